@@ -0,0 +1,98 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include <babylon/audio/audio_buffer.h>
+#include <babylon/audio/audio_engine.h>
+#include <babylon/audio/sound.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+
+namespace {
+
+using ns = uint64_t;
+
+template <typename F>
+ns measure(F&& f)
+{
+  const auto before = std::chrono::high_resolution_clock::now();
+  f();
+  const auto after = std::chrono::high_resolution_clock::now();
+  return static_cast<ns>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+}
+
+// Renders one second of a scene of looping positional sounds around the camera, at 60 frames
+// per second
+void measureMixer(size_t soundCount, size_t maxVoices, bool stereo)
+{
+  using namespace BABYLON;
+  Engine::audioEngine    = AudioEngine::New(48000u);
+  auto& audioEngine      = Engine::audioEngine;
+  audioEngine->maxVoices = maxVoices;
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+  FreeCamera::New("camera", Vector3::Zero(), scene.get());
+
+  // Two seconds of noise at 44.1 kHz, resampled by the mixer
+  const size_t numberOfChannels = stereo ? 2 : 1;
+  auto buffer                   = AudioBuffer::New(numberOfChannels, 88200u, 44100u);
+  for (size_t channel = 0; channel < numberOfChannels; ++channel) {
+    auto& data = buffer->getChannelData(channel);
+    for (size_t i = 0; i < data.size(); ++i) {
+      data[i] = std::sin(static_cast<float>(i * (channel + 1)) * 0.05f) * 0.1f;
+    }
+  }
+
+  ISoundOptions soundOptions;
+  soundOptions.loop         = true;
+  soundOptions.spatialSound = true;
+  soundOptions.maxDistance  = 60.f;
+  std::vector<SoundPtr> sounds;
+  for (size_t i = 0; i < soundCount; ++i) {
+    auto sound        = Sound::New("sound", buffer, scene.get(), nullptr, soundOptions);
+    const auto angle  = static_cast<float>(i) * 2.39996f;
+    const auto radius = 1.f + static_cast<float>(i % 50);
+    sound->setPosition(Vector3(std::cos(angle) * radius, 0.f, std::sin(angle) * radius));
+    sound->setPlaybackRate(0.8f + static_cast<float>(i % 5) * 0.1f);
+    sound->play();
+    sounds.emplace_back(sound);
+  }
+
+  const size_t frameCount = 60;
+  const size_t blockCount = 48000 / frameCount;
+  Float32Array output(blockCount * AudioEngine::NumberOfOutputChannels);
+  ns updateTime = 0;
+  ns renderTime = 0;
+  for (size_t frame = 0; frame < frameCount; ++frame) {
+    updateTime += measure([&]() { scene->render(); });
+    renderTime += measure([&]() { audioEngine->render(output.data(), blockCount); });
+  }
+
+  std::cout << "Mixer: " << soundCount << (stereo ? " stereo" : " mono") << " sounds, "
+            << maxVoices << " voices" << std::endl;
+  std::cout << "  Voices update: " << updateTime / frameCount / 1000.0 << " us per frame"
+            << std::endl;
+  std::cout << "  Mix          : " << renderTime / 1000000.0 << " ms per second of audio ("
+            << audioEngine->realVoiceCount() << " real, " << audioEngine->virtualVoiceCount()
+            << " virtual)" << std::endl;
+
+  for (const auto& sound : sounds) {
+    sound->dispose();
+  }
+  Engine::audioEngine = nullptr;
+}
+
+} // end of anonymous namespace
+
+TEST(AudioMixerBenchmark, PositionalSounds)
+{
+  measureMixer(500, 32, false);
+  measureMixer(500, 500, false);
+  measureMixer(500, 32, true);
+}
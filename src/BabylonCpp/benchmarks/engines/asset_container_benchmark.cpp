@@ -0,0 +1,99 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_group.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/animations/targeted_animation.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engines/asset_container.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/builders/sphere_builder.h>
+#include <babylon/meshes/geometry.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/transform_node.h>
+
+namespace {
+
+using ns = uint64_t;
+
+template <typename F>
+ns measure(F&& f)
+{
+  const auto before = std::chrono::high_resolution_clock::now();
+  f();
+  const auto after = std::chrono::high_resolution_clock::now();
+  return static_cast<ns>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+}
+
+} // end of anonymous namespace
+
+// A crowd: 1k characters, each a skinned mesh with a 32 bones skeleton and a walk animation
+TEST(AssetContainerBenchmark, InstantiateCrowd)
+{
+  using namespace BABYLON;
+  NullEngineOptions options;
+  auto engine    = NullEngine::New(options);
+  auto scene     = Scene::New(engine.get());
+  auto container = AssetContainer::New(scene.get());
+
+  const size_t boneCount = 32;
+  auto root              = TransformNode::New("character", scene.get());
+  SphereOptions sphereOptions;
+  sphereOptions.segments = 16;
+  auto body              = SphereBuilder::CreateSphere("body", sphereOptions, scene.get());
+  body->parent           = root.get();
+  auto skeleton          = Skeleton::New("skeleton", "skeleton", scene.get());
+  auto walk              = AnimationGroup::New("walk", scene.get());
+  Bone* parentBone       = nullptr;
+  for (size_t b = 0; b < boneCount; ++b) {
+    auto bone = Bone::New("bone" + std::to_string(b), skeleton.get(), parentBone);
+    auto animation
+      = Animation::New("walk", "position.y", 30, static_cast<int>(Animation::ANIMATIONTYPE_FLOAT));
+    animation->setKeys({IAnimationKey(0.f, AnimationValue(0.f)),
+                        IAnimationKey(30.f, AnimationValue(0.1f))});
+    walk->addTargetedAnimation(animation, bone);
+    parentBone = bone.get();
+  }
+  body->skeleton              = skeleton;
+  container->transformNodes  = scene->transformNodes;
+  container->meshes          = scene->meshes;
+  container->geometries      = scene->geometries;
+  container->skeletons       = scene->skeletons;
+  container->animationGroups = scene->animationGroups;
+  container->removeAllFromScene();
+
+  const size_t characterCount = 1000;
+  std::vector<InstantiatedEntries> characters;
+  characters.reserve(characterCount);
+  const auto instantiateTime = measure([&]() {
+    for (size_t c = 0; c < characterCount; ++c) {
+      characters.emplace_back(container->instantiateModelsToScene());
+    }
+  });
+
+  std::cout << "AssetContainer::instantiateModelsToScene: " << characterCount << " characters, "
+            << body->getTotalVertices() << " vertices and " << boneCount << " bones each"
+            << std::endl;
+  std::cout << "  Instantiate : " << instantiateTime / 1000000.0 << " ms ("
+            << instantiateTime / characterCount / 1000.0 << " us per character)" << std::endl;
+  std::cout << "  Scene       : " << scene->meshes.size() << " meshes, "
+            << scene->skeletons.size() << " skeletons, " << scene->animationGroups.size()
+            << " animation groups" << std::endl;
+  std::cout << "  Geometry    : shared by " << body->geometry()->meshes().size() << " meshes"
+            << std::endl;
+
+  const auto disposeTime = measure([&]() {
+    for (auto& character : characters) {
+      character.dispose();
+    }
+  });
+  std::cout << "  Dispose     : " << disposeTime / 1000000.0 << " ms" << std::endl;
+}
@@ -0,0 +1,83 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include <babylon/actions/action_manager.h>
+#include <babylon/actions/directactions/execute_code_action.h>
+#include <babylon/actions/iaction_event.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/box_builder.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+
+namespace {
+
+using ns = uint64_t;
+
+template <typename F>
+ns measure(F&& f)
+{
+  const auto before = std::chrono::high_resolution_clock::now();
+  f();
+  const auto after = std::chrono::high_resolution_clock::now();
+  return static_cast<ns>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+}
+
+// Trigger volumes scattered on a plane with a constant density, each one checking all the others,
+// half of them moving every frame
+void measureTriggerVolumes(size_t volumeCount)
+{
+  using namespace BABYLON;
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+  FreeCamera::New("camera", Vector3(0.f, 10.f, -10.f), scene.get());
+
+  BoxOptions boxOptions;
+  const auto spread = 2.f * std::sqrt(static_cast<float>(volumeCount));
+  std::vector<MeshPtr> volumes;
+  size_t eventCount = 0;
+  const auto onEvent = [&eventCount](const std::optional<IActionEvent>&) { ++eventCount; };
+  for (size_t i = 0; i < volumeCount; ++i) {
+    auto volume       = BoxBuilder::CreateBox("volume", boxOptions, scene.get());
+    volume->isVisible = false;
+    volume->position  = Vector3(spread * static_cast<float>((i * 37) % 101) / 101.f, 0.f,
+                               spread * static_cast<float>((i * 53) % 97) / 97.f);
+    volume->actionManager = ActionManager::New(scene.get());
+    volume->actionManager->registerAction(
+      std::make_shared<ExecuteCodeAction>(ActionManager::OnIntersectionEnterTrigger, onEvent));
+    volume->actionManager->registerAction(
+      std::make_shared<ExecuteCodeAction>(ActionManager::OnIntersectionExitTrigger, onEvent));
+    volumes.emplace_back(volume);
+  }
+
+  const size_t frameCount = 60;
+  scene->render();
+  const auto renderTime = measure([&]() {
+    for (size_t frame = 0; frame < frameCount; ++frame) {
+      for (size_t i = 0; i < volumeCount; i += 2) {
+        volumes[i]->position().x += (frame % 20 < 10) ? 0.1f : -0.1f;
+      }
+      scene->render();
+    }
+  });
+
+  std::cout << "Intersection triggers: " << volumeCount << " volumes, " << eventCount
+            << " events" << std::endl;
+  std::cout << "  Render : " << renderTime / frameCount / 1000.0 << " us per frame" << std::endl;
+}
+
+} // end of anonymous namespace
+
+TEST(IntersectionTriggersBenchmark, TriggerVolumes)
+{
+  for (const auto volumeCount : {125u, 250u, 500u, 1000u}) {
+    measureTriggerVolumes(volumeCount);
+  }
+}
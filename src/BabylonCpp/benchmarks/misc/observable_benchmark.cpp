@@ -0,0 +1,89 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include <babylon/misc/observable.h>
+#include <babylon/misc/small_observable.h>
+
+namespace {
+
+using ns = uint64_t;
+
+struct FrameData {
+  int counter = 0;
+};
+
+template <typename F>
+ns measure(F&& f)
+{
+  const auto before = std::chrono::high_resolution_clock::now();
+  f();
+  const auto after = std::chrono::high_resolution_clock::now();
+  return static_cast<ns>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+}
+
+template <typename OBSERVABLE, typename HANDLE>
+void runOperationSet(size_t observerCount, size_t notifyCount, ns& addTime, ns& notifyTime,
+                     ns& removeTime)
+{
+  FrameData data;
+  OBSERVABLE observable;
+  std::vector<HANDLE> handles(observerCount);
+
+  addTime = measure([&]() {
+    for (size_t i = 0; i < observerCount; ++i) {
+      handles[i] = observable.add([](FrameData* eventData, BABYLON::EventState& /*es*/) {
+        ++eventData->counter;
+      });
+    }
+  });
+  notifyTime = measure([&]() {
+    for (size_t i = 0; i < notifyCount; ++i) {
+      observable.notifyObservers(&data);
+    }
+  });
+  removeTime = measure([&]() {
+    for (auto& handle : handles) {
+      observable.remove(handle);
+    }
+  });
+  EXPECT_EQ(data.counter, static_cast<int>(observerCount * notifyCount));
+}
+
+void compare(size_t observerCount, size_t notifyCount)
+{
+  using namespace BABYLON;
+
+  ns addTime1, notifyTime1, removeTime1, addTime2, notifyTime2, removeTime2;
+  runOperationSet<Observable<FrameData>, Observer<FrameData>::Ptr>(
+    observerCount, notifyCount, addTime1, notifyTime1, removeTime1);
+  runOperationSet<SmallObservable<FrameData>, ObserverHandle>(
+    observerCount, notifyCount, addTime2, notifyTime2, removeTime2);
+
+  std::cout << observerCount << " observers, " << notifyCount
+            << " notifications, Observable vs. SmallObservable:" << std::endl;
+  std::cout << "\tAdd: " << addTime1 << " vs. " << addTime2 << std::endl;
+  std::cout << "\tNotify: " << notifyTime1 << " vs. " << notifyTime2 << std::endl;
+  std::cout << "\tRemove: " << removeTime1 << " vs. " << removeTime2 << std::endl;
+  std::cout << "\tNotify gain:\t" << 1.0 * notifyTime1 / notifyTime2 << std::endl;
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkObservable, emptyObservable)
+{
+  compare(0, 1000000);
+}
+
+TEST(BenchmarkObservable, fewObservers)
+{
+  compare(3, 1000000);
+}
+
+TEST(BenchmarkObservable, manyObservers)
+{
+  compare(1000, 10000);
+}
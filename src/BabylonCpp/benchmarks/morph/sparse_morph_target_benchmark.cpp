@@ -0,0 +1,91 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/ground_builder.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/ground_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/morph/sparse_morph_target_manager.h>
+
+namespace {
+
+using ns = uint64_t;
+
+template <typename F>
+ns measure(F&& f)
+{
+  const auto before = std::chrono::high_resolution_clock::now();
+  f();
+  const auto after = std::chrono::high_resolution_clock::now();
+  return static_cast<ns>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+}
+
+// A facial rig: 150 targets moving 3% of the vertices each, 12 of them active at once and
+// animated every frame
+void measureBlend(bool quantize)
+{
+  using namespace BABYLON;
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+  GroundOptions groundOptions;
+  groundOptions.subdivisions = 140;
+  auto mesh                  = GroundBuilder::CreateGround("face", groundOptions, scene.get());
+  const auto vertexCount     = mesh->getTotalVertices();
+
+  const size_t targetCount = 150;
+  const size_t activeCount = 12;
+  const size_t movedCount  = vertexCount * 3 / 100;
+  auto manager             = SparseMorphTargetManager::New(mesh);
+  for (size_t t = 0; t < targetCount; ++t) {
+    IndicesArray indices(movedCount);
+    Float32Array positions(movedCount * 3);
+    Float32Array normals(movedCount * 3);
+    const auto first = (t * 997) % (vertexCount - movedCount);
+    for (size_t i = 0; i < movedCount; ++i) {
+      indices[i]           = static_cast<uint32_t>(first + i);
+      positions[3 * i + 1] = 0.01f * static_cast<float>(i % 7);
+      normals[3 * i]       = 0.001f * static_cast<float>(i % 5);
+    }
+    auto target = SparseMorphTarget::New("target", t < activeCount ? 0.5f : 0.f);
+    target->setPositions(indices, positions);
+    target->setNormals(indices, normals);
+    if (quantize) {
+      target->quantize();
+    }
+    manager->addTarget(target);
+  }
+
+  const size_t frameCount = 120;
+  ns blendTime            = 0;
+  for (size_t frame = 0; frame < frameCount; ++frame) {
+    for (size_t t = 0; t < activeCount; ++t) {
+      manager->getTarget(t)->influence = 0.5f + 0.5f * static_cast<float>((frame + t) % 10) / 10.f;
+    }
+    blendTime += measure([&]() { manager->update(); });
+  }
+  const auto unchangedTime = measure([&]() { manager->update(); });
+
+  const auto denseByteLength = targetCount * vertexCount * 2 * 3 * sizeof(float);
+  std::cout << "Sparse morph targets: " << vertexCount << " vertices, " << targetCount
+            << " targets, " << activeCount << " active" << (quantize ? ", quantized" : "")
+            << std::endl;
+  std::cout << "  Memory    : " << manager->getByteLength() / 1024 << " KiB (dense: "
+            << denseByteLength / 1024 << " KiB)" << std::endl;
+  std::cout << "  Blend     : " << blendTime / frameCount / 1000.0 << " us per frame" << std::endl;
+  std::cout << "  Unchanged : " << unchangedTime / 1000.0 << " us" << std::endl;
+}
+
+} // end of anonymous namespace
+
+TEST(SparseMorphTargetBenchmark, FacialRig)
+{
+  measureBlend(false);
+  measureBlend(true);
+}
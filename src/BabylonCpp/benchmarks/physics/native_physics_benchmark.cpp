@@ -0,0 +1,335 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/box_builder.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/builders/sphere_builder.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/physics/helper/physics_affected_impostor_with_data.h>
+#include <babylon/physics/helper/physics_helper.h>
+#include <babylon/physics/helper/physics_hit_data.h>
+#include <babylon/physics/helper/physics_radial_explosion_event.h>
+#include <babylon/physics/iphysics_engine.h>
+#include <babylon/physics/physics_impostor.h>
+#include <babylon/physics/physics_impostor_parameters.h>
+#include <babylon/physics/plugins/native/physics_world.h>
+#include <babylon/physics/plugins/native_physics_plugin.h>
+
+namespace {
+
+using namespace BABYLON::NativePhysics;
+
+using ns = uint64_t;
+
+constexpr float TimeStep = 1.f / 60.f;
+
+template <typename F>
+ns measure(F&& f)
+{
+  const auto before = std::chrono::high_resolution_clock::now();
+  f();
+  const auto after = std::chrono::high_resolution_clock::now();
+  return static_cast<ns>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+}
+
+BodyId addGround(PhysicsWorld& world, float halfSize)
+{
+  BodyDefinition definition;
+  definition.shape    = CollisionShape::CreateBox({halfSize, 0.5f, halfSize});
+  definition.position = {0.f, -0.5f, 0.f};
+  return world.createBody(definition);
+}
+
+void runSteps(PhysicsWorld& world, size_t stepCount, const char* name)
+{
+  ns maxStepTime = 0;
+  const ns totalTime = measure([&]() {
+    for (size_t i = 0; i < stepCount; ++i) {
+      const auto stepTime = measure([&]() { world.step(TimeStep); });
+      maxStepTime         = std::max(maxStepTime, stepTime);
+    }
+  });
+
+  std::cout << name << ": " << world.bodyCount() << " bodies, " << stepCount << " steps"
+            << std::endl;
+  std::cout << "  Mean step   : " << totalTime / stepCount / 1000000.0 << " ms" << std::endl;
+  std::cout << "  Max step    : " << maxStepTime / 1000000.0 << " ms" << std::endl;
+  std::cout << "  Contacts    : " << world.contactCount() << std::endl;
+  std::cout << "  Awake bodies: " << world.awakeBodyCount() << std::endl;
+}
+
+// Pyramid, one large island, surrounded by small stacks of three boxes
+void createPilesAndStacks(PhysicsWorld& world, size_t stackCount)
+{
+  addGround(world, 200.f);
+  BodyDefinition definition;
+  definition.shape    = CollisionShape::CreateBox({0.5f, 0.5f, 0.5f});
+  definition.mass     = 1.f;
+  definition.friction = 0.6f;
+
+  const size_t baseCount = 30;
+  for (size_t row = 0; row < baseCount; ++row) {
+    for (size_t i = 0; i < baseCount - row; ++i) {
+      definition.position = {(i - (baseCount - row - 1) * 0.5f) * 1.05f, 0.5f + row * 1.f, 0.f};
+      world.createBody(definition);
+    }
+  }
+  const auto side = static_cast<size_t>(std::sqrt(static_cast<float>(stackCount))) + 1;
+  for (size_t i = 0; i < stackCount; ++i) {
+    const auto x = (static_cast<float>(i % side) - side * 0.5f) * 2.5f;
+    const auto z = static_cast<float>(i / side) * 2.5f + 5.f;
+    for (size_t level = 0; level < 3; ++level) {
+      definition.position = {x, 0.5f + level * 1.f, z};
+      world.createBody(definition);
+    }
+  }
+}
+
+// Times the physics steps of a scene of boxes falling on the ground, then resting
+void measureTransformSync(size_t boxCount, bool bulk)
+{
+  using namespace BABYLON;
+  NativePhysicsPlugin plugin;
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+  scene->enablePhysics(Vector3(0.f, -9.81f, 0.f), &plugin);
+
+  BoxOptions groundOptions;
+  groundOptions.width  = 400.f;
+  groundOptions.height = 1.f;
+  groundOptions.depth  = 400.f;
+  auto ground          = BoxBuilder::CreateBox("ground", groundOptions, scene.get());
+  ground->position().y = -0.5f;
+  PhysicsImpostorParameters groundParameters;
+  groundParameters.mass   = 0.f;
+  ground->physicsImpostor = std::make_shared<PhysicsImpostor>(
+    ground.get(), PhysicsImpostor::BoxImpostor, groundParameters, scene.get());
+
+  BoxOptions boxOptions;
+  boxOptions.size = 1.f;
+  const auto side = static_cast<size_t>(std::sqrt(static_cast<float>(boxCount))) + 1;
+  for (size_t i = 0; i < boxCount; ++i) {
+    auto box = BoxBuilder::CreateBox("box", boxOptions, scene.get());
+    box->position().set((static_cast<float>(i % side) - side * 0.5f) * 2.f, 1.f,
+                        (static_cast<float>(i / side) - side * 0.5f) * 2.f);
+    PhysicsImpostorParameters parameters;
+    parameters.mass      = 1.f;
+    box->physicsImpostor = std::make_shared<PhysicsImpostor>(
+      box.get(), PhysicsImpostor::BoxImpostor, parameters, scene.get());
+    if (!bulk) {
+      // A step callback sends the impostor through beforeStep and afterStep
+      box->physicsImpostor()->registerBeforePhysicsStep([](PhysicsImpostor* /*impostor*/) {});
+    }
+  }
+
+  auto& physicsEngine    = *scene->getPhysicsEngine();
+  const size_t stepCount = 60;
+  const ns fallingTime   = measure([&]() {
+    for (size_t i = 0; i < stepCount; ++i) {
+      physicsEngine._step(TimeStep);
+    }
+  });
+  for (size_t i = 0; i < 120; ++i) {
+    physicsEngine._step(TimeStep);
+  }
+  const ns restingTime = measure([&]() {
+    for (size_t i = 0; i < stepCount; ++i) {
+      physicsEngine._step(TimeStep);
+    }
+  });
+
+  std::cout << "  " << (bulk ? "Bulk     " : "Per body ") << ": falling "
+            << fallingTime / stepCount / 1000000.0 << " ms, resting "
+            << restingTime / stepCount / 1000000.0 << " ms per step, "
+            << plugin.physicsWorld().awakeBodyCount() << " awake bodies" << std::endl;
+}
+
+} // end of anonymous namespace
+
+TEST(NativePhysicsBenchmark, PyramidStacking)
+{
+  PhysicsWorld world;
+  addGround(world, 50.f);
+  const size_t baseCount = 20;
+  std::vector<BodyId> boxes;
+  for (size_t row = 0; row < baseCount; ++row) {
+    for (size_t i = 0; i < baseCount - row; ++i) {
+      BodyDefinition definition;
+      definition.shape    = CollisionShape::CreateBox({0.5f, 0.5f, 0.5f});
+      definition.position = {(i - (baseCount - row - 1) * 0.5f) * 1.05f, 0.5f + row * 1.f, 0.f};
+      definition.mass     = 1.f;
+      definition.friction = 0.6f;
+      boxes.emplace_back(world.createBody(definition));
+    }
+  }
+
+  runSteps(world, 600, "Pyramid stacking");
+
+  // The top box is still on top of the pyramid
+  const auto& top = world.body(boxes.back());
+  EXPECT_NEAR(top.position.y, 0.5f + (baseCount - 1) * 1.f, 0.25f);
+}
+
+TEST(NativePhysicsBenchmark, FallingBodies)
+{
+  PhysicsWorld world;
+  addGround(world, 200.f);
+  // 10k spheres, boxes and capsules dropped in a grid
+  const size_t sideCount = 100;
+  for (size_t i = 0; i < sideCount * sideCount; ++i) {
+    BodyDefinition definition;
+    switch (i % 3) {
+      case 0:
+        definition.shape = CollisionShape::CreateSphere(0.5f);
+        break;
+      case 1:
+        definition.shape = CollisionShape::CreateBox({0.5f, 0.5f, 0.5f});
+        break;
+      default:
+        definition.shape = CollisionShape::CreateCapsule(0.3f, 0.3f);
+        break;
+    }
+    const auto x        = static_cast<float>(i % sideCount);
+    const auto z        = static_cast<float>(i / sideCount);
+    definition.position = {(x - sideCount * 0.5f) * 1.5f, 2.f + (i % 7) * 0.5f,
+                           (z - sideCount * 0.5f) * 1.5f};
+    definition.mass     = 1.f;
+    world.createBody(definition);
+  }
+
+  runSteps(world, 300, "Falling bodies");
+
+  EXPECT_EQ(world.bodyCount(), sideCount * sideCount + 1);
+}
+
+TEST(NativePhysicsBenchmark, ThreadScaling)
+{
+  BABYLON::ThreadPool singleThread{1};
+  auto& threadPool = BABYLON::ThreadPool::Default();
+
+  PhysicsWorld sequentialWorld;
+  sequentialWorld.setThreadPool(&singleThread);
+  createPilesAndStacks(sequentialWorld, 3000);
+  PhysicsWorld parallelWorld;
+  parallelWorld.setThreadPool(&threadPool);
+  createPilesAndStacks(parallelWorld, 3000);
+
+  const size_t stepCount = 120;
+
+  const ns sequentialTime = measure([&]() {
+    for (size_t i = 0; i < stepCount; ++i) {
+      sequentialWorld.step(TimeStep);
+    }
+  });
+  const ns parallelTime = measure([&]() {
+    for (size_t i = 0; i < stepCount; ++i) {
+      parallelWorld.step(TimeStep);
+    }
+  });
+
+  std::cout << "Thread scaling: " << parallelWorld.bodyCount() << " bodies, " << stepCount
+            << " steps" << std::endl;
+  std::cout << "  1 thread    : " << sequentialTime / stepCount / 1000000.0 << " ms per step"
+            << std::endl;
+  std::cout << "  " << threadPool.workerCount() << " threads   : "
+            << parallelTime / stepCount / 1000000.0 << " ms per step" << std::endl;
+
+  // Deterministic whatever the number of threads
+  for (BodyId id = 0; id < parallelWorld.bodyCount(); ++id) {
+    EXPECT_EQ(sequentialWorld.body(id).position.y, parallelWorld.body(id).position.y);
+  }
+}
+
+TEST(NativePhysicsBenchmark, TransformSync)
+{
+  std::cout << "Transform synchronization: 2000 impostors" << std::endl;
+  measureTransformSync(2000, false);
+  measureTransformSync(2000, true);
+}
+
+TEST(NativePhysicsBenchmark, RadialExplosion)
+{
+  using namespace BABYLON;
+  NativePhysicsPlugin plugin;
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+  scene->enablePhysics(Vector3::Zero(), &plugin);
+
+  // 20k spheres spread on a grid
+  const size_t sideCount = 142;
+  SphereOptions sphereOptions;
+  sphereOptions.diameter = 1.f;
+  sphereOptions.segments = 4;
+  std::vector<MeshPtr> spheres;
+  for (size_t i = 0; i < sideCount * sideCount; ++i) {
+    auto sphere = SphereBuilder::CreateSphere("sphere", sphereOptions, scene.get());
+    sphere->position().set((static_cast<float>(i % sideCount) - sideCount * 0.5f) * 2.f, 0.f,
+                           (static_cast<float>(i / sideCount) - sideCount * 0.5f) * 2.f);
+    sphere->computeWorldMatrix(true);
+    PhysicsImpostorParameters parameters;
+    parameters.mass         = 1.f;
+    sphere->physicsImpostor = std::make_shared<PhysicsImpostor>(
+      sphere.get(), PhysicsImpostor::SphereImpostor, parameters, scene.get());
+    spheres.emplace_back(sphere);
+  }
+  auto& physicsEngine   = *scene->getPhysicsEngine();
+  const auto& impostors = physicsEngine.getImpostors();
+
+  PhysicsHelper physicsHelper{scene.get()};
+  PhysicsRadialExplosionEventOptions eventOptions;
+  eventOptions.radius   = 10.f;
+  eventOptions.strength = 20.f;
+  size_t affectedCount  = 0;
+  eventOptions.affectedImpostorsCallback
+    = [&](const std::vector<PhysicsAffectedImpostorWithData>& affectedImpostorsWithData) {
+        affectedCount = affectedImpostorsWithData.size();
+      };
+  PhysicsHelper::RadiusOrPhysicsRadialExplosionEventOptions radiusOrEventOptions = eventOptions;
+  const size_t explosionCount = 20;
+  const ns explosionTime      = measure([&]() {
+    for (size_t i = 0; i < explosionCount; ++i) {
+      physicsHelper.applyRadialExplosionImpulse(Vector3::Zero(), radiusOrEventOptions);
+    }
+  });
+
+  // Hit test of every impostor, without broadphase query
+  size_t hitCount = 0;
+  PhysicsRadialExplosionEvent event{scene.get(), eventOptions};
+  const ns scanTime = measure([&]() {
+    for (const auto& impostor : impostors) {
+      if (event.getImpostorHitData(*impostor, Vector3::Zero())) {
+        ++hitCount;
+      }
+    }
+  });
+
+  // Impostor of each body
+  size_t foundCount   = 0;
+  const ns lookupTime = measure([&]() {
+    for (const auto& impostor : impostors) {
+      if (physicsEngine.getImpostorWithPhysicsBody(impostor->physicsBody())) {
+        ++foundCount;
+      }
+    }
+  });
+
+  std::cout << "Radial explosion: " << impostors.size() << " impostors, " << affectedCount
+            << " affected" << std::endl;
+  std::cout << "  Explosion      : " << explosionTime / explosionCount / 1000000.0 << " ms"
+            << std::endl;
+  std::cout << "  All hit tests  : " << scanTime / 1000000.0 << " ms" << std::endl;
+  std::cout << "  Body lookups   : " << lookupTime / 1000000.0 << " ms" << std::endl;
+
+  EXPECT_EQ(affectedCount, hitCount);
+  EXPECT_EQ(foundCount, impostors.size());
+}
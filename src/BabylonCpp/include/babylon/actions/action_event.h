@@ -40,7 +40,8 @@ public:
    * @returns the new ActionEvent
    */
   static ActionEvent CreateNew(const AbstractMeshPtr& source,
-                               const std::optional<Event>& evt = std::nullopt);
+                               const std::optional<Event>& evt = std::nullopt,
+                               const std::string& additionalData = "");
 
   /**
    * @brief Helper function to auto-create an ActionEvent from a source sprite.
@@ -23,6 +23,9 @@ public:
   ExecuteCodeAction(unsigned int triggerOptions,
                     const std::function<void(const std::optional<IActionEvent>& evt)>& func,
                     Condition* condition = nullptr);
+  ExecuteCodeAction(const TriggerOptions& triggerOptions,
+                    const std::function<void(const std::optional<IActionEvent>& evt)>& func,
+                    Condition* condition = nullptr);
   ~ExecuteCodeAction() override; // = default
 
   /**
@@ -9,6 +9,7 @@
 #include <babylon/animations/animation_value.h>
 #include <babylon/animations/easing/ieasing_function.h>
 #include <babylon/babylon_api.h>
+#include <babylon/core/profiling/memory_tracker.h>
 
 using json = nlohmann::json;
 
@@ -626,6 +627,12 @@ public:
    */
   ReadOnlyProperty<Animation, bool> hasRunningRuntimeAnimations;
 
+  /**
+   * Hidden
+   * Memory used by the key frames
+   */
+  TrackedMemory _keysMemory;
+
 private:
   /**
    * Stores the key frames of the animation
@@ -1,14 +1,200 @@
-#ifndef BABYLON_AUDIO_ANALYSER_H
-#define BABYLON_AUDIO_ANALYSER_H
-
-#include <babylon/babylon_api.h>
-
-namespace BABYLON {
-
-class BABYLON_SHARED_EXPORT Analyser {
-
-}; // end of class Analyser
-
-} // end of namespace BABYLON
-
-#endif // end of BABYLON_AUDIO_ANALYSER_H
+#ifndef BABYLON_AUDIO_ANALYSER_H
+#define BABYLON_AUDIO_ANALYSER_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class Analyser;
+class AudioEngine;
+class Scene;
+using AnalyserPtr    = std::shared_ptr<Analyser>;
+using AudioEnginePtr = std::shared_ptr<AudioEngine>;
+
+/**
+ * @brief Class used to work with sound analyzer using fast fourier transform (FFT).
+ *
+ * The analyser taps the output of the audio engine once connected with
+ * AudioEngine::connectToAnalyser. The mixer copies the output into a lock-free ring buffer and a
+ * worker thread computes the frequency and time domain data, as the AnalyserNode of WebAudio
+ * does. The results are handed back through lock-free buffers: the get functions only copy the
+ * latest results and never wait for the worker.
+ * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music
+ */
+class BABYLON_SHARED_EXPORT Analyser {
+
+public:
+  /**
+   * The largest supported FFT size
+   */
+  static constexpr size_t MaxFFTSize = 32768;
+
+public:
+  template <typename... Ts>
+  static AnalyserPtr New(Ts&&... args)
+  {
+    return std::shared_ptr<Analyser>(new Analyser(std::forward<Ts>(args)...));
+  }
+  ~Analyser(); // = default
+
+  Analyser(const Analyser&) = delete;
+  Analyser& operator=(const Analyser&) = delete;
+
+  /**
+   * @brief Get the number of data values you will have to play with for the visualization.
+   * @see https://developer.mozilla.org/en-US/docs/Web/API/AnalyserNode/frequencyBinCount
+   * @returns a number
+   */
+  size_t getFrequencyBinCount();
+
+  /**
+   * @brief Gets the current frequency data as a byte array.
+   * @see https://developer.mozilla.org/en-US/docs/Web/API/AnalyserNode/getByteFrequencyData
+   * @returns a Uint8Array
+   */
+  Uint8Array& getByteFrequencyData();
+
+  /**
+   * @brief Gets the current waveform as a byte array.
+   * @see https://developer.mozilla.org/en-US/docs/Web/API/AnalyserNode/getByteTimeDomainData
+   * @returns a Uint8Array
+   */
+  Uint8Array& getByteTimeDomainData();
+
+  /**
+   * @brief Gets the current frequency data as a float array, in decibels.
+   * @see https://developer.mozilla.org/en-US/docs/Web/API/AnalyserNode/getFloatFrequencyData
+   * @returns a Float32Array
+   */
+  Float32Array& getFloatFrequencyData();
+
+  /**
+   * @brief Gets the current waveform as a float array.
+   * @see https://developer.mozilla.org/en-US/docs/Web/API/AnalyserNode/getFloatTimeDomainData
+   * @returns a Float32Array
+   */
+  Float32Array& getFloatTimeDomainData();
+
+  /**
+   * @brief Release all associated resources.
+   */
+  void dispose();
+
+  /**
+   * @brief Copies the output of the mixer, called by the audio engine.
+   * @param frames defines the interleaved stereo frames
+   * @param frameCount defines the number of frames
+   * @hidden
+   */
+  void _write(const float* frames, size_t frameCount);
+
+  /**
+   * @brief Gets the number of frames written by the mixer when the results returned by the get
+   * functions were computed.
+   * @hidden
+   */
+  [[nodiscard]] uint64_t _getAnalysedFrameCount() const;
+
+protected:
+  /**
+   * @brief Creates a new analyser.
+   * @param scene defines hosting scene
+   */
+  Analyser(Scene* scene);
+
+private:
+  struct FFT;
+  struct Results {
+    uint64_t frameCount = 0;
+    size_t fftSize      = 0;
+    Float32Array floatFrequencyData;
+    Uint8Array byteFrequencyData;
+    Float32Array floatTimeDomainData;
+    Uint8Array byteTimeDomainData;
+  };
+
+  void _updateParameters();
+  const Results& _fetchResults();
+  void _run();
+  void _analyse();
+
+public:
+  /**
+   * Gets or sets the smoothing time constant, between 0 and 1
+   * @ignorenaming
+   */
+  float SMOOTHING;
+
+  /**
+   * Gets or sets the FFT table size, a power of two between 32 and 32768
+   * @ignorenaming
+   */
+  size_t FFT_SIZE;
+
+  /**
+   * Gets or sets the bar graph amplitude
+   * @ignorenaming
+   */
+  float BARGRAPHAMPLITUDE;
+
+  /**
+   * The power value in decibels mapped to 0 in the byte frequency data
+   */
+  float minDecibels;
+
+  /**
+   * The power value in decibels mapped to 255 in the byte frequency data
+   */
+  float maxDecibels;
+
+private:
+  Scene* _scene;
+  AudioEnginePtr _audioEngine;
+
+  // Parameters read by the worker
+  std::atomic<size_t> _fftSize;
+  std::atomic<float> _smoothing;
+  std::atomic<float> _minDecibels;
+  std::atomic<float> _maxDecibels;
+
+  // Mono downmix of the output of the mixer
+  std::unique_ptr<std::atomic<float>[]> _samples;
+  alignas(64) std::atomic<uint64_t> _writtenFrameCount;
+
+  // The worker publishes the results in the middle slot and takes the previous one back, the
+  // reader swaps its slot with the middle one when it holds newer results
+  static constexpr unsigned int NewResultsFlag = 4;
+  std::array<Results, 3> _results;
+  alignas(64) std::atomic<unsigned int> _middleResults;
+  unsigned int _readerResults;
+  unsigned int _workerResults;
+
+  // State of the worker
+  uint64_t _lastAnalysedFrameCount;
+  std::unique_ptr<FFT> _fft;
+  Float32Array _timeDomain;
+  Float32Array _smoothedMagnitudes;
+  std::mutex _workerMutex;
+  std::condition_variable _workerCondition;
+  bool _stopWorker;
+  std::thread _worker;
+
+  // Data returned to the caller
+  Uint8Array _byteFreqs;
+  Uint8Array _byteTime;
+  Float32Array _floatFreqs;
+  Float32Array _floatTime;
+
+}; // end of class Analyser
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_AUDIO_ANALYSER_H
@@ -0,0 +1,114 @@
+#ifndef BABYLON_AUDIO_AUDIO_BUFFER_H
+#define BABYLON_AUDIO_AUDIO_BUFFER_H
+
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class AudioBuffer;
+using AudioBufferPtr = std::shared_ptr<AudioBuffer>;
+
+/**
+ * @brief Decoded audio data in memory: one array of samples in [-1, 1] per channel.
+ */
+class BABYLON_SHARED_EXPORT AudioBuffer {
+
+public:
+  template <typename... Ts>
+  static AudioBufferPtr New(Ts&&... args)
+  {
+    return std::shared_ptr<AudioBuffer>(new AudioBuffer(std::forward<Ts>(args)...));
+  }
+  ~AudioBuffer(); // = default
+
+  /**
+   * @brief Decodes a WAV file held in memory. PCM data of 8, 16, 24 and 32 bits and IEEE float
+   * data of 32 and 64 bits are supported.
+   * @param data defines the content of the file
+   * @returns the decoded buffer, or null if the data cannot be decoded
+   */
+  static AudioBufferPtr DecodeWav(const ArrayBuffer& data);
+
+  /**
+   * @brief Decodes interleaved PCM samples held in memory.
+   * @param data defines the interleaved little endian samples
+   * @param byteLength defines the size of the data in bytes
+   * @param numberOfChannels defines the number of channels
+   * @param sampleRate defines the sample rate in Hz
+   * @param bitsPerSample defines the size of a sample: 8, 16, 24 or 32 bits for integer samples,
+   * 32 or 64 bits for floating point samples
+   * @param isFloat defines whether the samples are IEEE floating point numbers
+   * @returns the decoded buffer, or null if the format is not supported
+   */
+  static AudioBufferPtr DecodePCM(const uint8_t* data, size_t byteLength, size_t numberOfChannels,
+                                  size_t sampleRate, unsigned int bitsPerSample,
+                                  bool isFloat = false);
+
+  /**
+   * @brief Gets the samples of a channel.
+   */
+  Float32Array& getChannelData(size_t channel)
+  {
+    return _channels[channel];
+  }
+
+  [[nodiscard]] const Float32Array& getChannelData(size_t channel) const
+  {
+    return _channels[channel];
+  }
+
+  /**
+   * @brief Gets the number of channels.
+   */
+  [[nodiscard]] size_t numberOfChannels() const
+  {
+    return _channels.size();
+  }
+
+  /**
+   * @brief Gets the number of sample frames.
+   */
+  [[nodiscard]] size_t length() const
+  {
+    return _length;
+  }
+
+  /**
+   * @brief Gets the sample rate in Hz.
+   */
+  [[nodiscard]] size_t sampleRate() const
+  {
+    return _sampleRate;
+  }
+
+  /**
+   * @brief Gets the duration in seconds.
+   */
+  [[nodiscard]] float duration() const
+  {
+    return static_cast<float>(_length) / static_cast<float>(_sampleRate);
+  }
+
+protected:
+  /**
+   * @brief Creates a silent buffer.
+   * @param numberOfChannels defines the number of channels
+   * @param length defines the number of sample frames
+   * @param sampleRate defines the sample rate in Hz
+   */
+  AudioBuffer(size_t numberOfChannels, size_t length, size_t sampleRate);
+
+private:
+  std::vector<Float32Array> _channels;
+  size_t _length;
+  size_t _sampleRate;
+
+}; // end of class AudioBuffer
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_AUDIO_AUDIO_BUFFER_H
@@ -1,17 +1,235 @@
-#ifndef BABYLON_AUDIO_ENGINE_H
-#define BABYLON_AUDIO_ENGINE_H
-
-#include <babylon/babylon_api.h>
-
-namespace BABYLON {
-
-class BABYLON_SHARED_EXPORT AudioEngine {
-
-public:
-    bool canUseWebAudio;
-
-}; // end of class AudioEngine
-
-} // end of namespace BABYLON
-
-#endif // end of BABYLON_AUDIO_ENGINE_H
+#ifndef BABYLON_AUDIO_ENGINE_H
+#define BABYLON_AUDIO_ENGINE_H
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class Analyser;
+class AudioBuffer;
+class AudioEngine;
+struct AudioVoice;
+using AnalyserPtr    = std::shared_ptr<Analyser>;
+using AudioBufferPtr = std::shared_ptr<AudioBuffer>;
+using AudioEnginePtr = std::shared_ptr<AudioEngine>;
+using AudioVoicePtr  = std::shared_ptr<AudioVoice>;
+
+/**
+ * @brief Playback state of a buffer in the mixer. The fields are written under the lock of the
+ * audio engine.
+ * @hidden
+ */
+struct BABYLON_SHARED_EXPORT AudioVoice {
+  /** The played buffer */
+  AudioBufferPtr buffer = nullptr;
+  /** The read position in frames of the buffer */
+  double position = 0.0;
+  /** The position in frames of the buffer where the playback stops when not looping */
+  double end = 0.0;
+  /** Whether the whole buffer is played in loop */
+  bool loop = false;
+  /** The speed of the playback */
+  float playbackRate = 1.f;
+  /** Target gains from the input channels to the output channels: LL, LR, RL, RR. A mono
+   * buffer feeds the output channels through LL and RR */
+  std::array<float, 4> gains{{1.f, 0.f, 0.f, 1.f}};
+  /** Gains applied at the end of the last rendered block, ramped toward the target gains */
+  std::array<float, 4> currentGains{{0.f, 0.f, 0.f, 0.f}};
+  /** Voices of higher priority are kept real first when the budget is exceeded */
+  int priority = 0;
+  /** A virtual voice only advances its position, it is not mixed */
+  bool isVirtual = false;
+  /** Number of output frames to wait before starting the playback */
+  size_t delayFrames = 0;
+  /** Number of output frames to play before stopping the playback */
+  std::optional<size_t> stopFrames = std::nullopt;
+  /** Set by the mixer once the voice reached its end or its stop time */
+  std::atomic<bool> ended{false};
+
+  /**
+   * @brief Gets the highest gain of the voice, used to choose the voices to virtualize.
+   */
+  [[nodiscard]] float audibility() const;
+}; // end of struct AudioVoice
+
+/**
+ * @brief Software audio engine mixing the playing sounds into a stereo bus.
+ * The engine does not open any sound device: the output is pulled by calling render, either from
+ * the callback of a platform audio device or offline into a buffer.
+ * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music
+ */
+class BABYLON_SHARED_EXPORT AudioEngine {
+
+public:
+  /**
+   * The number of frames mixed at once, the gain changes are ramped over a block
+   */
+  static constexpr size_t BlockSize = 128;
+
+  /**
+   * The number of interleaved channels of the output
+   */
+  static constexpr size_t NumberOfOutputChannels = 2;
+
+public:
+  template <typename... Ts>
+  static AudioEnginePtr New(Ts&&... args)
+  {
+    return std::shared_ptr<AudioEngine>(new AudioEngine(std::forward<Ts>(args)...));
+  }
+  ~AudioEngine(); // = default
+
+  /**
+   * @brief Gets the sample rate of the output in Hz.
+   */
+  [[nodiscard]] size_t sampleRate() const
+  {
+    return _sampleRate;
+  }
+
+  /**
+   * @brief Gets the time in seconds of the next frame to render.
+   */
+  [[nodiscard]] float currentTime() const;
+
+  /**
+   * @brief Gets the global volume sets on the master gain.
+   * @returns the global volume
+   */
+  [[nodiscard]] float getGlobalVolume() const;
+
+  /**
+   * @brief Sets the global volume of your experience (sets on the master gain).
+   * @param newVolume Defines the new global volume of the application
+   */
+  void setGlobalVolume(float newVolume);
+
+  /**
+   * @brief Mixes the playing sounds.
+   * @param output defines where to write the interleaved stereo frames
+   * @param frameCount defines the number of frames to render
+   */
+  void render(float* output, size_t frameCount);
+
+  /**
+   * @brief Mixes the playing sounds in a new buffer.
+   * @param frameCount defines the number of frames to render
+   * @returns the interleaved stereo frames
+   */
+  Float32Array render(size_t frameCount);
+
+  /**
+   * @brief Gets the number of voices mixed during the last rendered block.
+   */
+  [[nodiscard]] size_t realVoiceCount() const;
+
+  /**
+   * @brief Gets the number of voices only advanced during the last rendered block.
+   */
+  [[nodiscard]] size_t virtualVoiceCount() const;
+
+  /**
+   * @brief Connect the audio engine to an audio analyser allowing some amazing synchornization
+   * between the sounds/music and your visualization (VuMeter for instance).
+   * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#using-the-analyser
+   * @param analyser The analyser to connect to the engine, created while this engine was the
+   * audio engine of the Engine class
+   */
+  void connectToAnalyser(const AnalyserPtr& analyser);
+
+  /**
+   * @brief Dispose of the audio engine: all the voices are stopped.
+   */
+  void dispose();
+
+  /**
+   * @brief Locks the voices against the mixer. The lock must be held to change a voice or to
+   * call the functions below.
+   * @hidden
+   */
+  std::unique_lock<std::mutex> _lock();
+
+  /** @hidden */
+  void _addVoice(const AudioVoicePtr& voice);
+
+  /** @hidden */
+  void _removeVoice(const AudioVoicePtr& voice);
+
+  /** @hidden */
+  void _disconnectAnalyser(Analyser* analyser);
+
+  /**
+   * @brief Flags the voices to be sorted again before the next rendered block, after a change
+   * of their gains or priorities.
+   * @hidden
+   */
+  void _markVoicesDirty();
+
+protected:
+  /**
+   * @brief Creates a new audio engine.
+   * @param sampleRate defines the sample rate of the output in Hz
+   */
+  AudioEngine(size_t sampleRate = 48000);
+
+private:
+  void _updateVoices();
+  void _renderBlock(size_t frameCount);
+  void _mixVoice(AudioVoice& voice, size_t frameCount);
+  void _advanceVoice(AudioVoice& voice, size_t frameCount);
+
+public:
+  /**
+   * Gets whether the current host supports Web Audio and thus could create AudioContexts.
+   */
+  bool canUseWebAudio;
+
+  /**
+   * Gets whether or not mp3 are supported by your browser.
+   */
+  bool isMP3supported;
+
+  /**
+   * Gets whether or not ogg are supported by your browser.
+   */
+  bool isOGGsupported;
+
+  /**
+   * Gets whether audio has been unlocked on the device.
+   */
+  bool unlocked;
+
+  /**
+   * Defines the maximum number of voices mixed at once. The voices over the budget, chosen by
+   * priority then by audibility, keep playing silently.
+   */
+  size_t maxVoices;
+
+private:
+  size_t _sampleRate;
+  float _masterGain;
+  float _currentMasterGain;
+  std::atomic<uint64_t> _renderedFrames;
+  std::vector<AudioVoicePtr> _voices;
+  std::vector<AudioVoice*> _sortedVoices;
+  bool _voicesDirty;
+  size_t _realVoiceCount;
+  size_t _virtualVoiceCount;
+  Float32Array _bus;
+  Float32Array _resampled;
+  Analyser* _connectedAnalyser;
+  mutable std::mutex _mutex;
+
+}; // end of class AudioEngine
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_AUDIO_ENGINE_H
@@ -5,11 +5,14 @@
 #include <babylon/babylon_common.h>
 #include <babylon/engines/iscene_serializable_component.h>
 #include <babylon/engines/scene_component_constants.h>
+#include <babylon/maths/vector3.h>
 
 namespace BABYLON {
 
 class AudioSceneComponent;
+class Sound;
 using AudioSceneComponentPtr = std::shared_ptr<AudioSceneComponent>;
+using SoundPtr               = std::shared_ptr<Sound>;
 
 /**
  * @brief Defines the sound scene component responsible to manage any sounds in
@@ -121,9 +124,21 @@ public:
    */
   ReadOnlyProperty<AudioSceneComponent, bool> headphone;
 
+  /**
+   * The position and the orientation of the listener, updated from the active camera after each
+   * render.
+   * @hidden
+   */
+  Vector3 _listenerPosition;
+  /** @hidden */
+  Vector3 _listenerForward;
+  /** @hidden */
+  Vector3 _listenerUp;
+
 private:
   bool _audioEnabled;
   bool _headphone;
+  std::vector<SoundPtr> _sounds;
 
 }; // end of class AudioSceneComponent
 
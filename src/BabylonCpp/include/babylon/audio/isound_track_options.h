@@ -14,7 +14,7 @@ struct BABYLON_SHARED_EXPORT ISoundTrackOptions {
   /**
    * The volume the sound track should take during creation
    */
-  std::optional<bool> volume = std::nullopt;
+  std::optional<float> volume = std::nullopt;
   /**
    * Define if the sound track is the main sound track of the scene
    */
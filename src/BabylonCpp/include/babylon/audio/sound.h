@@ -1,77 +1,367 @@
-#ifndef BABYLON_AUDIO_SOUND_H
-#define BABYLON_AUDIO_SOUND_H
-
-#include <variant>
-
-#include <babylon/babylon_api.h>
-#include <babylon/babylon_common.h>
-#include <babylon/misc/observable.h>
-#include <nlohmann/json_fwd.hpp>
-
-using json = nlohmann::json;
-
-namespace BABYLON {
-
-class Scene;
-class Sound;
-using SoundPtr = std::shared_ptr<Sound>;
-
-class BABYLON_SHARED_EXPORT Sound {
-
-public:
-  template <typename... Ts>
-  static SoundPtr New(Ts&&... args)
-  {
-    return std::shared_ptr<Sound>(new Sound(std::forward<Ts>(args)...));
-  }
-  virtual ~Sound() = default;
-
-  bool isReady()
-  {
-    return false;
-  }
-  void play(std::optional<size_t> /*time*/   = std::nullopt,
-            std::optional<size_t> /*offset*/ = std::nullopt)
-  {
-  }
-  void pause()
-  {
-  }
-  void stop()
-  {
-  }
-  void setVolume(unsigned int /*volume*/)
-  {
-  }
-  static SoundPtr Parse(const json& /*parsedSound*/, Scene* /*scene*/,
-                        const std::string& /*rootUrl*/,
-                        const SoundPtr& /*sound*/ = nullptr)
-  {
-    return nullptr;
-  }
-
-protected:
-  Sound(const std::string& /*name*/,
-        const std::optional<std::variant<std::string, ArrayBuffer>>&
-        /*urlOrArrayBuffer*/,
-        Scene* /*scene*/)
-  {
-  }
-
-public:
-  bool isPaused;
-  std::string name;
-  bool autoplay;
-  float directionalConeInnerAngle;
-  float directionalConeOuterAngle;
-
-  /**
-   * Observable event when the current playing sound finishes.
-   */
-  Observable<Sound> onEndedObservable;
-
-}; // end of class Sound
-
-} // end of namespace BABYLON
-
-#endif // end of BABYLON_AUDIO_SOUND_H
+#ifndef BABYLON_AUDIO_SOUND_H
+#define BABYLON_AUDIO_SOUND_H
+
+#include <functional>
+#include <variant>
+
+#include <babylon/audio/isound_options.h>
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/misc/observable.h>
+#include <nlohmann/json_fwd.hpp>
+
+using json = nlohmann::json;
+
+namespace BABYLON {
+
+class AudioBuffer;
+class AudioEngine;
+struct AudioVoice;
+class Scene;
+class Sound;
+class SoundTrack;
+class TransformNode;
+using AudioBufferPtr   = std::shared_ptr<AudioBuffer>;
+using AudioEnginePtr   = std::shared_ptr<AudioEngine>;
+using AudioVoicePtr    = std::shared_ptr<AudioVoice>;
+using SoundPtr         = std::shared_ptr<Sound>;
+using TransformNodePtr = std::shared_ptr<TransformNode>;
+
+/**
+ * @brief Defines a sound that can be played in the application.
+ * The sound is mixed by the audio engine: only WAV files and PCM data are decoded and the HRTF
+ * panning model falls back to the equal power one.
+ * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music
+ */
+class BABYLON_SHARED_EXPORT Sound : public std::enable_shared_from_this<Sound> {
+
+public:
+  using UrlOrArrayBufferOrAudioBuffer = std::variant<std::string, ArrayBuffer, AudioBufferPtr>;
+
+public:
+  template <typename... Ts>
+  static SoundPtr New(Ts&&... args)
+  {
+    auto sound = std::shared_ptr<Sound>(new Sound(std::forward<Ts>(args)...));
+    sound->_initialize();
+
+    return sound;
+  }
+  virtual ~Sound(); // = default
+
+  /**
+   * @brief Release the sound and its associated resources.
+   */
+  void dispose();
+
+  /**
+   * @brief Gets if the sounds is ready to be played or not.
+   * @returns true if ready, otherwise false
+   */
+  [[nodiscard]] bool isReady() const;
+
+  /**
+   * @brief Sets the data of the sound from an audio buffer.
+   * @param audioBuffer The audio buffer containing the data
+   */
+  void setAudioBuffer(const AudioBufferPtr& audioBuffer);
+
+  /**
+   * @brief Updates the current sounds options such as maxdistance, loop...
+   * @param options A JSON object containing values named as the object properties
+   */
+  void updateOptions(const ISoundOptions& options);
+
+  /**
+   * @brief Switch the panning model to HRTF: Renders a stereo output of higher quality than
+   * equalpower. The mixer does not implement HRTF and keeps panning with equal power.
+   * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#creating-a-spatial-3d-sound
+   */
+  void switchPanningModelToHRTF();
+
+  /**
+   * @brief Switch the panning model to Equal Power: Represents the equal-power panning algorithm,
+   * generally regarded as simple and efficient. equalpower is the default value.
+   * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#creating-a-spatial-3d-sound
+   */
+  void switchPanningModelToEqualPower();
+
+  /**
+   * @brief Transform this sound into a directional source.
+   * @param coneInnerAngle Size of the inner cone in degree
+   * @param coneOuterAngle Size of the outer cone in degree
+   * @param coneOuterGain Volume of the sound outside the outer cone (between 0.0 and 1.0)
+   */
+  void setDirectionalCone(float coneInnerAngle, float coneOuterAngle, float coneOuterGain);
+
+  /**
+   * @brief Sets the position of the emitter if spatial sound is enabled.
+   * @param newPosition Defines the new posisiton
+   */
+  void setPosition(const Vector3& newPosition);
+
+  /**
+   * @brief Sets the local direction of the emitter if spatial sound is enabled.
+   * @param newLocalDirection Defines the new local direction
+   */
+  void setLocalDirectionToMesh(const Vector3& newLocalDirection);
+
+  /**
+   * @brief Play the sound.
+   * @param time (optional) Start the sound after X, value in seconds
+   * @param offset (optional) Start the sound at a specific time in seconds
+   * @param length (optional) Sound duration (in seconds)
+   */
+  void play(const std::optional<float>& time   = std::nullopt,
+            const std::optional<float>& offset = std::nullopt,
+            const std::optional<float>& length = std::nullopt);
+
+  /**
+   * @brief Stop the sound.
+   * @param time (optional) Stop the sound after X, value in seconds
+   */
+  void stop(const std::optional<float>& time = std::nullopt);
+
+  /**
+   * @brief Put the sound in pause.
+   */
+  void pause();
+
+  /**
+   * @brief Sets a dedicated volume for this sounds.
+   * @param newVolume Define the new volume of the sound
+   */
+  void setVolume(float newVolume);
+
+  /**
+   * @brief Set the sound play back rate.
+   * @param newPlaybackRate Define the playback rate the sound should be played at
+   */
+  void setPlaybackRate(float newPlaybackRate);
+
+  /**
+   * @brief Gets the volume of the sound.
+   * @returns the volume of the sound
+   */
+  [[nodiscard]] float getVolume() const;
+
+  /**
+   * @brief Attach the sound to a dedicated mesh.
+   * @param transformNode The transform node to connect the sound with
+   * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#attaching-a-sound-to-a-mesh
+   */
+  void attachToMesh(const TransformNodePtr& transformNode);
+
+  /**
+   * @brief Detach the sound from the previously attached mesh.
+   * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#attaching-a-sound-to-a-mesh
+   */
+  void detachFromMesh();
+
+  /**
+   * @brief Gets the current underlying audio buffer containing the data.
+   * @returns the audio buffer
+   */
+  [[nodiscard]] AudioBufferPtr getAudioBuffer() const;
+
+  /**
+   * @brief Gets the current time of the playback, in seconds from the start of the buffer.
+   */
+  [[nodiscard]] float currentTime() const;
+
+  /**
+   * @brief Computes the gains of the voice from the listener, the lock of the audio engine must
+   * be held.
+   * @hidden
+   */
+  void _updateVoice(const Vector3& listenerPosition, const Vector3& listenerForward,
+                    const Vector3& listenerUp);
+
+  /**
+   * @brief Notifies the end of the playback when the mixer reached the end of the voice.
+   * @hidden
+   */
+  void _checkEnded();
+
+  /**
+   * @brief Updates the voice after a change of the sound or of its sound track.
+   * @hidden
+   */
+  void _updateGains();
+
+  /**
+   * @brief Parse a JSON representation of a sound to instantiate in a given scene.
+   * @param parsedSound Define the JSON representation of the sound (usually coming from the
+   * serialize method)
+   * @param scene Define the scene the new parsed sound should be created in
+   * @param rootUrl Define the rooturl of the load in case we need to fetch relative dependencies
+   * @param sourceSound Define a sound place holder if do not need to instantiate a new one
+   * @returns the newly parsed sound
+   */
+  static SoundPtr Parse(const json& parsedSound, Scene* scene, const std::string& rootUrl,
+                        const SoundPtr& sourceSound = nullptr);
+
+protected:
+  /**
+   * @brief Create a sound and attach it to a scene.
+   * @param name Name of your sound
+   * @param urlOrArrayBuffer Url to the WAV file to load, or the content of a WAV file, or an
+   * already decoded audio buffer
+   * @param scene defines the scene the sound belongs to
+   * @param readyToPlayCallback Provide a callback function if you'd like to load your code once
+   * the sound is ready to be played
+   * @param options Objects to provide with the current available options: autoplay, loop,
+   * volume, spatialSound, maxDistance, rolloffFactor, refDistance, distanceModel, playbackRate,
+   * offset, length, priority
+   */
+  Sound(const std::string& name,
+        const std::optional<UrlOrArrayBufferOrAudioBuffer>& urlOrArrayBuffer, Scene* scene,
+        const std::function<void()>& readyToPlayCallback = nullptr,
+        const ISoundOptions& options                     = {});
+
+  /**
+   * @brief Gets the size of cone in degrees for a directional sound in which there will be no
+   * attenuation.
+   */
+  [[nodiscard]] float get_directionalConeInnerAngle() const;
+
+  /**
+   * @brief Sets the size of cone in degrees for a directional sound in which there will be no
+   * attenuation.
+   */
+  void set_directionalConeInnerAngle(float value);
+
+  /**
+   * @brief Gets the size of cone in degrees for a directional sound outside of which there will
+   * be no sound. Between these angles, the volume will reduce linearly.
+   */
+  [[nodiscard]] float get_directionalConeOuterAngle() const;
+
+  /**
+   * @brief Sets the size of cone in degrees for a directional sound outside of which there will
+   * be no sound. Between these angles, the volume will reduce linearly.
+   */
+  void set_directionalConeOuterAngle(float value);
+
+private:
+  void _initialize();
+  void _soundLoaded(const ArrayBuffer& audioData);
+  void _onended();
+  void _updateVoiceFromListener();
+  [[nodiscard]] float _distanceGain(float distance) const;
+  [[nodiscard]] float _coneGain(const Vector3& position, const Vector3& listenerPosition) const;
+
+public:
+  /**
+   * The name of the sound in the scene.
+   */
+  std::string name;
+
+  /**
+   * Does the sound autoplay once loaded.
+   */
+  bool autoplay;
+
+  /**
+   * Does the sound loop after it finishes playing once.
+   */
+  bool loop;
+
+  /**
+   * The sound track id this sound belongs to.
+   */
+  int soundTrackId;
+
+  /**
+   * Is this sound currently played.
+   */
+  bool isPlaying;
+
+  /**
+   * Is this sound currently paused.
+   */
+  bool isPaused;
+
+  /**
+   * Does this sound enables spatial sound.
+   * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#creating-a-spatial-3d-sound
+   */
+  bool spatialSound;
+
+  /**
+   * Define the reference distance the sound should be heard perfectly.
+   * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#creating-a-spatial-3d-sound
+   */
+  float refDistance;
+
+  /**
+   * Define the roll off factor of spatial sounds.
+   * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#creating-a-spatial-3d-sound
+   */
+  float rolloffFactor;
+
+  /**
+   * Define the max distance the sound should be heard (intensity just became 0 at this point).
+   * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#creating-a-spatial-3d-sound
+   */
+  float maxDistance;
+
+  /**
+   * Define the distance attenuation model the sound will follow: "linear", "inverse" or
+   * "exponential".
+   * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#creating-a-spatial-3d-sound
+   */
+  std::string distanceModel;
+
+  /**
+   * Define the priority of the sound: when more sounds play than the voice budget of the audio
+   * engine, the sounds of lowest priority, then the least audible ones, are virtualized.
+   */
+  int priority;
+
+  /**
+   * Observable event when the current playing sound finishes.
+   */
+  Observable<Sound> onEndedObservable;
+
+  /**
+   * The size of cone in degrees for a directional sound in which there will be no attenuation.
+   */
+  Property<Sound, float> directionalConeInnerAngle;
+
+  /**
+   * The size of cone in degrees for a directional sound outside of which there will be no
+   * sound. Between these angles, the volume will reduce linearly.
+   */
+  Property<Sound, float> directionalConeOuterAngle;
+
+  /** @hidden */
+  SoundTrack* _soundTrack;
+
+private:
+  Scene* _scene;
+  AudioEnginePtr _audioEngine;
+  AudioBufferPtr _audioBuffer;
+  AudioVoicePtr _voice;
+  std::string _url;
+  std::function<void()> _readyToPlayCallback;
+  bool _isReadyToPlay;
+  float _volume;
+  float _playbackRate;
+  std::optional<float> _offset;
+  std::optional<float> _length;
+  Vector3 _position;
+  Vector3 _localDirection;
+  bool _isDirectional;
+  float _coneInnerAngle;
+  float _coneOuterAngle;
+  float _coneOuterGain;
+  std::string _panningModel;
+  std::weak_ptr<TransformNode> _connectedTransformNode;
+
+}; // end of class Sound
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_AUDIO_SOUND_H
@@ -1,64 +1,110 @@
-#ifndef BABYLON_AUDIO_SOUND_TRACK_H
-#define BABYLON_AUDIO_SOUND_TRACK_H
-
-#include <memory>
-#include <vector>
-
-#include <babylon/audio/isound_track_options.h>
-#include <babylon/babylon_api.h>
-
-namespace BABYLON {
-
-class Scene;
-class Sound;
-class SoundTrack;
-using SoundPtr      = std::shared_ptr<Sound>;
-using SoundTrackPtr = std::shared_ptr<SoundTrack>;
-
-class BABYLON_SHARED_EXPORT SoundTrack {
-
-public:
-  template <typename... Ts>
-  static SoundTrackPtr New(Ts&&... args)
-  {
-    return std::shared_ptr<SoundTrack>(
-      new SoundTrack(std::forward<Ts>(args)...));
-  }
-  void AddSound(const SoundPtr& /*sound*/)
-  {
-  }
-  void RemoveSound(const SoundPtr& /*sound*/)
-  {
-  }
-  void switchPanningModelToHRTF()
-  {
-  }
-  void switchPanningModelToEqualPower()
-  {
-  }
-  void dispose()
-  {
-  }
-
-protected:
-  /**
-   * @brief Creates a new sound track.
-   * @see
-   * http://doc.babylonjs.com/how_to/playing_sounds_and_music#using-sound-tracks
-   * @param scene Define the scene the sound track belongs to
-   * @param options
-   */
-  SoundTrack(Scene* /*scene*/, const ISoundTrackOptions& /*options*/ = {})
-  {
-  }
-
-public:
-  Scene* _scene;
-  bool _mainTrack;
-  std::vector<SoundPtr> soundCollection;
-
-}; // end of class SoundTrack
-
-} // end of namespace BABYLON
-
-#endif // end of BABYLON_AUDIO_SOUND_TRACK_H
+#ifndef BABYLON_AUDIO_SOUND_TRACK_H
+#define BABYLON_AUDIO_SOUND_TRACK_H
+
+#include <memory>
+#include <vector>
+
+#include <babylon/audio/isound_track_options.h>
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class Scene;
+class Sound;
+class SoundTrack;
+using SoundPtr      = std::shared_ptr<Sound>;
+using SoundTrackPtr = std::shared_ptr<SoundTrack>;
+
+/**
+ * @brief It could be useful to isolate your music & sounds on several tracks to better manage
+ * volume on a grouped instance of sounds. It will be also used in a future release to apply
+ * effects on a specific track.
+ * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#using-sound-tracks
+ */
+class BABYLON_SHARED_EXPORT SoundTrack {
+
+public:
+  template <typename... Ts>
+  static SoundTrackPtr New(Ts&&... args)
+  {
+    return std::shared_ptr<SoundTrack>(new SoundTrack(std::forward<Ts>(args)...));
+  }
+  ~SoundTrack(); // = default
+
+  /**
+   * @brief Release the sound track and its associated resources.
+   */
+  void dispose();
+
+  /**
+   * @brief Adds a sound to this sound track.
+   * @param sound define the cound to add
+   */
+  void AddSound(const SoundPtr& sound);
+
+  /**
+   * @brief Removes a sound to this soundtrack.
+   * @param soundToRemove define the sound to be removed
+   */
+  void RemoveSound(const SoundPtr& sound);
+
+  /**
+   * @brief Set a global volume for the full sound track.
+   * @param newVolume Define the new volume of the sound track
+   */
+  void setVolume(float newVolume);
+
+  /**
+   * @brief Gets the global volume of the full sound track.
+   * @returns the volume of the sound track
+   */
+  [[nodiscard]] float getVolume() const;
+
+  /**
+   * @brief Switch the panning model to HRTF: Renders a stereo output of higher quality than
+   * equalpower.
+   * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#creating-a-spatial-3d-sound
+   */
+  void switchPanningModelToHRTF();
+
+  /**
+   * @brief Switch the panning model to Equal Power: Represents the equal-power panning algorithm,
+   * generally regarded as simple and efficient. equalpower is the default value.
+   * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#creating-a-spatial-3d-sound
+   */
+  void switchPanningModelToEqualPower();
+
+protected:
+  /**
+   * @brief Creates a new sound track.
+   * @see http://doc.babylonjs.com/how_to/playing_sounds_and_music#using-sound-tracks
+   * @param scene Define the scene the sound track belongs to
+   * @param options
+   */
+  SoundTrack(Scene* scene, const ISoundTrackOptions& options = {});
+
+public:
+  /**
+   * The unique identifier of the sound track in the scene.
+   */
+  int id;
+
+  /**
+   * The list of sounds included in the sound track.
+   */
+  std::vector<SoundPtr> soundCollection;
+
+  /** @hidden */
+  Scene* _scene;
+
+  /** @hidden */
+  bool _mainTrack;
+
+private:
+  float _volume;
+
+}; // end of class SoundTrack
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_AUDIO_SOUND_TRACK_H
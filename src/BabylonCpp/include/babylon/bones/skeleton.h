@@ -7,6 +7,7 @@
 #include <babylon/animations/animation_range.h>
 #include <babylon/animations/ianimatable.h>
 #include <babylon/babylon_api.h>
+#include <babylon/core/profiling/memory_tracker.h>
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/maths/matrix.h>
 #include <babylon/misc/iinspectable.h>
@@ -193,11 +194,10 @@ public:
   /**
    * @brief Clone the current skeleton.
    * @param name defines the name of the new skeleton
-   * @param id defines the id of the new skeleton
+   * @param id defines the id of the new skeleton (the name by default)
    * @returns the new skeleton
    */
-  [[nodiscard]] std::unique_ptr<Skeleton> clone(const std::string& name,
-                                                const std::string& id) const;
+  [[nodiscard]] SkeletonPtr clone(const std::string& name, const std::string& id = "") const;
 
   /**
    * @brief Enable animation blending for this skeleton.
@@ -366,6 +366,12 @@ public:
    */
   ReadOnlyProperty<Skeleton, size_t> uniqueId;
 
+  /**
+   * Hidden
+   * Memory used by the bone matrices
+   */
+  TrackedMemory _transformMatricesMemory;
+
 private:
   Scene* _scene;
   bool _isDirty;
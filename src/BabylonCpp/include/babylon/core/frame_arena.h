@@ -0,0 +1,179 @@
+#ifndef BABYLON_CORE_FRAME_ARENA_H
+#define BABYLON_CORE_FRAME_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Linear (bump) allocator for data that only lives for the duration of a frame.
+ *
+ * Memory is carved out of a list of blocks which are kept alive when the arena is reset, so once
+ * the arena has grown to the size of a typical frame, allocating from it no longer hits the heap.
+ * Individual deallocations are no-ops: memory is reclaimed all at once either by reset(), which is
+ * called by the engine at the beginning of each frame, or by rewinding to a marker using a Scope.
+ *
+ * The arena is not thread safe, it is meant to be used from the render thread only.
+ */
+class BABYLON_SHARED_EXPORT FrameArena {
+
+public:
+  static constexpr size_t DefaultBlockSize = 64 * 1024;
+
+  /**
+   * @brief Position in the arena that can be rewound to.
+   */
+  struct Marker {
+    size_t blockIndex = 0;
+    size_t offset     = 0;
+  }; // end of struct Marker
+
+  /**
+   * @brief Rewinds the arena to its current position when going out of scope.
+   */
+  class Scope {
+  public:
+    explicit Scope(FrameArena& arena) : _arena{arena}, _marker{arena.mark()}
+    {
+      ++_arena._openScopeCount;
+    }
+    ~Scope()
+    {
+      --_arena._openScopeCount;
+      _arena.rewind(_marker);
+    }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    FrameArena& _arena;
+    Marker _marker;
+  }; // end of class Scope
+
+public:
+  explicit FrameArena(size_t blockSize = DefaultBlockSize);
+  FrameArena(const FrameArena&) = delete;
+  FrameArena& operator=(const FrameArena&) = delete;
+  ~FrameArena(); // = default
+
+  /**
+   * @brief Allocates a chunk of memory from the arena.
+   * @param size the number of bytes to allocate
+   * @param alignment the required alignment (power of two)
+   * @returns the allocated memory
+   */
+  void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+  /**
+   * @brief Returns the current position in the arena.
+   */
+  [[nodiscard]] Marker mark() const;
+
+  /**
+   * @brief Releases everything allocated since the given marker was taken.
+   */
+  void rewind(const Marker& marker);
+
+  /**
+   * @brief Releases everything allocated from the arena while keeping the blocks for reuse. The
+   * memory allocated before the reset must no longer be used, the blocks may be merged and freed.
+   * The reset does nothing while a scope is open, as the memory of the scope is still in use.
+   */
+  void reset();
+
+  /**
+   * @brief Returns the number of bytes handed out since the last reset (including alignment
+   * padding).
+   */
+  [[nodiscard]] size_t bytesUsed() const;
+
+  /**
+   * @brief Returns the total size of the blocks owned by the arena.
+   */
+  [[nodiscard]] size_t capacity() const;
+
+  /**
+   * @brief Returns the number of blocks owned by the arena.
+   */
+  [[nodiscard]] size_t blockCount() const;
+
+private:
+  struct Block {
+    std::unique_ptr<std::byte[]> data = nullptr;
+    size_t size                       = 0;
+  }; // end of struct Block
+
+  std::vector<Block> _blocks;
+  size_t _blockSize;
+  size_t _blockIndex;
+  size_t _offset;
+  size_t _openScopeCount;
+
+}; // end of class FrameArena
+
+/**
+ * @brief STL compatible allocator allocating from a FrameArena.
+ */
+template <typename T>
+class FrameAllocator {
+
+  template <typename U>
+  friend class FrameAllocator;
+
+public:
+  using value_type = T;
+
+public:
+  FrameAllocator(FrameArena& arena) noexcept : _arena{&arena}
+  {
+  }
+
+  template <typename U>
+  FrameAllocator(const FrameAllocator<U>& other) noexcept : _arena{other._arena}
+  {
+  }
+
+  T* allocate(size_t n)
+  {
+    return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* /*p*/, size_t /*n*/) noexcept
+  {
+  }
+
+  [[nodiscard]] FrameArena& arena() const noexcept
+  {
+    return *_arena;
+  }
+
+  template <typename U>
+  bool operator==(const FrameAllocator<U>& other) const noexcept
+  {
+    return _arena == other._arena;
+  }
+
+  template <typename U>
+  bool operator!=(const FrameAllocator<U>& other) const noexcept
+  {
+    return _arena != other._arena;
+  }
+
+private:
+  FrameArena* _arena;
+
+}; // end of class FrameAllocator
+
+/**
+ * @brief Vector whose storage is allocated from a FrameArena.
+ */
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_FRAME_ARENA_H
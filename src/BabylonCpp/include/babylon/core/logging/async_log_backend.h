@@ -0,0 +1,102 @@
+#ifndef BABYLON_CORE_LOGGING_ASYNC_LOG_BACKEND_H
+#define BABYLON_CORE_LOGGING_ASYNC_LOG_BACKEND_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <babylon/babylon_api.h>
+#include <babylon/core/logging/log_message.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Asynchronous logging backend.
+ *
+ * Log messages are pushed by any number of producer threads into a bounded,
+ * lock-free multi-producer / single-consumer ring buffer and are dispatched
+ * to the listeners by a background sink thread. Producers never block: when
+ * the ring buffer is full the message is dropped and accounted for in
+ * droppedMessageCount().
+ *
+ * The expensive parts of a log message (thread id and pretty function
+ * formatting, timestamp rendering, listener fan-out) are deferred to the sink
+ * thread.
+ */
+class BABYLON_SHARED_EXPORT AsyncLogBackend {
+
+public:
+  using SinkFunction = std::function<void(const LogMessage& msg)>;
+
+public:
+  /**
+   * @brief Creates the backend and starts the sink thread.
+   * @param sink The function called by the sink thread for each message
+   * @param capacity The ring buffer capacity, rounded up to a power of two
+   */
+  AsyncLogBackend(const SinkFunction& sink, size_t capacity = 8192);
+  ~AsyncLogBackend(); // = default
+
+  AsyncLogBackend(const AsyncLogBackend&) = delete;
+  AsyncLogBackend& operator=(const AsyncLogBackend&) = delete;
+
+  /**
+   * @brief Enqueues a message without blocking.
+   * @return false if the ring buffer was full and the message was dropped
+   */
+  bool tryPush(LogMessage&& msg);
+
+  /**
+   * @brief Blocks until all messages enqueued before this call have been
+   * dispatched by the sink thread.
+   */
+  void flush();
+
+  /**
+   * @brief Flushes the pending messages and stops the sink thread.
+   */
+  void stop();
+
+  /**
+   * @brief Returns the ring buffer capacity.
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief Returns the number of messages dropped because the ring buffer was
+   * full.
+   */
+  size_t droppedMessageCount() const;
+
+private:
+  bool tryPop(LogMessage& msg);
+  void run();
+
+private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    LogMessage message;
+  };
+
+  SinkFunction _sink;
+  size_t _mask;
+  std::unique_ptr<Slot[]> _slots;
+  // Producer and consumer cursors live on separate cache lines
+  alignas(64) std::atomic<size_t> _enqueuePos;
+  alignas(64) size_t _dequeuePos;
+  std::atomic<size_t> _dispatchedCount;
+  std::atomic<size_t> _droppedCount;
+  std::atomic<bool> _running;
+  std::atomic<bool> _sinkSleeping;
+  std::mutex _sleepMutex;
+  std::condition_variable _sleepCondition;
+  std::thread _sinkThread;
+
+}; // end of class AsyncLogBackend
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_LOGGING_ASYNC_LOG_BACKEND_H
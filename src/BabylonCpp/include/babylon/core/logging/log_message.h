@@ -2,6 +2,7 @@
 #define BABYLON_CORE_LOGGING_LOG_MESSAGE_H
 
 #include <sstream>
+#include <thread>
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
@@ -74,19 +75,22 @@ public:
     __attribute__((format(printf, 2, 3)));
 
 private:
-  std::string prettify(char const* pretty_func);
+  static std::string prettify(char const* pretty_func);
 
 private:
   unsigned int _level;
   system_time_point_t _timestamp;
   std::string _file;
   int _lineNumber;
-  std::string _threadId;
+  std::thread::id _threadIdRaw;
   std::string _context;
   std::string _function;
-  std::string _prettyFunction;
+  char const* _prettyFunctionRaw;
   std::string _expression;
   std::ostringstream _oss;
+  // Formatted lazily, only when a listener actually asks for them
+  mutable std::string _threadId;
+  mutable std::string _prettyFunction;
 
 }; // end of class LogMessage
 
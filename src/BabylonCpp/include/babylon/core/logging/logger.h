@@ -2,6 +2,9 @@
 #define BABYLON_CORE_LOGGING_LOGGER_H
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include <babylon/core/delegates/delegate.h>
@@ -20,8 +23,16 @@
 #define thread_local __declspec(thread)
 #endif
 
+// Compile-time log level: messages more verbose than this level are compiled
+// out entirely (e.g. -DBABYLON_LOG_ACTIVE_LEVEL=3 keeps ERROR, WARN and INFO).
+#ifndef BABYLON_LOG_ACTIVE_LEVEL
+#define BABYLON_LOG_ACTIVE_LEVEL 5 // LogLevels::LEVEL_TRACE
+#endif
+
 namespace BABYLON {
 
+class AsyncLogBackend;
+
 struct LogMessageHandler {
   using LogMessageListener = SA::delegate<void(const LogMessage&)>;
 
@@ -30,17 +41,36 @@ struct LogMessageHandler {
   LogMessageHandler(const LogMessageHandler&) = delete;
   LogMessageHandler& operator=(const LogMessageHandler&) = delete;
 
-  bool takes(unsigned int level);
+  /**
+   * @brief Returns whether at least one listener is registered for the level.
+   */
+  bool takes(unsigned int level) const;
+  /**
+   * @brief Returns whether the level is in the range of known levels.
+   */
+  bool isValidLevel(unsigned int level) const;
   void handle(const LogMessage& msg);
+  /**
+   * @brief Recomputes the bit mask of the levels having listeners, must be
+   * called with the listeners mutex held.
+   */
+  void updateLevelMask();
 
   std::unordered_map<unsigned int, std::vector<LogMessageListener*>>
     _logMessageListeners;
   unsigned int _minLevel, _maxLevel;
+  std::atomic<unsigned int> _levelMask;
+  std::recursive_mutex _listenersMutex;
 };
 
 /**
  * @brief Logger used througouht the application to allow configuration of
  * the log level required for the messages.
+ *
+ * The listeners are called on the logging thread in synchronous mode. Once
+ * asynchronous logging is started, they are called on the sink thread of the
+ * asynchronous backend instead, one message at a time, so they must not rely
+ * on thread local state of the logging thread.
  */
 class BABYLON_SHARED_EXPORT Logger {
 
@@ -61,7 +91,12 @@ public:
                                   char const* file, int lineNumber,
                                   char const* func, char const* prettyFunc);
   void log(const LogMessage& msg);
-  bool takes(unsigned int level);
+  void log(LogMessage&& msg);
+  /**
+   * @brief Returns whether a message of the given level would reach at least
+   * one listener.
+   */
+  bool takes(unsigned int level) const;
 
   bool isSubscribed(unsigned int level, LogMessageListener& logMsgListener);
   void registerLogMessageListener(LogMessageListener& logMsgListener);
@@ -71,12 +106,46 @@ public:
   void unregisterLogMessageListener(unsigned int level,
                                     const LogMessageListener& logMsgListener);
 
+  /**
+   * @brief Switches to asynchronous logging: messages are enqueued in a
+   * lock-free ring buffer and dispatched to the listeners by a background sink
+   * thread, so logging never blocks the calling thread. From then on, the
+   * listeners are called on the sink thread.
+   * @param capacity The ring buffer capacity (number of messages)
+   * @return true if asynchronous logging is active
+   */
+  bool startAsyncLogging(size_t capacity = 8192);
+  /**
+   * @brief Flushes the pending messages and switches back to synchronous
+   * logging. Waits for the threads which are enqueueing a message, the
+   * messages logged afterwards are dispatched synchronously.
+   */
+  void stopAsyncLogging();
+  /**
+   * @brief Returns whether asynchronous logging is active.
+   */
+  bool isAsyncLogging() const;
+  /**
+   * @brief Blocks until all the messages logged so far have been dispatched.
+   */
+  void flush();
+  /**
+   * @brief Returns the number of messages dropped because the asynchronous
+   * ring buffer was full.
+   */
+  size_t droppedMessageCount() const;
+
 protected:
   Logger();
   ~Logger();
 
 private:
   LogMessageHandler _impl;
+  std::unique_ptr<AsyncLogBackend> _asyncBackend;
+  std::atomic<AsyncLogBackend*> _activeAsyncBackend;
+  // Number of threads which may be enqueueing in the asynchronous backend
+  std::atomic<size_t> _asyncProducerCount;
+  std::mutex _asyncBackendMutex;
 
 }; // end of class Logger
 
@@ -85,8 +154,11 @@ BABYLON_SHARED_EXPORT Logger & LoggerInstance();
 } // end of namespace BABYLON
 
 
+#define BABYLON_LOG_LEVEL_ENABLED(level)                                       \
+  ((level) <= BABYLON_LOG_ACTIVE_LEVEL && BABYLON::LoggerInstance().takes(level))
+
 #define BABYLON_LOG_MSG(level, context, ...)                                   \
-  if (BABYLON::LoggerInstance().takes(level)) {                              \
+  if (BABYLON_LOG_LEVEL_ENABLED(level)) {                                      \
     std::ostringstream _ctx;                                                   \
     _ctx << context;                                                           \
     BABYLON::LogMessage _logMessage                                            \
@@ -97,7 +169,7 @@ BABYLON_SHARED_EXPORT Logger & LoggerInstance();
   }
 
 #define BABYLON_LOGF_MSG(level, context, printf_like_message, ...)             \
-  if (BABYLON::LoggerInstance().takes(level)) {                              \
+  if (BABYLON_LOG_LEVEL_ENABLED(level)) {                                      \
     std::ostringstream _ctx;                                                   \
     _ctx << context;                                                           \
     BABYLON::LogMessage _logMessage                                            \
@@ -0,0 +1,141 @@
+#ifndef BABYLON_CORE_PROFILING_MEMORY_TRACKER_H
+#define BABYLON_CORE_PROFILING_MEMORY_TRACKER_H
+
+#include <cstddef>
+#include <nlohmann/json_fwd.hpp>
+
+#include <babylon/babylon_api.h>
+
+using json = nlohmann::json;
+
+namespace BABYLON {
+
+/**
+ * @brief Subsystems for which the memory usage is tracked.
+ */
+enum class MemoryCategory : unsigned int {
+  /** Vertex data of the geometries (CPU copy, mirrored in GPU vertex buffers) */
+  GeometryVertexData = 0,
+  /** Index data of the geometries (CPU copy, mirrored in GPU index buffers) */
+  GeometryIndexData = 1,
+  /** Estimated GPU size of the internal textures, based on their format, type and mip chain */
+  Textures = 2,
+  /** Animation keys */
+  AnimationKeys = 3,
+  /** Bone matrices of the skeletons */
+  SkeletonMatrices = 4,
+  /** Vertex data of the particle systems */
+  ParticleBuffers = 5,
+  /** Processed shader sources kept by the effects of the engine effect cache */
+  EffectCache = 6,
+  /** Binary data kept by the loaders while a file is being loaded */
+  LoaderStagingBuffers = 7,
+  /** Number of categories */
+  Count = 8
+}; // end of enum class MemoryCategory
+
+/**
+ * @brief Process wide byte counters, updated when tracked objects allocate and dispose their data.
+ *
+ * The counters are atomics so they can be updated from loader or worker threads.
+ */
+class BABYLON_SHARED_EXPORT MemoryTracker {
+
+public:
+  static constexpr size_t CategoryCount = static_cast<size_t>(MemoryCategory::Count);
+
+public:
+  /**
+   * @brief Accounts for bytes allocated in the given category.
+   */
+  static void Allocate(MemoryCategory category, size_t bytes);
+
+  /**
+   * @brief Accounts for bytes released in the given category.
+   */
+  static void Release(MemoryCategory category, size_t bytes);
+
+  /**
+   * @brief Returns the number of bytes currently allocated in the given category.
+   */
+  static size_t GetBytes(MemoryCategory category);
+
+  /**
+   * @brief Returns the maximum number of bytes allocated in the given category since the start of
+   * the process or the last call to ResetPeaks().
+   */
+  static size_t GetPeakBytes(MemoryCategory category);
+
+  /**
+   * @brief Returns the number of bytes currently allocated in all categories.
+   */
+  static size_t GetTotalBytes();
+
+  /**
+   * @brief Resets the peak values to the current values.
+   */
+  static void ResetPeaks();
+
+  /**
+   * @brief Returns the name of a category, as used in the JSON dump.
+   */
+  static const char* GetCategoryName(MemoryCategory category);
+
+  /**
+   * @brief Serializes the counters, along with the process resident set size.
+   * @returns the JSON representation of the counters
+   */
+  static json Serialize();
+
+}; // end of class MemoryTracker
+
+/**
+ * @brief Number of bytes owned by an object and accounted for in a MemoryTracker category.
+ *
+ * The bytes are released from the tracker when the object is destroyed, so embedding a
+ * TrackedMemory member is enough to keep the counters right when the owner is disposed.
+ */
+class BABYLON_SHARED_EXPORT TrackedMemory {
+
+public:
+  explicit TrackedMemory(MemoryCategory category);
+  TrackedMemory(const TrackedMemory& other);
+  TrackedMemory(TrackedMemory&& other) noexcept;
+  TrackedMemory& operator=(const TrackedMemory& other);
+  TrackedMemory& operator=(TrackedMemory&& other) noexcept;
+  ~TrackedMemory(); // = default
+
+  /**
+   * @brief Sets the number of bytes owned.
+   */
+  void set(size_t bytes);
+
+  /**
+   * @brief Adds to the number of bytes owned.
+   */
+  void add(size_t bytes);
+
+  /**
+   * @brief Releases all the bytes owned.
+   */
+  void release();
+
+  /**
+   * @brief Returns the number of bytes owned.
+   */
+  [[nodiscard]] size_t bytes() const;
+
+  /**
+   * @brief Returns the tracked category.
+   */
+  [[nodiscard]] MemoryCategory category() const;
+
+private:
+  MemoryCategory _category;
+  size_t _bytes;
+
+}; // end of class TrackedMemory
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_PROFILING_MEMORY_TRACKER_H
@@ -1,6 +1,7 @@
 #ifndef BABYLON_CORE_STRUCTS_H
 #define BABYLON_CORE_STRUCTS_H
 
+#include <memory>
 #include <unordered_map>
 
 #include <babylon/babylon_enums.h>
@@ -11,6 +12,7 @@
 
 namespace BABYLON {
 
+class AbstractMesh;
 class Effect;
 class ICanvas;
 class Node;
@@ -346,6 +348,12 @@ struct SnapEvent {
 struct TriggerOptions {
   std::string parameter;
   unsigned int trigger = 0;
+  // Mesh checked by the intersection triggers, looked up by its name in the parameter when not
+  // set. An intersection trigger with neither a mesh nor a parameter checks all the meshes taking
+  // part in the intersection checks of the scene
+  std::weak_ptr<AbstractMesh> mesh;
+  // Whether the intersections are checked with the oriented bounding boxes
+  bool usePreciseIntersection = false;
 }; // end of struct TriggerOptions
 
 } // end of namespace BABYLON
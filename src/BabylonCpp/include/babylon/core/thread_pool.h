@@ -0,0 +1,89 @@
+#ifndef BABYLON_CORE_THREAD_POOL_H
+#define BABYLON_CORE_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Pool of worker threads used to run data parallel loops.
+ *
+ * The threads are started once and sleep between the loops, so that a parallelFor can be issued
+ * every frame without paying for the thread creation. The calling thread takes part in the loop as
+ * worker 0, the pool threads being workers 1 to workerCount() - 1. The worker index can be used to
+ * address per worker scratch data.
+ *
+ * Loops are run one at a time. A parallelFor issued from inside a loop body of the same pool runs
+ * inline on the calling worker, with the worker index of the caller. A parallelFor issued from
+ * inside a loop body of another pool runs inline as worker 0 of this pool, the worker indices of
+ * the two pools being unrelated.
+ */
+class BABYLON_SHARED_EXPORT ThreadPool {
+
+public:
+  /**
+   * Loop body, called with the range [begin, end) of items to process and the worker index. It
+   * must not throw.
+   */
+  using RangeFunction = std::function<void(size_t begin, size_t end, size_t workerIndex)>;
+
+public:
+  /**
+   * @brief Creates the pool and starts the threads.
+   * @param workerCount number of workers including the calling thread, 0 to use the number of
+   * hardware threads
+   */
+  explicit ThreadPool(size_t workerCount = 0);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ~ThreadPool(); // = default
+
+  /**
+   * @brief Returns the process wide pool, using all the hardware threads.
+   */
+  static ThreadPool& Default();
+
+  /**
+   * @brief Returns the number of workers, including the calling thread.
+   */
+  [[nodiscard]] size_t workerCount() const;
+
+  /**
+   * @brief Runs func over [0, count), split in ranges of grainSize items which are claimed by the
+   * workers. Returns when all the items are processed.
+   */
+  void parallelFor(size_t count, size_t grainSize, const RangeFunction& func);
+
+private:
+  void workerLoop(size_t workerIndex);
+  void runRanges(size_t workerIndex);
+
+private:
+  std::vector<std::thread> _threads;
+  // Serializes the loops
+  std::mutex _loopMutex;
+  // Protects the loop description and the worker synchronization
+  std::mutex _mutex;
+  std::condition_variable _wakeCondition;
+  std::condition_variable _doneCondition;
+  const RangeFunction* _func;
+  size_t _count;
+  size_t _grainSize;
+  std::atomic<size_t> _next;
+  size_t _generation;
+  size_t _activeWorkers;
+  bool _stopping;
+
+}; // end of class ThreadPool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_THREAD_POOL_H
@@ -0,0 +1,262 @@
+#ifndef BABYLON_CULLING_DYNAMIC_AABB_TREE_H
+#define BABYLON_CULLING_DYNAMIC_AABB_TREE_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Dynamic bounding volume hierarchy of axis aligned boxes.
+ *
+ * Each proxy stores a box enlarged by a margin, so that objects moving a little do not need to be
+ * reinserted. The tree is kept balanced with rotations on insertion, which makes the box queries
+ * and the ray casts logarithmic in the number of proxies.
+ */
+class BABYLON_SHARED_EXPORT DynamicAABBTree {
+
+public:
+  /**
+   * @brief Axis aligned box.
+   */
+  struct Box {
+    std::array<float, 3> minimum;
+    std::array<float, 3> maximum;
+  }; // end of struct Box
+
+  static constexpr int NullNode = -1;
+
+public:
+  /**
+   * @brief Creates an empty tree.
+   * @param margin defines the margin by which the proxy boxes are enlarged
+   */
+  explicit DynamicAABBTree(float margin = 0.1f);
+  ~DynamicAABBTree(); // = default
+
+  /**
+   * @brief Creates a proxy for the given box.
+   * @param box defines the tight box of the object
+   * @param userData defines the user data returned by the queries
+   * @returns the proxy id
+   */
+  int createProxy(const Box& box, std::size_t userData);
+
+  /**
+   * @brief Destroys a proxy.
+   * @param proxyId defines the id of the proxy to destroy
+   */
+  void destroyProxy(int proxyId);
+
+  /**
+   * @brief Moves a proxy to its new tight box. The proxy is only reinserted if the new box is out
+   * of its enlarged box.
+   * @param proxyId defines the id of the proxy to move
+   * @param box defines the new tight box of the object
+   * @returns true if the proxy has been reinserted
+   */
+  bool moveProxy(int proxyId, const Box& box);
+
+  /**
+   * @brief Gets the user data of a proxy.
+   */
+  [[nodiscard]] std::size_t userData(int proxyId) const
+  {
+    return _nodes[static_cast<std::size_t>(proxyId)].userData;
+  }
+
+  /**
+   * @brief Gets the enlarged box of a proxy.
+   */
+  [[nodiscard]] const Box& fatBox(int proxyId) const
+  {
+    return _nodes[static_cast<std::size_t>(proxyId)].box;
+  }
+
+  /**
+   * @brief Gets the number of proxies in the tree.
+   */
+  [[nodiscard]] std::size_t proxyCount() const
+  {
+    return _proxyCount;
+  }
+
+  /**
+   * @brief Gets the height of the tree, 0 for a single leaf.
+   */
+  [[nodiscard]] int height() const;
+
+  /**
+   * @brief Removes all the proxies.
+   */
+  void clear();
+
+  /**
+   * @brief Calls callback(proxyId) for each proxy whose enlarged box overlaps the box, until the
+   * callback returns false.
+   */
+  template <typename Callback>
+  void query(const Box& box, Callback&& callback) const
+  {
+    if (_root == NullNode) {
+      return;
+    }
+    NodeStack stack;
+    stack.push(_root);
+    while (!stack.empty()) {
+      const auto nodeId = stack.pop();
+      const auto& node  = _nodes[static_cast<std::size_t>(nodeId)];
+      if (!Overlaps(node.box, box)) {
+        continue;
+      }
+      if (node.isLeaf()) {
+        if (!callback(nodeId)) {
+          return;
+        }
+      }
+      else {
+        stack.push(node.child1);
+        stack.push(node.child2);
+      }
+    }
+  }
+
+  /**
+   * @brief Casts the segment from + t * (to - from), t in [0, 1], against the enlarged boxes.
+   *
+   * callback(proxyId, maxFraction) is called for each proxy box hit before the current maximum
+   * fraction, and returns the new maximum fraction: the fraction of the closest hit found so far to
+   * clip the segment, maxFraction to ignore the proxy, or 0 to stop the cast.
+   */
+  template <typename Callback>
+  void raycast(const std::array<float, 3>& from, const std::array<float, 3>& to,
+               Callback&& callback) const
+  {
+    if (_root == NullNode) {
+      return;
+    }
+    std::array<float, 3> invDirection;
+    for (std::size_t i = 0; i < 3; ++i) {
+      const auto d    = to[i] - from[i];
+      invDirection[i] = (d != 0.f) ? 1.f / d : 1e30f;
+    }
+    float maxFraction = 1.f;
+    NodeStack stack;
+    stack.push(_root);
+    while (!stack.empty()) {
+      const auto nodeId = stack.pop();
+      const auto& node  = _nodes[static_cast<std::size_t>(nodeId)];
+      if (!RayHits(node.box, from, invDirection, maxFraction)) {
+        continue;
+      }
+      if (node.isLeaf()) {
+        maxFraction = callback(nodeId, maxFraction);
+        if (maxFraction <= 0.f) {
+          return;
+        }
+      }
+      else {
+        stack.push(node.child1);
+        stack.push(node.child2);
+      }
+    }
+  }
+
+  /**
+   * @brief Returns whether the boxes overlap.
+   */
+  static bool Overlaps(const Box& a, const Box& b)
+  {
+    return a.minimum[0] <= b.maximum[0] && a.maximum[0] >= b.minimum[0]
+           && a.minimum[1] <= b.maximum[1] && a.maximum[1] >= b.minimum[1]
+           && a.minimum[2] <= b.maximum[2] && a.maximum[2] >= b.minimum[2];
+  }
+
+private:
+  struct Node {
+    Box box;
+    std::size_t userData;
+    // Parent node, or next free node
+    int parent;
+    int child1;
+    int child2;
+    // Height of the subtree, -1 for a free node
+    int height;
+
+    [[nodiscard]] bool isLeaf() const
+    {
+      return child1 == NullNode;
+    }
+  }; // end of struct Node
+
+  /**
+   * @brief Traversal stack, on the call stack for the usual tree heights.
+   */
+  class NodeStack {
+  public:
+    void push(int nodeId)
+    {
+      if (_count < _local.size()) {
+        _local[_count++] = nodeId;
+      }
+      else {
+        _overflow.emplace_back(nodeId);
+      }
+    }
+
+    int pop()
+    {
+      if (!_overflow.empty()) {
+        const auto nodeId = _overflow.back();
+        _overflow.pop_back();
+        return nodeId;
+      }
+      return _local[--_count];
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+      return _count == 0 && _overflow.empty();
+    }
+
+  private:
+    std::array<int, 128> _local;
+    std::size_t _count = 0;
+    std::vector<int> _overflow;
+  }; // end of class NodeStack
+
+  static bool RayHits(const Box& box, const std::array<float, 3>& from,
+                      const std::array<float, 3>& invDirection, float maxFraction)
+  {
+    float tMin = 0.f, tMax = maxFraction;
+    for (std::size_t i = 0; i < 3; ++i) {
+      auto t1 = (box.minimum[i] - from[i]) * invDirection[i];
+      auto t2 = (box.maximum[i] - from[i]) * invDirection[i];
+      tMin    = std::max(tMin, std::min(t1, t2));
+      tMax    = std::min(tMax, std::max(t1, t2));
+    }
+    return tMin <= tMax;
+  }
+
+  int _allocateNode();
+  void _freeNode(int nodeId);
+  void _insertLeaf(int leaf);
+  void _removeLeaf(int leaf);
+  int _balance(int nodeId);
+
+private:
+  float _margin;
+  std::vector<Node> _nodes;
+  int _root;
+  int _freeList;
+  std::size_t _proxyCount;
+
+}; // end of class DynamicAABBTree
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_DYNAMIC_AABB_TREE_H
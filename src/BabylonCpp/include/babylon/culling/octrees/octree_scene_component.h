@@ -48,14 +48,14 @@ public:
    * @brief Return the list of active meshes.
    * @returns the list of active meshes
    */
-  std::vector<AbstractMesh*> getActiveMeshCandidates();
+  const std::vector<AbstractMesh*>& getActiveMeshCandidates();
 
   /**
    * @brief Return the list of active sub meshes.
    * @param mesh The mesh to get the candidates sub meshes from
    * @returns the list of active sub meshes
    */
-  std::vector<SubMesh*> getActiveSubMeshCandidates(AbstractMesh* mesh);
+  const std::vector<SubMesh*>& getActiveSubMeshCandidates(AbstractMesh* mesh);
 
   /**
    * @brief Return the list of sub meshes intersecting with a given local ray.
@@ -63,7 +63,8 @@ public:
    * @param localRay defines the ray in local space
    * @returns the list of intersecting sub meshes
    */
-  std::vector<SubMesh*> getIntersectingSubMeshCandidates(AbstractMesh* mesh, const Ray& localRay);
+  const std::vector<SubMesh*>& getIntersectingSubMeshCandidates(AbstractMesh* mesh,
+                                                                const Ray& localRay);
 
   /**
    * @brief Return the list of sub meshes colliding with a collider.
@@ -71,7 +72,8 @@ public:
    * @param collider defines the collider to evaluate the collision against
    * @returns the list of colliding sub meshes
    */
-  std::vector<SubMesh*> getCollidingSubMeshCandidates(AbstractMesh* mesh, const Collider& collider);
+  const std::vector<SubMesh*>& getCollidingSubMeshCandidates(AbstractMesh* mesh,
+                                                             const Collider& collider);
 
   /**
    * @brief Rebuilds the elements related to this component in case of
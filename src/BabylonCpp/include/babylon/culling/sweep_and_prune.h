@@ -0,0 +1,99 @@
+#ifndef BABYLON_CULLING_SWEEP_AND_PRUNE_H
+#define BABYLON_CULLING_SWEEP_AND_PRUNE_H
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Sort and sweep broadphase of axis aligned boxes.
+ *
+ * The boxes are sorted along the x axis and swept once, only the boxes whose x intervals overlap
+ * are compared on the other axes. Finding the overlapping pairs costs O(n log n + k) for n boxes
+ * and k pairs, instead of comparing every box against all the others. The storage is kept across
+ * updates so that a broadphase run every frame does not allocate once it reached its size.
+ */
+class BABYLON_SHARED_EXPORT SweepAndPrune {
+
+public:
+  /**
+   * @brief Axis aligned box.
+   */
+  struct Box {
+    std::array<float, 3> minimum;
+    std::array<float, 3> maximum;
+  }; // end of struct Box
+
+public:
+  SweepAndPrune();
+  ~SweepAndPrune(); // = default
+
+  /**
+   * @brief Removes all the boxes and their pairs.
+   */
+  void clear();
+
+  /**
+   * @brief Adds a box.
+   * @param box defines the box to add
+   * @returns the index of the box
+   */
+  std::size_t addBox(const Box& box);
+
+  /**
+   * @brief Gets the number of boxes.
+   */
+  [[nodiscard]] std::size_t size() const
+  {
+    return _boxes.size();
+  }
+
+  /**
+   * @brief Sorts and sweeps the boxes to find the overlapping pairs.
+   */
+  void update();
+
+  /**
+   * @brief Gets the overlapping pairs found by the last update, the first index of each pair
+   * being the lowest one.
+   */
+  [[nodiscard]] const std::vector<std::array<std::size_t, 2>>& pairs() const
+  {
+    return _pairs;
+  }
+
+  /**
+   * @brief Gets the boxes overlapping a box in the last update.
+   * @param index defines the index of the box
+   * @returns the indices of the overlapping boxes
+   */
+  [[nodiscard]] const std::vector<std::size_t>& overlaps(std::size_t index) const
+  {
+    return _overlaps[index];
+  }
+
+  /**
+   * @brief Gets whether two boxes were overlapping in the last update.
+   * @param a defines the index of the first box
+   * @param b defines the index of the second box
+   * @returns true if the boxes overlap
+   */
+  [[nodiscard]] bool overlap(std::size_t a, std::size_t b) const;
+
+private:
+  std::vector<Box> _boxes;
+  // Indices of the boxes sorted by their minimum on the x axis
+  std::vector<std::size_t> _sorted;
+  std::vector<std::array<std::size_t, 2>> _pairs;
+  // Overlapping boxes of each box, the inner vectors being reused across updates
+  std::vector<std::vector<std::size_t>> _overlaps;
+
+}; // end of class SweepAndPrune
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_SWEEP_AND_PRUNE_H
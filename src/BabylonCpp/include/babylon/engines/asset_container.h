@@ -1,8 +1,11 @@
 #ifndef BABYLON_ENGINES_ASSET_CONTAINER_H
 #define BABYLON_ENGINES_ASSET_CONTAINER_H
 
+#include <functional>
+
 #include <babylon/babylon_api.h>
 #include <babylon/engines/abstract_scene.h>
+#include <babylon/engines/instantiated_entries.h>
 
 namespace BABYLON {
 
@@ -47,6 +50,20 @@ public:
    */
   MeshPtr createRootMesh();
 
+  /**
+   * @brief Clones all the node hierarchies of the container and adds the new nodes to the scene.
+   * The clones share the geometries (and the materials unless cloneMaterials is true) of their
+   * source. Skeletons are cloned and their bones retargeted, animation groups are cloned with their
+   * animations retargeted to the new nodes and bones, the animations themselves being shared.
+   * @param nameFunction defines an optional function used to get new names for clones
+   * @param cloneMaterials defines an optional boolean that defines if materials must be cloned as
+   * well (false by default)
+   * @returns a list of rootNodes, skeletons and animation groups that were duplicated
+   */
+  InstantiatedEntries instantiateModelsToScene(
+    const std::function<std::string(const std::string& sourceName)>& nameFunction = nullptr,
+    bool cloneMaterials                                                         = false);
+
 protected:
   /**
    * @brief Instantiates an AssetContainer.
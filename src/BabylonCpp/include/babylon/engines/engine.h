@@ -2,6 +2,7 @@
 #define BABYLON_ENGINES_ENGINE_H
 
 #include <babylon/babylon_api.h>
+#include <babylon/core/frame_arena.h>
 #include <babylon/engines/thin_engine.h>
 #include <babylon/instrumentation/_time_token.h>
 #include <babylon/misc/perf_counter.h>
@@ -740,6 +741,14 @@ public:
    */
   void endFrame() override;
 
+  /**
+   * @brief Gets the arena used to allocate the transient data of the current frame.
+   * The arena is reset at the beginning of each frame so memory allocated from it must not be kept
+   * across frames.
+   * @returns the frame arena
+   */
+  FrameArena& frameArena();
+
   /**
    * @brief Resize the view according to the canvas' size.
    */
@@ -1279,6 +1288,9 @@ private:
   float _deltaTime                                        = 0.f;
   std::unique_ptr<PerformanceMonitor> _performanceMonitor = nullptr;
 
+  // Transient per-frame allocations
+  FrameArena _frameArena;
+
   // Focus
   std::function<void()> _onFocus                            = nullptr;
   std::function<void()> _onBlur                             = nullptr;
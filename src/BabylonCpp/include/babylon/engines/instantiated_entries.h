@@ -16,7 +16,7 @@ using SkeletonPtr       = std::shared_ptr<Skeleton>;
 using TransformNodePtr  = std::shared_ptr<TransformNode>;
 
 /**
- * @brief Class used to store the output of the AssetContainer.instantiateAllMeshesToScene function.
+ * @brief Class used to store the output of the AssetContainer.instantiateModelsToScene function.
  */
 struct BABYLON_SHARED_EXPORT InstantiatedEntries {
   /**
@@ -33,6 +33,11 @@ struct BABYLON_SHARED_EXPORT InstantiatedEntries {
    * List of new animation groups
    */
   std::vector<AnimationGroupPtr> animationGroups;
+
+  /**
+   * @brief Disposes the instantiated entries from the scene.
+   */
+  void dispose();
 }; // end of struct InstantiatedEntries
 
 } // end of namespace BABYLON
@@ -25,6 +25,7 @@
 #include <babylon/misc/observable.h>
 #include <babylon/misc/observer.h>
 #include <babylon/misc/perf_counter.h>
+#include <babylon/misc/small_observable.h>
 
 using json = nlohmann::json;
 
@@ -43,6 +44,7 @@ class Engine;
 class EnvironmentHelper;
 class GamepadManager;
 class GeometryBufferRenderer;
+struct IAction;
 struct IActiveMeshCandidateProvider;
 class IAnimatable;
 struct ICollisionCoordinator;
@@ -68,6 +70,7 @@ class RenderingManager;
 class RuntimeAnimation;
 class SimplificationQueue;
 class SoundTrack;
+class SweepAndPrune;
 class UniformBuffer;
 using AnimatablePtr                   = std::shared_ptr<Animatable>;
 using BoundingBoxRendererPtr          = std::shared_ptr<BoundingBoxRenderer>;
@@ -203,13 +206,26 @@ public:
 
   /**
    * @brief Hidden
+   * The default candidate lists are kept by the scene, one list per provider, so that a picking or
+   * a collision check does not refill the list iterated by the active meshes evaluation. Each list
+   * is only valid until the next call of the same function.
    */
-  std::vector<AbstractMesh*> _getDefaultMeshCandidates();
+  const std::vector<AbstractMesh*>& _getDefaultMeshCandidates();
 
   /**
    * @brief Hidden
    */
-  std::vector<SubMesh*> _getDefaultSubMeshCandidates(AbstractMesh* mesh);
+  const std::vector<SubMesh*>& _getDefaultActiveSubMeshCandidates(AbstractMesh* mesh);
+
+  /**
+   * @brief Hidden
+   */
+  const std::vector<SubMesh*>& _getDefaultIntersectingSubMeshCandidates(AbstractMesh* mesh);
+
+  /**
+   * @brief Hidden
+   */
+  const std::vector<SubMesh*>& _getDefaultCollidingSubMeshCandidates(AbstractMesh* mesh);
 
   /**
    * @brief Sets the default candidate providers for the scene.
@@ -1821,6 +1837,7 @@ private:
   void _bindFrameBuffer();
   void _processSubCameras(const CameraPtr& camera);
   void _checkIntersections();
+  bool _getIntersectionTriggerMesh(IAction& action, AbstractMesh*& mesh);
   /** Pointers handling **/
   void _onPointerMoveEvent(PointerEvent&& evt);
   void _onPointerDownEvent(PointerEvent&& evt);
@@ -2340,7 +2357,7 @@ public:
    * An event triggered before rendering the scene (right after animations and
    * physics)
    */
-  Observable<Scene> onBeforeRenderObservable;
+  SmallObservable<Scene> onBeforeRenderObservable;
 
   /**
    * Sets a function to be executed before rendering this scene
@@ -2350,7 +2367,7 @@ public:
   /**
    * An event triggered after rendering the scene
    */
-  Observable<Scene> onAfterRenderObservable;
+  SmallObservable<Scene> onAfterRenderObservable;
 
   /**
    * Sets a function to be executed after rendering this scene
@@ -2360,32 +2377,32 @@ public:
   /**
    * An event triggered before animating the scene
    */
-  Observable<Scene> onBeforeAnimationsObservable;
+  SmallObservable<Scene> onBeforeAnimationsObservable;
 
   /**
    * An event triggered after animations processing
    */
-  Observable<Scene> onAfterAnimationsObservable;
+  SmallObservable<Scene> onAfterAnimationsObservable;
 
   /**
    * An event triggered before draw calls are ready to be sent
    */
-  Observable<Scene> onBeforeDrawPhaseObservable;
+  SmallObservable<Scene> onBeforeDrawPhaseObservable;
 
   /**
    * An event triggered after draw calls have been sent
    */
-  Observable<Scene> onAfterDrawPhaseObservable;
+  SmallObservable<Scene> onAfterDrawPhaseObservable;
 
   /**
    * An event triggered when physic simulation is about to be run
    */
-  Observable<Scene> onBeforePhysicsObservable;
+  SmallObservable<Scene> onBeforePhysicsObservable;
 
   /**
    * An event triggered when physic simulation has been done
    */
-  Observable<Scene> onAfterPhysicsObservable;
+  SmallObservable<Scene> onAfterPhysicsObservable;
 
   /**
    * An event triggered after rendering the scene
@@ -2394,7 +2411,7 @@ public:
   /**
    * An event triggered before rendering a camera
    */
-  Observable<Camera> onBeforeCameraRenderObservable;
+  SmallObservable<Camera> onBeforeCameraRenderObservable;
 
   /**
    * Sets a function to be executed before rendering a camera
@@ -2403,7 +2420,7 @@ public:
   /**
    * An event triggered after rendering a camera
    */
-  Observable<Camera> onAfterCameraRenderObservable;
+  SmallObservable<Camera> onAfterCameraRenderObservable;
 
   /**
    * Sets a function to be executed after rendering a camera
@@ -2413,40 +2430,40 @@ public:
   /**
    * An event triggered when active meshes evaluation is about to start
    */
-  Observable<Scene> onBeforeActiveMeshesEvaluationObservable;
+  SmallObservable<Scene> onBeforeActiveMeshesEvaluationObservable;
 
   /**
    * An event triggered when active meshes evaluation is done
    */
-  Observable<Scene> onAfterActiveMeshesEvaluationObservable;
+  SmallObservable<Scene> onAfterActiveMeshesEvaluationObservable;
 
   /**
    * An event triggered when particles rendering is about to start
    * Note: This event can be trigger more than once per frame (because particles
    * can be rendered by render target textures as well)
    */
-  Observable<Scene> onBeforeParticlesRenderingObservable;
+  SmallObservable<Scene> onBeforeParticlesRenderingObservable;
 
   /**
    * An event triggered when particles rendering is done
    * Note: This event can be trigger more than once per frame (because particles
    * can be rendered by render target textures as well)
    */
-  Observable<Scene> onAfterParticlesRenderingObservable;
+  SmallObservable<Scene> onAfterParticlesRenderingObservable;
 
   /**
    * An event triggered when sprites rendering is about to start
    * Note: This event can be trigger more than once per frame (because sprites can be rendered by
    * render target textures as well)
    */
-  Observable<Scene> onBeforeSpritesRenderingObservable;
+  SmallObservable<Scene> onBeforeSpritesRenderingObservable;
 
   /**
    * An event triggered when sprites rendering is done
    * Note: This event can be trigger more than once per frame (because sprites can be rendered by
    * render target textures as well)
    */
-  Observable<Scene> onAfterSpritesRenderingObservable;
+  SmallObservable<Scene> onAfterSpritesRenderingObservable;
 
   /**
    * An event triggered when SceneLoader.Append or SceneLoader.Load or
@@ -2528,23 +2545,23 @@ public:
    * An event triggered when render targets are about to be rendered
    * Can happen multiple times per frame.
    */
-  Observable<Scene> onBeforeRenderTargetsRenderObservable;
+  SmallObservable<Scene> onBeforeRenderTargetsRenderObservable;
 
   /**
    * An event triggered when render targets were rendered.
    * Can happen multiple times per frame.
    */
-  Observable<Scene> onAfterRenderTargetsRenderObservable;
+  SmallObservable<Scene> onAfterRenderTargetsRenderObservable;
 
   /**
    * An event triggered before calculating deterministic simulation step
    */
-  Observable<Scene> onBeforeStepObservable;
+  SmallObservable<Scene> onBeforeStepObservable;
 
   /**
    * An event triggered after calculating deterministic simulation step
    */
-  Observable<Scene> onAfterStepObservable;
+  SmallObservable<Scene> onAfterStepObservable;
 
   /**
    * An event triggered when the activeCamera property is updated
@@ -2559,7 +2576,7 @@ public:
    * mask with a combination of the renderingGroup index elevated to the power
    * of two (1 for renderingGroup 0, 2 for renderingrOup1, 4 for 2 and 8 for 3)
    */
-  Observable<RenderingGroupInfo> onBeforeRenderingGroupObservable;
+  SmallObservable<RenderingGroupInfo> onBeforeRenderingGroupObservable;
 
   /**
    * This Observable will be triggered after rendering each renderingGroup of
@@ -2569,7 +2586,7 @@ public:
    * mask with a combination of the renderingGroup index elevated to the power
    * of two (1 for renderingGroup 0, 2 for renderingrOup1, 4 for 2 and 8 for 3)
    */
-  Observable<RenderingGroupInfo> onAfterRenderingGroupObservable;
+  SmallObservable<RenderingGroupInfo> onAfterRenderingGroupObservable;
 
   /**
    * This Observable will when a mesh has been imported into the scene.
@@ -3403,24 +3420,28 @@ public:
 
   /**
    * Lambda returning the list of potentially active meshes.
+   * The returned list is owned by the provider and is only valid until its next call.
    */
-  std::function<std::vector<AbstractMesh*>()> getActiveMeshCandidates;
+  std::function<const std::vector<AbstractMesh*>&()> getActiveMeshCandidates;
 
   /**
    * Lambda returning the list of potentially active sub meshes.
+   * The returned list is owned by the provider and is only valid until its next call.
    */
-  std::function<std::vector<SubMesh*>(AbstractMesh* mesh)> getActiveSubMeshCandidates;
+  std::function<const std::vector<SubMesh*>&(AbstractMesh* mesh)> getActiveSubMeshCandidates;
 
   /**
    * Lambda returning the list of potentially intersecting sub meshes.
+   * The returned list is owned by the provider and is only valid until its next call.
    */
-  std::function<std::vector<SubMesh*>(AbstractMesh* mesh, const Ray& localRay)>
+  std::function<const std::vector<SubMesh*>&(AbstractMesh* mesh, const Ray& localRay)>
     getIntersectingSubMeshCandidates;
 
   /**
    * Lambda returning the list of potentially colliding sub meshes.
+   * The returned list is owned by the provider and is only valid until its next call.
    */
-  std::function<std::vector<SubMesh*>(AbstractMesh* mesh, const Collider& collider)>
+  std::function<const std::vector<SubMesh*>&(AbstractMesh* mesh, const Collider& collider)>
     getCollidingSubMeshCandidates;
 
   /**
@@ -3463,10 +3484,10 @@ private:
   // Events
   std::function<bool(Sprite* sprite)> _spritePredicate;
   Observer<Scene>::Ptr _onDisposeObserver;
-  Observer<Scene>::Ptr _onBeforeRenderObserver;
-  Observer<Scene>::Ptr _onAfterRenderObserver;
-  Observer<Camera>::Ptr _onBeforeCameraRenderObserver;
-  Observer<Camera>::Ptr _onAfterCameraRenderObserver;
+  ObserverHandle _onBeforeRenderObserver;
+  ObserverHandle _onAfterRenderObserver;
+  ObserverHandle _onBeforeCameraRenderObserver;
+  ObserverHandle _onAfterCameraRenderObserver;
   // Animations
   std::vector<std::string> _registeredForLateAnimationBindings;
   // Pointers
@@ -3634,7 +3655,9 @@ private:
   std::unique_ptr<Ray> _cachedRayForTransform;
 
   std::vector<AbstractMesh*> _defaultMeshCandidates;
-  std::vector<SubMesh*> _defaultSubMeshCandidates;
+  std::vector<SubMesh*> _defaultActiveSubMeshCandidates;
+  std::vector<SubMesh*> _defaultIntersectingSubMeshCandidates;
+  std::vector<SubMesh*> _defaultCollidingSubMeshCandidates;
 
   std::optional<bool> _audioEnabled;
   std::optional<bool> _headphone;
@@ -3642,6 +3665,12 @@ private:
   /** Hidden */
   std::unique_ptr<UniformBuffer> _multiviewSceneUbo;
 
+  // Intersection triggers, the broadphase storage being reused across frames
+  std::unique_ptr<SweepAndPrune> _intersectionBroadphase;
+  std::unordered_map<AbstractMesh*, size_t> _intersectionBoxIndices;
+  std::vector<AbstractMesh*> _intersectionBoxMeshes;
+  std::vector<std::pair<AbstractMesh*, bool>> _intersectionCandidates;
+
 }; // end of class Scene
 
 } // end of namespace BABYLON
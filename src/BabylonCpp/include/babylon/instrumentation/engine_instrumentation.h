@@ -2,6 +2,7 @@
 #define BABYLON_INSTRUMENTATION_ENGINE_INSTRUMENTATION_H
 
 #include <babylon/babylon_api.h>
+#include <babylon/core/profiling/memory_tracker.h>
 #include <babylon/instrumentation/_time_token.h>
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/misc/observer.h>
@@ -33,6 +34,28 @@ public:
    */
   void dispose(bool doNotRecurse = false, bool disposeMaterialAndTextures = false) override;
 
+  /**
+   * @brief Gets the number of bytes currently allocated in a memory category, for all the engines
+   * and scenes of the process.
+   * @param category Defines the memory category
+   * @returns the number of bytes
+   */
+  [[nodiscard]] size_t getMemoryUsage(MemoryCategory category) const;
+
+  /**
+   * @brief Gets the maximum number of bytes allocated in a memory category.
+   * @param category Defines the memory category
+   * @returns the number of bytes
+   */
+  [[nodiscard]] size_t getPeakMemoryUsage(MemoryCategory category) const;
+
+  /**
+   * @brief Serializes the memory counters of all the categories, along with the process resident
+   * set size.
+   * @returns the JSON representation of the memory usage
+   */
+  [[nodiscard]] json serializeMemoryUsage() const;
+
 protected:
   // Properties
   /**
@@ -1,7 +1,10 @@
 #ifndef BABYLON_INSTRUMENTATION_SCENE_INSTRUMENTATION_H
 #define BABYLON_INSTRUMENTATION_SCENE_INSTRUMENTATION_H
 
+#include <array>
+
 #include <babylon/babylon_api.h>
+#include <babylon/core/profiling/memory_tracker.h>
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/misc/observer.h>
 #include <babylon/misc/perf_counter.h>
@@ -33,6 +36,21 @@ public:
    */
   void dispose(bool doNotRecurse = false, bool disposeMaterialAndTextures = false) override;
 
+  /**
+   * @brief Gets the number of bytes allocated in a memory category by the objects of the scene.
+   * Engine wide categories (effect cache, loader staging buffers) are not attributed to a scene
+   * and are reported as 0, use EngineInstrumentation to read them.
+   * @param category Defines the memory category
+   * @returns the number of bytes
+   */
+  [[nodiscard]] size_t getMemoryUsage(MemoryCategory category) const;
+
+  /**
+   * @brief Serializes the memory used by the objects of the scene, per category.
+   * @returns the JSON representation of the memory usage
+   */
+  [[nodiscard]] json serializeMemoryUsage() const;
+
 protected:
   // Properties
   /**
@@ -303,6 +321,9 @@ public:
    */
   ReadOnlyProperty<SceneInstrumentation, PerfCounter> drawCallsCounter;
 
+private:
+  [[nodiscard]] std::array<size_t, MemoryTracker::CategoryCount> _computeMemoryUsage() const;
+
 private:
   bool _captureActiveMeshesEvaluationTime;
   PerfCounter _activeMeshesEvaluationTime;
@@ -11,6 +11,7 @@
 #include <babylon/babylon_common.h>
 #include <babylon/core/array_buffer_view.h>
 #include <babylon/core/data_view.h>
+#include <babylon/core/profiling/memory_tracker.h>
 #include <babylon/loading/plugins/gltf/2.0/gltf_loader_interfaces.h>
 #include <babylon/loading/plugins/gltf/igltf_loader.h>
 
@@ -544,6 +545,7 @@ private:
   MeshPtr _rootBabylonMesh;
   std::unordered_map<unsigned int, MaterialPtr> _defaultBabylonMaterialData;
   std::function<void(const SceneLoaderProgressEvent& event)> _progressCallback;
+  TrackedMemory _stagingMemory;
 
 }; // end of class GLTFLoader
 
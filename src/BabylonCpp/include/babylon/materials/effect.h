@@ -5,6 +5,7 @@
 #include <variant>
 
 #include <babylon/babylon_api.h>
+#include <babylon/core/profiling/memory_tracker.h>
 #include <babylon/babylon_common.h>
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/misc/observable.h>
@@ -602,6 +603,7 @@ private:
   void _processCompilationErrors(const std::exception& e,
                                  const IPipelineContextPtr& previousPipelineContext);
   int _getChannel(const std::string& channel);
+  void _updateSourceCodeMemory();
 
 public:
   /**
@@ -678,6 +680,12 @@ public:
    */
   ReadOnlyProperty<Effect, std::string> fragmentSourceCode;
 
+  /**
+   * Hidden
+   * Memory used by the processed shader sources of this effect
+   */
+  TrackedMemory _sourceCodeMemory;
+
 private:
   Observer<Effect>::Ptr _onCompileObserver;
   static std::size_t _uniqueIdSeed;
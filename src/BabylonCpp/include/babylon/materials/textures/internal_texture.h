@@ -6,6 +6,7 @@
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
 #include <babylon/core/array_buffer_view.h>
+#include <babylon/core/profiling/memory_tracker.h>
 #include <babylon/core/structs.h>
 #include <babylon/materials/textures/iinternal_texture_tracker.h>
 #include <babylon/misc/observable.h>
@@ -149,6 +150,18 @@ public:
    */
   void dispose();
 
+  /**
+   * @brief Hidden
+   * Updates the estimated GPU memory used by the texture from its size, format, type, layers and
+   * mip chain.
+   */
+  void _updateMemoryEstimate();
+
+  /**
+   * @brief Returns the estimated GPU memory used by the texture, in bytes.
+   */
+  [[nodiscard]] size_t getEstimatedMemorySize() const;
+
 protected:
   /**
    * @brief Creates a new InternalTexture.
@@ -325,6 +338,8 @@ public:
 
   WebGLTexturePtr _webGLTexture;
   int _references;
+  /** Hidden */
+  TrackedMemory _gpuMemory;
 
 private:
   ThinEngine* _engine;
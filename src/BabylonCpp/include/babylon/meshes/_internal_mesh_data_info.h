@@ -6,7 +6,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
-#include <babylon/misc/observable.h>
+#include <babylon/misc/small_observable.h>
 
 namespace BABYLON {
 
@@ -21,10 +21,10 @@ using MorphTargetManagerPtr = std::shared_ptr<MorphTargetManager>;
  */
 struct BABYLON_SHARED_EXPORT _InternalMeshDataInfo {
   // Events
-  Observable<Mesh> _onBeforeRenderObservable;
-  Observable<Mesh> _onBeforeBindObservable;
-  Observable<Mesh> _onAfterRenderObservable;
-  Observable<Mesh> _onBeforeDrawObservable;
+  SmallObservable<Mesh> _onBeforeRenderObservable;
+  SmallObservable<Mesh> _onBeforeBindObservable;
+  SmallObservable<Mesh> _onAfterRenderObservable;
+  SmallObservable<Mesh> _onBeforeDrawObservable;
 
   // Will be used by ribbons mainly
   bool _areNormalsFrozen = false;
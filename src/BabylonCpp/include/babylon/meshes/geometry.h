@@ -6,6 +6,7 @@
 #include <nlohmann/json_fwd.hpp>
 
 #include <babylon/babylon_api.h>
+#include <babylon/core/profiling/memory_tracker.h>
 #include <babylon/core/structs.h>
 #include <babylon/meshes/iget_set_vertices_data.h>
 
@@ -187,7 +188,7 @@ public:
    * @param kind defines the data kind (Position, normal, etc...)
    * @returns a VertexBuffer
    */
-  std::unordered_map<std::string, VertexBufferPtr> getVertexBuffers();
+  const std::unordered_map<std::string, VertexBufferPtr>& getVertexBuffers();
 
   /**
    * @brief Gets a boolean indicating if specific vertex buffer is present.
@@ -403,6 +404,7 @@ private:
   void notifyUpdate(const std::string& kind = "");
   void _queueLoad(Scene* scene, const std::function<void()>& onLoaded);
   void _disposeVertexArrayObjects();
+  void _updateVertexDataMemory();
 
 public:
   // Members
@@ -448,6 +450,10 @@ public:
   // Cache
   /** Hidden */
   std::vector<Vector3> _positions;
+  /** Hidden */
+  TrackedMemory _vertexDataMemory;
+  /** Hidden */
+  TrackedMemory _indexDataMemory;
 
   /**
    *  Gets or sets the Bias Vector to apply on the bounding elements
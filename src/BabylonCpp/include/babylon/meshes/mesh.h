@@ -7,6 +7,7 @@
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/iget_set_vertices_data.h>
 #include <babylon/meshes/vertex_data_constants.h>
+#include <babylon/misc/small_observable.h>
 
 namespace BABYLON {
 
@@ -197,7 +198,7 @@ public:
     TransformNode* newParent                                   = nullptr,
     const std::optional<InstantiateHierarychyOptions>& options = std::nullopt,
     const std::function<void(TransformNode* source, TransformNode* clone)>& onNewNodeCreated
-    = nullptr);
+    = nullptr) override;
 
   /**
    * @brief Gets the class name.
@@ -1725,22 +1726,22 @@ protected:
   /**
    * @brief An event triggered before rendering the mesh.
    */
-  Observable<Mesh>& get_onBeforeRenderObservable();
+  SmallObservable<Mesh>& get_onBeforeRenderObservable();
 
   /**
    * @brief An event triggered before binding the mesh.
    */
-  Observable<Mesh>& get_onBeforeBindObservable();
+  SmallObservable<Mesh>& get_onBeforeBindObservable();
 
   /**
    * @brief An event triggered after rendering the mesh.
    */
-  Observable<Mesh>& get_onAfterRenderObservable();
+  SmallObservable<Mesh>& get_onAfterRenderObservable();
 
   /**
    * @brief An event triggered before drawing the mesh.
    */
-  Observable<Mesh>& get_onBeforeDrawObservable();
+  SmallObservable<Mesh>& get_onBeforeDrawObservable();
 
   /**
    * @brief Sets a callback to call before drawing the mesh. It is recommended
@@ -1850,22 +1851,22 @@ public:
   /**
    * An event triggered before rendering the mesh
    */
-  ReadOnlyProperty<Mesh, Observable<Mesh>> onBeforeRenderObservable;
+  ReadOnlyProperty<Mesh, SmallObservable<Mesh>> onBeforeRenderObservable;
 
   /**
    * An event triggered before binding the mesh
    */
-  ReadOnlyProperty<Mesh, Observable<Mesh>> onBeforeBindObservable;
+  ReadOnlyProperty<Mesh, SmallObservable<Mesh>> onBeforeBindObservable;
 
   /**
    * An event triggered after rendering the mesh
    */
-  ReadOnlyProperty<Mesh, Observable<Mesh>> onAfterRenderObservable;
+  ReadOnlyProperty<Mesh, SmallObservable<Mesh>> onAfterRenderObservable;
 
   /**
    * An event triggered before drawing the mesh
    */
-  ReadOnlyProperty<Mesh, Observable<Mesh>> onBeforeDrawObservable;
+  ReadOnlyProperty<Mesh, SmallObservable<Mesh>> onBeforeDrawObservable;
 
   /**
    * Sets a callback to call before drawing the mesh. It is recommended to use
@@ -5,6 +5,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/engines/node.h>
+#include <babylon/misc/small_observable.h>
 
 namespace BABYLON {
 
@@ -178,7 +179,7 @@ public:
    * created
    * @returns an instance (or a clone) of the current node with its hiearchy
    */
-  TransformNodePtr instantiateHierarchy(
+  virtual TransformNodePtr instantiateHierarchy(
     TransformNode* newParent                                   = nullptr,
     const std::optional<InstantiateHierarychyOptions>& options = std::nullopt,
     const std::function<void(TransformNode* source, TransformNode* clone)>& onNewNodeCreated
@@ -811,7 +812,7 @@ protected:
   /**
    * An event triggered after the world matrix is updated
    */
-  Observable<TransformNode> onAfterWorldMatrixUpdateObservable;
+  SmallObservable<TransformNode> onAfterWorldMatrixUpdateObservable;
 
 private:
   static std::unique_ptr<Vector3> _lookAtVectorCache;
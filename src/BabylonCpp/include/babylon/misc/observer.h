@@ -1,6 +1,7 @@
 #ifndef BABYLON_MISC_OBSERVER_H
 #define BABYLON_MISC_OBSERVER_H
 
+#include <cstdint>
 #include <functional>
 #include <babylon/misc/event_state.h>
 
@@ -23,6 +24,8 @@ public:
    */
   Observer()
       : _willBeUnregistered{false}
+      , _handleId{0}
+      , _handleOwner{nullptr}
       , unregisterOnNextCall{false}
       , callback{nullptr}
       , mask{-1}
@@ -38,6 +41,8 @@ public:
    */
   Observer(const CallbackFunc& iCallback, int iMask, any* iScope)
       : _willBeUnregistered{false}
+      , _handleId{0}
+      , _handleOwner{nullptr}
       , unregisterOnNextCall{false}
       , callback{iCallback}
       , mask{iMask}
@@ -55,6 +60,10 @@ public:
 public:
   /** Hidden */
   bool _willBeUnregistered;
+  /** Hidden (packed SmallObservable handle when this observer is a proxy) */
+  uint64_t _handleId;
+  /** Hidden (SmallObservable which created this observer when it is a proxy) */
+  const void* _handleOwner;
   /**
    * Gets or sets a property defining that the observer as to be unregistered
    * after the next notification
@@ -12,12 +12,16 @@ public:
   HardwareScalingOptimization(int priority = 0, int maximumSize = 2);
   ~HardwareScalingOptimization() override; // = default
 
+  [[nodiscard]] std::string getDescription() const override;
   bool apply(Scene* scene) override;
+  bool revert(Scene* scene) override;
 
 public:
   int maximumScale;
 
 private:
+  // Scaling level of the engine before the first application
+  float _initialScale;
   int _currentScale;
 
 }; // end of class SceneOptimization
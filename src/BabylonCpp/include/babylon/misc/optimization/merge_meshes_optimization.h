@@ -21,7 +21,13 @@ public:
   MergeMeshesOptimization(int priority = 0);
   ~MergeMeshesOptimization() override; // = default
 
+  [[nodiscard]] std::string getDescription() const override;
   bool apply(Scene* scene) override;
+
+  /**
+   * @brief The merged meshes are disposed and cannot be restored.
+   */
+  [[nodiscard]] bool canRevert() const override;
   bool _apply(Scene* scene, bool updateSelectionTree = false);
 
 private:
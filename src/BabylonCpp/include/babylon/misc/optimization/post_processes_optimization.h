@@ -1,6 +1,8 @@
 #ifndef BABYLON_MISC_OPTIMIZATION_POST_PROCESS_OPTIMIZATION_H
 #define BABYLON_MISC_OPTIMIZATION_POST_PROCESS_OPTIMIZATION_H
 
+#include <optional>
+
 #include <babylon/babylon_api.h>
 #include <babylon/misc/optimization/scene_optimization.h>
 
@@ -12,7 +14,12 @@ public:
   PostProcessesOptimization(int priority = 0);
   ~PostProcessesOptimization() override; // = default
 
+  [[nodiscard]] std::string getDescription() const override;
   bool apply(Scene* scene) override;
+  bool revert(Scene* scene) override;
+
+private:
+  std::optional<bool> _wasEnabled;
 
 }; // end of class PostProcessesOptimization
 
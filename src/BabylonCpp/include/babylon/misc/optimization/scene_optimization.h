@@ -1,21 +1,58 @@
 #ifndef BABYLON_MISC_OPTIMIZATION_SCENE_OPTIMIZATION_H
 #define BABYLON_MISC_OPTIMIZATION_SCENE_OPTIMIZATION_H
 
+#include <memory>
+#include <string>
+
 #include <babylon/babylon_api.h>
 
 namespace BABYLON {
 
 class Scene;
+class SceneOptimization;
+using SceneOptimizationPtr = std::shared_ptr<SceneOptimization>;
 
+/**
+ * @brief Defines the root class used to create scene optimization to use with SceneOptimizer.
+ * @description More details at http://doc.babylonjs.com/how_to/how_to_use_sceneoptimizer
+ */
 class BABYLON_SHARED_EXPORT SceneOptimization {
 
 public:
   SceneOptimization(int priority = 0);
   virtual ~SceneOptimization(); // = default
 
+  /**
+   * @brief Gets a string describing the action executed by the current optimization.
+   * @returns description string
+   */
+  [[nodiscard]] virtual std::string getDescription() const;
+
+  /**
+   * @brief This function will be called by the SceneOptimizer when its priority is reached in
+   * order to apply the change required by the current optimization.
+   * @param scene defines the current scene where to apply this optimization
+   * @returns true if everything that can be done was applied
+   */
   virtual bool apply(Scene* scene);
 
+  /**
+   * @brief This function will be called by the SceneOptimizer when the frame rate allows to undo
+   * one application of the optimization.
+   * @param scene defines the current scene where to revert this optimization
+   * @returns true if the scene is back to its state before the first application
+   */
+  virtual bool revert(Scene* scene);
+
+  /**
+   * @brief Gets whether the optimization can be reverted.
+   */
+  [[nodiscard]] virtual bool canRevert() const;
+
 public:
+  /**
+   * Defines the priority of this optimization (0 by default which means first in the list)
+   */
   int priority;
 
 }; // end of class SceneOptimization
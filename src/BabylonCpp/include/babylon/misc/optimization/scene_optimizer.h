@@ -2,28 +2,195 @@
 #define BABYLON_MISC_OPTIMIZATION_SCENE_OPTIMIZER_H
 
 #include <functional>
+#include <optional>
+#include <unordered_set>
 
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/core/time.h>
+#include <babylon/misc/observable.h>
 #include <babylon/misc/optimization/scene_optimizer_options.h>
+#include <babylon/misc/small_observable.h>
 
 namespace BABYLON {
 
-struct BABYLON_SHARED_EXPORT SceneOptimizer {
+class SceneOptimizer;
+using SceneOptimizerPtr = std::shared_ptr<SceneOptimizer>;
 
-  static void
-  _CheckCurrentState(Scene* scene, SceneOptimizerOptions& options,
-                     int currentPriorityLevel,
-                     const std::function<void()>& onSuccess = nullptr,
-                     const std::function<void()>& onFailure = nullptr);
+/**
+ * @brief Class used to run optimizations in order to reach a target frame rate.
+ *
+ * The optimizer keeps a rolling average of the frame time, the largest of the CPU and GPU times
+ * of each frame. When the average exceeds the budget of the target frame rate, the optimizations
+ * of the next priority level are applied. When the average, corrected by the time saved by the
+ * last applied level, fits in the budget with some headroom, the optimizations of that level are
+ * reverted, except the ones which cannot be reverted and stay applied. After each change the
+ * scene runs for trackerDuration milliseconds of frames before the next check.
+ * @description More details at http://doc.babylonjs.com/how_to/how_to_use_sceneoptimizer
+ */
+class BABYLON_SHARED_EXPORT SceneOptimizer {
 
-  static void
+public:
+  template <typename... Ts>
+  static SceneOptimizerPtr New(Ts&&... args)
+  {
+    return std::shared_ptr<SceneOptimizer>(new SceneOptimizer(std::forward<Ts>(args)...));
+  }
+  ~SceneOptimizer(); // = default
+
+  SceneOptimizer(const SceneOptimizer&) = delete;
+  SceneOptimizer& operator=(const SceneOptimizer&) = delete;
+
+  /**
+   * @brief Gets the current priority level (0 at start).
+   */
+  [[nodiscard]] int currentPriorityLevel() const;
+
+  /**
+   * @brief Gets the rolling average of the frame time, in milliseconds.
+   */
+  [[nodiscard]] float currentFrameTime() const;
+
+  /**
+   * @brief Gets the current frame rate checked by the SceneOptimizer.
+   */
+  [[nodiscard]] float currentFrameRate() const;
+
+  /**
+   * @brief Gets the frame time budget of the target frame rate, in milliseconds.
+   */
+  [[nodiscard]] float frameTimeBudget() const;
+
+  /**
+   * @brief Gets a boolean indicating if the optimizer is running.
+   */
+  [[nodiscard]] bool isRunning() const;
+
+  /**
+   * @brief Gets the optimizations currently applied to the scene, in the order of application.
+   */
+  [[nodiscard]] std::vector<SceneOptimizationPtr> getActiveOptimizations() const;
+
+  /**
+   * @brief Start the optimizer. By default it will try to reach a specific framerate but if the
+   * optimizer is not able to reach that framerate, it will raise the onFailureObservable.
+   */
+  void start();
+
+  /**
+   * @brief Stops the current optimizer.
+   */
+  void stop();
+
+  /**
+   * @brief Reverts all the optimizations that can be reverted and resets the optimizer to
+   * priority level 0.
+   */
+  void reset();
+
+  /**
+   * @brief Release all resources.
+   */
+  void dispose();
+
+  /**
+   * @brief Adds the times of a frame to the rolling average and applies or reverts
+   * optimizations, called after each render of the scene with the frame time sources.
+   * @param cpuFrameTime defines the CPU time of the frame, in milliseconds
+   * @param gpuFrameTime defines the GPU time of the frame, in milliseconds
+   */
+  void sampleFrame(float cpuFrameTime, float gpuFrameTime = 0.f);
+
+  /**
+   * @brief Creates and starts an optimizer for a scene.
+   * @param scene defines the scene to optimize
+   * @param options defines the options to use with the SceneOptimizer
+   * @param onSuccess defines a callback to call on success
+   * @param onFailure defines a callback to call on failure
+   * @returns the new SceneOptimizer object, the optimization stops when it is released
+   */
+  static SceneOptimizerPtr
   OptimizeAsync(Scene* scene,
                 const SceneOptimizerOptions& options
                 = SceneOptimizerOptions::ModerateDegradationAllowed(),
                 const std::function<void()>& onSuccess = nullptr,
                 const std::function<void()>& onFailure = nullptr);
 
-}; // end of struct SceneOptimizer
+protected:
+  /**
+   * @brief Creates a new SceneOptimizer.
+   * @param scene defines the scene to work on
+   * @param options defines the options to use with the SceneOptimizer
+   */
+  SceneOptimizer(Scene* scene, const SceneOptimizerOptions& options
+                               = SceneOptimizerOptions::ModerateDegradationAllowed());
+
+private:
+  struct AppliedLevel {
+    int priority;
+    std::vector<SceneOptimizationPtr> optimizations;
+    // Average frame times before the application and once the scene ran with it
+    float frameTimeBefore;
+    std::optional<float> frameTimeAfter;
+  };
+
+  void _resetFrameTimes();
+  bool _applyNextLevel(float frameTime);
+  bool _revertLastLevel(float frameTime);
+
+public:
+  /**
+   * Defines the source of the CPU time of the frames, in milliseconds. By default, the time
+   * spent in the render function of the scene is measured
+   */
+  std::function<float()> cpuFrameTimeSource;
+
+  /**
+   * Defines the source of the GPU time of the frames, in milliseconds, not used by default
+   */
+  std::function<float()> gpuFrameTimeSource;
+
+  /**
+   * Defines an observable called when the optimizer reaches the target frame rate
+   */
+  Observable<SceneOptimizer> onSuccessObservable;
+
+  /**
+   * Defines an observable called when the optimizer enables an optimization
+   */
+  Observable<SceneOptimization> onNewOptimizationAppliedObservable;
+
+  /**
+   * Defines an observable called when the optimizer reverts an optimization
+   */
+  Observable<SceneOptimization> onOptimizationRevertedObservable;
+
+  /**
+   * Defines an observable called when the optimizer is not able to reach the target frame rate
+   */
+  Observable<SceneOptimizer> onFailureObservable;
+
+private:
+  Scene* _scene;
+  SceneOptimizerOptions _options;
+  bool _isRunning;
+  int _currentPriorityLevel;
+  std::vector<AppliedLevel> _appliedLevels;
+  // Optimizations that reported everything was applied
+  std::unordered_set<SceneOptimization*> _completedOptimizations;
+  // Rolling window of frame times
+  Float32Array _frameTimes;
+  size_t _frameTimeIndex;
+  size_t _frameTimeCount;
+  float _frameTimeSum;
+  float _timeSinceLastChange;
+  bool _isWithinBudget;
+  bool _hasFailed;
+  high_res_time_point_t _renderStart;
+  ObserverHandle _beforeAnimationsObserver;
+  ObserverHandle _afterRenderObserver;
+
+}; // end of class SceneOptimizer
 
 } // end of namespace BABYLON
 
@@ -18,6 +18,13 @@ public:
   SceneOptimizerOptions& operator=(SceneOptimizerOptions&& other);
   ~SceneOptimizerOptions(); // = default
 
+  /**
+   * @brief Add a new optimization.
+   * @param optimization defines the SceneOptimization to add to the list of active optimizations
+   * @returns the current SceneOptimizerOptions
+   */
+  SceneOptimizerOptions& addOptimization(const SceneOptimizationPtr& optimization);
+
   static SceneOptimizerOptions LowDegradationAllowed(float targetFrameRate
                                                      = 60);
 
@@ -28,10 +35,33 @@ public:
                                                       = 60);
 
 public:
-  std::vector<SceneOptimization> optimizations;
+  /**
+   * Defines the list of optimizations to apply
+   */
+  std::vector<SceneOptimizationPtr> optimizations;
+
+  /**
+   * Defines the target frame rate to reach (60 by default)
+   */
   float targetFrameRate;
+
+  /**
+   * Defines the time, in milliseconds of rendered frames, to let the scene run after a change
+   * before checking the frame time again (2000 by default)
+   */
   int trackerDuration;
 
+  /**
+   * Defines the number of frames of the rolling frame time average (60 by default)
+   */
+  size_t frameTimeSampleCount;
+
+  /**
+   * Defines the fraction of the frame time budget that must remain free once an optimization is
+   * reverted, so that the optimizer does not oscillate between two levels (0.2 by default)
+   */
+  float headroom;
+
 }; // end of class SceneOptimizerOptions
 
 } // end of namespace BABYLON
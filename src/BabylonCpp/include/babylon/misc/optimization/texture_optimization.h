@@ -12,8 +12,14 @@ public:
   TextureOptimization(int priority = 0, int maximumSize = 1024);
   ~TextureOptimization() override; // = default
 
+  [[nodiscard]] std::string getDescription() const override;
   bool apply(Scene* scene) override;
 
+  /**
+   * @brief The textures are not scaled back up: their data was released.
+   */
+  [[nodiscard]] bool canRevert() const override;
+
 public:
   int maximumSize;
 
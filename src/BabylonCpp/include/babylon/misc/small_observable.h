@@ -0,0 +1,509 @@
+#ifndef BABYLON_MISC_SMALL_OBSERVABLE_H
+#define BABYLON_MISC_SMALL_OBSERVABLE_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <babylon/misc/event_state.h>
+#include <babylon/misc/observer.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Lightweight reference to an observer registered to a SmallObservable.
+ * A handle becomes stale as soon as its observer is removed: the slot
+ * generation no longer matches and removing it again is a no-op.
+ */
+struct ObserverHandle {
+  static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+  uint32_t index      = InvalidIndex;
+  uint32_t generation = 0;
+
+  explicit operator bool() const
+  {
+    return index != InvalidIndex;
+  }
+
+  /**
+   * @brief Packs the handle into a 64 bits integer (0 is the invalid handle).
+   */
+  uint64_t pack() const
+  {
+    return index == InvalidIndex ? 0 : ((uint64_t(generation) << 32) | (uint64_t(index) + 1));
+  }
+
+  /**
+   * @brief Unpacks a handle packed with pack().
+   */
+  static ObserverHandle Unpack(uint64_t packed)
+  {
+    ObserverHandle handle;
+    if (packed != 0) {
+      handle.index      = static_cast<uint32_t>(packed & 0xFFFFFFFF) - 1;
+      handle.generation = static_cast<uint32_t>(packed >> 32);
+    }
+    return handle;
+  }
+}; // end of struct ObserverHandle
+
+/**
+ * @brief Allocation-free variant of the Observable class intended for the
+ * observables notified every frame.
+ *
+ * The first N observers are stored inline, the observers are referenced
+ * through generation-counted handles instead of shared pointers and are
+ * notified by walking a dense array of slot pointers. Removing an observer is
+ * O(1): the slot is flagged as dead and the array is compacted lazily, when no
+ * notification is in progress. Notifying an observable without observers is a
+ * single comparison.
+ *
+ * The add / remove / notifyObservers API mirrors the one of Observable<T>: the
+ * returned handle converts to an Observer<T>::Ptr so existing call sites that
+ * keep the observer as a shared pointer still compile (the conversion
+ * allocates a proxy observer, only use it outside of hot paths).
+ */
+template <class T, size_t N = 4>
+class SmallObservable {
+
+public:
+  using CallbackFunc = std::function<void(T* eventData, EventState& eventState)>;
+
+  /**
+   * @brief Handle returned by add(), converts to an Observer<T>::Ptr proxy.
+   * It keeps the observable which created it, so that it can not remove the
+   * observer of another observable using the same slot and generation.
+   */
+  struct Handle : public ObserverHandle {
+    Handle() = default;
+    Handle(const ObserverHandle& other, const SmallObservable* iOwner = nullptr)
+        : ObserverHandle{other}, owner{iOwner}
+    {
+    }
+
+    operator typename Observer<T>::Ptr() const
+    {
+      if (!*this) {
+        return nullptr;
+      }
+      auto proxy          = std::make_shared<Observer<T>>();
+      proxy->_handleId    = pack();
+      proxy->_handleOwner = owner;
+      return proxy;
+    }
+
+    const SmallObservable* owner = nullptr;
+  }; // end of struct Handle
+
+public:
+  /**
+   * @brief Creates a new observable.
+   */
+  SmallObservable()
+      : _eventState{0}
+      , _inlineOrder{}
+      , _order{_inlineOrder.data()}
+      , _orderSize{0}
+      , _orderCapacity{static_cast<uint32_t>(N)}
+      , _freeList{nullptr}
+      , _slotCount{0}
+      , _liveCount{0}
+      , _deadCount{0}
+      , _notifyDepth{0}
+      , _frontInsertionCount{0}
+  {
+  }
+
+  SmallObservable(const SmallObservable&) = delete;
+  SmallObservable& operator=(const SmallObservable&) = delete;
+
+  ~SmallObservable() = default;
+
+  /**
+   * @brief Returns whether or not this observable has observers.
+   */
+  operator bool() const
+  {
+    return _liveCount != 0;
+  }
+
+  /**
+   * @brief Create a new Observer with the specified callback.
+   * @param callback the callback that will be executed for that Observer
+   * @param mask the mask used to filter observers
+   * @param insertFirst if true the callback will be inserted at the first
+   * position, hence executed before the others ones. If false (default
+   * behavior) the callback will be inserted at the last position, executed
+   * after all the others already present.
+   * @param scope optional scope for the callback to be called from
+   * @param unregisterOnFirstCall defines if the observer as to be unregistered
+   * after the next notification
+   * @returns the handle of the new observer created for the callback
+   */
+  Handle add(CallbackFunc callback, int mask = -1, bool insertFirst = false, any* scope = nullptr,
+             bool unregisterOnFirstCall = false)
+  {
+    if (!callback) {
+      return Handle{};
+    }
+
+    if (_notifyDepth == 0 && _deadCount > 0 && 2 * _deadCount >= _orderSize) {
+      _compact();
+    }
+
+    auto slot                  = _allocateSlot();
+    slot->callback             = std::move(callback);
+    slot->mask                 = mask;
+    slot->scope                = scope;
+    slot->unregisterOnNextCall = unregisterOnFirstCall;
+    slot->alive                = true;
+    ++_liveCount;
+
+    _reserveOrder(_orderSize + 1);
+    if (insertFirst) {
+      std::move_backward(_order, _order + _orderSize, _order + _orderSize + 1);
+      _order[0] = slot;
+      ++_frontInsertionCount;
+    }
+    else {
+      _order[_orderSize] = slot;
+    }
+    ++_orderSize;
+
+    ObserverHandle handle;
+    handle.index      = slot->index;
+    handle.generation = slot->generation;
+    return Handle{handle, this};
+  }
+
+  /**
+   * @brief Create a new Observer with the specified callback and unregisters
+   * after the next notification.
+   * @param callback the callback that will be executed for that Observer
+   * @returns the handle of the new observer created for the callback
+   */
+  Handle addOnce(CallbackFunc callback)
+  {
+    return add(std::move(callback), -1, false, nullptr, true);
+  }
+
+  /**
+   * @brief Remove an Observer from the Observable object.
+   * @param handle the handle of the Observer to remove, a plain handle only
+   * carries a slot and a generation so it must come from this Observable
+   * @returns false if it doesn't belong to this Observable
+   */
+  bool remove(const ObserverHandle& handle)
+  {
+    if (!_isLive(handle)) {
+      return false;
+    }
+    _release(&_slot(handle.index));
+    return true;
+  }
+
+  /**
+   * @brief Remove an Observer from the Observable object.
+   * @param handle the handle returned by add()
+   * @returns false if it doesn't belong to this Observable
+   */
+  bool remove(const Handle& handle)
+  {
+    if (handle.owner != nullptr && handle.owner != this) {
+      return false;
+    }
+    return remove(static_cast<const ObserverHandle&>(handle));
+  }
+
+  /**
+   * @brief Remove an Observer from the Observable object.
+   * @param observer the proxy observer obtained from a handle of this
+   * Observable
+   * @returns false if it doesn't belong to this Observable
+   */
+  bool remove(const typename Observer<T>::Ptr& observer)
+  {
+    if (!observer || observer->_handleOwner != this) {
+      return false;
+    }
+    return remove(ObserverHandle::Unpack(observer->_handleId));
+  }
+
+  /**
+   * @brief Remove a callback from the Observable object.
+   * @param callback the callback to remove, matched on its target type (and
+   * target for plain function pointers)
+   * @returns false if it doesn't belong to this Observable
+   */
+  bool removeCallback(const CallbackFunc& callback)
+  {
+    using FunctionPtr = void (*)(T*, EventState&);
+    for (uint32_t i = 0; i < _orderSize; ++i) {
+      auto slot = _order[i];
+      if (!slot->alive || slot->callback.target_type() != callback.target_type()) {
+        continue;
+      }
+      auto ptr1 = slot->callback.template target<FunctionPtr>();
+      auto ptr2 = callback.template target<FunctionPtr>();
+      if (!ptr1 || !ptr2 || *ptr1 == *ptr2) {
+        _release(slot);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Moves the observable to the top of the observer list making it get
+   * called first when notified.
+   * @param handle the observer to move
+   */
+  void makeObserverTopPriority(const ObserverHandle& handle)
+  {
+    if (_isLive(handle)) {
+      auto slot = &_slot(handle.index);
+      auto it   = std::find(_order, _order + _orderSize, slot);
+      std::rotate(_order, it, it + 1);
+    }
+  }
+
+  /**
+   * @brief Moves the observable to the bottom of the observer list making it
+   * get called last when notified.
+   * @param handle the observer to move
+   */
+  void makeObserverBottomPriority(const ObserverHandle& handle)
+  {
+    if (_isLive(handle)) {
+      auto slot = &_slot(handle.index);
+      auto it   = std::find(_order, _order + _orderSize, slot);
+      std::rotate(it, it + 1, _order + _orderSize);
+    }
+  }
+
+  /**
+   * @brief Notify all Observers by calling their respective callback with the
+   * given data. Will return true if all observers were executed, false if an
+   * observer set skipNextObservers to true, then prevent the subsequent ones to
+   * execute
+   * @param eventData defines the data to send to all observers
+   * @param mask defines the mask of the current notification (observers with
+   * incompatible mask (ie mask & observer.mask === 0) will not be notified)
+   * @param target defines the original target of the state
+   * @param currentTarget defines the current target of the state
+   * @returns false if the complete observer chain was not processed (because
+   * one observer set the skipNextObservers to true)
+   */
+  bool notifyObservers(T* eventData = nullptr, int mask = -1, any* target = nullptr,
+                       any* currentTarget = nullptr)
+  {
+    if (_liveCount == 0) {
+      return true;
+    }
+
+    auto& state             = _eventState;
+    state.mask              = mask;
+    state.target            = target;
+    state.currentTarget     = currentTarget;
+    state.skipNextObservers = false;
+    state.lastReturnValue   = eventData;
+
+    bool completed = true;
+    ++_notifyDepth;
+    // Slots never move and dead slots are only recycled by the compaction,
+    // which does not run while notifying: observers can safely be added or
+    // removed from the callbacks
+    for (uint32_t i = 0; i < _orderSize; ++i) {
+      auto slot = _order[i];
+      if (!slot->alive || !(slot->mask & mask)) {
+        continue;
+      }
+      const auto frontInsertionCount = _frontInsertionCount;
+      slot->callback(eventData, state);
+      // The observers inserted first by the callback shifted the current one
+      i += _frontInsertionCount - frontInsertionCount;
+      if (slot->alive && slot->unregisterOnNextCall) {
+        _release(slot);
+      }
+      if (state.skipNextObservers) {
+        completed = false;
+        break;
+      }
+    }
+    if (--_notifyDepth == 0 && _deadCount > 0) {
+      _compact();
+    }
+    return completed;
+  }
+
+  /**
+   * @brief Gets a boolean indicating if the observable has at least one
+   * observer.
+   * @returns true is the Observable has at least one Observer registered
+   */
+  [[nodiscard]] bool hasObservers() const
+  {
+    return _liveCount != 0;
+  }
+
+  /**
+   * @brief Returns the number of registered observers.
+   */
+  [[nodiscard]] size_t observerCount() const
+  {
+    return _liveCount;
+  }
+
+  /**
+   * @brief Clear the list of observers.
+   */
+  void clear()
+  {
+    for (uint32_t i = 0; i < _orderSize; ++i) {
+      if (_order[i]->alive) {
+        _release(_order[i]);
+      }
+    }
+    if (_notifyDepth == 0) {
+      _compact();
+    }
+  }
+
+  /**
+   * @brief Does this observable handles observer registered with a given mask.
+   * @param mask defines the mask to be tested
+   * @return whether or not one observer registered with the given mask is
+   *handeled
+   **/
+  bool hasSpecificMask(int mask = -1) const
+  {
+    for (uint32_t i = 0; i < _orderSize; ++i) {
+      const auto slot = _order[i];
+      if (slot->alive && ((slot->mask & mask) || slot->mask == mask)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  // The fields tested before calling the callback come first (64 bytes on
+  // 64-bit platforms)
+  struct Slot {
+    bool alive                = false;
+    bool unregisterOnNextCall = false;
+    int mask                  = -1;
+    uint32_t index            = 0;
+    uint32_t generation       = 0;
+    CallbackFunc callback     = nullptr;
+    any* scope                = nullptr;
+    Slot* nextFree            = nullptr;
+  }; // end of struct Slot
+
+  // Overflow slots are allocated in chunks so that slots never move in memory
+  static constexpr uint32_t ChunkShift = 4;
+  static constexpr uint32_t ChunkSize  = 1u << ChunkShift;
+  using SlotChunk                      = std::array<Slot, ChunkSize>;
+
+  Slot& _slot(uint32_t index)
+  {
+    if (index < N) {
+      return _inlineSlots[index];
+    }
+    index -= N;
+    return (*_overflowChunks[index >> ChunkShift])[index & (ChunkSize - 1)];
+  }
+
+  bool _isLive(const ObserverHandle& handle)
+  {
+    if (!handle || handle.index >= _slotCount) {
+      return false;
+    }
+    const auto& slot = _slot(handle.index);
+    return slot.alive && slot.generation == handle.generation;
+  }
+
+  Slot* _allocateSlot()
+  {
+    if (_freeList) {
+      auto slot = _freeList;
+      _freeList = slot->nextFree;
+      return slot;
+    }
+    const auto index = _slotCount++;
+    if (index >= N && ((index - N) & (ChunkSize - 1)) == 0) {
+      _overflowChunks.emplace_back(std::make_unique<SlotChunk>());
+    }
+    auto& slot = _slot(index);
+    slot.index = index;
+    return &slot;
+  }
+
+  void _reserveOrder(uint32_t size)
+  {
+    if (size <= _orderCapacity) {
+      return;
+    }
+    _orderCapacity = std::max(size, 2 * _orderCapacity);
+    std::vector<Slot*> order(_orderCapacity);
+    std::copy(_order, _order + _orderSize, order.begin());
+    _heapOrder.swap(order);
+    _order = _heapOrder.data();
+  }
+
+  void _release(Slot* slot)
+  {
+    slot->alive = false;
+    ++slot->generation;
+    --_liveCount;
+    ++_deadCount;
+    // The callback may be the one currently executing, destroy it later
+    if (_notifyDepth == 0) {
+      slot->callback = nullptr;
+    }
+  }
+
+  // Removes the dead slots from the notification order and recycles them
+  void _compact()
+  {
+    uint32_t newSize = 0;
+    for (uint32_t i = 0; i < _orderSize; ++i) {
+      auto slot = _order[i];
+      if (slot->alive) {
+        _order[newSize++] = slot;
+      }
+      else {
+        slot->callback = nullptr;
+        slot->nextFree = _freeList;
+        _freeList      = slot;
+      }
+    }
+    _orderSize = newSize;
+    _deadCount = 0;
+  }
+
+private:
+  EventState _eventState;
+  std::array<Slot, N> _inlineSlots;
+  std::vector<std::unique_ptr<SlotChunk>> _overflowChunks;
+  std::array<Slot*, N> _inlineOrder;
+  std::vector<Slot*> _heapOrder;
+  Slot** _order;
+  uint32_t _orderSize;
+  uint32_t _orderCapacity;
+  Slot* _freeList;
+  uint32_t _slotCount;
+  uint32_t _liveCount;
+  uint32_t _deadCount;
+  uint32_t _notifyDepth;
+  uint32_t _frontInsertionCount;
+
+}; // end of class SmallObservable
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_SMALL_OBSERVABLE_H
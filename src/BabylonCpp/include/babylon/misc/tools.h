@@ -2,6 +2,7 @@
 #define BABYLON_MISC_TOOLS_H
 
 #include <functional>
+#include <string_view>
 #include <variant>
 
 #include <babylon/babylon_api.h>
@@ -157,16 +158,16 @@ struct BABYLON_SHARED_EXPORT Tools {
    */
   static void DumpFramebuffer(int width, int height, Engine* engine);
 
-  static void StartPerformanceCounter(const std::string&)
+  static void StartPerformanceCounter(std::string_view)
   {
   }
-  static void StartPerformanceCounter(const std::string&, bool)
+  static void StartPerformanceCounter(std::string_view, bool)
   {
   }
-  static void EndPerformanceCounter(const std::string&)
+  static void EndPerformanceCounter(std::string_view)
   {
   }
-  static void EndPerformanceCounter(const std::string&, bool)
+  static void EndPerformanceCounter(std::string_view, bool)
   {
   }
   static void ExitFullscreen()
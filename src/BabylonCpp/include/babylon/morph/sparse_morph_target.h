@@ -0,0 +1,198 @@
+#ifndef BABYLON_MORPH_SPARSE_MORPH_TARGET_H
+#define BABYLON_MORPH_SPARSE_MORPH_TARGET_H
+
+#include <memory>
+#include <string>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class Mesh;
+class MorphTarget;
+class SparseMorphTarget;
+using MeshPtr              = std::shared_ptr<Mesh>;
+using MorphTargetPtr       = std::shared_ptr<MorphTarget>;
+using SparseMorphTargetPtr = std::shared_ptr<SparseMorphTarget>;
+
+/**
+ * @brief Deltas of the vertices moved by a morph target, for one vertex attribute.
+ *
+ * Only the vertices whose delta is not null are stored, sorted by index. The deltas can be
+ * quantized to 16 bits, with one scale for the whole attribute.
+ */
+struct BABYLON_SHARED_EXPORT SparseMorphDeltas {
+
+  /**
+   * @brief Creates the sparse deltas from dense target data.
+   * @param target defines the data of the target, components values per vertex
+   * @param base defines the data of the mesh, stride values per vertex
+   * @param components defines the number of components of the deltas
+   * @param stride defines the number of values per vertex of the mesh data
+   * @param epsilon defines the largest delta component considered as null
+   * @returns the sparse deltas
+   */
+  static SparseMorphDeltas FromDense(const Float32Array& target, const Float32Array& base,
+                                     size_t components, size_t stride, float epsilon = 0.f);
+
+  /**
+   * @brief Gets the number of vertices moved by the target.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Gets whether no vertex is moved.
+   */
+  [[nodiscard]] bool empty() const;
+
+  /**
+   * @brief Gets whether the deltas are quantized.
+   */
+  [[nodiscard]] bool isQuantized() const;
+
+  /**
+   * @brief Quantizes the deltas to 16 bits and releases the float values.
+   */
+  void quantize();
+
+  /**
+   * @brief Gets the memory used by the deltas, in bytes.
+   */
+  [[nodiscard]] size_t getByteLength() const;
+
+  /**
+   * Sorted indices of the vertices moved by the target
+   */
+  IndicesArray indices;
+
+  /**
+   * Deltas of the vertices, components values per index
+   */
+  Float32Array values;
+
+  /**
+   * Quantized deltas, used instead of the values when not empty
+   */
+  std::vector<int16_t> quantizedValues;
+
+  /**
+   * Scale of the quantized deltas
+   */
+  float scale = 1.f;
+
+  /**
+   * Number of components per vertex
+   */
+  size_t components = 3;
+
+}; // end of struct SparseMorphDeltas
+
+/**
+ * @brief Defines a morph target stored as sparse deltas, blended on the CPU by the
+ * SparseMorphTargetManager.
+ * @see SparseMorphTargetManager
+ */
+class BABYLON_SHARED_EXPORT SparseMorphTarget {
+
+public:
+  template <typename... Ts>
+  static SparseMorphTargetPtr New(Ts&&... args)
+  {
+    return std::shared_ptr<SparseMorphTarget>(new SparseMorphTarget(std::forward<Ts>(args)...));
+  }
+  ~SparseMorphTarget(); // = default
+
+  /**
+   * @brief Sets the position deltas of the target.
+   * @param indices defines the indices of the moved vertices
+   * @param deltas defines the deltas, 3 per index
+   */
+  void setPositions(const IndicesArray& indices, const Float32Array& deltas);
+
+  /**
+   * @brief Sets the normal deltas of the target.
+   * @param indices defines the indices of the modified vertices
+   * @param deltas defines the deltas, 3 per index
+   */
+  void setNormals(const IndicesArray& indices, const Float32Array& deltas);
+
+  /**
+   * @brief Sets the tangent deltas of the target.
+   * @param indices defines the indices of the modified vertices
+   * @param deltas defines the deltas of the xyz components, 3 per index
+   */
+  void setTangents(const IndicesArray& indices, const Float32Array& deltas);
+
+  /**
+   * @brief Sets the texture coordinates deltas of the target.
+   * @param indices defines the indices of the modified vertices
+   * @param deltas defines the deltas, 2 per index
+   */
+  void setUVs(const IndicesArray& indices, const Float32Array& deltas);
+
+  /**
+   * @brief Quantizes all the deltas of the target to 16 bits.
+   */
+  void quantize();
+
+  /**
+   * @brief Gets the memory used by the deltas of the target, in bytes.
+   */
+  [[nodiscard]] size_t getByteLength() const;
+
+  /**
+   * @brief Creates a sparse target from a morph target and the mesh it deforms.
+   * @param target defines the morph target, storing the absolute vertex data
+   * @param mesh defines the mesh deformed by the target
+   * @param epsilon defines the largest delta component considered as null
+   * @param quantize defines whether the deltas are quantized to 16 bits
+   * @returns a new SparseMorphTarget
+   */
+  static SparseMorphTargetPtr FromMorphTarget(const MorphTargetPtr& target, const MeshPtr& mesh,
+                                              float epsilon = 0.f, bool quantize = false);
+
+protected:
+  /**
+   * @brief Creates a new SparseMorphTarget.
+   * @param name defines the name of the target
+   * @param influence defines the influence to use
+   */
+  SparseMorphTarget(const std::string& name, float influence = 0.f);
+
+public:
+  /**
+   * Name of the target
+   */
+  std::string name;
+
+  /**
+   * Influence of this target (ie. its weight in the overall morphing)
+   */
+  float influence;
+
+  /**
+   * Position deltas
+   */
+  SparseMorphDeltas positions;
+
+  /**
+   * Normal deltas
+   */
+  SparseMorphDeltas normals;
+
+  /**
+   * Tangent deltas, of the xyz components
+   */
+  SparseMorphDeltas tangents;
+
+  /**
+   * Texture coordinates deltas
+   */
+  SparseMorphDeltas uvs;
+
+}; // end of class SparseMorphTarget
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MORPH_SPARSE_MORPH_TARGET_H
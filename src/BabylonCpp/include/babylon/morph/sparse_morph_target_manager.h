@@ -0,0 +1,151 @@
+#ifndef BABYLON_MORPH_SPARSE_MORPH_TARGET_MANAGER_H
+#define BABYLON_MORPH_SPARSE_MORPH_TARGET_MANAGER_H
+
+#include <array>
+
+#include <babylon/babylon_api.h>
+#include <babylon/misc/small_observable.h>
+#include <babylon/morph/sparse_morph_target.h>
+
+namespace BABYLON {
+
+class MorphTargetManager;
+class Scene;
+class SparseMorphTargetManager;
+class ThreadPool;
+using MorphTargetManagerPtr       = std::shared_ptr<MorphTargetManager>;
+using SparseMorphTargetManagerPtr = std::shared_ptr<SparseMorphTargetManager>;
+
+/**
+ * @brief This class is used to deform a mesh on the CPU using sparse morph targets.
+ *
+ * Unlike the MorphTargetManager, which feeds every active target to the shaders as extra vertex
+ * attributes, the targets only store the deltas of the vertices they move and any number of them
+ * can be active at once. Before each render, the non null influences are blended on the thread
+ * pool into the position, normal, tangent and texture coordinates buffers of the mesh, which
+ * must not use a MorphTargetManager. Nothing is blended when the influences did not change since
+ * the previous update.
+ * @see http://doc.babylonjs.com/how_to/how_to_use_morphtargets
+ */
+class BABYLON_SHARED_EXPORT SparseMorphTargetManager {
+
+public:
+  template <typename... Ts>
+  static SparseMorphTargetManagerPtr New(Ts&&... args)
+  {
+    return std::shared_ptr<SparseMorphTargetManager>(
+      new SparseMorphTargetManager(std::forward<Ts>(args)...));
+  }
+  ~SparseMorphTargetManager(); // = default
+
+  SparseMorphTargetManager(const SparseMorphTargetManager&) = delete;
+  SparseMorphTargetManager& operator=(const SparseMorphTargetManager&) = delete;
+
+  /**
+   * @brief Gets the target at specified index.
+   * @param index defines the index to check
+   * @returns the requested target
+   */
+  SparseMorphTargetPtr getTarget(size_t index);
+
+  /**
+   * @brief Add a new target to this manager.
+   * @param target defines the target to add
+   */
+  void addTarget(const SparseMorphTargetPtr& target);
+
+  /**
+   * @brief Removes a target from the manager.
+   * @param target defines the target to remove
+   */
+  void removeTarget(SparseMorphTarget* target);
+
+  /**
+   * @brief Gets the number of targets stored in this manager.
+   */
+  [[nodiscard]] size_t numTargets() const;
+
+  /**
+   * @brief Gets the number of targets blended by the last update (ie. the number of targets with
+   * influences != 0).
+   */
+  [[nodiscard]] size_t numInfluencers() const;
+
+  /**
+   * @brief Gets the memory used by the deltas of all the targets, in bytes.
+   */
+  [[nodiscard]] size_t getByteLength() const;
+
+  /**
+   * @brief Sets the thread pool blending the targets.
+   * @param threadPool the thread pool, or nullptr to use the default thread pool
+   */
+  void setThreadPool(ThreadPool* threadPool);
+
+  /**
+   * @brief Blends the targets into the vertex buffers of the mesh if the influences changed,
+   * called before each render of the scene. The morphed vertex buffers are made updatable by
+   * the first blend, and then updated in place.
+   * @returns true if the vertex buffers were updated
+   */
+  bool update();
+
+  /**
+   * @brief Restores the vertex data of the mesh and stops the updates.
+   */
+  void dispose();
+
+  /**
+   * @brief Creates a manager deforming a mesh with the targets of a morph target manager.
+   * @param morphTargetManager defines the manager of the targets to convert
+   * @param mesh defines the mesh to deform, its morph target manager is removed
+   * @param epsilon defines the largest delta component considered as null
+   * @param quantize defines whether the deltas are quantized to 16 bits
+   * @returns a new SparseMorphTargetManager
+   */
+  static SparseMorphTargetManagerPtr FromMorphTargetManager(
+    const MorphTargetManagerPtr& morphTargetManager, const MeshPtr& mesh, float epsilon = 0.f,
+    bool quantize = false);
+
+protected:
+  /**
+   * @brief Creates a new SparseMorphTargetManager.
+   * @param mesh defines the mesh to deform
+   */
+  SparseMorphTargetManager(const MeshPtr& mesh);
+
+private:
+  struct Channel {
+    std::string kind;
+    SparseMorphDeltas SparseMorphTarget::*deltas;
+    // Number of values per vertex in the vertex buffer
+    size_t stride;
+    Float32Array base;
+    Float32Array deformed;
+    // Whether the deltas were added by the last blend
+    bool isMorphed;
+    // Whether the buffer is written by the current blend
+    bool isUpdated;
+  };
+
+  void _blend(size_t beginVertex, size_t endVertex);
+
+private:
+  std::weak_ptr<Mesh> _mesh;
+  Scene* _scene;
+  ObserverHandle _beforeRenderObserver;
+  ThreadPool* _threadPool;
+  size_t _vertexCount;
+  std::array<Channel, 4> _channels;
+  std::vector<SparseMorphTargetPtr> _targets;
+  // Targets with a non null influence and their influences, as of the last blend
+  std::vector<SparseMorphTarget*> _activeTargets;
+  Float32Array _activeInfluences;
+  Float32Array _blendedInfluences;
+  bool _isDirty;
+
+}; // end of class SparseMorphTargetManager
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MORPH_SPARSE_MORPH_TARGET_MANAGER_H
@@ -79,6 +79,13 @@ struct INavMeshParameters {
    * data. (For height detail only.) [Limit: >=0] [Units: wu]
    */
   float detailSampleMaxError;
+
+  /**
+   * The width/depth size of the tiles on the xz-plane. When 0, the navigation mesh is built in
+   * one single tile, otherwise the tiles are built in parallel and the navigation mesh supports
+   * temporary obstacles and partial rebuilds. [Limit: >= 0] [Units: vx]
+   */
+  int tileSize = 0;
 }; // end of struct INavMeshParameters
 
 } // end of namespace BABYLON
@@ -3,6 +3,7 @@
 
 #include <babylon/animations/ianimatable.h>
 #include <babylon/babylon_api.h>
+#include <babylon/core/profiling/memory_tracker.h>
 #include <babylon/engines/constants.h>
 #include <babylon/misc/observable.h>
 #include <babylon/misc/observer.h>
@@ -643,6 +644,12 @@ public:
    */
   std::vector<ParticleSystem*> activeSubSystems;
 
+  /**
+   * Hidden
+   * Memory used by the particles vertex data
+   */
+  TrackedMemory _vertexDataMemory;
+
 private:
   Observer<IParticleSystem>::Ptr _onDisposeObserver;
   std::vector<Particle*> _particles;
@@ -4,6 +4,7 @@
 #include <memory>
 #include <optional>
 #include <variant>
+#include <vector>
 
 #include <babylon/babylon_api.h>
 #include <babylon/physics/helper/physics_event_options.h>
@@ -13,12 +14,14 @@ namespace BABYLON {
 
 struct IPhysicsEngine;
 class PhysicsGravitationalFieldEvent;
+class PhysicsImpostor;
 class PhysicsRadialExplosionEvent;
 class PhysicsUpdraftEvent;
 class PhysicsVortexEvent;
 class Scene;
 class Vector3;
-using IPhysicsEnginePtr = std::shared_ptr<IPhysicsEngine>;
+using IPhysicsEnginePtr  = std::shared_ptr<IPhysicsEngine>;
+using PhysicsImpostorPtr = std::shared_ptr<PhysicsImpostor>;
 
 /**
  * @brief A helper for physics simulations.
@@ -117,9 +120,18 @@ public:
          const std::optional<float>& strength = std::nullopt,
          const std::optional<float>& height   = std::nullopt);
 
+private:
+  /**
+   * @brief Gets the impostors which may overlap the bounding box of a sphere.
+   */
+  std::vector<PhysicsImpostorPtr>& _getImpostorsInSphere(const Vector3& origin,
+                                                         float radius);
+
 private:
   Scene* _scene;
   IPhysicsEnginePtr _physicsEngine;
+  // candidate impostors of the last explosion
+  std::vector<PhysicsImpostorPtr> _impostors;
 
 }; // end of class PhysicsHelper
 
@@ -1,7 +1,10 @@
 #ifndef BABYLON_PHYSICS_HELPER_PHYSICS_RADIAL_EXPLOSION_EVENT_H
 #define BABYLON_PHYSICS_HELPER_PHYSICS_RADIAL_EXPLOSION_EVENT_H
 
+#include <optional>
+
 #include <babylon/babylon_api.h>
+#include <babylon/maths/vector3.h>
 #include <babylon/meshes/builders/mesh_builder_options.h>
 #include <babylon/physics/helper/physics_event_options.h>
 
@@ -75,7 +78,9 @@ private:
 private:
   Scene* _scene;
   PhysicsRadialExplosionEventOptions _options;
-  // create a sphere, so we can get the intersecting meshes inside
+  // origin of the last impostor hit test
+  std::optional<Vector3> _origin;
+  // sphere of the explosion, created when the data is fetched
   MeshPtr _sphere;
   // check if the data has been fetched. If not, do cleanup
   bool _dataFetched;
@@ -2,6 +2,7 @@
 #define BABYLON_PHYSICS_HELPER_PHYSICS_UPDRAFT_EVENT_H
 
 #include <functional>
+#include <vector>
 
 #include <babylon/babylon_api.h>
 #include <babylon/maths/vector3.h>
@@ -16,8 +17,9 @@ struct PhysicsHitData;
 class PhysicsImpostor;
 struct PhysicsUpdraftEventData;
 class Scene;
-using IPhysicsEnginePtr = std::shared_ptr<IPhysicsEngine>;
-using MeshPtr           = std::shared_ptr<Mesh>;
+using IPhysicsEnginePtr  = std::shared_ptr<IPhysicsEngine>;
+using MeshPtr            = std::shared_ptr<Mesh>;
+using PhysicsImpostorPtr = std::shared_ptr<PhysicsImpostor>;
 
 /**
  * @brief Represents a physics updraft event.
@@ -84,6 +86,8 @@ private:
   Vector3 _cylinderPosition;
   // check if the has been fetched the data. If not, do cleanup
   bool _dataFetched;
+  // impostors around the cylinder, queried on each tick
+  std::vector<PhysicsImpostorPtr> _impostors;
 
 }; // end of class PhysicsUpdraftEvent
 
@@ -7,15 +7,11 @@
 namespace BABYLON {
 
 /**
- * @brief Interface for a physics-enabled object.
+ * @brief Physics-enabled object. Meshes are the only objects carrying impostors, the interface is
+ * an alias so that impostors can be attached to any mesh.
  * @see https://doc.babylonjs.com/how_to/using_the_physics_engine
  */
-struct BABYLON_SHARED_EXPORT IPhysicsEnabledObject : public AbstractMesh {
-  AbstractMesh* getParent() override              = 0;
-  Scene* getScene() const override                = 0;
-  virtual bool hasBoundingInfo()                  = 0;
-  std::string getClassName() const override = 0;
-}; // end of struct IPhysicsEnabledObject
+using IPhysicsEnabledObject = AbstractMesh;
 
 } // end of namespace BABYLON
 
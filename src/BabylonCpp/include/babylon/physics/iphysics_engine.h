@@ -6,13 +6,14 @@
 
 namespace BABYLON {
 
+class AbstractMesh;
 struct IPhysicsBody;
-struct IPhysicsEnabledObject;
 struct IPhysicsEnginePlugin;
 class PhysicsImpostor;
 class PhysicsJoint;
 class PhysicsRaycastResult;
-using PhysicsImpostorPtr = std::shared_ptr<PhysicsImpostor>;
+using IPhysicsEnabledObject = AbstractMesh;
+using PhysicsImpostorPtr    = std::shared_ptr<PhysicsImpostor>;
 
 /**
  * @brief Interface used to define a physics engine.
@@ -134,6 +135,16 @@ struct BABYLON_SHARED_EXPORT IPhysicsEngine {
    */
   virtual PhysicsImpostor* getImpostorWithPhysicsBody(IPhysicsBody* body) = 0;
 
+  /**
+   * @brief Gets the impostors which may overlap an axis aligned box
+   * @param minimum defines the minimum of the box, in world space
+   * @param maximum defines the maximum of the box, in world space
+   * @param impostors receives the candidate impostors, in the order of the impostor list
+   */
+  virtual void getImpostorsInBox(const Vector3& minimum, const Vector3& maximum,
+                                 std::vector<PhysicsImpostorPtr>& impostors)
+    = 0;
+
   /**
    * @brief Does a raycast in the physics world.
    * @param from when should the ray start?
@@ -31,8 +31,7 @@ struct BABYLON_SHARED_EXPORT IPhysicsEnginePlugin {
   virtual void setGravity(const Vector3& gravity) = 0;
   virtual void setTimeStep(float timeStep)        = 0;
   [[nodiscard]] virtual float getTimeStep() const = 0;
-  virtual void executeStep(float delta,
-                           const std::vector<std::unique_ptr<PhysicsImpostor>>& impostors)
+  virtual void executeStep(float delta, const std::vector<PhysicsImpostorPtr>& impostors)
     = 0; // not forgetting pre and post events
   virtual void applyImpulse(const PhysicsImpostor& impostor, const Vector3& force,
                             const Vector3& contactPoint)
@@ -40,7 +39,7 @@ struct BABYLON_SHARED_EXPORT IPhysicsEnginePlugin {
   virtual void applyForce(const PhysicsImpostor& impostor, const Vector3& force,
                           const Vector3& contactPoint)
     = 0;
-  virtual void generatePhysicsBody(const PhysicsImpostor& impostor)              = 0;
+  virtual void generatePhysicsBody(PhysicsImpostor& impostor)                    = 0;
   virtual void removePhysicsBody(const PhysicsImpostor& impostor)                = 0;
   virtual void generateJoint(PhysicsImpostorJoint* joint)                        = 0;
   virtual void removeJoint(PhysicsImpostorJoint* joint)                          = 0;
@@ -96,6 +95,16 @@ struct BABYLON_SHARED_EXPORT IPhysicsEnginePlugin {
   virtual void getBoxSizeToRef(const PhysicsImpostor& impostor, Vector3& result)         = 0;
   virtual void syncMeshWithImpostor(AbstractMesh* mesh, const PhysicsImpostor& impostor) = 0;
   virtual void dispose()                                                                 = 0;
+  /**
+   * @brief Collects the impostors whose bodies may overlap the axis aligned box, from the
+   * broadphase of the plugin.
+   * @returns false if the plugin has no broadphase to query
+   */
+  virtual bool queryBroadphase(const Vector3& /*minimum*/, const Vector3& /*maximum*/,
+                               std::vector<PhysicsImpostor*>& /*impostors*/)
+  {
+    return false;
+  }
 }; // end of struct IPhysicsEnginePlugin
 
 } // end of namespace BABYLON
@@ -20,7 +20,7 @@ public:
    * @param jointData The data for the Distance-Joint
    */
   DistanceJoint(const DistanceJointData& jointData);
-  ~DistanceJoint(); // = default
+  ~DistanceJoint() override; // = default
 
   /**
    * @brief Update the predefined distance.
@@ -29,6 +29,12 @@ public:
    */
   void updateDistance(float maxDistance, float minDistance);
 
+public:
+  /**
+   * Maximum distance given at the creation, the joint data being stored as a PhysicsJointData
+   */
+  float maxDistance;
+
 }; // end of class DistanceJoint
 
 } // end of namespace BABYLON
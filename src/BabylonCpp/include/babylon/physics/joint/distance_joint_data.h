@@ -14,7 +14,7 @@ struct BABYLON_SHARED_EXPORT DistanceJointData : public PhysicsJointData {
   /**
    * Max distance the 2 joint objects can be apart
    */
-  float maxDistance;
+  float maxDistance = 0.f;
   // Oimo - minDistance
   // Cannon - maxForce
 }; // end of struct DistanceJointData
@@ -1,6 +1,8 @@
 #ifndef BABYLON_PHYSICS_PHYSICS_ENGINE_H
 #define BABYLON_PHYSICS_PHYSICS_ENGINE_H
 
+#include <unordered_map>
+
 #include <babylon/babylon_api.h>
 #include <babylon/physics/iphysics_engine.h>
 
@@ -60,6 +62,8 @@ public:
    * @brief Set the sub time step of the physics engine.
    * Default is 0 meaning there is no sub steps
    * To increase physics resolution precision, set a small value (like 1 ms)
+   * A positive sub time step also becomes the time step of the plugin, in seconds, so that the
+   * physics advance by fixed steps
    * @param subTimeStep defines the new sub timestep used for physics resolution.
    */
   void setSubTimeStep(float subTimeStep = 0.f) final;
@@ -148,6 +152,17 @@ public:
    */
   PhysicsImpostor* getImpostorWithPhysicsBody(IPhysicsBody* body) final;
 
+  /**
+   * @brief Gets the impostors which may overlap an axis aligned box. The broadphase of the plugin
+   * is queried when it has one, it reflects the transformations of the last step. Otherwise the
+   * world bounding boxes of the objects are tested.
+   * @param minimum defines the minimum of the box, in world space
+   * @param maximum defines the maximum of the box, in world space
+   * @param impostors receives the candidate impostors, in the order of the impostor list
+   */
+  void getImpostorsInBox(const Vector3& minimum, const Vector3& maximum,
+                         std::vector<PhysicsImpostorPtr>& impostors) final;
+
   /**
    * @brief Does a raycast in the physics world.
    * @param from when should the ray start?
@@ -174,6 +189,16 @@ private:
   bool _initialized;
   IPhysicsEnginePlugin* _physicsPlugin;
   std::vector<PhysicsImpostorPtr> _impostors;
+  // Insertion order of the impostors, which is the order of the impostor list
+  std::unordered_map<const PhysicsImpostor*, std::pair<size_t, PhysicsImpostorPtr>>
+    _impostorOrders;
+  size_t _nextImpostorOrder;
+  // First impostor of each object
+  std::unordered_map<const IPhysicsEnabledObject*, PhysicsImpostor*> _impostorsByObject;
+  // First impostor of each body, rebuilt when a body is not found
+  std::unordered_map<const IPhysicsBody*, PhysicsImpostor*> _impostorsByBody;
+  std::vector<PhysicsImpostor*> _queriedImpostors;
+  std::vector<std::pair<size_t, PhysicsImpostor*>> _queriedOrders;
   std::vector<PhysicsImpostorJointPtr> _joints;
   float _subTimeStep;
 
@@ -13,7 +13,6 @@ namespace BABYLON {
 class AbstractMesh;
 class Bone;
 struct IPhysicsBody;
-struct IPhysicsEnabledObject;
 struct IPhysicsEngine;
 class Mesh;
 class PhysicsEngine;
@@ -21,8 +20,9 @@ class PhysicsImpostor;
 class PhysicsJoint;
 struct PhysicsJointData;
 class Scene;
-using IPhysicsEnginePtr  = std::shared_ptr<IPhysicsEngine>;
-using PhysicsImpostorPtr = std::shared_ptr<PhysicsImpostor>;
+using IPhysicsEnabledObject = AbstractMesh;
+using IPhysicsEnginePtr     = std::shared_ptr<IPhysicsEngine>;
+using PhysicsImpostorPtr    = std::shared_ptr<PhysicsImpostor>;
 
 struct Joint {
   std::shared_ptr<PhysicsJoint> joint;
@@ -258,6 +258,13 @@ public:
    */
   Quaternion& getParentsRotation();
 
+  /**
+   * @brief Hidden. Returns whether the transformation of the object can be exchanged with the
+   * physics body in bulk, as is: the object has no parent, no delta transformation and no step
+   * callback, and bidirectional transformation is enabled.
+   */
+  [[nodiscard]] bool _canSyncTransformationInBulk() const;
+
   /**
    * @brief This function is executed by the physics engine.
    */
@@ -0,0 +1,122 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_COLLISION_SHAPE_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_COLLISION_SHAPE_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/physics/plugins/native/native_math.h>
+
+namespace BABYLON {
+namespace NativePhysics {
+
+/**
+ * @brief Convex polyhedron with polygonal faces, in the local space of its body.
+ */
+struct BABYLON_SHARED_EXPORT ConvexHull {
+  struct Face {
+    Vec3 normal;
+    float offset;
+    // Range of the face vertex loop in faceVertices
+    uint32_t firstVertex;
+    uint32_t vertexCount;
+  }; // end of struct Face
+
+  struct Edge {
+    uint32_t vertex0;
+    uint32_t vertex1;
+    // Faces on each side of the edge, face0 having the edge from vertex0 to vertex1 in its loop
+    uint32_t face0;
+    uint32_t face1;
+  }; // end of struct Edge
+
+  std::vector<Vec3> vertices;
+  std::vector<Face> faces;
+  // Vertex loops of the faces, counter-clockwise seen from outside
+  std::vector<uint32_t> faceVertices;
+  std::vector<Edge> edges;
+  Vec3 centroid{0.f, 0.f, 0.f};
+
+  /**
+   * @brief Builds the convex hull of a point cloud. Coplanar triangles are merged into polygons,
+   * and flat point clouds are given a small thickness.
+   * @param points defines the points to wrap
+   * @returns the hull, without vertices if the points are all at the same place
+   */
+  static ConvexHull Create(const std::vector<Vec3>& points);
+
+  /**
+   * @brief Returns the vertex of the hull farthest along the direction.
+   */
+  [[nodiscard]] const Vec3& support(const Vec3& direction) const;
+
+  /**
+   * @brief Gets the vertex of a face loop.
+   */
+  [[nodiscard]] const Vec3& faceVertex(const Face& face, uint32_t index) const
+  {
+    return vertices[faceVertices[face.firstVertex + index]];
+  }
+}; // end of struct ConvexHull
+
+/**
+ * @brief Type of a collision shape.
+ */
+enum class ShapeType {
+  Sphere,
+  // Sphere swept along a segment of the local Y axis
+  Capsule,
+  ConvexHull
+}; // end of enum class ShapeType
+
+/**
+ * @brief Collision shape of a rigid body, in the local space of the body.
+ */
+struct BABYLON_SHARED_EXPORT CollisionShape {
+  ShapeType type = ShapeType::Sphere;
+  // Radius of a sphere or a capsule
+  float radius = 0.5f;
+  // Half length of the segment of a capsule
+  float halfHeight = 0.f;
+  // Center and half extents of the local bounding box
+  Vec3 center{0.f, 0.f, 0.f};
+  Vec3 halfExtents{0.5f, 0.5f, 0.5f};
+  // Polyhedron of a convex hull shape, shared by the copies of the shape
+  std::shared_ptr<const ConvexHull> hull;
+
+  static CollisionShape CreateSphere(float radius);
+  static CollisionShape CreateCapsule(float radius, float halfHeight);
+  static CollisionShape CreateBox(const Vec3& halfExtents);
+  static CollisionShape CreateCylinder(float radius, float halfHeight, unsigned int segments = 16);
+  static CollisionShape CreateConvexHull(const std::vector<Vec3>& points);
+
+  /**
+   * @brief Computes the world bounding box of the shape.
+   */
+  [[nodiscard]] AABB computeAABB(const Transform& transform) const;
+
+  /**
+   * @brief Computes the local inverse inertia diagonal of the shape for the given mass.
+   */
+  [[nodiscard]] Vec3 computeInverseInertia(float mass) const;
+
+  /**
+   * @brief Gets the radius of the bounding sphere of the shape.
+   */
+  [[nodiscard]] float boundingRadius() const;
+
+  /**
+   * @brief Intersects the segment from + t * (to - from), t in [0, maxFraction], with the shape.
+   * @param fraction receives the fraction of the hit
+   * @param normal receives the world normal of the hit
+   * @returns whether the segment hits the shape from outside
+   */
+  bool raycast(const Transform& transform, const Vec3& from, const Vec3& to, float maxFraction,
+               float& fraction, Vec3& normal) const;
+}; // end of struct CollisionShape
+
+} // end of namespace NativePhysics
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_COLLISION_SHAPE_H
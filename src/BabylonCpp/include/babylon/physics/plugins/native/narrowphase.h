@@ -0,0 +1,50 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_NARROWPHASE_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_NARROWPHASE_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/physics/plugins/native/native_math.h>
+
+namespace BABYLON {
+namespace NativePhysics {
+
+struct CollisionShape;
+
+/**
+ * @brief Contact point between two shapes.
+ */
+struct ContactPoint {
+  // World position, half way between the surfaces
+  Vec3 position;
+  // Penetration depth, negative for the speculative contacts of separated shapes
+  float depth;
+}; // end of struct ContactPoint
+
+/**
+ * @brief Contact points between two shapes sharing the same normal.
+ */
+struct ContactManifold {
+  static constexpr int MaxPoints = 4;
+
+  // World normal, from the first shape to the second one
+  Vec3 normal;
+  ContactPoint points[MaxPoints];
+  int pointCount = 0;
+}; // end of struct ContactManifold
+
+/**
+ * @brief Computes the contact manifold of two shapes.
+ * @param shapeA defines the first shape
+ * @param transformA defines the transform of the first shape
+ * @param shapeB defines the second shape
+ * @param transformB defines the transform of the second shape
+ * @param margin defines the distance under which separated shapes get speculative contacts
+ * @param manifold receives the contact points, none if the shapes are farther than the margin
+ */
+BABYLON_SHARED_EXPORT void Collide(const CollisionShape& shapeA, const Transform& transformA,
+                                   const CollisionShape& shapeB, const Transform& transformB,
+                                   float margin, ContactManifold& manifold);
+
+} // end of namespace NativePhysics
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_NARROWPHASE_H
@@ -0,0 +1,319 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_NATIVE_MATH_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_NATIVE_MATH_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace BABYLON {
+namespace NativePhysics {
+
+/**
+ * @brief Plain 3D vector of the native physics world.
+ *
+ * The solver loops are the hot path of the simulation: the math types are aggregates with inline
+ * operators so that they stay in registers, unlike Vector3 and Quaternion whose operations are not
+ * visible to the optimizer.
+ */
+struct Vec3 {
+  float x, y, z;
+
+  float& operator[](int i)
+  {
+    return (&x)[i];
+  }
+
+  float operator[](int i) const
+  {
+    return (&x)[i];
+  }
+}; // end of struct Vec3
+
+inline Vec3 operator+(const Vec3& a, const Vec3& b)
+{
+  return {a.x + b.x, a.y + b.y, a.z + b.z};
+}
+
+inline Vec3 operator-(const Vec3& a, const Vec3& b)
+{
+  return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+inline Vec3 operator-(const Vec3& a)
+{
+  return {-a.x, -a.y, -a.z};
+}
+
+inline Vec3 operator*(const Vec3& a, float s)
+{
+  return {a.x * s, a.y * s, a.z * s};
+}
+
+inline Vec3 operator*(float s, const Vec3& a)
+{
+  return {a.x * s, a.y * s, a.z * s};
+}
+
+inline Vec3& operator+=(Vec3& a, const Vec3& b)
+{
+  a.x += b.x;
+  a.y += b.y;
+  a.z += b.z;
+  return a;
+}
+
+inline Vec3& operator-=(Vec3& a, const Vec3& b)
+{
+  a.x -= b.x;
+  a.y -= b.y;
+  a.z -= b.z;
+  return a;
+}
+
+inline Vec3& operator*=(Vec3& a, float s)
+{
+  a.x *= s;
+  a.y *= s;
+  a.z *= s;
+  return a;
+}
+
+inline float dot(const Vec3& a, const Vec3& b)
+{
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+inline Vec3 cross(const Vec3& a, const Vec3& b)
+{
+  return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+inline Vec3 multiply(const Vec3& a, const Vec3& b)
+{
+  return {a.x * b.x, a.y * b.y, a.z * b.z};
+}
+
+inline float lengthSquared(const Vec3& a)
+{
+  return dot(a, a);
+}
+
+inline float length(const Vec3& a)
+{
+  return std::sqrt(dot(a, a));
+}
+
+inline Vec3 minimum(const Vec3& a, const Vec3& b)
+{
+  return {std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z)};
+}
+
+inline Vec3 maximum(const Vec3& a, const Vec3& b)
+{
+  return {std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z)};
+}
+
+inline Vec3 absolute(const Vec3& a)
+{
+  return {std::abs(a.x), std::abs(a.y), std::abs(a.z)};
+}
+
+/**
+ * @brief Returns the normalized vector, or the fallback vector if the vector is too short.
+ */
+inline Vec3 normalizeOr(const Vec3& a, const Vec3& fallback)
+{
+  const auto lengthSq = dot(a, a);
+  if (lengthSq < 1e-12f) {
+    return fallback;
+  }
+  return a * (1.f / std::sqrt(lengthSq));
+}
+
+inline Vec3 normalize(const Vec3& a)
+{
+  return normalizeOr(a, {1.f, 0.f, 0.f});
+}
+
+/**
+ * @brief Computes two unit vectors orthogonal to the unit vector n and to each other.
+ */
+inline void computeBasis(const Vec3& n, Vec3& t1, Vec3& t2)
+{
+  // Branchless orthonormal basis (Duff et al.)
+  const float sign = std::copysign(1.f, n.z);
+  const float a    = -1.f / (sign + n.z);
+  const float b    = n.x * n.y * a;
+  t1               = {1.f + sign * n.x * n.x * a, sign * b, -sign * n.x};
+  t2               = {b, sign + n.y * n.y * a, -n.y};
+}
+
+/**
+ * @brief Unit quaternion of the native physics world.
+ */
+struct Quat {
+  float x, y, z, w;
+}; // end of struct Quat
+
+inline Quat operator*(const Quat& a, const Quat& b)
+{
+  return {a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+          a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+          a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+          a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z};
+}
+
+inline Quat conjugate(const Quat& q)
+{
+  return {-q.x, -q.y, -q.z, q.w};
+}
+
+inline Quat normalize(const Quat& q)
+{
+  const auto lengthSq = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+  if (lengthSq < 1e-12f) {
+    return {0.f, 0.f, 0.f, 1.f};
+  }
+  const auto invLength = 1.f / std::sqrt(lengthSq);
+  return {q.x * invLength, q.y * invLength, q.z * invLength, q.w * invLength};
+}
+
+/**
+ * @brief Rotates the vector v by the unit quaternion q.
+ */
+inline Vec3 rotate(const Quat& q, const Vec3& v)
+{
+  const Vec3 u{q.x, q.y, q.z};
+  const auto t = cross(u, v) * 2.f;
+  return v + t * q.w + cross(u, t);
+}
+
+/**
+ * @brief Rotates the vector v by the inverse of the unit quaternion q.
+ */
+inline Vec3 inverseRotate(const Quat& q, const Vec3& v)
+{
+  return rotate(conjugate(q), v);
+}
+
+/**
+ * @brief Integrates the orientation q with the angular velocity w during h.
+ */
+inline Quat integrate(const Quat& q, const Vec3& w, float h)
+{
+  const Quat dq = Quat{w.x, w.y, w.z, 0.f} * q;
+  const auto s  = 0.5f * h;
+  return normalize(Quat{q.x + dq.x * s, q.y + dq.y * s, q.z + dq.z * s, q.w + dq.w * s});
+}
+
+/**
+ * @brief Row major 3x3 matrix.
+ */
+struct Mat3 {
+  Vec3 rows[3];
+}; // end of struct Mat3
+
+inline Vec3 operator*(const Mat3& m, const Vec3& v)
+{
+  return {dot(m.rows[0], v), dot(m.rows[1], v), dot(m.rows[2], v)};
+}
+
+/**
+ * @brief Returns the product of the transpose of m with v.
+ */
+inline Vec3 transposeMultiply(const Mat3& m, const Vec3& v)
+{
+  return m.rows[0] * v.x + m.rows[1] * v.y + m.rows[2] * v.z;
+}
+
+inline Mat3 toMatrix(const Quat& q)
+{
+  const float x2 = q.x + q.x, y2 = q.y + q.y, z2 = q.z + q.z;
+  const float xx = q.x * x2, xy = q.x * y2, xz = q.x * z2;
+  const float yy = q.y * y2, yz = q.y * z2, zz = q.z * z2;
+  const float wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;
+  return {{{1.f - (yy + zz), xy - wz, xz + wy},
+           {xy + wz, 1.f - (xx + zz), yz - wx},
+           {xz - wy, yz + wx, 1.f - (xx + yy)}}};
+}
+
+/**
+ * @brief Returns R * diag(d) * R^T, the world inverse inertia of a body whose local inverse
+ * inertia is the diagonal d and whose rotation matrix is R.
+ */
+inline Mat3 rotateDiagonal(const Mat3& r, const Vec3& d)
+{
+  Mat3 result;
+  for (int i = 0; i < 3; ++i) {
+    const auto scaled = multiply(r.rows[i], d);
+    result.rows[i]    = {dot(scaled, r.rows[0]), dot(scaled, r.rows[1]), dot(scaled, r.rows[2])};
+  }
+  return result;
+}
+
+/**
+ * @brief Rigid transform: rotation then translation.
+ */
+struct Transform {
+  Vec3 position;
+  Quat rotation;
+}; // end of struct Transform
+
+inline Vec3 transformPoint(const Transform& t, const Vec3& v)
+{
+  return rotate(t.rotation, v) + t.position;
+}
+
+inline Vec3 inverseTransformPoint(const Transform& t, const Vec3& v)
+{
+  return inverseRotate(t.rotation, v - t.position);
+}
+
+/**
+ * @brief Axis aligned bounding box.
+ */
+struct AABB {
+  Vec3 minimum;
+  Vec3 maximum;
+}; // end of struct AABB
+
+inline bool overlaps(const AABB& a, const AABB& b)
+{
+  return a.minimum.x <= b.maximum.x && a.maximum.x >= b.minimum.x && a.minimum.y <= b.maximum.y
+         && a.maximum.y >= b.minimum.y && a.minimum.z <= b.maximum.z && a.maximum.z >= b.minimum.z;
+}
+
+/**
+ * @brief Intersects the segment from + t * (to - from), t in [0, maxFraction], with the box.
+ * @return the fraction where the segment enters the box, or a negative value if it misses it
+ */
+inline float raycast(const AABB& box, const Vec3& from, const Vec3& to, float maxFraction)
+{
+  float tMin = 0.f, tMax = maxFraction;
+  for (int i = 0; i < 3; ++i) {
+    const auto d = to[i] - from[i];
+    if (std::abs(d) < 1e-12f) {
+      if (from[i] < box.minimum[i] || from[i] > box.maximum[i]) {
+        return -1.f;
+      }
+      continue;
+    }
+    const auto invD = 1.f / d;
+    auto t1         = (box.minimum[i] - from[i]) * invD;
+    auto t2         = (box.maximum[i] - from[i]) * invD;
+    if (t1 > t2) {
+      std::swap(t1, t2);
+    }
+    tMin = std::max(tMin, t1);
+    tMax = std::min(tMax, t2);
+    if (tMin > tMax) {
+      return -1.f;
+    }
+  }
+  return tMin;
+}
+
+} // end of namespace NativePhysics
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_NATIVE_MATH_H
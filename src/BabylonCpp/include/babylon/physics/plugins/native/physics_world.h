@@ -0,0 +1,409 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_WORLD_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_WORLD_H
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/culling/dynamic_aabb_tree.h>
+#include <babylon/physics/plugins/native/collision_shape.h>
+#include <babylon/physics/plugins/native/narrowphase.h>
+
+namespace BABYLON {
+
+class ThreadPool;
+
+namespace NativePhysics {
+
+using BodyId  = uint32_t;
+using JointId = uint32_t;
+
+static constexpr uint32_t InvalidId = ~uint32_t(0);
+
+/**
+ * @brief Parameters of a new rigid body.
+ */
+struct BodyDefinition {
+  CollisionShape shape;
+  Vec3 position{0.f, 0.f, 0.f};
+  Quat rotation{0.f, 0.f, 0.f, 1.f};
+  // A null mass makes the body static
+  float mass           = 0.f;
+  float friction       = 0.2f;
+  float restitution    = 0.2f;
+  float linearDamping  = 0.01f;
+  float angularDamping = 0.05f;
+  void* userData       = nullptr;
+}; // end of struct BodyDefinition
+
+/**
+ * @brief Rigid body of the native physics world.
+ */
+struct Body {
+  CollisionShape shape;
+  Vec3 position{0.f, 0.f, 0.f};
+  Quat rotation{0.f, 0.f, 0.f, 1.f};
+  Vec3 linearVelocity{0.f, 0.f, 0.f};
+  Vec3 angularVelocity{0.f, 0.f, 0.f};
+  // Accumulated until the next step
+  Vec3 force{0.f, 0.f, 0.f};
+  Vec3 torque{0.f, 0.f, 0.f};
+  float mass    = 0.f;
+  float invMass = 0.f;
+  Vec3 invInertiaLocal{0.f, 0.f, 0.f};
+  Mat3 invInertiaWorld{};
+  float friction       = 0.2f;
+  float restitution    = 0.2f;
+  float linearDamping  = 0.01f;
+  float angularDamping = 0.05f;
+  // Time spent under the sleep velocities
+  float sleepTime = 0.f;
+  // Index of the last step which moved the body
+  uint32_t movedStep = 0;
+  bool sleeping      = false;
+  bool used          = false;
+  int proxyId        = DynamicAABBTree::NullNode;
+  void* userData     = nullptr;
+
+  [[nodiscard]] bool isDynamic() const
+  {
+    return invMass > 0.f;
+  }
+
+  [[nodiscard]] bool isAwake() const
+  {
+    return invMass > 0.f && !sleeping;
+  }
+}; // end of struct Body
+
+/**
+ * @brief Type of a joint.
+ */
+enum class JointType {
+  // Shared pivot
+  Ball,
+  // Shared pivot, rotation around the axis only
+  Hinge,
+  // Shared pivot, the axes of the two bodies staying orthogonal
+  Universal,
+  // Translation along the axis only
+  Slider,
+  // Distance between the pivots within [minDistance, maxDistance]
+  Distance,
+  // No relative motion
+  Lock
+}; // end of enum class JointType
+
+/**
+ * @brief Parameters of a new joint. Pivots and axes are in the local spaces of the bodies.
+ */
+struct JointDefinition {
+  JointType type = JointType::Ball;
+  BodyId bodyA   = InvalidId;
+  BodyId bodyB   = InvalidId;
+  Vec3 pivotA{0.f, 0.f, 0.f};
+  Vec3 pivotB{0.f, 0.f, 0.f};
+  Vec3 axisA{1.f, 0.f, 0.f};
+  Vec3 axisB{1.f, 0.f, 0.f};
+  bool collideConnected = false;
+  float minDistance     = 0.f;
+  // A null maximum distance keeps the distance at the time of the creation
+  float maxDistance = 0.f;
+}; // end of struct JointDefinition
+
+/**
+ * @brief Scalar velocity constraint: J * v + bias = 0, its accumulated impulse within
+ * [lower, upper].
+ */
+struct JointRow {
+  Vec3 linearA, angularA, linearB, angularB;
+  float mass    = 0.f;
+  float bias    = 0.f;
+  float lower   = 0.f;
+  float upper   = 0.f;
+  float impulse = 0.f;
+  bool active   = false;
+}; // end of struct JointRow
+
+/**
+ * @brief Joint of the native physics world.
+ */
+struct Joint {
+  // Rows 0-5: positional constraints, 6-7: motors, 8-9: limits
+  static constexpr size_t MaxRows = 10;
+
+  struct Motor {
+    bool enabled   = false;
+    float speed    = 0.f;
+    float maxForce = 0.f;
+  }; // end of struct Motor
+
+  struct Limit {
+    bool enabled = false;
+    float lower  = 0.f;
+    float upper  = 0.f;
+  }; // end of struct Limit
+
+  JointDefinition definition;
+  // Axis of body B orthogonal to the hinge axis, for the measure of the hinge angle
+  Vec3 referenceA{0.f, 1.f, 0.f};
+  Vec3 referenceB{0.f, 1.f, 0.f};
+  // Rotation of B relative to A at the time of the creation
+  Quat relativeRotation{0.f, 0.f, 0.f, 1.f};
+  std::array<Motor, 2> motors;
+  Limit limit;
+  std::array<JointRow, MaxRows> rows;
+  bool used = false;
+}; // end of struct Joint
+
+/**
+ * @brief Contact between the shapes of two bodies, persistent while their enlarged bounding boxes
+ * overlap.
+ */
+struct Contact {
+  struct Point {
+    // Local position on A, to match the points of successive steps
+    Vec3 localA;
+    Vec3 rA, rB;
+    float depth;
+    float normalImpulse     = 0.f;
+    float tangentImpulse[2] = {0.f, 0.f};
+    float normalMass;
+    float tangentMass[2];
+    float bias;
+  }; // end of struct Point
+
+  BodyId bodyA;
+  BodyId bodyB;
+  Vec3 normal;
+  Vec3 tangents[2];
+  Point points[ContactManifold::MaxPoints];
+  int pointCount = 0;
+  float friction;
+  float restitution;
+}; // end of struct Contact
+
+/**
+ * @brief Result of a ray cast against the world.
+ */
+struct RayHit {
+  bool hit       = false;
+  BodyId body    = InvalidId;
+  float fraction = 1.f;
+  Vec3 point{0.f, 0.f, 0.f};
+  Vec3 normal{0.f, 0.f, 0.f};
+}; // end of struct RayHit
+
+/**
+ * @brief Rigid body world: dynamic bounding volume tree broadphase, contact manifolds of spheres,
+ * capsules and convex hulls, and sequential impulse solver with warm starting, solved island by
+ * island so that resting islands can sleep.
+ *
+ * The narrowphase and the islands run on the worker threads of a thread pool. Large islands are
+ * split in batches of constraints sharing no dynamic body, solved in parallel batch after batch.
+ * The work split never changes the order in which the impulses of a body are applied, so the
+ * simulation is deterministic for a given sequence of calls, whatever the number of threads.
+ */
+class BABYLON_SHARED_EXPORT PhysicsWorld {
+
+public:
+  PhysicsWorld();
+  ~PhysicsWorld(); // = default
+
+  void setGravity(const Vec3& gravity);
+  [[nodiscard]] const Vec3& gravity() const
+  {
+    return _gravity;
+  }
+
+  /**
+   * @brief Sets the number of velocity iterations of the solver.
+   */
+  void setIterations(size_t iterations);
+  [[nodiscard]] size_t iterations() const
+  {
+    return _iterations;
+  }
+
+  BodyId createBody(const BodyDefinition& definition);
+  void destroyBody(BodyId id);
+
+  [[nodiscard]] Body& body(BodyId id)
+  {
+    return _bodies[id];
+  }
+
+  [[nodiscard]] const Body& body(BodyId id) const
+  {
+    return _bodies[id];
+  }
+
+  /**
+   * @brief Teleports the body. The body is woken up if the transform changed.
+   */
+  void setTransform(BodyId id, const Vec3& position, const Quat& rotation);
+
+  /**
+   * @brief Teleports bodies in bulk, see setTransform.
+   */
+  void setTransforms(size_t count, const BodyId* ids, const Vec3* positions,
+                     const Quat* rotations);
+
+  /**
+   * @brief Gets in bulk the transforms of the bodies moved by the steps following the given one,
+   * among the given ones. Static and sleeping bodies are skipped, except the bodies which fell
+   * asleep in those steps.
+   * @param sinceStep the index of the last step whose moves were already read, see stepIndex()
+   * @param indices receives the indices, in ids, of the moved bodies
+   * @return the number of moved bodies
+   */
+  size_t getMovedTransforms(uint32_t sinceStep, size_t count, const BodyId* ids,
+                            uint32_t* indices, Vec3* positions, Quat* rotations) const;
+  void setLinearVelocity(BodyId id, const Vec3& velocity);
+  void setAngularVelocity(BodyId id, const Vec3& velocity);
+  void applyImpulse(BodyId id, const Vec3& impulse, const Vec3& point);
+  void applyForce(BodyId id, const Vec3& force, const Vec3& point);
+  void setMass(BodyId id, float mass);
+  void setShape(BodyId id, const CollisionShape& shape);
+  void wakeUp(BodyId id);
+  void sleep(BodyId id);
+
+  JointId createJoint(const JointDefinition& definition);
+  void destroyJoint(JointId id);
+
+  [[nodiscard]] const Joint& joint(JointId id) const
+  {
+    return _joints[id];
+  }
+
+  /**
+   * @brief Drives the joint at the given speed, the motor 0 along the axis of A and the motor 1
+   * along the axis of B. A null maximum force is not bounded.
+   */
+  void setMotor(JointId id, unsigned int index, float speed, float maxForce);
+  void setLimit(JointId id, float lower, float upper);
+  void setDistance(JointId id, float minDistance, float maxDistance);
+
+  /**
+   * @brief Sets the thread pool running the steps.
+   * @param threadPool the thread pool, or nullptr to use the default thread pool
+   */
+  void setThreadPool(ThreadPool* threadPool);
+
+  /**
+   * @brief Finds the closest body hit by the segment from - to.
+   */
+  [[nodiscard]] RayHit raycast(const Vec3& from, const Vec3& to) const;
+
+  /**
+   * @brief Collects the bodies whose enlarged broadphase boxes overlap the box, in increasing id
+   * order.
+   */
+  void queryAABB(const AABB& box, std::vector<BodyId>& bodies) const;
+
+  /**
+   * @brief Advances the simulation.
+   */
+  void step(float timeStep);
+
+  /**
+   * @brief Gets the index of the last step, 0 before the first one.
+   */
+  [[nodiscard]] uint32_t stepIndex() const
+  {
+    return _stepIndex;
+  }
+
+  [[nodiscard]] size_t bodyCount() const
+  {
+    return _bodyCount;
+  }
+
+  [[nodiscard]] size_t contactCount() const
+  {
+    return _contacts.size();
+  }
+
+  [[nodiscard]] size_t awakeBodyCount() const;
+
+  [[nodiscard]] const std::vector<Contact>& contacts() const
+  {
+    return _contacts;
+  }
+
+  [[nodiscard]] const DynamicAABBTree& broadphase() const
+  {
+    return _tree;
+  }
+
+private:
+  struct Island {
+    std::vector<BodyId> bodies;
+    std::vector<uint32_t> contacts;
+    std::vector<JointId> joints;
+    // Constraints of a large island grouped in batches sharing no dynamic body, joints being
+    // flagged with JointBit. The batch b spans [batchOffsets[b], batchOffsets[b + 1]).
+    std::vector<uint32_t> batchConstraints;
+    std::vector<uint32_t> batchOffsets;
+  }; // end of struct Island
+
+  static constexpr uint32_t JointBit = 1u << 31;
+
+  void _updateMassProperties(Body& body) const;
+  void _synchronizeProxy(BodyId id);
+  void _findNewContacts();
+  void _updateContacts(ThreadPool& threadPool);
+  void _updateContact(Contact& contact, ContactManifold& manifold) const;
+  void _destroyContact(size_t index);
+  void _wakeContactBodies(const Contact& contact);
+  bool _shouldCollide(BodyId a, BodyId b) const;
+  void _buildIslands();
+  void _colorIsland(Island& island);
+  void _solveIsland(Island& island, float timeStep);
+  void _solveLargeIsland(Island& island, float timeStep, ThreadPool& threadPool);
+  void _integrateVelocity(Body& body, float timeStep) const;
+  void _integratePosition(Body& body, float timeStep) const;
+  void _prepareConstraint(uint32_t constraint, float timeStep);
+  void _warmStartConstraint(uint32_t constraint);
+  void _solveConstraint(uint32_t constraint);
+  void _prepareJoint(Joint& joint, float timeStep);
+  void _prepareContact(Contact& contact, float timeStep);
+  void _warmStart(Contact& contact);
+  void _solveJoint(Joint& joint);
+  void _solveContact(Contact& contact);
+
+private:
+  Vec3 _gravity{0.f, -9.81f, 0.f};
+  size_t _iterations;
+  std::vector<Body> _bodies;
+  std::vector<BodyId> _freeBodies;
+  size_t _bodyCount;
+  std::vector<Joint> _joints;
+  std::vector<JointId> _freeJoints;
+  DynamicAABBTree _tree;
+  // Proxies whose enlarged box changed since the last step
+  std::vector<int> _moveBuffer;
+  std::vector<Contact> _contacts;
+  // Index of the contact of each pair of bodies
+  std::unordered_map<uint64_t, uint32_t> _pairs;
+  // Pairs of bodies connected by joints without collisions
+  std::unordered_map<uint64_t, uint32_t> _jointPairs;
+  std::vector<Island> _islands;
+  std::vector<uint32_t> _islandParents;
+  std::vector<uint32_t> _islandIndices;
+  // Islands solved with batches, the others being solved one island per worker
+  std::vector<uint32_t> _largeIslands;
+  std::vector<uint32_t> _smallIslands;
+  // Batches used by the constraints of each body, while coloring an island
+  std::vector<uint64_t> _bodyBatches;
+  ThreadPool* _threadPool;
+  // Index of the current step, starting at 1
+  uint32_t _stepIndex;
+}; // end of class PhysicsWorld
+
+} // end of namespace NativePhysics
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_WORLD_H
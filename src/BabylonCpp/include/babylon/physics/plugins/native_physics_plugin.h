@@ -0,0 +1,187 @@
+#ifndef BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_PLUGIN_H
+#define BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_PLUGIN_H
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/physics/iphysics_body.h>
+#include <babylon/physics/iphysics_engine_plugin.h>
+#include <babylon/physics/plugins/native/physics_world.h>
+
+namespace BABYLON {
+
+class PhysicsJoint;
+
+/**
+ * @brief Physics body of an impostor in the native physics world.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsBody : public IPhysicsBody {
+
+public:
+  NativePhysicsBody(NativePhysics::PhysicsWorld* world, NativePhysics::BodyId id);
+  virtual ~NativePhysicsBody(); // = default
+
+  void setPosition(const Vector3& newPosition) override;
+  void setOrientation(const Quaternion& newRotation) override;
+  void setShapesDensity(float density) override;
+  void setupMass(int mass) override;
+  float mass() override;
+  void applyImpulse(const Vector3& position, const Vector3& force) override;
+  Vector3 angularVelocity() override;
+  void setAngularVelocity(const Vector3& velocity) override;
+  Vector3 linearVelocity() override;
+  void setLinearVelocity(const Vector3& velocity) override;
+  void sleep() override;
+  bool sleeping() override;
+  void awake() override;
+  void syncShapes() override;
+
+public:
+  NativePhysics::PhysicsWorld* world;
+  NativePhysics::BodyId id;
+
+}; // end of class NativePhysicsBody
+
+/**
+ * @brief Physics plugin running the rigid body simulation natively, without an external engine:
+ * it works headless, e.g. under the NullEngine.
+ *
+ * The transformations of the impostors without parent, delta transformation nor step callback are
+ * exchanged with the world in bulk, through contiguous arrays: only the objects whose
+ * transformation changed are pushed to the world, and only the bodies moved by the step are
+ * written back, so that the world matrices of resting objects stay cached. The other impostors go
+ * through beforeStep and afterStep.
+ *
+ * Spheres, capsules, boxes, cylinders and convex hulls are simulated. Mesh impostors are
+ * approximated by the convex hull of their vertices and heightmaps by their bounding box. Soft
+ * bodies and compound impostors made of parented meshes are not supported.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsPlugin : public IPhysicsEnginePlugin {
+
+public:
+  /**
+   * @brief Creates the plugin.
+   * @param useDeltaForWorldStep defines whether the world advances by the frame delta, in fixed
+   * steps, or by a single fixed step per frame. With a sub time step set on the physics engine,
+   * each engine step advances the world by exactly one fixed step of the sub time step.
+   * @param iterations defines the number of velocity iterations of the solver
+   */
+  NativePhysicsPlugin(bool useDeltaForWorldStep = true, size_t iterations = 10);
+  ~NativePhysicsPlugin() override; // = default
+
+  void setGravity(const Vector3& gravity) override;
+  void setTimeStep(float timeStep) override;
+  [[nodiscard]] float getTimeStep() const override;
+  void executeStep(float delta, const std::vector<PhysicsImpostorPtr>& impostors) override;
+  void applyImpulse(const PhysicsImpostor& impostor, const Vector3& force,
+                    const Vector3& contactPoint) override;
+  void applyForce(const PhysicsImpostor& impostor, const Vector3& force,
+                  const Vector3& contactPoint) override;
+  void generatePhysicsBody(PhysicsImpostor& impostor) override;
+  void removePhysicsBody(const PhysicsImpostor& impostor) override;
+  void generateJoint(PhysicsImpostorJoint* impostorJoint) override;
+  void removeJoint(PhysicsImpostorJoint* impostorJoint) override;
+  bool isSupported() override;
+  void setTransformationFromPhysicsBody(const PhysicsImpostor& impostor) override;
+  void setPhysicsBodyTransformation(const PhysicsImpostor& impostor, const Vector3& newPosition,
+                                    const Quaternion& newRotation) override;
+  void setLinearVelocity(const PhysicsImpostor& impostor,
+                         const std::optional<Vector3>& velocity) override;
+  void setAngularVelocity(const PhysicsImpostor& impostor,
+                          const std::optional<Vector3>& velocity) override;
+  Vector3 getLinearVelocity(const PhysicsImpostor& impostor) override;
+  Vector3 getAngularVelocity(const PhysicsImpostor& impostor) override;
+  void setBodyMass(const PhysicsImpostor& impostor, float mass) override;
+  float getBodyMass(const PhysicsImpostor& impostor) override;
+  float getBodyFriction(const PhysicsImpostor& impostor) override;
+  void setBodyFriction(const PhysicsImpostor& impostor, float friction) override;
+  float getBodyRestitution(const PhysicsImpostor& impostor) override;
+  void setBodyRestitution(const PhysicsImpostor& impostor, float restitution) override;
+  float getBodyPressure(const PhysicsImpostor& impostor) override;
+  void setBodyPressure(const PhysicsImpostor& impostor, float pressure) override;
+  float getBodyStiffness(const PhysicsImpostor& impostor) override;
+  void setBodyStiffness(const PhysicsImpostor& impostor, float stiffness) override;
+  size_t getBodyVelocityIterations(const PhysicsImpostor& impostor) override;
+  void setBodyVelocityIterations(const PhysicsImpostor& impostor,
+                                 size_t velocityIterations) override;
+  size_t getBodyPositionIterations(const PhysicsImpostor& impostor) override;
+  void setBodyPositionIterations(const PhysicsImpostor& impostor,
+                                 size_t positionIterations) override;
+  void appendAnchor(const PhysicsImpostor& impostor, const PhysicsImpostorPtr& otherImpostor,
+                    int width, int height, float influence,
+                    bool noCollisionBetweenLinkedBodies) override;
+  void appendHook(const PhysicsImpostor& impostor, const PhysicsImpostorPtr& otherImpostor,
+                  float length, float influence, bool noCollisionBetweenLinkedBodies) override;
+  void sleepBody(const PhysicsImpostor& impostor) override;
+  void wakeUpBody(const PhysicsImpostor& impostor) override;
+  PhysicsRaycastResult raycast(const Vector3& from, const Vector3& to) override;
+  void updateDistanceJoint(DistanceJoint* joint, float maxDistance, float minDistance) override;
+  void setMotor(IMotorEnabledJoint* joint, float speed, float maxForce,
+                unsigned int motorIndex = 0) override;
+  void setLimit(IMotorEnabledJoint* joint, float upperLimit, float lowerLimit,
+                unsigned int motorIndex = 0) override;
+  float getRadius(const PhysicsImpostor& impostor) override;
+  void getBoxSizeToRef(const PhysicsImpostor& impostor, Vector3& result) override;
+  void syncMeshWithImpostor(AbstractMesh* mesh, const PhysicsImpostor& impostor) override;
+  void dispose() override;
+  bool queryBroadphase(const Vector3& minimum, const Vector3& maximum,
+                       std::vector<PhysicsImpostor*>& impostors) override;
+
+  /**
+   * @brief Sets the thread pool running the steps of the world.
+   * @param threadPool the thread pool, or nullptr to use the default thread pool
+   */
+  void setThreadPool(ThreadPool* threadPool);
+
+  /**
+   * @brief Gets the native physics world.
+   */
+  NativePhysics::PhysicsWorld& physicsWorld()
+  {
+    return *_world;
+  }
+
+  /**
+   * @brief Gets the body of the impostor in the native physics world, InvalidId if it has none.
+   */
+  [[nodiscard]] NativePhysics::BodyId getBodyId(const PhysicsImpostor& impostor) const;
+
+private:
+  NativePhysics::CollisionShape _createShape(PhysicsImpostor& impostor) const;
+  NativePhysics::JointId _getJointId(const PhysicsJoint* joint) const;
+  void _syncBodiesBeforeStep(const std::vector<PhysicsImpostorPtr>& impostors);
+  void _syncObjectsAfterStep(uint32_t startStep);
+
+private:
+  static constexpr unsigned int MaxSubSteps = 3;
+
+  bool _useDeltaForWorldStep;
+  float _fixedTimeStep;
+  float _accumulator;
+  std::unique_ptr<NativePhysics::PhysicsWorld> _world;
+  ThreadPool* _threadPool;
+  std::unordered_map<const PhysicsImpostor*, std::unique_ptr<NativePhysicsBody>> _bodies;
+  std::unordered_map<const PhysicsJoint*, NativePhysics::JointId> _joints;
+  // Transformations of the objects last exchanged with the bodies, by body
+  std::vector<NativePhysics::Vec3> _syncedPositions;
+  std::vector<NativePhysics::Quat> _syncedRotations;
+  // Impostors synchronized in bulk during the current step, and their bodies
+  std::vector<PhysicsImpostor*> _bulkImpostors;
+  std::vector<NativePhysics::BodyId> _bulkBodies;
+  // Impostors going through beforeStep and afterStep
+  std::vector<PhysicsImpostor*> _stepImpostors;
+  // Transformations exchanged with the world
+  std::vector<uint32_t> _movedIndices;
+  std::vector<NativePhysics::BodyId> _movedBodies;
+  std::vector<NativePhysics::Vec3> _movedPositions;
+  std::vector<NativePhysics::Quat> _movedRotations;
+  // Bodies found by the broadphase queries
+  std::vector<NativePhysics::BodyId> _queriedBodies;
+
+}; // end of class NativePhysicsPlugin
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_PLUGINS_NATIVE_PHYSICS_PLUGIN_H
@@ -15,14 +15,18 @@
 namespace BABYLON {
 
 Action::Action(unsigned int iTriggerOptions, Condition* condition)
-    : _nextActiveAction{this}, _condition{condition}
+    : _nextActiveAction{this}, _child{nullptr}, _condition{condition}
 {
   trigger = iTriggerOptions;
 }
 
 Action::Action(const TriggerOptions& iTriggerOptions, Condition* condition)
-    : _nextActiveAction{this}, _condition{condition}, _triggerParameter{triggerOptions.parameter}
+    : _nextActiveAction{this}
+    , _child{nullptr}
+    , _condition{condition}
+    , _triggerParameter{iTriggerOptions.parameter}
 {
+  trigger        = iTriggerOptions.trigger;
   triggerOptions = iTriggerOptions;
 }
 
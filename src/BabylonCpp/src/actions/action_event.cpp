@@ -26,11 +26,12 @@ ActionEvent& ActionEvent::operator=(ActionEvent&& other) =default;
 ActionEvent::~ActionEvent() = default;
 
 ActionEvent ActionEvent::CreateNew(const AbstractMeshPtr& iSource,
-                                   const std::optional<Event>& evt)
+                                   const std::optional<Event>& evt,
+                                   const std::string& additionalData)
 {
   auto scene = iSource->getScene();
   return ActionEvent(iSource, scene->pointerX(), scene->pointerY(),
-                     scene->meshUnderPointer(), evt);
+                     scene->meshUnderPointer(), evt, additionalData);
 }
 
 ActionEvent ActionEvent::CreateNewFromSprite(const SpritePtr& iSource,
@@ -12,6 +12,14 @@ ExecuteCodeAction::ExecuteCodeAction(
 {
 }
 
+ExecuteCodeAction::ExecuteCodeAction(
+  const TriggerOptions& iTriggerOptions,
+  const std::function<void(const std::optional<IActionEvent>& evt)>& iFunc,
+  Condition* condition)
+    : Action(iTriggerOptions, condition), func{iFunc}
+{
+}
+
 ExecuteCodeAction::~ExecuteCodeAction() = default;
 
 void ExecuteCodeAction::execute(const std::optional<IActionEvent>& evt)
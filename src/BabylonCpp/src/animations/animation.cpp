@@ -174,6 +174,7 @@ Animation::Animation(const std::string& iName, const std::string& iTargetPropert
     , targetPropertyPath{StringTools::split(targetProperty, '.')}
     , blendingSpeed{0.01f}
     , hasRunningRuntimeAnimations{this, &Animation::get_hasRunningRuntimeAnimations}
+    , _keysMemory{MemoryCategory::AnimationKeys}
     , _easingFunction{nullptr}
 {
   framePerSecond = iFramePerSecond;
@@ -246,6 +247,7 @@ void Animation::deleteRange(const std::string& iName, bool deleteFrames)
       stl_util::erase_remove_if(_keys, [from, to](const IAnimationKey& key) {
         return key.frame >= from && key.frame <= to;
       });
+      _keysMemory.set(_keys.capacity() * sizeof(IAnimationKey));
     }
     _ranges.erase(iName);
   }
@@ -642,6 +644,7 @@ AnimationPtr Animation::clone() const
 void Animation::setKeys(const std::vector<IAnimationKey>& values)
 {
   _keys = values;
+  _keysMemory.set(_keys.capacity() * sizeof(IAnimationKey));
 }
 
 json Animation::serialize() const
@@ -0,0 +1,376 @@
+#include <babylon/audio/analyser.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include <babylon/audio/audio_engine.h>
+#include <babylon/babylon_constants.h>
+#include <babylon/core/logging.h>
+#include <babylon/engines/engine.h>
+
+namespace BABYLON {
+
+namespace {
+
+// The ring buffer keeps twice the largest FFT size so that the worker reads the latest samples
+// while the mixer writes the next blocks
+constexpr size_t RingSize = 2 * Analyser::MaxFFTSize;
+constexpr size_t RingMask = RingSize - 1;
+
+// Half a frame at 60 frames per second, the results are never older than that
+constexpr std::chrono::microseconds AnalysisInterval{8333};
+
+// The tables of the largest sizes are computed in double precision
+constexpr double Pi = 3.14159265358979323846;
+
+} // end of anonymous namespace
+
+/**
+ * Real FFT of size N computed as a complex FFT of size N / 2 on the even and odd samples packed
+ * in the real and imaginary parts, then split into the spectrum of the real sequence. The tables
+ * are computed once per size and the butterflies use contiguous twiddles per stage so that the
+ * inner loops vectorize.
+ */
+struct Analyser::FFT {
+
+  explicit FFT(size_t iSize)
+      : size{iSize}
+      , window(iSize)
+      , bitReversal(iSize / 2)
+      , twiddleReal(iSize / 2)
+      , twiddleImag(iSize / 2)
+      , splitReal(iSize / 2)
+      , splitImag(iSize / 2)
+      , real(iSize / 2)
+      , imag(iSize / 2)
+      , magnitudes(iSize / 2)
+  {
+    const auto n = static_cast<double>(size);
+    const auto m = size / 2;
+
+    // Blackman window, as the AnalyserNode of WebAudio
+    for (size_t i = 0; i < size; ++i) {
+      const auto x = 2.0 * Pi * static_cast<double>(i) / n;
+      window[i]    = static_cast<float>(0.42 - 0.5 * std::cos(x) + 0.08 * std::cos(2.0 * x));
+    }
+
+    size_t bitCount = 0;
+    while ((size_t(1) << bitCount) < m) {
+      ++bitCount;
+    }
+    for (size_t i = 0; i < m; ++i) {
+      size_t reversed = 0;
+      for (size_t bit = 0; bit < bitCount; ++bit) {
+        reversed |= ((i >> bit) & 1) << (bitCount - 1 - bit);
+      }
+      bitReversal[i] = static_cast<uint32_t>(reversed);
+    }
+
+    // The twiddles of the stage of half size h start at h - 1
+    for (size_t half = 1; half < m; half <<= 1) {
+      for (size_t k = 0; k < half; ++k) {
+        const auto angle = -Pi * static_cast<double>(k) / static_cast<double>(half);
+        twiddleReal[half - 1 + k] = static_cast<float>(std::cos(angle));
+        twiddleImag[half - 1 + k] = static_cast<float>(std::sin(angle));
+      }
+    }
+
+    for (size_t k = 0; k < m; ++k) {
+      const auto angle = -2.0 * Pi * static_cast<double>(k) / n;
+      splitReal[k]     = static_cast<float>(std::cos(angle));
+      splitImag[k]     = static_cast<float>(std::sin(angle));
+    }
+  }
+
+  // Computes the magnitudes of the size / 2 first bins of the windowed input, divided by size
+  void transform(const float* input)
+  {
+    const auto m = size / 2;
+
+    // Even samples in the real part, odd samples in the imaginary part, in bit reversed order
+    for (size_t i = 0; i < m; ++i) {
+      const auto j = bitReversal[i];
+      real[j]      = input[2 * i] * window[2 * i];
+      imag[j]      = input[2 * i + 1] * window[2 * i + 1];
+    }
+
+    for (size_t half = 1; half < m; half <<= 1) {
+      const auto wr = &twiddleReal[half - 1];
+      const auto wi = &twiddleImag[half - 1];
+      for (size_t start = 0; start < m; start += 2 * half) {
+        auto ar = &real[start];
+        auto ai = &imag[start];
+        auto br = &real[start + half];
+        auto bi = &imag[start + half];
+        for (size_t k = 0; k < half; ++k) {
+          const auto tr = br[k] * wr[k] - bi[k] * wi[k];
+          const auto ti = br[k] * wi[k] + bi[k] * wr[k];
+          br[k]         = ar[k] - tr;
+          bi[k]         = ai[k] - ti;
+          ar[k] += tr;
+          ai[k] += ti;
+        }
+      }
+    }
+
+    // X[k] = E[k] + W^k O[k], with E[k] = (Z[k] + Z*[m - k]) / 2 and O[k] = (Z[k] - Z*[m - k]) / 2i
+    const auto scale = 1.f / static_cast<float>(size);
+    for (size_t k = 0; k < m; ++k) {
+      const auto nk = (m - k) & (m - 1);
+      const auto evenReal = 0.5f * (real[k] + real[nk]);
+      const auto evenImag = 0.5f * (imag[k] - imag[nk]);
+      const auto oddReal  = 0.5f * (imag[k] + imag[nk]);
+      const auto oddImag  = -0.5f * (real[k] - real[nk]);
+      const auto xr       = evenReal + splitReal[k] * oddReal - splitImag[k] * oddImag;
+      const auto xi       = evenImag + splitReal[k] * oddImag + splitImag[k] * oddReal;
+      magnitudes[k]       = std::sqrt(xr * xr + xi * xi) * scale;
+    }
+  }
+
+  size_t size;
+  Float32Array window;
+  std::vector<uint32_t> bitReversal;
+  Float32Array twiddleReal;
+  Float32Array twiddleImag;
+  Float32Array splitReal;
+  Float32Array splitImag;
+  Float32Array real;
+  Float32Array imag;
+  Float32Array magnitudes;
+
+}; // end of struct Analyser::FFT
+
+Analyser::Analyser(Scene* scene)
+    : SMOOTHING{0.75f}
+    , FFT_SIZE{512}
+    , BARGRAPHAMPLITUDE{256.f}
+    , minDecibels{-100.f}
+    , maxDecibels{-30.f}
+    , _scene{scene}
+    , _audioEngine{Engine::audioEngine}
+    , _fftSize{FFT_SIZE}
+    , _smoothing{SMOOTHING}
+    , _minDecibels{minDecibels}
+    , _maxDecibels{maxDecibels}
+    , _samples{std::make_unique<std::atomic<float>[]>(RingSize)}
+    , _writtenFrameCount{0}
+    , _middleResults{1}
+    , _readerResults{0}
+    , _workerResults{2}
+    , _lastAnalysedFrameCount{0}
+    , _stopWorker{false}
+{
+  for (size_t i = 0; i < RingSize; ++i) {
+    _samples[i].store(0.f, std::memory_order_relaxed);
+  }
+  _worker = std::thread(&Analyser::_run, this);
+}
+
+Analyser::~Analyser()
+{
+  dispose();
+}
+
+void Analyser::_updateParameters()
+{
+  if (FFT_SIZE != _fftSize.load(std::memory_order_relaxed)) {
+    if (FFT_SIZE < 32 || FFT_SIZE > MaxFFTSize || (FFT_SIZE & (FFT_SIZE - 1)) != 0) {
+      BABYLON_LOGF_ERROR("Analyser",
+                         "The FFT size must be a power of two between 32 and %zu, got %zu",
+                         MaxFFTSize, FFT_SIZE)
+      FFT_SIZE = _fftSize.load(std::memory_order_relaxed);
+    }
+    else {
+      _fftSize.store(FFT_SIZE, std::memory_order_relaxed);
+    }
+  }
+  _smoothing.store(std::clamp(SMOOTHING, 0.f, 1.f), std::memory_order_relaxed);
+  _minDecibels.store(minDecibels, std::memory_order_relaxed);
+  _maxDecibels.store(maxDecibels, std::memory_order_relaxed);
+}
+
+const Analyser::Results& Analyser::_fetchResults()
+{
+  // The results of the worker are only taken when they are newer, otherwise the reader keeps its
+  // own slot
+  if (_middleResults.load(std::memory_order_relaxed) & NewResultsFlag) {
+    _readerResults
+      = _middleResults.exchange(_readerResults, std::memory_order_acq_rel) & ~NewResultsFlag;
+  }
+  return _results[_readerResults];
+}
+
+size_t Analyser::getFrequencyBinCount()
+{
+  _updateParameters();
+  return FFT_SIZE / 2;
+}
+
+Uint8Array& Analyser::getByteFrequencyData()
+{
+  _updateParameters();
+  const auto& results = _fetchResults();
+  if (results.fftSize == FFT_SIZE) {
+    _byteFreqs = results.byteFrequencyData;
+  }
+  else {
+    _byteFreqs.assign(FFT_SIZE / 2, 0);
+  }
+  return _byteFreqs;
+}
+
+Uint8Array& Analyser::getByteTimeDomainData()
+{
+  _updateParameters();
+  const auto& results = _fetchResults();
+  if (results.fftSize == FFT_SIZE) {
+    _byteTime = results.byteTimeDomainData;
+  }
+  else {
+    _byteTime.assign(FFT_SIZE, 128);
+  }
+  return _byteTime;
+}
+
+Float32Array& Analyser::getFloatFrequencyData()
+{
+  _updateParameters();
+  const auto& results = _fetchResults();
+  if (results.fftSize == FFT_SIZE) {
+    _floatFreqs = results.floatFrequencyData;
+  }
+  else {
+    _floatFreqs.assign(FFT_SIZE / 2, -std::numeric_limits<float>::infinity());
+  }
+  return _floatFreqs;
+}
+
+Float32Array& Analyser::getFloatTimeDomainData()
+{
+  _updateParameters();
+  const auto& results = _fetchResults();
+  if (results.fftSize == FFT_SIZE) {
+    _floatTime = results.floatTimeDomainData;
+  }
+  else {
+    _floatTime.assign(FFT_SIZE, 0.f);
+  }
+  return _floatTime;
+}
+
+uint64_t Analyser::_getAnalysedFrameCount() const
+{
+  return _results[_readerResults].frameCount;
+}
+
+void Analyser::_write(const float* frames, size_t frameCount)
+{
+  const auto writtenFrameCount = _writtenFrameCount.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < frameCount; ++i) {
+    _samples[(writtenFrameCount + i) & RingMask].store(
+      0.5f * (frames[2 * i] + frames[2 * i + 1]), std::memory_order_relaxed);
+  }
+  _writtenFrameCount.store(writtenFrameCount + frameCount, std::memory_order_release);
+}
+
+void Analyser::_run()
+{
+  std::unique_lock<std::mutex> lock(_workerMutex);
+  while (!_stopWorker) {
+    lock.unlock();
+    _analyse();
+    lock.lock();
+    _workerCondition.wait_for(lock, AnalysisInterval, [this] { return _stopWorker; });
+  }
+}
+
+void Analyser::_analyse()
+{
+  const auto fftSize           = _fftSize.load(std::memory_order_relaxed);
+  const auto writtenFrameCount = _writtenFrameCount.load(std::memory_order_acquire);
+  const auto binCount          = fftSize / 2;
+
+  // A new size restarts the smoothing
+  const auto resized = !_fft || _fft->size != fftSize;
+  if (resized) {
+    _fft = std::make_unique<FFT>(fftSize);
+    _timeDomain.resize(fftSize);
+    _smoothedMagnitudes.assign(binCount, 0.f);
+  }
+  else if (writtenFrameCount == _lastAnalysedFrameCount) {
+    return;
+  }
+
+  // Latest samples, preceded by silence before the first written frame
+  const auto available = static_cast<size_t>(std::min<uint64_t>(writtenFrameCount, fftSize));
+  const auto first     = writtenFrameCount - available;
+  std::fill(_timeDomain.begin(), _timeDomain.begin() + (fftSize - available), 0.f);
+  for (size_t i = 0; i < available; ++i) {
+    _timeDomain[fftSize - available + i]
+      = _samples[(first + i) & RingMask].load(std::memory_order_relaxed);
+  }
+  // The mixer may have overwritten the oldest samples while they were copied
+  if (_writtenFrameCount.load(std::memory_order_acquire) - writtenFrameCount
+      > RingSize - fftSize) {
+    return;
+  }
+
+  _fft->transform(_timeDomain.data());
+
+  const auto smoothing   = _smoothing.load(std::memory_order_relaxed);
+  const auto minDb       = _minDecibels.load(std::memory_order_relaxed);
+  const auto maxDb       = _maxDecibels.load(std::memory_order_relaxed);
+  const auto rangeScale  = maxDb > minDb ? 255.f / (maxDb - minDb) : 0.f;
+  const auto& magnitudes = _fft->magnitudes;
+
+  auto& results = _results[_workerResults];
+  results.floatFrequencyData.resize(binCount);
+  results.byteFrequencyData.resize(binCount);
+  results.floatTimeDomainData.resize(fftSize);
+  results.byteTimeDomainData.resize(fftSize);
+  for (size_t k = 0; k < binCount; ++k) {
+    auto smoothed = smoothing * _smoothedMagnitudes[k] + (1.f - smoothing) * magnitudes[k];
+    if (!std::isfinite(smoothed)) {
+      smoothed = 0.f;
+    }
+    _smoothedMagnitudes[k] = smoothed;
+    const auto decibels    = smoothed > 0.f ? 20.f * std::log10(smoothed) :
+                                              -std::numeric_limits<float>::infinity();
+    const auto scaled = std::floor(rangeScale * (decibels - minDb));
+    results.floatFrequencyData[k] = decibels;
+    results.byteFrequencyData[k]  = static_cast<uint8_t>(std::clamp(scaled, 0.f, 255.f));
+  }
+  for (size_t i = 0; i < fftSize; ++i) {
+    const auto scaled              = std::floor(128.f * (1.f + _timeDomain[i]));
+    results.floatTimeDomainData[i] = _timeDomain[i];
+    results.byteTimeDomainData[i]  = static_cast<uint8_t>(std::clamp(scaled, 0.f, 255.f));
+  }
+  results.frameCount = writtenFrameCount;
+  results.fftSize    = fftSize;
+
+  // Publishes the results and takes back the slot the reader does not use
+  _workerResults
+    = _middleResults.exchange(_workerResults | NewResultsFlag, std::memory_order_acq_rel)
+      & ~NewResultsFlag;
+  _lastAnalysedFrameCount = writtenFrameCount;
+}
+
+void Analyser::dispose()
+{
+  if (_audioEngine) {
+    _audioEngine->_disconnectAnalyser(this);
+    _audioEngine = nullptr;
+  }
+  {
+    std::lock_guard<std::mutex> lock(_workerMutex);
+    _stopWorker = true;
+  }
+  _workerCondition.notify_one();
+  if (_worker.joinable()) {
+    _worker.join();
+  }
+}
+
+} // end of namespace BABYLON
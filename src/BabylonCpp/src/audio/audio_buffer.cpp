@@ -0,0 +1,169 @@
+#include <babylon/audio/audio_buffer.h>
+
+#include <cstring>
+
+#include <babylon/core/logging.h>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr uint16_t WaveFormatPCM        = 0x0001;
+constexpr uint16_t WaveFormatIEEEFloat  = 0x0003;
+constexpr uint16_t WaveFormatExtensible = 0xFFFE;
+
+uint16_t readUint16(const uint8_t* data)
+{
+  return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+uint32_t readUint32(const uint8_t* data)
+{
+  return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8)
+         | (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+// Copies the interleaved samples to an aligned array, then splits the channels
+template <typename T>
+void deinterleave(const uint8_t* data, size_t frameCount, float scale, float bias,
+                  std::vector<Float32Array>& channels)
+{
+  const auto channelCount = channels.size();
+  std::vector<T> samples(frameCount * channelCount);
+  std::memcpy(samples.data(), data, samples.size() * sizeof(T));
+  for (size_t channel = 0; channel < channelCount; ++channel) {
+    auto output = channels[channel].data();
+    const auto input = samples.data() + channel;
+    for (size_t i = 0; i < frameCount; ++i) {
+      output[i] = (static_cast<float>(input[i * channelCount]) + bias) * scale;
+    }
+  }
+}
+
+void deinterleave24(const uint8_t* data, size_t frameCount, std::vector<Float32Array>& channels)
+{
+  const auto channelCount = channels.size();
+  for (size_t i = 0; i < frameCount; ++i) {
+    for (size_t channel = 0; channel < channelCount; ++channel) {
+      const auto sample = data + (i * channelCount + channel) * 3;
+      // Sign extension of the 24 bits value through the upper byte of a 32 bits value
+      const auto value = static_cast<int32_t>(static_cast<uint32_t>(sample[0]) << 8
+                                              | static_cast<uint32_t>(sample[1]) << 16
+                                              | static_cast<uint32_t>(sample[2]) << 24)
+                         >> 8;
+      channels[channel][i] = static_cast<float>(value) * (1.f / 8388608.f);
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+AudioBuffer::AudioBuffer(size_t numberOfChannels, size_t length, size_t sampleRate)
+    : _channels(numberOfChannels, Float32Array(length, 0.f))
+    , _length{length}
+    , _sampleRate{sampleRate}
+{
+}
+
+AudioBuffer::~AudioBuffer() = default;
+
+AudioBufferPtr AudioBuffer::DecodePCM(const uint8_t* data, size_t byteLength,
+                                      size_t numberOfChannels, size_t sampleRate,
+                                      unsigned int bitsPerSample, bool isFloat)
+{
+  if (numberOfChannels == 0 || sampleRate == 0) {
+    BABYLON_LOG_ERROR("AudioBuffer", "Invalid number of channels or sample rate.")
+    return nullptr;
+  }
+  const auto validFormat = isFloat ? (bitsPerSample == 32 || bitsPerSample == 64) :
+                                     (bitsPerSample == 8 || bitsPerSample == 16
+                                      || bitsPerSample == 24 || bitsPerSample == 32);
+  if (!validFormat) {
+    BABYLON_LOGF_ERROR("AudioBuffer", "Unsupported PCM format: %u bits %s samples.",
+                       bitsPerSample, isFloat ? "float" : "integer")
+    return nullptr;
+  }
+
+  const auto frameSize  = numberOfChannels * bitsPerSample / 8;
+  const auto frameCount = byteLength / frameSize;
+  auto buffer           = AudioBuffer::New(numberOfChannels, frameCount, sampleRate);
+  auto& channels        = buffer->_channels;
+  if (isFloat) {
+    if (bitsPerSample == 32) {
+      deinterleave<float>(data, frameCount, 1.f, 0.f, channels);
+    }
+    else {
+      deinterleave<double>(data, frameCount, 1.f, 0.f, channels);
+    }
+    return buffer;
+  }
+  switch (bitsPerSample) {
+    case 8:
+      // 8 bits samples are unsigned
+      deinterleave<uint8_t>(data, frameCount, 1.f / 128.f, -128.f, channels);
+      break;
+    case 16:
+      deinterleave<int16_t>(data, frameCount, 1.f / 32768.f, 0.f, channels);
+      break;
+    case 24:
+      deinterleave24(data, frameCount, channels);
+      break;
+    default:
+      deinterleave<int32_t>(data, frameCount, 1.f / 2147483648.f, 0.f, channels);
+      break;
+  }
+  return buffer;
+}
+
+AudioBufferPtr AudioBuffer::DecodeWav(const ArrayBuffer& data)
+{
+  if (data.size() < 12 || std::memcmp(data.data(), "RIFF", 4) != 0
+      || std::memcmp(data.data() + 8, "WAVE", 4) != 0) {
+    BABYLON_LOG_ERROR("AudioBuffer", "The data is not a RIFF WAVE file.")
+    return nullptr;
+  }
+
+  uint16_t format            = 0;
+  size_t numberOfChannels    = 0;
+  size_t sampleRate          = 0;
+  unsigned int bitsPerSample = 0;
+  bool hasFormat             = false;
+  size_t offset              = 12;
+  while (offset + 8 <= data.size()) {
+    const auto chunk     = data.data() + offset;
+    const auto chunkSize = readUint32(chunk + 4);
+    const auto chunkData = chunk + 8;
+    const auto available = data.size() - offset - 8;
+    if (std::memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 16 && available >= 16) {
+      format           = readUint16(chunkData);
+      numberOfChannels = readUint16(chunkData + 2);
+      sampleRate       = readUint32(chunkData + 4);
+      bitsPerSample    = readUint16(chunkData + 14);
+      // The format of an extensible file is at the start of its sub format GUID
+      if (format == WaveFormatExtensible && chunkSize >= 40 && available >= 40) {
+        format = readUint16(chunkData + 24);
+      }
+      hasFormat = true;
+    }
+    else if (std::memcmp(chunk, "data", 4) == 0) {
+      if (!hasFormat) {
+        break;
+      }
+      if (format != WaveFormatPCM && format != WaveFormatIEEEFloat) {
+        BABYLON_LOGF_ERROR("AudioBuffer", "Unsupported WAVE format: %u.", format)
+        return nullptr;
+      }
+      // The size of a file being recorded may not be set yet
+      const auto byteLength = std::min(static_cast<size_t>(chunkSize), available);
+      return DecodePCM(chunkData, byteLength, numberOfChannels, sampleRate, bitsPerSample,
+                       format == WaveFormatIEEEFloat);
+    }
+    // Chunks are aligned on 2 bytes
+    offset += 8 + chunkSize + (chunkSize & 1);
+  }
+
+  BABYLON_LOG_ERROR("AudioBuffer", "The WAVE file has no format or data chunk.")
+  return nullptr;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,373 @@
+#include <babylon/audio/audio_engine.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <babylon/audio/analyser.h>
+#include <babylon/audio/audio_buffer.h>
+
+namespace BABYLON {
+
+namespace {
+
+// The kernels below are plain loops over contiguous arrays so that the compiler vectorizes them
+
+// output[i] += input[i] * (gain + gainStep * i)
+void mixRamped(const float* input, float* output, size_t frameCount, float gain, float gainStep)
+{
+  if (gainStep == 0.f) {
+    if (gain == 0.f) {
+      return;
+    }
+    for (size_t i = 0; i < frameCount; ++i) {
+      output[i] += input[i] * gain;
+    }
+    return;
+  }
+  for (size_t i = 0; i < frameCount; ++i) {
+    output[i] += input[i] * (gain + gainStep * static_cast<float>(i));
+  }
+}
+
+// Linear interpolation of the samples read from the position with a constant step, the read
+// index is clamped to lastIndex so that the next sample is always in the data
+void resample(const float* data, size_t lastIndex, double position, double step, float* output,
+              size_t frameCount)
+{
+  const auto base     = static_cast<size_t>(position);
+  const auto fraction = static_cast<float>(position - static_cast<double>(base));
+  if (step == 1.0 && fraction == 0.f) {
+    std::memcpy(output, data + base, frameCount * sizeof(float));
+    return;
+  }
+  const auto stepf = static_cast<float>(step);
+  for (size_t i = 0; i < frameCount; ++i) {
+    const auto offset = fraction + stepf * static_cast<float>(i);
+    const auto whole  = static_cast<size_t>(offset);
+    const auto index  = std::min(base + whole, lastIndex);
+    const auto weight = offset - static_cast<float>(whole);
+    output[i]         = data[index] + (data[index + 1] - data[index]) * weight;
+  }
+}
+
+// Consumes the start delay and the stop countdown of a voice over a block, returns the range of
+// frames of the block to play
+std::pair<size_t, size_t> playedFrames(AudioVoice& voice, size_t frameCount)
+{
+  const auto begin = std::min(voice.delayFrames, frameCount);
+  voice.delayFrames -= begin;
+  auto end = frameCount;
+  if (voice.stopFrames.has_value()) {
+    end = std::min(end, *voice.stopFrames);
+    *voice.stopFrames -= end;
+    if (*voice.stopFrames == 0) {
+      voice.ended = true;
+    }
+  }
+  return {begin, std::max(begin, end)};
+}
+
+} // end of anonymous namespace
+
+float AudioVoice::audibility() const
+{
+  return std::max(std::max(std::abs(gains[0]), std::abs(gains[1])),
+                  std::max(std::abs(gains[2]), std::abs(gains[3])));
+}
+
+AudioEngine::AudioEngine(size_t sampleRate)
+    : canUseWebAudio{true}
+    , isMP3supported{false}
+    , isOGGsupported{false}
+    , unlocked{true}
+    , maxVoices{32}
+    , _sampleRate{sampleRate}
+    , _masterGain{1.f}
+    , _currentMasterGain{1.f}
+    , _renderedFrames{0}
+    , _voicesDirty{false}
+    , _realVoiceCount{0}
+    , _virtualVoiceCount{0}
+    , _bus(NumberOfOutputChannels * BlockSize, 0.f)
+    , _resampled(2 * BlockSize, 0.f)
+    , _connectedAnalyser{nullptr}
+{
+}
+
+AudioEngine::~AudioEngine() = default;
+
+float AudioEngine::currentTime() const
+{
+  return static_cast<float>(static_cast<double>(_renderedFrames) / _sampleRate);
+}
+
+float AudioEngine::getGlobalVolume() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _masterGain;
+}
+
+void AudioEngine::setGlobalVolume(float newVolume)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _masterGain = newVolume;
+}
+
+size_t AudioEngine::realVoiceCount() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _realVoiceCount;
+}
+
+size_t AudioEngine::virtualVoiceCount() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _virtualVoiceCount;
+}
+
+std::unique_lock<std::mutex> AudioEngine::_lock()
+{
+  return std::unique_lock<std::mutex>(_mutex);
+}
+
+void AudioEngine::_addVoice(const AudioVoicePtr& voice)
+{
+  voice->ended = false;
+  _voices.emplace_back(voice);
+  _voicesDirty = true;
+}
+
+void AudioEngine::_removeVoice(const AudioVoicePtr& voice)
+{
+  auto it = std::find(_voices.begin(), _voices.end(), voice);
+  if (it != _voices.end()) {
+    _voices.erase(it);
+    _voicesDirty = true;
+  }
+}
+
+void AudioEngine::_markVoicesDirty()
+{
+  _voicesDirty = true;
+}
+
+void AudioEngine::connectToAnalyser(const AnalyserPtr& analyser)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _connectedAnalyser = analyser.get();
+}
+
+void AudioEngine::_disconnectAnalyser(Analyser* analyser)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_connectedAnalyser == analyser) {
+    _connectedAnalyser = nullptr;
+  }
+}
+
+void AudioEngine::dispose()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _connectedAnalyser = nullptr;
+  for (const auto& voice : _voices) {
+    voice->ended = true;
+  }
+  _voices.clear();
+  _sortedVoices.clear();
+}
+
+void AudioEngine::_updateVoices()
+{
+  _voicesDirty = false;
+
+  // Silent voices are virtual whatever the budget
+  if (_voices.size() <= maxVoices) {
+    for (const auto& voice : _voices) {
+      voice->isVirtual = voice->audibility() <= 0.f;
+    }
+    return;
+  }
+
+  // Only the voices in the budget need to be ordered
+  _sortedVoices.clear();
+  for (const auto& voice : _voices) {
+    _sortedVoices.emplace_back(voice.get());
+  }
+  const auto realEnd = _sortedVoices.begin() + static_cast<std::ptrdiff_t>(maxVoices);
+  std::nth_element(_sortedVoices.begin(), realEnd, _sortedVoices.end(),
+                   [](const AudioVoice* a, const AudioVoice* b) {
+                     if (a->priority != b->priority) {
+                       return a->priority > b->priority;
+                     }
+                     return a->audibility() > b->audibility();
+                   });
+  for (auto it = _sortedVoices.begin(); it != _sortedVoices.end(); ++it) {
+    (*it)->isVirtual = it >= realEnd || (*it)->audibility() <= 0.f;
+  }
+}
+
+void AudioEngine::_mixVoice(AudioVoice& voice, size_t frameCount)
+{
+  const auto& buffer = *voice.buffer;
+  const auto length  = buffer.length();
+  const auto stereo  = buffer.numberOfChannels() > 1;
+  const auto left    = buffer.getChannelData(0).data();
+  const auto right   = stereo ? buffer.getChannelData(1).data() : left;
+  const auto step   = static_cast<double>(voice.playbackRate) * buffer.sampleRate()
+                    / static_cast<double>(_sampleRate);
+
+  // The gains are ramped over the whole block to avoid clicks
+  std::array<float, 4> gainSteps{};
+  for (size_t i = 0; i < 4; ++i) {
+    gainSteps[i] = (voice.gains[i] - voice.currentGains[i]) / static_cast<float>(frameCount);
+  }
+
+  auto busLeft           = _bus.data();
+  auto busRight          = _bus.data() + BlockSize;
+  auto resampledLeft     = _resampled.data();
+  auto resampledRight    = _resampled.data() + BlockSize;
+  auto [frame, frameEnd] = playedFrames(voice, frameCount);
+  while (frame < frameEnd && step > 0.0) {
+    if (voice.position >= voice.end) {
+      if (!voice.loop || length == 0) {
+        voice.ended = true;
+        break;
+      }
+      voice.position = std::fmod(voice.position, static_cast<double>(length));
+    }
+    size_t count     = 0;
+    const auto limit = std::min(voice.end, static_cast<double>(length) - 1.0);
+    if (voice.position < limit) {
+      count = std::min(frameEnd - frame,
+                       static_cast<size_t>(std::ceil((limit - voice.position) / step)));
+      resample(left, length - 2, voice.position, step, resampledLeft, count);
+      if (stereo) {
+        resample(right, length - 2, voice.position, step, resampledRight, count);
+      }
+    }
+    else {
+      // The last frame is interpolated with the first one when looping
+      count             = 1;
+      const auto index  = static_cast<size_t>(voice.position);
+      const auto next   = voice.loop ? 0 : index;
+      const auto weight = static_cast<float>(voice.position - static_cast<double>(index));
+      resampledLeft[0]  = left[index] + (left[next] - left[index]) * weight;
+      resampledRight[0] = right[index] + (right[next] - right[index]) * weight;
+    }
+
+    const auto rampFrame = static_cast<float>(frame);
+    const auto& gains    = voice.currentGains;
+    if (stereo) {
+      mixRamped(resampledLeft, busLeft + frame, count, gains[0] + gainSteps[0] * rampFrame,
+                gainSteps[0]);
+      mixRamped(resampledLeft, busRight + frame, count, gains[1] + gainSteps[1] * rampFrame,
+                gainSteps[1]);
+      mixRamped(resampledRight, busLeft + frame, count, gains[2] + gainSteps[2] * rampFrame,
+                gainSteps[2]);
+      mixRamped(resampledRight, busRight + frame, count, gains[3] + gainSteps[3] * rampFrame,
+                gainSteps[3]);
+    }
+    else {
+      mixRamped(resampledLeft, busLeft + frame, count, gains[0] + gainSteps[0] * rampFrame,
+                gainSteps[0]);
+      mixRamped(resampledLeft, busRight + frame, count, gains[3] + gainSteps[3] * rampFrame,
+                gainSteps[3]);
+    }
+
+    voice.position += static_cast<double>(count) * step;
+    frame += count;
+  }
+  if (!voice.loop && voice.position >= voice.end) {
+    voice.ended = true;
+  }
+  voice.currentGains = voice.gains;
+}
+
+void AudioEngine::_advanceVoice(AudioVoice& voice, size_t frameCount)
+{
+  const auto& buffer = *voice.buffer;
+  const auto length  = buffer.length();
+  const auto step   = static_cast<double>(voice.playbackRate) * buffer.sampleRate()
+                    / static_cast<double>(_sampleRate);
+  const auto [frame, frameEnd] = playedFrames(voice, frameCount);
+  if (frameEnd > frame && step > 0.0) {
+    voice.position += static_cast<double>(frameEnd - frame) * step;
+    if (voice.position >= voice.end) {
+      if (voice.loop && length > 0) {
+        voice.position = std::fmod(voice.position, static_cast<double>(length));
+      }
+      else {
+        voice.ended = true;
+      }
+    }
+  }
+  // Fades in when the voice becomes real again
+  voice.currentGains.fill(0.f);
+}
+
+void AudioEngine::_renderBlock(size_t frameCount)
+{
+  if (_voicesDirty) {
+    _updateVoices();
+  }
+
+  std::fill(_bus.begin(), _bus.end(), 0.f);
+  _realVoiceCount    = 0;
+  _virtualVoiceCount = 0;
+  bool hasEndedVoice = false;
+  for (const auto& voice : _voices) {
+    if (voice->isVirtual) {
+      _advanceVoice(*voice, frameCount);
+      ++_virtualVoiceCount;
+    }
+    else {
+      _mixVoice(*voice, frameCount);
+      ++_realVoiceCount;
+    }
+    hasEndedVoice = hasEndedVoice || voice->ended;
+  }
+
+  if (hasEndedVoice) {
+    _voices.erase(std::remove_if(_voices.begin(), _voices.end(),
+                                 [](const AudioVoicePtr& voice) { return voice->ended.load(); }),
+                  _voices.end());
+    _voicesDirty = true;
+  }
+}
+
+void AudioEngine::render(float* output, size_t frameCount)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  const auto busLeft  = _bus.data();
+  const auto busRight = _bus.data() + BlockSize;
+  for (size_t offset = 0; offset < frameCount; offset += BlockSize) {
+    const auto blockFrameCount = std::min(BlockSize, frameCount - offset);
+    _renderBlock(blockFrameCount);
+
+    const auto gainStep
+      = (_masterGain - _currentMasterGain) / static_cast<float>(blockFrameCount);
+    auto blockOutput = output + offset * NumberOfOutputChannels;
+    for (size_t i = 0; i < blockFrameCount; ++i) {
+      const auto gain        = _currentMasterGain + gainStep * static_cast<float>(i);
+      blockOutput[2 * i]     = busLeft[i] * gain;
+      blockOutput[2 * i + 1] = busRight[i] * gain;
+    }
+    _currentMasterGain = _masterGain;
+    _renderedFrames += blockFrameCount;
+
+    // The analyser only copies the output, the analysis runs on its own thread
+    if (_connectedAnalyser) {
+      _connectedAnalyser->_write(blockOutput, blockFrameCount);
+    }
+  }
+}
+
+Float32Array AudioEngine::render(size_t frameCount)
+{
+  Float32Array output(frameCount * NumberOfOutputChannels);
+  render(output.data(), frameCount);
+  return output;
+}
+
+} // end of namespace BABYLON
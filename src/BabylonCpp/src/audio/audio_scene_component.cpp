@@ -1,14 +1,22 @@
 #include <babylon/audio/audio_scene_component.h>
 
+#include <babylon/audio/audio_engine.h>
 #include <babylon/audio/sound.h>
 #include <babylon/audio/sound_track.h>
+#include <babylon/babylon_stl_util.h>
+#include <babylon/cameras/camera.h>
+#include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/maths/axis.h>
 
 namespace BABYLON {
 
 AudioSceneComponent::AudioSceneComponent(Scene* iScene)
     : audioEnabled{this, &AudioSceneComponent::get_audioEnabled}
     , headphone{this, &AudioSceneComponent::get_headphone}
+    , _listenerPosition{Vector3::Zero()}
+    , _listenerForward{Axis::Z()}
+    , _listenerUp{Axis::Y()}
     , _audioEnabled{true}
     , _headphone{true}
 {
@@ -78,7 +86,10 @@ void AudioSceneComponent::dispose()
   if (!scene->soundTracks.empty()) {
     for (auto& soundTrack : scene->soundTracks) {
       soundTrack->dispose();
+      // The sound track may outlive the scene
+      soundTrack->_scene = nullptr;
     }
+    scene->soundTracks.clear();
   }
 }
 
@@ -146,6 +157,40 @@ void AudioSceneComponent::switchAudioModeForNormalSpeakers()
 
 void AudioSceneComponent::_afterRender()
 {
+  const auto& audioEngine = Engine::audioEngine;
+  if (!_audioEnabled || !audioEngine) {
+    return;
+  }
+
+  auto listeningCamera
+    = !scene->activeCameras.empty() ? scene->activeCameras[0] : scene->activeCamera();
+  if (listeningCamera) {
+    _listenerPosition.copyFrom(listeningCamera->globalPosition());
+    _listenerForward = listeningCamera->getDirection(Axis::Z());
+    _listenerUp      = listeningCamera->getDirection(Axis::Y());
+  }
+
+  _sounds.clear();
+  stl_util::concat(_sounds, scene->mainSoundTrack()->soundCollection);
+  for (const auto& soundTrack : scene->soundTracks) {
+    stl_util::concat(_sounds, soundTrack->soundCollection);
+  }
+
+  // Updates the distance attenuation, the cones and the panning of all the voices at once
+  {
+    auto lock = audioEngine->_lock();
+    for (const auto& sound : _sounds) {
+      if (sound->isPlaying) {
+        sound->_updateVoice(_listenerPosition, _listenerForward, _listenerUp);
+      }
+    }
+  }
+
+  // The observers of the end of a sound may play sounds again, the engine must be unlocked
+  for (const auto& sound : _sounds) {
+    sound->_checkEnded();
+  }
+  _sounds.clear();
 }
 
 } // end of namespace BABYLON
@@ -0,0 +1,590 @@
+#include <babylon/audio/sound.h>
+
+#include <cmath>
+
+#include <babylon/audio/audio_buffer.h>
+#include <babylon/audio/audio_engine.h>
+#include <babylon/audio/audio_scene_component.h>
+#include <babylon/audio/sound_track.h>
+#include <babylon/babylon_constants.h>
+#include <babylon/core/array_buffer_view.h>
+#include <babylon/core/json_util.h>
+#include <babylon/core/logging.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/axis.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/misc/file_tools.h>
+#include <babylon/misc/string_tools.h>
+
+namespace BABYLON {
+
+Sound::Sound(const std::string& iName,
+             const std::optional<UrlOrArrayBufferOrAudioBuffer>& urlOrArrayBuffer, Scene* scene,
+             const std::function<void()>& readyToPlayCallback, const ISoundOptions& options)
+    : name{iName}
+    , autoplay{options.autoplay.value_or(false)}
+    , loop{options.loop.value_or(false)}
+    , soundTrackId{-1}
+    , isPlaying{false}
+    , isPaused{false}
+    , spatialSound{options.spatialSound.value_or(false)}
+    , refDistance{options.refDistance.value_or(1.f)}
+    , rolloffFactor{options.rolloffFactor.value_or(1.f)}
+    , maxDistance{options.maxDistance.value_or(100.f)}
+    , distanceModel{options.distanceModel.value_or("linear")}
+    , priority{options.priority.value_or(0)}
+    , directionalConeInnerAngle{this, &Sound::get_directionalConeInnerAngle,
+                                &Sound::set_directionalConeInnerAngle}
+    , directionalConeOuterAngle{this, &Sound::get_directionalConeOuterAngle,
+                                &Sound::set_directionalConeOuterAngle}
+    , _soundTrack{nullptr}
+    , _scene{scene}
+    , _audioEngine{Engine::audioEngine}
+    , _audioBuffer{nullptr}
+    , _voice{nullptr}
+    , _readyToPlayCallback{readyToPlayCallback}
+    , _isReadyToPlay{false}
+    , _volume{options.volume.value_or(1.f)}
+    , _playbackRate{options.playbackRate.value_or(1.f)}
+    , _offset{options.offset}
+    , _length{options.length}
+    , _position{Vector3::Zero()}
+    , _localDirection{Vector3(1.f, 0.f, 0.f)}
+    , _isDirectional{false}
+    , _coneInnerAngle{360.f}
+    , _coneOuterAngle{360.f}
+    , _coneOuterGain{0.f}
+    , _panningModel{"equalpower"}
+{
+  if (!_audioEngine || !_audioEngine->canUseWebAudio || !urlOrArrayBuffer.has_value()) {
+    return;
+  }
+
+  if (std::holds_alternative<std::string>(*urlOrArrayBuffer)) {
+    const auto& url = std::get<std::string>(*urlOrArrayBuffer);
+    if (StringTools::endsWith(StringTools::toLowerCase(url), ".wav")) {
+      // The file is loaded once the sound is referenced by a shared pointer
+      _url = url;
+    }
+    else {
+      BABYLON_LOGF_ERROR("Sound", "Only WAV files are supported, cannot load: %s", url.c_str())
+    }
+  }
+  else if (std::holds_alternative<ArrayBuffer>(*urlOrArrayBuffer)) {
+    const auto& arrayBuffer = std::get<ArrayBuffer>(*urlOrArrayBuffer);
+    if (!arrayBuffer.empty()) {
+      _soundLoaded(arrayBuffer);
+    }
+  }
+  else if (std::holds_alternative<AudioBufferPtr>(*urlOrArrayBuffer)) {
+    setAudioBuffer(std::get<AudioBufferPtr>(*urlOrArrayBuffer));
+  }
+}
+
+Sound::~Sound() = default;
+
+void Sound::_initialize()
+{
+  if (_scene) {
+    _scene->mainSoundTrack()->AddSound(shared_from_this());
+  }
+
+  if (!_url.empty()) {
+    std::weak_ptr<Sound> weakSound = shared_from_this();
+    FileTools::LoadFile(
+      _url,
+      [weakSound](const std::variant<std::string, ArrayBufferView>& data,
+                  const std::string& /*responseURL*/) {
+        auto sound = weakSound.lock();
+        if (sound && std::holds_alternative<ArrayBufferView>(data)) {
+          sound->_soundLoaded(std::get<ArrayBufferView>(data).uint8Array());
+        }
+      },
+      nullptr, true,
+      [url = _url](const std::string& message, const std::string& /*exception*/) {
+        BABYLON_LOGF_ERROR("Sound", "Error while trying to load sound: %s, %s", url.c_str(),
+                           message.c_str())
+      });
+  }
+}
+
+void Sound::dispose()
+{
+  // The sound track may hold the last reference to the sound
+  auto self = shared_from_this();
+  if (isPlaying) {
+    stop();
+  }
+  _isReadyToPlay = false;
+
+  if (_soundTrack) {
+    _soundTrack->RemoveSound(self);
+  }
+
+  if (_voice && _audioEngine) {
+    auto lock = _audioEngine->_lock();
+    _audioEngine->_removeVoice(_voice);
+  }
+  _voice       = nullptr;
+  _audioBuffer = nullptr;
+  _connectedTransformNode.reset();
+}
+
+bool Sound::isReady() const
+{
+  return _isReadyToPlay;
+}
+
+void Sound::_soundLoaded(const ArrayBuffer& audioData)
+{
+  auto audioBuffer = AudioBuffer::DecodeWav(audioData);
+  if (!audioBuffer) {
+    BABYLON_LOGF_ERROR("Sound", "Error while decoding audio data for: %s", name.c_str())
+    return;
+  }
+  _audioBuffer   = audioBuffer;
+  _isReadyToPlay = true;
+  if (autoplay) {
+    play(0.f, _offset, _length);
+  }
+  if (_readyToPlayCallback) {
+    _readyToPlayCallback();
+  }
+}
+
+void Sound::setAudioBuffer(const AudioBufferPtr& audioBuffer)
+{
+  if (!_audioEngine || !audioBuffer) {
+    return;
+  }
+  _audioBuffer   = audioBuffer;
+  _isReadyToPlay = true;
+}
+
+void Sound::updateOptions(const ISoundOptions& options)
+{
+  loop          = options.loop.value_or(loop);
+  maxDistance   = options.maxDistance.value_or(maxDistance);
+  rolloffFactor = options.rolloffFactor.value_or(rolloffFactor);
+  refDistance   = options.refDistance.value_or(refDistance);
+  distanceModel = options.distanceModel.value_or(distanceModel);
+  priority      = options.priority.value_or(priority);
+  _playbackRate = options.playbackRate.value_or(_playbackRate);
+  _length       = options.length;
+  _offset       = options.offset;
+  _updateGains();
+}
+
+void Sound::switchPanningModelToHRTF()
+{
+  _panningModel = "HRTF";
+}
+
+void Sound::switchPanningModelToEqualPower()
+{
+  _panningModel = "equalpower";
+}
+
+void Sound::setDirectionalCone(float coneInnerAngle, float coneOuterAngle, float coneOuterGain)
+{
+  if (coneOuterAngle < coneInnerAngle) {
+    BABYLON_LOG_ERROR("Sound",
+                      "setDirectionalCone(): outer angle of the cone must be superior or equal "
+                      "to the inner angle.")
+    return;
+  }
+  _coneInnerAngle = coneInnerAngle;
+  _coneOuterAngle = coneOuterAngle;
+  _coneOuterGain  = coneOuterGain;
+  _isDirectional  = true;
+  _updateGains();
+}
+
+float Sound::get_directionalConeInnerAngle() const
+{
+  return _coneInnerAngle;
+}
+
+void Sound::set_directionalConeInnerAngle(float value)
+{
+  if (value != _coneInnerAngle) {
+    if (_coneOuterAngle < value) {
+      BABYLON_LOG_ERROR("Sound",
+                        "directionalConeInnerAngle: outer angle of the cone must be superior or "
+                        "equal to the inner angle.")
+      return;
+    }
+    _coneInnerAngle = value;
+    _updateGains();
+  }
+}
+
+float Sound::get_directionalConeOuterAngle() const
+{
+  return _coneOuterAngle;
+}
+
+void Sound::set_directionalConeOuterAngle(float value)
+{
+  if (value != _coneOuterAngle) {
+    if (value < _coneInnerAngle) {
+      BABYLON_LOG_ERROR("Sound",
+                        "directionalConeOuterAngle: outer angle of the cone must be superior or "
+                        "equal to the inner angle.")
+      return;
+    }
+    _coneOuterAngle = value;
+    _updateGains();
+  }
+}
+
+void Sound::setPosition(const Vector3& newPosition)
+{
+  _position.copyFrom(newPosition);
+  _updateGains();
+}
+
+void Sound::setLocalDirectionToMesh(const Vector3& newLocalDirection)
+{
+  _localDirection.copyFrom(newLocalDirection);
+  _updateGains();
+}
+
+void Sound::play(const std::optional<float>& time, const std::optional<float>& offset,
+                 const std::optional<float>& length)
+{
+  if (!_isReadyToPlay || !_audioBuffer || !_audioEngine) {
+    return;
+  }
+  if (_scene) {
+    const auto& audioEnabled = _scene->audioEnabled();
+    if (audioEnabled.has_value() && !*audioEnabled) {
+      return;
+    }
+  }
+
+  const auto sampleRate  = static_cast<double>(_audioBuffer->sampleRate());
+  const auto frameCount  = static_cast<double>(_audioBuffer->length());
+  const auto startOffset = std::max(0.0, static_cast<double>(offset.value_or(0.f)) * sampleRate);
+
+  auto voice    = std::make_shared<AudioVoice>();
+  voice->buffer = _audioBuffer;
+  if (isPaused && _voice) {
+    // Resumes from where the sound was paused
+    voice->position = _voice->position;
+    voice->end      = _voice->end;
+  }
+  else {
+    voice->position = std::min(startOffset, frameCount);
+    voice->end      = frameCount;
+    if (!loop && length.has_value()) {
+      voice->end
+        = std::min(frameCount, startOffset + static_cast<double>(*length) * sampleRate);
+    }
+  }
+  if (time.has_value() && *time > 0.f) {
+    voice->delayFrames = static_cast<size_t>(std::lround(*time * _audioEngine->sampleRate()));
+  }
+
+  {
+    auto lock = _audioEngine->_lock();
+    if (_voice) {
+      _audioEngine->_removeVoice(_voice);
+    }
+    _voice = voice;
+    _updateVoiceFromListener();
+    // The voice starts without fading in
+    _voice->currentGains = _voice->gains;
+    _audioEngine->_addVoice(_voice);
+  }
+
+  isPlaying = true;
+  isPaused  = false;
+}
+
+void Sound::stop(const std::optional<float>& time)
+{
+  if (!isPlaying) {
+    return;
+  }
+
+  if (_voice && _audioEngine) {
+    auto lock = _audioEngine->_lock();
+    if (time.has_value() && *time > 0.f) {
+      // The mixer ends the voice, without notifying the end of the sound
+      _voice->stopFrames = static_cast<size_t>(std::lround(*time * _audioEngine->sampleRate()));
+    }
+    else {
+      _audioEngine->_removeVoice(_voice);
+    }
+  }
+  isPlaying = false;
+}
+
+void Sound::pause()
+{
+  if (!isPlaying) {
+    return;
+  }
+
+  isPaused = true;
+  if (_voice && _audioEngine) {
+    auto lock = _audioEngine->_lock();
+    _audioEngine->_removeVoice(_voice);
+  }
+  isPlaying = false;
+}
+
+void Sound::setVolume(float newVolume)
+{
+  _volume = newVolume;
+  _updateGains();
+}
+
+void Sound::setPlaybackRate(float newPlaybackRate)
+{
+  _playbackRate = newPlaybackRate;
+  _updateGains();
+}
+
+float Sound::getVolume() const
+{
+  return _volume;
+}
+
+void Sound::attachToMesh(const TransformNodePtr& transformNode)
+{
+  _connectedTransformNode = transformNode;
+  spatialSound            = true;
+  _updateGains();
+}
+
+void Sound::detachFromMesh()
+{
+  _connectedTransformNode.reset();
+}
+
+AudioBufferPtr Sound::getAudioBuffer() const
+{
+  return _audioBuffer;
+}
+
+float Sound::currentTime() const
+{
+  if (!_voice || !_audioEngine) {
+    return 0.f;
+  }
+  auto lock = _audioEngine->_lock();
+  return static_cast<float>(_voice->position / static_cast<double>(_voice->buffer->sampleRate()));
+}
+
+void Sound::_checkEnded()
+{
+  if (_voice && isPlaying && _voice->ended) {
+    _onended();
+  }
+}
+
+void Sound::_onended()
+{
+  isPlaying = false;
+  onEndedObservable.notifyObservers(this);
+}
+
+void Sound::_updateGains()
+{
+  if (!_voice || !_audioEngine) {
+    return;
+  }
+  auto lock = _audioEngine->_lock();
+  _updateVoiceFromListener();
+}
+
+void Sound::_updateVoiceFromListener()
+{
+  auto component = _scene ? std::static_pointer_cast<AudioSceneComponent>(
+                              _scene->_getComponent(SceneComponentConstants::NAME_AUDIO)) :
+                            nullptr;
+  if (component) {
+    _updateVoice(component->_listenerPosition, component->_listenerForward,
+                 component->_listenerUp);
+  }
+  else {
+    _updateVoice(Vector3::Zero(), Axis::Z(), Axis::Y());
+  }
+}
+
+float Sound::_distanceGain(float distance) const
+{
+  if (distanceModel == "inverse") {
+    const auto denominator
+      = refDistance + rolloffFactor * (std::max(distance, refDistance) - refDistance);
+    return denominator > 0.f ? refDistance / denominator : 1.f;
+  }
+  if (distanceModel == "exponential") {
+    if (refDistance <= 0.f) {
+      return 1.f;
+    }
+    return std::pow(std::max(distance, refDistance) / refDistance, -rolloffFactor);
+  }
+  // Linear model
+  if (maxDistance <= refDistance) {
+    return distance <= refDistance ? 1.f : std::max(0.f, 1.f - rolloffFactor);
+  }
+  const auto clampedDistance = std::clamp(distance, refDistance, maxDistance);
+  return std::max(
+    0.f, 1.f - rolloffFactor * (clampedDistance - refDistance) / (maxDistance - refDistance));
+}
+
+float Sound::_coneGain(const Vector3& position, const Vector3& listenerPosition) const
+{
+  if (!_isDirectional || (_coneInnerAngle >= 360.f && _coneOuterAngle >= 360.f)) {
+    return 1.f;
+  }
+
+  auto node      = _connectedTransformNode.lock();
+  auto direction = node ? Vector3::TransformNormal(_localDirection, node->getWorldMatrix()) :
+                          _localDirection;
+  auto toListener = listenerPosition.subtract(position);
+  if (direction.lengthSquared() == 0.f || toListener.lengthSquared() == 0.f) {
+    return 1.f;
+  }
+  direction.normalize();
+  toListener.normalize();
+  const auto angle
+    = std::acos(std::clamp(Vector3::Dot(direction, toListener), -1.f, 1.f)) * 180.f / Math::PI;
+  const auto innerHalfAngle = _coneInnerAngle / 2.f;
+  const auto outerHalfAngle = _coneOuterAngle / 2.f;
+  if (angle <= innerHalfAngle) {
+    return 1.f;
+  }
+  if (angle >= outerHalfAngle) {
+    return _coneOuterGain;
+  }
+  const auto x = (angle - innerHalfAngle) / (outerHalfAngle - innerHalfAngle);
+  return 1.f + (_coneOuterGain - 1.f) * x;
+}
+
+void Sound::_updateVoice(const Vector3& listenerPosition, const Vector3& listenerForward,
+                         const Vector3& listenerUp)
+{
+  if (!_voice) {
+    return;
+  }
+
+  _voice->loop         = loop;
+  _voice->playbackRate = _playbackRate;
+  _voice->priority     = priority;
+  const auto gain      = _volume * (_soundTrack ? _soundTrack->getVolume() : 1.f);
+  if (!spatialSound) {
+    _voice->gains = {{gain, 0.f, 0.f, gain}};
+    _audioEngine->_markVoicesDirty();
+    return;
+  }
+
+  auto node           = _connectedTransformNode.lock();
+  const auto position = node ? node->getAbsolutePosition() : _position;
+  const auto toSource = position.subtract(listenerPosition);
+  const auto distance = toSource.length();
+  const auto spatialGain
+    = gain * _distanceGain(distance) * _coneGain(position, listenerPosition);
+
+  // Equal power panning from the azimuth of the source around the listener, the sources behind
+  // the listener are panned as if they were in front of it
+  auto azimuth = 0.f;
+  if (distance > 0.f) {
+    const auto right = Vector3::Cross(listenerUp, listenerForward);
+    azimuth = std::atan2(Vector3::Dot(toSource, right), Vector3::Dot(toSource, listenerForward));
+  }
+  if (azimuth > Math::PI_2) {
+    azimuth = Math::PI - azimuth;
+  }
+  else if (azimuth < -Math::PI_2) {
+    azimuth = -Math::PI - azimuth;
+  }
+
+  if (_audioBuffer && _audioBuffer->numberOfChannels() > 1) {
+    // A stereo source keeps the channel on the side of the source and pans the other one
+    if (azimuth <= 0.f) {
+      const auto angle = azimuth + Math::PI_2;
+      _voice->gains
+        = {{spatialGain, 0.f, spatialGain * std::cos(angle), spatialGain * std::sin(angle)}};
+    }
+    else {
+      const auto angle = azimuth;
+      _voice->gains
+        = {{spatialGain * std::cos(angle), spatialGain * std::sin(angle), 0.f, spatialGain}};
+    }
+  }
+  else {
+    const auto angle = (azimuth + Math::PI_2) / 2.f;
+    _voice->gains    = {{spatialGain * std::cos(angle), 0.f, 0.f, spatialGain * std::sin(angle)}};
+  }
+  _audioEngine->_markVoicesDirty();
+}
+
+SoundPtr Sound::Parse(const json& parsedSound, Scene* scene, const std::string& rootUrl,
+                      const SoundPtr& sourceSound)
+{
+  const auto soundName = json_util::get_string(parsedSound, "name");
+  std::string soundUrl;
+  if (json_util::has_valid_key_value(parsedSound, "url")) {
+    soundUrl = rootUrl + json_util::get_string(parsedSound, "url");
+  }
+  else {
+    soundUrl = rootUrl + soundName;
+  }
+
+  ISoundOptions options;
+  options.autoplay      = json_util::get_bool(parsedSound, "autoplay");
+  options.loop          = json_util::get_bool(parsedSound, "loop");
+  options.volume        = json_util::get_number<float>(parsedSound, "volume", 1.f);
+  options.spatialSound  = json_util::get_bool(parsedSound, "spatialSound");
+  options.maxDistance   = json_util::get_number<float>(parsedSound, "maxDistance", 100.f);
+  options.rolloffFactor = json_util::get_number<float>(parsedSound, "rolloffFactor", 1.f);
+  options.refDistance   = json_util::get_number<float>(parsedSound, "refDistance", 1.f);
+  options.distanceModel = json_util::get_string(parsedSound, "distanceModel", "linear");
+  options.playbackRate  = json_util::get_number<float>(parsedSound, "playbackRate", 1.f);
+
+  SoundPtr newSound = nullptr;
+  if (!sourceSound || !sourceSound->isReady()) {
+    newSound = Sound::New(soundName, soundUrl, scene, nullptr, options);
+  }
+  else {
+    // Shares the already decoded data of the source sound
+    newSound = Sound::New(soundName, sourceSound->getAudioBuffer(), scene, nullptr, options);
+    if (newSound->autoplay) {
+      newSound->play(0.f, newSound->_offset, newSound->_length);
+    }
+  }
+
+  if (json_util::has_valid_key_value(parsedSound, "position")) {
+    const auto soundPosition
+      = Vector3::FromArray(json_util::get_array<float>(parsedSound, "position"));
+    newSound->setPosition(soundPosition);
+  }
+
+  if (json_util::get_bool(parsedSound, "isDirectional")) {
+    newSound->setDirectionalCone(json_util::get_number<float>(parsedSound, "coneInnerAngle", 360.f),
+                                 json_util::get_number<float>(parsedSound, "coneOuterAngle", 360.f),
+                                 json_util::get_number<float>(parsedSound, "coneOuterGain", 0.f));
+    if (json_util::has_valid_key_value(parsedSound, "localDirectionToMesh")) {
+      const auto localDirectionToMesh
+        = Vector3::FromArray(json_util::get_array<float>(parsedSound, "localDirectionToMesh"));
+      newSound->setLocalDirectionToMesh(localDirectionToMesh);
+    }
+  }
+
+  if (json_util::has_valid_key_value(parsedSound, "connectedMeshId")) {
+    auto connectedMesh
+      = scene->getMeshByID(json_util::get_string(parsedSound, "connectedMeshId"));
+    if (connectedMesh) {
+      newSound->attachToMesh(connectedMesh);
+    }
+  }
+
+  return newSound;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,84 @@
+#include <babylon/audio/sound_track.h>
+
+#include <babylon/audio/sound.h>
+#include <babylon/babylon_stl_util.h>
+#include <babylon/engines/scene.h>
+
+namespace BABYLON {
+
+SoundTrack::SoundTrack(Scene* scene, const ISoundTrackOptions& options)
+    : id{-1}
+    , _scene{scene}
+    , _mainTrack{options.mainTrack.value_or(false)}
+    , _volume{options.volume.value_or(1.f)}
+{
+  if (!_mainTrack && _scene) {
+    _scene->soundTracks.emplace_back(this);
+    id = static_cast<int>(_scene->soundTracks.size()) - 1;
+  }
+}
+
+SoundTrack::~SoundTrack()
+{
+  if (!_mainTrack && _scene) {
+    stl_util::remove_vector_elements_equal(_scene->soundTracks, this);
+  }
+}
+
+void SoundTrack::dispose()
+{
+  // Disposing a sound removes it from the collection
+  const auto sounds = soundCollection;
+  for (const auto& sound : sounds) {
+    sound->dispose();
+  }
+  soundCollection.clear();
+}
+
+void SoundTrack::AddSound(const SoundPtr& sound)
+{
+  if (sound->_soundTrack) {
+    sound->_soundTrack->RemoveSound(sound);
+  }
+  soundCollection.emplace_back(sound);
+  sound->soundTrackId = id;
+  sound->_soundTrack  = this;
+  sound->_updateGains();
+}
+
+void SoundTrack::RemoveSound(const SoundPtr& sound)
+{
+  stl_util::remove_vector_elements_equal(soundCollection, sound);
+  if (sound->_soundTrack == this) {
+    sound->_soundTrack = nullptr;
+  }
+}
+
+void SoundTrack::setVolume(float newVolume)
+{
+  _volume = newVolume;
+  for (const auto& sound : soundCollection) {
+    sound->_updateGains();
+  }
+}
+
+float SoundTrack::getVolume() const
+{
+  return _volume;
+}
+
+void SoundTrack::switchPanningModelToHRTF()
+{
+  for (const auto& sound : soundCollection) {
+    sound->switchPanningModelToHRTF();
+  }
+}
+
+void SoundTrack::switchPanningModelToEqualPower()
+{
+  for (const auto& sound : soundCollection) {
+    sound->switchPanningModelToEqualPower();
+  }
+}
+
+} // end of namespace BABYLON
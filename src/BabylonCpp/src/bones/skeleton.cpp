@@ -27,6 +27,7 @@ Skeleton::Skeleton(const std::string& iName, const std::string& iId, Scene* scen
                                     &Skeleton::set_useTextureToStoreBoneMatrices}
     , isUsingTextureForMatrices{this, &Skeleton::get_isUsingTextureForMatrices}
     , uniqueId{this, &Skeleton::get_uniqueId}
+    , _transformMatricesMemory{MemoryCategory::SkeletonMatrices}
     , _isDirty{true}
     , _transformMatrixTexture{nullptr}
     , _identity{Matrix::Identity()}
@@ -57,7 +58,7 @@ Type Skeleton::type() const
 
 void Skeleton::addToScene(const SkeletonPtr& newSkeleton)
 {
-  _scene->skeletons.emplace_back(newSkeleton);
+  _scene->addSkeleton(newSkeleton);
 }
 
 std::string Skeleton::getClassName() const
@@ -460,6 +461,7 @@ void Skeleton::prepare()
   else {
     if (_transformMatrices.size() != 16 * (bones.size() + 1)) {
       _transformMatrices.resize(16 * (bones.size() + 1));
+      _transformMatricesMemory.set(_transformMatrices.size() * sizeof(float));
 
       if (isUsingTextureForMatrices) {
         if (_transformMatrixTexture) {
@@ -502,10 +504,41 @@ std::vector<AnimationPtr> Skeleton::getAnimations()
   return std::vector<AnimationPtr>();
 }
 
-std::unique_ptr<Skeleton> Skeleton::clone(const std::string& /*iName*/,
-                                          const std::string& /*iId*/) const
+SkeletonPtr Skeleton::clone(const std::string& iName, const std::string& iId) const
 {
-  return nullptr;
+  auto result = Skeleton::New(iName, iId.empty() ? iName : iId, _scene);
+
+  result->needInitialSkinMatrix = needInitialSkinMatrix;
+  result->overrideMesh          = overrideMesh;
+
+  for (const auto& source : bones) {
+    Bone* parentBone = nullptr;
+    if (auto parent = source->getParent()) {
+      auto it = std::find_if(bones.begin(), bones.end(),
+                             [parent](const BonePtr& bone) { return bone.get() == parent; });
+      if (it != bones.end()) {
+        parentBone = result->bones[static_cast<size_t>(it - bones.begin())].get();
+      }
+    }
+
+    auto bone = Bone::New(source->name, result.get(), parentBone, source->getBaseMatrix(),
+                          source->getRestPose(), std::nullopt, source->_index);
+    if (source->_linkedTransformNode) {
+      bone->linkTransformNode(source->_linkedTransformNode);
+    }
+
+    for (const auto& animation : source->animations) {
+      bone->animations.emplace_back(animation->clone());
+    }
+  }
+
+  for (const auto& [rangeName, range] : _ranges) {
+    if (range) {
+      result->_ranges[rangeName] = std::make_shared<AnimationRange>(range->clone());
+    }
+  }
+
+  return result;
 }
 
 void Skeleton::enableBlending(float blendingSpeed)
@@ -532,6 +565,8 @@ void Skeleton::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*
     _transformMatrixTexture->dispose();
     _transformMatrixTexture = nullptr;
   }
+
+  _transformMatricesMemory.release();
 }
 
 json Skeleton::serialize() const
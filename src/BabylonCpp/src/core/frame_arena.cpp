@@ -0,0 +1,105 @@
+#include <babylon/core/frame_arena.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace BABYLON {
+
+FrameArena::FrameArena(size_t blockSize)
+    : _blockSize{std::max(blockSize, static_cast<size_t>(1024))}
+    , _blockIndex{0}
+    , _offset{0}
+    , _openScopeCount{0}
+{
+}
+
+FrameArena::~FrameArena() = default;
+
+void* FrameArena::allocate(size_t size, size_t alignment)
+{
+  size = std::max(size, static_cast<size_t>(1));
+
+  // Try to fit the allocation in the current block or in one of the blocks that were released by
+  // the last reset / rewind
+  while (_blockIndex < _blocks.size()) {
+    auto& block          = _blocks[_blockIndex];
+    const auto base      = reinterpret_cast<std::uintptr_t>(block.data.get());
+    const auto aligned   = (base + _offset + alignment - 1) & ~(alignment - 1);
+    const auto newOffset = aligned - base + size;
+    if (newOffset <= block.size) {
+      _offset = newOffset;
+      return reinterpret_cast<void*>(aligned);
+    }
+    ++_blockIndex;
+    _offset = 0;
+  }
+
+  // Grow the arena
+  Block block;
+  block.size = std::max(_blockSize, size + alignment);
+  block.data = std::make_unique<std::byte[]>(block.size);
+  _blocks.emplace_back(std::move(block));
+  _blockIndex = _blocks.size() - 1;
+  _offset     = 0;
+
+  return allocate(size, alignment);
+}
+
+FrameArena::Marker FrameArena::mark() const
+{
+  return {_blockIndex, _offset};
+}
+
+void FrameArena::rewind(const Marker& marker)
+{
+  _blockIndex = marker.blockIndex;
+  _offset     = marker.offset;
+}
+
+void FrameArena::reset()
+{
+  // A reset from within a scope (e.g. a frame started while sorting) would free or overwrite the
+  // memory the scope still uses, the scopes release their memory when they close
+  if (_openScopeCount > 0) {
+    return;
+  }
+
+  // Merge the blocks when the previous frame did not fit in a single one, so that the next frames
+  // allocate from contiguous memory
+  if (_blocks.size() > 1) {
+    const auto totalSize = capacity();
+    _blocks.clear();
+    Block block;
+    block.size = totalSize;
+    block.data = std::make_unique<std::byte[]>(block.size);
+    _blocks.emplace_back(std::move(block));
+  }
+
+  _blockIndex = 0;
+  _offset     = 0;
+}
+
+size_t FrameArena::bytesUsed() const
+{
+  size_t used = _offset;
+  for (size_t i = 0; i < _blockIndex && i < _blocks.size(); ++i) {
+    used += _blocks[i].size;
+  }
+  return used;
+}
+
+size_t FrameArena::capacity() const
+{
+  size_t total = 0;
+  for (const auto& block : _blocks) {
+    total += block.size;
+  }
+  return total;
+}
+
+size_t FrameArena::blockCount() const
+{
+  return _blocks.size();
+}
+
+} // end of namespace BABYLON
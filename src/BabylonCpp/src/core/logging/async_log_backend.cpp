@@ -0,0 +1,140 @@
+#include <babylon/core/logging/async_log_backend.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace BABYLON {
+
+namespace {
+
+size_t nextPowerOfTwo(size_t value)
+{
+  size_t powerOfTwo = 2;
+  while (powerOfTwo < value) {
+    powerOfTwo <<= 1;
+  }
+  return powerOfTwo;
+}
+
+} // end of anonymous namespace
+
+AsyncLogBackend::AsyncLogBackend(const SinkFunction& sink, size_t iCapacity)
+    : _sink{sink}
+    , _mask{nextPowerOfTwo(iCapacity) - 1}
+    , _slots{std::make_unique<Slot[]>(_mask + 1)}
+    , _enqueuePos{0}
+    , _dequeuePos{0}
+    , _dispatchedCount{0}
+    , _droppedCount{0}
+    , _running{true}
+    , _sinkSleeping{false}
+{
+  for (size_t i = 0; i <= _mask; ++i) {
+    _slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  _sinkThread = std::thread(&AsyncLogBackend::run, this);
+}
+
+AsyncLogBackend::~AsyncLogBackend()
+{
+  stop();
+}
+
+bool AsyncLogBackend::tryPush(LogMessage&& msg)
+{
+  Slot* slot = nullptr;
+  auto pos   = _enqueuePos.load(std::memory_order_relaxed);
+  for (;;) {
+    slot      = &_slots[pos & _mask];
+    auto seq  = slot->sequence.load(std::memory_order_acquire);
+    auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+    if (diff == 0) {
+      if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    }
+    else if (diff < 0) {
+      // Ring buffer is full
+      _droppedCount.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    else {
+      pos = _enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+
+  slot->message = std::move(msg);
+  slot->sequence.store(pos + 1, std::memory_order_release);
+
+  if (_sinkSleeping.load(std::memory_order_relaxed)) {
+    _sleepCondition.notify_one();
+  }
+  return true;
+}
+
+bool AsyncLogBackend::tryPop(LogMessage& msg)
+{
+  auto& slot = _slots[_dequeuePos & _mask];
+  auto seq   = slot.sequence.load(std::memory_order_acquire);
+  if (seq != _dequeuePos + 1) {
+    return false;
+  }
+  msg = std::move(slot.message);
+  slot.sequence.store(_dequeuePos + _mask + 1, std::memory_order_release);
+  ++_dequeuePos;
+  return true;
+}
+
+void AsyncLogBackend::run()
+{
+  LogMessage msg;
+  for (;;) {
+    if (tryPop(msg)) {
+      _sink(msg);
+      _dispatchedCount.fetch_add(1, std::memory_order_release);
+      continue;
+    }
+    if (!_running.load(std::memory_order_acquire)
+        && _dispatchedCount.load(std::memory_order_relaxed)
+             == _enqueuePos.load(std::memory_order_acquire)) {
+      break;
+    }
+    // Idle: sleep until a producer wakes us up. The timeout bounds the latency
+    // of a notification racing with the sleeping flag.
+    std::unique_lock<std::mutex> lock(_sleepMutex);
+    _sinkSleeping.store(true, std::memory_order_relaxed);
+    _sleepCondition.wait_for(lock, std::chrono::milliseconds(5));
+    _sinkSleeping.store(false, std::memory_order_relaxed);
+  }
+}
+
+void AsyncLogBackend::flush()
+{
+  const auto target = _enqueuePos.load(std::memory_order_acquire);
+  while (_dispatchedCount.load(std::memory_order_acquire) < target) {
+    _sleepCondition.notify_one();
+    std::this_thread::yield();
+  }
+}
+
+void AsyncLogBackend::stop()
+{
+  if (_running.exchange(false)) {
+    _sleepCondition.notify_one();
+    if (_sinkThread.joinable()) {
+      _sinkThread.join();
+    }
+  }
+}
+
+size_t AsyncLogBackend::capacity() const
+{
+  return _mask + 1;
+}
+
+size_t AsyncLogBackend::droppedMessageCount() const
+{
+  return _droppedCount.load(std::memory_order_relaxed);
+}
+
+} // end of namespace BABYLON
@@ -7,14 +7,13 @@
 namespace BABYLON {
 
 LogMessage::LogMessage(unsigned int level, const std::string& context)
-    : _level{level}, _context{context}
+    : _level{level}
+    , _timestamp{Time::systemTimepointNow()}
+    , _lineNumber{0}
+    , _threadIdRaw{std::this_thread::get_id()}
+    , _context{context}
+    , _prettyFunctionRaw{nullptr}
 {
-  // Set timestamp
-  _timestamp = Time::systemTimepointNow();
-  // Set thread id
-  std::ostringstream ss;
-  ss << std::hex << std::this_thread::get_id();
-  _threadId = ss.str();
 }
 
 LogMessage::LogMessage(const LogMessage& otherLogMessage)
@@ -22,9 +21,11 @@ LogMessage::LogMessage(const LogMessage& otherLogMessage)
     , _timestamp{otherLogMessage._timestamp}
     , _file{otherLogMessage._file}
     , _lineNumber{otherLogMessage._lineNumber}
-    , _threadId{otherLogMessage._threadId}
+    , _threadIdRaw{otherLogMessage._threadIdRaw}
     , _context{otherLogMessage._context}
     , _function{otherLogMessage._function}
+    , _prettyFunctionRaw{otherLogMessage._prettyFunctionRaw}
+    , _threadId{otherLogMessage._threadId}
     , _prettyFunction{otherLogMessage._prettyFunction}
 {
   _oss << otherLogMessage.message();
@@ -35,9 +36,12 @@ LogMessage::LogMessage(LogMessage&& otherLogMessage)
     , _timestamp{std::move(otherLogMessage._timestamp)}
     , _file{std::move(otherLogMessage._file)}
     , _lineNumber{std::move(otherLogMessage._lineNumber)}
-    , _threadId{std::move(otherLogMessage._threadId)}
+    , _threadIdRaw{std::move(otherLogMessage._threadIdRaw)}
     , _context{std::move(otherLogMessage._context)}
     , _function{std::move(otherLogMessage._function)}
+    , _prettyFunctionRaw{std::move(otherLogMessage._prettyFunctionRaw)}
+    , _oss{std::move(otherLogMessage._oss)}
+    , _threadId{std::move(otherLogMessage._threadId)}
     , _prettyFunction{std::move(otherLogMessage._prettyFunction)}
 {
 }
@@ -45,16 +49,19 @@ LogMessage::LogMessage(LogMessage&& otherLogMessage)
 LogMessage& LogMessage::operator=(const LogMessage& otherLogMessage)
 {
   if (&otherLogMessage != this) {
-    _level          = otherLogMessage._level;
-    _timestamp      = otherLogMessage._timestamp;
-    _file           = otherLogMessage._file;
-    _lineNumber     = otherLogMessage._lineNumber;
-    _threadId       = otherLogMessage._threadId;
-    _context        = otherLogMessage._context;
-    _function       = otherLogMessage._function;
-    _prettyFunction = otherLogMessage._prettyFunction;
+    _level             = otherLogMessage._level;
+    _timestamp         = otherLogMessage._timestamp;
+    _file              = otherLogMessage._file;
+    _lineNumber        = otherLogMessage._lineNumber;
+    _threadIdRaw       = otherLogMessage._threadIdRaw;
+    _context           = otherLogMessage._context;
+    _function          = otherLogMessage._function;
+    _prettyFunctionRaw = otherLogMessage._prettyFunctionRaw;
+    _threadId          = otherLogMessage._threadId;
+    _prettyFunction    = otherLogMessage._prettyFunction;
+    _oss.str(otherLogMessage._oss.str());
     _oss.clear();
-    _oss << otherLogMessage._oss.str();
+    _oss.seekp(0, std::ios_base::end);
   }
 
   return *this;
@@ -63,17 +70,17 @@ LogMessage& LogMessage::operator=(const LogMessage& otherLogMessage)
 LogMessage& LogMessage::operator=(LogMessage&& otherLogMessage)
 {
   if (&otherLogMessage != this) {
-    _level          = std::move(otherLogMessage._level);
-    _timestamp      = std::move(otherLogMessage._timestamp);
-    _file           = std::move(otherLogMessage._file);
-    _lineNumber     = std::move(otherLogMessage._lineNumber);
-    _threadId       = std::move(otherLogMessage._threadId);
-    _context        = std::move(otherLogMessage._context);
-    _function       = std::move(otherLogMessage._function);
-    _prettyFunction = std::move(otherLogMessage._prettyFunction);
-    _oss.clear();
-    _oss << otherLogMessage._oss.str();
-    otherLogMessage._oss.clear();
+    _level             = std::move(otherLogMessage._level);
+    _timestamp         = std::move(otherLogMessage._timestamp);
+    _file              = std::move(otherLogMessage._file);
+    _lineNumber        = std::move(otherLogMessage._lineNumber);
+    _threadIdRaw       = std::move(otherLogMessage._threadIdRaw);
+    _context           = std::move(otherLogMessage._context);
+    _function          = std::move(otherLogMessage._function);
+    _prettyFunctionRaw = std::move(otherLogMessage._prettyFunctionRaw);
+    _threadId          = std::move(otherLogMessage._threadId);
+    _prettyFunction    = std::move(otherLogMessage._prettyFunction);
+    _oss               = std::move(otherLogMessage._oss);
   }
 
   return *this;
@@ -150,6 +157,11 @@ void LogMessage::setLineNumber(int lineNumber)
 
 std::string const& LogMessage::threadId() const
 {
+  if (_threadId.empty()) {
+    std::ostringstream ss;
+    ss << std::hex << _threadIdRaw;
+    _threadId = ss.str();
+  }
   return _threadId;
 }
 
@@ -170,12 +182,18 @@ void LogMessage::setFunction(char const* func)
 
 std::string const& LogMessage::prettyFunction() const
 {
+  if (_prettyFunction.empty() && _prettyFunctionRaw) {
+    _prettyFunction = prettify(_prettyFunctionRaw);
+  }
   return _prettyFunction;
 }
 
 void LogMessage::setPrettyFunction(char const* prettyFunc)
 {
-  _prettyFunction = prettify(prettyFunc);
+  // prettyFunc is expected to be __PRETTY_FUNCTION__, i.e. a string with
+  // static storage duration, so the prettify step can be deferred
+  _prettyFunctionRaw = prettyFunc;
+  _prettyFunction.clear();
 }
 
 std::string LogMessage::message() const
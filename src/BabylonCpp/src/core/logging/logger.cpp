@@ -1,29 +1,43 @@
 #include <babylon/core/logging/logger.h>
 
+#include <babylon/core/logging/async_log_backend.h>
 #include <babylon/core/logging/log_message.h>
 #include <iostream>
+#include <thread>
 
 namespace BABYLON {
 
 LogMessageHandler::LogMessageHandler()
-    : _minLevel{LogLevels::LEVEL_QUIET}, _maxLevel{LogLevels::LEVEL_TRACE}
+    : _minLevel{LogLevels::LEVEL_QUIET}, _maxLevel{LogLevels::LEVEL_TRACE}, _levelMask{0}
 {
   for (unsigned int lvl = _minLevel; lvl <= _maxLevel; ++lvl) {
     _logMessageListeners[lvl] = std::vector<LogMessageListener*>();
   }
+#ifdef __EMSCRIPTEN__
+  // Every message is echoed on the console
+  _levelMask = ~0u;
+#endif
+}
+
+bool LogMessageHandler::takes(unsigned int level) const
+{
+  return (level <= _maxLevel) && ((_levelMask.load(std::memory_order_relaxed) >> level) & 1u);
 }
 
-bool LogMessageHandler::takes(unsigned int level)
+bool LogMessageHandler::isValidLevel(unsigned int level) const
 {
   return (level >= _minLevel) && (level <= _maxLevel);
 }
 
 void LogMessageHandler::handle(const LogMessage& msg)
 {
-  if (_logMessageListeners.find(msg.level())
-      != _logMessageListeners.end()) {
-    for (auto& logMsgListener : _logMessageListeners[msg.level()]) {
-      (*logMsgListener)(LogMessage(msg));
+  {
+    std::lock_guard<std::recursive_mutex> lock(_listenersMutex);
+    auto it = _logMessageListeners.find(msg.level());
+    if (it != _logMessageListeners.end()) {
+      for (auto& logMsgListener : it->second) {
+        (*logMsgListener)(msg);
+      }
     }
   }
 #ifdef __EMSCRIPTEN__
@@ -31,6 +45,21 @@ void LogMessageHandler::handle(const LogMessage& msg)
 #endif
 }
 
+void LogMessageHandler::updateLevelMask()
+{
+#ifdef __EMSCRIPTEN__
+  unsigned int levelMask = ~0u;
+#else
+  unsigned int levelMask = 0;
+  for (const auto& keyVal : _logMessageListeners) {
+    if (!keyVal.second.empty()) {
+      levelMask |= (1u << keyVal.first);
+    }
+  }
+#endif
+  _levelMask.store(levelMask, std::memory_order_relaxed);
+}
+
 //BABYLON::Logger& Logger::Instance()
 //{
 //  // Since it's a static variable, if the class has already been created,
@@ -54,12 +83,17 @@ Logger & LoggerInstance()
 }
 
 
-Logger::Logger() = default;
+Logger::Logger() : _activeAsyncBackend{nullptr}, _asyncProducerCount{0}
+{
+}
 
 Logger::~Logger()
 {
+  stopAsyncLogging();
   // Cleanly shutting down log message handler
+  std::lock_guard<std::recursive_mutex> lock(_impl._listenersMutex);
   _impl._logMessageListeners.clear();
+  _impl.updateLevelMask();
 }
 
 LogMessage Logger::CreateMessage(unsigned int level, std::string context,
@@ -76,17 +110,90 @@ LogMessage Logger::CreateMessage(unsigned int level, std::string context,
 
 void Logger::log(const LogMessage& msg)
 {
-  _impl.handle(msg);
+  _asyncProducerCount.fetch_add(1);
+  if (auto asyncBackend = _activeAsyncBackend.load()) {
+    asyncBackend->tryPush(LogMessage(msg));
+    _asyncProducerCount.fetch_sub(1, std::memory_order_release);
+  }
+  else {
+    _asyncProducerCount.fetch_sub(1, std::memory_order_release);
+    _impl.handle(msg);
+  }
+}
+
+void Logger::log(LogMessage&& msg)
+{
+  // The producer is counted before looking up the backend, so that
+  // stopAsyncLogging() either waits for the push or is seen by this thread
+  _asyncProducerCount.fetch_add(1);
+  if (auto asyncBackend = _activeAsyncBackend.load()) {
+    asyncBackend->tryPush(std::move(msg));
+    _asyncProducerCount.fetch_sub(1, std::memory_order_release);
+  }
+  else {
+    _asyncProducerCount.fetch_sub(1, std::memory_order_release);
+    _impl.handle(msg);
+  }
 }
 
-bool Logger::takes(unsigned int level)
+bool Logger::takes(unsigned int level) const
 {
   return _impl.takes(level);
 }
 
+bool Logger::startAsyncLogging(size_t capacity)
+{
+#ifdef __EMSCRIPTEN__
+  // No threads: stay synchronous
+  (void)capacity;
+  return false;
+#else
+  std::lock_guard<std::mutex> lock(_asyncBackendMutex);
+  if (!_asyncBackend) {
+    _asyncBackend = std::make_unique<AsyncLogBackend>(
+      [this](const LogMessage& msg) { _impl.handle(msg); }, capacity);
+    _activeAsyncBackend.store(_asyncBackend.get(), std::memory_order_release);
+  }
+  return true;
+#endif
+}
+
+void Logger::stopAsyncLogging()
+{
+  std::lock_guard<std::mutex> lock(_asyncBackendMutex);
+  if (_asyncBackend) {
+    // New messages are dispatched synchronously, the ones being enqueued are
+    // waited for before draining the backend
+    _activeAsyncBackend.store(nullptr);
+    while (_asyncProducerCount.load(std::memory_order_acquire) != 0) {
+      std::this_thread::yield();
+    }
+    _asyncBackend->stop();
+    _asyncBackend = nullptr;
+  }
+}
+
+bool Logger::isAsyncLogging() const
+{
+  return _activeAsyncBackend.load(std::memory_order_acquire) != nullptr;
+}
+
+void Logger::flush()
+{
+  if (auto asyncBackend = _activeAsyncBackend.load(std::memory_order_acquire)) {
+    asyncBackend->flush();
+  }
+}
+
+size_t Logger::droppedMessageCount() const
+{
+  return _asyncBackend ? _asyncBackend->droppedMessageCount() : 0;
+}
+
 bool Logger::isSubscribed(unsigned int level,
                           LogMessageListener& logMsgListener)
 {
+  std::lock_guard<std::recursive_mutex> lock(_impl._listenersMutex);
   bool subscribed = false;
   if (_impl._logMessageListeners.find(level)
       != _impl._logMessageListeners.end()) {
@@ -100,6 +207,7 @@ bool Logger::isSubscribed(unsigned int level,
 
 void Logger::registerLogMessageListener(LogMessageListener& logMsgListener)
 {
+  std::lock_guard<std::recursive_mutex> lock(_impl._listenersMutex);
   for (auto& keyVal : _impl._logMessageListeners) {
     auto& _logMsgListenersLvl = _impl._logMessageListeners[keyVal.first];
     auto it = std::find(_logMsgListenersLvl.begin(), _logMsgListenersLvl.end(),
@@ -109,11 +217,13 @@ void Logger::registerLogMessageListener(LogMessageListener& logMsgListener)
       _logMsgListenersLvl.emplace_back(l);
     }
   }
+  _impl.updateLevelMask();
 }
 
 void Logger::unregisterLogMessageListener(
   const LogMessageListener& logMsgListener)
 {
+  std::lock_guard<std::recursive_mutex> lock(_impl._listenersMutex);
   for (const auto& keyVal : _impl._logMessageListeners) {
     auto& _logMsgListenersLvl = _impl._logMessageListeners[keyVal.first];
     auto it = std::find(_logMsgListenersLvl.begin(), _logMsgListenersLvl.end(),
@@ -122,12 +232,14 @@ void Logger::unregisterLogMessageListener(
       _logMsgListenersLvl.erase(it);
     }
   }
+  _impl.updateLevelMask();
 }
 
 void Logger::registerLogMessageListener(unsigned int level,
                                         LogMessageListener& logMsgListener)
 {
-  if (_impl.takes(level)) {
+  std::lock_guard<std::recursive_mutex> lock(_impl._listenersMutex);
+  if (_impl.isValidLevel(level)) {
     if (_impl._logMessageListeners.find(level)
         != _impl._logMessageListeners.end()) {
       auto& _logMsgListenersLvl = _impl._logMessageListeners[level];
@@ -139,12 +251,14 @@ void Logger::registerLogMessageListener(unsigned int level,
       }
     }
   }
+  _impl.updateLevelMask();
 }
 
 void Logger::unregisterLogMessageListener(
   unsigned int level, const LogMessageListener& logMsgListener)
 {
-  if (_impl.takes(level)) {
+  std::lock_guard<std::recursive_mutex> lock(_impl._listenersMutex);
+  if (_impl.isValidLevel(level)) {
     if (_impl._logMessageListeners.find(level)
         != _impl._logMessageListeners.end()) {
       auto& _logMsgListenersLvl = _impl._logMessageListeners[level];
@@ -155,7 +269,8 @@ void Logger::unregisterLogMessageListener(
       }
     }
   }
-} // namespace BABYLON
+  _impl.updateLevelMask();
+}
 
 
 } // end of namespace BABYLON
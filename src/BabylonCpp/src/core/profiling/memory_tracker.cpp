@@ -0,0 +1,198 @@
+#include <babylon/core/profiling/memory_tracker.h>
+
+#include <array>
+#include <atomic>
+
+#include <babylon/core/json_util.h>
+#include <babylon/core/profiling/memory.h>
+
+namespace BABYLON {
+
+namespace {
+
+struct MemoryCounter {
+  std::atomic<size_t> bytes{0};
+  std::atomic<size_t> peakBytes{0};
+}; // end of struct MemoryCounter
+
+std::array<MemoryCounter, MemoryTracker::CategoryCount>& memoryCounters()
+{
+  static std::array<MemoryCounter, MemoryTracker::CategoryCount> counters;
+  return counters;
+}
+
+MemoryCounter& memoryCounter(MemoryCategory category)
+{
+  return memoryCounters()[static_cast<size_t>(category)];
+}
+
+} // end of anonymous namespace
+
+void MemoryTracker::Allocate(MemoryCategory category, size_t bytes)
+{
+  if (bytes == 0) {
+    return;
+  }
+  auto& counter      = memoryCounter(category);
+  const auto current = counter.bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  auto peak          = counter.peakBytes.load(std::memory_order_relaxed);
+  while (current > peak
+         && !counter.peakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+  }
+}
+
+void MemoryTracker::Release(MemoryCategory category, size_t bytes)
+{
+  if (bytes == 0) {
+    return;
+  }
+  memoryCounter(category).bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+size_t MemoryTracker::GetBytes(MemoryCategory category)
+{
+  return memoryCounter(category).bytes.load(std::memory_order_relaxed);
+}
+
+size_t MemoryTracker::GetPeakBytes(MemoryCategory category)
+{
+  return memoryCounter(category).peakBytes.load(std::memory_order_relaxed);
+}
+
+size_t MemoryTracker::GetTotalBytes()
+{
+  size_t total = 0;
+  for (const auto& counter : memoryCounters()) {
+    total += counter.bytes.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+void MemoryTracker::ResetPeaks()
+{
+  for (auto& counter : memoryCounters()) {
+    counter.peakBytes.store(counter.bytes.load(std::memory_order_relaxed),
+                            std::memory_order_relaxed);
+  }
+}
+
+const char* MemoryTracker::GetCategoryName(MemoryCategory category)
+{
+  switch (category) {
+    case MemoryCategory::GeometryVertexData:
+      return "geometryVertexData";
+    case MemoryCategory::GeometryIndexData:
+      return "geometryIndexData";
+    case MemoryCategory::Textures:
+      return "textures";
+    case MemoryCategory::AnimationKeys:
+      return "animationKeys";
+    case MemoryCategory::SkeletonMatrices:
+      return "skeletonMatrices";
+    case MemoryCategory::ParticleBuffers:
+      return "particleBuffers";
+    case MemoryCategory::EffectCache:
+      return "effectCache";
+    case MemoryCategory::LoaderStagingBuffers:
+      return "loaderStagingBuffers";
+    default:
+      return "unknown";
+  }
+}
+
+json MemoryTracker::Serialize()
+{
+  auto categories = json::object();
+  for (size_t i = 0; i < CategoryCount; ++i) {
+    const auto category                   = static_cast<MemoryCategory>(i);
+    categories[GetCategoryName(category)] = {
+      {"bytes", GetBytes(category)},
+      {"peakBytes", GetPeakBytes(category)},
+    };
+  }
+
+  return {
+    {"trackedBytes", GetTotalBytes()},
+    {"currentRSS", Memory::GetCurrentRSS()},
+    {"peakRSS", Memory::GetPeakRSS()},
+    {"categories", categories},
+  };
+}
+
+TrackedMemory::TrackedMemory(MemoryCategory category) : _category{category}, _bytes{0}
+{
+}
+
+TrackedMemory::TrackedMemory(const TrackedMemory& other)
+    : _category{other._category}, _bytes{other._bytes}
+{
+  MemoryTracker::Allocate(_category, _bytes);
+}
+
+TrackedMemory::TrackedMemory(TrackedMemory&& other) noexcept
+    : _category{other._category}, _bytes{other._bytes}
+{
+  other._bytes = 0;
+}
+
+TrackedMemory& TrackedMemory::operator=(const TrackedMemory& other)
+{
+  if (&other != this) {
+    release();
+    _category = other._category;
+    _bytes    = other._bytes;
+    MemoryTracker::Allocate(_category, _bytes);
+  }
+
+  return *this;
+}
+
+TrackedMemory& TrackedMemory::operator=(TrackedMemory&& other) noexcept
+{
+  if (&other != this) {
+    release();
+    _category    = other._category;
+    _bytes       = other._bytes;
+    other._bytes = 0;
+  }
+
+  return *this;
+}
+
+TrackedMemory::~TrackedMemory()
+{
+  release();
+}
+
+void TrackedMemory::set(size_t bytes)
+{
+  if (bytes > _bytes) {
+    MemoryTracker::Allocate(_category, bytes - _bytes);
+  }
+  else if (bytes < _bytes) {
+    MemoryTracker::Release(_category, _bytes - bytes);
+  }
+  _bytes = bytes;
+}
+
+void TrackedMemory::add(size_t bytes)
+{
+  set(_bytes + bytes);
+}
+
+void TrackedMemory::release()
+{
+  set(0);
+}
+
+size_t TrackedMemory::bytes() const
+{
+  return _bytes;
+}
+
+MemoryCategory TrackedMemory::category() const
+{
+  return _category;
+}
+
+} // end of namespace BABYLON
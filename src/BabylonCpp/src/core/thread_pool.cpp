@@ -0,0 +1,162 @@
+#include <babylon/core/thread_pool.h>
+
+#include <algorithm>
+
+namespace BABYLON {
+
+namespace {
+
+// Pool and index of a worker running a loop body on this thread. The index only addresses the
+// per worker data of its own pool.
+struct WorkerScope;
+thread_local const WorkerScope* currentWorkerScope = nullptr;
+
+// Makes this thread run the loop bodies as the given worker for the lifetime of the scope, the
+// scopes of the loops nested on this thread are chained, innermost first
+struct WorkerScope {
+  WorkerScope(const ThreadPool* iPool, size_t iWorkerIndex)
+      : pool{iPool}, workerIndex{iWorkerIndex}, parent{currentWorkerScope}
+  {
+    currentWorkerScope = this;
+  }
+  ~WorkerScope()
+  {
+    currentWorkerScope = parent;
+  }
+  WorkerScope(const WorkerScope&) = delete;
+  WorkerScope& operator=(const WorkerScope&) = delete;
+
+  const ThreadPool* pool;
+  size_t workerIndex;
+  const WorkerScope* parent;
+}; // end of struct WorkerScope
+
+// Returns the scope of the loop of the given pool running on this thread, if any
+const WorkerScope* findWorkerScope(const ThreadPool* pool)
+{
+  auto workerScope = currentWorkerScope;
+  while (workerScope && workerScope->pool != pool) {
+    workerScope = workerScope->parent;
+  }
+  return workerScope;
+}
+
+} // end of anonymous namespace
+
+ThreadPool::ThreadPool(size_t workerCount)
+    : _func{nullptr}
+    , _count{0}
+    , _grainSize{1}
+    , _next{0}
+    , _generation{0}
+    , _activeWorkers{0}
+    , _stopping{false}
+{
+  if (workerCount == 0) {
+    workerCount = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+  _threads.reserve(workerCount - 1);
+  for (size_t i = 1; i < workerCount; ++i) {
+    _threads.emplace_back(&ThreadPool::workerLoop, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _wakeCondition.notify_all();
+  for (auto& thread : _threads) {
+    thread.join();
+  }
+}
+
+ThreadPool& ThreadPool::Default()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+size_t ThreadPool::workerCount() const
+{
+  return _threads.size() + 1;
+}
+
+void ThreadPool::parallelFor(size_t count, size_t grainSize, const RangeFunction& func)
+{
+  if (count == 0) {
+    return;
+  }
+  grainSize = std::max(grainSize, static_cast<size_t>(1));
+
+  // A loop issued from a loop body of this pool, possibly through loops of other pools, runs
+  // inline on the worker running the body
+  if (auto workerScope = findWorkerScope(this)) {
+    func(0, count, workerScope->workerIndex);
+    return;
+  }
+
+  std::lock_guard<std::mutex> loopLock(_loopMutex);
+
+  // Loops issued from a loop body of another pool, single worker pools and loops fitting in a
+  // single range run inline as worker 0, which the loop lock reserves to this thread
+  if (currentWorkerScope != nullptr || _threads.empty() || count <= grainSize) {
+    WorkerScope workerScope{this, 0};
+    func(0, count, 0);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _func      = &func;
+    _count     = count;
+    _grainSize = grainSize;
+    _next.store(0, std::memory_order_relaxed);
+    _activeWorkers = _threads.size();
+    ++_generation;
+  }
+  _wakeCondition.notify_all();
+
+  runRanges(0);
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  _doneCondition.wait(lock, [this]() { return _activeWorkers == 0; });
+  _func = nullptr;
+}
+
+void ThreadPool::workerLoop(size_t workerIndex)
+{
+  size_t generation = 0;
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _wakeCondition.wait(lock, [&]() { return _stopping || _generation != generation; });
+      if (_stopping) {
+        return;
+      }
+      generation = _generation;
+    }
+
+    runRanges(workerIndex);
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (--_activeWorkers == 0) {
+        _doneCondition.notify_one();
+      }
+    }
+  }
+}
+
+void ThreadPool::runRanges(size_t workerIndex)
+{
+  WorkerScope workerScope{this, workerIndex};
+  for (size_t begin = _next.fetch_add(_grainSize); begin < _count;
+       begin        = _next.fetch_add(_grainSize)) {
+    (*_func)(begin, std::min(begin + _grainSize, _count), workerIndex);
+  }
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,313 @@
+#include <babylon/culling/dynamic_aabb_tree.h>
+
+namespace BABYLON {
+
+namespace {
+
+using Box = DynamicAABBTree::Box;
+
+Box combine(const Box& a, const Box& b)
+{
+  Box result;
+  for (std::size_t i = 0; i < 3; ++i) {
+    result.minimum[i] = std::min(a.minimum[i], b.minimum[i]);
+    result.maximum[i] = std::max(a.maximum[i], b.maximum[i]);
+  }
+  return result;
+}
+
+// Half of the surface area, the cost of a node for the surface area heuristic
+float area(const Box& box)
+{
+  const auto dx = box.maximum[0] - box.minimum[0];
+  const auto dy = box.maximum[1] - box.minimum[1];
+  const auto dz = box.maximum[2] - box.minimum[2];
+  return dx * dy + dy * dz + dz * dx;
+}
+
+bool contains(const Box& outer, const Box& inner)
+{
+  for (std::size_t i = 0; i < 3; ++i) {
+    if (inner.minimum[i] < outer.minimum[i] || inner.maximum[i] > outer.maximum[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // end of anonymous namespace
+
+DynamicAABBTree::DynamicAABBTree(float margin)
+    : _margin{margin}, _root{NullNode}, _freeList{NullNode}, _proxyCount{0}
+{
+}
+
+DynamicAABBTree::~DynamicAABBTree() = default;
+
+int DynamicAABBTree::_allocateNode()
+{
+  if (_freeList == NullNode) {
+    _nodes.emplace_back();
+    _freeList            = static_cast<int>(_nodes.size()) - 1;
+    _nodes.back().parent = NullNode;
+  }
+  const auto nodeId = _freeList;
+  auto& node        = _nodes[static_cast<std::size_t>(nodeId)];
+  _freeList         = node.parent;
+  node.parent       = NullNode;
+  node.child1       = NullNode;
+  node.child2       = NullNode;
+  node.height       = 0;
+  node.userData     = 0;
+  return nodeId;
+}
+
+void DynamicAABBTree::_freeNode(int nodeId)
+{
+  auto& node  = _nodes[static_cast<std::size_t>(nodeId)];
+  node.parent = _freeList;
+  node.height = -1;
+  _freeList   = nodeId;
+}
+
+int DynamicAABBTree::createProxy(const Box& box, std::size_t userData)
+{
+  const auto proxyId = _allocateNode();
+  auto& node         = _nodes[static_cast<std::size_t>(proxyId)];
+  for (std::size_t i = 0; i < 3; ++i) {
+    node.box.minimum[i] = box.minimum[i] - _margin;
+    node.box.maximum[i] = box.maximum[i] + _margin;
+  }
+  node.userData = userData;
+  _insertLeaf(proxyId);
+  ++_proxyCount;
+  return proxyId;
+}
+
+void DynamicAABBTree::destroyProxy(int proxyId)
+{
+  _removeLeaf(proxyId);
+  _freeNode(proxyId);
+  --_proxyCount;
+}
+
+bool DynamicAABBTree::moveProxy(int proxyId, const Box& box)
+{
+  auto& node = _nodes[static_cast<std::size_t>(proxyId)];
+  if (contains(node.box, box)) {
+    return false;
+  }
+  _removeLeaf(proxyId);
+  for (std::size_t i = 0; i < 3; ++i) {
+    node.box.minimum[i] = box.minimum[i] - _margin;
+    node.box.maximum[i] = box.maximum[i] + _margin;
+  }
+  _insertLeaf(proxyId);
+  return true;
+}
+
+int DynamicAABBTree::height() const
+{
+  return _root == NullNode ? 0 : _nodes[static_cast<std::size_t>(_root)].height;
+}
+
+void DynamicAABBTree::clear()
+{
+  _nodes.clear();
+  _root       = NullNode;
+  _freeList   = NullNode;
+  _proxyCount = 0;
+}
+
+void DynamicAABBTree::_insertLeaf(int leaf)
+{
+  if (_root == NullNode) {
+    _root                                         = leaf;
+    _nodes[static_cast<std::size_t>(leaf)].parent = NullNode;
+    return;
+  }
+
+  // Find the best sibling with the surface area heuristic
+  const auto leafBox = _nodes[static_cast<std::size_t>(leaf)].box;
+  auto index         = _root;
+  while (!_nodes[static_cast<std::size_t>(index)].isLeaf()) {
+    const auto& node    = _nodes[static_cast<std::size_t>(index)];
+    const auto nodeArea = area(node.box);
+    const auto combined = area(combine(node.box, leafBox));
+    // Cost of creating a new parent for this node and the new leaf
+    const auto cost = 2.f * combined;
+    // Minimum cost of pushing the leaf further down the tree
+    const auto inheritanceCost = 2.f * (combined - nodeArea);
+
+    const auto childCost = [&](int child) {
+      const auto& childNode = _nodes[static_cast<std::size_t>(child)];
+      const auto childBox   = combine(leafBox, childNode.box);
+      return childNode.isLeaf() ? area(childBox) + inheritanceCost :
+                                  area(childBox) - area(childNode.box) + inheritanceCost;
+    };
+    const auto cost1 = childCost(node.child1);
+    const auto cost2 = childCost(node.child2);
+
+    if (cost < cost1 && cost < cost2) {
+      break;
+    }
+    index = (cost1 < cost2) ? node.child1 : node.child2;
+  }
+  const auto sibling = index;
+
+  // Create a new parent
+  const auto oldParent = _nodes[static_cast<std::size_t>(sibling)].parent;
+  const auto newParent = _allocateNode();
+  {
+    auto& parentNode  = _nodes[static_cast<std::size_t>(newParent)];
+    parentNode.parent = oldParent;
+    parentNode.box    = combine(leafBox, _nodes[static_cast<std::size_t>(sibling)].box);
+    parentNode.height = _nodes[static_cast<std::size_t>(sibling)].height + 1;
+    parentNode.child1 = sibling;
+    parentNode.child2 = leaf;
+  }
+  if (oldParent != NullNode) {
+    auto& oldParentNode = _nodes[static_cast<std::size_t>(oldParent)];
+    if (oldParentNode.child1 == sibling) {
+      oldParentNode.child1 = newParent;
+    }
+    else {
+      oldParentNode.child2 = newParent;
+    }
+  }
+  else {
+    _root = newParent;
+  }
+  _nodes[static_cast<std::size_t>(sibling)].parent = newParent;
+  _nodes[static_cast<std::size_t>(leaf)].parent    = newParent;
+
+  // Walk back up the tree fixing heights and boxes
+  index = newParent;
+  while (index != NullNode) {
+    index              = _balance(index);
+    auto& node         = _nodes[static_cast<std::size_t>(index)];
+    const auto& child1 = _nodes[static_cast<std::size_t>(node.child1)];
+    const auto& child2 = _nodes[static_cast<std::size_t>(node.child2)];
+    node.height        = 1 + std::max(child1.height, child2.height);
+    node.box           = combine(child1.box, child2.box);
+    index              = node.parent;
+  }
+}
+
+void DynamicAABBTree::_removeLeaf(int leaf)
+{
+  if (leaf == _root) {
+    _root = NullNode;
+    return;
+  }
+
+  const auto parent      = _nodes[static_cast<std::size_t>(leaf)].parent;
+  const auto& parentNode = _nodes[static_cast<std::size_t>(parent)];
+  const auto grandParent = parentNode.parent;
+  const auto sibling     = (parentNode.child1 == leaf) ? parentNode.child2 : parentNode.child1;
+
+  if (grandParent != NullNode) {
+    // Destroy the parent and connect the sibling to the grand parent
+    auto& grandParentNode = _nodes[static_cast<std::size_t>(grandParent)];
+    if (grandParentNode.child1 == parent) {
+      grandParentNode.child1 = sibling;
+    }
+    else {
+      grandParentNode.child2 = sibling;
+    }
+    _nodes[static_cast<std::size_t>(sibling)].parent = grandParent;
+    _freeNode(parent);
+
+    auto index = grandParent;
+    while (index != NullNode) {
+      index              = _balance(index);
+      auto& node         = _nodes[static_cast<std::size_t>(index)];
+      const auto& child1 = _nodes[static_cast<std::size_t>(node.child1)];
+      const auto& child2 = _nodes[static_cast<std::size_t>(node.child2)];
+      node.box           = combine(child1.box, child2.box);
+      node.height        = 1 + std::max(child1.height, child2.height);
+      index              = node.parent;
+    }
+  }
+  else {
+    _root                                            = sibling;
+    _nodes[static_cast<std::size_t>(sibling)].parent = NullNode;
+    _freeNode(parent);
+  }
+}
+
+int DynamicAABBTree::_balance(int iA)
+{
+  // Performs a left or right rotation if the node A is imbalanced, and returns the new root of the
+  // subtree
+  auto& A = _nodes[static_cast<std::size_t>(iA)];
+  if (A.isLeaf() || A.height < 2) {
+    return iA;
+  }
+
+  const auto iB = A.child1;
+  const auto iC = A.child2;
+  auto& B       = _nodes[static_cast<std::size_t>(iB)];
+  auto& C       = _nodes[static_cast<std::size_t>(iC)];
+
+  const auto rotate = [&](Node& X, int iX, Node& other, bool xIsChild2) {
+    // Rotates the child X up, X being imbalanced against other
+    const auto iF = X.child1;
+    const auto iG = X.child2;
+    auto& F       = _nodes[static_cast<std::size_t>(iF)];
+    auto& G       = _nodes[static_cast<std::size_t>(iG)];
+
+    // Swap A and X
+    X.child1 = iA;
+    X.parent = A.parent;
+    A.parent = iX;
+
+    // A's old parent should point to X
+    if (X.parent != NullNode) {
+      auto& xParent = _nodes[static_cast<std::size_t>(X.parent)];
+      if (xParent.child1 == iA) {
+        xParent.child1 = iX;
+      }
+      else {
+        xParent.child2 = iX;
+      }
+    }
+    else {
+      _root = iX;
+    }
+
+    // Rotate: keep the tallest grand child under X
+    const auto keepF = F.height > G.height;
+    const auto iUp   = keepF ? iF : iG;
+    const auto iDown = keepF ? iG : iF;
+    auto& up         = _nodes[static_cast<std::size_t>(iUp)];
+    auto& down       = _nodes[static_cast<std::size_t>(iDown)];
+    X.child2         = iUp;
+    if (xIsChild2) {
+      A.child2 = iDown;
+    }
+    else {
+      A.child1 = iDown;
+    }
+    down.parent = iA;
+    A.box       = combine(other.box, down.box);
+    X.box       = combine(A.box, up.box);
+    A.height    = 1 + std::max(other.height, down.height);
+    X.height    = 1 + std::max(A.height, up.height);
+  };
+
+  const auto balance = C.height - B.height;
+  // Rotate C up
+  if (balance > 1) {
+    rotate(C, iC, B, true);
+    return iC;
+  }
+  // Rotate B up
+  if (balance < -1) {
+    rotate(B, iB, C, false);
+    return iB;
+  }
+  return iA;
+}
+
+} // end of namespace BABYLON
@@ -16,18 +16,24 @@ OctreeSceneComponent::OctreeSceneComponent(Scene* iScene)
   scene                 = iScene;
 
   scene->getActiveMeshCandidates
-    = [this]() { return getActiveMeshCandidates(); };
+    = [this]() -> const std::vector<AbstractMesh*>& {
+    return getActiveMeshCandidates();
+  };
 
   scene->getActiveSubMeshCandidates
-    = [this](AbstractMesh* mesh) { return getActiveSubMeshCandidates(mesh); };
+    = [this](AbstractMesh* mesh) -> const std::vector<SubMesh*>& {
+    return getActiveSubMeshCandidates(mesh);
+  };
   scene->getCollidingSubMeshCandidates
-    = [this](AbstractMesh* mesh, const Collider& collider) {
-        return getCollidingSubMeshCandidates(mesh, collider);
-      };
+    = [this](AbstractMesh* mesh,
+             const Collider& collider) -> const std::vector<SubMesh*>& {
+    return getCollidingSubMeshCandidates(mesh, collider);
+  };
   scene->getIntersectingSubMeshCandidates
-    = [this](AbstractMesh* mesh, const Ray& localRay) {
-        return getIntersectingSubMeshCandidates(mesh, localRay);
-      };
+    = [this](AbstractMesh* mesh,
+             const Ray& localRay) -> const std::vector<SubMesh*>& {
+    return getIntersectingSubMeshCandidates(mesh, localRay);
+  };
 }
 
 OctreeSceneComponent::~OctreeSceneComponent() = default;
@@ -59,39 +65,35 @@ void OctreeSceneComponent::_register()
     });
 }
 
-std::vector<AbstractMesh*> OctreeSceneComponent::getActiveMeshCandidates()
+const std::vector<AbstractMesh*>& OctreeSceneComponent::getActiveMeshCandidates()
 {
   if (scene->selectionOctree()) {
-    auto selection = scene->selectionOctree()->select(scene->frustumPlanes());
-    return selection;
+    return scene->selectionOctree()->select(scene->frustumPlanes());
   }
   return scene->_getDefaultMeshCandidates();
 }
 
-std::vector<SubMesh*>
+const std::vector<SubMesh*>&
 OctreeSceneComponent::getActiveSubMeshCandidates(AbstractMesh* mesh)
 {
   if (mesh->_submeshesOctree && mesh->useOctreeForRenderingSelection) {
-    auto intersections = mesh->_submeshesOctree->select(scene->frustumPlanes());
-    return intersections;
+    return mesh->_submeshesOctree->select(scene->frustumPlanes());
   }
-  return scene->_getDefaultSubMeshCandidates(mesh);
+  return scene->_getDefaultActiveSubMeshCandidates(mesh);
 }
 
-std::vector<SubMesh*>
+const std::vector<SubMesh*>&
 OctreeSceneComponent::getIntersectingSubMeshCandidates(AbstractMesh* mesh,
                                                        const Ray& localRay)
 {
   if (mesh->_submeshesOctree && mesh->useOctreeForPicking) {
     Ray::TransformToRef(localRay, mesh->getWorldMatrix(), _tempRay);
-    auto intersections = mesh->_submeshesOctree->intersectsRay(_tempRay);
-
-    return intersections;
+    return mesh->_submeshesOctree->intersectsRay(_tempRay);
   }
-  return scene->_getDefaultSubMeshCandidates(mesh);
+  return scene->_getDefaultIntersectingSubMeshCandidates(mesh);
 }
 
-std::vector<SubMesh*>
+const std::vector<SubMesh*>&
 OctreeSceneComponent::getCollidingSubMeshCandidates(AbstractMesh* mesh,
                                                     const Collider& collider)
 {
@@ -99,12 +101,9 @@ OctreeSceneComponent::getCollidingSubMeshCandidates(AbstractMesh* mesh,
     auto radius = collider._velocityWorldLength
                   + stl_util::max(collider._radius.x, collider._radius.y,
                                   collider._radius.z);
-    auto intersections
-      = mesh->_submeshesOctree->intersects(collider._basePointWorld, radius);
-
-    return intersections;
+    return mesh->_submeshesOctree->intersects(collider._basePointWorld, radius);
   }
-  return scene->_getDefaultSubMeshCandidates(mesh);
+  return scene->_getDefaultCollidingSubMeshCandidates(mesh);
 }
 
 void OctreeSceneComponent::rebuild()
@@ -0,0 +1,81 @@
+#include <babylon/culling/sweep_and_prune.h>
+
+#include <algorithm>
+
+namespace BABYLON {
+
+SweepAndPrune::SweepAndPrune() = default;
+
+SweepAndPrune::~SweepAndPrune() = default;
+
+void SweepAndPrune::clear()
+{
+  _boxes.clear();
+  _sorted.clear();
+  _pairs.clear();
+  // The overlap lists are kept to reuse their storage
+  for (auto& overlaps : _overlaps) {
+    overlaps.clear();
+  }
+}
+
+std::size_t SweepAndPrune::addBox(const Box& box)
+{
+  _boxes.emplace_back(box);
+  return _boxes.size() - 1;
+}
+
+void SweepAndPrune::update()
+{
+  const auto count = _boxes.size();
+  _pairs.clear();
+  if (_overlaps.size() < count) {
+    _overlaps.resize(count);
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    _overlaps[i].clear();
+  }
+
+  // Sort along the x axis
+  _sorted.resize(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    _sorted[i] = i;
+  }
+  std::sort(_sorted.begin(), _sorted.end(), [this](std::size_t a, std::size_t b) {
+    return _boxes[a].minimum[0] < _boxes[b].minimum[0];
+  });
+
+  // Sweep: the following boxes starting before the end of a box overlap it on the x axis
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto& box = _boxes[_sorted[i]];
+    for (std::size_t j = i + 1; j < count; ++j) {
+      const auto& other = _boxes[_sorted[j]];
+      if (other.minimum[0] > box.maximum[0]) {
+        break;
+      }
+      if (other.minimum[1] > box.maximum[1] || other.maximum[1] < box.minimum[1]
+          || other.minimum[2] > box.maximum[2] || other.maximum[2] < box.minimum[2]) {
+        continue;
+      }
+      const auto a = std::min(_sorted[i], _sorted[j]);
+      const auto b = std::max(_sorted[i], _sorted[j]);
+      _pairs.push_back({a, b});
+      _overlaps[a].emplace_back(b);
+      _overlaps[b].emplace_back(a);
+    }
+  }
+}
+
+bool SweepAndPrune::overlap(std::size_t a, std::size_t b) const
+{
+  if (std::max(a, b) >= std::min(_boxes.size(), _overlaps.size())) {
+    return false;
+  }
+
+  // Search the shortest list
+  const auto& overlaps = _overlaps[a].size() <= _overlaps[b].size() ? _overlaps[a] : _overlaps[b];
+  const auto other     = _overlaps[a].size() <= _overlaps[b].size() ? b : a;
+  return std::find(overlaps.begin(), overlaps.end(), other) != overlaps.end();
+}
+
+} // end of namespace BABYLON
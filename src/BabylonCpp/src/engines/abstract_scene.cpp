@@ -132,7 +132,7 @@ void AbstractScene::_addParsers()
       if (json_util::has_valid_key_value(parsedData, "sounds")) {
         for (const auto& parsedSound : json_util::get_array<json>(parsedData, "sounds")) {
           auto parsedSoundName = json_util::get_string(parsedSound, "name");
-          if (Engine::audioEngine->canUseWebAudio) {
+          if (Engine::audioEngine && Engine::audioEngine->canUseWebAudio) {
             std::string parsedSoundUrl;
             if (!json_util::has_valid_key_value(parsedSound, "url")) {
               parsedSoundUrl = parsedSoundName;
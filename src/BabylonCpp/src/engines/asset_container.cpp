@@ -1,10 +1,14 @@
 #include <babylon/engines/asset_container.h>
 
+#include <unordered_map>
+
 #include <babylon/actions/abstract_action_manager.h>
 #include <babylon/animations/animation.h>
 #include <babylon/animations/animation_group.h>
+#include <babylon/animations/targeted_animation.h>
 #include <babylon/audio/sound.h>
 #include <babylon/audio/sound_track.h>
+#include <babylon/bones/bone.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/engines/iscene_serializable_component.h>
@@ -22,6 +26,32 @@
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Blocks the registration of new entities with the scene, and restores the previous
+ * state when released or destroyed (also when the instantiation throws).
+ */
+struct BlockEntityCollectionGuard {
+  BlockEntityCollectionGuard(Scene& iScene)
+      : scene{iScene}, blockEntityCollection{iScene._blockEntityCollection}
+  {
+    scene._blockEntityCollection = true;
+  }
+  ~BlockEntityCollectionGuard()
+  {
+    release();
+  }
+  void release()
+  {
+    scene._blockEntityCollection = blockEntityCollection;
+  }
+  Scene& scene;
+  const bool blockEntityCollection;
+};
+
+} // end of anonymous namespace
+
 AssetContainer::AssetContainer(Scene* iScene) : scene{iScene}, _wasAddedToScene{false}
 {
   scene->onDisposeObservable.add([this](Scene* /*scene*/, EventState & /*es*/) -> void {
@@ -229,4 +259,156 @@ MeshPtr AssetContainer::createRootMesh()
   return rootMesh;
 }
 
+InstantiatedEntries AssetContainer::instantiateModelsToScene(
+  const std::function<std::string(const std::string& sourceName)>& nameFunction,
+  bool cloneMaterials)
+{
+  InstantiatedEntries result;
+  const auto cloneName = [&nameFunction](const std::string& sourceName) {
+    return nameFunction ? nameFunction(sourceName) : "Clone of " + sourceName;
+  };
+
+  // Clones of the nodes, bones and materials by source, used to retarget the skeletons and
+  // animations
+  std::unordered_map<Node*, TransformNodePtr> nodeClones;
+  std::unordered_map<IAnimatable*, IAnimatablePtr> animatableClones;
+  std::unordered_map<Material*, MaterialPtr> materialClones;
+  std::vector<MaterialPtr> newMaterials;
+  std::vector<AbstractMeshPtr> newMeshes;
+  std::vector<TransformNodePtr> newTransformNodes;
+
+  // The new entities are registered with the scene once everything is cloned
+  BlockEntityCollectionGuard blockEntityCollectionGuard{*scene};
+  const auto blockEntityCollection = blockEntityCollectionGuard.blockEntityCollection;
+
+  const auto onNewNodeCreated = [&](TransformNode* source, TransformNode* clone) {
+    auto node = std::static_pointer_cast<TransformNode>(clone->shared_from_this());
+    nodeClones[source]       = node;
+    animatableClones[source] = node;
+    if (nameFunction) {
+      clone->name = nameFunction(source->name);
+    }
+
+    auto sourceMesh = dynamic_cast<AbstractMesh*>(source);
+    auto mesh       = std::dynamic_pointer_cast<AbstractMesh>(node);
+    if (!mesh || !sourceMesh) {
+      newTransformNodes.emplace_back(node);
+      return;
+    }
+
+    newMeshes.emplace_back(mesh);
+    mesh->skeleton = sourceMesh->skeleton();
+
+    // The geometry is shared by the clone, the material unless asked otherwise
+    auto sourceMaterial = sourceMesh->getMaterial();
+    if (cloneMaterials && sourceMaterial) {
+      auto it = materialClones.find(sourceMaterial.get());
+      if (it == materialClones.end()) {
+        auto swap = sourceMaterial->clone(cloneName(sourceMaterial->name), true);
+        if (swap) {
+          newMaterials.emplace_back(swap);
+          animatableClones[sourceMaterial.get()] = swap;
+        }
+        else {
+          swap = sourceMaterial;
+        }
+        it = materialClones.emplace(sourceMaterial.get(), swap).first;
+      }
+      mesh->material = it->second;
+    }
+  };
+
+  InstantiateHierarychyOptions options;
+  options.doNotInstantiate = true;
+  for (const auto& transformNode : transformNodes) {
+    if (!transformNode->parent()) {
+      if (auto rootNode
+          = transformNode->instantiateHierarchy(nullptr, options, onNewNodeCreated)) {
+        result.rootNodes.emplace_back(rootNode);
+      }
+    }
+  }
+  for (const auto& mesh : meshes) {
+    if (!mesh->parent()) {
+      if (auto rootNode = mesh->instantiateHierarchy(nullptr, options, onNewNodeCreated)) {
+        result.rootNodes.emplace_back(rootNode);
+      }
+    }
+  }
+
+  // Skeletons
+  for (const auto& skeleton : skeletons) {
+    auto clone = skeleton->clone(cloneName(skeleton->name));
+    if (skeleton->overrideMesh) {
+      auto it = nodeClones.find(skeleton->overrideMesh.get());
+      if (it != nodeClones.end()) {
+        clone->overrideMesh = std::static_pointer_cast<AbstractMesh>(it->second);
+      }
+    }
+
+    // Bones linked to nodes are linked to their clones
+    for (size_t index = 0; index < clone->bones.size(); ++index) {
+      const auto& bone = clone->bones[index];
+      animatableClones[skeleton->bones[index].get()] = bone;
+      if (bone->_linkedTransformNode) {
+        auto it = nodeClones.find(bone->_linkedTransformNode.get());
+        if (it != nodeClones.end()) {
+          bone->linkTransformNode(it->second);
+        }
+      }
+    }
+
+    for (const auto& mesh : meshes) {
+      if (mesh->skeleton() == skeleton) {
+        auto it = nodeClones.find(mesh.get());
+        if (it != nodeClones.end()) {
+          std::static_pointer_cast<AbstractMesh>(it->second)->skeleton = clone;
+        }
+      }
+    }
+
+    result.skeletons.emplace_back(clone);
+  }
+
+  // Animation groups
+  for (const auto& animationGroup : animationGroups) {
+    auto clone = AnimationGroup::New(cloneName(animationGroup->name), scene);
+    for (const auto& targetedAnimation : animationGroup->targetedAnimations()) {
+      auto it = animatableClones.find(targetedAnimation->target.get());
+      clone->addTargetedAnimation(targetedAnimation->animation, it != animatableClones.end() ?
+                                                                  it->second :
+                                                                  targetedAnimation->target);
+    }
+    clone->speedRatio    = animationGroup->speedRatio();
+    clone->loopAnimation = animationGroup->loopAnimation();
+    clone->isAdditive    = animationGroup->isAdditive();
+    result.animationGroups.emplace_back(clone);
+  }
+
+  blockEntityCollectionGuard.release();
+
+  // Register the new entities with the scene in one pass
+  if (!blockEntityCollection) {
+    scene->meshes.reserve(scene->meshes.size() + newMeshes.size());
+    scene->transformNodes.reserve(scene->transformNodes.size() + newTransformNodes.size());
+    for (const auto& material : newMaterials) {
+      scene->addMaterial(material);
+    }
+    for (const auto& mesh : newMeshes) {
+      scene->addMesh(mesh);
+    }
+    for (const auto& transformNode : newTransformNodes) {
+      scene->addTransformNode(transformNode);
+    }
+    for (const auto& skeleton : result.skeletons) {
+      scene->addSkeleton(skeleton);
+    }
+    for (const auto& animationGroup : result.animationGroups) {
+      scene->addAnimationGroup(animationGroup);
+    }
+  }
+
+  return result;
+}
+
 } // end of namespace BABYLON
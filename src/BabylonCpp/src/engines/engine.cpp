@@ -1,5 +1,6 @@
 #include <babylon/engines/engine.h>
 
+#include <babylon/audio/audio_engine.h>
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/logging.h>
@@ -75,6 +76,11 @@ Engine::Engine(ICanvas* canvas, const EngineOptions& options)
 {
   Engine::Instances().emplace_back(this);
 
+  // The audio engine does not need a canvas, it is shared by all the engines
+  if (options.audioEngine && !Engine::audioEngine) {
+    Engine::audioEngine = AudioEngine::New();
+  }
+
   if (!canvas) {
     return;
   }
@@ -601,6 +607,7 @@ void Engine::exitPointerlock()
 
 void Engine::beginFrame()
 {
+  _frameArena.reset();
   _measureFps();
 
   onBeginFrameObservable.notifyObservers(this);
@@ -615,6 +622,11 @@ void Engine::endFrame()
   onEndFrameObservable.notifyObservers(this);
 }
 
+FrameArena& Engine::frameArena()
+{
+  return _frameArena;
+}
+
 void Engine::resize()
 {
   // We're not resizing the size of the canvas while in VR mode & presenting
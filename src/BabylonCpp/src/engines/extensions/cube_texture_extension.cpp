@@ -187,6 +187,7 @@ InternalTexturePtr CubeTextureExtension::createCubeTexture(
         if (format) {
           texture->format = format;
         }
+        texture->_updateMemoryEstimate();
 
         texture->onLoadedObservable.notifyObservers(texture.get());
         texture->onLoadedObservable.clear();
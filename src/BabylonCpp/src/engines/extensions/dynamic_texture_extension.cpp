@@ -70,6 +70,7 @@ void DynamicTextureExtension::updateDynamicTexture(const InternalTexturePtr& tex
     _this->_gl->pixelStorei(GL::UNPACK_PREMULTIPLY_ALPHA_WEBGL, 0);
   }
   texture->isReady = true;
+  texture->_updateMemoryEstimate();
 }
 
 } // end of namespace BABYLON
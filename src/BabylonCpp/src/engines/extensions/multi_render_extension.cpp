@@ -171,6 +171,7 @@ MultiRenderExtension::createMultipleRenderTarget(ISize size,
     texture->_generateDepthBuffer   = generateDepthBuffer;
     texture->_generateStencilBuffer = generateStencilBuffer;
     texture->_attachments           = attachments;
+    texture->_updateMemoryEstimate();
 
     _this->_internalTexturesCache.emplace_back(texture);
   }
@@ -214,6 +215,7 @@ MultiRenderExtension::createMultipleRenderTarget(ISize size,
     depthTexture->samplingMode           = GL::NEAREST;
     depthTexture->_generateDepthBuffer   = generateDepthBuffer;
     depthTexture->_generateStencilBuffer = generateStencilBuffer;
+    depthTexture->_updateMemoryEstimate();
 
     textures.emplace_back(depthTexture);
     _this->_internalTexturesCache.emplace_back(depthTexture);
@@ -32,6 +32,7 @@ InternalTexturePtr MultiviewExtension::createMultiviewRenderTargetTexture(int wi
   gl.bindTexture(GL::TEXTURE_2D_ARRAY, internalTexture->_depthStencilTextureArray.get());
   gl.texStorage3D(GL::TEXTURE_2D_ARRAY, 1, GL::DEPTH32F_STENCIL8, width, height, 2);
   internalTexture->isReady = true;
+  internalTexture->_updateMemoryEstimate();
   return internalTexture;
 }
 
@@ -101,6 +101,7 @@ void RawTextureExtension::updateRawTexture(const InternalTexturePtr& texture,
   _this->_bindTextureDirectly(GL::TEXTURE_2D, nullptr);
   // resetTextureCache();
   texture->isReady = true;
+  texture->_updateMemoryEstimate();
 }
 
 InternalTexturePtr RawTextureExtension::createRawCubeTexture(
@@ -259,6 +260,7 @@ void RawTextureExtension::updateRawCubeTexture(const InternalTexturePtr& texture
 
   // resetTextureCache();
   texture->isReady = true;
+  texture->_updateMemoryEstimate();
 }
 
 InternalTexturePtr RawTextureExtension::createRawCubeTextureFromUrl(
@@ -334,6 +336,7 @@ InternalTexturePtr RawTextureExtension::createRawCubeTextureFromUrl(
     }
 
     texture->isReady = true;
+    texture->_updateMemoryEstimate();
     // resetTextureCache();
     scene->_removePendingData(texture);
 
@@ -466,6 +469,7 @@ void RawTextureExtension::_updateRawTexture(const InternalTexturePtr& texture,
   _this->_bindTextureDirectly(target, nullptr);
   // resetTextureCache();
   texture->isReady = true;
+  texture->_updateMemoryEstimate();
 }
 
 void RawTextureExtension::updateRawTexture3D(const InternalTexturePtr& texture,
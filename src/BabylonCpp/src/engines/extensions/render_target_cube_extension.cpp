@@ -97,6 +97,7 @@ RenderTargetCubeExtension::createRenderTargetCubeTexture(const ISize& size,
   texture->format                 = fullOptions.format.value();
   texture->_generateDepthBuffer   = fullOptions.generateDepthBuffer.value();
   texture->_generateStencilBuffer = fullOptions.generateStencilBuffer.value();
+  texture->_updateMemoryEstimate();
 
   _this->_internalTexturesCache.emplace_back(texture);
 
@@ -123,6 +123,7 @@ InternalTexturePtr RenderTargetExtension::createRenderTargetTexture(
   texture->format                 = fullOptions.format.value();
   texture->_generateDepthBuffer   = fullOptions.generateDepthBuffer.value();
   texture->_generateStencilBuffer = fullOptions.generateStencilBuffer.value();
+  texture->_updateMemoryEstimate();
 
   _this->_internalTexturesCache.emplace_back(texture);
 
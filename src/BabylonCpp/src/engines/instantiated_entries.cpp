@@ -0,0 +1,27 @@
+#include <babylon/engines/instantiated_entries.h>
+
+#include <babylon/animations/animation_group.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/meshes/transform_node.h>
+
+namespace BABYLON {
+
+void InstantiatedEntries::dispose()
+{
+  for (const auto& rootNode : rootNodes) {
+    rootNode->dispose();
+  }
+  rootNodes.clear();
+
+  for (const auto& skeleton : skeletons) {
+    skeleton->dispose();
+  }
+  skeletons.clear();
+
+  for (const auto& animationGroup : animationGroups) {
+    animationGroup->dispose();
+  }
+  animationGroups.clear();
+}
+
+} // end of namespace BABYLON
@@ -353,6 +353,7 @@ InternalTexturePtr NullEngine::createTexture(
   }
 
   texture->isReady = true;
+  texture->_updateMemoryEstimate();
 
   if (onLoad) {
     EventState es{0};
@@ -412,6 +413,7 @@ NullEngine::createRenderTargetTexture(const std::variant<int, RenderTargetSize,
   texture->type                   = *fullOptions.type;
   texture->_generateDepthBuffer   = *fullOptions.generateDepthBuffer;
   texture->_generateStencilBuffer = fullOptions.generateStencilBuffer.value_or(false);
+  texture->_updateMemoryEstimate();
 
   _internalTexturesCache.emplace_back(texture);
 
@@ -3,6 +3,7 @@
 #include <babylon/actions/abstract_action_manager.h>
 #include <babylon/actions/action_event.h>
 #include <babylon/actions/action_manager.h>
+#include <babylon/actions/iaction.h>
 #include <babylon/animations/animatable.h>
 #include <babylon/animations/animation_group.h>
 #include <babylon/animations/runtime_animation.h>
@@ -18,11 +19,13 @@
 #include <babylon/cameras/target_camera.h>
 #include <babylon/collisions/collision_coordinator.h>
 #include <babylon/collisions/icollision_coordinator.h>
+#include <babylon/core/frame_arena.h>
 #include <babylon/core/logging.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/octrees/octree_scene_component.h>
 #include <babylon/culling/ray.h>
+#include <babylon/culling/sweep_and_prune.h>
 #include <babylon/debug/debug_layer.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
@@ -213,10 +216,10 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , _animationPropertiesOverride{nullptr}
     , _spritePredicate{nullptr}
     , _onDisposeObserver{nullptr}
-    , _onBeforeRenderObserver{nullptr}
-    , _onAfterRenderObserver{nullptr}
-    , _onBeforeCameraRenderObserver{nullptr}
-    , _onAfterCameraRenderObserver{nullptr}
+    , _onBeforeRenderObserver{}
+    , _onAfterRenderObserver{}
+    , _onBeforeCameraRenderObserver{}
+    , _onAfterCameraRenderObserver{}
     , _onPointerMove{nullptr}
     , _onPointerDown{nullptr}
     , _onPointerUp{nullptr}
@@ -299,6 +302,7 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , _audioEnabled{std::nullopt}
     , _headphone{std::nullopt}
     , _multiviewSceneUbo{nullptr}
+    , _intersectionBroadphase{nullptr}
 {
   SceneOptions fullOptions;
   fullOptions.useGeometryUniqueIdsMap = true;
@@ -859,29 +863,60 @@ void Scene::set_pointerY(int value)
   _pointerY = value;
 }
 
-std::vector<AbstractMesh*> Scene::_getDefaultMeshCandidates()
+const std::vector<AbstractMesh*>& Scene::_getDefaultMeshCandidates()
 {
-  _defaultMeshCandidates = stl_util::to_raw_ptr_vector(meshes);
+  // Refill the cached list in place so that its capacity is reused from one frame to the next
+  _defaultMeshCandidates.clear();
+  for (const auto& mesh : meshes) {
+    _defaultMeshCandidates.emplace_back(mesh.get());
+  }
   return _defaultMeshCandidates;
 }
 
-std::vector<SubMesh*> Scene::_getDefaultSubMeshCandidates(AbstractMesh* mesh)
+namespace {
+
+const std::vector<SubMesh*>& fillSubMeshCandidates(AbstractMesh* mesh,
+                                                   std::vector<SubMesh*>& candidates)
+{
+  candidates.clear();
+  for (const auto& subMesh : mesh->subMeshes) {
+    candidates.emplace_back(subMesh.get());
+  }
+  return candidates;
+}
+
+} // end of anonymous namespace
+
+const std::vector<SubMesh*>& Scene::_getDefaultActiveSubMeshCandidates(AbstractMesh* mesh)
+{
+  return fillSubMeshCandidates(mesh, _defaultActiveSubMeshCandidates);
+}
+
+const std::vector<SubMesh*>& Scene::_getDefaultIntersectingSubMeshCandidates(AbstractMesh* mesh)
+{
+  return fillSubMeshCandidates(mesh, _defaultIntersectingSubMeshCandidates);
+}
+
+const std::vector<SubMesh*>& Scene::_getDefaultCollidingSubMeshCandidates(AbstractMesh* mesh)
 {
-  _defaultSubMeshCandidates = stl_util::to_raw_ptr_vector(mesh->subMeshes);
-  return _defaultSubMeshCandidates;
+  return fillSubMeshCandidates(mesh, _defaultCollidingSubMeshCandidates);
 }
 
 void Scene::setDefaultCandidateProviders()
 {
-  getActiveMeshCandidates = [this]() { return _getDefaultMeshCandidates(); };
+  getActiveMeshCandidates
+    = [this]() -> const std::vector<AbstractMesh*>& { return _getDefaultMeshCandidates(); };
 
-  getActiveSubMeshCandidates
-    = [this](AbstractMesh* mesh) { return _getDefaultSubMeshCandidates(mesh); };
-  getIntersectingSubMeshCandidates = [this](AbstractMesh* mesh, const Ray& /*localRay*/) {
-    return _getDefaultSubMeshCandidates(mesh);
+  getActiveSubMeshCandidates = [this](AbstractMesh* mesh) -> const std::vector<SubMesh*>& {
+    return _getDefaultActiveSubMeshCandidates(mesh);
   };
-  getCollidingSubMeshCandidates = [this](AbstractMesh* mesh, const Collider& /*collider*/) {
-    return _getDefaultSubMeshCandidates(mesh);
+  getIntersectingSubMeshCandidates
+    = [this](AbstractMesh* mesh, const Ray& /*localRay*/) -> const std::vector<SubMesh*>& {
+    return _getDefaultIntersectingSubMeshCandidates(mesh);
+  };
+  getCollidingSubMeshCandidates
+    = [this](AbstractMesh* mesh, const Collider& /*collider*/) -> const std::vector<SubMesh*>& {
+    return _getDefaultCollidingSubMeshCandidates(mesh);
   };
 }
 
@@ -2153,8 +2188,11 @@ void Scene::_animate()
   const auto& animationTime = _animationTime;
 
   // We make a copy of "animatables" because animatable->_animate can suppress
-  // elements from "animatables"
-  auto animatables_copy = animatables;
+  // elements from "animatables". The copy is allocated from the frame arena.
+  auto& frameArena = _engine->frameArena();
+  FrameArena::Scope frameScope{frameArena};
+  FrameVector<AnimatablePtr> animatables_copy{animatables.begin(), animatables.end(),
+                                              FrameAllocator<AnimatablePtr>{frameArena}};
   for (const auto& animatable : animatables_copy) {
     if (animatable) {
       if (!animatable->_animate(std::chrono::milliseconds(animationTime))
@@ -3494,7 +3532,7 @@ void Scene::_evaluateActiveMeshes()
   }
 
   // Determine mesh candidates
-  auto _meshes = getActiveMeshCandidates();
+  const auto& _meshes = getActiveMeshCandidates();
 
   // Check each mesh
   for (const auto& mesh : _meshes) {
@@ -3510,14 +3548,11 @@ void Scene::_evaluateActiveMeshes()
 
     mesh->computeWorldMatrix();
 
-    // Intersections
+    // Intersections, the duplicates are skipped when checking them
     if (mesh->actionManager
         && mesh->actionManager->hasSpecificTriggers2(ActionManager::OnIntersectionEnterTrigger,
                                                      ActionManager::OnIntersectionExitTrigger)) {
-      if (std::find(_meshesForIntersections.begin(), _meshesForIntersections.end(), mesh)
-          == _meshesForIntersections.end()) {
-        _meshesForIntersections.emplace_back(mesh);
-      }
+      _meshesForIntersections.emplace_back(mesh);
     }
 
     // Switch to current LOD
@@ -3589,7 +3624,7 @@ void Scene::_activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh)
   }
 
   if (mesh && !mesh->subMeshes.empty()) {
-    auto subMeshes = getActiveSubMeshCandidates(mesh);
+    const auto& subMeshes = getActiveSubMeshCandidates(mesh);
     for (const auto& subMesh : subMeshes) {
       _evaluateSubMesh(subMesh, mesh, sourceMesh);
     }
@@ -3771,8 +3806,156 @@ void Scene::_processSubCameras(const CameraPtr& camera)
   setTransformMatrix(_activeCamera->getViewMatrix(), _activeCamera->getProjectionMatrix());
 }
 
+bool Scene::_getIntersectionTriggerMesh(IAction& action, AbstractMesh*& mesh)
+{
+  mesh          = nullptr;
+  auto& options = action.triggerOptions;
+  if (auto triggerMesh = options.mesh.lock(); triggerMesh && !triggerMesh->isDisposed()) {
+    mesh = triggerMesh.get();
+    return true;
+  }
+
+  // Without parameter, the trigger checks all the meshes, unless its mesh was disposed
+  const auto parameter = action.getTriggerParameter();
+  if (parameter.empty()) {
+    const std::weak_ptr<AbstractMesh> noMesh;
+    return !options.mesh.owner_before(noMesh) && !noMesh.owner_before(options.mesh);
+  }
+
+  auto triggerMesh = getMeshByName(parameter);
+  options.mesh     = triggerMesh;
+  mesh             = triggerMesh.get();
+  return mesh != nullptr;
+}
+
 void Scene::_checkIntersections()
 {
+  if (_meshesForIntersections.empty()) {
+    return;
+  }
+
+  const auto isIntersectionTrigger = [](unsigned int trigger) {
+    return trigger == ActionManager::OnIntersectionEnterTrigger
+           || trigger == ActionManager::OnIntersectionExitTrigger;
+  };
+
+  if (!_intersectionBroadphase) {
+    _intersectionBroadphase = std::make_unique<SweepAndPrune>();
+  }
+  auto& broadphase = *_intersectionBroadphase;
+  broadphase.clear();
+  _intersectionBoxIndices.clear();
+  _intersectionBoxMeshes.clear();
+
+  // Broadphase of the world bounding boxes of the meshes with intersection triggers and of the
+  // meshes they check
+  const auto addBox = [this, &broadphase](AbstractMesh* mesh) {
+    if (_intersectionBoxIndices.find(mesh) != _intersectionBoxIndices.end()) {
+      return;
+    }
+    const auto& boundingBox       = mesh->getBoundingInfo()->boundingBox;
+    const auto& minimum           = boundingBox.minimumWorld;
+    const auto& maximum           = boundingBox.maximumWorld;
+    _intersectionBoxIndices[mesh] = broadphase.addBox(
+      {{minimum.x, minimum.y, minimum.z}, {maximum.x, maximum.y, maximum.z}});
+    _intersectionBoxMeshes.emplace_back(mesh);
+  };
+  for (const auto& sourceMesh : _meshesForIntersections) {
+    addBox(sourceMesh);
+  }
+  // The first boxes are the meshes with intersection triggers, without duplicates
+  const auto sourceCount = _intersectionBoxMeshes.size();
+  for (size_t sourceIndex = 0; sourceIndex < sourceCount; ++sourceIndex) {
+    for (const auto& action : _intersectionBoxMeshes[sourceIndex]->actionManager->actions) {
+      AbstractMesh* otherMesh = nullptr;
+      if (isIntersectionTrigger(action->trigger)
+          && _getIntersectionTriggerMesh(*action, otherMesh) && otherMesh) {
+        addBox(otherMesh);
+      }
+    }
+  }
+  broadphase.update();
+
+  for (size_t sourceIndex = 0; sourceIndex < sourceCount; ++sourceIndex) {
+    // Kept alive in case the actions dispose the mesh
+    auto sourceMesh = _intersectionBoxMeshes[sourceIndex];
+    const auto source
+      = std::static_pointer_cast<AbstractMesh>(sourceMesh->shared_from_this());
+    const auto actionManager = sourceMesh->actionManager;
+    auto& actions            = actionManager->actions;
+
+    // Meshes to check, with the precise test if any trigger asks for it
+    _intersectionCandidates.clear();
+    const auto addCandidate = [this, sourceMesh](AbstractMesh* mesh, bool precise) {
+      if (mesh == sourceMesh) {
+        return;
+      }
+      auto it = std::find_if(_intersectionCandidates.begin(), _intersectionCandidates.end(),
+                             [mesh](const auto& candidate) { return candidate.first == mesh; });
+      if (it == _intersectionCandidates.end()) {
+        _intersectionCandidates.emplace_back(mesh, precise);
+      }
+      else {
+        it->second = it->second || precise;
+      }
+    };
+    for (const auto& action : actions) {
+      AbstractMesh* otherMesh = nullptr;
+      if (!isIntersectionTrigger(action->trigger)
+          || !_getIntersectionTriggerMesh(*action, otherMesh)) {
+        continue;
+      }
+      const auto precise = action->triggerOptions.usePreciseIntersection;
+      if (otherMesh) {
+        addCandidate(otherMesh, precise);
+      }
+      else {
+        for (const auto index : broadphase.overlaps(sourceIndex)) {
+          addCandidate(_intersectionBoxMeshes[index], precise);
+        }
+      }
+    }
+    // Intersections in progress are checked to detect their exit
+    for (const auto& mesh : sourceMesh->_intersectionsInProgress) {
+      addCandidate(mesh, false);
+    }
+
+    // Only the pairs found by the broadphase need the precise test, the state of each pair
+    // persists across frames in the intersections in progress
+    for (const auto& [otherMesh, usePreciseIntersection] : _intersectionCandidates) {
+      const auto otherIndex = _intersectionBoxIndices.find(otherMesh);
+      const auto areIntersecting
+        = otherIndex != _intersectionBoxIndices.end()
+          && broadphase.overlap(sourceIndex, otherIndex->second)
+          && sourceMesh->intersectsMesh(*otherMesh, usePreciseIntersection);
+      auto& intersectionsInProgress = sourceMesh->_intersectionsInProgress;
+      auto currentIntersectionInProgress
+        = std::find(intersectionsInProgress.begin(), intersectionsInProgress.end(), otherMesh);
+      const auto wasIntersecting = currentIntersectionInProgress != intersectionsInProgress.end();
+      if (areIntersecting == wasIntersecting) {
+        continue;
+      }
+      if (areIntersecting) {
+        intersectionsInProgress.emplace_back(otherMesh);
+      }
+      else {
+        intersectionsInProgress.erase(currentIntersectionInProgress);
+      }
+
+      // The actions may modify the list of actions
+      const auto trigger = areIntersecting ? ActionManager::OnIntersectionEnterTrigger :
+                                             ActionManager::OnIntersectionExitTrigger;
+      for (size_t index = 0; index < actions.size(); ++index) {
+        auto action               = actions[index];
+        AbstractMesh* triggerMesh = nullptr;
+        if (action->trigger != trigger || !_getIntersectionTriggerMesh(*action, triggerMesh)
+            || (triggerMesh && triggerMesh != otherMesh)) {
+          continue;
+        }
+        action->_executeCurrent(ActionEvent::CreateNew(source, std::nullopt, otherMesh->name));
+      }
+    }
+  }
 }
 
 void Scene::animate()
@@ -4040,7 +4223,7 @@ std::optional<bool>& Scene::get_headphone()
     _addComponent(compo);
   }
 
-  headphone = compo->headphone();
+  _headphone = compo->headphone();
 
   return _headphone;
 }
@@ -4062,7 +4245,7 @@ void Scene::set_headphone(const std::optional<bool>& value)
     compo->switchAudioModeForHeadphones();
   }
   else {
-    compo->switchAudioModeForHeadphones();
+    compo->switchAudioModeForNormalSpeakers();
   }
 }
 
@@ -1282,6 +1282,11 @@ bool ThinEngine::_releaseBuffer(const WebGLDataBufferPtr& buffer)
 
 void ThinEngine::_deleteBuffer(const WebGLDataBufferPtr& buffer)
 {
+  // The null engine has no context
+  if (!_gl) {
+    return;
+  }
+
   _gl->deleteBuffer(buffer->underlyingResource().get());
 }
 
@@ -2596,6 +2601,7 @@ void ThinEngine::_setupDepthStencilTexture(const InternalTexturePtr& internalTex
                                                       Constants::TEXTURE_NEAREST_SAMPLINGMODE;
   internalTexture->type                = Constants::TEXTURETYPE_UNSIGNED_INT;
   internalTexture->_comparisonFunction = comparisonFunction;
+  internalTexture->_updateMemoryEstimate();
 
   auto& gl                = *_gl;
   auto target             = internalTexture->isCube ? GL::TEXTURE_CUBE_MAP : GL::TEXTURE_2D;
@@ -2718,6 +2724,8 @@ void ThinEngine::_prepareWebGLTextureContinuation(const InternalTexturePtr& text
 
   _bindTextureDirectly(GL::TEXTURE_2D, nullptr);
 
+  texture->_updateMemoryEstimate();
+
   // resetTextureCache();
   if (scene) {
     scene->_removePendingData(texture);
@@ -1,5 +1,7 @@
 #include <babylon/instrumentation/engine_instrumentation.h>
 
+#include <nlohmann/json.hpp>
+
 #include <babylon/engines/engine.h>
 
 namespace BABYLON {
@@ -125,4 +127,19 @@ void EngineInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMateria
   _engine = nullptr;
 }
 
+size_t EngineInstrumentation::getMemoryUsage(MemoryCategory category) const
+{
+  return MemoryTracker::GetBytes(category);
+}
+
+size_t EngineInstrumentation::getPeakMemoryUsage(MemoryCategory category) const
+{
+  return MemoryTracker::GetPeakBytes(category);
+}
+
+json EngineInstrumentation::serializeMemoryUsage() const
+{
+  return MemoryTracker::Serialize();
+}
+
 } // end of namespace BABYLON
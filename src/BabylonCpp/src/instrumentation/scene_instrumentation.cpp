@@ -1,9 +1,23 @@
 #include <babylon/instrumentation/scene_instrumentation.h>
 
+#include <unordered_set>
+
+#include <nlohmann/json.hpp>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_group.h>
+#include <babylon/animations/targeted_animation.h>
+#include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/materials/material.h>
+#include <babylon/materials/textures/base_texture.h>
+#include <babylon/materials/textures/internal_texture.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/geometry.h>
 #include <babylon/misc/tools.h>
+#include <babylon/particles/particle_system.h>
 
 namespace BABYLON {
 
@@ -530,4 +544,94 @@ void SceneInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMaterial
   scene = nullptr;
 }
 
+size_t SceneInstrumentation::getMemoryUsage(MemoryCategory category) const
+{
+  return _computeMemoryUsage()[static_cast<size_t>(category)];
+}
+
+json SceneInstrumentation::serializeMemoryUsage() const
+{
+  const auto usage = _computeMemoryUsage();
+
+  size_t totalBytes = 0;
+  auto categories   = json::object();
+  for (size_t i = 0; i < MemoryTracker::CategoryCount; ++i) {
+    categories[MemoryTracker::GetCategoryName(static_cast<MemoryCategory>(i))] = usage[i];
+    totalBytes += usage[i];
+  }
+
+  return {
+    {"trackedBytes", totalBytes},
+    {"categories", categories},
+  };
+}
+
+std::array<size_t, MemoryTracker::CategoryCount> SceneInstrumentation::_computeMemoryUsage() const
+{
+  std::array<size_t, MemoryTracker::CategoryCount> usage{};
+  if (!scene) {
+    return usage;
+  }
+
+  const auto accumulate = [&usage](const TrackedMemory& memory) {
+    usage[static_cast<size_t>(memory.category())] += memory.bytes();
+  };
+
+  // Geometries
+  for (const auto& geometry : scene->geometries) {
+    accumulate(geometry->_vertexDataMemory);
+    accumulate(geometry->_indexDataMemory);
+  }
+
+  // Textures (internal textures can be shared by several textures)
+  std::unordered_set<InternalTexture*> internalTextures;
+  for (const auto& texture : scene->textures) {
+    const auto& internalTexture = texture ? texture->getInternalTexture() : nullptr;
+    if (internalTexture && internalTextures.insert(internalTexture.get()).second) {
+      accumulate(internalTexture->_gpuMemory);
+    }
+  }
+
+  // Animations (the same animation can be referenced by the scene, nodes and animation groups)
+  std::unordered_set<Animation*> animations;
+  const auto addAnimations = [&animations](const std::vector<AnimationPtr>& list) {
+    for (const auto& animation : list) {
+      if (animation) {
+        animations.insert(animation.get());
+      }
+    }
+  };
+  addAnimations(scene->animations);
+  for (const auto& mesh : scene->meshes) {
+    addAnimations(mesh->animations);
+  }
+  for (const auto& material : scene->materials) {
+    addAnimations(material->animations);
+  }
+  for (const auto& animationGroup : scene->animationGroups) {
+    for (const auto& targetedAnimation : animationGroup->targetedAnimations()) {
+      if (targetedAnimation && targetedAnimation->animation) {
+        animations.insert(targetedAnimation->animation.get());
+      }
+    }
+  }
+  for (const auto& animation : animations) {
+    accumulate(animation->_keysMemory);
+  }
+
+  // Skeletons
+  for (const auto& skeleton : scene->skeletons) {
+    accumulate(skeleton->_transformMatricesMemory);
+  }
+
+  // Particle systems
+  for (const auto& system : scene->particleSystems) {
+    if (auto particleSystem = std::dynamic_pointer_cast<ParticleSystem>(system)) {
+      accumulate(particleSystem->_vertexDataMemory);
+    }
+  }
+
+  return usage;
+}
+
 } // end of namespace BABYLON
@@ -70,6 +70,7 @@ GLTFLoader::GLTFLoader(GLTFFileLoader& parent)
     , _babylonScene{nullptr}
     , _rootBabylonMesh{nullptr}
     , _progressCallback{nullptr}
+    , _stagingMemory{MemoryCategory::LoaderStagingBuffers}
 {
 }
 
@@ -97,6 +98,23 @@ MeshPtr GLTFLoader::rootBabylonMesh()
 
 void GLTFLoader::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
+  if (_disposed) {
+    return;
+  }
+
+  _disposed = true;
+
+  // Release the binary data loaded from the file, the babylon objects hold their own copy
+  if (_gltf) {
+    for (auto& buffer : _gltf->buffers) {
+      buffer._data = ArrayBufferView();
+    }
+    for (auto& bufferView : _gltf->bufferViews) {
+      bufferView._data = ArrayBufferView();
+    }
+  }
+  _bin = std::nullopt;
+  _stagingMemory.release();
 }
 
 ImportedMeshes GLTFLoader::importMeshAsync(
@@ -255,6 +273,7 @@ void GLTFLoader::_loadData(const IGLTFLoaderData& data)
       }
 
       _bin = data.bin;
+      _stagingMemory.add(_bin->byteLength());
     }
     else {
       BABYLON_LOG_WARN("GLTFLoader", "Unexpected BIN chunk")
@@ -1405,6 +1424,7 @@ ArrayBufferView& GLTFLoader::_loadBufferAsync(const std::string& context, IBuffe
   }
 
   buffer._data = loadUriAsync(StringTools::printf("%s/uri", context.c_str()), buffer.uri);
+  _stagingMemory.add(buffer._data.byteLength());
 
   return buffer._data;
 }
@@ -1425,6 +1445,7 @@ ArrayBufferView& GLTFLoader::loadBufferViewAsync(const std::string& context,
     bufferView._data = stl_util::to_array<uint8_t>(
       data.uint8Array(), data.byteOffset + (bufferView.byteOffset.value_or(0)),
       bufferView.byteLength);
+    _stagingMemory.add(bufferView._data.byteLength());
   }
   catch (const std::exception& e) {
     throw std::runtime_error(StringTools::printf("%s: %s", context.c_str(), e.what()));
@@ -968,7 +968,7 @@ void BackgroundMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subM
   if (!definesTmp) {
     return;
   }
-  auto defines = *definesTmp;
+  auto& defines = *definesTmp;
 
   auto effect = subMesh->effect();
   if (!effect) {
@@ -1022,7 +1022,7 @@ void BackgroundMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subM
         _uniformBuffer->updateFloat("pointSize", pointSize);
       }
 
-      if (defines.boolDef["USEHIGHLIGHTANDSHADOWCOLORS"]) {
+      if (defines["USEHIGHLIGHTANDSHADOWCOLORS"]) {
         _uniformBuffer->updateColor4("vPrimaryColor", _primaryHighlightColor, 1.f, "");
         _uniformBuffer->updateColor4("vPrimaryColorShadow", _primaryShadowColor, 1.f, "");
       }
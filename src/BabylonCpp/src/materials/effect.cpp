@@ -50,6 +50,7 @@ Effect::Effect(
     , _pipelineContext{nullptr}
     , vertexSourceCode{this, &Effect::get_vertexSourceCode}
     , fragmentSourceCode{this, &Effect::get_fragmentSourceCode}
+    , _sourceCodeMemory{MemoryCategory::EffectCache}
     , _onCompileObserver{nullptr}
     , _isReady{false}
     , _compilationError{""}
@@ -201,6 +202,7 @@ void Effect::_useFinalCode(
     _vertexSourceCode   = migratedVertexCode;
     _fragmentSourceCode = migratedFragmentCode;
   }
+  _updateSourceCodeMemory();
   _prepareEffect();
 }
 
@@ -429,6 +431,7 @@ void Effect::_rebuildProgram(
     }
   };
   _fallbacks = nullptr;
+  _updateSourceCodeMemory();
   _prepareEffect();
 }
 
@@ -471,7 +474,8 @@ void Effect::_prepareEffect()
 
         _attributes = engine->getAttributes(_pipelineContext, attributesNames);
         if (!attributesNames.empty()) {
-          for (size_t i = 0; i < attributesNames.size(); ++i) {
+          // The null engine does not return any attribute location
+          for (size_t i = 0; i < std::min(attributesNames.size(), _attributes.size()); ++i) {
             _attributeLocationByName[attributesNames[i]] = _attributes[i];
           }
         }
@@ -930,7 +934,10 @@ Effect& Effect::setMatrices(const std::string& uniformName, Float32Array matrice
 Effect& Effect::setMatrix(const std::string& uniformName, const Matrix& matrix)
 {
   if (_cacheMatrix(uniformName, matrix)) {
-    _engine->setMatrices(getUniform(uniformName), matrix.toArray());
+    // Reuse the upload buffer instead of copying the matrix into a new array
+    thread_local Float32Array matrixArray(16);
+    std::copy(matrix.m().begin(), matrix.m().end(), matrixArray.begin());
+    _engine->setMatrices(getUniform(uniformName), matrixArray);
   }
 
   return *this;
@@ -1061,9 +1068,16 @@ Effect& Effect::setDirectColor4(const std::string& uniformName, const Color4& co
   return *this;
 }
 
+void Effect::_updateSourceCodeMemory()
+{
+  _sourceCodeMemory.set(_vertexSourceCode.size() + _fragmentSourceCode.size()
+                        + _vertexSourceCodeOverride.size() + _fragmentSourceCodeOverride.size());
+}
+
 void Effect::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
   _engine->_releaseEffect(this);
+  _sourceCodeMemory.release();
 }
 
 void Effect::RegisterShader(const std::string& name, const std::optional<std::string>& pixelShader,
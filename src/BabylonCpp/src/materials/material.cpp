@@ -180,8 +180,7 @@ void Material::setProperty(const std::vector<std::string>& /*targetPropertyPath*
 
 void Material::addMaterialToScene(const MaterialPtr& newMaterial)
 {
-  _scene->materials.emplace_back(newMaterial);
-  _scene->onNewMaterialAddedObservable.notifyObservers(newMaterial.get());
+  _scene->addMaterial(newMaterial);
 }
 
 void Material::addMultiMaterialToScene(const MultiMaterialPtr& newMultiMaterial)
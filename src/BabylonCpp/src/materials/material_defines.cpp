@@ -117,7 +117,8 @@ MaterialDefines::~MaterialDefines() = default;
 
 bool MaterialDefines::operator[](const std::string& define) const
 {
-  return stl_util::contains(boolDef, define) && boolDef.at(define);
+  const auto it = boolDef.find(define);
+  return it != boolDef.end() && it->second;
 }
 
 bool MaterialDefines::operator==(const MaterialDefines& rhs) const
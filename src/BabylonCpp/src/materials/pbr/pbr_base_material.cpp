@@ -1092,7 +1092,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
   if (!definesTmp) {
     return;
   }
-  auto defines = *definesTmp;
+  auto& defines = *definesTmp;
 
   auto effect = subMesh->effect();
   if (!effect) {
@@ -1410,7 +1410,8 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
     MaterialHelper::BindFogParameters(scene, mesh, _activeEffect, true);
 
     // Morph targets
-    if (defines.intDef["NUM_MORPH_INFLUENCERS"]) {
+    static const std::string numMorphInfluencers{"NUM_MORPH_INFLUENCERS"};
+    if (defines.intDef[numMorphInfluencers]) {
       MaterialHelper::BindMorphTargetParameters(mesh, _activeEffect);
     }
 
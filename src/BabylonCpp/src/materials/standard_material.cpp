@@ -1003,7 +1003,7 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
   if (!definesTmp) {
     return;
   }
-  auto defines = *definesTmp;
+  auto& defines = *definesTmp;
 
   auto effect = subMesh->effect();
   if (!effect) {
@@ -1016,8 +1016,9 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
     bindOnlyWorldMatrix(world);
   }
 
-  // Normal Matrix
-  if (defines["OBJECTSPACE_NORMALMAP"]) {
+  // Normal Matrix (the define name is longer than the small string buffer)
+  static const std::string objectSpaceNormalMap{"OBJECTSPACE_NORMALMAP"};
+  if (defines[objectSpaceNormalMap]) {
     world.toNormalMatrix(_normalMatrix);
     bindOnlyNormalMatrix(_normalMatrix);
   }
@@ -1252,7 +1253,8 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
     MaterialHelper::BindFogParameters(scene, mesh, effect);
 
     // Morph targets
-    if (defines.intDef["NUM_MORPH_INFLUENCERS"]) {
+    static const std::string numMorphInfluencers{"NUM_MORPH_INFLUENCERS"};
+    if (defines.intDef[numMorphInfluencers]) {
       MaterialHelper::BindMorphTargetParameters(mesh, effect);
     }
 
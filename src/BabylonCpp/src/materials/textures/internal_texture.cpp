@@ -65,6 +65,7 @@ InternalTexture::InternalTexture(ThinEngine* engine, InternalTextureSource sourc
     , _irradianceTexture{nullptr}
     , _webGLTexture{nullptr}
     , _references{1}
+    , _gpuMemory{MemoryCategory::Textures}
     , _engine{engine}
 {
   previous = nullptr;
@@ -103,6 +104,10 @@ void InternalTexture::updateSize(int iWidth, int iHeight, int iDepth)
   baseDepth  = iDepth;
 
   _size = width * height * depth;
+
+  if (isReady) {
+    _updateMemoryEstimate();
+  }
 }
 
 void InternalTexture::_rebuild()
@@ -317,7 +322,100 @@ void InternalTexture::dispose()
   if (_references == 0) {
     _engine->_releaseTexture(shared_from_this());
     _webGLTexture = nullptr;
+    _gpuMemory.release();
+  }
+}
+
+void InternalTexture::_updateMemoryEstimate()
+{
+  // Bytes per channel (or per pixel for the packed types)
+  size_t bytesPerChannel = 1;
+  bool packedType        = false;
+  switch (type) {
+    case Constants::TEXTURETYPE_FLOAT:
+    case Constants::TEXTURETYPE_INT:
+    case Constants::TEXTURETYPE_UNSIGNED_INTEGER:
+      bytesPerChannel = 4;
+      break;
+    case Constants::TEXTURETYPE_HALF_FLOAT:
+    case Constants::TEXTURETYPE_SHORT:
+    case Constants::TEXTURETYPE_UNSIGNED_SHORT:
+      bytesPerChannel = 2;
+      break;
+    case Constants::TEXTURETYPE_UNSIGNED_SHORT_4_4_4_4:
+    case Constants::TEXTURETYPE_UNSIGNED_SHORT_5_5_5_1:
+    case Constants::TEXTURETYPE_UNSIGNED_SHORT_5_6_5:
+      bytesPerChannel = 2;
+      packedType      = true;
+      break;
+    case Constants::TEXTURETYPE_UNSIGNED_INT_2_10_10_10_REV:
+    case Constants::TEXTURETYPE_UNSIGNED_INT_24_8:
+    case Constants::TEXTURETYPE_UNSIGNED_INT_10F_11F_11F_REV:
+    case Constants::TEXTURETYPE_UNSIGNED_INT_5_9_9_9_REV:
+      bytesPerChannel = 4;
+      packedType      = true;
+      break;
+    case Constants::TEXTURETYPE_FLOAT_32_UNSIGNED_INT_24_8_REV:
+      bytesPerChannel = 8;
+      packedType      = true;
+      break;
+    default:
+      break;
+  }
+
+  // Number of channels
+  size_t channels = 4;
+  switch (format) {
+    case Constants::TEXTUREFORMAT_ALPHA:
+    case Constants::TEXTUREFORMAT_LUMINANCE:
+    case Constants::TEXTUREFORMAT_RED:
+    case Constants::TEXTUREFORMAT_RED_INTEGER:
+      channels = 1;
+      break;
+    case Constants::TEXTUREFORMAT_LUMINANCE_ALPHA:
+    case Constants::TEXTUREFORMAT_RG:
+    case Constants::TEXTUREFORMAT_RG_INTEGER:
+      channels = 2;
+      break;
+    case Constants::TEXTUREFORMAT_RGB:
+    case Constants::TEXTUREFORMAT_RGB_INTEGER:
+      channels = 3;
+      break;
+    default:
+      break;
+  }
+
+  // Compressed textures use roughly one byte per pixel (BC3 / ETC2 RGBA / ASTC 4x4)
+  const auto bytesPerPixel
+    = !_compression.empty() ? 1 : (packedType ? bytesPerChannel : bytesPerChannel * channels);
+
+  const auto pixels
+    = static_cast<size_t>(std::max(width, 0)) * static_cast<size_t>(std::max(height, 0));
+  const auto layers
+    = static_cast<size_t>(isCube ? 6 : ((is3D || is2DArray) ? std::max(depth, 1) : 1));
+  auto bytes = pixels * layers * bytesPerPixel;
+
+  // A full mip chain adds a third of the base level
+  if (generateMipMaps) {
+    bytes += bytes / 3;
   }
+
+  // Multisampled render buffers
+  if (samples > 1) {
+    bytes *= samples;
+  }
+
+  // Depth / stencil attachments
+  if (_generateDepthBuffer || _generateStencilBuffer) {
+    bytes += pixels * layers * 4;
+  }
+
+  _gpuMemory.set(bytes);
+}
+
+size_t InternalTexture::getEstimatedMemorySize() const
+{
+  return _gpuMemory.bytes();
 }
 
 } // end of namespace BABYLON
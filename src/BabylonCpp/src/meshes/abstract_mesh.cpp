@@ -745,11 +745,7 @@ void AbstractMesh::set_scaling(const Vector3& newScaling)
 
 AbstractMesh* AbstractMesh::getParent()
 {
-  if (parent()->type() == Type::ABSTRACTMESH) {
-    return dynamic_cast<AbstractMesh*>(parent());
-  }
-
-  return nullptr;
+  return parent() ? dynamic_cast<AbstractMesh*>(parent()) : nullptr;
 }
 
 MaterialPtr AbstractMesh::getMaterial()
@@ -1373,11 +1369,11 @@ AbstractMesh& AbstractMesh::_collideForSubMesh(SubMesh* subMesh, const Matrix& t
 AbstractMesh& AbstractMesh::_processCollisionsForSubMeshes(Collider& iCollider,
                                                            const Matrix& transformMatrix)
 {
-  auto iSubMeshes = _scene->getCollidingSubMeshCandidates(this, iCollider);
-  auto len        = iSubMeshes.size();
+  const auto& iSubMeshes = _scene->getCollidingSubMeshCandidates(this, iCollider);
+  auto len                = iSubMeshes.size();
 
   for (size_t index = 0; index < len; ++index) {
-    auto& subMesh = iSubMeshes[index];
+    const auto& subMesh = iSubMeshes[index];
 
     // Bounding test
     if (len > 1 && !subMesh->_checkCollision(iCollider)) {
@@ -1444,10 +1440,10 @@ PickingInfo AbstractMesh::intersects(Ray& ray, const std::optional<bool>& iFastC
   std::optional<IntersectionInfo> intersectInfo = std::nullopt;
 
   // Octrees
-  auto _subMeshes = _scene->getIntersectingSubMeshCandidates(this, ray);
-  auto len        = _subMeshes.size();
+  const auto& _subMeshes = _scene->getIntersectingSubMeshCandidates(this, ray);
+  auto len                = _subMeshes.size();
   for (size_t index = 0; index < len; ++index) {
-    auto& subMesh = _subMeshes[index];
+    const auto& subMesh = _subMeshes[index];
 
     // Bounding test
     if (len > 1 && !subMesh->canIntersects(ray)) {
@@ -1542,8 +1538,8 @@ void AbstractMesh::dispose(bool doNotRecurse, bool disposeMaterialAndTextures)
     _transformMatrixTexture = nullptr;
   }
 
-  // Intersections in progress
-  for (const auto& other : _intersectionsInProgress) {
+  // Intersections in progress, the meshes checked by intersection triggers do not know about them
+  for (const auto& other : getScene()->meshes) {
     other->_intersectionsInProgress.erase(std::remove(other->_intersectionsInProgress.begin(),
                                                       other->_intersectionsInProgress.end(), this),
                                           other->_intersectionsInProgress.end());
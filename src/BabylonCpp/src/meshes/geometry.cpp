@@ -1,5 +1,7 @@
 #include <babylon/meshes/geometry.h>
 
+#include <algorithm>
+
 #include <babylon/core/json_util.h>
 
 #include <babylon/babylon_stl_util.h>
@@ -26,6 +28,8 @@ namespace BABYLON {
 Geometry::Geometry(const std::string& iId, Scene* scene, VertexData* vertexData, bool updatable,
                    Mesh* mesh)
     : delayLoadState{Constants::DELAYLOADSTATE_NONE}
+    , _vertexDataMemory{MemoryCategory::GeometryVertexData}
+    , _indexDataMemory{MemoryCategory::GeometryIndexData}
     , boundingBias(this, &Geometry::get_boundingBias, &Geometry::set_boundingBias)
     , meshes(this, &Geometry::get_meshes)
     , extend(this, &Geometry::get_extend)
@@ -181,6 +185,7 @@ void Geometry::removeVerticesData(const std::string& kind)
     _vertexBuffers[kind] = nullptr;
     _vertexBuffers.erase(kind);
   }
+  _updateVertexDataMemory();
 }
 
 void Geometry::setVerticesBuffer(const VertexBufferPtr& buffer,
@@ -193,6 +198,7 @@ void Geometry::setVerticesBuffer(const VertexBufferPtr& buffer,
   }
 
   _vertexBuffers[kind] = buffer;
+  _updateVertexDataMemory();
 
   if (kind == VertexBuffer::PositionKind) {
     auto& data = buffer->getData();
@@ -248,6 +254,7 @@ AbstractMesh* Geometry::updateVerticesData(const std::string& kind, const Float3
   }
 
   vertexBuffer->update(data);
+  _updateVertexDataMemory();
 
   if (kind == VertexBuffer::PositionKind) {
     _updateBoundingInfo(updateExtends, data);
@@ -291,13 +298,13 @@ void Geometry::_bind(const EffectPtr& effect, WebGLDataBufferPtr indexToBind)
     indexToBind = _indexBuffer;
   }
 
-  auto vbs = getVertexBuffers();
+  const auto& vbs = getVertexBuffers();
 
   if (vbs.empty()) {
     return;
   }
 
-  if (indexToBind != _indexBuffer /*|| _vertexArrayObjects.empty()*/) {
+  if (indexToBind != _indexBuffer || !_engine->getCaps().vertexArrayObject) {
     _engine->bindBuffers(vbs, indexToBind, effect);
     return;
   }
@@ -368,10 +375,11 @@ VertexBufferPtr Geometry::getVertexBuffer(const std::string& kind)
   return _vertexBuffers[kind];
 }
 
-std::unordered_map<std::string, VertexBufferPtr> Geometry::getVertexBuffers()
+const std::unordered_map<std::string, VertexBufferPtr>& Geometry::getVertexBuffers()
 {
+  static const std::unordered_map<std::string, VertexBufferPtr> noVertexBuffers;
   if (!isReady()) {
-    return std::unordered_map<std::string, VertexBufferPtr>();
+    return noVertexBuffers;
   }
   return _vertexBuffers;
 }
@@ -418,6 +426,7 @@ void Geometry::updateIndices(const IndicesArray& indices, int offset, bool gpuMe
 
     if (!gpuMemoryOnly) {
       _indices = indices;
+      _indexDataMemory.set(_indices.size() * sizeof(IndicesArray::value_type));
     }
     _engine->updateDynamicIndexBuffer(_indexBuffer, indices, offset);
     if (needToUpdateSubMeshes) {
@@ -439,6 +448,7 @@ AbstractMesh* Geometry::setIndices(const IndicesArray& indices, size_t totalVert
 
   _indices                = indices;
   _indexBufferIsUpdatable = updatable;
+  _indexDataMemory.set(_indices.size() * sizeof(IndicesArray::value_type));
   if (!_meshes.empty()) {
     _indexBuffer = _engine->createIndexBuffer(_indices, updatable);
   }
@@ -701,6 +711,26 @@ void Geometry::_disposeVertexArrayObjects()
   }
 }
 
+void Geometry::_updateVertexDataMemory()
+{
+  // Interleaved vertex buffers share the same underlying buffer, it is counted by the first vertex
+  // buffer using it
+  size_t bytes = 0;
+  for (auto it = _vertexBuffers.begin(); it != _vertexBuffers.end(); ++it) {
+    if (!it->second) {
+      continue;
+    }
+    const auto* data        = &it->second->getData();
+    const auto sharedBuffer = std::any_of(_vertexBuffers.begin(), it, [data](const auto& item) {
+      return item.second && &item.second->getData() == data;
+    });
+    if (!sharedBuffer) {
+      bytes += data->size() * sizeof(float);
+    }
+  }
+  _vertexDataMemory.set(bytes);
+}
+
 void Geometry::dispose()
 {
   for (const auto& mesh : _meshes) {
@@ -716,12 +746,14 @@ void Geometry::dispose()
   }
   _vertexBuffers.clear();
   _totalVertices = 0;
+  _vertexDataMemory.release();
 
   if (_indexBuffer) {
     _engine->_releaseBuffer(_indexBuffer);
   }
   _indexBuffer = nullptr;
   _indices.clear();
+  _indexDataMemory.release();
 
   delayLoadState = Constants::DELAYLOADSTATE_NONE;
   delayLoadingFile.clear();
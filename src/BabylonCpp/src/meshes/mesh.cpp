@@ -299,22 +299,22 @@ bool Mesh::get__isMesh() const
   return true;
 }
 
-Observable<Mesh>& Mesh::get_onBeforeRenderObservable()
+SmallObservable<Mesh>& Mesh::get_onBeforeRenderObservable()
 {
   return _internalMeshDataInfo->_onBeforeRenderObservable;
 }
 
-Observable<Mesh>& Mesh::get_onBeforeBindObservable()
+SmallObservable<Mesh>& Mesh::get_onBeforeBindObservable()
 {
   return _internalMeshDataInfo->_onBeforeBindObservable;
 }
 
-Observable<Mesh>& Mesh::get_onAfterRenderObservable()
+SmallObservable<Mesh>& Mesh::get_onAfterRenderObservable()
 {
   return _internalMeshDataInfo->_onAfterRenderObservable;
 }
 
-Observable<Mesh>& Mesh::get_onBeforeDrawObservable()
+SmallObservable<Mesh>& Mesh::get_onBeforeDrawObservable()
 {
   return _internalMeshDataInfo->_onBeforeDrawObservable;
 }
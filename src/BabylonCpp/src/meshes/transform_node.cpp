@@ -10,6 +10,7 @@
 #include <babylon/engines/scene.h>
 #include <babylon/maths/tmp_vectors.h>
 #include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/mesh.h>
 
 namespace BABYLON {
 
@@ -1150,10 +1151,44 @@ float TransformNode::getDistanceToCamera(const CameraPtr& camera)
   }
 }
 
-TransformNodePtr TransformNode::clone(const std::string& /*name*/, Node* /*newParent*/,
-                                      bool /*doNotCloneChildren*/)
+TransformNodePtr TransformNode::clone(const std::string& iName, Node* newParent,
+                                      bool doNotCloneChildren)
 {
-  return nullptr;
+  auto result = TransformNode::New(iName, getScene());
+  result->id  = iName;
+
+  // Transformation
+  result->position = position().copy();
+  result->scaling  = scaling().copy();
+  if (rotationQuaternion()) {
+    result->rotationQuaternion = rotationQuaternion()->copy();
+  }
+  else {
+    result->rotation = rotation().copy();
+  }
+  result->setPivotMatrix(getPivotMatrix());
+  result->billboardMode           = billboardMode();
+  result->infiniteDistance        = infiniteDistance();
+  result->scalingDeterminant      = scalingDeterminant;
+  result->ignoreNonUniformScaling = ignoreNonUniformScaling;
+
+  if (newParent) {
+    result->parent = newParent;
+  }
+
+  if (!doNotCloneChildren) {
+    // Children
+    for (const auto& child : getChildTransformNodes(true)) {
+      if (auto childMesh = std::dynamic_pointer_cast<Mesh>(child)) {
+        childMesh->clone(iName + "." + child->name, result.get());
+      }
+      else {
+        child->clone(iName + "." + child->name, result.get());
+      }
+    }
+  }
+
+  return result;
 }
 
 json TransformNode::serialize(json& /*currentSerializationObject*/)
@@ -6,19 +6,44 @@
 namespace BABYLON {
 
 HardwareScalingOptimization::HardwareScalingOptimization(int iPriority, int iMaximumSize)
-    : SceneOptimization{iPriority}, maximumScale{iMaximumSize}, _currentScale{1}
+    : SceneOptimization{iPriority}
+    , maximumScale{iMaximumSize}
+    , _initialScale{1.f}
+    , _currentScale{1}
 {
 }
 
 HardwareScalingOptimization::~HardwareScalingOptimization() = default;
 
+std::string HardwareScalingOptimization::getDescription() const
+{
+  return "Setting hardware scaling level to " + std::to_string(_currentScale);
+}
+
 bool HardwareScalingOptimization::apply(Scene* scene)
 {
-  ++_currentScale;
+  if (_currentScale == 1) {
+    _initialScale = scene->getEngine()->getHardwareScalingLevel();
+  }
 
-  scene->getEngine()->setHardwareScalingLevel(static_cast<float>(_currentScale));
+  if (_currentScale < maximumScale) {
+    ++_currentScale;
+    scene->getEngine()->setHardwareScalingLevel(_initialScale
+                                                * static_cast<float>(_currentScale));
+  }
 
   return _currentScale >= maximumScale;
 }
 
+bool HardwareScalingOptimization::revert(Scene* scene)
+{
+  if (_currentScale > 1) {
+    --_currentScale;
+    scene->getEngine()->setHardwareScalingLevel(_initialScale
+                                                * static_cast<float>(_currentScale));
+  }
+
+  return _currentScale == 1;
+}
+
 } // end of namespace BABYLON
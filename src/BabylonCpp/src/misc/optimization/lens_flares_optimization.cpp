@@ -11,10 +11,27 @@ LensFlaresOptimization::LensFlaresOptimization(int iPriority)
 
 LensFlaresOptimization::~LensFlaresOptimization() = default;
 
+std::string LensFlaresOptimization::getDescription() const
+{
+  return "Turning lens flares on/off";
+}
+
 bool LensFlaresOptimization::apply(Scene* scene)
 {
+  if (!_wasEnabled) {
+    _wasEnabled = scene->lensFlaresEnabled;
+  }
   scene->lensFlaresEnabled = false;
   return true;
 }
 
+bool LensFlaresOptimization::revert(Scene* scene)
+{
+  if (_wasEnabled) {
+    scene->lensFlaresEnabled = *_wasEnabled;
+    _wasEnabled.reset();
+  }
+  return true;
+}
+
 } // end of namespace BABYLON
@@ -56,6 +56,16 @@ bool MergeMeshesOptimization::_canBeMerged(const AbstractMeshPtr& abstractMesh)
   return true;
 }
 
+std::string MergeMeshesOptimization::getDescription() const
+{
+  return "Merging similar meshes together";
+}
+
+bool MergeMeshesOptimization::canRevert() const
+{
+  return false;
+}
+
 bool MergeMeshesOptimization::apply(Scene* scene)
 {
   return _apply(scene, false);
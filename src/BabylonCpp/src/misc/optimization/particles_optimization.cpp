@@ -11,10 +11,27 @@ ParticlesOptimization::ParticlesOptimization(int iPriority)
 
 ParticlesOptimization::~ParticlesOptimization() = default;
 
+std::string ParticlesOptimization::getDescription() const
+{
+  return "Turning particles on/off";
+}
+
 bool ParticlesOptimization::apply(Scene* scene)
 {
+  if (!_wasEnabled) {
+    _wasEnabled = scene->particlesEnabled;
+  }
   scene->particlesEnabled = false;
   return true;
 }
 
+bool ParticlesOptimization::revert(Scene* scene)
+{
+  if (_wasEnabled) {
+    scene->particlesEnabled = *_wasEnabled;
+    _wasEnabled.reset();
+  }
+  return true;
+}
+
 } // end of namespace BABYLON
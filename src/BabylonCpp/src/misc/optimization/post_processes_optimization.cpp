@@ -11,10 +11,27 @@ PostProcessesOptimization::PostProcessesOptimization(int iPriority)
 
 PostProcessesOptimization::~PostProcessesOptimization() = default;
 
+std::string PostProcessesOptimization::getDescription() const
+{
+  return "Turning post-processes on/off";
+}
+
 bool PostProcessesOptimization::apply(Scene* scene)
 {
+  if (!_wasEnabled) {
+    _wasEnabled = scene->postProcessesEnabled;
+  }
   scene->postProcessesEnabled = false;
   return true;
 }
 
+bool PostProcessesOptimization::revert(Scene* scene)
+{
+  if (_wasEnabled) {
+    scene->postProcessesEnabled = *_wasEnabled;
+    _wasEnabled.reset();
+  }
+  return true;
+}
+
 } // end of namespace BABYLON
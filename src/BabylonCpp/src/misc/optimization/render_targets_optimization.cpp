@@ -11,10 +11,27 @@ RenderTargetsOptimization::RenderTargetsOptimization(int iPriority)
 
 RenderTargetsOptimization::~RenderTargetsOptimization() = default;
 
+std::string RenderTargetsOptimization::getDescription() const
+{
+  return "Turning render targets off";
+}
+
 bool RenderTargetsOptimization::apply(Scene* scene)
 {
+  if (!_wasEnabled) {
+    _wasEnabled = scene->renderTargetsEnabled;
+  }
   scene->renderTargetsEnabled = false;
   return true;
 }
 
+bool RenderTargetsOptimization::revert(Scene* scene)
+{
+  if (_wasEnabled) {
+    scene->renderTargetsEnabled = *_wasEnabled;
+    _wasEnabled.reset();
+  }
+  return true;
+}
+
 } // end of namespace BABYLON
@@ -8,9 +8,24 @@ SceneOptimization::SceneOptimization(int iPriority) : priority{iPriority}
 
 SceneOptimization::~SceneOptimization() = default;
 
+std::string SceneOptimization::getDescription() const
+{
+  return "";
+}
+
 bool SceneOptimization::apply(Scene* /*scene*/)
 {
   return true; // Return true if everything that can be done was applied
 }
 
+bool SceneOptimization::revert(Scene* /*scene*/)
+{
+  return true;
+}
+
+bool SceneOptimization::canRevert() const
+{
+  return true;
+}
+
 } // end of namespace BABYLON
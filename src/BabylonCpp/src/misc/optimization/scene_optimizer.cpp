@@ -1,62 +1,315 @@
 #include <babylon/misc/optimization/scene_optimizer.h>
 
-#include <babylon/engines/engine.h>
+#include <algorithm>
+#include <limits>
+
 #include <babylon/engines/scene.h>
 #include <babylon/misc/optimization/scene_optimization.h>
 
 namespace BABYLON {
 
-void SceneOptimizer::_CheckCurrentState(
-  Scene* scene, SceneOptimizerOptions& options, int currentPriorityLevel,
-  const std::function<void()>& onSuccess,
-  const std::function<void()>& onFailure)
+SceneOptimizer::SceneOptimizer(Scene* scene, const SceneOptimizerOptions& options)
+    : _scene{scene}
+    , _options{options}
+    , _isRunning{false}
+    , _currentPriorityLevel{0}
+    , _frameTimes(std::max(options.frameTimeSampleCount, size_t(1)), 0.f)
+    , _frameTimeIndex{0}
+    , _frameTimeCount{0}
+    , _frameTimeSum{0.f}
+    , _timeSinceLastChange{0.f}
+    , _isWithinBudget{false}
+    , _hasFailed{false}
+    , _renderStart{Time::highresTimepointNow()}
+{
+}
+
+SceneOptimizer::~SceneOptimizer()
+{
+  stop();
+}
+
+int SceneOptimizer::currentPriorityLevel() const
+{
+  return _currentPriorityLevel;
+}
+
+float SceneOptimizer::currentFrameTime() const
 {
-  if (scene->getEngine()->getFps() >= options.targetFrameRate) {
-    if (onSuccess) {
-      onSuccess();
+  return _frameTimeCount > 0 ? _frameTimeSum / static_cast<float>(_frameTimeCount) : 0.f;
+}
+
+float SceneOptimizer::currentFrameRate() const
+{
+  const auto frameTime = currentFrameTime();
+  return frameTime > 0.f ? 1000.f / frameTime : 0.f;
+}
+
+float SceneOptimizer::frameTimeBudget() const
+{
+  return _options.targetFrameRate > 0.f ? 1000.f / _options.targetFrameRate :
+                                          std::numeric_limits<float>::max();
+}
+
+bool SceneOptimizer::isRunning() const
+{
+  return _isRunning;
+}
+
+std::vector<SceneOptimizationPtr> SceneOptimizer::getActiveOptimizations() const
+{
+  std::vector<SceneOptimizationPtr> result;
+  for (const auto& level : _appliedLevels) {
+    for (const auto& optimization : level.optimizations) {
+      if (std::find(result.begin(), result.end(), optimization) == result.end()) {
+        result.emplace_back(optimization);
+      }
     }
+  }
+  return result;
+}
 
+void SceneOptimizer::start()
+{
+  if (_isRunning || !_scene) {
     return;
   }
 
-  // Apply current level of optimizations
-  bool allDone               = true;
-  bool noOptimizationApplied = true;
-  for (auto& optimization : options.optimizations) {
-    if (optimization.priority == currentPriorityLevel) {
-      noOptimizationApplied = false;
-      allDone               = allDone && optimization.apply(scene);
-    }
+  _isRunning = true;
+  _resetFrameTimes();
+
+  // The frame time is measured from the start of the render to its end
+  _beforeAnimationsObserver = _scene->onBeforeAnimationsObservable.add(
+    [this](Scene*, EventState&) { _renderStart = Time::highresTimepointNow(); });
+  _afterRenderObserver = _scene->onAfterRenderObservable.add([this](Scene*, EventState&) {
+    const auto cpuFrameTime = cpuFrameTimeSource ?
+                                cpuFrameTimeSource() :
+                                Time::fpTimeSince<float, std::milli>(_renderStart);
+    const auto gpuFrameTime = gpuFrameTimeSource ? gpuFrameTimeSource() : 0.f;
+    sampleFrame(cpuFrameTime, gpuFrameTime);
+  });
+}
+
+void SceneOptimizer::stop()
+{
+  if (!_isRunning) {
+    return;
+  }
+
+  _isRunning = false;
+  if (_scene) {
+    _scene->onBeforeAnimationsObservable.remove(_beforeAnimationsObserver);
+    _scene->onAfterRenderObservable.remove(_afterRenderObserver);
   }
+}
 
-  // If no optimization was applied, this is a failure :(
-  if (noOptimizationApplied) {
-    if (onFailure) {
-      onFailure();
+void SceneOptimizer::reset()
+{
+  // Optimizations that cannot be reverted stay applied with their level
+  for (auto level = _appliedLevels.rbegin(); level != _appliedLevels.rend(); ++level) {
+    auto& optimizations = level->optimizations;
+    for (auto optimization = optimizations.rbegin(); optimization != optimizations.rend();
+         ++optimization) {
+      if ((*optimization)->canRevert()) {
+        (*optimization)->revert(_scene);
+        _completedOptimizations.erase(optimization->get());
+        onOptimizationRevertedObservable.notifyObservers(optimization->get());
+      }
     }
+    optimizations.erase(std::remove_if(optimizations.begin(), optimizations.end(),
+                                       [](const SceneOptimizationPtr& optimization) {
+                                         return optimization->canRevert();
+                                       }),
+                        optimizations.end());
+  }
+  _appliedLevels.erase(std::remove_if(_appliedLevels.begin(), _appliedLevels.end(),
+                                      [](const AppliedLevel& level) {
+                                        return level.optimizations.empty();
+                                      }),
+                       _appliedLevels.end());
 
+  _currentPriorityLevel = 0;
+  _isWithinBudget       = false;
+  _hasFailed            = false;
+  _resetFrameTimes();
+}
+
+void SceneOptimizer::dispose()
+{
+  stop();
+  onSuccessObservable.clear();
+  onNewOptimizationAppliedObservable.clear();
+  onOptimizationRevertedObservable.clear();
+  onFailureObservable.clear();
+  _scene = nullptr;
+}
+
+void SceneOptimizer::sampleFrame(float cpuFrameTime, float gpuFrameTime)
+{
+  if (!_isRunning) {
     return;
   }
 
+  // Add the frame to the rolling window
+  const auto frameTime = std::max(cpuFrameTime, gpuFrameTime);
+  if (_frameTimeCount == _frameTimes.size()) {
+    _frameTimeSum -= _frameTimes[_frameTimeIndex];
+  }
+  else {
+    ++_frameTimeCount;
+  }
+  _frameTimes[_frameTimeIndex] = frameTime;
+  _frameTimeSum += frameTime;
+  _frameTimeIndex = (_frameTimeIndex + 1) % _frameTimes.size();
+  _timeSinceLastChange += frameTime;
+
+  // Let the scene run for a specific amount of time after a change before checking again
+  if (_frameTimeCount < _frameTimes.size()
+      || _timeSinceLastChange < static_cast<float>(_options.trackerDuration)) {
+    return;
+  }
+
+  const auto averageFrameTime = currentFrameTime();
+  if (!_appliedLevels.empty() && !_appliedLevels.back().frameTimeAfter) {
+    _appliedLevels.back().frameTimeAfter = averageFrameTime;
+  }
+
+  if (averageFrameTime > frameTimeBudget()) {
+    _isWithinBudget = false;
+    _applyNextLevel(averageFrameTime);
+    return;
+  }
+
+  if (!_isWithinBudget) {
+    _isWithinBudget = true;
+    _hasFailed      = false;
+    onSuccessObservable.notifyObservers(this);
+  }
+
+  _revertLastLevel(averageFrameTime);
+}
+
+void SceneOptimizer::_resetFrameTimes()
+{
+  _frameTimeIndex      = 0;
+  _frameTimeCount      = 0;
+  _frameTimeSum        = 0.f;
+  _timeSinceLastChange = 0.f;
+}
+
+bool SceneOptimizer::_applyNextLevel(float frameTime)
+{
+  const auto isPending = [this](const SceneOptimizationPtr& optimization) {
+    return optimization->priority >= _currentPriorityLevel
+           && _completedOptimizations.find(optimization.get())
+                == _completedOptimizations.end();
+  };
+
+  // Find the next priority level with something left to apply
+  auto priority = std::numeric_limits<int>::max();
+  for (const auto& optimization : _options.optimizations) {
+    if (isPending(optimization)) {
+      priority = std::min(priority, optimization->priority);
+    }
+  }
+
+  // If no optimization can be applied, this is a failure :(
+  if (priority == std::numeric_limits<int>::max()) {
+    if (!_hasFailed) {
+      _hasFailed = true;
+      onFailureObservable.notifyObservers(this);
+    }
+    return false;
+  }
+
+  // Apply current level of optimizations
+  AppliedLevel level{priority, {}, frameTime, std::nullopt};
+  auto allDone = true;
+  for (const auto& optimization : _options.optimizations) {
+    if (optimization->priority != priority || !isPending(optimization)) {
+      continue;
+    }
+    if (optimization->apply(_scene)) {
+      _completedOptimizations.insert(optimization.get());
+    }
+    else {
+      allDone = false;
+    }
+    level.optimizations.emplace_back(optimization);
+    onNewOptimizationAppliedObservable.notifyObservers(optimization.get());
+  }
+  _appliedLevels.emplace_back(std::move(level));
+
   // If all optimizations were done, move to next level
-  if (allDone) {
-    ++currentPriorityLevel;
+  _currentPriorityLevel = allDone ? priority + 1 : priority;
+  _resetFrameTimes();
+  return true;
+}
+
+bool SceneOptimizer::_revertLastLevel(float frameTime)
+{
+  // Optimizations that cannot be reverted stay applied, the levels left with only such
+  // optimizations are skipped
+  const auto isRevertible
+    = [](const SceneOptimizationPtr& optimization) { return optimization->canRevert(); };
+  auto levelIt = std::find_if(_appliedLevels.rbegin(), _appliedLevels.rend(),
+                              [&isRevertible](const AppliedLevel& appliedLevel) {
+                                return std::any_of(appliedLevel.optimizations.begin(),
+                                                   appliedLevel.optimizations.end(),
+                                                   isRevertible);
+                              });
+  if (levelIt == _appliedLevels.rend()) {
+    return false;
   }
+  auto& level = *levelIt;
 
-  // Let's the system running for a specific amount of time before checking FPS
-  /*scene->executeWhenReady(void() {
-      setTimeout(() => {
-          SceneOptimizer._CheckCurrentState(scene, options,
-                         currentPriorityLevel, onSuccess, onFailure);
-      }, options.trackerDuration);
-  });*/
+  // The frame time without the level is estimated from the time it saved, and must leave some
+  // headroom in the budget so that the level is not applied again right away
+  const auto savedFrameTime
+    = std::max(level.frameTimeBefore - level.frameTimeAfter.value_or(level.frameTimeBefore), 0.f);
+  if (frameTime + savedFrameTime >= frameTimeBudget() * (1.f - _options.headroom)) {
+    return false;
+  }
+
+  auto& optimizations = level.optimizations;
+  for (auto optimization = optimizations.rbegin(); optimization != optimizations.rend();
+       ++optimization) {
+    if ((*optimization)->canRevert()) {
+      (*optimization)->revert(_scene);
+      _completedOptimizations.erase(optimization->get());
+      onOptimizationRevertedObservable.notifyObservers(optimization->get());
+    }
+  }
+  optimizations.erase(std::remove_if(optimizations.begin(), optimizations.end(), isRevertible),
+                      optimizations.end());
+  _currentPriorityLevel = level.priority;
+  if (optimizations.empty()) {
+    _appliedLevels.erase(std::next(levelIt).base());
+  }
+  _resetFrameTimes();
+  return true;
 }
 
-void SceneOptimizer::OptimizeAsync(Scene* /*scene*/,
-                                   const SceneOptimizerOptions& /*options*/,
-                                   const std::function<void()>& /*Success*/,
-                                   const std::function<void()>& /*onFailure*/)
+SceneOptimizerPtr SceneOptimizer::OptimizeAsync(Scene* scene,
+                                                const SceneOptimizerOptions& options,
+                                                const std::function<void()>& onSuccess,
+                                                const std::function<void()>& onFailure)
 {
+  auto optimizer = SceneOptimizer::New(scene, options);
+
+  if (onSuccess) {
+    optimizer->onSuccessObservable.add(
+      [onSuccess](SceneOptimizer*, EventState&) { onSuccess(); });
+  }
+
+  if (onFailure) {
+    optimizer->onFailureObservable.add(
+      [onFailure](SceneOptimizer*, EventState&) { onFailure(); });
+  }
+
+  optimizer->start();
+
+  return optimizer;
 }
 
 } // end of namespace BABYLON
@@ -13,7 +13,10 @@ namespace BABYLON {
 
 SceneOptimizerOptions::SceneOptimizerOptions(float iTargetFrameRate,
                                              int iTrackerDuration)
-    : targetFrameRate{iTargetFrameRate}, trackerDuration{iTrackerDuration}
+    : targetFrameRate{iTargetFrameRate}
+    , trackerDuration{iTrackerDuration}
+    , frameTimeSampleCount{60}
+    , headroom{0.2f}
 {
 }
 
@@ -29,24 +32,31 @@ operator=(SceneOptimizerOptions&& other) = default;
 
 SceneOptimizerOptions::~SceneOptimizerOptions() = default;
 
+SceneOptimizerOptions&
+SceneOptimizerOptions::addOptimization(const SceneOptimizationPtr& optimization)
+{
+  optimizations.emplace_back(optimization);
+  return *this;
+}
+
 SceneOptimizerOptions
 SceneOptimizerOptions::LowDegradationAllowed(float targetFrameRate)
 {
   SceneOptimizerOptions result(targetFrameRate);
 
   int priority = 0;
-  result.optimizations.emplace_back(MergeMeshesOptimization(priority));
-  result.optimizations.emplace_back(ShadowsOptimization(priority));
-  result.optimizations.emplace_back(LensFlaresOptimization(priority));
+  result.addOptimization(std::make_shared<MergeMeshesOptimization>(priority));
+  result.addOptimization(std::make_shared<ShadowsOptimization>(priority));
+  result.addOptimization(std::make_shared<LensFlaresOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(PostProcessesOptimization(priority));
-  result.optimizations.emplace_back(ParticlesOptimization(priority));
+  result.addOptimization(std::make_shared<PostProcessesOptimization>(priority));
+  result.addOptimization(std::make_shared<ParticlesOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(TextureOptimization(priority, 1024));
+  result.addOptimization(std::make_shared<TextureOptimization>(priority, 1024));
 
   return result;
 }
@@ -57,26 +67,26 @@ SceneOptimizerOptions::ModerateDegradationAllowed(float targetFrameRate)
   SceneOptimizerOptions result(targetFrameRate);
 
   int priority = 0;
-  result.optimizations.emplace_back(MergeMeshesOptimization(priority));
-  result.optimizations.emplace_back(ShadowsOptimization(priority));
-  result.optimizations.emplace_back(LensFlaresOptimization(priority));
+  result.addOptimization(std::make_shared<MergeMeshesOptimization>(priority));
+  result.addOptimization(std::make_shared<ShadowsOptimization>(priority));
+  result.addOptimization(std::make_shared<LensFlaresOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(PostProcessesOptimization(priority));
-  result.optimizations.emplace_back(ParticlesOptimization(priority));
+  result.addOptimization(std::make_shared<PostProcessesOptimization>(priority));
+  result.addOptimization(std::make_shared<ParticlesOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(TextureOptimization(priority, 512));
+  result.addOptimization(std::make_shared<TextureOptimization>(priority, 512));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(RenderTargetsOptimization(priority));
+  result.addOptimization(std::make_shared<RenderTargetsOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(HardwareScalingOptimization(priority, 2));
+  result.addOptimization(std::make_shared<HardwareScalingOptimization>(priority, 2));
 
   return result;
 }
@@ -87,26 +97,26 @@ SceneOptimizerOptions::HighDegradationAllowed(float targetFrameRate)
   SceneOptimizerOptions result(targetFrameRate);
 
   int priority = 0;
-  result.optimizations.emplace_back(MergeMeshesOptimization(priority));
-  result.optimizations.emplace_back(ShadowsOptimization(priority));
-  result.optimizations.emplace_back(LensFlaresOptimization(priority));
+  result.addOptimization(std::make_shared<MergeMeshesOptimization>(priority));
+  result.addOptimization(std::make_shared<ShadowsOptimization>(priority));
+  result.addOptimization(std::make_shared<LensFlaresOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(PostProcessesOptimization(priority));
-  result.optimizations.emplace_back(ParticlesOptimization(priority));
+  result.addOptimization(std::make_shared<PostProcessesOptimization>(priority));
+  result.addOptimization(std::make_shared<ParticlesOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(TextureOptimization(priority, 256));
+  result.addOptimization(std::make_shared<TextureOptimization>(priority, 256));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(RenderTargetsOptimization(priority));
+  result.addOptimization(std::make_shared<RenderTargetsOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(HardwareScalingOptimization(priority, 4));
+  result.addOptimization(std::make_shared<HardwareScalingOptimization>(priority, 4));
 
   return result;
 }
@@ -11,10 +11,27 @@ ShadowsOptimization::ShadowsOptimization(int iPriority)
 
 ShadowsOptimization::~ShadowsOptimization() = default;
 
+std::string ShadowsOptimization::getDescription() const
+{
+  return "Turning shadows on/off";
+}
+
 bool ShadowsOptimization::apply(Scene* scene)
 {
+  if (!_wasEnabled) {
+    _wasEnabled = scene->shadowsEnabled();
+  }
   scene->shadowsEnabled = false;
   return true;
 }
 
+bool ShadowsOptimization::revert(Scene* scene)
+{
+  if (_wasEnabled) {
+    scene->shadowsEnabled = *_wasEnabled;
+    _wasEnabled.reset();
+  }
+  return true;
+}
+
 } // end of namespace BABYLON
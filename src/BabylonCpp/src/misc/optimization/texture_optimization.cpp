@@ -12,6 +12,16 @@ TextureOptimization::TextureOptimization(int iPriority, int iMaximumSize)
 
 TextureOptimization::~TextureOptimization() = default;
 
+std::string TextureOptimization::getDescription() const
+{
+  return "Reducing render target texture size to " + std::to_string(maximumSize);
+}
+
+bool TextureOptimization::canRevert() const
+{
+  return false;
+}
+
 bool TextureOptimization::apply(Scene* scene)
 {
   bool allDone = true;
@@ -0,0 +1,202 @@
+#include <babylon/morph/sparse_morph_target.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include <babylon/core/logging.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/morph/morph_target.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Sorts the deltas by vertex index
+SparseMorphDeltas makeDeltas(const IndicesArray& indices, const Float32Array& deltas,
+                             size_t components)
+{
+  SparseMorphDeltas result;
+  result.components = components;
+  if (deltas.size() != indices.size() * components) {
+    BABYLON_LOGF_ERROR("SparseMorphTarget",
+                       "Invalid sparse deltas: %zu values for %zu indices of %zu components",
+                       deltas.size(), indices.size(), components)
+    return result;
+  }
+
+  std::vector<size_t> order(indices.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&indices](size_t a, size_t b) { return indices[a] < indices[b]; });
+  result.indices.reserve(indices.size());
+  result.values.reserve(deltas.size());
+  for (auto i : order) {
+    result.indices.emplace_back(indices[i]);
+    result.values.insert(result.values.end(), deltas.begin() + i * components,
+                         deltas.begin() + (i + 1) * components);
+  }
+  return result;
+}
+
+// Number of values per vertex of the mesh data
+size_t getStride(const Float32Array& data, size_t vertexCount)
+{
+  return vertexCount > 0 ? data.size() / vertexCount : 0;
+}
+
+} // end of anonymous namespace
+
+SparseMorphDeltas SparseMorphDeltas::FromDense(const Float32Array& target,
+                                               const Float32Array& base, size_t components,
+                                               size_t stride, float epsilon)
+{
+  SparseMorphDeltas result;
+  result.components = components;
+  if (stride < components) {
+    return result;
+  }
+
+  const auto vertexCount = base.size() / stride;
+  if (target.size() != vertexCount * components) {
+    BABYLON_LOG_ERROR("SparseMorphTarget",
+                      "Incompatible target. Targets and mesh must all have the same vertices "
+                      "count.")
+    return result;
+  }
+
+  for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+    const auto targetValues = &target[vertex * components];
+    const auto baseValues   = &base[vertex * stride];
+    bool moved              = false;
+    for (size_t c = 0; c < components; ++c) {
+      moved = moved || std::abs(targetValues[c] - baseValues[c]) > epsilon;
+    }
+    if (moved) {
+      result.indices.emplace_back(static_cast<uint32_t>(vertex));
+      for (size_t c = 0; c < components; ++c) {
+        result.values.emplace_back(targetValues[c] - baseValues[c]);
+      }
+    }
+  }
+  return result;
+}
+
+size_t SparseMorphDeltas::size() const
+{
+  return indices.size();
+}
+
+bool SparseMorphDeltas::empty() const
+{
+  return indices.empty();
+}
+
+bool SparseMorphDeltas::isQuantized() const
+{
+  return !quantizedValues.empty();
+}
+
+void SparseMorphDeltas::quantize()
+{
+  if (values.empty()) {
+    return;
+  }
+
+  float maxValue = 0.f;
+  for (auto value : values) {
+    maxValue = std::max(maxValue, std::abs(value));
+  }
+  constexpr auto MaxQuantized = static_cast<float>(std::numeric_limits<int16_t>::max());
+  scale = maxValue > 0.f ? maxValue / MaxQuantized : 1.f;
+
+  quantizedValues.resize(values.size());
+  const auto inverseScale = 1.f / scale;
+  for (size_t i = 0; i < values.size(); ++i) {
+    quantizedValues[i] = static_cast<int16_t>(
+      std::clamp(std::round(values[i] * inverseScale), -MaxQuantized, MaxQuantized));
+  }
+  Float32Array().swap(values);
+}
+
+size_t SparseMorphDeltas::getByteLength() const
+{
+  return indices.size() * sizeof(uint32_t) + values.size() * sizeof(float)
+         + quantizedValues.size() * sizeof(int16_t);
+}
+
+SparseMorphTarget::SparseMorphTarget(const std::string& iName, float iInfluence)
+    : name{iName}, influence{iInfluence}
+{
+  uvs.components = 2;
+}
+
+SparseMorphTarget::~SparseMorphTarget() = default;
+
+void SparseMorphTarget::setPositions(const IndicesArray& indices, const Float32Array& deltas)
+{
+  positions = makeDeltas(indices, deltas, 3);
+}
+
+void SparseMorphTarget::setNormals(const IndicesArray& indices, const Float32Array& deltas)
+{
+  normals = makeDeltas(indices, deltas, 3);
+}
+
+void SparseMorphTarget::setTangents(const IndicesArray& indices, const Float32Array& deltas)
+{
+  tangents = makeDeltas(indices, deltas, 3);
+}
+
+void SparseMorphTarget::setUVs(const IndicesArray& indices, const Float32Array& deltas)
+{
+  uvs = makeDeltas(indices, deltas, 2);
+}
+
+void SparseMorphTarget::quantize()
+{
+  positions.quantize();
+  normals.quantize();
+  tangents.quantize();
+  uvs.quantize();
+}
+
+size_t SparseMorphTarget::getByteLength() const
+{
+  return positions.getByteLength() + normals.getByteLength() + tangents.getByteLength()
+         + uvs.getByteLength();
+}
+
+SparseMorphTargetPtr SparseMorphTarget::FromMorphTarget(const MorphTargetPtr& target,
+                                                        const MeshPtr& mesh, float epsilon,
+                                                        bool quantize)
+{
+  auto result = SparseMorphTarget::New(target->id, target->influence());
+
+  const auto vertexCount = mesh->getTotalVertices();
+  const auto fromDense   = [&](const Float32Array& targetData, const std::string& kind,
+                             size_t components) {
+    if (targetData.empty() || !mesh->isVerticesDataPresent(kind)) {
+      SparseMorphDeltas deltas;
+      deltas.components = components;
+      return deltas;
+    }
+    const auto base = mesh->getVerticesData(kind);
+    return SparseMorphDeltas::FromDense(targetData, base, components,
+                                        getStride(base, vertexCount), epsilon);
+  };
+  result->positions = fromDense(target->getPositions(), VertexBuffer::PositionKind, 3);
+  result->normals   = fromDense(target->getNormals(), VertexBuffer::NormalKind, 3);
+  result->tangents  = fromDense(target->getTangents(), VertexBuffer::TangentKind, 3);
+  result->uvs       = fromDense(target->getUVs(), VertexBuffer::UVKind, 2);
+
+  if (quantize) {
+    result->quantize();
+  }
+
+  return result;
+}
+
+} // end of namespace BABYLON
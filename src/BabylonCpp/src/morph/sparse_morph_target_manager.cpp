@@ -0,0 +1,295 @@
+#include <babylon/morph/sparse_morph_target_manager.h>
+
+#include <algorithm>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/morph/morph_target_manager.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Vertices per range of the parallel blend
+constexpr size_t VertexGrain = 4096;
+
+// The kernels below are plain loops with a constant number of components so that the compiler
+// unrolls and vectorizes them
+
+// output[indices[i] * stride + c] += weight * values[i * Components + c]
+template <size_t Components>
+void accumulate(const uint32_t* indices, const float* values, size_t count, float weight,
+                size_t stride, float* output)
+{
+  for (size_t i = 0; i < count; ++i) {
+    auto vertex       = output + indices[i] * stride;
+    const auto deltas = values + i * Components;
+    for (size_t c = 0; c < Components; ++c) {
+      vertex[c] += weight * deltas[c];
+    }
+  }
+}
+
+// Same as accumulate, the weight including the scale of the quantized values
+template <size_t Components>
+void accumulateQuantized(const uint32_t* indices, const int16_t* values, size_t count,
+                         float weight, size_t stride, float* output)
+{
+  for (size_t i = 0; i < count; ++i) {
+    auto vertex       = output + indices[i] * stride;
+    const auto deltas = values + i * Components;
+    for (size_t c = 0; c < Components; ++c) {
+      vertex[c] += weight * static_cast<float>(deltas[c]);
+    }
+  }
+}
+
+// Adds the deltas of the vertices in [beginVertex, endVertex)
+void accumulateRange(const SparseMorphDeltas& deltas, float influence, size_t beginVertex,
+                     size_t endVertex, size_t stride, float* output)
+{
+  const auto& vertices = deltas.indices;
+  const auto first
+    = std::lower_bound(vertices.begin(), vertices.end(), static_cast<uint32_t>(beginVertex));
+  const auto last   = std::lower_bound(first, vertices.end(), static_cast<uint32_t>(endVertex));
+  const auto offset = static_cast<size_t>(first - vertices.begin());
+  const auto count  = static_cast<size_t>(last - first);
+  if (count == 0) {
+    return;
+  }
+
+  const auto indices = deltas.indices.data() + offset;
+  if (deltas.isQuantized()) {
+    const auto values = deltas.quantizedValues.data() + offset * deltas.components;
+    const auto weight = influence * deltas.scale;
+    if (deltas.components == 3) {
+      accumulateQuantized<3>(indices, values, count, weight, stride, output);
+    }
+    else {
+      accumulateQuantized<2>(indices, values, count, weight, stride, output);
+    }
+  }
+  else {
+    const auto values = deltas.values.data() + offset * deltas.components;
+    if (deltas.components == 3) {
+      accumulate<3>(indices, values, count, influence, stride, output);
+    }
+    else {
+      accumulate<2>(indices, values, count, influence, stride, output);
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+SparseMorphTargetManager::SparseMorphTargetManager(const MeshPtr& mesh)
+    : _mesh{mesh}
+    , _scene{mesh->getScene()}
+    , _threadPool{nullptr}
+    , _vertexCount{mesh->getTotalVertices()}
+    , _channels{{
+        {VertexBuffer::PositionKind, &SparseMorphTarget::positions, 0, {}, {}, false, false},
+        {VertexBuffer::NormalKind, &SparseMorphTarget::normals, 0, {}, {}, false, false},
+        {VertexBuffer::TangentKind, &SparseMorphTarget::tangents, 0, {}, {}, false, false},
+        {VertexBuffer::UVKind, &SparseMorphTarget::uvs, 0, {}, {}, false, false},
+      }}
+    , _isDirty{true}
+{
+  for (auto& channel : _channels) {
+    if (_vertexCount > 0 && mesh->isVerticesDataPresent(channel.kind)) {
+      channel.base   = mesh->getVerticesData(channel.kind);
+      channel.stride = channel.base.size() / _vertexCount;
+    }
+  }
+
+  if (_scene) {
+    _beforeRenderObserver
+      = _scene->onBeforeRenderObservable.add([this](Scene*, EventState&) { update(); });
+  }
+}
+
+SparseMorphTargetManager::~SparseMorphTargetManager()
+{
+  dispose();
+}
+
+SparseMorphTargetPtr SparseMorphTargetManager::getTarget(size_t index)
+{
+  if (index < _targets.size()) {
+    return _targets[index];
+  }
+
+  return nullptr;
+}
+
+void SparseMorphTargetManager::addTarget(const SparseMorphTargetPtr& target)
+{
+  _targets.emplace_back(target);
+  _isDirty = true;
+}
+
+void SparseMorphTargetManager::removeTarget(SparseMorphTarget* target)
+{
+  auto it = std::find_if(_targets.begin(), _targets.end(),
+                         [target](const SparseMorphTargetPtr& morphTarget) {
+                           return target == morphTarget.get();
+                         });
+  if (it != _targets.end()) {
+    _targets.erase(it);
+    _isDirty = true;
+  }
+}
+
+size_t SparseMorphTargetManager::numTargets() const
+{
+  return _targets.size();
+}
+
+size_t SparseMorphTargetManager::numInfluencers() const
+{
+  return _activeTargets.size();
+}
+
+size_t SparseMorphTargetManager::getByteLength() const
+{
+  size_t byteLength = 0;
+  for (const auto& target : _targets) {
+    byteLength += target->getByteLength();
+  }
+  return byteLength;
+}
+
+void SparseMorphTargetManager::setThreadPool(ThreadPool* threadPool)
+{
+  _threadPool = threadPool;
+}
+
+bool SparseMorphTargetManager::update()
+{
+  auto mesh = _mesh.lock();
+  if (!mesh || _vertexCount == 0) {
+    return false;
+  }
+
+  // Nothing to blend when the influences did not change
+  auto changed = _isDirty || _blendedInfluences.size() != _targets.size();
+  for (size_t i = 0; i < _targets.size() && !changed; ++i) {
+    changed = _targets[i]->influence != _blendedInfluences[i];
+  }
+  if (!changed) {
+    return false;
+  }
+
+  _blendedInfluences.resize(_targets.size());
+  _activeTargets.clear();
+  _activeInfluences.clear();
+  for (size_t i = 0; i < _targets.size(); ++i) {
+    const auto& target    = _targets[i];
+    _blendedInfluences[i] = target->influence;
+    if (target->influence != 0.f) {
+      _activeTargets.emplace_back(target.get());
+      _activeInfluences.emplace_back(target->influence);
+    }
+  }
+
+  // The buffers morphed by the previous blend are restored even if no target morphs them anymore
+  auto isUpdated = false;
+  for (auto& channel : _channels) {
+    const auto morphed = channel.stride > 0
+                         && std::any_of(_activeTargets.begin(), _activeTargets.end(),
+                                        [&channel](const SparseMorphTarget* target) {
+                                          const auto& deltas = target->*channel.deltas;
+                                          return !deltas.empty()
+                                                 && deltas.components <= channel.stride;
+                                        });
+    channel.isUpdated = morphed || channel.isMorphed;
+    channel.isMorphed = morphed;
+    if (channel.isUpdated) {
+      channel.deformed.resize(channel.base.size());
+      isUpdated = true;
+    }
+  }
+  _isDirty = false;
+  if (!isUpdated) {
+    return false;
+  }
+
+  auto& threadPool = (_threadPool != nullptr ? *_threadPool : ThreadPool::Default());
+  threadPool.parallelFor(_vertexCount, VertexGrain,
+                         [this](size_t begin, size_t end, size_t /*workerIndex*/) {
+                           _blend(begin, end);
+                         });
+
+  for (auto& channel : _channels) {
+    if (!channel.isUpdated) {
+      continue;
+    }
+    if (!mesh->isVertexBufferUpdatable(channel.kind)) {
+      // Recreated once, the submeshes are kept as the number of vertices does not change
+      mesh->markVerticesDataAsUpdatable(channel.kind, true);
+    }
+    mesh->updateVerticesData(channel.kind, channel.deformed);
+  }
+
+  return true;
+}
+
+void SparseMorphTargetManager::_blend(size_t beginVertex, size_t endVertex)
+{
+  for (auto& channel : _channels) {
+    if (!channel.isUpdated) {
+      continue;
+    }
+
+    const auto stride = channel.stride;
+    std::copy(channel.base.begin() + beginVertex * stride,
+              channel.base.begin() + endVertex * stride,
+              channel.deformed.begin() + beginVertex * stride);
+    for (size_t i = 0; i < _activeTargets.size(); ++i) {
+      const auto& deltas = _activeTargets[i]->*channel.deltas;
+      if (!deltas.empty() && deltas.components <= stride) {
+        accumulateRange(deltas, _activeInfluences[i], beginVertex, endVertex, stride,
+                        channel.deformed.data());
+      }
+    }
+  }
+}
+
+void SparseMorphTargetManager::dispose()
+{
+  if (_scene) {
+    _scene->onBeforeRenderObservable.remove(_beforeRenderObserver);
+    _scene = nullptr;
+  }
+
+  if (auto mesh = _mesh.lock()) {
+    for (auto& channel : _channels) {
+      if (channel.isMorphed) {
+        mesh->updateVerticesData(channel.kind, channel.base);
+        channel.isMorphed = false;
+      }
+    }
+  }
+  _mesh.reset();
+}
+
+SparseMorphTargetManagerPtr SparseMorphTargetManager::FromMorphTargetManager(
+  const MorphTargetManagerPtr& morphTargetManager, const MeshPtr& mesh, float epsilon,
+  bool quantize)
+{
+  if (mesh->morphTargetManager() == morphTargetManager) {
+    mesh->morphTargetManager = nullptr;
+  }
+
+  auto result = SparseMorphTargetManager::New(mesh);
+  for (size_t index = 0; index < morphTargetManager->numTargets(); ++index) {
+    result->addTarget(SparseMorphTarget::FromMorphTarget(morphTargetManager->getTarget(index),
+                                                         mesh, epsilon, quantize));
+  }
+
+  return result;
+}
+
+} // end of namespace BABYLON
@@ -48,6 +48,7 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity, Scene*
     , _currentStartSize1{0.f}
     , _currentStartSize2{0.f}
     , _disposeEmitterOnDispose{false}
+    , _vertexDataMemory{MemoryCategory::ParticleBuffers}
     , _newPartsExcess{0}
     , _scaledColorStep{Color4(0.f, 0.f, 0.f, 0.f)}
     , _colorDiff{Color4(0.f, 0.f, 0.f, 0.f)}
@@ -743,6 +744,7 @@ void ParticleSystem::_createVertexBuffers()
   auto engine   = _scene->getEngine();
   _vertexData   = Float32Array(_capacity * _vertexBufferSize * (_useInstancing ? 1 : 4));
   _vertexBuffer = std::make_unique<Buffer>(engine, _vertexData, true, _vertexBufferSize);
+  _vertexDataMemory.set(_vertexData.size() * sizeof(float));
 
   size_t dataOffset = 0;
   auto positions    = _vertexBuffer->createVertexBuffer(VertexBuffer::PositionKind, dataOffset, 3,
@@ -1741,6 +1743,7 @@ void ParticleSystem::dispose(bool disposeTexture, bool /*disposeMaterialAndTextu
     _vertexBuffer->dispose();
     _vertexBuffer = nullptr;
   }
+  _vertexDataMemory.release();
 
   if (_spriteBuffer) {
     _spriteBuffer->dispose();
@@ -21,7 +21,7 @@ PhysicsGravitationalFieldEvent::PhysicsGravitationalFieldEvent(
   _tickCallback
     = [this](Scene* /*scene*/, EventState & /*es*/) -> void { _tick(); };
 
-  PhysicsRadialExplosionEventOptions eventOptions;
+  auto eventOptions     = options;
   eventOptions.strength = options.strength * -1.f;
   _options              = eventOptions;
 }
@@ -73,8 +73,10 @@ void PhysicsGravitationalFieldEvent::_tick()
     auto radialExplosionEvent
       = _physicsHelper->applyRadialExplosionForce(_origin, _options);
     if (radialExplosionEvent) {
-      _sphere = radialExplosionEvent->getData().sphere->clone(
-        "radialExplosionEventSphereClone");
+      const auto sphere = radialExplosionEvent->getData().sphere;
+      if (sphere) {
+        _sphere = sphere->clone("radialExplosionEventSphereClone");
+      }
     }
   }
 }
@@ -53,17 +53,23 @@ PhysicsHelper::applyRadialExplosionImpulse(
     radiusOrEventOptions  = eventOptions;
   }
 
-  auto event = std::make_unique<PhysicsRadialExplosionEvent>(
-    _scene, std::get<PhysicsRadialExplosionEventOptions>(radiusOrEventOptions));
+  const auto& eventOptions
+    = std::get<PhysicsRadialExplosionEventOptions>(radiusOrEventOptions);
+  auto event
+    = std::make_unique<PhysicsRadialExplosionEvent>(_scene, eventOptions);
   std::vector<PhysicsAffectedImpostorWithData> affectedImpostorsWithData;
 
-  for (const auto& impostor : impostors) {
+  // Only the impostors around the explosion are tested
+  const auto& impostorsInSphere
+    = _getImpostorsInSphere(origin, eventOptions.radius);
+  for (const auto& impostor : impostorsInSphere) {
     auto impostorHitData = event->getImpostorHitData(*impostor, origin);
     if (!impostorHitData) {
-      return nullptr;
+      continue;
     }
 
-    impostor->applyForce(impostorHitData->force, impostorHitData->contactPoint);
+    impostor->applyImpulse(impostorHitData->force,
+                           impostorHitData->contactPoint);
 
     affectedImpostorsWithData.emplace_back(PhysicsAffectedImpostorWithData{
       impostor,       // impostor
@@ -105,14 +111,19 @@ PhysicsHelper::applyRadialExplosionForce(
     radiusOrEventOptions  = eventOptions;
   }
 
-  auto event = std::make_unique<PhysicsRadialExplosionEvent>(
-    _scene, std::get<PhysicsRadialExplosionEventOptions>(radiusOrEventOptions));
+  const auto& eventOptions
+    = std::get<PhysicsRadialExplosionEventOptions>(radiusOrEventOptions);
+  auto event
+    = std::make_unique<PhysicsRadialExplosionEvent>(_scene, eventOptions);
   std::vector<PhysicsAffectedImpostorWithData> affectedImpostorsWithData;
 
-  for (const auto& impostor : impostors) {
+  // Only the impostors around the explosion are tested
+  const auto& impostorsInSphere
+    = _getImpostorsInSphere(origin, eventOptions.radius);
+  for (const auto& impostor : impostorsInSphere) {
     auto impostorHitData = event->getImpostorHitData(*impostor, origin);
     if (!impostorHitData) {
-      return nullptr;
+      continue;
     }
 
     impostor->applyForce(impostorHitData->force, impostorHitData->contactPoint);
@@ -234,4 +245,13 @@ PhysicsHelper::vortex(const Vector3& origin,
   return event;
 }
 
+std::vector<PhysicsImpostorPtr>&
+PhysicsHelper::_getImpostorsInSphere(const Vector3& origin, float radius)
+{
+  const Vector3 halfSize{radius, radius, radius};
+  _physicsEngine->getImpostorsInBox(origin.subtract(halfSize),
+                                    origin.add(halfSize), _impostors);
+  return _impostors;
+}
+
 } // end of namespace BABYLON
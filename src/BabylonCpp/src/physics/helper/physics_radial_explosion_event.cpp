@@ -1,6 +1,7 @@
 #include <babylon/physics/helper/physics_radial_explosion_event.h>
 
 #include <babylon/collisions/picking_info.h>
+#include <babylon/culling/bounding_info.h>
 #include <babylon/culling/ray.h>
 #include <babylon/meshes/builders/sphere_builder.h>
 #include <babylon/meshes/mesh.h>
@@ -13,7 +14,11 @@ namespace BABYLON {
 
 PhysicsRadialExplosionEvent::PhysicsRadialExplosionEvent(
   Scene* scene, const PhysicsRadialExplosionEventOptions& options)
-    : _scene{scene}, _options{options}, _sphere{nullptr}, _dataFetched{false}
+    : _scene{scene}
+    , _options{options}
+    , _origin{std::nullopt}
+    , _sphere{nullptr}
+    , _dataFetched{false}
 {
 }
 
@@ -23,6 +28,11 @@ PhysicsRadialExplosionEventData PhysicsRadialExplosionEvent::getData()
 {
   _dataFetched = true;
 
+  // The sphere is only created when the data is fetched
+  if (_origin) {
+    _prepareSphere();
+  }
+
   return {
     _sphere, // sphere
   };
@@ -36,6 +46,8 @@ PhysicsRadialExplosionEvent::getImpostorHitData(PhysicsImpostor& impostor,
     return nullptr;
   }
 
+  _origin = origin;
+
   if (!_intersectsWithSphere(impostor, origin, _options.radius)) {
     return nullptr;
   }
@@ -106,21 +118,30 @@ void PhysicsRadialExplosionEvent::_prepareSphere()
                                           _options.sphere, _scene);
     _sphere->isVisible = false;
   }
+
+  _sphere->position = *_origin;
+  _sphere->scaling  = Vector3(_options.radius * 2.f, _options.radius * 2.f,
+                             _options.radius * 2.f);
+  _sphere->_updateBoundingInfo();
+  _sphere->computeWorldMatrix(true);
 }
 
 bool PhysicsRadialExplosionEvent::_intersectsWithSphere(
   PhysicsImpostor& impostor, const Vector3& origin, float radius)
 {
-  auto impostorObject = static_cast<AbstractMesh*>(impostor.object);
-
-  _prepareSphere();
+  // The contact point of the ray cast towards the object lies within the
+  // radius, so the bounding sphere of the object has to reach the sphere
+  auto impostorObject      = static_cast<AbstractMesh*>(impostor.object);
+  const auto& boundingInfo = impostorObject->getBoundingInfo();
+  if (!boundingInfo) {
+    return false;
+  }
 
-  _sphere->position = origin;
-  _sphere->scaling  = Vector3(radius * 2.f, radius * 2.f, radius * 2.f);
-  _sphere->_updateBoundingInfo();
-  _sphere->computeWorldMatrix(true);
+  const auto& boundingSphere = boundingInfo->boundingSphere;
+  const auto maxDistance     = radius + boundingSphere.radiusWorld;
 
-  return _sphere->intersectsMesh(*impostorObject, true);
+  return Vector3::DistanceSquared(origin, boundingSphere.centerWorld)
+         <= maxDistance * maxDistance;
 }
 
 } // end of namespace BABYLON
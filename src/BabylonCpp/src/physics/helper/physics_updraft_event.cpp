@@ -114,11 +114,16 @@ PhysicsUpdraftEvent::getImpostorHitData(PhysicsImpostor& impostor)
 
 void PhysicsUpdraftEvent::_tick()
 {
-  const auto& impostors = _physicsEngine->getImpostors();
-  for (const auto& impostor : impostors) {
+  // Only the impostors around the cylinder are tested
+  const Vector3 halfSize{_options.radius, _options.height / 2.f,
+                         _options.radius};
+  _physicsEngine->getImpostorsInBox(_cylinderPosition.subtract(halfSize),
+                                    _cylinderPosition.add(halfSize),
+                                    _impostors);
+  for (const auto& impostor : _impostors) {
     auto impostorHitData = getImpostorHitData(*impostor);
     if (!impostorHitData) {
-      return;
+      continue;
     }
 
     impostor->applyForce(impostorHitData->force, impostorHitData->contactPoint);
@@ -134,6 +139,9 @@ void PhysicsUpdraftEvent::_prepareCylinder()
     _cylinder = CylinderBuilder::CreateCylinder("updraftEventCylinder", options,
                                                 _scene);
     _cylinder->isVisible = false;
+    // The cylinder does not move, its world matrix is computed once
+    _cylinder->position = _cylinderPosition;
+    _cylinder->computeWorldMatrix(true);
   }
 }
 
@@ -141,8 +149,6 @@ bool PhysicsUpdraftEvent::_intersectsWithCylinder(PhysicsImpostor& impostor)
 {
   auto impostorObject = static_cast<AbstractMesh*>(impostor.object);
 
-  _cylinder->position = _cylinderPosition;
-
   return _cylinder->intersectsMesh(*impostorObject, true);
 }
 
@@ -138,11 +138,16 @@ PhysicsVortexEvent::getImpostorHitData(PhysicsImpostor& impostor)
 
 void PhysicsVortexEvent::_tick()
 {
-  const auto& impostors = _physicsEngine->getImpostors();
-  for (const auto& impostor : impostors) {
+  // Only the impostors around the cylinder are tested
+  const Vector3 halfSize{_options.radius, _options.height / 2.f,
+                         _options.radius};
+  _physicsEngine->getImpostorsInBox(_cylinderPosition.subtract(halfSize),
+                                    _cylinderPosition.add(halfSize),
+                                    _impostors);
+  for (const auto& impostor : _impostors) {
     auto impostorHitData = getImpostorHitData(*impostor);
     if (!impostorHitData) {
-      return;
+      continue;
     }
 
     impostor->applyForce(impostorHitData->force, impostorHitData->contactPoint);
@@ -158,6 +163,9 @@ void PhysicsVortexEvent::_prepareCylinder()
     _cylinder
       = CylinderBuilder::CreateCylinder("vortexEventCylinder", options, _scene);
     _cylinder->isVisible = false;
+    // The cylinder does not move, its world matrix is computed once
+    _cylinder->position = _cylinderPosition;
+    _cylinder->computeWorldMatrix(true);
   }
 }
 
@@ -165,8 +173,6 @@ bool PhysicsVortexEvent::_intersectsWithCylinder(PhysicsImpostor& impostor)
 {
   auto impostorObject = static_cast<AbstractMesh*>(impostor.object);
 
-  _cylinder->position = _cylinderPosition;
-
   return _cylinder->intersectsMesh(*impostorObject, true);
 }
 
@@ -6,7 +6,7 @@
 namespace BABYLON {
 
 DistanceJoint::DistanceJoint(const DistanceJointData& iJointData)
-    : PhysicsJoint(PhysicsJoint::DistanceJoint, iJointData)
+    : PhysicsJoint(PhysicsJoint::DistanceJoint, iJointData), maxDistance{iJointData.maxDistance}
 {
 }
 
@@ -11,6 +11,8 @@ PhysicsJoint::PhysicsJoint(unsigned int iJointType,
     , physicsJoint{this, &PhysicsJoint::get_physicsJoint,
                    &PhysicsJoint::set_physicsJoint}
     , physicsPlugin{this, &PhysicsJoint::set_physicsPlugin}
+    , _physicsPlugin{nullptr}
+    , _physicsJoint{nullptr}
 {
 }
 
@@ -1,6 +1,9 @@
 #include <babylon/physics/physics_engine.h>
 
+#include <babylon/babylon_stl_util.h>
 #include <babylon/core/logging.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/meshes/abstract_mesh.h>
 #include <babylon/physics/iphysics_engine_plugin.h>
 #include <babylon/physics/joint/physics_joint.h>
 #include <babylon/physics/physics_impostor.h>
@@ -13,7 +16,10 @@ float PhysicsEngine::Epsilon = 0.001f;
 
 PhysicsEngine::PhysicsEngine(const std::optional<Vector3>& iGravity,
                              IPhysicsEnginePlugin* physicsPlugin)
-    : _initialized{false}, _physicsPlugin{physicsPlugin}, _subTimeStep{0.f}
+    : _initialized{false}
+    , _physicsPlugin{physicsPlugin}
+    , _nextImpostorOrder{0}
+    , _subTimeStep{0.f}
 {
   if (_physicsPlugin && _physicsPlugin->isSupported()) {
     setGravity(iGravity.has_value() ? *iGravity : Vector3(0.f, -9.807f, 0.f));
@@ -50,6 +56,10 @@ float PhysicsEngine::getTimeStep() const
 void PhysicsEngine::setSubTimeStep(float subTimeStep)
 {
   _subTimeStep = subTimeStep;
+  // The scene steps the engine by sub time steps, which the plugin takes as its fixed time step
+  if (_subTimeStep > 0.f) {
+    _physicsPlugin->setTimeStep(_subTimeStep / 1000.f);
+  }
 }
 
 float PhysicsEngine::getSubTimeStep() const
@@ -59,7 +69,9 @@ float PhysicsEngine::getSubTimeStep() const
 
 void PhysicsEngine::dispose()
 {
-  for (const auto& impostor : _impostors) {
+  // Disposing an impostor removes it from the list
+  const auto impostors = _impostors;
+  for (const auto& impostor : impostors) {
     impostor->dispose();
   }
   _physicsPlugin->dispose();
@@ -72,7 +84,10 @@ std::string PhysicsEngine::getPhysicsPluginName() const
 
 void PhysicsEngine::addImpostor(PhysicsImpostor* impostor)
 {
-  _impostors.emplace_back(impostor);
+  // The impostors are owned by their objects
+  _impostors.emplace_back(PhysicsImpostorPtr(impostor, [](PhysicsImpostor*) {}));
+  _impostorOrders[impostor] = {_nextImpostorOrder++, _impostors.back()};
+  _impostorsByObject.emplace(impostor->object, impostor);
   impostor->uniqueId = _impostors.size();
   // if no parent, generate the body
   if (!impostor->parent()) {
@@ -82,13 +97,25 @@ void PhysicsEngine::addImpostor(PhysicsImpostor* impostor)
 
 void PhysicsEngine::removeImpostor(PhysicsImpostor* impostor)
 {
-  auto it = std::find_if(
+  if (_impostorOrders.erase(impostor) == 0) {
+    return;
+  }
+  _impostors.erase(std::find_if(
     _impostors.begin(), _impostors.end(),
-    [&impostor](const PhysicsImpostorPtr& _imposter) { return _imposter.get() == impostor; });
-  if (it != _impostors.end()) {
-    _impostors.erase(it);
-    getPhysicsPlugin()->removePhysicsBody(*impostor);
+    [&impostor](const PhysicsImpostorPtr& _imposter) { return _imposter.get() == impostor; }));
+  const auto objectIt = _impostorsByObject.find(impostor->object);
+  if (objectIt != _impostorsByObject.end() && objectIt->second == impostor) {
+    _impostorsByObject.erase(objectIt);
+    // Another impostor of the object takes over
+    for (const auto& otherImpostor : _impostors) {
+      if (otherImpostor->object == impostor->object) {
+        _impostorsByObject.emplace(impostor->object, otherImpostor.get());
+        break;
+      }
+    }
   }
+  _impostorsByBody.clear();
+  getPhysicsPlugin()->removePhysicsBody(*impostor);
 }
 
 void PhysicsEngine::addJoint(PhysicsImpostor* mainImpostor, PhysicsImpostor* connectedImpostor,
@@ -122,10 +149,11 @@ void PhysicsEngine::removeJoint(PhysicsImpostor* mainImpostor, PhysicsImpostor*
 
   if (!matchingJoints.empty()) {
     _physicsPlugin->removeJoint(matchingJoints[0].get());
+    stl_util::remove_vector_elements_equal_sharedptr(_joints, matchingJoints[0].get());
   }
 }
 
-void PhysicsEngine::_step(float /*delta*/)
+void PhysicsEngine::_step(float delta)
 {
   // check if any mesh has no body / requires an update
   for (auto& impostor : _impostors) {
@@ -134,7 +162,6 @@ void PhysicsEngine::_step(float /*delta*/)
     }
   }
 
-#if 0
   if (delta > 0.1f) {
     delta = 0.1f;
   }
@@ -143,7 +170,6 @@ void PhysicsEngine::_step(float /*delta*/)
   }
 
   _physicsPlugin->executeStep(delta, _impostors);
-#endif
 }
 
 IPhysicsEnginePlugin* PhysicsEngine::getPhysicsPlugin()
@@ -158,18 +184,56 @@ std::vector<PhysicsImpostorPtr>& PhysicsEngine::getImpostors()
 
 PhysicsImpostor* PhysicsEngine::getImpostorForPhysicsObject(IPhysicsEnabledObject* object)
 {
-  auto it = std::find_if(
-    _impostors.begin(), _impostors.end(),
-    [&object](const PhysicsImpostorPtr& impostor) { return impostor->object == object; });
-  return (it == _impostors.end()) ? nullptr : (*it).get();
+  const auto it = _impostorsByObject.find(object);
+  return (it == _impostorsByObject.end()) ? nullptr : it->second;
 }
 
 PhysicsImpostor* PhysicsEngine::getImpostorWithPhysicsBody(IPhysicsBody* body)
 {
-  auto it = std::find_if(
-    _impostors.begin(), _impostors.end(),
-    [&body](const PhysicsImpostorPtr& impostor) { return impostor->physicsBody() == body; });
-  return (it == _impostors.end()) ? nullptr : (*it).get();
+  auto it = _impostorsByBody.find(body);
+  // The bodies are generated and replaced by the plugin, the index is rebuilt on a miss
+  if (it == _impostorsByBody.end() || it->second->physicsBody() != body) {
+    _impostorsByBody.clear();
+    for (const auto& impostor : _impostors) {
+      _impostorsByBody.emplace(impostor->physicsBody(), impostor.get());
+    }
+    it = _impostorsByBody.find(body);
+  }
+  return (it == _impostorsByBody.end()) ? nullptr : it->second;
+}
+
+void PhysicsEngine::getImpostorsInBox(const Vector3& minimum, const Vector3& maximum,
+                                      std::vector<PhysicsImpostorPtr>& impostors)
+{
+  impostors.clear();
+  if (_physicsPlugin->queryBroadphase(minimum, maximum, _queriedImpostors)) {
+    _queriedOrders.clear();
+    for (const auto impostor : _queriedImpostors) {
+      const auto it = _impostorOrders.find(impostor);
+      if (it != _impostorOrders.end()) {
+        _queriedOrders.emplace_back(it->second.first, impostor);
+      }
+    }
+    std::sort(_queriedOrders.begin(), _queriedOrders.end());
+    for (const auto& queriedOrder : _queriedOrders) {
+      impostors.emplace_back(_impostorOrders[queriedOrder.second].second);
+    }
+    return;
+  }
+
+  for (const auto& impostor : _impostors) {
+    const auto& boundingInfo = impostor->object->getBoundingInfo();
+    if (!boundingInfo) {
+      impostors.emplace_back(impostor);
+      continue;
+    }
+    const auto& boundingBox = boundingInfo->boundingBox;
+    if (boundingBox.minimumWorld.x <= maximum.x && boundingBox.maximumWorld.x >= minimum.x
+        && boundingBox.minimumWorld.y <= maximum.y && boundingBox.maximumWorld.y >= minimum.y
+        && boundingBox.minimumWorld.z <= maximum.z && boundingBox.maximumWorld.z >= minimum.z) {
+      impostors.emplace_back(impostor);
+    }
+  }
 }
 
 bool PhysicsEngine::isInitialized() const
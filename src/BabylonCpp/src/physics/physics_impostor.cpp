@@ -9,6 +9,7 @@
 #include <babylon/maths/vector3.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/mesh.h>
+#include <babylon/meshes/transform_node.h>
 #include <babylon/physics/iphysics_enabled_object.h>
 #include <babylon/physics/iphysics_engine.h>
 #include <babylon/physics/iphysics_engine_plugin.h>
@@ -44,8 +45,10 @@ PhysicsImpostor::PhysicsImpostor(IPhysicsEnabledObject* iObject, unsigned int iT
     , parent{this, &PhysicsImpostor::get_parent, &PhysicsImpostor::set_parent}
     , _options{options}
     , _scene{scene}
+    , _physicsBody{nullptr}
     , _bodyUpdateRequired{false}
     , _deltaPosition{Vector3::Zero()}
+    , _parent{nullptr}
     , _isDisposed{false}
     , nullPhysicsImpostor{nullptr}
 {
@@ -83,13 +86,8 @@ PhysicsImpostor::PhysicsImpostor(IPhysicsEnabledObject* iObject, unsigned int iT
   else {
     // Set the object's quaternion, if not set
     if (!object->rotationQuaternion()) {
-      if (object->rotation() == Vector3::Zero()) {
-        object->rotationQuaternion = Quaternion::RotationYawPitchRoll(
-          object->rotation().y, object->rotation().x, object->rotation().z);
-      }
-      else {
-        object->rotationQuaternion = Quaternion();
-      }
+      object->rotationQuaternion = Quaternion::RotationYawPitchRoll(
+        object->rotation().y, object->rotation().x, object->rotation().z);
     }
     // default options params
     _options.mass        = _options.mass.value_or(0.f);
@@ -116,7 +114,13 @@ PhysicsImpostor::PhysicsImpostor(IPhysicsEnabledObject* iObject, unsigned int iT
   }
 }
 
-PhysicsImpostor::~PhysicsImpostor() = default;
+PhysicsImpostor::~PhysicsImpostor()
+{
+  // Impostors released without being disposed must not stay registered in the engine
+  if (!_isDisposed && _physicsEngine) {
+    _physicsEngine->removeImpostor(this);
+  }
+}
 
 void PhysicsImpostor::_init()
 {
@@ -134,7 +138,7 @@ void PhysicsImpostor::_init()
 
 PhysicsImpostorPtr PhysicsImpostor::_getPhysicsParent()
 {
-  if (object->parent()->type() == Type::ABSTRACTMESH) {
+  if (object->parent() && object->parent()->type() == Type::ABSTRACTMESH) {
     auto parentMesh = static_cast<AbstractMesh*>(object->parent());
     return parentMesh->physicsImpostor();
   }
@@ -176,7 +180,7 @@ void PhysicsImpostor::set_parent(PhysicsImpostor* const& value)
 
 void PhysicsImpostor::set_physicsBody(IPhysicsBody* const& iPhysicsBody)
 {
-  if (iPhysicsBody && _physicsEngine) {
+  if (_physicsBody && _physicsEngine) {
     _physicsEngine->getPhysicsPlugin()->removePhysicsBody(*this);
   }
   _physicsBody = iPhysicsBody;
@@ -190,8 +194,8 @@ void PhysicsImpostor::resetUpdateFlags()
 
 Vector3 PhysicsImpostor::getObjectExtendSize()
 {
-  if (object->hasBoundingInfo()) {
-    auto& q = object->rotationQuaternion();
+  if (object->getBoundingInfo()) {
+    const auto q = object->rotationQuaternion();
     // reset rotation
     object->rotationQuaternion = PhysicsImpostor::IDENTITY_QUATERNION;
     // calculate the world matrix with no rotation
@@ -215,7 +219,7 @@ Vector3 PhysicsImpostor::getObjectExtendSize()
 
 Vector3 PhysicsImpostor::getObjectCenter()
 {
-  if (object->hasBoundingInfo()) {
+  if (object->getBoundingInfo()) {
     const auto& boundingInfo = *object->getBoundingInfo();
     return boundingInfo.boundingBox.centerWorld;
   }
@@ -354,7 +358,7 @@ void PhysicsImpostor::set_positionIterations(size_t value)
 
 void PhysicsImpostor::setMass(float iMass)
 {
-  if (stl_util::almost_equal(getParam("mass"), iMass)) {
+  if (!stl_util::almost_equal(getParam("mass"), iMass)) {
     setParam("mass", iMass);
   }
   if (_physicsEngine) {
@@ -442,9 +446,32 @@ void PhysicsImpostor::unregisterOnPhysicsCollide()
 
 Quaternion& PhysicsImpostor::getParentsRotation()
 {
+  _tmpQuat.copyFromFloats(0.f, 0.f, 0.f, 1.f);
+  for (auto parentNode = object->parent(); parentNode; parentNode = parentNode->parent()) {
+    auto transformNode = dynamic_cast<TransformNode*>(parentNode);
+    if (!transformNode) {
+      continue;
+    }
+    if (transformNode->rotationQuaternion()) {
+      _tmpQuat2.copyFrom(*transformNode->rotationQuaternion());
+    }
+    else {
+      const auto& rotation = transformNode->rotation();
+      Quaternion::RotationYawPitchRollToRef(rotation.y, rotation.x, rotation.z, _tmpQuat2);
+    }
+    _tmpQuat.multiplyToRef(_tmpQuat2, _tmpQuat);
+  }
   return _tmpQuat;
 }
 
+bool PhysicsImpostor::_canSyncTransformationInBulk() const
+{
+  return _physicsEngine && !object->parent() && object->rotationQuaternion()
+         && !_options.disableBidirectionalTransformation.value_or(false) && !_deltaRotation
+         && _deltaPosition.x == 0.f && _deltaPosition.y == 0.f && _deltaPosition.z == 0.f
+         && _onBeforePhysicsStepCallbacks.empty() && _onAfterPhysicsStepCallbacks.empty();
+}
+
 void PhysicsImpostor::beforeStep()
 {
   if (!_physicsEngine) {
@@ -633,6 +660,9 @@ void PhysicsImpostor::setDeltaRotation(const Quaternion& rotation)
   if (!_deltaRotation) {
     _deltaRotation = std::make_unique<Quaternion>();
   }
+  if (!_deltaRotationConjugated) {
+    _deltaRotationConjugated = std::make_unique<Quaternion>();
+  }
   _deltaRotation->copyFrom(rotation);
   _deltaRotationConjugated->copyFrom(_deltaRotation->conjugate());
 }
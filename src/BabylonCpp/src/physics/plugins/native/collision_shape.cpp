@@ -0,0 +1,643 @@
+#include <babylon/physics/plugins/native/collision_shape.h>
+
+#include <array>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace BABYLON {
+namespace NativePhysics {
+
+namespace {
+
+constexpr float Pi = 3.14159265358979323846f;
+
+// Thickness given to flat point clouds
+constexpr float FlatHullThickness = 0.01f;
+
+// Triangle of the hull under construction, counter-clockwise seen from outside
+struct Triangle {
+  uint32_t v[3];
+  Vec3 normal;
+  float offset;
+  bool alive;
+}; // end of struct Triangle
+
+uint64_t edgeKey(uint32_t a, uint32_t b)
+{
+  return (static_cast<uint64_t>(a) << 32) | b;
+}
+
+Triangle makeTriangle(const std::vector<Vec3>& points, uint32_t a, uint32_t b, uint32_t c)
+{
+  Triangle triangle;
+  triangle.v[0]   = a;
+  triangle.v[1]   = b;
+  triangle.v[2]   = c;
+  triangle.normal = normalize(cross(points[b] - points[a], points[c] - points[a]));
+  triangle.offset = dot(triangle.normal, points[a]);
+  triangle.alive  = true;
+  return triangle;
+}
+
+// Incremental hull of the points. Returns false with the plane normal if the points are flat.
+bool buildTriangles(const std::vector<Vec3>& points, float epsilon,
+                    std::vector<Triangle>& triangles, Vec3& flatNormal)
+{
+  const auto count = static_cast<uint32_t>(points.size());
+  flatNormal       = {0.f, 0.f, 0.f};
+  if (count < 4) {
+    return false;
+  }
+
+  // Initial tetrahedron from extreme points
+  uint32_t i0 = 0;
+  for (uint32_t i = 1; i < count; ++i) {
+    if (points[i].x < points[i0].x) {
+      i0 = i;
+    }
+  }
+  uint32_t i1    = i0;
+  float distance = 0.f;
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto d = lengthSquared(points[i] - points[i0]);
+    if (d > distance) {
+      distance = d;
+      i1       = i;
+    }
+  }
+  if (distance <= epsilon * epsilon) {
+    return false;
+  }
+  const auto axis = normalize(points[i1] - points[i0]);
+  uint32_t i2     = i0;
+  distance        = 0.f;
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto d = lengthSquared(cross(points[i] - points[i0], axis));
+    if (d > distance) {
+      distance = d;
+      i2       = i;
+    }
+  }
+  if (distance <= epsilon * epsilon) {
+    return false;
+  }
+  flatNormal  = normalize(cross(points[i1] - points[i0], points[i2] - points[i0]));
+  uint32_t i3 = i0;
+  distance    = 0.f;
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto d = std::abs(dot(points[i] - points[i0], flatNormal));
+    if (d > distance) {
+      distance = d;
+      i3       = i;
+    }
+  }
+  if (distance <= epsilon) {
+    return false;
+  }
+
+  triangles.clear();
+  const uint32_t simplex[4] = {i0, i1, i2, i3};
+  const auto interior = (points[i0] + points[i1] + points[i2] + points[i3]) * 0.25f;
+  using Face3 = std::array<uint32_t, 3>;
+  const Face3 tetrahedron[4] = {{i0, i1, i2}, {i0, i3, i1}, {i1, i3, i2}, {i2, i3, i0}};
+  for (const auto& face : tetrahedron) {
+    auto triangle = makeTriangle(points, face[0], face[1], face[2]);
+    if (dot(triangle.normal, interior) - triangle.offset > 0.f) {
+      triangle = makeTriangle(points, face[0], face[2], face[1]);
+    }
+    triangles.emplace_back(triangle);
+  }
+
+  std::vector<uint32_t> visible;
+  std::unordered_set<uint64_t> visibleEdges;
+  std::vector<std::pair<uint32_t, uint32_t>> horizon;
+  size_t deadCount = 0;
+  for (uint32_t i = 0; i < count; ++i) {
+    if (i == simplex[0] || i == simplex[1] || i == simplex[2] || i == simplex[3]) {
+      continue;
+    }
+    const auto& point = points[i];
+    visible.clear();
+    for (uint32_t t = 0; t < triangles.size(); ++t) {
+      const auto& triangle = triangles[t];
+      if (triangle.alive && dot(triangle.normal, point) - triangle.offset > epsilon) {
+        visible.emplace_back(t);
+      }
+    }
+    if (visible.empty()) {
+      continue;
+    }
+
+    // The horizon is made of the edges of the visible triangles whose reverse edge is not visible
+    visibleEdges.clear();
+    for (auto t : visible) {
+      const auto& v = triangles[t].v;
+      for (int e = 0; e < 3; ++e) {
+        visibleEdges.insert(edgeKey(v[e], v[(e + 1) % 3]));
+      }
+    }
+    horizon.clear();
+    for (auto t : visible) {
+      auto& triangle = triangles[t];
+      for (int e = 0; e < 3; ++e) {
+        const auto a = triangle.v[e], b = triangle.v[(e + 1) % 3];
+        if (visibleEdges.find(edgeKey(b, a)) == visibleEdges.end()) {
+          horizon.emplace_back(a, b);
+        }
+      }
+      triangle.alive = false;
+    }
+    deadCount += visible.size();
+    for (const auto& edge : horizon) {
+      triangles.emplace_back(makeTriangle(points, edge.first, edge.second, i));
+    }
+
+    if (deadCount > triangles.size() / 2) {
+      triangles.erase(std::remove_if(triangles.begin(), triangles.end(),
+                                     [](const Triangle& triangle) { return !triangle.alive; }),
+                      triangles.end());
+      deadCount = 0;
+    }
+  }
+
+  triangles.erase(std::remove_if(triangles.begin(), triangles.end(),
+                                 [](const Triangle& triangle) { return !triangle.alive; }),
+                  triangles.end());
+  return true;
+}
+
+uint32_t findRoot(std::vector<uint32_t>& parents, uint32_t i)
+{
+  while (parents[i] != i) {
+    parents[i] = parents[parents[i]];
+    i          = parents[i];
+  }
+  return i;
+}
+
+// Merges the coplanar triangles into polygonal faces
+ConvexHull buildHull(const std::vector<Vec3>& points, const std::vector<Triangle>& triangles)
+{
+  // Maximum angle between the merged triangles, about 0.8 degree
+  constexpr float CoplanarCosine = 0.9999f;
+
+  const auto triangleCount = static_cast<uint32_t>(triangles.size());
+  std::unordered_map<uint64_t, uint32_t> edgeTriangles;
+  edgeTriangles.reserve(triangleCount * 3);
+  for (uint32_t t = 0; t < triangleCount; ++t) {
+    const auto& v = triangles[t].v;
+    for (int e = 0; e < 3; ++e) {
+      edgeTriangles[edgeKey(v[e], v[(e + 1) % 3])] = t;
+    }
+  }
+
+  std::vector<uint32_t> parents(triangleCount);
+  for (uint32_t t = 0; t < triangleCount; ++t) {
+    parents[t] = t;
+  }
+  for (uint32_t t = 0; t < triangleCount; ++t) {
+    const auto& v = triangles[t].v;
+    for (int e = 0; e < 3; ++e) {
+      const auto it = edgeTriangles.find(edgeKey(v[(e + 1) % 3], v[e]));
+      if (it != edgeTriangles.end()
+          && dot(triangles[t].normal, triangles[it->second].normal) > CoplanarCosine) {
+        parents[findRoot(parents, t)] = findRoot(parents, it->second);
+      }
+    }
+  }
+
+  ConvexHull hull;
+  std::unordered_map<uint32_t, uint32_t> groupFaces;
+  std::unordered_map<uint32_t, uint32_t> vertexIndices;
+  std::vector<std::vector<uint32_t>> groupTriangles;
+  for (uint32_t t = 0; t < triangleCount; ++t) {
+    const auto root = findRoot(parents, t);
+    auto it         = groupFaces.find(root);
+    if (it == groupFaces.end()) {
+      it = groupFaces.emplace(root, static_cast<uint32_t>(groupTriangles.size())).first;
+      groupTriangles.emplace_back();
+    }
+    groupTriangles[it->second].emplace_back(t);
+  }
+
+  std::unordered_map<uint32_t, uint32_t> next;
+  for (const auto& group : groupTriangles) {
+    // Area weighted normal
+    Vec3 normal{0.f, 0.f, 0.f};
+    for (auto t : group) {
+      const auto& v = triangles[t].v;
+      normal += cross(points[v[1]] - points[v[0]], points[v[2]] - points[v[0]]);
+    }
+    normal = normalize(normal);
+
+    // Boundary loop of the group
+    next.clear();
+    for (auto t : group) {
+      const auto& v = triangles[t].v;
+      for (int e = 0; e < 3; ++e) {
+        const auto a = v[e], b = v[(e + 1) % 3];
+        const auto it = edgeTriangles.find(edgeKey(b, a));
+        if (it == edgeTriangles.end() || findRoot(parents, it->second) != findRoot(parents, t)) {
+          next[a] = b;
+        }
+      }
+    }
+    if (next.size() < 3) {
+      continue;
+    }
+
+    ConvexHull::Face face;
+    face.normal      = normal;
+    face.offset      = -std::numeric_limits<float>::max();
+    face.firstVertex = static_cast<uint32_t>(hull.faceVertices.size());
+    auto vertex      = next.begin()->first;
+    for (size_t i = 0; i < next.size(); ++i) {
+      auto it = vertexIndices.find(vertex);
+      if (it == vertexIndices.end()) {
+        it = vertexIndices.emplace(vertex, static_cast<uint32_t>(hull.vertices.size())).first;
+        hull.vertices.emplace_back(points[vertex]);
+      }
+      hull.faceVertices.emplace_back(it->second);
+      face.offset = std::max(face.offset, dot(normal, points[vertex]));
+      vertex      = next[vertex];
+    }
+    face.vertexCount = static_cast<uint32_t>(hull.faceVertices.size()) - face.firstVertex;
+    hull.faces.emplace_back(face);
+  }
+
+  // Edges with their two faces
+  std::unordered_map<uint64_t, uint32_t> edgeFaces;
+  for (uint32_t f = 0; f < hull.faces.size(); ++f) {
+    const auto& face = hull.faces[f];
+    for (uint32_t i = 0; i < face.vertexCount; ++i) {
+      const auto a = hull.faceVertices[face.firstVertex + i];
+      const auto b = hull.faceVertices[face.firstVertex + (i + 1) % face.vertexCount];
+      edgeFaces[edgeKey(a, b)] = f;
+    }
+  }
+  for (uint32_t f = 0; f < hull.faces.size(); ++f) {
+    const auto& face = hull.faces[f];
+    for (uint32_t i = 0; i < face.vertexCount; ++i) {
+      const auto a  = hull.faceVertices[face.firstVertex + i];
+      const auto b  = hull.faceVertices[face.firstVertex + (i + 1) % face.vertexCount];
+      const auto it = edgeFaces.find(edgeKey(b, a));
+      if (a < b && it != edgeFaces.end()) {
+        hull.edges.push_back({a, b, f, it->second});
+      }
+    }
+  }
+
+  Vec3 centroid{0.f, 0.f, 0.f};
+  for (const auto& v : hull.vertices) {
+    centroid += v;
+  }
+  hull.centroid = centroid * (1.f / static_cast<float>(std::max<size_t>(hull.vertices.size(), 1)));
+  return hull;
+}
+
+void computeLocalBounds(const std::vector<Vec3>& vertices, CollisionShape& shape)
+{
+  Vec3 lower{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+             std::numeric_limits<float>::max()};
+  Vec3 upper = -lower;
+  for (const auto& v : vertices) {
+    lower = minimum(lower, v);
+    upper = maximum(upper, v);
+  }
+  shape.center      = (lower + upper) * 0.5f;
+  shape.halfExtents = (upper - lower) * 0.5f;
+}
+
+// Inverse of the inertia diagonal, 0 for the null moments
+Vec3 invert(const Vec3& inertia)
+{
+  return {inertia.x > 0.f ? 1.f / inertia.x : 0.f, inertia.y > 0.f ? 1.f / inertia.y : 0.f,
+          inertia.z > 0.f ? 1.f / inertia.z : 0.f};
+}
+
+bool raycastSphere(const Vec3& center, float radius, const Vec3& from, const Vec3& direction,
+                   float maxFraction, float& fraction)
+{
+  const auto m = from - center;
+  const auto a = dot(direction, direction);
+  const auto b = dot(m, direction);
+  const auto c = dot(m, m) - radius * radius;
+  if (c < 0.f || a <= 0.f) {
+    // Starts inside
+    return false;
+  }
+  const auto discriminant = b * b - a * c;
+  if (discriminant < 0.f || b > 0.f) {
+    return false;
+  }
+  const auto t = (-b - std::sqrt(discriminant)) / a;
+  if (t < 0.f || t > maxFraction) {
+    return false;
+  }
+  fraction = t;
+  return true;
+}
+
+} // end of anonymous namespace
+
+ConvexHull ConvexHull::Create(const std::vector<Vec3>& inputPoints)
+{
+  if (inputPoints.empty()) {
+    return ConvexHull{};
+  }
+  Vec3 lower = inputPoints[0], upper = inputPoints[0];
+  for (const auto& point : inputPoints) {
+    lower = minimum(lower, point);
+    upper = maximum(upper, point);
+  }
+  const auto size    = upper - lower;
+  const auto scale   = std::max(size.x, std::max(size.y, size.z));
+  const auto epsilon = 1e-5f * scale;
+
+  std::vector<Triangle> triangles;
+  Vec3 flatNormal;
+  if (buildTriangles(inputPoints, epsilon, triangles, flatNormal)) {
+    return buildHull(inputPoints, triangles);
+  }
+  if (lengthSquared(flatNormal) == 0.f) {
+    // Points on a line or at the same place
+    return ConvexHull{};
+  }
+
+  // Flat cloud: extrude it on both sides
+  std::vector<Vec3> points;
+  points.reserve(inputPoints.size() * 2);
+  const auto offset = flatNormal * (FlatHullThickness * 0.5f);
+  for (const auto& point : inputPoints) {
+    points.emplace_back(point + offset);
+    points.emplace_back(point - offset);
+  }
+  if (buildTriangles(points, std::min(epsilon, FlatHullThickness * 0.1f), triangles, flatNormal)) {
+    return buildHull(points, triangles);
+  }
+  return ConvexHull{};
+}
+
+const Vec3& ConvexHull::support(const Vec3& direction) const
+{
+  size_t best       = 0;
+  float bestProject = dot(vertices[0], direction);
+  for (size_t i = 1; i < vertices.size(); ++i) {
+    const auto project = dot(vertices[i], direction);
+    if (project > bestProject) {
+      bestProject = project;
+      best        = i;
+    }
+  }
+  return vertices[best];
+}
+
+CollisionShape CollisionShape::CreateSphere(float radius)
+{
+  CollisionShape shape;
+  shape.type        = ShapeType::Sphere;
+  shape.radius      = radius;
+  shape.halfExtents = {radius, radius, radius};
+  return shape;
+}
+
+CollisionShape CollisionShape::CreateCapsule(float radius, float halfHeight)
+{
+  CollisionShape shape;
+  shape.type        = ShapeType::Capsule;
+  shape.radius      = radius;
+  shape.halfHeight  = halfHeight;
+  shape.halfExtents = {radius, halfHeight + radius, radius};
+  return shape;
+}
+
+CollisionShape CollisionShape::CreateBox(const Vec3& halfExtents)
+{
+  // Boxes keep a minimum thickness, for the ground planes
+  const auto h = maximum(halfExtents, Vec3{FlatHullThickness * 0.5f, FlatHullThickness * 0.5f,
+                                           FlatHullThickness * 0.5f});
+  std::vector<Vec3> corners;
+  for (int i = 0; i < 8; ++i) {
+    corners.push_back({(i & 1) ? h.x : -h.x, (i & 2) ? h.y : -h.y, (i & 4) ? h.z : -h.z});
+  }
+  return CreateConvexHull(corners);
+}
+
+CollisionShape CollisionShape::CreateCylinder(float radius, float halfHeight, unsigned int segments)
+{
+  std::vector<Vec3> points;
+  segments = std::max(segments, 3u);
+  for (unsigned int i = 0; i < segments; ++i) {
+    const auto angle = 2.f * Pi * static_cast<float>(i) / static_cast<float>(segments);
+    const auto x = radius * std::cos(angle), z = radius * std::sin(angle);
+    points.push_back({x, -halfHeight, z});
+    points.push_back({x, halfHeight, z});
+  }
+  return CreateConvexHull(points);
+}
+
+CollisionShape CollisionShape::CreateConvexHull(const std::vector<Vec3>& points)
+{
+  auto hull = std::make_shared<ConvexHull>(ConvexHull::Create(points));
+  if (hull->vertices.empty()) {
+    // Degenerate cloud: use a small sphere
+    return CreateSphere(FlatHullThickness * 0.5f);
+  }
+  CollisionShape shape;
+  shape.type = ShapeType::ConvexHull;
+  computeLocalBounds(hull->vertices, shape);
+  shape.radius = 0.f;
+  shape.hull   = std::move(hull);
+  return shape;
+}
+
+AABB CollisionShape::computeAABB(const Transform& transform) const
+{
+  switch (type) {
+    case ShapeType::Sphere: {
+      const Vec3 r{radius, radius, radius};
+      return {transform.position - r, transform.position + r};
+    }
+    case ShapeType::Capsule: {
+      const auto axis = rotate(transform.rotation, Vec3{0.f, halfHeight, 0.f});
+      const auto r    = absolute(axis) + Vec3{radius, radius, radius};
+      return {transform.position - r, transform.position + r};
+    }
+    default: {
+      const auto m      = toMatrix(transform.rotation);
+      const auto center = transform.position + m * this->center;
+      const Vec3 extents{dot(absolute(m.rows[0]), halfExtents),
+                         dot(absolute(m.rows[1]), halfExtents),
+                         dot(absolute(m.rows[2]), halfExtents)};
+      return {center - extents, center + extents};
+    }
+  }
+}
+
+Vec3 CollisionShape::computeInverseInertia(float mass) const
+{
+  if (mass <= 0.f) {
+    return {0.f, 0.f, 0.f};
+  }
+  switch (type) {
+    case ShapeType::Sphere: {
+      const auto i = 0.4f * mass * radius * radius;
+      return invert({i, i, i});
+    }
+    case ShapeType::Capsule: {
+      // Cylinder and two hemispheres sharing the mass by volume
+      const auto r2             = radius * radius;
+      const auto h              = 2.f * halfHeight;
+      const auto cylinderVolume = Pi * r2 * h;
+      const auto sphereVolume   = 4.f / 3.f * Pi * r2 * radius;
+      const auto volume         = cylinderVolume + sphereVolume;
+      const auto mc             = volume > 0.f ? mass * cylinderVolume / volume : 0.f;
+      const auto ms             = mass - mc;
+      const auto iy             = mc * r2 * 0.5f + ms * 0.4f * r2;
+      const auto ixz            = mc * (h * h / 12.f + r2 * 0.25f)
+                       + ms * (0.4f * r2 + h * h * 0.25f + 0.375f * h * radius);
+      return invert({ixz, iy, ixz});
+    }
+    default: {
+      // Covariance of the polyhedron about the body origin, with a tetrahedron per triangle
+      float volume = 0.f;
+      float covariance[3][3]{};
+      for (const auto& face : hull->faces) {
+        const auto& a = hull->faceVertex(face, 0);
+        for (uint32_t i = 1; i + 1 < face.vertexCount; ++i) {
+          const auto& b     = hull->faceVertex(face, i);
+          const auto& c     = hull->faceVertex(face, i + 1);
+          const auto det    = dot(a, cross(b, c));
+          const auto s      = a + b + c;
+          volume += det / 6.f;
+          for (int r = 0; r < 3; ++r) {
+            for (int col = 0; col < 3; ++col) {
+              covariance[r][col] += det / 120.f
+                                    * (a[r] * a[col] + b[r] * b[col] + c[r] * c[col]
+                                       + s[r] * s[col]);
+            }
+          }
+        }
+      }
+      if (volume <= 0.f) {
+        return {0.f, 0.f, 0.f};
+      }
+      const auto density = mass / volume;
+      // Only the diagonal of the inertia tensor is kept
+      return invert({density * (covariance[1][1] + covariance[2][2]),
+                     density * (covariance[0][0] + covariance[2][2]),
+                     density * (covariance[0][0] + covariance[1][1])});
+    }
+  }
+}
+
+float CollisionShape::boundingRadius() const
+{
+  switch (type) {
+    case ShapeType::Sphere:
+      return radius;
+    case ShapeType::Capsule:
+      return radius + halfHeight;
+    default: {
+      float radiusSq = 0.f;
+      for (const auto& v : hull->vertices) {
+        radiusSq = std::max(radiusSq, lengthSquared(v));
+      }
+      return std::sqrt(radiusSq);
+    }
+  }
+}
+
+bool CollisionShape::raycast(const Transform& transform, const Vec3& worldFrom, const Vec3& worldTo,
+                             float maxFraction, float& fraction, Vec3& normal) const
+{
+  // Local segment
+  const auto from      = inverseTransformPoint(transform, worldFrom);
+  const auto direction = inverseRotate(transform.rotation, worldTo - worldFrom);
+
+  switch (type) {
+    case ShapeType::Sphere: {
+      if (!raycastSphere({0.f, 0.f, 0.f}, radius, from, direction, maxFraction, fraction)) {
+        return false;
+      }
+      normal = rotate(transform.rotation, normalize(from + direction * fraction));
+      return true;
+    }
+    case ShapeType::Capsule: {
+      bool hit     = false;
+      float best   = maxFraction;
+      Vec3 hitNormal{0.f, 1.f, 0.f};
+      // Side of the cylinder
+      const auto a = direction.x * direction.x + direction.z * direction.z;
+      const auto b = from.x * direction.x + from.z * direction.z;
+      const auto c = from.x * from.x + from.z * from.z - radius * radius;
+      const auto discriminant = b * b - a * c;
+      if (a > 1e-12f && discriminant >= 0.f && c > 0.f) {
+        const auto t = (-b - std::sqrt(discriminant)) / a;
+        const auto y = from.y + direction.y * t;
+        if (t >= 0.f && t <= best && std::abs(y) <= halfHeight) {
+          hit       = true;
+          best      = t;
+          hitNormal = normalize(Vec3{from.x + direction.x * t, 0.f, from.z + direction.z * t});
+        }
+      }
+      // Caps
+      for (const auto capY : {-halfHeight, halfHeight}) {
+        float t;
+        const Vec3 cap{0.f, capY, 0.f};
+        if (raycastSphere(cap, radius, from, direction, best, t)) {
+          const auto point = from + direction * t;
+          if ((capY < 0.f && point.y <= capY) || (capY > 0.f && point.y >= capY)
+              || halfHeight == 0.f) {
+            hit       = true;
+            best      = t;
+            hitNormal = normalize(point - cap);
+          }
+        }
+      }
+      if (!hit) {
+        return false;
+      }
+      fraction = best;
+      normal   = rotate(transform.rotation, hitNormal);
+      return true;
+    }
+    default: {
+      float enter = 0.f, exit = maxFraction;
+      int enterFace = -1;
+      for (size_t f = 0; f < hull->faces.size(); ++f) {
+        const auto& face     = hull->faces[f];
+        const auto distance  = dot(face.normal, from) - face.offset;
+        const auto projected = dot(face.normal, direction);
+        if (projected == 0.f) {
+          if (distance > 0.f) {
+            return false;
+          }
+        }
+        else if (projected < 0.f) {
+          const auto t = -distance / projected;
+          if (t > enter) {
+            enter     = t;
+            enterFace = static_cast<int>(f);
+          }
+        }
+        else {
+          exit = std::min(exit, -distance / projected);
+        }
+        if (enter > exit) {
+          return false;
+        }
+      }
+      if (enterFace < 0) {
+        // Starts inside
+        return false;
+      }
+      fraction = enter;
+      normal   = rotate(transform.rotation, hull->faces[static_cast<size_t>(enterFace)].normal);
+      return true;
+    }
+  }
+}
+
+} // end of namespace NativePhysics
+} // end of namespace BABYLON
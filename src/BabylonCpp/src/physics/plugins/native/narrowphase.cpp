@@ -0,0 +1,731 @@
+#include <babylon/physics/plugins/native/narrowphase.h>
+
+#include <vector>
+
+#include <babylon/physics/plugins/native/collision_shape.h>
+
+namespace BABYLON {
+namespace NativePhysics {
+
+namespace {
+
+constexpr float MaxFloat = std::numeric_limits<float>::max();
+
+void addPoint(ContactManifold& manifold, const Vec3& position, float depth)
+{
+  if (manifold.pointCount < ContactManifold::MaxPoints) {
+    manifold.points[manifold.pointCount++] = {position, depth};
+  }
+}
+
+// Moves the manifold from the local space of a shape to the world space
+void toWorld(const Transform& transform, ContactManifold& manifold)
+{
+  manifold.normal = rotate(transform.rotation, manifold.normal);
+  for (int i = 0; i < manifold.pointCount; ++i) {
+    manifold.points[i].position = transformPoint(transform, manifold.points[i].position);
+  }
+}
+
+Vec3 closestPointOnSegment(const Vec3& point, const Vec3& a, const Vec3& b)
+{
+  const auto ab       = b - a;
+  const auto lengthSq = dot(ab, ab);
+  if (lengthSq <= 0.f) {
+    return a;
+  }
+  const auto t = std::clamp(dot(point - a, ab) / lengthSq, 0.f, 1.f);
+  return a + ab * t;
+}
+
+// Closest points of the segments p1q1 and p2q2 (Ericson, Real-Time Collision Detection 5.1.9)
+void closestPointsOfSegments(const Vec3& p1, const Vec3& q1, const Vec3& p2, const Vec3& q2,
+                             Vec3& c1, Vec3& c2)
+{
+  const auto d1 = q1 - p1, d2 = q2 - p2, r = p1 - p2;
+  const auto a = dot(d1, d1), e = dot(d2, d2), f = dot(d2, r);
+  float s = 0.f, t = 0.f;
+  if (a <= 1e-12f && e <= 1e-12f) {
+    c1 = p1;
+    c2 = p2;
+    return;
+  }
+  if (a <= 1e-12f) {
+    t = std::clamp(f / e, 0.f, 1.f);
+  }
+  else {
+    const auto c = dot(d1, r);
+    if (e <= 1e-12f) {
+      s = std::clamp(-c / a, 0.f, 1.f);
+    }
+    else {
+      const auto b     = dot(d1, d2);
+      const auto denom = a * e - b * b;
+      s                = denom > 1e-12f ? std::clamp((b * f - c * e) / denom, 0.f, 1.f) : 0.f;
+      t                = (b * s + f) / e;
+      if (t < 0.f) {
+        t = 0.f;
+        s = std::clamp(-c / a, 0.f, 1.f);
+      }
+      else if (t > 1.f) {
+        t = 1.f;
+        s = std::clamp((b - c) / a, 0.f, 1.f);
+      }
+    }
+  }
+  c1 = p1 + d1 * s;
+  c2 = p2 + d2 * t;
+}
+
+// Contact of two spheres, the normal going from A to B
+bool collideSpheres(const Vec3& centerA, float radiusA, const Vec3& centerB, float radiusB,
+                    float margin, const Vec3& fallbackNormal, ContactManifold& manifold)
+{
+  const auto d        = centerB - centerA;
+  const auto distSq   = dot(d, d);
+  const auto radius   = radiusA + radiusB;
+  const auto maxDist = radius + margin;
+  if (distSq > maxDist * maxDist) {
+    return false;
+  }
+  const auto distance = std::sqrt(distSq);
+  if (manifold.pointCount == 0) {
+    manifold.normal = distance > 1e-6f ? d * (1.f / distance) : fallbackNormal;
+  }
+  const auto depth = radius - distance;
+  addPoint(manifold, centerA + manifold.normal * (radiusA - 0.5f * depth), depth);
+  return true;
+}
+
+void collideCapsules(const Vec3& a0, const Vec3& a1, float radiusA, const Vec3& b0, const Vec3& b1,
+                     float radiusB, float margin, ContactManifold& manifold)
+{
+  Vec3 c1, c2;
+  closestPointsOfSegments(a0, a1, b0, b1, c1, c2);
+  const auto dA = a1 - a0, dB = b1 - b0;
+  const auto fallback = normalizeOr(cross(dA, dB), {0.f, 1.f, 0.f});
+  if (!collideSpheres(c1, radiusA, c2, radiusB, margin, fallback, manifold)) {
+    return;
+  }
+
+  // Parallel segments: a second point at the other end of their overlap
+  const auto lengthSqA = dot(dA, dA), lengthSqB = dot(dB, dB);
+  if (lengthSqA <= 1e-12f || lengthSqB <= 1e-12f
+      || lengthSquared(cross(dA, dB)) > 1e-4f * lengthSqA * lengthSqB) {
+    return;
+  }
+  auto t0 = std::clamp(dot(b0 - a0, dA) / lengthSqA, 0.f, 1.f);
+  auto t1 = std::clamp(dot(b1 - a0, dA) / lengthSqA, 0.f, 1.f);
+  if (std::abs(t1 - t0) * std::sqrt(lengthSqA) < 1e-3f) {
+    return;
+  }
+  const auto normal = manifold.normal;
+  manifold.pointCount = 0;
+  for (const auto t : {t0, t1}) {
+    const auto pointA  = a0 + dA * t;
+    const auto pointB  = closestPointOnSegment(pointA, b0, b1);
+    const auto depth   = radiusA + radiusB - dot(pointB - pointA, normal);
+    if (depth >= -margin) {
+      addPoint(manifold, pointA + normal * (radiusA - 0.5f * depth), depth);
+    }
+  }
+}
+
+// Closest point of a face polygon to a point
+Vec3 closestPointOnFace(const ConvexHull& hull, const ConvexHull::Face& face, const Vec3& point)
+{
+  const auto projected = point - face.normal * (dot(face.normal, point) - face.offset);
+  bool inside          = true;
+  for (uint32_t i = 0; i < face.vertexCount && inside; ++i) {
+    const auto& v0 = hull.faceVertex(face, i);
+    const auto& v1 = hull.faceVertex(face, (i + 1) % face.vertexCount);
+    inside         = dot(projected - v0, cross(v1 - v0, face.normal)) <= 0.f;
+  }
+  if (inside) {
+    return projected;
+  }
+  Vec3 closest    = projected;
+  float closestSq = MaxFloat;
+  for (uint32_t i = 0; i < face.vertexCount; ++i) {
+    const auto candidate = closestPointOnSegment(point, hull.faceVertex(face, i),
+                                                 hull.faceVertex(face, (i + 1) % face.vertexCount));
+    const auto distSq    = lengthSquared(point - candidate);
+    if (distSq < closestSq) {
+      closestSq = distSq;
+      closest   = candidate;
+    }
+  }
+  return closest;
+}
+
+// Closest point of the hull surface to a point outside the hull
+Vec3 closestPointOnHull(const ConvexHull& hull, const Vec3& point)
+{
+  Vec3 closest    = point;
+  float closestSq = MaxFloat;
+  for (const auto& face : hull.faces) {
+    if (dot(face.normal, point) - face.offset <= 0.f) {
+      continue;
+    }
+    const auto candidate = closestPointOnFace(hull, face, point);
+    const auto distSq    = lengthSquared(point - candidate);
+    if (distSq < closestSq) {
+      closestSq = distSq;
+      closest   = candidate;
+    }
+  }
+  return closest;
+}
+
+// Face of the hull with the largest separation from the point
+float bestFace(const ConvexHull& hull, const Vec3& point, size_t& face)
+{
+  float best = -MaxFloat;
+  face       = 0;
+  for (size_t f = 0; f < hull.faces.size(); ++f) {
+    const auto separation = dot(hull.faces[f].normal, point) - hull.faces[f].offset;
+    if (separation > best) {
+      best = separation;
+      face = f;
+    }
+  }
+  return best;
+}
+
+// Hull A and sphere B, in the local space of the hull
+void collideHullSphere(const ConvexHull& hull, const Vec3& center, float radius, float margin,
+                       ContactManifold& manifold)
+{
+  size_t face;
+  const auto separation = bestFace(hull, center, face);
+  if (separation > radius + margin) {
+    return;
+  }
+  if (separation <= 0.f) {
+    // Center inside the hull
+    const auto& normal = hull.faces[face].normal;
+    const auto depth   = radius - separation;
+    manifold.normal    = normal;
+    addPoint(manifold, center - normal * (0.5f * (separation + radius)), depth);
+    return;
+  }
+  const auto closest  = closestPointOnHull(hull, center);
+  const auto d        = center - closest;
+  const auto distance = length(d);
+  if (distance > radius + margin) {
+    return;
+  }
+  manifold.normal  = distance > 1e-6f ? d * (1.f / distance) : hull.faces[face].normal;
+  const auto depth = radius - distance;
+  addPoint(manifold, closest + manifold.normal * (0.5f * (distance - radius)), depth);
+}
+
+// Contacts of a segment of radius radius lying on a hull face
+bool collideSegmentFace(const ConvexHull& hull, const ConvexHull::Face& face, const Vec3& s0,
+                        const Vec3& s1, float radius, float margin, ContactManifold& manifold)
+{
+  float t0 = 0.f, t1 = 1.f;
+  for (uint32_t i = 0; i < face.vertexCount; ++i) {
+    const auto& v0     = hull.faceVertex(face, i);
+    const auto& v1     = hull.faceVertex(face, (i + 1) % face.vertexCount);
+    const auto side    = cross(v1 - v0, face.normal);
+    const auto offset  = dot(side, v0);
+    const auto d0      = dot(side, s0) - offset;
+    const auto d1      = dot(side, s1) - offset;
+    if (d0 > 0.f && d1 > 0.f) {
+      return false;
+    }
+    if (d0 > 0.f) {
+      t0 = std::max(t0, d0 / (d0 - d1));
+    }
+    else if (d1 > 0.f) {
+      t1 = std::min(t1, d0 / (d0 - d1));
+    }
+  }
+  if (t0 > t1) {
+    return false;
+  }
+  const auto count = manifold.pointCount;
+  for (const auto t : {t0, t1}) {
+    const auto point    = s0 + (s1 - s0) * t;
+    const auto distance = dot(face.normal, point) - face.offset;
+    if (distance <= radius + margin) {
+      addPoint(manifold, point - face.normal * (0.5f * (distance + radius)), radius - distance);
+    }
+    if (t1 - t0 < 1e-4f) {
+      break;
+    }
+  }
+  manifold.normal = face.normal;
+  return manifold.pointCount > count;
+}
+
+// Hull A and capsule B of segment s0s1, in the local space of the hull
+void collideHullCapsule(const ConvexHull& hull, const Vec3& s0, const Vec3& s1, float radius,
+                        float margin, ContactManifold& manifold)
+{
+  // Face axes
+  float faceSeparation = -MaxFloat;
+  size_t face          = 0;
+  for (size_t f = 0; f < hull.faces.size(); ++f) {
+    const auto& plane     = hull.faces[f];
+    const auto separation = std::min(dot(plane.normal, s0), dot(plane.normal, s1)) - plane.offset;
+    if (separation > faceSeparation) {
+      faceSeparation = separation;
+      face           = f;
+    }
+  }
+  if (faceSeparation > radius + margin) {
+    return;
+  }
+
+  // Axes orthogonal to the segment and to the hull edges
+  const auto segment    = s1 - s0;
+  float edgeSeparation  = -MaxFloat;
+  Vec3 edgeAxis         = {0.f, 1.f, 0.f};
+  const ConvexHull::Edge* bestEdge = nullptr;
+  for (const auto& edge : hull.edges) {
+    const auto& v0 = hull.vertices[edge.vertex0];
+    const auto e   = hull.vertices[edge.vertex1] - v0;
+    auto axis      = cross(segment, e);
+    const auto lengthSq = dot(axis, axis);
+    if (lengthSq < 1e-6f * dot(segment, segment) * dot(e, e) || lengthSq <= 0.f) {
+      continue;
+    }
+    axis *= 1.f / std::sqrt(lengthSq);
+    if (dot(axis, s0 - hull.centroid) < 0.f) {
+      axis = -axis;
+    }
+    const auto separation = dot(axis, s0) - dot(axis, hull.support(axis));
+    if (separation > edgeSeparation) {
+      edgeSeparation = separation;
+      edgeAxis       = axis;
+      bestEdge       = &edge;
+    }
+  }
+  if (edgeSeparation > radius + margin) {
+    return;
+  }
+
+  const auto& bestPlane = hull.faces[face];
+  if (std::max(faceSeparation, edgeSeparation) > 0.f) {
+    // The segment is out of the hull: closest points by alternating projections
+    auto point   = (s0 + s1) * 0.5f;
+    auto closest = closestPointOnHull(hull, point);
+    for (int i = 0; i < 8; ++i) {
+      const auto next = closestPointOnSegment(closest, s0, s1);
+      if (lengthSquared(next - point) < 1e-12f) {
+        break;
+      }
+      point   = next;
+      closest = closestPointOnHull(hull, point);
+    }
+    const auto d        = point - closest;
+    const auto distance = length(d);
+    if (distance > radius + margin) {
+      return;
+    }
+    const auto normal = distance > 1e-6f ? d * (1.f / distance) : bestPlane.normal;
+    // A capsule lying on a face gets two contacts
+    const auto segmentLength = length(segment);
+    if (dot(normal, bestPlane.normal) > 0.99f && segmentLength > 0.f
+        && std::abs(dot(segment, bestPlane.normal)) < 0.1f * segmentLength
+        && collideSegmentFace(hull, bestPlane, s0, s1, radius, margin, manifold)) {
+      return;
+    }
+    manifold.normal = normal;
+    addPoint(manifold, closest + normal * (0.5f * (distance - radius)), radius - distance);
+    return;
+  }
+
+  // The segment penetrates the hull
+  if (bestEdge != nullptr && edgeSeparation > faceSeparation + 1e-3f) {
+    Vec3 c1, c2;
+    closestPointsOfSegments(s0, s1, hull.vertices[bestEdge->vertex0],
+                            hull.vertices[bestEdge->vertex1], c1, c2);
+    manifold.normal = edgeAxis;
+    addPoint(manifold, (c1 - edgeAxis * radius + c2) * 0.5f, radius - edgeSeparation);
+    return;
+  }
+  if (!collideSegmentFace(hull, bestPlane, s0, s1, radius, margin, manifold)) {
+    // Deepest end point
+    const auto distance0 = dot(bestPlane.normal, s0) - bestPlane.offset;
+    const auto distance1 = dot(bestPlane.normal, s1) - bestPlane.offset;
+    const auto& deepest  = distance0 < distance1 ? s0 : s1;
+    const auto distance  = std::min(distance0, distance1);
+    manifold.normal      = bestPlane.normal;
+    addPoint(manifold, deepest - bestPlane.normal * (0.5f * (distance + radius)),
+             radius - distance);
+  }
+}
+
+// Hull vertices and planes in the local space of another hull
+struct HullInFrame {
+  std::vector<Vec3> vertices;
+  std::vector<Vec3> normals;
+  std::vector<float> offsets;
+  Vec3 centroid;
+}; // end of struct HullInFrame
+
+void transformHull(const ConvexHull& hull, const Transform& transform, HullInFrame& result)
+{
+  const auto m = toMatrix(transform.rotation);
+  result.vertices.resize(hull.vertices.size());
+  for (size_t i = 0; i < hull.vertices.size(); ++i) {
+    result.vertices[i] = m * hull.vertices[i] + transform.position;
+  }
+  result.normals.resize(hull.faces.size());
+  result.offsets.resize(hull.faces.size());
+  for (size_t f = 0; f < hull.faces.size(); ++f) {
+    result.normals[f] = m * hull.faces[f].normal;
+    result.offsets[f] = hull.faces[f].offset + dot(result.normals[f], transform.position);
+  }
+  result.centroid = m * hull.centroid + transform.position;
+}
+
+// Largest separation of the faces of a hull (given by its normals, offsets) from the vertices of
+// another one
+float queryFaces(const std::vector<Vec3>& normals, const std::vector<float>& offsets,
+                 const std::vector<Vec3>& vertices, size_t& bestFace)
+{
+  float best = -MaxFloat;
+  bestFace   = 0;
+  for (size_t f = 0; f < normals.size(); ++f) {
+    float separation = MaxFloat;
+    for (const auto& v : vertices) {
+      separation = std::min(separation, dot(normals[f], v));
+    }
+    separation -= offsets[f];
+    if (separation > best) {
+      best     = separation;
+      bestFace = f;
+    }
+  }
+  return best;
+}
+
+// Whether the arcs ab and cd of the Gauss maps intersect, i.e. whether the edges build a face of
+// the Minkowski difference (Gregorius, The Separating Axis Test between Convex Polyhedra)
+bool isMinkowskiFace(const Vec3& a, const Vec3& b, const Vec3& c, const Vec3& d)
+{
+  const auto bxa = cross(b, a);
+  const auto dxc = cross(d, c);
+  const auto cba = dot(c, bxa), dba = dot(d, bxa);
+  const auto adc = dot(a, dxc), bdc = dot(b, dxc);
+  return cba * dba < 0.f && adc * bdc < 0.f && cba * bdc > 0.f;
+}
+
+struct EdgeQuery {
+  float separation = -MaxFloat;
+  Vec3 axis{0.f, 1.f, 0.f};
+  uint32_t edgeA = 0;
+  uint32_t edgeB = 0;
+}; // end of struct EdgeQuery
+
+EdgeQuery queryEdges(const ConvexHull& hullA, const ConvexHull& hullB, const HullInFrame& b)
+{
+  EdgeQuery query;
+  for (uint32_t i = 0; i < hullA.edges.size(); ++i) {
+    const auto& edgeA = hullA.edges[i];
+    const auto& pA    = hullA.vertices[edgeA.vertex0];
+    const auto eA     = hullA.vertices[edgeA.vertex1] - pA;
+    const auto& u1    = hullA.faces[edgeA.face0].normal;
+    const auto& v1    = hullA.faces[edgeA.face1].normal;
+    for (uint32_t j = 0; j < hullB.edges.size(); ++j) {
+      const auto& edgeB = hullB.edges[j];
+      const auto& u2    = b.normals[edgeB.face0];
+      const auto& v2    = b.normals[edgeB.face1];
+      if (!isMinkowskiFace(u1, v1, -u2, -v2)) {
+        continue;
+      }
+      const auto& pB      = b.vertices[edgeB.vertex0];
+      const auto eB       = b.vertices[edgeB.vertex1] - pB;
+      auto axis           = cross(eA, eB);
+      const auto lengthSq = dot(axis, axis);
+      if (lengthSq < 2.5e-5f * dot(eA, eA) * dot(eB, eB) || lengthSq <= 0.f) {
+        // Parallel edges
+        continue;
+      }
+      axis *= 1.f / std::sqrt(lengthSq);
+      if (dot(axis, pA - hullA.centroid) < 0.f) {
+        axis = -axis;
+      }
+      const auto separation = dot(axis, pB - pA);
+      if (separation > query.separation) {
+        query.separation = separation;
+        query.axis       = axis;
+        query.edgeA      = i;
+        query.edgeB      = j;
+      }
+    }
+  }
+  return query;
+}
+
+// Keeps the deepest point and the three points spanning the largest area
+void reducePoints(const std::vector<ContactPoint>& points, const Vec3& normal,
+                  ContactManifold& manifold)
+{
+  if (points.size() <= static_cast<size_t>(ContactManifold::MaxPoints)) {
+    for (const auto& point : points) {
+      addPoint(manifold, point.position, point.depth);
+    }
+    return;
+  }
+  size_t i0 = 0;
+  for (size_t i = 1; i < points.size(); ++i) {
+    if (points[i].depth > points[i0].depth) {
+      i0 = i;
+    }
+  }
+  const auto& p0 = points[i0].position;
+  size_t i1      = i0;
+  float best     = -1.f;
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto distSq = lengthSquared(points[i].position - p0);
+    if (distSq > best) {
+      best = distSq;
+      i1   = i;
+    }
+  }
+  const auto& p1 = points[i1].position;
+  size_t i2      = i0;
+  float signedArea = 0.f;
+  best             = -1.f;
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto area = dot(cross(p1 - p0, points[i].position - p0), normal);
+    if (std::abs(area) > best) {
+      best       = std::abs(area);
+      signedArea = area;
+      i2         = i;
+    }
+  }
+  // Fourth point on the other side of the edge p0p1, or farthest out of the triangle
+  const auto& p2 = points[i2].position;
+  const Vec3 triangle[3] = {p0, p1, p2};
+  const auto orientation = signedArea >= 0.f ? 1.f : -1.f;
+  size_t i3              = i0;
+  best                   = 0.f;
+  for (size_t i = 0; i < points.size(); ++i) {
+    for (int e = 0; e < 3; ++e) {
+      const auto& a   = triangle[e];
+      const auto& b   = triangle[(e + 1) % 3];
+      const auto area = -orientation * dot(cross(b - a, points[i].position - a), normal);
+      if (area > best) {
+        best = area;
+        i3   = i;
+      }
+    }
+  }
+  for (const auto i : {i0, i1, i2, i3}) {
+    addPoint(manifold, points[i].position, points[i].depth);
+  }
+  if (i3 == i0) {
+    --manifold.pointCount;
+  }
+}
+
+void clipPolygon(const std::vector<Vec3>& input, const Vec3& normal, float offset,
+                 std::vector<Vec3>& output)
+{
+  output.clear();
+  if (input.empty()) {
+    return;
+  }
+  auto previous         = input.back();
+  auto previousDistance = dot(normal, previous) - offset;
+  for (const auto& current : input) {
+    const auto distance     = dot(normal, current) - offset;
+    const auto intersection = [&]() {
+      return previous + (current - previous) * (previousDistance / (previousDistance - distance));
+    };
+    if (previousDistance <= 0.f && distance <= 0.f) {
+      output.emplace_back(current);
+    }
+    else if (previousDistance <= 0.f) {
+      output.emplace_back(intersection());
+    }
+    else if (distance <= 0.f) {
+      output.emplace_back(intersection());
+      output.emplace_back(current);
+    }
+    previous         = current;
+    previousDistance = distance;
+  }
+}
+
+// Clips the incident face against the reference face. All the geometry is in the same frame.
+void collideFaces(const ConvexHull& reference, const std::vector<Vec3>& referenceVertices,
+                  const Vec3& referenceNormal, float referenceOffset,
+                  const ConvexHull::Face& referenceFace, const ConvexHull& incident,
+                  const std::vector<Vec3>& incidentVertices,
+                  const std::vector<Vec3>& incidentNormals, float margin, bool flip,
+                  ContactManifold& manifold)
+{
+  thread_local std::vector<Vec3> polygon, clipped;
+  thread_local std::vector<ContactPoint> points;
+
+  // Incident face: the most anti-parallel to the reference face
+  size_t incidentFace = 0;
+  float minDot        = MaxFloat;
+  for (size_t f = 0; f < incident.faces.size(); ++f) {
+    const auto d = dot(incidentNormals[f], referenceNormal);
+    if (d < minDot) {
+      minDot       = d;
+      incidentFace = f;
+    }
+  }
+  const auto& face = incident.faces[incidentFace];
+  polygon.clear();
+  for (uint32_t i = 0; i < face.vertexCount; ++i) {
+    polygon.emplace_back(incidentVertices[incident.faceVertices[face.firstVertex + i]]);
+  }
+
+  for (uint32_t i = 0; i < referenceFace.vertexCount && !polygon.empty(); ++i) {
+    const auto next = (i + 1) % referenceFace.vertexCount;
+    const auto& v0  = referenceVertices[reference.faceVertices[referenceFace.firstVertex + i]];
+    const auto& v1  = referenceVertices[reference.faceVertices[referenceFace.firstVertex + next]];
+    const auto side = cross(v1 - v0, referenceNormal);
+    clipPolygon(polygon, side, dot(side, v0), clipped);
+    std::swap(polygon, clipped);
+  }
+
+  points.clear();
+  for (const auto& point : polygon) {
+    const auto separation = dot(referenceNormal, point) - referenceOffset;
+    if (separation <= margin) {
+      points.push_back({point - referenceNormal * (0.5f * separation), -separation});
+    }
+  }
+  manifold.normal = flip ? -referenceNormal : referenceNormal;
+  reducePoints(points, referenceNormal, manifold);
+}
+
+// Hulls A and B, in the local space of A
+void collideHulls(const ConvexHull& hullA, const ConvexHull& hullB, const Transform& bInA,
+                  float margin, ContactManifold& manifold)
+{
+  thread_local HullInFrame b;
+  transformHull(hullB, bInA, b);
+
+  size_t faceA;
+  thread_local std::vector<Vec3> normalsA;
+  thread_local std::vector<float> planeOffsetsA;
+  normalsA.resize(hullA.faces.size());
+  planeOffsetsA.resize(hullA.faces.size());
+  for (size_t f = 0; f < hullA.faces.size(); ++f) {
+    normalsA[f]      = hullA.faces[f].normal;
+    planeOffsetsA[f] = hullA.faces[f].offset;
+  }
+  const auto separationA = queryFaces(normalsA, planeOffsetsA, b.vertices, faceA);
+  if (separationA > margin) {
+    return;
+  }
+  size_t faceB;
+  const auto separationB = queryFaces(b.normals, b.offsets, hullA.vertices, faceB);
+  if (separationB > margin) {
+    return;
+  }
+  const auto edges = queryEdges(hullA, hullB, b);
+  if (edges.separation > margin) {
+    return;
+  }
+
+  // Favor the faces over the edges, and the faces of A over the faces of B, for coherence
+  const auto linearSlop = 0.005f;
+  const auto maxFace    = std::max(separationA, separationB);
+  if (edges.separation > 0.9f * maxFace + 0.5f * linearSlop
+      && edges.separation > maxFace + 1e-4f) {
+    const auto& edgeA = hullA.edges[edges.edgeA];
+    const auto& edgeB = hullB.edges[edges.edgeB];
+    Vec3 c1, c2;
+    closestPointsOfSegments(hullA.vertices[edgeA.vertex0], hullA.vertices[edgeA.vertex1],
+                            b.vertices[edgeB.vertex0], b.vertices[edgeB.vertex1], c1, c2);
+    manifold.normal = edges.axis;
+    addPoint(manifold, (c1 + c2) * 0.5f, -edges.separation);
+    return;
+  }
+
+  if (separationB > 0.98f * separationA + 0.5f * linearSlop) {
+    // Reference face on B
+    collideFaces(hullB, b.vertices, b.normals[faceB], b.offsets[faceB], hullB.faces[faceB], hullA,
+                 hullA.vertices, normalsA, margin, true, manifold);
+  }
+  else {
+    collideFaces(hullA, hullA.vertices, hullA.faces[faceA].normal, hullA.faces[faceA].offset,
+                 hullA.faces[faceA], hullB, b.vertices, b.normals, margin, false, manifold);
+  }
+}
+
+void flip(ContactManifold& manifold)
+{
+  manifold.normal = -manifold.normal;
+}
+
+// End points of the segment of a capsule
+void capsuleSegment(const CollisionShape& shape, const Transform& transform, Vec3& s0, Vec3& s1)
+{
+  const auto axis = rotate(transform.rotation, Vec3{0.f, shape.halfHeight, 0.f});
+  s0              = transform.position - axis;
+  s1              = transform.position + axis;
+}
+
+void collideHullAndRound(const CollisionShape& hull, const Transform& hullTransform,
+                         const CollisionShape& round, const Transform& roundTransform,
+                         float margin, ContactManifold& manifold)
+{
+  if (round.type == ShapeType::Sphere) {
+    collideHullSphere(*hull.hull, inverseTransformPoint(hullTransform, roundTransform.position),
+                      round.radius, margin, manifold);
+  }
+  else {
+    Vec3 s0, s1;
+    capsuleSegment(round, roundTransform, s0, s1);
+    collideHullCapsule(*hull.hull, inverseTransformPoint(hullTransform, s0),
+                       inverseTransformPoint(hullTransform, s1), round.radius, margin, manifold);
+  }
+  toWorld(hullTransform, manifold);
+}
+
+} // end of anonymous namespace
+
+void Collide(const CollisionShape& shapeA, const Transform& transformA,
+             const CollisionShape& shapeB, const Transform& transformB, float margin,
+             ContactManifold& manifold)
+{
+  manifold.pointCount = 0;
+  const auto typeA    = shapeA.type;
+  const auto typeB    = shapeB.type;
+
+  if (typeA == ShapeType::ConvexHull && typeB == ShapeType::ConvexHull) {
+    Transform bInA;
+    bInA.rotation = conjugate(transformA.rotation) * transformB.rotation;
+    bInA.position = inverseTransformPoint(transformA, transformB.position);
+    collideHulls(*shapeA.hull, *shapeB.hull, bInA, margin, manifold);
+    toWorld(transformA, manifold);
+    return;
+  }
+  if (typeA == ShapeType::ConvexHull) {
+    collideHullAndRound(shapeA, transformA, shapeB, transformB, margin, manifold);
+    return;
+  }
+  if (typeB == ShapeType::ConvexHull) {
+    collideHullAndRound(shapeB, transformB, shapeA, transformA, margin, manifold);
+    flip(manifold);
+    return;
+  }
+
+  // Spheres and capsules: spheres are capsules with a null segment
+  Vec3 a0 = transformA.position, a1 = transformA.position;
+  Vec3 b0 = transformB.position, b1 = transformB.position;
+  if (typeA == ShapeType::Capsule) {
+    capsuleSegment(shapeA, transformA, a0, a1);
+  }
+  if (typeB == ShapeType::Capsule) {
+    capsuleSegment(shapeB, transformB, b0, b1);
+  }
+  collideCapsules(a0, a1, shapeA.radius, b0, b1, shapeB.radius, margin, manifold);
+}
+
+} // end of namespace NativePhysics
+} // end of namespace BABYLON
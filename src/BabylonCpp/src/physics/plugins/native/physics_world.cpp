@@ -0,0 +1,1208 @@
+#include <babylon/physics/plugins/native/physics_world.h>
+
+#include <babylon/core/thread_pool.h>
+
+namespace BABYLON {
+namespace NativePhysics {
+
+namespace {
+
+constexpr float Infinity = std::numeric_limits<float>::infinity();
+// Fraction of the position error corrected at each step
+constexpr float Baumgarte = 0.2f;
+// Penetration allowed to keep the contacts of resting bodies
+constexpr float LinearSlop = 0.005f;
+// Distance under which separated shapes get speculative contacts
+constexpr float SpeculativeDistance = 4.f * LinearSlop;
+// Distance under which the contact points of successive steps are matched for warm starting
+constexpr float MatchDistance = 0.05f;
+// Impact velocity above which the restitution applies
+constexpr float RestitutionThreshold = 1.f;
+// Maximum distance traveled in a step, for stability
+constexpr float MaxTranslation = 2.f;
+constexpr float SleepLinearVelocity  = 0.05f;
+constexpr float SleepAngularVelocity = 2.f / 180.f * 3.14159265f;
+constexpr float TimeToSleep          = 0.5f;
+// Islands with this many constraints are solved with parallel batches
+constexpr size_t LargeIslandConstraints = 128;
+// Batches of a large island, the last one gathering the constraints which fit in no other batch
+constexpr uint32_t BatchCount = 64;
+// Items per range of the parallel loops
+constexpr size_t ContactGrain    = 64;
+constexpr size_t IslandGrain     = 8;
+constexpr size_t BodyGrain       = 256;
+constexpr size_t ConstraintGrain = 64;
+
+uint64_t pairKey(BodyId a, BodyId b)
+{
+  if (a > b) {
+    std::swap(a, b);
+  }
+  return (static_cast<uint64_t>(a) << 32) | b;
+}
+
+DynamicAABBTree::Box toBox(const AABB& aabb)
+{
+  return {{aabb.minimum.x, aabb.minimum.y, aabb.minimum.z},
+          {aabb.maximum.x, aabb.maximum.y, aabb.maximum.z}};
+}
+
+Transform transformOf(const Body& body)
+{
+  return {body.position, body.rotation};
+}
+
+void applyImpulseAt(Body& body, const Vec3& impulse, const Vec3& r)
+{
+  if (body.isDynamic()) {
+    body.linearVelocity += impulse * body.invMass;
+    body.angularVelocity += body.invInertiaWorld * cross(r, impulse);
+  }
+}
+
+// Velocity of the point at r from the center of the body
+Vec3 pointVelocity(const Body& body, const Vec3& r)
+{
+  return body.linearVelocity + cross(body.angularVelocity, r);
+}
+
+float effectiveMass(const Body& a, const Body& b, const Vec3& rA, const Vec3& rB, const Vec3& axis)
+{
+  const auto rnA = cross(rA, axis);
+  const auto rnB = cross(rB, axis);
+  const auto k   = a.invMass + b.invMass + dot(rnA, a.invInertiaWorld * rnA)
+                 + dot(rnB, b.invInertiaWorld * rnB);
+  return k > 0.f ? 1.f / k : 0.f;
+}
+
+void applyRowImpulse(const JointRow& row, Body& a, Body& b, float impulse)
+{
+  if (a.isDynamic()) {
+    a.linearVelocity += row.linearA * (a.invMass * impulse);
+    a.angularVelocity += a.invInertiaWorld * (row.angularA * impulse);
+  }
+  if (b.isDynamic()) {
+    b.linearVelocity += row.linearB * (b.invMass * impulse);
+    b.angularVelocity += b.invInertiaWorld * (row.angularB * impulse);
+  }
+}
+
+} // end of anonymous namespace
+
+PhysicsWorld::PhysicsWorld()
+    : _iterations{10}, _bodyCount{0}, _threadPool{nullptr}, _stepIndex{0}
+{
+}
+
+PhysicsWorld::~PhysicsWorld() = default;
+
+void PhysicsWorld::setGravity(const Vec3& gravity)
+{
+  _gravity = gravity;
+  for (auto& body : _bodies) {
+    if (body.used && body.isDynamic()) {
+      body.sleeping  = false;
+      body.sleepTime = 0.f;
+    }
+  }
+}
+
+void PhysicsWorld::setThreadPool(ThreadPool* threadPool)
+{
+  _threadPool = threadPool;
+}
+
+void PhysicsWorld::setIterations(size_t iterations)
+{
+  _iterations = std::max<size_t>(iterations, 1);
+}
+
+size_t PhysicsWorld::awakeBodyCount() const
+{
+  return static_cast<size_t>(std::count_if(_bodies.begin(), _bodies.end(), [](const Body& body) {
+    return body.used && body.isAwake();
+  }));
+}
+
+void PhysicsWorld::_updateMassProperties(Body& body) const
+{
+  body.invMass         = body.mass > 0.f ? 1.f / body.mass : 0.f;
+  body.invInertiaLocal = body.shape.computeInverseInertia(body.mass);
+  body.invInertiaWorld = rotateDiagonal(toMatrix(body.rotation), body.invInertiaLocal);
+}
+
+BodyId PhysicsWorld::createBody(const BodyDefinition& definition)
+{
+  BodyId id;
+  if (!_freeBodies.empty()) {
+    id = _freeBodies.back();
+    _freeBodies.pop_back();
+  }
+  else {
+    id = static_cast<BodyId>(_bodies.size());
+    _bodies.emplace_back();
+  }
+
+  auto& body          = _bodies[id];
+  body                = Body{};
+  body.shape          = definition.shape;
+  body.position       = definition.position;
+  body.rotation       = normalize(definition.rotation);
+  body.mass           = std::max(definition.mass, 0.f);
+  body.friction       = definition.friction;
+  body.restitution    = definition.restitution;
+  body.linearDamping  = definition.linearDamping;
+  body.angularDamping = definition.angularDamping;
+  body.userData       = definition.userData;
+  body.used           = true;
+  _updateMassProperties(body);
+
+  body.proxyId = _tree.createProxy(toBox(body.shape.computeAABB(transformOf(body))), id);
+  _moveBuffer.emplace_back(body.proxyId);
+  ++_bodyCount;
+  return id;
+}
+
+void PhysicsWorld::destroyBody(BodyId id)
+{
+  auto& body = _bodies[id];
+  if (!body.used) {
+    return;
+  }
+
+  for (JointId j = 0; j < _joints.size(); ++j) {
+    const auto& joint = _joints[j];
+    if (joint.used && (joint.definition.bodyA == id || joint.definition.bodyB == id)) {
+      destroyJoint(j);
+    }
+  }
+  for (size_t i = _contacts.size(); i-- > 0;) {
+    if (_contacts[i].bodyA == id || _contacts[i].bodyB == id) {
+      _wakeContactBodies(_contacts[i]);
+      _destroyContact(i);
+    }
+  }
+
+  _moveBuffer.erase(std::remove(_moveBuffer.begin(), _moveBuffer.end(), body.proxyId),
+                    _moveBuffer.end());
+  _tree.destroyProxy(body.proxyId);
+  body = Body{};
+  _freeBodies.emplace_back(id);
+  --_bodyCount;
+}
+
+void PhysicsWorld::_wakeContactBodies(const Contact& contact)
+{
+  wakeUp(contact.bodyA);
+  wakeUp(contact.bodyB);
+}
+
+void PhysicsWorld::_synchronizeProxy(BodyId id)
+{
+  const auto& body = _bodies[id];
+  if (_tree.moveProxy(body.proxyId, toBox(body.shape.computeAABB(transformOf(body))))) {
+    _moveBuffer.emplace_back(body.proxyId);
+  }
+}
+
+void PhysicsWorld::setTransform(BodyId id, const Vec3& position, const Quat& rotation)
+{
+  auto& body = _bodies[id];
+  const auto q = normalize(rotation);
+  const auto cosine
+    = body.rotation.x * q.x + body.rotation.y * q.y + body.rotation.z * q.z + body.rotation.w * q.w;
+  if (lengthSquared(position - body.position) < 1e-12f && std::abs(cosine) > 1.f - 1e-6f) {
+    return;
+  }
+  body.position        = position;
+  body.rotation        = q;
+  body.invInertiaWorld = rotateDiagonal(toMatrix(q), body.invInertiaLocal);
+  wakeUp(id);
+  _synchronizeProxy(id);
+}
+
+void PhysicsWorld::setTransforms(size_t count, const BodyId* ids, const Vec3* positions,
+                                 const Quat* rotations)
+{
+  for (size_t i = 0; i < count; ++i) {
+    setTransform(ids[i], positions[i], rotations[i]);
+  }
+}
+
+size_t PhysicsWorld::getMovedTransforms(uint32_t sinceStep, size_t count, const BodyId* ids,
+                                        uint32_t* indices, Vec3* positions,
+                                        Quat* rotations) const
+{
+  size_t movedCount = 0;
+  for (size_t i = 0; i < count; ++i) {
+    const auto& body = _bodies[ids[i]];
+    if (body.movedStep <= sinceStep) {
+      continue;
+    }
+    indices[movedCount]   = static_cast<uint32_t>(i);
+    positions[movedCount] = body.position;
+    rotations[movedCount] = body.rotation;
+    ++movedCount;
+  }
+  return movedCount;
+}
+
+void PhysicsWorld::setLinearVelocity(BodyId id, const Vec3& velocity)
+{
+  auto& body = _bodies[id];
+  if (!body.isDynamic()) {
+    return;
+  }
+  body.linearVelocity = velocity;
+  if (lengthSquared(velocity) > 0.f) {
+    wakeUp(id);
+  }
+}
+
+void PhysicsWorld::setAngularVelocity(BodyId id, const Vec3& velocity)
+{
+  auto& body = _bodies[id];
+  if (!body.isDynamic()) {
+    return;
+  }
+  body.angularVelocity = velocity;
+  if (lengthSquared(velocity) > 0.f) {
+    wakeUp(id);
+  }
+}
+
+void PhysicsWorld::applyImpulse(BodyId id, const Vec3& impulse, const Vec3& point)
+{
+  auto& body = _bodies[id];
+  if (!body.isDynamic()) {
+    return;
+  }
+  wakeUp(id);
+  applyImpulseAt(body, impulse, point - body.position);
+}
+
+void PhysicsWorld::applyForce(BodyId id, const Vec3& force, const Vec3& point)
+{
+  auto& body = _bodies[id];
+  if (!body.isDynamic()) {
+    return;
+  }
+  wakeUp(id);
+  body.force += force;
+  body.torque += cross(point - body.position, force);
+}
+
+void PhysicsWorld::setMass(BodyId id, float mass)
+{
+  auto& body = _bodies[id];
+  body.mass  = std::max(mass, 0.f);
+  _updateMassProperties(body);
+  if (!body.isDynamic()) {
+    body.linearVelocity  = {0.f, 0.f, 0.f};
+    body.angularVelocity = {0.f, 0.f, 0.f};
+    body.sleeping        = false;
+  }
+  wakeUp(id);
+}
+
+void PhysicsWorld::setShape(BodyId id, const CollisionShape& shape)
+{
+  auto& body = _bodies[id];
+  body.shape = shape;
+  _updateMassProperties(body);
+  _moveBuffer.erase(std::remove(_moveBuffer.begin(), _moveBuffer.end(), body.proxyId),
+                    _moveBuffer.end());
+  _tree.destroyProxy(body.proxyId);
+  body.proxyId = _tree.createProxy(toBox(body.shape.computeAABB(transformOf(body))), id);
+  _moveBuffer.emplace_back(body.proxyId);
+  wakeUp(id);
+}
+
+void PhysicsWorld::wakeUp(BodyId id)
+{
+  auto& body = _bodies[id];
+  if (body.isDynamic()) {
+    body.sleeping  = false;
+    body.sleepTime = 0.f;
+  }
+}
+
+void PhysicsWorld::sleep(BodyId id)
+{
+  auto& body = _bodies[id];
+  if (body.isDynamic()) {
+    body.sleeping        = true;
+    body.linearVelocity  = {0.f, 0.f, 0.f};
+    body.angularVelocity = {0.f, 0.f, 0.f};
+  }
+}
+
+JointId PhysicsWorld::createJoint(const JointDefinition& definition)
+{
+  JointId id;
+  if (!_freeJoints.empty()) {
+    id = _freeJoints.back();
+    _freeJoints.pop_back();
+  }
+  else {
+    id = static_cast<JointId>(_joints.size());
+    _joints.emplace_back();
+  }
+
+  auto& joint      = _joints[id];
+  joint            = Joint{};
+  joint.definition = definition;
+  joint.used       = true;
+
+  auto& def     = joint.definition;
+  const auto& a = _bodies[def.bodyA];
+  const auto& b = _bodies[def.bodyB];
+  def.axisA     = normalizeOr(def.axisA, {1.f, 0.f, 0.f});
+  def.axisB     = normalizeOr(def.axisB, {1.f, 0.f, 0.f});
+  joint.relativeRotation = conjugate(a.rotation) * b.rotation;
+
+  // Reference axis orthogonal to the axis of A, in the local spaces of A and B
+  Vec3 t1, t2;
+  computeBasis(def.axisA, t1, t2);
+  joint.referenceA = t1;
+  joint.referenceB = inverseRotate(b.rotation, rotate(a.rotation, t1));
+  if (def.type == JointType::Universal) {
+    const auto worldAxisA = rotate(a.rotation, def.axisA);
+    const auto worldAxisB = rotate(b.rotation, def.axisB);
+    if (std::abs(dot(worldAxisA, worldAxisB)) > 0.99f) {
+      def.axisB = joint.referenceB;
+    }
+  }
+  if (def.type == JointType::Distance && def.maxDistance <= 0.f) {
+    def.maxDistance = length(transformPoint(transformOf(b), def.pivotB)
+                             - transformPoint(transformOf(a), def.pivotA));
+  }
+
+  if (!def.collideConnected) {
+    const auto key = pairKey(def.bodyA, def.bodyB);
+    ++_jointPairs[key];
+    const auto it = _pairs.find(key);
+    if (it != _pairs.end()) {
+      _destroyContact(it->second);
+    }
+  }
+  wakeUp(def.bodyA);
+  wakeUp(def.bodyB);
+  return id;
+}
+
+void PhysicsWorld::destroyJoint(JointId id)
+{
+  auto& joint = _joints[id];
+  if (!joint.used) {
+    return;
+  }
+  const auto& def = joint.definition;
+  if (!def.collideConnected) {
+    const auto key = pairKey(def.bodyA, def.bodyB);
+    auto it        = _jointPairs.find(key);
+    if (it != _jointPairs.end() && --it->second == 0) {
+      _jointPairs.erase(it);
+      // The bodies may be touching: let the broadphase find the pair again
+      _moveBuffer.emplace_back(_bodies[def.bodyA].proxyId);
+    }
+  }
+  wakeUp(def.bodyA);
+  wakeUp(def.bodyB);
+  joint = Joint{};
+  _freeJoints.emplace_back(id);
+}
+
+void PhysicsWorld::setMotor(JointId id, unsigned int index, float speed, float maxForce)
+{
+  auto& joint    = _joints[id];
+  auto& motor    = joint.motors[std::min(index, 1u)];
+  motor.enabled  = true;
+  motor.speed    = speed;
+  motor.maxForce = maxForce;
+  wakeUp(joint.definition.bodyA);
+  wakeUp(joint.definition.bodyB);
+}
+
+void PhysicsWorld::setLimit(JointId id, float lower, float upper)
+{
+  auto& joint         = _joints[id];
+  joint.limit.enabled = true;
+  joint.limit.lower   = std::min(lower, upper);
+  joint.limit.upper   = std::max(lower, upper);
+  wakeUp(joint.definition.bodyA);
+  wakeUp(joint.definition.bodyB);
+}
+
+void PhysicsWorld::setDistance(JointId id, float minDistance, float maxDistance)
+{
+  auto& joint                  = _joints[id];
+  joint.definition.minDistance = std::max(minDistance, 0.f);
+  joint.definition.maxDistance = std::max(maxDistance, joint.definition.minDistance);
+  wakeUp(joint.definition.bodyA);
+  wakeUp(joint.definition.bodyB);
+}
+
+RayHit PhysicsWorld::raycast(const Vec3& from, const Vec3& to) const
+{
+  RayHit result;
+  _tree.raycast({from.x, from.y, from.z}, {to.x, to.y, to.z},
+                [&](int proxyId, float maxFraction) {
+                  const auto id    = static_cast<BodyId>(_tree.userData(proxyId));
+                  const auto& body = _bodies[id];
+                  float fraction;
+                  Vec3 normal;
+                  if (!body.shape.raycast(transformOf(body), from, to, maxFraction, fraction,
+                                          normal)) {
+                    return maxFraction;
+                  }
+                  result.hit      = true;
+                  result.body     = id;
+                  result.fraction = fraction;
+                  result.point    = from + (to - from) * fraction;
+                  result.normal   = normal;
+                  return fraction;
+                });
+  return result;
+}
+
+void PhysicsWorld::queryAABB(const AABB& box, std::vector<BodyId>& bodies) const
+{
+  bodies.clear();
+  _tree.query(toBox(box), [&](int proxyId) {
+    bodies.emplace_back(static_cast<BodyId>(_tree.userData(proxyId)));
+    return true;
+  });
+  std::sort(bodies.begin(), bodies.end());
+}
+
+bool PhysicsWorld::_shouldCollide(BodyId a, BodyId b) const
+{
+  if (a == b) {
+    return false;
+  }
+  const auto& bodyA = _bodies[a];
+  const auto& bodyB = _bodies[b];
+  if (!bodyA.isDynamic() && !bodyB.isDynamic()) {
+    return false;
+  }
+  return _jointPairs.empty() || _jointPairs.find(pairKey(a, b)) == _jointPairs.end();
+}
+
+void PhysicsWorld::_findNewContacts()
+{
+  // Sorted so that the contacts are created in the same order for the same world
+  std::sort(_moveBuffer.begin(), _moveBuffer.end());
+  _moveBuffer.erase(std::unique(_moveBuffer.begin(), _moveBuffer.end()), _moveBuffer.end());
+
+  for (const auto proxyId : _moveBuffer) {
+    const auto bodyId = static_cast<BodyId>(_tree.userData(proxyId));
+    _tree.query(_tree.fatBox(proxyId), [&](int otherProxyId) {
+      const auto otherId = static_cast<BodyId>(_tree.userData(otherProxyId));
+      if (!_shouldCollide(bodyId, otherId)) {
+        return true;
+      }
+      const auto key = pairKey(bodyId, otherId);
+      if (_pairs.find(key) != _pairs.end()) {
+        return true;
+      }
+      Contact contact;
+      contact.bodyA       = std::min(bodyId, otherId);
+      contact.bodyB       = std::max(bodyId, otherId);
+      const auto& a       = _bodies[contact.bodyA];
+      const auto& b       = _bodies[contact.bodyB];
+      contact.friction    = std::sqrt(a.friction * b.friction);
+      contact.restitution = std::max(a.restitution, b.restitution);
+      _pairs.emplace(key, static_cast<uint32_t>(_contacts.size()));
+      _contacts.emplace_back(contact);
+      return true;
+    });
+  }
+  _moveBuffer.clear();
+}
+
+void PhysicsWorld::_destroyContact(size_t index)
+{
+  _pairs.erase(pairKey(_contacts[index].bodyA, _contacts[index].bodyB));
+  if (index + 1 != _contacts.size()) {
+    _contacts[index] = _contacts.back();
+    _pairs[pairKey(_contacts[index].bodyA, _contacts[index].bodyB)]
+      = static_cast<uint32_t>(index);
+  }
+  _contacts.pop_back();
+}
+
+void PhysicsWorld::_updateContacts(ThreadPool& threadPool)
+{
+  for (size_t i = 0; i < _contacts.size();) {
+    const auto& contact = _contacts[i];
+    if (!DynamicAABBTree::Overlaps(_tree.fatBox(_bodies[contact.bodyA].proxyId),
+                                   _tree.fatBox(_bodies[contact.bodyB].proxyId))) {
+      _destroyContact(i);
+      continue;
+    }
+    ++i;
+  }
+
+  // Each contact only reads its two bodies
+  threadPool.parallelFor(_contacts.size(), ContactGrain,
+                         [this](size_t begin, size_t end, size_t /*workerIndex*/) {
+                           ContactManifold manifold;
+                           for (size_t i = begin; i < end; ++i) {
+                             _updateContact(_contacts[i], manifold);
+                           }
+                         });
+}
+
+void PhysicsWorld::_updateContact(Contact& contact, ContactManifold& manifold) const
+{
+  const auto& a = _bodies[contact.bodyA];
+  const auto& b = _bodies[contact.bodyB];
+  // Resting contacts keep their manifold
+  if (!a.isAwake() && !b.isAwake()) {
+    return;
+  }
+
+  const auto transformA = transformOf(a);
+  Collide(a.shape, transformA, b.shape, transformOf(b), SpeculativeDistance, manifold);
+
+  Contact::Point previous[ContactManifold::MaxPoints];
+  const auto previousCount = contact.pointCount;
+  std::copy(contact.points, contact.points + previousCount, previous);
+
+  contact.normal = manifold.normal;
+  computeBasis(manifold.normal, contact.tangents[0], contact.tangents[1]);
+  contact.pointCount = manifold.pointCount;
+  for (int p = 0; p < manifold.pointCount; ++p) {
+    auto& point   = contact.points[p];
+    point         = Contact::Point{};
+    const auto& x = manifold.points[p].position;
+    point.localA  = inverseTransformPoint(transformA, x);
+    point.rA      = x - a.position;
+    point.rB      = x - b.position;
+    point.depth   = manifold.points[p].depth;
+    // Warm starting with the impulses of the closest point of the previous step
+    auto bestDistSq = MatchDistance * MatchDistance;
+    for (int q = 0; q < previousCount; ++q) {
+      const auto distSq = lengthSquared(previous[q].localA - point.localA);
+      if (distSq < bestDistSq) {
+        bestDistSq              = distSq;
+        point.normalImpulse     = previous[q].normalImpulse;
+        point.tangentImpulse[0] = previous[q].tangentImpulse[0];
+        point.tangentImpulse[1] = previous[q].tangentImpulse[1];
+      }
+    }
+  }
+}
+
+void PhysicsWorld::_buildIslands()
+{
+  // Union find of the dynamic bodies connected by touching contacts and joints
+  auto& parents = _islandParents;
+  parents.resize(_bodies.size());
+  for (uint32_t i = 0; i < parents.size(); ++i) {
+    parents[i] = i;
+  }
+  const auto find = [&parents](uint32_t i) {
+    while (parents[i] != i) {
+      parents[i] = parents[parents[i]];
+      i          = parents[i];
+    }
+    return i;
+  };
+  const auto unite = [&](BodyId a, BodyId b) {
+    if (!_bodies[a].isDynamic() || !_bodies[b].isDynamic()) {
+      return;
+    }
+    const auto rootA = find(a);
+    const auto rootB = find(b);
+    if (rootA != rootB) {
+      parents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+    }
+  };
+  for (const auto& contact : _contacts) {
+    if (contact.pointCount > 0) {
+      unite(contact.bodyA, contact.bodyB);
+    }
+  }
+  for (const auto& joint : _joints) {
+    if (joint.used) {
+      unite(joint.definition.bodyA, joint.definition.bodyB);
+    }
+  }
+
+  // An island with an awake body is awake. Islands are numbered by their smallest body.
+  constexpr uint32_t NoIsland = ~uint32_t(0);
+  std::vector<uint32_t>& islandOfRoot = _islandIndices;
+  islandOfRoot.assign(_bodies.size(), NoIsland);
+  for (BodyId i = 0; i < _bodies.size(); ++i) {
+    if (_bodies[i].used && _bodies[i].isAwake()) {
+      islandOfRoot[find(i)] = 0;
+    }
+  }
+  size_t islandCount = 0;
+  for (BodyId i = 0; i < _bodies.size(); ++i) {
+    auto& body = _bodies[i];
+    if (!body.used || !body.isDynamic()) {
+      continue;
+    }
+    const auto root = find(i);
+    if (islandOfRoot[root] == NoIsland) {
+      continue;
+    }
+    if (root == i) {
+      islandOfRoot[root] = static_cast<uint32_t>(islandCount++);
+      if (_islands.size() < islandCount) {
+        _islands.emplace_back();
+      }
+      auto& island = _islands[islandCount - 1];
+      island.bodies.clear();
+      island.contacts.clear();
+      island.joints.clear();
+    }
+    if (body.sleeping) {
+      body.sleeping  = false;
+      body.sleepTime = 0.f;
+    }
+    _islands[islandOfRoot[root]].bodies.emplace_back(i);
+  }
+  _islands.resize(islandCount);
+
+  const auto islandOf = [&](BodyId a, BodyId b) {
+    return islandOfRoot[find(_bodies[a].isDynamic() ? a : b)];
+  };
+  for (uint32_t c = 0; c < _contacts.size(); ++c) {
+    const auto& contact = _contacts[c];
+    if (contact.pointCount == 0) {
+      continue;
+    }
+    const auto island = islandOf(contact.bodyA, contact.bodyB);
+    if (island != NoIsland) {
+      _islands[island].contacts.emplace_back(c);
+    }
+  }
+  for (JointId j = 0; j < _joints.size(); ++j) {
+    const auto& joint = _joints[j];
+    if (!joint.used) {
+      continue;
+    }
+    const auto island = islandOf(joint.definition.bodyA, joint.definition.bodyB);
+    if (island != NoIsland) {
+      _islands[island].joints.emplace_back(j);
+    }
+  }
+}
+
+void PhysicsWorld::_prepareJoint(Joint& joint, float timeStep)
+{
+  const auto& def = joint.definition;
+  const auto& a   = _bodies[def.bodyA];
+  const auto& b   = _bodies[def.bodyB];
+  const auto beta = Baumgarte / timeStep;
+  const auto rA   = rotate(a.rotation, def.pivotA);
+  const auto rB   = rotate(b.rotation, def.pivotB);
+  const auto d    = (b.position + rB) - (a.position + rA);
+  const Vec3 zero{0.f, 0.f, 0.f};
+
+  std::array<bool, Joint::MaxRows> used{};
+  const auto setRow = [&](size_t index, const Vec3& linearA, const Vec3& angularA,
+                          const Vec3& linearB, const Vec3& angularB, float bias, float lower,
+                          float upper) {
+    auto& row    = joint.rows[index];
+    used[index]  = true;
+    row.linearA  = linearA;
+    row.angularA = angularA;
+    row.linearB  = linearB;
+    row.angularB = angularB;
+    const auto k = a.invMass * dot(linearA, linearA) + dot(angularA, a.invInertiaWorld * angularA)
+                   + b.invMass * dot(linearB, linearB)
+                   + dot(angularB, b.invInertiaWorld * angularB);
+    row.mass  = k > 0.f ? 1.f / k : 0.f;
+    row.bias  = bias;
+    row.lower = lower;
+    row.upper = upper;
+    if (!row.active) {
+      row.impulse = 0.f;
+      row.active  = true;
+    }
+    row.impulse = std::clamp(row.impulse, lower, upper);
+  };
+  // Bias of a one sided constraint C >= 0, speculative while it is satisfied
+  const auto inequalityBias = [&](float c) { return c < 0.f ? beta * c : c / timeStep; };
+  const auto motorBounds    = [&](const Joint::Motor& motor) {
+    return motor.maxForce > 0.f ? motor.maxForce * timeStep : Infinity;
+  };
+
+  const auto pointRows = [&]() {
+    for (int k = 0; k < 3; ++k) {
+      Vec3 e{0.f, 0.f, 0.f};
+      e[k] = 1.f;
+      setRow(static_cast<size_t>(k), -e, -cross(rA, e), e, cross(rB, e), beta * d[k], -Infinity,
+             Infinity);
+    }
+  };
+  const auto rotationRows = [&](size_t first) {
+    // Rotation of B from its rest orientation relative to A
+    auto error = b.rotation * conjugate(a.rotation * joint.relativeRotation);
+    if (error.w < 0.f) {
+      error = {-error.x, -error.y, -error.z, -error.w};
+    }
+    const Vec3 c{2.f * error.x, 2.f * error.y, 2.f * error.z};
+    for (int k = 0; k < 3; ++k) {
+      Vec3 e{0.f, 0.f, 0.f};
+      e[k] = 1.f;
+      setRow(first + static_cast<size_t>(k), zero, -e, zero, e, beta * c[k], -Infinity, Infinity);
+    }
+  };
+  const auto angularRows = [&](const Vec3& axis, float c, size_t index, const Joint::Motor* motor,
+                               bool limited) {
+    if (motor != nullptr && motor->enabled) {
+      const auto bound = motorBounds(*motor);
+      setRow(index, zero, -axis, zero, axis, -motor->speed, -bound, bound);
+    }
+    if (limited && joint.limit.enabled) {
+      setRow(8, zero, -axis, zero, axis, inequalityBias(c - joint.limit.lower), 0.f, Infinity);
+      setRow(9, zero, axis, zero, -axis, inequalityBias(joint.limit.upper - c), 0.f, Infinity);
+    }
+  };
+
+  switch (def.type) {
+    case JointType::Ball:
+      pointRows();
+      break;
+    case JointType::Hinge: {
+      pointRows();
+      const auto axis  = rotate(a.rotation, def.axisA);
+      const auto axisB = rotate(b.rotation, def.axisB);
+      Vec3 perpendiculars[2];
+      computeBasis(axis, perpendiculars[0], perpendiculars[1]);
+      for (size_t k = 0; k < 2; ++k) {
+        const auto& p = perpendiculars[k];
+        const auto j  = cross(p, axisB);
+        setRow(3 + k, zero, j, zero, -j, beta * dot(p, axisB), -Infinity, Infinity);
+      }
+      const auto referenceA = rotate(a.rotation, joint.referenceA);
+      const auto referenceB = rotate(b.rotation, joint.referenceB);
+      const auto angle
+        = std::atan2(dot(cross(referenceA, referenceB), axis), dot(referenceA, referenceB));
+      angularRows(axis, angle, 6, &joint.motors[0], true);
+      break;
+    }
+    case JointType::Universal: {
+      pointRows();
+      const auto axisA = rotate(a.rotation, def.axisA);
+      const auto axisB = rotate(b.rotation, def.axisB);
+      const auto j     = cross(axisA, axisB);
+      setRow(3, zero, j, zero, -j, beta * dot(axisA, axisB), -Infinity, Infinity);
+      angularRows(axisA, 0.f, 6, &joint.motors[0], false);
+      angularRows(axisB, 0.f, 7, &joint.motors[1], false);
+      break;
+    }
+    case JointType::Slider: {
+      rotationRows(0);
+      const auto axis = rotate(a.rotation, def.axisA);
+      const auto arm  = rA + d;
+      Vec3 perpendiculars[2];
+      computeBasis(axis, perpendiculars[0], perpendiculars[1]);
+      for (size_t k = 0; k < 2; ++k) {
+        const auto& p = perpendiculars[k];
+        setRow(3 + k, -p, -cross(arm, p), p, cross(rB, p), beta * dot(p, d), -Infinity, Infinity);
+      }
+      const auto& motor = joint.motors[0];
+      if (motor.enabled) {
+        const auto bound = motorBounds(motor);
+        setRow(6, -axis, -cross(arm, axis), axis, cross(rB, axis), -motor.speed, -bound, bound);
+      }
+      if (joint.limit.enabled) {
+        const auto translation = dot(axis, d);
+        setRow(8, -axis, -cross(arm, axis), axis, cross(rB, axis),
+               inequalityBias(translation - joint.limit.lower), 0.f, Infinity);
+        setRow(9, axis, cross(arm, axis), -axis, -cross(rB, axis),
+               inequalityBias(joint.limit.upper - translation), 0.f, Infinity);
+      }
+      break;
+    }
+    case JointType::Distance: {
+      const auto distance = length(d);
+      const auto n        = distance > 1e-6f ? d * (1.f / distance) : Vec3{0.f, 1.f, 0.f};
+      setRow(8, n, cross(rA, n), -n, -cross(rB, n), inequalityBias(def.maxDistance - distance),
+             0.f, Infinity);
+      if (def.minDistance > 0.f) {
+        setRow(9, -n, -cross(rA, n), n, cross(rB, n), inequalityBias(distance - def.minDistance),
+               0.f, Infinity);
+      }
+      break;
+    }
+    case JointType::Lock:
+      pointRows();
+      rotationRows(3);
+      break;
+  }
+
+  for (size_t i = 0; i < Joint::MaxRows; ++i) {
+    if (!used[i]) {
+      joint.rows[i].active  = false;
+      joint.rows[i].impulse = 0.f;
+    }
+  }
+}
+
+void PhysicsWorld::_solveJoint(Joint& joint)
+{
+  auto& a = _bodies[joint.definition.bodyA];
+  auto& b = _bodies[joint.definition.bodyB];
+  for (auto& row : joint.rows) {
+    if (!row.active) {
+      continue;
+    }
+    const auto jv = dot(row.linearA, a.linearVelocity) + dot(row.angularA, a.angularVelocity)
+                    + dot(row.linearB, b.linearVelocity) + dot(row.angularB, b.angularVelocity);
+    const auto previous = row.impulse;
+    row.impulse = std::clamp(previous - row.mass * (jv + row.bias), row.lower, row.upper);
+    applyRowImpulse(row, a, b, row.impulse - previous);
+  }
+}
+
+void PhysicsWorld::_prepareContact(Contact& contact, float timeStep)
+{
+  const auto& a = _bodies[contact.bodyA];
+  const auto& b = _bodies[contact.bodyB];
+  for (int i = 0; i < contact.pointCount; ++i) {
+    auto& point          = contact.points[i];
+    point.normalMass     = effectiveMass(a, b, point.rA, point.rB, contact.normal);
+    point.tangentMass[0] = effectiveMass(a, b, point.rA, point.rB, contact.tangents[0]);
+    point.tangentMass[1] = effectiveMass(a, b, point.rA, point.rB, contact.tangents[1]);
+
+    // Target normal velocity: approach up to the surface when separated, push out when
+    // penetrating, bounce on impacts
+    const auto vn
+      = dot(pointVelocity(b, point.rB) - pointVelocity(a, point.rA), contact.normal);
+    point.bias = point.depth < 0.f ? point.depth / timeStep :
+                                     Baumgarte / timeStep * std::max(point.depth - LinearSlop, 0.f);
+    if (vn < -RestitutionThreshold) {
+      point.bias = std::max(point.bias, -contact.restitution * vn);
+    }
+  }
+}
+
+void PhysicsWorld::_warmStart(Contact& contact)
+{
+  auto& a = _bodies[contact.bodyA];
+  auto& b = _bodies[contact.bodyB];
+  for (int i = 0; i < contact.pointCount; ++i) {
+    const auto& point   = contact.points[i];
+    const auto impulse = contact.normal * point.normalImpulse
+                         + contact.tangents[0] * point.tangentImpulse[0]
+                         + contact.tangents[1] * point.tangentImpulse[1];
+    applyImpulseAt(a, -impulse, point.rA);
+    applyImpulseAt(b, impulse, point.rB);
+  }
+}
+
+void PhysicsWorld::_solveContact(Contact& contact)
+{
+  auto& a = _bodies[contact.bodyA];
+  auto& b = _bodies[contact.bodyB];
+
+  // Friction first, the normal impulses being more important
+  for (int i = 0; i < contact.pointCount; ++i) {
+    auto& point           = contact.points[i];
+    const auto maxFriction = contact.friction * point.normalImpulse;
+    for (int t = 0; t < 2; ++t) {
+      const auto& tangent = contact.tangents[t];
+      const auto vt = dot(pointVelocity(b, point.rB) - pointVelocity(a, point.rA), tangent);
+      const auto previous     = point.tangentImpulse[t];
+      point.tangentImpulse[t] = std::clamp(previous - point.tangentMass[t] * vt, -maxFriction,
+                                           maxFriction);
+      const auto impulse      = tangent * (point.tangentImpulse[t] - previous);
+      applyImpulseAt(a, -impulse, point.rA);
+      applyImpulseAt(b, impulse, point.rB);
+    }
+  }
+
+  for (int i = 0; i < contact.pointCount; ++i) {
+    auto& point = contact.points[i];
+    const auto vn
+      = dot(pointVelocity(b, point.rB) - pointVelocity(a, point.rA), contact.normal);
+    const auto previous = point.normalImpulse;
+    point.normalImpulse = std::max(previous + point.normalMass * (point.bias - vn), 0.f);
+    const auto impulse  = contact.normal * (point.normalImpulse - previous);
+    applyImpulseAt(a, -impulse, point.rA);
+    applyImpulseAt(b, impulse, point.rB);
+  }
+}
+
+void PhysicsWorld::_integrateVelocity(Body& body, float timeStep) const
+{
+  body.invInertiaWorld = rotateDiagonal(toMatrix(body.rotation), body.invInertiaLocal);
+  body.linearVelocity += (_gravity + body.force * body.invMass) * timeStep;
+  body.angularVelocity += body.invInertiaWorld * body.torque * timeStep;
+  body.linearVelocity *= 1.f / (1.f + timeStep * body.linearDamping);
+  body.angularVelocity *= 1.f / (1.f + timeStep * body.angularDamping);
+  body.force  = {0.f, 0.f, 0.f};
+  body.torque = {0.f, 0.f, 0.f};
+}
+
+void PhysicsWorld::_integratePosition(Body& body, float timeStep) const
+{
+  const auto translation = body.linearVelocity * timeStep;
+  if (lengthSquared(translation) > MaxTranslation * MaxTranslation) {
+    body.linearVelocity *= MaxTranslation / length(translation);
+  }
+  body.position += body.linearVelocity * timeStep;
+  body.rotation  = integrate(body.rotation, body.angularVelocity, timeStep);
+  body.movedStep = _stepIndex;
+
+  if (lengthSquared(body.linearVelocity) > SleepLinearVelocity * SleepLinearVelocity
+      || lengthSquared(body.angularVelocity) > SleepAngularVelocity * SleepAngularVelocity) {
+    body.sleepTime = 0.f;
+  }
+  else {
+    body.sleepTime += timeStep;
+  }
+}
+
+void PhysicsWorld::_prepareConstraint(uint32_t constraint, float timeStep)
+{
+  if (constraint & JointBit) {
+    _prepareJoint(_joints[constraint & ~JointBit], timeStep);
+  }
+  else {
+    _prepareContact(_contacts[constraint], timeStep);
+  }
+}
+
+void PhysicsWorld::_warmStartConstraint(uint32_t constraint)
+{
+  if (constraint & JointBit) {
+    auto& joint = _joints[constraint & ~JointBit];
+    for (const auto& row : joint.rows) {
+      if (row.active) {
+        applyRowImpulse(row, _bodies[joint.definition.bodyA], _bodies[joint.definition.bodyB],
+                        row.impulse);
+      }
+    }
+  }
+  else {
+    _warmStart(_contacts[constraint]);
+  }
+}
+
+void PhysicsWorld::_solveConstraint(uint32_t constraint)
+{
+  if (constraint & JointBit) {
+    _solveJoint(_joints[constraint & ~JointBit]);
+  }
+  else {
+    _solveContact(_contacts[constraint]);
+  }
+}
+
+void PhysicsWorld::_solveIsland(Island& island, float timeStep)
+{
+  for (const auto id : island.bodies) {
+    _integrateVelocity(_bodies[id], timeStep);
+  }
+
+  for (const auto j : island.joints) {
+    _prepareJoint(_joints[j], timeStep);
+  }
+  for (const auto c : island.contacts) {
+    _prepareContact(_contacts[c], timeStep);
+  }
+
+  for (const auto j : island.joints) {
+    _warmStartConstraint(j | JointBit);
+  }
+  for (const auto c : island.contacts) {
+    _warmStart(_contacts[c]);
+  }
+
+  for (size_t iteration = 0; iteration < _iterations; ++iteration) {
+    for (const auto j : island.joints) {
+      _solveJoint(_joints[j]);
+    }
+    for (const auto c : island.contacts) {
+      _solveContact(_contacts[c]);
+    }
+  }
+
+  // Integrate the positions and put the island to sleep once it rested long enough
+  auto minSleepTime = Infinity;
+  for (const auto id : island.bodies) {
+    auto& body = _bodies[id];
+    _integratePosition(body, timeStep);
+    minSleepTime = std::min(minSleepTime, body.sleepTime);
+  }
+  if (minSleepTime >= TimeToSleep) {
+    for (const auto id : island.bodies) {
+      sleep(id);
+    }
+  }
+}
+
+void PhysicsWorld::_colorIsland(Island& island)
+{
+  // Greedy coloring, in the order of the constraints of the island: each constraint goes to the
+  // first batch none of its dynamic bodies is used in. Static bodies are only read.
+  constexpr uint32_t OverflowBatch   = BatchCount - 1;
+  constexpr uint64_t ParallelBatches = (uint64_t(1) << OverflowBatch) - 1;
+  _bodyBatches.resize(_bodies.size());
+  for (const auto id : island.bodies) {
+    _bodyBatches[id] = 0;
+  }
+
+  std::array<uint32_t, BatchCount> counts{};
+  std::vector<std::pair<uint32_t, uint32_t>> batches;
+  batches.reserve(island.joints.size() + island.contacts.size());
+  const auto addConstraint = [&](uint32_t constraint, BodyId a, BodyId b) {
+    const auto dynamicA = _bodies[a].isDynamic();
+    const auto dynamicB = _bodies[b].isDynamic();
+    const auto used     = (dynamicA ? _bodyBatches[a] : 0) | (dynamicB ? _bodyBatches[b] : 0);
+    const auto free     = ~used & ParallelBatches;
+    uint32_t batch      = OverflowBatch;
+    if (free != 0) {
+      batch = 0;
+      while (!(free & (uint64_t(1) << batch))) {
+        ++batch;
+      }
+      if (dynamicA) {
+        _bodyBatches[a] |= uint64_t(1) << batch;
+      }
+      if (dynamicB) {
+        _bodyBatches[b] |= uint64_t(1) << batch;
+      }
+    }
+    ++counts[batch];
+    batches.emplace_back(batch, constraint);
+  };
+  for (const auto j : island.joints) {
+    const auto& definition = _joints[j].definition;
+    addConstraint(j | JointBit, definition.bodyA, definition.bodyB);
+  }
+  for (const auto c : island.contacts) {
+    addConstraint(c, _contacts[c].bodyA, _contacts[c].bodyB);
+  }
+
+  // Counting sort by batch, stable so that the order within a batch stays the island order
+  island.batchOffsets.assign(BatchCount + 1, 0);
+  for (uint32_t b = 0; b < BatchCount; ++b) {
+    island.batchOffsets[b + 1] = island.batchOffsets[b] + counts[b];
+  }
+  island.batchConstraints.resize(batches.size());
+  auto offsets = island.batchOffsets;
+  for (const auto& [batch, constraint] : batches) {
+    island.batchConstraints[offsets[batch]++] = constraint;
+  }
+}
+
+void PhysicsWorld::_solveLargeIsland(Island& island, float timeStep, ThreadPool& threadPool)
+{
+  const auto& constraints = island.batchConstraints;
+
+  // Runs func on each constraint, the batches one after the other. The constraints of a batch
+  // share no dynamic body, except in the last batch which is run sequentially.
+  const auto forEachBatch = [&](const auto& func) {
+    for (uint32_t b = 0; b < BatchCount; ++b) {
+      const auto offset = island.batchOffsets[b];
+      const auto count  = island.batchOffsets[b + 1] - offset;
+      if (b + 1 == BatchCount || count <= ConstraintGrain) {
+        for (uint32_t i = offset; i < offset + count; ++i) {
+          func(constraints[i]);
+        }
+        continue;
+      }
+      threadPool.parallelFor(count, ConstraintGrain,
+                             [&](size_t begin, size_t end, size_t /*workerIndex*/) {
+                               for (size_t i = begin; i < end; ++i) {
+                                 func(constraints[offset + i]);
+                               }
+                             });
+    }
+  };
+
+  threadPool.parallelFor(island.bodies.size(), BodyGrain,
+                         [&](size_t begin, size_t end, size_t /*workerIndex*/) {
+                           for (size_t i = begin; i < end; ++i) {
+                             _integrateVelocity(_bodies[island.bodies[i]], timeStep);
+                           }
+                         });
+
+  // The preparation only writes the constraints
+  threadPool.parallelFor(constraints.size(), ConstraintGrain,
+                         [&](size_t begin, size_t end, size_t /*workerIndex*/) {
+                           for (size_t i = begin; i < end; ++i) {
+                             _prepareConstraint(constraints[i], timeStep);
+                           }
+                         });
+
+  forEachBatch([this](uint32_t constraint) { _warmStartConstraint(constraint); });
+  for (size_t iteration = 0; iteration < _iterations; ++iteration) {
+    forEachBatch([this](uint32_t constraint) { _solveConstraint(constraint); });
+  }
+
+  threadPool.parallelFor(island.bodies.size(), BodyGrain,
+                         [&](size_t begin, size_t end, size_t /*workerIndex*/) {
+                           for (size_t i = begin; i < end; ++i) {
+                             _integratePosition(_bodies[island.bodies[i]], timeStep);
+                           }
+                         });
+
+  auto minSleepTime = Infinity;
+  for (const auto id : island.bodies) {
+    minSleepTime = std::min(minSleepTime, _bodies[id].sleepTime);
+  }
+  if (minSleepTime >= TimeToSleep) {
+    for (const auto id : island.bodies) {
+      sleep(id);
+    }
+  }
+}
+
+void PhysicsWorld::step(float timeStep)
+{
+  if (timeStep <= 0.f) {
+    return;
+  }
+
+  auto& threadPool = (_threadPool != nullptr ? *_threadPool : ThreadPool::Default());
+  ++_stepIndex;
+
+  _findNewContacts();
+  _updateContacts(threadPool);
+  _buildIslands();
+
+  // The split only depends on the islands, not on the number of threads
+  _largeIslands.clear();
+  _smallIslands.clear();
+  for (uint32_t i = 0; i < _islands.size(); ++i) {
+    const auto& island = _islands[i];
+    if (island.contacts.size() + island.joints.size() >= LargeIslandConstraints) {
+      _largeIslands.emplace_back(i);
+    }
+    else {
+      _smallIslands.emplace_back(i);
+    }
+  }
+
+  // Islands share no dynamic body, each one is solved by a single worker
+  threadPool.parallelFor(_smallIslands.size(), IslandGrain,
+                         [&](size_t begin, size_t end, size_t /*workerIndex*/) {
+                           for (size_t i = begin; i < end; ++i) {
+                             _solveIsland(_islands[_smallIslands[i]], timeStep);
+                           }
+                         });
+  for (const auto i : _largeIslands) {
+    _colorIsland(_islands[i]);
+    _solveLargeIsland(_islands[i], timeStep, threadPool);
+  }
+
+  for (const auto& island : _islands) {
+    for (const auto id : island.bodies) {
+      _synchronizeProxy(id);
+    }
+  }
+}
+
+} // end of namespace NativePhysics
+} // end of namespace BABYLON
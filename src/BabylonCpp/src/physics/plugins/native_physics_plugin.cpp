@@ -0,0 +1,723 @@
+#include <babylon/physics/plugins/native_physics_plugin.h>
+
+#include <babylon/core/logging.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/physics/joint/distance_joint.h>
+#include <babylon/physics/joint/imotor_enabled_joint.h>
+#include <babylon/physics/joint/physics_joint.h>
+#include <babylon/physics/physics_impostor.h>
+#include <babylon/physics/physics_impostor_joint.h>
+#include <babylon/physics/physics_raycast_result.h>
+
+namespace BABYLON {
+
+using namespace NativePhysics;
+
+namespace {
+
+Vec3 toVec3(const Vector3& v)
+{
+  return {v.x, v.y, v.z};
+}
+
+Quat toQuat(const Quaternion& q)
+{
+  return {q.x, q.y, q.z, q.w};
+}
+
+Vector3 toVector3(const Vec3& v)
+{
+  return Vector3(v.x, v.y, v.z);
+}
+
+} // end of anonymous namespace
+
+NativePhysicsBody::NativePhysicsBody(PhysicsWorld* iWorld, BodyId iId) : world{iWorld}, id{iId}
+{
+}
+
+NativePhysicsBody::~NativePhysicsBody() = default;
+
+void NativePhysicsBody::setPosition(const Vector3& newPosition)
+{
+  world->setTransform(id, toVec3(newPosition), world->body(id).rotation);
+}
+
+void NativePhysicsBody::setOrientation(const Quaternion& newRotation)
+{
+  world->setTransform(id, world->body(id).position, toQuat(newRotation));
+}
+
+void NativePhysicsBody::setShapesDensity(float /*density*/)
+{
+  // The bodies have a single shape, their mass is set directly
+}
+
+void NativePhysicsBody::setupMass(int iMass)
+{
+  world->setMass(id, static_cast<float>(iMass));
+}
+
+float NativePhysicsBody::mass()
+{
+  return world->body(id).mass;
+}
+
+void NativePhysicsBody::applyImpulse(const Vector3& position, const Vector3& force)
+{
+  world->applyImpulse(id, toVec3(force), toVec3(position));
+}
+
+Vector3 NativePhysicsBody::angularVelocity()
+{
+  return toVector3(world->body(id).angularVelocity);
+}
+
+void NativePhysicsBody::setAngularVelocity(const Vector3& velocity)
+{
+  world->setAngularVelocity(id, toVec3(velocity));
+}
+
+Vector3 NativePhysicsBody::linearVelocity()
+{
+  return toVector3(world->body(id).linearVelocity);
+}
+
+void NativePhysicsBody::setLinearVelocity(const Vector3& velocity)
+{
+  world->setLinearVelocity(id, toVec3(velocity));
+}
+
+void NativePhysicsBody::sleep()
+{
+  world->sleep(id);
+}
+
+bool NativePhysicsBody::sleeping()
+{
+  return world->body(id).sleeping;
+}
+
+void NativePhysicsBody::awake()
+{
+  world->wakeUp(id);
+}
+
+void NativePhysicsBody::syncShapes()
+{
+}
+
+NativePhysicsPlugin::NativePhysicsPlugin(bool useDeltaForWorldStep, size_t iterations)
+    : _useDeltaForWorldStep{useDeltaForWorldStep}
+    , _fixedTimeStep{1.f / 60.f}
+    , _accumulator{0.f}
+    , _world{std::make_unique<PhysicsWorld>()}
+    , _threadPool{nullptr}
+{
+  world = nullptr;
+  name  = "NativePhysicsPlugin";
+  _world->setIterations(iterations);
+}
+
+NativePhysicsPlugin::~NativePhysicsPlugin() = default;
+
+BodyId NativePhysicsPlugin::getBodyId(const PhysicsImpostor& impostor) const
+{
+  const auto it = _bodies.find(&impostor);
+  return it == _bodies.end() ? InvalidId : it->second->id;
+}
+
+JointId NativePhysicsPlugin::_getJointId(const PhysicsJoint* joint) const
+{
+  const auto it = _joints.find(joint);
+  return it == _joints.end() ? InvalidId : it->second;
+}
+
+void NativePhysicsPlugin::setGravity(const Vector3& gravity)
+{
+  _world->setGravity(toVec3(gravity));
+}
+
+void NativePhysicsPlugin::setTimeStep(float timeStep)
+{
+  _fixedTimeStep = timeStep;
+}
+
+float NativePhysicsPlugin::getTimeStep() const
+{
+  return _fixedTimeStep;
+}
+
+void NativePhysicsPlugin::_syncBodiesBeforeStep(
+  const std::vector<PhysicsImpostorPtr>& impostors)
+{
+  _bulkImpostors.clear();
+  _bulkBodies.clear();
+  _stepImpostors.clear();
+  _movedBodies.clear();
+  _movedPositions.clear();
+  _movedRotations.clear();
+  for (const auto& impostor : impostors) {
+    auto body = static_cast<NativePhysicsBody*>(impostor->physicsBody());
+    if (!body || !impostor->_canSyncTransformationInBulk()) {
+      _stepImpostors.emplace_back(impostor.get());
+      continue;
+    }
+    _bulkImpostors.emplace_back(impostor.get());
+    _bulkBodies.emplace_back(body->id);
+
+    // Only the objects moved since the last exchange are pushed
+    const auto& object   = *impostor->object;
+    const auto position  = toVec3(object.position());
+    const auto rotation  = toQuat(*object.rotationQuaternion());
+    auto& syncedPosition = _syncedPositions[body->id];
+    auto& syncedRotation = _syncedRotations[body->id];
+    if (position.x != syncedPosition.x || position.y != syncedPosition.y
+        || position.z != syncedPosition.z || rotation.x != syncedRotation.x
+        || rotation.y != syncedRotation.y || rotation.z != syncedRotation.z
+        || rotation.w != syncedRotation.w) {
+      syncedPosition = position;
+      syncedRotation = rotation;
+      _movedBodies.emplace_back(body->id);
+      _movedPositions.emplace_back(position);
+      _movedRotations.emplace_back(rotation);
+    }
+  }
+  _world->setTransforms(_movedBodies.size(), _movedBodies.data(), _movedPositions.data(),
+                        _movedRotations.data());
+
+  for (auto impostor : _stepImpostors) {
+    impostor->beforeStep();
+  }
+}
+
+void NativePhysicsPlugin::_syncObjectsAfterStep(uint32_t startStep)
+{
+  // Sleeping and static bodies are skipped by the world, the bodies moved by any of the sub-steps
+  // of the frame are read back
+  const auto count = _bulkBodies.size();
+  _movedIndices.resize(count);
+  _movedPositions.resize(count);
+  _movedRotations.resize(count);
+  const auto movedCount
+    = _world->getMovedTransforms(startStep, count, _bulkBodies.data(), _movedIndices.data(),
+                                 _movedPositions.data(), _movedRotations.data());
+  for (size_t i = 0; i < movedCount; ++i) {
+    const auto index     = _movedIndices[i];
+    const auto id        = _bulkBodies[index];
+    const auto& position = _movedPositions[i];
+    const auto& rotation = _movedRotations[i];
+    auto& object         = *_bulkImpostors[index]->object;
+    object.position().set(position.x, position.y, position.z);
+    object.rotationQuaternion()->set(rotation.x, rotation.y, rotation.z, rotation.w);
+    _syncedPositions[id] = position;
+    _syncedRotations[id] = rotation;
+  }
+
+  for (auto impostor : _stepImpostors) {
+    impostor->afterStep();
+  }
+}
+
+void NativePhysicsPlugin::executeStep(float delta,
+                                      const std::vector<PhysicsImpostorPtr>& impostors)
+{
+  _syncBodiesBeforeStep(impostors);
+  const auto startStep = _world->stepIndex();
+
+  if (_useDeltaForWorldStep) {
+    // Fixed steps consuming the frame delta, the remainder carried over to the next frame
+    _accumulator += delta;
+    unsigned int subSteps = 0;
+    while (_accumulator + 1e-6f >= _fixedTimeStep && subSteps < MaxSubSteps) {
+      _world->step(_fixedTimeStep);
+      _accumulator -= _fixedTimeStep;
+      ++subSteps;
+    }
+    _accumulator = std::clamp(_accumulator, 0.f, _fixedTimeStep);
+  }
+  else {
+    _world->step(_fixedTimeStep);
+  }
+
+  _syncObjectsAfterStep(startStep);
+}
+
+void NativePhysicsPlugin::applyImpulse(const PhysicsImpostor& impostor, const Vector3& force,
+                                       const Vector3& contactPoint)
+{
+  const auto id = getBodyId(impostor);
+  if (id != InvalidId) {
+    _world->applyImpulse(id, toVec3(force), toVec3(contactPoint));
+  }
+}
+
+void NativePhysicsPlugin::applyForce(const PhysicsImpostor& impostor, const Vector3& force,
+                                     const Vector3& contactPoint)
+{
+  const auto id = getBodyId(impostor);
+  if (id != InvalidId) {
+    _world->applyForce(id, toVec3(force), toVec3(contactPoint));
+  }
+}
+
+CollisionShape NativePhysicsPlugin::_createShape(PhysicsImpostor& impostor) const
+{
+  const auto size = impostor.getObjectExtendSize();
+  switch (impostor.physicsImposterType) {
+    case PhysicsImpostor::SphereImpostor:
+      return CollisionShape::CreateSphere(std::max({size.x, size.y, size.z}) * 0.5f);
+    case PhysicsImpostor::CapsuleImpostor: {
+      const auto radius = size.x * 0.5f;
+      return CollisionShape::CreateCapsule(radius, std::max(size.y * 0.5f - radius, 0.f));
+    }
+    case PhysicsImpostor::CylinderImpostor:
+      return CollisionShape::CreateCylinder(size.x * 0.5f, size.y * 0.5f);
+    case PhysicsImpostor::ParticleImpostor:
+      return CollisionShape::CreateSphere(0.01f);
+    case PhysicsImpostor::MeshImpostor:
+    case PhysicsImpostor::ConvexHullImpostor: {
+      auto* object         = impostor.object;
+      const auto positions = object->getVerticesData(VertexBuffer::PositionKind);
+      if (positions.size() < 12) {
+        break;
+      }
+      object->computeWorldMatrix(true);
+      const auto& scaling = object->absoluteScaling();
+      std::vector<Vec3> points;
+      points.reserve(positions.size() / 3);
+      for (size_t i = 0; i + 2 < positions.size(); i += 3) {
+        points.push_back({positions[i] * scaling.x, positions[i + 1] * scaling.y,
+                          positions[i + 2] * scaling.z});
+      }
+      return CollisionShape::CreateConvexHull(points);
+    }
+    default:
+      break;
+  }
+  // Boxes, planes and heightmaps
+  return CollisionShape::CreateBox(toVec3(size) * 0.5f);
+}
+
+void NativePhysicsPlugin::generatePhysicsBody(PhysicsImpostor& impostor)
+{
+  if (impostor.parent()) {
+    BABYLON_LOG_WARN("NativePhysicsPlugin",
+                     "Compound impostors are not supported, the child impostor is ignored")
+    return;
+  }
+  if (impostor.soft) {
+    BABYLON_LOG_WARN("NativePhysicsPlugin", "Soft bodies are not supported")
+    return;
+  }
+
+  // The body is regenerated when the impostor requires an update
+  removePhysicsBody(impostor);
+
+  auto* object = impostor.object;
+  // World rotation of the object
+  auto rotation = object->rotationQuaternion() ? *object->rotationQuaternion() : Quaternion();
+  if (object->parent()) {
+    rotation = impostor.getParentsRotation().multiply(rotation);
+  }
+  BodyDefinition definition;
+  definition.shape       = _createShape(impostor);
+  definition.position    = toVec3(object->getAbsolutePosition());
+  definition.rotation    = toQuat(rotation);
+  definition.mass        = impostor.getParam("mass");
+  definition.friction    = impostor.getParam("friction");
+  definition.restitution = impostor.getParam("restitution");
+  definition.userData    = &impostor;
+
+  auto body
+    = std::make_unique<NativePhysicsBody>(_world.get(), _world->createBody(definition));
+  if (_syncedPositions.size() <= body->id) {
+    _syncedPositions.resize(body->id + 1);
+    _syncedRotations.resize(body->id + 1);
+  }
+  _syncedPositions[body->id] = toVec3(object->position());
+  _syncedRotations[body->id] = toQuat(rotation);
+  impostor.physicsBody = body.get();
+  _bodies[&impostor]   = std::move(body);
+}
+
+void NativePhysicsPlugin::removePhysicsBody(const PhysicsImpostor& impostor)
+{
+  const auto it = _bodies.find(&impostor);
+  if (it == _bodies.end()) {
+    return;
+  }
+  // The world destroys the joints of the body
+  const auto id = it->second->id;
+  for (auto joint = _joints.begin(); joint != _joints.end();) {
+    const auto& definition = _world->joint(joint->second).definition;
+    if (definition.bodyA == id || definition.bodyB == id) {
+      joint = _joints.erase(joint);
+    }
+    else {
+      ++joint;
+    }
+  }
+  _world->destroyBody(id);
+  _bodies.erase(it);
+}
+
+void NativePhysicsPlugin::generateJoint(PhysicsImpostorJoint* impostorJoint)
+{
+  const auto mainBody      = getBodyId(*impostorJoint->mainImpostor);
+  const auto connectedBody = getBodyId(*impostorJoint->connectedImpostor);
+  if (mainBody == InvalidId || connectedBody == InvalidId) {
+    return;
+  }
+
+  const auto& joint = impostorJoint->joint;
+  const auto& data  = joint->jointData;
+  JointDefinition definition;
+  definition.bodyA            = mainBody;
+  definition.bodyB            = connectedBody;
+  definition.pivotA           = toVec3(data.mainPivot.value_or(Vector3::Zero()));
+  definition.pivotB           = toVec3(data.connectedPivot.value_or(Vector3::Zero()));
+  definition.axisA            = toVec3(data.mainAxis.value_or(Vector3(1.f, 0.f, 0.f)));
+  definition.axisB            = toVec3(data.connectedAxis.value_or(toVector3(definition.axisA)));
+  definition.collideConnected = data.collision.value_or(false);
+
+  switch (joint->jointType) {
+    case PhysicsJoint::DistanceJoint: {
+      definition.type = JointType::Distance;
+      if (const auto* distanceJoint = dynamic_cast<const DistanceJoint*>(joint.get())) {
+        definition.maxDistance = distanceJoint->maxDistance;
+      }
+    } break;
+    case PhysicsJoint::SpringJoint:
+      // The spring parameters are not kept by the joint: the rest length is held instead
+      definition.type = JointType::Distance;
+      break;
+    case PhysicsJoint::HingeJoint:
+      definition.type = JointType::Hinge;
+      break;
+    case PhysicsJoint::BallAndSocketJoint:
+    case PhysicsJoint::PointToPointJoint:
+      definition.type = JointType::Ball;
+      break;
+    case PhysicsJoint::Hinge2Joint:
+    case PhysicsJoint::UniversalJoint:
+      definition.type = JointType::Universal;
+      break;
+    case PhysicsJoint::SliderJoint:
+    case PhysicsJoint::PrismaticJoint:
+      definition.type = JointType::Slider;
+      break;
+    case PhysicsJoint::LockJoint:
+      definition.type = JointType::Lock;
+      break;
+    default:
+      BABYLON_LOGF_WARN("NativePhysicsPlugin", "Unsupported joint type %u", joint->jointType)
+      return;
+  }
+
+  _joints[joint.get()] = _world->createJoint(definition);
+}
+
+void NativePhysicsPlugin::removeJoint(PhysicsImpostorJoint* impostorJoint)
+{
+  const auto it = _joints.find(impostorJoint->joint.get());
+  if (it != _joints.end()) {
+    _world->destroyJoint(it->second);
+    _joints.erase(it);
+  }
+}
+
+bool NativePhysicsPlugin::isSupported()
+{
+  return true;
+}
+
+void NativePhysicsPlugin::setTransformationFromPhysicsBody(const PhysicsImpostor& impostor)
+{
+  const auto id = getBodyId(impostor);
+  if (id == InvalidId) {
+    return;
+  }
+  const auto& body                   = _world->body(id);
+  impostor.object->position          = toVector3(body.position);
+  impostor.object->rotationQuaternion
+    = Quaternion(body.rotation.x, body.rotation.y, body.rotation.z, body.rotation.w);
+}
+
+void NativePhysicsPlugin::setPhysicsBodyTransformation(const PhysicsImpostor& impostor,
+                                                       const Vector3& newPosition,
+                                                       const Quaternion& newRotation)
+{
+  const auto id = getBodyId(impostor);
+  if (id != InvalidId) {
+    _world->setTransform(id, toVec3(newPosition), toQuat(newRotation));
+  }
+}
+
+void NativePhysicsPlugin::setLinearVelocity(const PhysicsImpostor& impostor,
+                                            const std::optional<Vector3>& velocity)
+{
+  const auto id = getBodyId(impostor);
+  if (id != InvalidId) {
+    _world->setLinearVelocity(id, velocity ? toVec3(*velocity) : Vec3{0.f, 0.f, 0.f});
+  }
+}
+
+void NativePhysicsPlugin::setAngularVelocity(const PhysicsImpostor& impostor,
+                                             const std::optional<Vector3>& velocity)
+{
+  const auto id = getBodyId(impostor);
+  if (id != InvalidId) {
+    _world->setAngularVelocity(id, velocity ? toVec3(*velocity) : Vec3{0.f, 0.f, 0.f});
+  }
+}
+
+Vector3 NativePhysicsPlugin::getLinearVelocity(const PhysicsImpostor& impostor)
+{
+  const auto id = getBodyId(impostor);
+  return id != InvalidId ? toVector3(_world->body(id).linearVelocity) : Vector3::Zero();
+}
+
+Vector3 NativePhysicsPlugin::getAngularVelocity(const PhysicsImpostor& impostor)
+{
+  const auto id = getBodyId(impostor);
+  return id != InvalidId ? toVector3(_world->body(id).angularVelocity) : Vector3::Zero();
+}
+
+void NativePhysicsPlugin::setBodyMass(const PhysicsImpostor& impostor, float mass)
+{
+  const auto id = getBodyId(impostor);
+  if (id != InvalidId) {
+    _world->setMass(id, mass);
+  }
+}
+
+float NativePhysicsPlugin::getBodyMass(const PhysicsImpostor& impostor)
+{
+  const auto id = getBodyId(impostor);
+  return id != InvalidId ? _world->body(id).mass : 0.f;
+}
+
+float NativePhysicsPlugin::getBodyFriction(const PhysicsImpostor& impostor)
+{
+  const auto id = getBodyId(impostor);
+  return id != InvalidId ? _world->body(id).friction : 0.f;
+}
+
+void NativePhysicsPlugin::setBodyFriction(const PhysicsImpostor& impostor, float friction)
+{
+  const auto id = getBodyId(impostor);
+  if (id != InvalidId) {
+    _world->body(id).friction = friction;
+  }
+}
+
+float NativePhysicsPlugin::getBodyRestitution(const PhysicsImpostor& impostor)
+{
+  const auto id = getBodyId(impostor);
+  return id != InvalidId ? _world->body(id).restitution : 0.f;
+}
+
+void NativePhysicsPlugin::setBodyRestitution(const PhysicsImpostor& impostor, float restitution)
+{
+  const auto id = getBodyId(impostor);
+  if (id != InvalidId) {
+    _world->body(id).restitution = restitution;
+  }
+}
+
+float NativePhysicsPlugin::getBodyPressure(const PhysicsImpostor& /*impostor*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Pressure is not supported by the native plugin")
+  return 0.f;
+}
+
+void NativePhysicsPlugin::setBodyPressure(const PhysicsImpostor& /*impostor*/, float /*pressure*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Pressure is not supported by the native plugin")
+}
+
+float NativePhysicsPlugin::getBodyStiffness(const PhysicsImpostor& /*impostor*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Stiffness is not supported by the native plugin")
+  return 0.f;
+}
+
+void NativePhysicsPlugin::setBodyStiffness(const PhysicsImpostor& /*impostor*/,
+                                           float /*stiffness*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Stiffness is not supported by the native plugin")
+}
+
+size_t NativePhysicsPlugin::getBodyVelocityIterations(const PhysicsImpostor& /*impostor*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin",
+                   "Velocity iterations are not supported by the native plugin")
+  return 0;
+}
+
+void NativePhysicsPlugin::setBodyVelocityIterations(const PhysicsImpostor& /*impostor*/,
+                                                    size_t /*velocityIterations*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin",
+                   "Velocity iterations are not supported by the native plugin")
+}
+
+size_t NativePhysicsPlugin::getBodyPositionIterations(const PhysicsImpostor& /*impostor*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin",
+                   "Position iterations are not supported by the native plugin")
+  return 0;
+}
+
+void NativePhysicsPlugin::setBodyPositionIterations(const PhysicsImpostor& /*impostor*/,
+                                                    size_t /*positionIterations*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin",
+                   "Position iterations are not supported by the native plugin")
+}
+
+void NativePhysicsPlugin::appendAnchor(const PhysicsImpostor& /*impostor*/,
+                                       const PhysicsImpostorPtr& /*otherImpostor*/,
+                                       int /*width*/, int /*height*/, float /*influence*/,
+                                       bool /*noCollisionBetweenLinkedBodies*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Anchors are not supported by the native plugin")
+}
+
+void NativePhysicsPlugin::appendHook(const PhysicsImpostor& /*impostor*/,
+                                     const PhysicsImpostorPtr& /*otherImpostor*/,
+                                     float /*length*/, float /*influence*/,
+                                     bool /*noCollisionBetweenLinkedBodies*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Hooks are not supported by the native plugin")
+}
+
+void NativePhysicsPlugin::sleepBody(const PhysicsImpostor& impostor)
+{
+  const auto id = getBodyId(impostor);
+  if (id != InvalidId) {
+    _world->sleep(id);
+  }
+}
+
+void NativePhysicsPlugin::wakeUpBody(const PhysicsImpostor& impostor)
+{
+  const auto id = getBodyId(impostor);
+  if (id != InvalidId) {
+    _world->wakeUp(id);
+  }
+}
+
+PhysicsRaycastResult NativePhysicsPlugin::raycast(const Vector3& from, const Vector3& to)
+{
+  PhysicsRaycastResult result;
+  result.reset(from, to);
+  const auto hit = _world->raycast(toVec3(from), toVec3(to));
+  if (hit.hit) {
+    result.setHitData({hit.normal.x, hit.normal.y, hit.normal.z},
+                      {hit.point.x, hit.point.y, hit.point.z});
+    result.calculateHitDistance();
+  }
+  return result;
+}
+
+void NativePhysicsPlugin::updateDistanceJoint(DistanceJoint* joint, float maxDistance,
+                                              float minDistance)
+{
+  const auto id = _getJointId(joint);
+  if (id != InvalidId) {
+    _world->setDistance(id, minDistance, maxDistance);
+  }
+}
+
+void NativePhysicsPlugin::setMotor(IMotorEnabledJoint* joint, float speed, float maxForce,
+                                   unsigned int motorIndex)
+{
+  const auto id = _getJointId(dynamic_cast<PhysicsJoint*>(joint));
+  if (id != InvalidId) {
+    _world->setMotor(id, motorIndex, speed, maxForce);
+  }
+}
+
+void NativePhysicsPlugin::setLimit(IMotorEnabledJoint* joint, float upperLimit, float lowerLimit,
+                                   unsigned int /*motorIndex*/)
+{
+  const auto id = _getJointId(dynamic_cast<PhysicsJoint*>(joint));
+  if (id != InvalidId) {
+    _world->setLimit(id, lowerLimit, upperLimit);
+  }
+}
+
+float NativePhysicsPlugin::getRadius(const PhysicsImpostor& impostor)
+{
+  const auto id = getBodyId(impostor);
+  if (id == InvalidId) {
+    return 0.f;
+  }
+  const auto& shape = _world->body(id).shape;
+  return shape.type == ShapeType::ConvexHull ? shape.boundingRadius() : shape.radius;
+}
+
+void NativePhysicsPlugin::getBoxSizeToRef(const PhysicsImpostor& impostor, Vector3& result)
+{
+  const auto id = getBodyId(impostor);
+  if (id == InvalidId) {
+    result.setAll(0.f);
+    return;
+  }
+  const auto& halfExtents = _world->body(id).shape.halfExtents;
+  result.set(halfExtents.x * 2.f, halfExtents.y * 2.f, halfExtents.z * 2.f);
+}
+
+void NativePhysicsPlugin::syncMeshWithImpostor(AbstractMesh* mesh,
+                                               const PhysicsImpostor& impostor)
+{
+  const auto id = getBodyId(impostor);
+  if (id == InvalidId) {
+    return;
+  }
+  const auto& body = _world->body(id);
+  mesh->position().set(body.position.x, body.position.y, body.position.z);
+  if (mesh->rotationQuaternion()) {
+    mesh->rotationQuaternion()->set(body.rotation.x, body.rotation.y, body.rotation.z,
+                                    body.rotation.w);
+  }
+}
+
+void NativePhysicsPlugin::dispose()
+{
+  const auto gravity    = _world->gravity();
+  const auto iterations = _world->iterations();
+  _bodies.clear();
+  _joints.clear();
+  _syncedPositions.clear();
+  _syncedRotations.clear();
+  _world = std::make_unique<PhysicsWorld>();
+  _world->setGravity(gravity);
+  _world->setIterations(iterations);
+  _world->setThreadPool(_threadPool);
+  _accumulator = 0.f;
+}
+
+bool NativePhysicsPlugin::queryBroadphase(const Vector3& minimum, const Vector3& maximum,
+                                          std::vector<PhysicsImpostor*>& impostors)
+{
+  _world->queryAABB({toVec3(minimum), toVec3(maximum)}, _queriedBodies);
+  impostors.clear();
+  for (const auto id : _queriedBodies) {
+    if (auto impostor = static_cast<PhysicsImpostor*>(_world->body(id).userData)) {
+      impostors.emplace_back(impostor);
+    }
+  }
+  return true;
+}
+
+void NativePhysicsPlugin::setThreadPool(ThreadPool* threadPool)
+{
+  _threadPool = threadPool;
+  _world->setThreadPool(threadPool);
+}
+
+} // end of namespace BABYLON
@@ -2,6 +2,7 @@
 
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
+#include <babylon/core/frame_arena.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/bounding_sphere.h>
 #include <babylon/engines/constants.h>
@@ -190,6 +191,10 @@ void RenderingGroup::renderSorted(
   const std::function<bool(const SubMesh* a, const SubMesh* b)>& sortCompareFn,
   const CameraPtr& camera, bool transparent)
 {
+  if (subMeshes.empty()) {
+    return;
+  }
+
   auto cameraPosition = camera ? camera->globalPosition() : RenderingGroup::_zeroVector;
   for (auto& subMesh : subMeshes) {
     subMesh->_alphaIndex = subMesh->getMesh()->alphaIndex;
@@ -197,14 +202,33 @@ void RenderingGroup::renderSorted(
       = Vector3::Distance(subMesh->getBoundingInfo()->boundingSphere.centerWorld, cameraPosition);
   }
 
-  auto sortedArray = subMeshes;
+  // The sorted copy lives in the frame arena. Ties are broken using the submission order, which
+  // gives the result of a stable sort without the temporary buffer allocated by std::stable_sort.
+  auto& frameArena = subMeshes.front()->getMesh()->getScene()->getEngine()->frameArena();
+  FrameArena::Scope frameScope{frameArena};
+  using SortEntry = std::pair<SubMesh*, size_t>;
+  FrameVector<SortEntry> sortedArray{FrameAllocator<SortEntry>{frameArena}};
+  sortedArray.reserve(subMeshes.size());
+  for (size_t i = 0; i < subMeshes.size(); ++i) {
+    sortedArray.emplace_back(subMeshes[i], i);
+  }
 
   // sort using a custom function object
   if (sortCompareFn) {
-    std::stable_sort(sortedArray.begin(), sortedArray.end(), sortCompareFn);
-  }
-
-  for (auto& subMesh : sortedArray) {
+    std::sort(sortedArray.begin(), sortedArray.end(),
+              [&sortCompareFn](const SortEntry& a, const SortEntry& b) {
+                if (sortCompareFn(a.first, b.first)) {
+                  return true;
+                }
+                if (sortCompareFn(b.first, a.first)) {
+                  return false;
+                }
+                return a.second < b.second;
+              });
+  }
+
+  for (const auto& sortEntry : sortedArray) {
+    auto subMesh = sortEntry.first;
     if (transparent) {
       auto material = subMesh->getMaterial();
 
@@ -0,0 +1,97 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include "../test_utils.h"
+
+#include <babylon/audio/analyser.h>
+#include <babylon/audio/audio_buffer.h>
+#include <babylon/audio/audio_engine.h>
+#include <babylon/audio/sound.h>
+#include <babylon/babylon_constants.h>
+#include <babylon/engines/scene.h>
+
+namespace {
+
+// Waits for the worker of the analyser to analyse the frames rendered so far
+bool waitForAnalysis(BABYLON::Analyser& analyser, uint64_t frameCount)
+{
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (std::chrono::steady_clock::now() < timeout) {
+    analyser.getByteFrequencyData();
+    if (analyser._getAnalysedFrameCount() >= frameCount) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return false;
+}
+
+} // end of anonymous namespace
+
+TEST(TestAnalyser, FrequencyData_PeaksAtTheFrequencyOfTheSound)
+{
+  using namespace BABYLON;
+  Engine::audioEngine = AudioEngine::New(48000u);
+  auto& audioEngine   = Engine::audioEngine;
+  auto engine         = createSubject();
+  auto scene          = Scene::New(engine.get());
+  auto analyser       = Analyser::New(scene.get());
+  audioEngine->connectToAnalyser(analyser);
+
+  // Nothing was analysed yet
+  EXPECT_EQ(analyser->getFrequencyBinCount(), 256u);
+  EXPECT_EQ(analyser->getByteFrequencyData(), Uint8Array(256, 0));
+  EXPECT_EQ(analyser->getByteTimeDomainData(), Uint8Array(512, 128));
+
+  // A sine at the center of the bin 32 of the FFT of 512 samples
+  auto buffer = AudioBuffer::New(1u, 4096u, 48000u);
+  auto& data  = buffer->getChannelData(0);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = 0.5f * std::sin(2.f * Math::PI * 32.f * static_cast<float>(i) / 512.f);
+  }
+  auto sound = Sound::New("sound", buffer, scene.get());
+  sound->play();
+  analyser->SMOOTHING   = 0.f;
+  analyser->maxDecibels = 0.f;
+  audioEngine->render(2048);
+  ASSERT_TRUE(waitForAnalysis(*analyser, 2048));
+
+  const auto& byteFrequencies = analyser->getByteFrequencyData();
+  ASSERT_EQ(byteFrequencies.size(), 256u);
+  const auto peak = std::max_element(byteFrequencies.begin(), byteFrequencies.end());
+  EXPECT_EQ(peak - byteFrequencies.begin(), 32);
+  EXPECT_GT(*peak, byteFrequencies[31]);
+  EXPECT_GT(*peak, byteFrequencies[33]);
+  EXPECT_EQ(byteFrequencies[100], 0);
+
+  // The windowed sine of amplitude 0.5 is about 0.5 * 0.42 / 2 in its bin
+  const auto& floatFrequencies = analyser->getFloatFrequencyData();
+  EXPECT_NEAR(floatFrequencies[32], 20.f * std::log10(0.5f * 0.42f / 2.f), 1.f);
+  EXPECT_LT(floatFrequencies[100], -100.f);
+
+  // The output of the mixer is the sound itself, the bytes are centered on 128
+  const auto& timeDomain = analyser->getFloatTimeDomainData();
+  ASSERT_EQ(timeDomain.size(), 512u);
+  EXPECT_NEAR(timeDomain[0], 0.f, 1e-5f);
+  EXPECT_NEAR(timeDomain[4], 0.5f, 1e-5f);
+  const auto& byteTimeDomain = analyser->getByteTimeDomainData();
+  EXPECT_EQ(byteTimeDomain[0], 128);
+  EXPECT_EQ(byteTimeDomain[4], 192);
+
+  // Invalid sizes are rejected, a new size is analysed with the next frames
+  analyser->FFT_SIZE = 1000;
+  EXPECT_EQ(analyser->getFrequencyBinCount(), 256u);
+  analyser->FFT_SIZE = 1024;
+  EXPECT_EQ(analyser->getByteFrequencyData().size(), 512u);
+  audioEngine->render(AudioEngine::BlockSize);
+  ASSERT_TRUE(waitForAnalysis(*analyser, 2048 + AudioEngine::BlockSize));
+  EXPECT_EQ(analyser->getFloatTimeDomainData().size(), 1024u);
+
+  analyser->dispose();
+  sound->dispose();
+  Engine::audioEngine = nullptr;
+}
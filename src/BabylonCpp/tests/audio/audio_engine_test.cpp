@@ -0,0 +1,277 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "../test_utils.h"
+
+#include <babylon/audio/audio_buffer.h>
+#include <babylon/audio/audio_engine.h>
+#include <babylon/audio/sound.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/scene.h>
+
+namespace {
+
+void writeUint32(BABYLON::ArrayBuffer& data, uint32_t value)
+{
+  for (unsigned int i = 0; i < 4; ++i) {
+    data.emplace_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+void writeUint16(BABYLON::ArrayBuffer& data, uint16_t value)
+{
+  data.emplace_back(static_cast<uint8_t>(value));
+  data.emplace_back(static_cast<uint8_t>(value >> 8));
+}
+
+// Creates a 16 bits PCM WAV file, with a chunk to skip before the format
+BABYLON::ArrayBuffer createWav(const std::vector<int16_t>& samples, uint16_t numberOfChannels,
+                               uint32_t sampleRate)
+{
+  BABYLON::ArrayBuffer data;
+  const auto dataSize = static_cast<uint32_t>(samples.size() * sizeof(int16_t));
+  data.insert(data.end(), {'R', 'I', 'F', 'F'});
+  writeUint32(data, 4 + (8 + 3 + 1) + (8 + 16) + (8 + dataSize));
+  data.insert(data.end(), {'W', 'A', 'V', 'E'});
+  data.insert(data.end(), {'L', 'I', 'S', 'T'});
+  writeUint32(data, 3);
+  data.insert(data.end(), {'a', 'b', 'c', 0});
+  data.insert(data.end(), {'f', 'm', 't', ' '});
+  writeUint32(data, 16);
+  writeUint16(data, 1);
+  writeUint16(data, numberOfChannels);
+  writeUint32(data, sampleRate);
+  writeUint32(data, sampleRate * numberOfChannels * 2);
+  writeUint16(data, static_cast<uint16_t>(numberOfChannels * 2));
+  writeUint16(data, 16);
+  data.insert(data.end(), {'d', 'a', 't', 'a'});
+  writeUint32(data, dataSize);
+  const auto offset = data.size();
+  data.resize(offset + dataSize);
+  std::memcpy(data.data() + offset, samples.data(), dataSize);
+  return data;
+}
+
+BABYLON::AudioBufferPtr createConstantBuffer(size_t length, float value,
+                                             size_t sampleRate = 48000)
+{
+  auto buffer = BABYLON::AudioBuffer::New(1u, length, sampleRate);
+  std::fill(buffer->getChannelData(0).begin(), buffer->getChannelData(0).end(), value);
+  return buffer;
+}
+
+// Creates the audio engine used by the sounds of the test
+struct AudioEngineScope {
+  AudioEngineScope()
+  {
+    BABYLON::Engine::audioEngine = BABYLON::AudioEngine::New(48000u);
+  }
+  ~AudioEngineScope()
+  {
+    BABYLON::Engine::audioEngine = nullptr;
+  }
+};
+
+} // end of anonymous namespace
+
+TEST(TestAudioBuffer, DecodeWav)
+{
+  using namespace BABYLON;
+
+  auto buffer = AudioBuffer::DecodeWav(createWav({16384, -32768, 0, 8192}, 2, 22050));
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_EQ(buffer->numberOfChannels(), 2u);
+  EXPECT_EQ(buffer->length(), 2u);
+  EXPECT_EQ(buffer->sampleRate(), 22050u);
+  EXPECT_FLOAT_EQ(buffer->getChannelData(0)[0], 0.5f);
+  EXPECT_FLOAT_EQ(buffer->getChannelData(0)[1], 0.f);
+  EXPECT_FLOAT_EQ(buffer->getChannelData(1)[0], -1.f);
+  EXPECT_FLOAT_EQ(buffer->getChannelData(1)[1], 0.25f);
+
+  // 8 bits samples are unsigned
+  const std::vector<uint8_t> samples{{0, 128, 192}};
+  buffer = AudioBuffer::DecodePCM(samples.data(), samples.size(), 1, 8000, 8);
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_FLOAT_EQ(buffer->getChannelData(0)[0], -1.f);
+  EXPECT_FLOAT_EQ(buffer->getChannelData(0)[1], 0.f);
+  EXPECT_FLOAT_EQ(buffer->getChannelData(0)[2], 0.5f);
+
+  EXPECT_EQ(AudioBuffer::DecodeWav(ArrayBuffer{'R', 'I', 'F', 'F'}), nullptr);
+}
+
+TEST(TestAudioEngine, OfflineRender_MixesSounds)
+{
+  using namespace BABYLON;
+  AudioEngineScope audioEngineScope;
+  auto& audioEngine = Engine::audioEngine;
+  auto engine       = createSubject();
+  auto scene        = Scene::New(engine.get());
+
+  ISoundOptions options;
+  options.volume = 0.5f;
+  auto sound     = Sound::New("sound", createWav({16384, 16384, 16384, 16384}, 1, 48000),
+                          scene.get(), nullptr, options);
+  auto otherSound
+    = Sound::New("otherSound", createConstantBuffer(2, 0.25f), scene.get(), nullptr);
+  ASSERT_TRUE(sound->isReady());
+  sound->play();
+  otherSound->play();
+
+  // Both sounds are played in the center, the second one ends first
+  const auto output = audioEngine->render(5);
+  ASSERT_EQ(output.size(), 10u);
+  EXPECT_FLOAT_EQ(output[0], 0.5f * 0.5f + 0.25f);
+  EXPECT_FLOAT_EQ(output[1], 0.5f * 0.5f + 0.25f);
+  EXPECT_FLOAT_EQ(output[4], 0.5f * 0.5f);
+  EXPECT_FLOAT_EQ(output[7], 0.5f * 0.5f);
+  EXPECT_FLOAT_EQ(output[8], 0.f);
+
+  // The global volume is ramped over a block
+  sound->loop = true;
+  sound->play();
+  audioEngine->setGlobalVolume(0.f);
+  audioEngine->render(AudioEngine::BlockSize);
+  EXPECT_FLOAT_EQ(audioEngine->render(1)[0], 0.f);
+}
+
+TEST(TestAudioEngine, OfflineRender_ResamplesAndDelays)
+{
+  using namespace BABYLON;
+  AudioEngineScope audioEngineScope;
+  auto& audioEngine = Engine::audioEngine;
+  auto engine       = createSubject();
+  auto scene        = Scene::New(engine.get());
+
+  // A ramp at half the output sample rate is interpolated
+  auto buffer = AudioBuffer::New(1u, 4u, 24000u);
+  buffer->getChannelData(0) = {0.f, 0.2f, 0.4f, 0.6f};
+  auto sound = Sound::New("sound", buffer, scene.get());
+  sound->play(2.f / 48000.f);
+
+  const auto output = audioEngine->render(10);
+  const std::vector<float> expected{0.f, 0.f, 0.f, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f, 0.6f};
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_NEAR(output[2 * i], expected[i], 1e-6f) << "frame " << i;
+  }
+  EXPECT_FLOAT_EQ(output[19], 0.6f);
+  EXPECT_FLOAT_EQ(audioEngine->render(1)[0], 0.f);
+}
+
+TEST(TestAudioEngine, SpatialSound_PansAndAttenuatesFromCamera)
+{
+  using namespace BABYLON;
+  AudioEngineScope audioEngineScope;
+  auto& audioEngine = Engine::audioEngine;
+  auto engine       = createSubject();
+  auto scene        = Scene::New(engine.get());
+  auto camera       = FreeCamera::New("camera", Vector3::Zero(), scene.get());
+
+  ISoundOptions options;
+  options.loop         = true;
+  options.spatialSound = true;
+  options.maxDistance  = 10.f;
+  auto sound = Sound::New("sound", createConstantBuffer(256, 1.f), scene.get(), nullptr, options);
+  sound->setPosition(Vector3(1.f, 0.f, 0.f));
+  sound->play();
+  scene->render();
+
+  // The sound on the right of the camera is only heard in the right channel
+  audioEngine->render(AudioEngine::BlockSize);
+  auto output = audioEngine->render(1);
+  EXPECT_NEAR(output[0], 0.f, 1e-6f);
+  EXPECT_NEAR(output[1], 1.f, 1e-6f);
+
+  // Turning the camera moves the sound to the left, the linear model halves the gain at the
+  // middle of the distance range
+  camera->rotation().y = Math::PI;
+  sound->setPosition(Vector3(5.5f, 0.f, 0.f));
+  scene->render();
+  audioEngine->render(AudioEngine::BlockSize);
+  output = audioEngine->render(1);
+  EXPECT_NEAR(output[0], 0.5f, 1e-5f);
+  EXPECT_NEAR(output[1], 0.f, 1e-5f);
+
+  // Out of the cone, only the outer gain is left
+  sound->setPosition(Vector3(0.f, 0.f, 1.f));
+  sound->setDirectionalCone(90.f, 180.f, 0.25f);
+  scene->render();
+  audioEngine->render(AudioEngine::BlockSize);
+  output = audioEngine->render(1);
+  EXPECT_NEAR(output[0], 0.25f * std::cos(Math::PI / 4.f), 1e-5f);
+
+  // Beyond the maximum distance the voice is virtual
+  sound->setPosition(Vector3(0.f, 0.f, 20.f));
+  scene->render();
+  audioEngine->render(1);
+  EXPECT_EQ(audioEngine->realVoiceCount(), 0u);
+  EXPECT_EQ(audioEngine->virtualVoiceCount(), 1u);
+}
+
+TEST(TestAudioEngine, VoiceBudget_VirtualizesLowestPriorities)
+{
+  using namespace BABYLON;
+  AudioEngineScope audioEngineScope;
+  auto& audioEngine     = Engine::audioEngine;
+  audioEngine->maxVoices = 2;
+  auto engine            = createSubject();
+  auto scene             = Scene::New(engine.get());
+
+  auto quietSound  = Sound::New("quiet", createConstantBuffer(1024, 0.1f), scene.get());
+  auto loudSound   = Sound::New("loud", createConstantBuffer(1024, 0.2f), scene.get());
+  auto urgentSound = Sound::New("urgent", createConstantBuffer(1024, 0.01f), scene.get());
+  quietSound->setVolume(0.5f);
+  urgentSound->priority = 1;
+  for (const auto& sound : {quietSound, loudSound, urgentSound}) {
+    sound->play();
+  }
+
+  // The quiet sound keeps playing silently
+  auto output = audioEngine->render(4);
+  EXPECT_FLOAT_EQ(output[0], 0.2f + 0.01f);
+  EXPECT_EQ(audioEngine->realVoiceCount(), 2u);
+  EXPECT_EQ(audioEngine->virtualVoiceCount(), 1u);
+  EXPECT_NEAR(quietSound->currentTime(), 4.f / 48000.f, 1e-9f);
+
+  // It is mixed again once a voice is free
+  loudSound->stop();
+  audioEngine->render(AudioEngine::BlockSize);
+  output = audioEngine->render(1);
+  EXPECT_FLOAT_EQ(output[0], 0.5f * 0.1f + 0.01f);
+  EXPECT_EQ(audioEngine->virtualVoiceCount(), 0u);
+}
+
+TEST(TestAudioEngine, OnEndedObservable_NotifiedAfterRender)
+{
+  using namespace BABYLON;
+  AudioEngineScope audioEngineScope;
+  auto& audioEngine = Engine::audioEngine;
+  auto engine       = createSubject();
+  auto scene        = Scene::New(engine.get());
+  FreeCamera::New("camera", Vector3::Zero(), scene.get());
+
+  auto sound        = Sound::New("sound", createConstantBuffer(100, 1.f), scene.get());
+  size_t endedCount = 0;
+  sound->onEndedObservable.add([&](Sound* /*sound*/, EventState& /*es*/) { ++endedCount; });
+  sound->play();
+  scene->render();
+  EXPECT_EQ(endedCount, 0u);
+
+  audioEngine->render(200);
+  EXPECT_TRUE(sound->isPlaying);
+  scene->render();
+  EXPECT_EQ(endedCount, 1u);
+  EXPECT_FALSE(sound->isPlaying);
+
+  // A paused sound resumes where it stopped
+  sound->play();
+  audioEngine->render(40);
+  sound->pause();
+  audioEngine->render(100);
+  sound->play();
+  EXPECT_NEAR(sound->currentTime(), 40.f / 48000.f, 1e-9f);
+  audioEngine->render(60);
+  scene->render();
+  EXPECT_EQ(endedCount, 2u);
+}
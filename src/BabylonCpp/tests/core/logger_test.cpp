@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <babylon/core/logging.h>
+
+namespace {
+
+std::atomic<size_t> gReceivedMessageCount{0};
+
+void onLogMessage(const BABYLON::LogMessage& /*logMessage*/)
+{
+  ++gReceivedMessageCount;
+}
+
+} // end of anonymous namespace
+
+TEST(TestLogger, takesOnlyLevelsWithListeners)
+{
+  using namespace BABYLON;
+
+  auto listener = SA::delegate<void(const LogMessage&)>::create<&onLogMessage>();
+  auto& logger  = LoggerInstance();
+
+  EXPECT_FALSE(logger.takes(LogLevels::LEVEL_DEBUG));
+  logger.registerLogMessageListener(LogLevels::LEVEL_DEBUG, listener);
+  EXPECT_TRUE(logger.takes(LogLevels::LEVEL_DEBUG));
+  EXPECT_FALSE(logger.takes(LogLevels::LEVEL_TRACE));
+  logger.unregisterLogMessageListener(LogLevels::LEVEL_DEBUG, listener);
+  EXPECT_FALSE(logger.takes(LogLevels::LEVEL_DEBUG));
+
+  // No listener: the message is never created
+  gReceivedMessageCount = 0;
+  BABYLON_LOG_DEBUG("TestLogger", "not delivered")
+  EXPECT_EQ(gReceivedMessageCount, 0ull);
+}
+
+TEST(TestLogger, asyncLoggingDeliversAllMessages)
+{
+  using namespace BABYLON;
+
+  auto listener = SA::delegate<void(const LogMessage&)>::create<&onLogMessage>();
+  auto& logger  = LoggerInstance();
+  logger.registerLogMessageListener(LogLevels::LEVEL_INFO, listener);
+  EXPECT_TRUE(logger.startAsyncLogging(1024));
+  EXPECT_TRUE(logger.isAsyncLogging());
+
+  gReceivedMessageCount              = 0;
+  constexpr size_t threadCount       = 4;
+  constexpr size_t messagesPerThread = 200;
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < threadCount; ++t) {
+    threads.emplace_back([t]() {
+      for (size_t i = 0; i < messagesPerThread; ++i) {
+        BABYLON_LOG_INFO("TestLogger", "thread", t, "message", i)
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  logger.flush();
+
+  EXPECT_EQ(gReceivedMessageCount + logger.droppedMessageCount(),
+            threadCount * messagesPerThread);
+
+  logger.stopAsyncLogging();
+  EXPECT_FALSE(logger.isAsyncLogging());
+  logger.unregisterLogMessageListener(LogLevels::LEVEL_INFO, listener);
+}
+
+TEST(TestLogger, stopAsyncLoggingWhileThreadsAreLogging)
+{
+  using namespace BABYLON;
+
+  auto listener = SA::delegate<void(const LogMessage&)>::create<&onLogMessage>();
+  auto& logger  = LoggerInstance();
+  logger.registerLogMessageListener(LogLevels::LEVEL_INFO, listener);
+  // The ring buffer holds all the messages, none of them is dropped
+  EXPECT_TRUE(logger.startAsyncLogging(8192));
+
+  gReceivedMessageCount              = 0;
+  constexpr size_t threadCount       = 4;
+  constexpr size_t messagesPerThread = 1000;
+  std::atomic<size_t> loggedMessageCount{0};
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < threadCount; ++t) {
+    threads.emplace_back([t, &loggedMessageCount]() {
+      for (size_t i = 0; i < messagesPerThread; ++i) {
+        BABYLON_LOG_INFO("TestLogger", "thread", t, "message", i)
+        ++loggedMessageCount;
+      }
+    });
+  }
+
+  // Stop while the threads are logging, the messages are either drained or
+  // dispatched synchronously
+  while (loggedMessageCount < threadCount * messagesPerThread / 4) {
+    std::this_thread::yield();
+  }
+  logger.stopAsyncLogging();
+  EXPECT_FALSE(logger.isAsyncLogging());
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(gReceivedMessageCount, threadCount * messagesPerThread);
+  logger.unregisterLogMessageListener(LogLevels::LEVEL_INFO, listener);
+}
@@ -0,0 +1,120 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+
+#include "../test_utils.h"
+
+#include <babylon/core/profiling/memory_tracker.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/textures/internal_texture.h>
+#include <babylon/materials/textures/irender_target_options.h>
+#include <babylon/meshes/buffer.h>
+#include <babylon/meshes/geometry.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+TEST(TestMemoryTracker, trackedMemoryUpdatesCounters)
+{
+  using namespace BABYLON;
+
+  const auto category = MemoryCategory::AnimationKeys;
+  const auto initial  = MemoryTracker::GetBytes(category);
+  {
+    TrackedMemory memory{category};
+    memory.set(1024);
+    EXPECT_EQ(MemoryTracker::GetBytes(category), initial + 1024);
+    memory.set(256);
+    EXPECT_EQ(MemoryTracker::GetBytes(category), initial + 256);
+    memory.add(256);
+    EXPECT_EQ(memory.bytes(), 512ull);
+    EXPECT_EQ(MemoryTracker::GetBytes(category), initial + 512);
+    EXPECT_GE(MemoryTracker::GetPeakBytes(category), initial + 1024);
+
+    // Copies account for their own bytes, moves transfer them
+    TrackedMemory copy{memory};
+    EXPECT_EQ(MemoryTracker::GetBytes(category), initial + 1024);
+    TrackedMemory moved{std::move(copy)};
+    EXPECT_EQ(copy.bytes(), 0ull);
+    EXPECT_EQ(moved.bytes(), 512ull);
+    EXPECT_EQ(MemoryTracker::GetBytes(category), initial + 1024);
+  }
+  // Destruction releases the bytes
+  EXPECT_EQ(MemoryTracker::GetBytes(category), initial);
+}
+
+TEST(TestMemoryTracker, serialize)
+{
+  using namespace BABYLON;
+
+  TrackedMemory memory{MemoryCategory::LoaderStagingBuffers};
+  memory.set(4096);
+
+  const auto dump = MemoryTracker::Serialize();
+  ASSERT_TRUE(dump.find("categories") != dump.end());
+  const auto& categories = dump["categories"];
+  EXPECT_EQ(categories.size(), MemoryTracker::CategoryCount);
+  EXPECT_GE(categories["loaderStagingBuffers"]["bytes"].get<size_t>(), 4096ull);
+  EXPECT_GE(dump["trackedBytes"].get<size_t>(), 4096ull);
+}
+
+TEST(TestMemoryTracker, geometryTracksItsVertexAndIndexData)
+{
+  using namespace BABYLON;
+
+  auto engine            = createSubject();
+  auto scene             = Scene::New(engine.get());
+  const auto vertexBytes = MemoryTracker::GetBytes(MemoryCategory::GeometryVertexData);
+  const auto indexBytes  = MemoryTracker::GetBytes(MemoryCategory::GeometryIndexData);
+
+  // Positions and normals of 4 vertices interleaved in one buffer, counted once
+  Buffer buffer(engine.get(), Float32Array(4 * 6, 0.f), false, 6);
+  auto geometry = Geometry::New("geometry", scene.get());
+  geometry->setVerticesBuffer(buffer.createVertexBuffer(VertexBuffer::PositionKind, 0, 3, 6), 4);
+  geometry->setVerticesBuffer(buffer.createVertexBuffer(VertexBuffer::NormalKind, 3, 3, 6));
+  EXPECT_EQ(MemoryTracker::GetBytes(MemoryCategory::GeometryVertexData),
+            vertexBytes + 4 * 6 * sizeof(float));
+
+  geometry->setVerticesData(VertexBuffer::UVKind, Float32Array(4 * 2, 0.f));
+  EXPECT_EQ(MemoryTracker::GetBytes(MemoryCategory::GeometryVertexData),
+            vertexBytes + 4 * 8 * sizeof(float));
+  geometry->removeVerticesData(VertexBuffer::UVKind);
+  EXPECT_EQ(MemoryTracker::GetBytes(MemoryCategory::GeometryVertexData),
+            vertexBytes + 4 * 6 * sizeof(float));
+
+  geometry->setIndices({0, 1, 2, 0, 2, 3});
+  EXPECT_EQ(MemoryTracker::GetBytes(MemoryCategory::GeometryIndexData),
+            indexBytes + 6 * sizeof(IndicesArray::value_type));
+
+  // Disposing the geometry releases its data
+  geometry->dispose();
+  EXPECT_EQ(MemoryTracker::GetBytes(MemoryCategory::GeometryVertexData), vertexBytes);
+  EXPECT_EQ(MemoryTracker::GetBytes(MemoryCategory::GeometryIndexData), indexBytes);
+}
+
+TEST(TestMemoryTracker, internalTextureTracksItsEstimatedSize)
+{
+  using namespace BABYLON;
+
+  auto engine       = createSubject();
+  const auto before = MemoryTracker::GetBytes(MemoryCategory::Textures);
+
+  // RGBA8 color buffer, with a 4 bytes depth buffer
+  IRenderTargetOptions options;
+  options.generateMipMaps     = false;
+  options.generateDepthBuffer = true;
+  auto texture                = engine->createRenderTargetTexture(64, options);
+  EXPECT_EQ(texture->getEstimatedMemorySize(), 64u * 64u * (4u + 4u));
+  EXPECT_EQ(MemoryTracker::GetBytes(MemoryCategory::Textures),
+            before + texture->getEstimatedMemorySize());
+
+  // Resizing updates the estimate
+  texture->updateSize(32, 16);
+  EXPECT_EQ(texture->getEstimatedMemorySize(), 32u * 16u * (4u + 4u));
+  EXPECT_EQ(MemoryTracker::GetBytes(MemoryCategory::Textures),
+            before + texture->getEstimatedMemorySize());
+
+  // The bytes are released with the last reference
+  texture->dispose();
+  EXPECT_EQ(texture->getEstimatedMemorySize(), 0u);
+  EXPECT_EQ(MemoryTracker::GetBytes(MemoryCategory::Textures), before);
+}
@@ -0,0 +1,77 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include <babylon/core/thread_pool.h>
+
+TEST(TestThreadPool, parallelForVisitsEachItemOnce)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool{4};
+  EXPECT_EQ(pool.workerCount(), 4ull);
+
+  for (size_t grainSize : {1, 7, 64, 5000}) {
+    std::vector<int> visits(1000, 0);
+    std::vector<size_t> workers(1000, 0);
+    pool.parallelFor(visits.size(), grainSize, [&](size_t begin, size_t end, size_t workerIndex) {
+      for (size_t i = begin; i < end; ++i) {
+        ++visits[i];
+        workers[i] = workerIndex;
+      }
+    });
+    for (size_t i = 0; i < visits.size(); ++i) {
+      EXPECT_EQ(visits[i], 1);
+      EXPECT_LT(workers[i], pool.workerCount());
+    }
+  }
+}
+
+TEST(TestThreadPool, nestedParallelForRunsInline)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool{3};
+  std::atomic<size_t> total{0};
+  pool.parallelFor(16, 1, [&](size_t, size_t, size_t outerWorker) {
+    pool.parallelFor(10, 1, [&](size_t begin, size_t end, size_t innerWorker) {
+      EXPECT_EQ(innerWorker, outerWorker);
+      total += end - begin;
+    });
+  });
+  EXPECT_EQ(total.load(), 160ull);
+}
+
+TEST(TestThreadPool, nestedParallelForOfAnotherPoolUsesItsWorkerIndices)
+{
+  using namespace BABYLON;
+
+  // Per worker scratch data of the inner pool, smaller than the outer pool
+  ThreadPool outerPool{4};
+  ThreadPool innerPool{2};
+  std::vector<size_t> innerScratch(innerPool.workerCount(), 0);
+  std::atomic<size_t> total{0};
+  outerPool.parallelFor(16, 1, [&](size_t, size_t, size_t /*outerWorker*/) {
+    innerPool.parallelFor(10, 1, [&](size_t begin, size_t end, size_t innerWorker) {
+      ASSERT_LT(innerWorker, innerScratch.size());
+      innerScratch[innerWorker] += end - begin;
+      total += end - begin;
+    });
+  });
+  EXPECT_EQ(total.load(), 160ull);
+  EXPECT_EQ(innerScratch[0], 160ull);
+
+  // Back to the outer pool from the inner loop: inline, with the index of the outer worker
+  total = 0;
+  outerPool.parallelFor(16, 1, [&](size_t, size_t, size_t outerWorker) {
+    innerPool.parallelFor(2, 1, [&](size_t, size_t, size_t) {
+      outerPool.parallelFor(10, 1, [&](size_t begin, size_t end, size_t nestedWorker) {
+        EXPECT_EQ(nestedWorker, outerWorker);
+        total += end - begin;
+      });
+    });
+  });
+  EXPECT_EQ(total.load(), 160ull);
+}
@@ -0,0 +1,171 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "../test_utils.h"
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_group.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/animations/targeted_animation.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engines/asset_container.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/meshes/builders/box_builder.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/transform_node.h>
+
+TEST(TestAssetContainer, InstantiateModelsToScene_ClonesHierarchies)
+{
+  using namespace BABYLON;
+  auto engine    = createSubject();
+  auto scene     = Scene::New(engine.get());
+  auto container = AssetContainer::New(scene.get());
+
+  // A character loaded in the container: a root node, a skinned mesh and a walk animation
+  auto root = TransformNode::New("root", scene.get());
+  BoxOptions options;
+  auto body      = BoxBuilder::CreateBox("body", options, scene.get());
+  body->parent   = root.get();
+  body->position = Vector3(0.f, 1.f, 0.f);
+  auto skeleton  = Skeleton::New("skeleton", "skeleton", scene.get());
+  auto hips      = Bone::New("hips", skeleton.get());
+  auto spine     = Bone::New("spine", skeleton.get(), hips.get());
+  body->skeleton = skeleton;
+  auto animation = Animation::New("walk", "position.y", 30,
+                                  static_cast<int>(Animation::ANIMATIONTYPE_FLOAT));
+  animation->setKeys({IAnimationKey(0.f, AnimationValue(0.f)),
+                      IAnimationKey(30.f, AnimationValue(1.f))});
+  auto walk = AnimationGroup::New("walk", scene.get());
+  walk->addTargetedAnimation(animation, spine);
+  walk->addTargetedAnimation(animation, root);
+  container->transformNodes  = scene->transformNodes;
+  container->meshes          = scene->meshes;
+  container->geometries      = scene->geometries;
+  container->skeletons       = scene->skeletons;
+  container->animationGroups = scene->animationGroups;
+  container->removeAllFromScene();
+  EXPECT_TRUE(scene->meshes.empty());
+
+  auto entries = container->instantiateModelsToScene();
+  ASSERT_EQ(entries.rootNodes.size(), 1u);
+  const auto& rootClone = entries.rootNodes[0];
+  EXPECT_EQ(rootClone->name, "Clone of root");
+  ASSERT_EQ(rootClone->getChildMeshes(true).size(), 1u);
+  auto bodyClone = std::static_pointer_cast<Mesh>(rootClone->getChildMeshes(true)[0]);
+  EXPECT_EQ(bodyClone->name, "Clone of body");
+  EXPECT_EQ(bodyClone->geometry(), body->geometry());
+  EXPECT_TRUE(bodyClone->position().equals(Vector3(0.f, 1.f, 0.f)));
+
+  // The skeleton is cloned and the animations retargeted to the clones
+  ASSERT_EQ(entries.skeletons.size(), 1u);
+  const auto& skeletonClone = entries.skeletons[0];
+  EXPECT_NE(skeletonClone, skeleton);
+  EXPECT_EQ(bodyClone->skeleton(), skeletonClone);
+  ASSERT_EQ(skeletonClone->bones.size(), 2u);
+  EXPECT_EQ(skeletonClone->bones[1]->getParent(), skeletonClone->bones[0].get());
+  ASSERT_EQ(entries.animationGroups.size(), 1u);
+  EXPECT_EQ(entries.animationGroups[0]->name, "Clone of walk");
+  auto& targetedAnimations = entries.animationGroups[0]->targetedAnimations();
+  ASSERT_EQ(targetedAnimations.size(), 2u);
+  EXPECT_EQ(targetedAnimations[0]->target, skeletonClone->bones[1]);
+  EXPECT_EQ(targetedAnimations[1]->target, rootClone);
+  EXPECT_EQ(targetedAnimations[0]->animation, animation);
+
+  // Only the clones are added to the scene
+  EXPECT_EQ(scene->meshes.size(), 1u);
+  EXPECT_EQ(scene->transformNodes.size(), 1u);
+  EXPECT_EQ(scene->skeletons.size(), 1u);
+  EXPECT_EQ(scene->animationGroups.size(), 1u);
+
+  auto namedEntries = container->instantiateModelsToScene(
+    [](const std::string& sourceName) { return "Copy of " + sourceName; });
+  EXPECT_EQ(namedEntries.rootNodes[0]->name, "Copy of root");
+  EXPECT_EQ(namedEntries.skeletons[0]->name, "Copy of skeleton");
+  EXPECT_EQ(scene->meshes.size(), 2u);
+
+  entries.dispose();
+  EXPECT_TRUE(entries.rootNodes.empty());
+  EXPECT_EQ(scene->meshes.size(), 1u);
+  EXPECT_EQ(scene->skeletons.size(), 1u);
+  EXPECT_EQ(scene->animationGroups.size(), 1u);
+}
+
+TEST(TestAssetContainer, InstantiateModelsToScene_ClonesMaterials)
+{
+  using namespace BABYLON;
+  auto engine    = createSubject();
+  auto scene     = Scene::New(engine.get());
+  auto container = AssetContainer::New(scene.get());
+
+  // Two meshes sharing a material, with a fade animation
+  BoxOptions options;
+  auto box        = BoxBuilder::CreateBox("box", options, scene.get());
+  auto other      = BoxBuilder::CreateBox("other", options, scene.get());
+  auto material   = StandardMaterial::New("material", scene.get());
+  box->material   = material;
+  other->material = material;
+  auto animation  = Animation::New("fade", "alpha", 30,
+                                   static_cast<int>(Animation::ANIMATIONTYPE_FLOAT));
+  animation->setKeys({IAnimationKey(0.f, AnimationValue(1.f)),
+                      IAnimationKey(30.f, AnimationValue(0.f))});
+  auto fade = AnimationGroup::New("fade", scene.get());
+  fade->addTargetedAnimation(animation, material);
+  container->meshes          = scene->meshes;
+  container->geometries      = scene->geometries;
+  container->materials       = scene->materials;
+  container->animationGroups = scene->animationGroups;
+  container->removeAllFromScene();
+  EXPECT_TRUE(scene->materials.empty());
+
+  // The material is cloned once and registered with the scene
+  auto entries = container->instantiateModelsToScene(nullptr, true);
+  ASSERT_EQ(entries.rootNodes.size(), 2u);
+  ASSERT_EQ(scene->materials.size(), 1u);
+  const auto& materialClone = scene->materials[0];
+  EXPECT_NE(materialClone, material);
+  EXPECT_EQ(materialClone->name, "Clone of material");
+  for (const auto& rootNode : entries.rootNodes) {
+    EXPECT_EQ(std::static_pointer_cast<Mesh>(rootNode)->material(), materialClone);
+  }
+
+  // The animations of the material are retargeted to its clone
+  ASSERT_EQ(entries.animationGroups.size(), 1u);
+  ASSERT_EQ(entries.animationGroups[0]->targetedAnimations().size(), 1u);
+  EXPECT_EQ(entries.animationGroups[0]->targetedAnimations()[0]->target, materialClone);
+
+  // Without cloning, the material and its animations are shared
+  auto sharedEntries = container->instantiateModelsToScene(nullptr, false);
+  EXPECT_EQ(std::static_pointer_cast<Mesh>(sharedEntries.rootNodes[0])->material(), material);
+  EXPECT_EQ(scene->materials.size(), 1u);
+  ASSERT_EQ(sharedEntries.animationGroups.size(), 1u);
+  EXPECT_EQ(sharedEntries.animationGroups[0]->targetedAnimations()[0]->target, material);
+}
+
+TEST(TestAssetContainer, InstantiateModelsToScene_RestoresEntityCollectionOnError)
+{
+  using namespace BABYLON;
+  auto engine    = createSubject();
+  auto scene     = Scene::New(engine.get());
+  auto container = AssetContainer::New(scene.get());
+
+  BoxOptions options;
+  BoxBuilder::CreateBox("box", options, scene.get());
+  container->meshes     = scene->meshes;
+  container->geometries = scene->geometries;
+  container->removeAllFromScene();
+
+  // A failing clone leaves the scene collecting new entities
+  const auto failingName = [](const std::string& /*sourceName*/) -> std::string {
+    throw std::runtime_error("invalid name");
+  };
+  EXPECT_THROW(container->instantiateModelsToScene(failingName), std::runtime_error);
+  EXPECT_FALSE(scene->_blockEntityCollection);
+  auto box = BoxBuilder::CreateBox("other", options, scene.get());
+  ASSERT_EQ(scene->meshes.size(), 1u);
+  EXPECT_EQ(scene->meshes[0], box);
+}
@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "../test_utils.h"
+
+#include <babylon/animations/animation.h>
+#include <babylon/collisions/collider.h>
+#include <babylon/core/frame_arena.h>
+#include <babylon/culling/ray.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/material_defines.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/sub_mesh.h>
+
+namespace {
+
+std::atomic<bool> gCountAllocations{false};
+std::atomic<size_t> gAllocationCount{0};
+
+} // end of anonymous namespace
+
+// Replace the global allocation functions to count the heap allocations made while
+// gCountAllocations is set. This file is built as its own test executable
+// (BabylonCppAllocationTests), so the replacement does not affect the other tests.
+void* operator new(std::size_t size)
+{
+  if (gCountAllocations.load(std::memory_order_relaxed)) {
+    gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (auto ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+  std::free(ptr);
+}
+
+TEST(TestFrameArena, reusesMemoryAfterReset)
+{
+  using namespace BABYLON;
+
+  FrameArena arena{1024};
+  {
+    FrameVector<int> values{FrameAllocator<int>{arena}};
+    for (int i = 0; i < 1000; ++i) {
+      values.emplace_back(i);
+    }
+    EXPECT_EQ(values.back(), 999);
+  }
+  const auto capacity = arena.capacity();
+  EXPECT_GE(capacity, 1000 * sizeof(int));
+  arena.reset();
+  EXPECT_EQ(arena.bytesUsed(), 0ull);
+  EXPECT_EQ(arena.blockCount(), 1ull);
+
+  // Steady state: the same workload fits in the retained block
+  gAllocationCount = 0;
+  gCountAllocations = true;
+  {
+    FrameArena::Scope scope{arena};
+    FrameVector<int> values{FrameAllocator<int>{arena}};
+    values.reserve(1000);
+    for (int i = 0; i < 1000; ++i) {
+      values.emplace_back(i);
+    }
+  }
+  gCountAllocations = false;
+  EXPECT_EQ(gAllocationCount, 0ull);
+  EXPECT_EQ(arena.bytesUsed(), 0ull);
+  EXPECT_EQ(arena.capacity(), capacity);
+}
+
+TEST(TestFrameArena, resetKeepsTheMemoryOfOpenScopes)
+{
+  using namespace BABYLON;
+
+  FrameArena arena{1024};
+  FrameArena::Scope scope{arena};
+  FrameVector<int> values{FrameAllocator<int>{arena}};
+  for (int i = 0; i < 1000; ++i) {
+    values.emplace_back(i);
+  }
+  const auto blockCount = arena.blockCount();
+  EXPECT_GT(blockCount, 1ull);
+
+  // A frame started from within the scope neither merges nor reuses the blocks
+  const auto bytesUsed = arena.bytesUsed();
+  arena.reset();
+  EXPECT_EQ(arena.blockCount(), blockCount);
+  EXPECT_EQ(arena.bytesUsed(), bytesUsed);
+  FrameVector<int> otherValues(1000, -1, FrameAllocator<int>{arena});
+  EXPECT_EQ(values.front(), 0);
+  EXPECT_EQ(values.back(), 999);
+}
+
+TEST(TestFrameArena, defaultCandidateListsArePerProvider)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto box    = Mesh::CreateBox("box", 1.f, scene.get());
+  auto sphere = Mesh::CreateSphere("sphere", 16, 1.f, scene.get());
+
+  // A picking or a collision check does not refill the list of the active meshes evaluation
+  const auto& activeCandidates = scene->getActiveSubMeshCandidates(box.get());
+  ASSERT_EQ(activeCandidates.size(), 1ull);
+  const auto& intersectingCandidates
+    = scene->getIntersectingSubMeshCandidates(sphere.get(), Ray(Vector3::Zero(), Vector3::Up()));
+  scene->getCollidingSubMeshCandidates(sphere.get(), Collider());
+  EXPECT_NE(&activeCandidates, &intersectingCandidates);
+  ASSERT_EQ(activeCandidates.size(), 1ull);
+  EXPECT_EQ(activeCandidates.front(), box->subMeshes.front().get());
+  ASSERT_EQ(intersectingCandidates.size(), 1ull);
+  EXPECT_EQ(intersectingCandidates.front(), sphere->subMeshes.front().get());
+}
+
+TEST(TestFrameArena, steadyStateFrameDoesNotAllocate)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->createDefaultCameraOrLight();
+
+  // Opaque meshes
+  auto box    = Mesh::CreateBox("box", 1.f, scene.get());
+  auto sphere = Mesh::CreateSphere("sphere", 16, 1.f, scene.get());
+  Mesh::CreateGround("ground", 6, 6, 2, scene.get());
+  sphere->position().x = 2.f;
+
+  // Transparent mesh, rendered sorted
+  auto transparentMaterial   = StandardMaterial::New("transparent", scene.get());
+  transparentMaterial->alpha = 0.5f;
+  auto transparentBox        = Mesh::CreateBox("transparentBox", 1.f, scene.get());
+  transparentBox->material   = transparentMaterial;
+  transparentBox->position().x = -2.f;
+
+  // Running animation
+  Animation::CreateAndStartAnimation("rotation", box, "rotation.y", 30, 60.f, AnimationValue(0.f),
+                                     AnimationValue(3.14f));
+
+  const auto renderFrame = [&engine, &scene]() {
+    engine->beginFrame();
+    scene->render();
+    engine->endFrame();
+  };
+
+  // Warm up: lets the materials, the caches and the frame arena reach their steady state size
+  for (unsigned int i = 0; i < 10; ++i) {
+    renderFrame();
+  }
+
+  gAllocationCount  = 0;
+  gCountAllocations = true;
+  for (unsigned int i = 0; i < 10; ++i) {
+    renderFrame();
+  }
+  gCountAllocations = false;
+
+  EXPECT_EQ(gAllocationCount, 0ull);
+}
+
+TEST(TestEffect, setMatrixDoesNotAllocate)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->createDefaultCameraOrLight();
+  auto box      = Mesh::CreateBox("box", 1.f, scene.get());
+  auto material = StandardMaterial::New("material", scene.get());
+  box->material = material;
+  scene->render();
+  auto effect = material->getEffect();
+  ASSERT_NE(effect, nullptr);
+
+  // Every matrix differs from the cached one, so each of them is uploaded
+  Matrix matrix;
+  gAllocationCount  = 0;
+  gCountAllocations = true;
+  for (unsigned int i = 0; i < 10; ++i) {
+    Matrix::TranslationToRef(static_cast<float>(i), 0.f, 0.f, matrix);
+    effect->setMatrix("world", matrix);
+  }
+  gCountAllocations = false;
+
+  EXPECT_EQ(gAllocationCount, 0ull);
+}
+
+TEST(TestStandardMaterial, bindForSubMeshDoesNotCopyTheDefines)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->createDefaultCameraOrLight();
+  auto box      = Mesh::CreateBox("box", 1.f, scene.get());
+  auto material = StandardMaterial::New("material", scene.get());
+  box->material = material;
+  scene->render();
+  auto subMesh = box->subMeshes[0].get();
+  ASSERT_NE(subMesh->_materialDefines, nullptr);
+  const auto defines = subMesh->_materialDefines->toString();
+
+  gAllocationCount  = 0;
+  gCountAllocations = true;
+  for (unsigned int i = 0; i < 10; ++i) {
+    material->bindForSubMesh(box->getWorldMatrix(), box.get(), subMesh);
+  }
+  gCountAllocations = false;
+
+  EXPECT_EQ(gAllocationCount, 0ull);
+  EXPECT_EQ(subMesh->_materialDefines->toString(), defines);
+}
@@ -0,0 +1,149 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/actions/action_manager.h>
+#include <babylon/actions/directactions/execute_code_action.h>
+#include <babylon/actions/iaction_event.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/culling/sweep_and_prune.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/box_builder.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+
+TEST(TestSweepAndPrune, Update_FindsOverlappingPairs)
+{
+  using namespace BABYLON;
+  SweepAndPrune broadphase;
+
+  // Boxes on a grid, each one overlapping its neighbors on the x axis only
+  std::vector<SweepAndPrune::Box> boxes;
+  for (size_t i = 0; i < 50; ++i) {
+    const auto x = static_cast<float>(i % 10) * 0.75f;
+    const auto y = static_cast<float>(i / 10) * 2.f;
+    boxes.push_back({{x, y, 0.f}, {x + 1.f, y + 1.f, 1.f}});
+    EXPECT_EQ(broadphase.addBox(boxes.back()), i);
+  }
+  broadphase.update();
+
+  size_t pairCount = 0;
+  for (size_t a = 0; a < boxes.size(); ++a) {
+    for (size_t b = a + 1; b < boxes.size(); ++b) {
+      auto overlap = true;
+      for (size_t axis = 0; axis < 3; ++axis) {
+        overlap = overlap && boxes[a].minimum[axis] <= boxes[b].maximum[axis]
+                  && boxes[b].minimum[axis] <= boxes[a].maximum[axis];
+      }
+      EXPECT_EQ(broadphase.overlap(a, b), overlap);
+      EXPECT_EQ(broadphase.overlap(b, a), overlap);
+      pairCount += overlap ? 1 : 0;
+    }
+  }
+  EXPECT_EQ(broadphase.pairs().size(), pairCount);
+  EXPECT_EQ(pairCount, 45u);
+  EXPECT_EQ(broadphase.overlaps(0).size(), 1u);
+  EXPECT_EQ(broadphase.overlaps(1).size(), 2u);
+
+  broadphase.clear();
+  EXPECT_EQ(broadphase.size(), 0u);
+  EXPECT_FALSE(broadphase.overlap(0, 1));
+}
+
+TEST(TestIntersectionTriggers, EnterAndExit_FireOncePerIntersection)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+
+  BoxOptions options;
+  auto volume       = BoxBuilder::CreateBox("volume", options, scene.get());
+  auto player       = BoxBuilder::CreateBox("player", options, scene.get());
+  volume->isVisible = false;
+  player->isVisible = false;
+  player->position  = Vector3(5.f, 0.f, 0.f);
+
+  // The player is looked up by name, the exit trigger uses the mesh directly
+  std::vector<std::string> events;
+  volume->actionManager = ActionManager::New(scene.get());
+  TriggerOptions enterOptions;
+  enterOptions.trigger   = ActionManager::OnIntersectionEnterTrigger;
+  enterOptions.parameter = "player";
+  volume->actionManager->registerAction(std::make_shared<ExecuteCodeAction>(
+    enterOptions, [&events](const std::optional<IActionEvent>& evt) {
+      events.emplace_back("enter " + evt->additionalData);
+    }));
+  TriggerOptions exitOptions;
+  exitOptions.trigger = ActionManager::OnIntersectionExitTrigger;
+  exitOptions.mesh    = player;
+  volume->actionManager->registerAction(std::make_shared<ExecuteCodeAction>(
+    exitOptions, [&events](const std::optional<IActionEvent>& evt) {
+      events.emplace_back("exit " + evt->additionalData);
+    }));
+
+  scene->render();
+  EXPECT_TRUE(events.empty());
+
+  player->position = Vector3(0.5f, 0.f, 0.f);
+  scene->render();
+  scene->render();
+  EXPECT_EQ(events, std::vector<std::string>({"enter player"}));
+  EXPECT_EQ(volume->_intersectionsInProgress, std::vector<AbstractMesh*>({player.get()}));
+
+  player->position = Vector3(0.f, 5.f, 0.f);
+  scene->render();
+  scene->render();
+  EXPECT_EQ(events, std::vector<std::string>({"enter player", "exit player"}));
+  EXPECT_TRUE(volume->_intersectionsInProgress.empty());
+
+  // A disposed mesh does not stay in the intersections in progress
+  player->position = Vector3(0.f, 0.f, 0.f);
+  scene->render();
+  EXPECT_EQ(events.size(), 3u);
+  player->dispose();
+  EXPECT_TRUE(volume->_intersectionsInProgress.empty());
+  scene->render();
+  EXPECT_EQ(events.size(), 3u);
+}
+
+TEST(TestIntersectionTriggers, TriggerWithoutMesh_ChecksAllTriggerVolumes)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+
+  // A row of trigger volumes, each one overlapping the next one
+  BoxOptions options;
+  std::vector<MeshPtr> volumes;
+  size_t enterCount = 0, exitCount = 0;
+  for (size_t i = 0; i < 20; ++i) {
+    auto volume       = BoxBuilder::CreateBox("volume" + std::to_string(i), options, scene.get());
+    volume->isVisible = false;
+    volume->position  = Vector3(static_cast<float>(i) * 0.9f, 0.f, 0.f);
+    volume->actionManager = ActionManager::New(scene.get());
+    volume->actionManager->registerAction(std::make_shared<ExecuteCodeAction>(
+      ActionManager::OnIntersectionEnterTrigger,
+      [&enterCount](const std::optional<IActionEvent>&) { ++enterCount; }));
+    volume->actionManager->registerAction(std::make_shared<ExecuteCodeAction>(
+      ActionManager::OnIntersectionExitTrigger,
+      [&exitCount](const std::optional<IActionEvent>&) { ++exitCount; }));
+    volumes.emplace_back(volume);
+  }
+
+  // Each intersection is reported by both of its volumes
+  scene->render();
+  EXPECT_EQ(enterCount, 2u * 19u);
+  EXPECT_EQ(volumes[0]->_intersectionsInProgress.size(), 1u);
+  EXPECT_EQ(volumes[1]->_intersectionsInProgress.size(), 2u);
+  scene->render();
+  EXPECT_EQ(enterCount, 2u * 19u);
+  EXPECT_EQ(exitCount, 0u);
+
+  volumes[0]->position = Vector3(-5.f, 0.f, 0.f);
+  scene->render();
+  EXPECT_EQ(exitCount, 2u);
+  EXPECT_TRUE(volumes[0]->_intersectionsInProgress.empty());
+}
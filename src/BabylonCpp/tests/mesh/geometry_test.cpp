@@ -4,9 +4,14 @@
 #include "../test_utils.h"
 
 #include <babylon/babylon_stl_util.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/meshes/buffer.h>
+#include <babylon/meshes/builders/box_builder.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
 #include <babylon/meshes/geometry.h>
+#include <babylon/meshes/mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
 
 TEST(TestGeometry, TestGetVerticesData_Vec3FloatColor)
@@ -29,3 +34,19 @@ TEST(TestGeometry, TestGetVerticesData_Vec3FloatColor)
   auto result = geometry->getVerticesData(VertexBuffer::ColorKind);
   EXPECT_THAT(result, ::testing::ContainerEq(data));
 }
+
+TEST(TestGeometry, TestBind_WithoutVertexArrayObjects)
+{
+  using namespace BABYLON;
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+  FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+  BoxOptions options;
+  auto box = BoxBuilder::CreateBox("box", options, scene.get());
+  ASSERT_FALSE(subject->getCaps().vertexArrayObject);
+
+  // The buffers are bound directly when the engine does not support vertex array objects
+  scene->render();
+  scene->render();
+  EXPECT_TRUE(box->geometry()->_vertexArrayObjects.empty());
+}
@@ -0,0 +1,165 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/scene.h>
+#include <babylon/misc/optimization/lens_flares_optimization.h>
+#include <babylon/misc/optimization/particles_optimization.h>
+#include <babylon/misc/optimization/scene_optimizer.h>
+#include <babylon/misc/optimization/shadows_optimization.h>
+
+TEST(TestSceneOptimizer, SampleFrame_StepsPriorityLevelsDownAndUp)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+
+  // A 20 ms budget, checked every 4 frames
+  SceneOptimizerOptions options(50.f, 50);
+  options.frameTimeSampleCount = 4;
+  options.headroom             = 0.2f;
+  auto shadows                 = std::make_shared<ShadowsOptimization>(0);
+  auto particles               = std::make_shared<ParticlesOptimization>(1);
+  auto lensFlares              = std::make_shared<LensFlaresOptimization>(1);
+  options.addOptimization(shadows).addOptimization(particles).addOptimization(lensFlares);
+
+  auto optimizer                = SceneOptimizer::New(scene.get(), options);
+  float frameTime               = 30.f;
+  optimizer->cpuFrameTimeSource = [&frameTime]() { return frameTime; };
+  size_t appliedCount = 0, revertedCount = 0, successCount = 0, failureCount = 0;
+  optimizer->onNewOptimizationAppliedObservable.add(
+    [&](SceneOptimization*, EventState&) { ++appliedCount; });
+  optimizer->onOptimizationRevertedObservable.add(
+    [&](SceneOptimization*, EventState&) { ++revertedCount; });
+  optimizer->onSuccessObservable.add([&](SceneOptimizer*, EventState&) { ++successCount; });
+  optimizer->onFailureObservable.add([&](SceneOptimizer*, EventState&) { ++failureCount; });
+  optimizer->start();
+  EXPECT_FLOAT_EQ(optimizer->frameTimeBudget(), 20.f);
+
+  const auto renderFrames = [&scene](size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      scene->render();
+    }
+  };
+
+  // Over budget: the levels are applied one after the other
+  renderFrames(3);
+  EXPECT_EQ(appliedCount, 0u);
+  renderFrames(1);
+  EXPECT_FLOAT_EQ(optimizer->currentFrameTime(), 0.f);
+  EXPECT_EQ(optimizer->currentPriorityLevel(), 1);
+  EXPECT_EQ(optimizer->getActiveOptimizations(), std::vector<SceneOptimizationPtr>({shadows}));
+  EXPECT_FALSE(scene->shadowsEnabled());
+
+  frameTime = 25.f;
+  renderFrames(4);
+  EXPECT_EQ(optimizer->currentPriorityLevel(), 2);
+  EXPECT_EQ(optimizer->getActiveOptimizations().size(), 3u);
+  EXPECT_FALSE(scene->particlesEnabled);
+  EXPECT_FALSE(scene->lensFlaresEnabled);
+
+  // Nothing left to apply, the failure is reported once
+  frameTime = 22.f;
+  renderFrames(8);
+  EXPECT_EQ(appliedCount, 3u);
+  EXPECT_EQ(failureCount, 1u);
+
+  // Within budget, but reverting the last level would not leave enough headroom
+  frameTime = 17.f;
+  renderFrames(8);
+  EXPECT_EQ(successCount, 1u);
+  EXPECT_EQ(revertedCount, 0u);
+  EXPECT_FLOAT_EQ(optimizer->currentFrameRate(), 1000.f / 17.f);
+
+  // Headroom returns: the levels are reverted one after the other
+  frameTime = 10.f;
+  renderFrames(4);
+  EXPECT_EQ(revertedCount, 2u);
+  EXPECT_EQ(optimizer->currentPriorityLevel(), 1);
+  EXPECT_TRUE(scene->particlesEnabled);
+  EXPECT_TRUE(scene->lensFlaresEnabled);
+  EXPECT_FALSE(scene->shadowsEnabled());
+  renderFrames(4);
+  EXPECT_EQ(optimizer->currentPriorityLevel(), 0);
+  EXPECT_TRUE(optimizer->getActiveOptimizations().empty());
+  EXPECT_TRUE(scene->shadowsEnabled());
+
+  // Stopped, the frames are not sampled anymore
+  optimizer->stop();
+  frameTime = 30.f;
+  renderFrames(8);
+  EXPECT_EQ(appliedCount, 3u);
+}
+
+TEST(TestSceneOptimizer, Reset_RevertsActiveOptimizations)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  SceneOptimizerOptions options(60.f, 0);
+  options.frameTimeSampleCount = 1;
+  options.addOptimization(std::make_shared<ShadowsOptimization>(0))
+    .addOptimization(std::make_shared<ParticlesOptimization>(1));
+  auto optimizer = SceneOptimizer::New(scene.get(), options);
+
+  // Frames sampled without rendering, the GPU time being the largest one
+  optimizer->start();
+  optimizer->sampleFrame(5.f, 40.f);
+  optimizer->sampleFrame(5.f, 40.f);
+  EXPECT_EQ(optimizer->getActiveOptimizations().size(), 2u);
+  EXPECT_FALSE(scene->shadowsEnabled());
+  EXPECT_FALSE(scene->particlesEnabled);
+
+  optimizer->reset();
+  EXPECT_EQ(optimizer->currentPriorityLevel(), 0);
+  EXPECT_TRUE(optimizer->getActiveOptimizations().empty());
+  EXPECT_TRUE(scene->shadowsEnabled());
+  EXPECT_TRUE(scene->particlesEnabled);
+}
+
+TEST(TestSceneOptimizer, Preset_RevertsWhatCanBeReverted)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // Each of the first levels of the preset mixes optimizations that can and cannot be reverted
+  auto options                 = SceneOptimizerOptions::LowDegradationAllowed(50.f);
+  options.trackerDuration      = 0;
+  options.frameTimeSampleCount = 1;
+  auto optimizer               = SceneOptimizer::New(scene.get(), options);
+  size_t revertedCount         = 0;
+  optimizer->onOptimizationRevertedObservable.add(
+    [&](SceneOptimization*, EventState&) { ++revertedCount; });
+
+  optimizer->start();
+  for (unsigned int i = 0; i < 4; ++i) {
+    optimizer->sampleFrame(40.f);
+  }
+  EXPECT_EQ(optimizer->getActiveOptimizations().size(), 6u);
+  EXPECT_FALSE(scene->shadowsEnabled());
+  EXPECT_FALSE(scene->lensFlaresEnabled);
+  EXPECT_FALSE(scene->postProcessesEnabled);
+  EXPECT_FALSE(scene->particlesEnabled);
+
+  // The frame time recovers: the merged meshes and the resized textures stay
+  for (unsigned int i = 0; i < 4; ++i) {
+    optimizer->sampleFrame(5.f);
+  }
+  EXPECT_EQ(revertedCount, 4u);
+  EXPECT_EQ(optimizer->getActiveOptimizations().size(), 2u);
+  EXPECT_TRUE(scene->shadowsEnabled());
+  EXPECT_TRUE(scene->lensFlaresEnabled);
+  EXPECT_TRUE(scene->postProcessesEnabled);
+  EXPECT_TRUE(scene->particlesEnabled);
+  EXPECT_EQ(optimizer->currentPriorityLevel(), 0);
+
+  // Over budget again, only the reverted optimizations are applied again
+  optimizer->sampleFrame(40.f);
+  EXPECT_FALSE(scene->shadowsEnabled());
+  EXPECT_EQ(optimizer->getActiveOptimizations().size(), 4u);
+}
@@ -0,0 +1,134 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/builders/box_builder.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/morph/morph_target.h>
+#include <babylon/morph/morph_target_manager.h>
+#include <babylon/morph/sparse_morph_target_manager.h>
+
+TEST(TestSparseMorphTargetManager, Update_BlendsSparseDeltas)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+  BoxOptions options;
+  auto box        = BoxBuilder::CreateBox("box", options, scene.get());
+  box->isVisible  = false;
+  const auto base = box->getVerticesData(VertexBuffer::PositionKind);
+
+  auto manager = SparseMorphTargetManager::New(box);
+  auto first   = SparseMorphTarget::New("first", 0.5f);
+  first->setPositions({5, 1}, {0.f, 0.f, 1.f, 2.f, 0.f, 0.f});
+  auto second = SparseMorphTarget::New("second", 0.f);
+  second->setPositions({1}, {0.f, 4.f, 0.f});
+  manager->addTarget(first);
+  manager->addTarget(second);
+  EXPECT_EQ(first->positions.indices, IndicesArray({1, 5}));
+
+  // Only the vertices moved by the active target change, before the render
+  scene->render();
+  EXPECT_EQ(manager->numInfluencers(), 1u);
+  auto positions = box->getVerticesData(VertexBuffer::PositionKind);
+  EXPECT_FLOAT_EQ(positions[3], base[3] + 1.f);
+  EXPECT_FLOAT_EQ(positions[4], base[4]);
+  EXPECT_FLOAT_EQ(positions[17], base[17] + 0.5f);
+  EXPECT_FLOAT_EQ(positions[0], base[0]);
+  EXPECT_FALSE(manager->update());
+
+  // Influences are added up
+  second->influence = 0.25f;
+  EXPECT_TRUE(manager->update());
+  positions = box->getVerticesData(VertexBuffer::PositionKind);
+  EXPECT_FLOAT_EQ(positions[3], base[3] + 1.f);
+  EXPECT_FLOAT_EQ(positions[4], base[4] + 1.f);
+
+  // Without influence the mesh is back to its data
+  first->influence  = 0.f;
+  second->influence = 0.f;
+  EXPECT_TRUE(manager->update());
+  EXPECT_EQ(box->getVerticesData(VertexBuffer::PositionKind), base);
+}
+
+TEST(TestSparseMorphTargetManager, Update_KeepsSubMeshes)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions options;
+  auto box = BoxBuilder::CreateBox("box", options, scene.get());
+  box->subdivide(2);
+  const auto subMeshes = box->subMeshes;
+  ASSERT_EQ(subMeshes.size(), 2u);
+  EXPECT_FALSE(box->isVertexBufferUpdatable(VertexBuffer::PositionKind));
+
+  // A target without deltas does not update the mesh
+  auto manager = SparseMorphTargetManager::New(box);
+  auto empty   = SparseMorphTarget::New("empty", 1.f);
+  manager->addTarget(empty);
+  EXPECT_FALSE(manager->update());
+  EXPECT_FALSE(box->isVertexBufferUpdatable(VertexBuffer::PositionKind));
+
+  // The morphed buffer becomes updatable and the submeshes are kept
+  auto target = SparseMorphTarget::New("target", 1.f);
+  target->setPositions({2}, {0.f, 1.f, 0.f});
+  manager->addTarget(target);
+  EXPECT_TRUE(manager->update());
+  EXPECT_TRUE(box->isVertexBufferUpdatable(VertexBuffer::PositionKind));
+  EXPECT_FALSE(box->isVertexBufferUpdatable(VertexBuffer::NormalKind));
+  EXPECT_EQ(box->subMeshes, subMeshes);
+
+  target->influence = 0.5f;
+  EXPECT_TRUE(manager->update());
+  EXPECT_EQ(box->subMeshes, subMeshes);
+}
+
+TEST(TestSparseMorphTargetManager, FromMorphTargetManager_QuantizesDeltas)
+{
+  using namespace BABYLON;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions options;
+  auto box          = BoxBuilder::CreateBox("box", options, scene.get());
+  const auto base   = box->getVerticesData(VertexBuffer::PositionKind);
+  const auto normal = box->getVerticesData(VertexBuffer::NormalKind);
+
+  // A dense target moving a single vertex along with its normal
+  auto target    = MorphTarget::FromMesh(box, "target", 1.f);
+  auto positions = base;
+  positions[6 * 3 + 1] += 0.3f;
+  target->setPositions(positions);
+  auto normals = normal;
+  normals[6 * 3] += 0.1f;
+  target->setNormals(normals);
+  auto morphTargetManager = MorphTargetManager::New(scene.get());
+  morphTargetManager->addTarget(target);
+  box->morphTargetManager = morphTargetManager;
+
+  auto manager = SparseMorphTargetManager::FromMorphTargetManager(morphTargetManager, box, 1e-6f,
+                                                                  true);
+  EXPECT_EQ(box->morphTargetManager(), nullptr);
+  ASSERT_EQ(manager->numTargets(), 1u);
+  const auto& sparseTarget = *manager->getTarget(0);
+  EXPECT_EQ(sparseTarget.positions.indices, IndicesArray({6}));
+  EXPECT_TRUE(sparseTarget.positions.isQuantized());
+  EXPECT_EQ(sparseTarget.uvs.size(), 0u);
+  EXPECT_EQ(manager->getByteLength(), 2 * (sizeof(uint32_t) + 3 * sizeof(int16_t)));
+
+  EXPECT_TRUE(manager->update());
+  positions = box->getVerticesData(VertexBuffer::PositionKind);
+  EXPECT_NEAR(positions[6 * 3 + 1], base[6 * 3 + 1] + 0.3f, 1e-4f);
+  EXPECT_FLOAT_EQ(positions[6 * 3], base[6 * 3]);
+  EXPECT_NEAR(box->getVerticesData(VertexBuffer::NormalKind)[6 * 3], normal[6 * 3] + 0.1f, 1e-4f);
+
+  // Disposing restores the data of the mesh
+  manager->dispose();
+  EXPECT_EQ(box->getVerticesData(VertexBuffer::PositionKind), base);
+}
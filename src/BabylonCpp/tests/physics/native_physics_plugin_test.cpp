@@ -0,0 +1,360 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/box_builder.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/builders/sphere_builder.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/transform_node.h>
+#include <babylon/physics/iphysics_engine.h>
+#include <babylon/physics/physics_impostor.h>
+#include <babylon/physics/physics_impostor_parameters.h>
+#include <babylon/physics/physics_raycast_result.h>
+#include <babylon/physics/plugins/native/narrowphase.h>
+#include <babylon/physics/plugins/native_physics_plugin.h>
+
+namespace {
+
+constexpr float TimeStep = 1.f / 60.f;
+
+BABYLON::NativePhysics::BodyId createBox(BABYLON::NativePhysics::PhysicsWorld& world,
+                                         const BABYLON::NativePhysics::Vec3& position,
+                                         const BABYLON::NativePhysics::Vec3& halfExtents,
+                                         float mass)
+{
+  using namespace BABYLON::NativePhysics;
+  BodyDefinition definition;
+  definition.shape    = CollisionShape::CreateBox(halfExtents);
+  definition.position = position;
+  definition.mass     = mass;
+  definition.friction = 0.6f;
+  return world.createBody(definition);
+}
+
+// Ground box with its top at y = 0
+void createGround(BABYLON::Scene* scene)
+{
+  using namespace BABYLON;
+  BoxOptions options;
+  options.width        = 20.f;
+  options.height       = 1.f;
+  options.depth        = 20.f;
+  auto ground          = BoxBuilder::CreateBox("ground", options, scene);
+  ground->position().y = -0.5f;
+  PhysicsImpostorParameters parameters;
+  parameters.mass = 0.f;
+  ground->physicsImpostor = std::make_shared<PhysicsImpostor>(
+    ground.get(), PhysicsImpostor::BoxImpostor, parameters, scene);
+}
+
+BABYLON::MeshPtr createSphere(BABYLON::Scene* scene, const BABYLON::Vector3& position)
+{
+  using namespace BABYLON;
+  SphereOptions options;
+  options.diameter = 1.f;
+  options.segments = 4;
+  auto sphere      = SphereBuilder::CreateSphere("sphere", options, scene);
+  sphere->position().copyFrom(position);
+  PhysicsImpostorParameters parameters;
+  parameters.mass = 1.f;
+  sphere->physicsImpostor = std::make_shared<PhysicsImpostor>(
+    sphere.get(), PhysicsImpostor::SphereImpostor, parameters, scene);
+  return sphere;
+}
+
+// Pile of boxes forming one large island, next to separate small stacks
+std::vector<BABYLON::NativePhysics::Vec3> simulateScene(BABYLON::ThreadPool& threadPool)
+{
+  using namespace BABYLON::NativePhysics;
+  PhysicsWorld world;
+  world.setThreadPool(&threadPool);
+  createBox(world, {0.f, -0.5f, 0.f}, {50.f, 0.5f, 50.f}, 0.f);
+  std::vector<BodyId> bodies;
+  for (unsigned int i = 0; i < 100; ++i) {
+    const auto x = static_cast<float>(i % 10) * 1.01f - 5.f;
+    const auto y = 0.5f + static_cast<float>(i / 50) * 1.2f;
+    const auto z = static_cast<float>((i / 10) % 5) * 1.01f - 2.5f;
+    bodies.emplace_back(createBox(world, {x, y, z}, {0.5f, 0.5f, 0.5f}, 1.f));
+  }
+  for (unsigned int i = 0; i < 50; ++i) {
+    const auto x = static_cast<float>(i % 10) * 3.f - 15.f;
+    const auto z = static_cast<float>(i / 10) * 3.f + 10.f;
+    bodies.emplace_back(createBox(world, {x, 0.5f, z}, {0.5f, 0.5f, 0.5f}, 1.f));
+    bodies.emplace_back(createBox(world, {x + 0.1f, 1.6f, z}, {0.5f, 0.5f, 0.5f}, 1.f));
+  }
+
+  for (unsigned int i = 0; i < 60; ++i) {
+    world.step(TimeStep);
+  }
+
+  std::vector<Vec3> positions;
+  for (const auto id : bodies) {
+    positions.emplace_back(world.body(id).position);
+  }
+  return positions;
+}
+
+} // end of anonymous namespace
+
+TEST(TestNativePhysics, BoxResting_FourPointManifold)
+{
+  using namespace BABYLON::NativePhysics;
+  const auto ground = CollisionShape::CreateBox({5.f, 0.5f, 5.f});
+  const auto box    = CollisionShape::CreateBox({0.5f, 0.5f, 0.5f});
+  const Transform groundTransform{{0.f, -0.5f, 0.f}, {0.f, 0.f, 0.f, 1.f}};
+  const Transform boxTransform{{0.f, 0.49f, 0.f}, {0.f, 0.f, 0.f, 1.f}};
+
+  ContactManifold manifold;
+  Collide(ground, groundTransform, box, boxTransform, 0.02f, manifold);
+  EXPECT_EQ(manifold.pointCount, 4);
+  EXPECT_NEAR(manifold.normal.y, 1.f, 1e-4f);
+  for (int i = 0; i < manifold.pointCount; ++i) {
+    EXPECT_NEAR(manifold.points[i].depth, 0.01f, 1e-3f);
+  }
+}
+
+TEST(TestNativePhysics, BoxStack_StaysStableAndSleeps)
+{
+  using namespace BABYLON::NativePhysics;
+  PhysicsWorld world;
+  createBox(world, {0.f, -0.5f, 0.f}, {10.f, 0.5f, 10.f}, 0.f);
+  std::vector<BodyId> boxes;
+  for (unsigned int i = 0; i < 8; ++i) {
+    boxes.emplace_back(createBox(world, {0.f, 0.5f + i * 1.f, 0.f}, {0.5f, 0.5f, 0.5f}, 1.f));
+  }
+
+  for (unsigned int i = 0; i < 600; ++i) {
+    world.step(TimeStep);
+  }
+
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    const auto& body = world.body(boxes[i]);
+    EXPECT_NEAR(body.position.x, 0.f, 0.05f);
+    EXPECT_NEAR(body.position.y, 0.5f + i * 1.f, 0.1f);
+    EXPECT_NEAR(body.position.z, 0.f, 0.05f);
+  }
+  EXPECT_EQ(world.awakeBodyCount(), 0ull);
+}
+
+TEST(TestNativePhysics, HingeJoint_KeepsPivotAndAxis)
+{
+  using namespace BABYLON::NativePhysics;
+  PhysicsWorld world;
+  const auto anchor = createBox(world, {0.f, 0.f, 0.f}, {0.1f, 0.1f, 0.1f}, 0.f);
+  const auto arm    = createBox(world, {1.f, 0.f, 0.f}, {0.5f, 0.1f, 0.1f}, 1.f);
+  JointDefinition definition;
+  definition.type   = JointType::Hinge;
+  definition.bodyA  = anchor;
+  definition.bodyB  = arm;
+  definition.pivotB = {-1.f, 0.f, 0.f};
+  definition.axisA  = {0.f, 0.f, 1.f};
+  definition.axisB  = {0.f, 0.f, 1.f};
+  world.createJoint(definition);
+
+  for (unsigned int i = 0; i < 120; ++i) {
+    world.step(TimeStep);
+    const auto& body = world.body(arm);
+    const auto pivot = body.position + rotate(body.rotation, Vec3{-1.f, 0.f, 0.f});
+    EXPECT_LT(length(pivot), 0.02f);
+    EXPECT_NEAR(body.position.z, 0.f, 0.01f);
+  }
+  // The arm swung down
+  EXPECT_LT(world.body(arm).position.y, -0.5f);
+}
+
+TEST(TestNativePhysics, ParallelSolver_IsDeterministic)
+{
+  using namespace BABYLON;
+  ThreadPool singleThread{1};
+  ThreadPool fourThreads{4};
+  const auto reference = simulateScene(singleThread);
+  const auto parallel  = simulateScene(fourThreads);
+  const auto repeated  = simulateScene(fourThreads);
+
+  ASSERT_EQ(reference.size(), parallel.size());
+  for (size_t i = 0; i < reference.size(); ++i) {
+    // Bit identical whatever the number of threads
+    EXPECT_EQ(reference[i].x, parallel[i].x);
+    EXPECT_EQ(reference[i].y, parallel[i].y);
+    EXPECT_EQ(reference[i].z, parallel[i].z);
+    EXPECT_EQ(parallel[i].y, repeated[i].y);
+  }
+}
+
+TEST(TestNativePhysicsPlugin, SubTimeStep_FixedSteps)
+{
+  using namespace BABYLON;
+  NativePhysicsPlugin plugin;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->enablePhysics(Vector3(0.f, -10.f, 0.f), &plugin);
+  scene->getPhysicsEngine()->setSubTimeStep(5.f);
+  EXPECT_FLOAT_EQ(plugin.getTimeStep(), 0.005f);
+
+  NativePhysics::BodyDefinition definition;
+  definition.shape = NativePhysics::CollisionShape::CreateSphere(0.5f);
+  definition.mass  = 1.f;
+  const auto id    = plugin.physicsWorld().createBody(definition);
+  for (unsigned int i = 0; i < 20; ++i) {
+    scene->getPhysicsEngine()->_step(0.005f);
+  }
+  // One fixed step per engine step
+  const auto& body = plugin.physicsWorld().body(id);
+  EXPECT_NEAR(body.linearVelocity.y, -10.f * 20 * 0.005f, 1e-2f);
+}
+
+TEST(TestNativePhysicsPlugin, SphereFallsOnGround)
+{
+  using namespace BABYLON;
+  // The plugin outlives the physics engine of the scene
+  NativePhysicsPlugin plugin;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->enablePhysics(Vector3(0.f, -9.81f, 0.f), &plugin);
+
+  BoxOptions groundOptions;
+  groundOptions.width  = 10.f;
+  groundOptions.height = 1.f;
+  groundOptions.depth  = 10.f;
+  auto ground          = BoxBuilder::CreateBox("ground", groundOptions, scene.get());
+  ground->position().y = -0.5f;
+  PhysicsImpostorParameters groundParameters;
+  groundParameters.mass = 0.f;
+  ground->physicsImpostor
+    = std::make_shared<PhysicsImpostor>(ground.get(), PhysicsImpostor::BoxImpostor,
+                                        groundParameters, scene.get());
+
+  SphereOptions sphereOptions;
+  sphereOptions.diameter = 1.f;
+  auto sphere            = SphereBuilder::CreateSphere("sphere", sphereOptions, scene.get());
+  sphere->position().y   = 3.f;
+  PhysicsImpostorParameters sphereParameters;
+  sphereParameters.mass = 1.f;
+  sphere->physicsImpostor
+    = std::make_shared<PhysicsImpostor>(sphere.get(), PhysicsImpostor::SphereImpostor,
+                                        sphereParameters, scene.get());
+  EXPECT_NE(plugin.getBodyId(*sphere->physicsImpostor()), NativePhysics::InvalidId);
+
+  for (unsigned int i = 0; i < 240; ++i) {
+    scene->getPhysicsEngine()->_step(TimeStep);
+  }
+  EXPECT_NEAR(sphere->position().y, 0.5f, 0.05f);
+  EXPECT_NEAR(sphere->position().x, 0.f, 1e-3f);
+
+  // Ray cast from above the sphere
+  auto result
+    = scene->getPhysicsEngine()->raycast(Vector3(0.f, 5.f, 0.f), Vector3(0.f, -5.f, 0.f));
+  EXPECT_TRUE(result.hasHit());
+  EXPECT_NEAR(result.hitPointWorld().y, 1.f, 0.06f);
+  EXPECT_NEAR(result.hitNormalWorld().y, 1.f, 1e-3f);
+
+  // Ray cast missing both bodies
+  auto miss
+    = scene->getPhysicsEngine()->raycast(Vector3(20.f, 5.f, 0.f), Vector3(20.f, -5.f, 0.f));
+  EXPECT_FALSE(miss.hasHit());
+}
+
+TEST(TestNativePhysicsPlugin, BulkSync_SkipsRestingObjects)
+{
+  using namespace BABYLON;
+  NativePhysicsPlugin plugin;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->enablePhysics(Vector3(0.f, -9.81f, 0.f), &plugin);
+  createGround(scene.get());
+  auto sphere = createSphere(scene.get(), Vector3(0.f, 2.f, 0.f));
+  EXPECT_TRUE(sphere->physicsImpostor()->_canSyncTransformationInBulk());
+
+  auto& physicsEngine = *scene->getPhysicsEngine();
+  for (unsigned int i = 0; i < 300; ++i) {
+    physicsEngine._step(TimeStep);
+  }
+  const auto id = plugin.getBodyId(*sphere->physicsImpostor());
+  EXPECT_TRUE(plugin.physicsWorld().body(id).sleeping);
+  EXPECT_NEAR(sphere->position().y, 0.5f, 0.05f);
+
+  // The resting object is not touched, its world matrix stays cached
+  sphere->computeWorldMatrix(true);
+  physicsEngine._step(TimeStep);
+  EXPECT_TRUE(sphere->isSynchronized());
+
+  // Moving the object teleports and wakes up the body
+  sphere->position().y = 3.f;
+  physicsEngine._step(TimeStep);
+  EXPECT_FALSE(plugin.physicsWorld().body(id).sleeping);
+  EXPECT_LT(sphere->position().y, 3.f);
+  EXPECT_GT(sphere->position().y, 2.9f);
+  EXPECT_FALSE(sphere->isSynchronized());
+}
+
+TEST(TestNativePhysicsPlugin, BulkSync_ReadsBackBodiesSleepingInEarlierSubSteps)
+{
+  using namespace BABYLON;
+  // A drifting body falls asleep after 30 steps, the frames of 3 sub-steps are offset so that it
+  // falls asleep in each of the sub-steps
+  for (unsigned int offset = 0; offset < 3; ++offset) {
+    NativePhysicsPlugin plugin;
+    auto engine = createSubject();
+    auto scene  = Scene::New(engine.get());
+    scene->enablePhysics(Vector3(0.f, 0.f, 0.f), &plugin);
+    auto sphere = createSphere(scene.get(), Vector3(0.f, 2.f, 0.f));
+    sphere->physicsImpostor()->setLinearVelocity(Vector3(0.04f, 0.f, 0.f));
+    const auto id = plugin.getBodyId(*sphere->physicsImpostor());
+
+    auto& physicsEngine = *scene->getPhysicsEngine();
+    for (unsigned int i = 0; i < offset; ++i) {
+      physicsEngine._step(TimeStep);
+    }
+    const auto& body = plugin.physicsWorld().body(id);
+    for (unsigned int i = 0; i < 20 && !body.sleeping; ++i) {
+      physicsEngine._step(3.f * TimeStep);
+      EXPECT_FLOAT_EQ(sphere->position().x, body.position.x);
+    }
+    EXPECT_TRUE(body.sleeping);
+    EXPECT_GT(sphere->position().x, 0.015f);
+    EXPECT_FLOAT_EQ(sphere->position().x, body.position.x);
+  }
+}
+
+TEST(TestNativePhysicsPlugin, ParentedImpostor_FallsInWorldSpace)
+{
+  using namespace BABYLON;
+  NativePhysicsPlugin plugin;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->enablePhysics(Vector3(0.f, -9.81f, 0.f), &plugin);
+  createGround(scene.get());
+
+  // Parent translated and rotated by a quarter turn around the vertical axis
+  auto parent = TransformNode::New("parent", scene.get());
+  parent->position().set(2.f, 1.f, 0.f);
+  parent->rotation().y = Math::PI_2;
+  parent->computeWorldMatrix(true);
+  SphereOptions options;
+  options.diameter = 1.f;
+  options.segments = 4;
+  auto sphere      = SphereBuilder::CreateSphere("sphere", options, scene.get());
+  sphere->setParent(parent.get());
+  sphere->position().set(1.f, 2.f, 0.f);
+  sphere->computeWorldMatrix(true);
+  const auto start = sphere->getAbsolutePosition();
+  PhysicsImpostorParameters parameters;
+  parameters.mass         = 1.f;
+  parameters.ignoreParent = true;
+  sphere->physicsImpostor = std::make_shared<PhysicsImpostor>(
+    sphere.get(), PhysicsImpostor::SphereImpostor, parameters, scene.get());
+  EXPECT_FALSE(sphere->physicsImpostor()->_canSyncTransformationInBulk());
+
+  for (unsigned int i = 0; i < 240; ++i) {
+    scene->getPhysicsEngine()->_step(TimeStep);
+  }
+  sphere->computeWorldMatrix(true);
+  const auto end = sphere->getAbsolutePosition();
+  EXPECT_NEAR(end.x, start.x, 1e-2f);
+  EXPECT_NEAR(end.y, 0.5f, 0.05f);
+  EXPECT_NEAR(end.z, start.z, 1e-2f);
+}
@@ -0,0 +1,134 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/builders/sphere_builder.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/physics/helper/physics_affected_impostor_with_data.h>
+#include <babylon/physics/helper/physics_helper.h>
+#include <babylon/physics/helper/physics_radial_explosion_event.h>
+#include <babylon/physics/helper/physics_updraft_event.h>
+#include <babylon/physics/iphysics_engine.h>
+#include <babylon/physics/physics_impostor.h>
+#include <babylon/physics/physics_impostor_parameters.h>
+#include <babylon/physics/plugins/native_physics_plugin.h>
+
+namespace {
+
+BABYLON::MeshPtr createSphere(BABYLON::Scene* scene, const BABYLON::Vector3& position,
+                              float mass)
+{
+  using namespace BABYLON;
+  SphereOptions options;
+  options.diameter = 1.f;
+  options.segments = 4;
+  auto sphere      = SphereBuilder::CreateSphere("sphere", options, scene);
+  sphere->position().copyFrom(position);
+  sphere->computeWorldMatrix(true);
+  PhysicsImpostorParameters parameters;
+  parameters.mass = mass;
+  sphere->physicsImpostor = std::make_shared<PhysicsImpostor>(
+    sphere.get(), PhysicsImpostor::SphereImpostor, parameters, scene);
+  return sphere;
+}
+
+} // end of anonymous namespace
+
+TEST(TestPhysicsHelper, RadialExplosionImpulse_PushesImpostorsInRadius)
+{
+  using namespace BABYLON;
+  NativePhysicsPlugin plugin;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->enablePhysics(Vector3::Zero(), &plugin);
+
+  // The static impostor does not stop the explosion
+  auto staticSphere = createSphere(scene.get(), Vector3(0.f, 0.f, 1.f), 0.f);
+  auto nearSphere   = createSphere(scene.get(), Vector3(2.f, 0.f, 0.f), 1.f);
+  auto otherSphere  = createSphere(scene.get(), Vector3(-3.f, 0.f, 0.f), 1.f);
+  auto farSphere    = createSphere(scene.get(), Vector3(8.f, 0.f, 0.f), 1.f);
+
+  PhysicsHelper physicsHelper{scene.get()};
+  size_t affectedImpostorCount = 0;
+  PhysicsRadialExplosionEventOptions options;
+  options.radius   = 5.f;
+  options.strength = 10.f;
+  options.affectedImpostorsCallback
+    = [&](const std::vector<PhysicsAffectedImpostorWithData>& affectedImpostorsWithData) {
+        affectedImpostorCount = affectedImpostorsWithData.size();
+      };
+  PhysicsHelper::RadiusOrPhysicsRadialExplosionEventOptions radiusOrEventOptions = options;
+  auto event = physicsHelper.applyRadialExplosionImpulse(Vector3::Zero(), radiusOrEventOptions);
+  ASSERT_NE(event, nullptr);
+  EXPECT_EQ(affectedImpostorCount, 2u);
+
+  // Impulses change the velocities right away
+  EXPECT_GT(plugin.getLinearVelocity(*nearSphere->physicsImpostor()).x, 0.f);
+  EXPECT_LT(plugin.getLinearVelocity(*otherSphere->physicsImpostor()).x, 0.f);
+  EXPECT_FLOAT_EQ(plugin.getLinearVelocity(*farSphere->physicsImpostor()).x, 0.f);
+  EXPECT_FLOAT_EQ(plugin.getLinearVelocity(*staticSphere->physicsImpostor()).length(), 0.f);
+}
+
+TEST(TestPhysicsHelper, Updraft_LiftsImpostorsInCylinder)
+{
+  using namespace BABYLON;
+  NativePhysicsPlugin plugin;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->enablePhysics(Vector3::Zero(), &plugin);
+  auto insideSphere  = createSphere(scene.get(), Vector3(0.5f, 2.f, 0.f), 1.f);
+  auto outsideSphere = createSphere(scene.get(), Vector3(6.f, 2.f, 0.f), 1.f);
+
+  PhysicsHelper physicsHelper{scene.get()};
+  PhysicsUpdraftEventOptions options;
+  options.radius      = 2.f;
+  options.height      = 5.f;
+  options.strength    = 10.f;
+  options.updraftMode = PhysicsUpdraftMode::Perpendicular;
+  PhysicsHelper::RadiusOrPhysicsUpdraftEventOptions radiusOrEventOptions = options;
+  auto event = physicsHelper.updraft(Vector3::Zero(), radiusOrEventOptions);
+  ASSERT_NE(event, nullptr);
+  event->enable();
+  event->disable();
+  scene->getPhysicsEngine()->_step(1.f / 60.f);
+
+  EXPECT_GT(plugin.getLinearVelocity(*insideSphere->physicsImpostor()).y, 0.f);
+  EXPECT_FLOAT_EQ(plugin.getLinearVelocity(*outsideSphere->physicsImpostor()).y, 0.f);
+}
+
+TEST(TestPhysicsHelper, ImpostorLookups_FollowAddAndRemove)
+{
+  using namespace BABYLON;
+  NativePhysicsPlugin plugin;
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  scene->enablePhysics(Vector3::Zero(), &plugin);
+  auto sphere      = createSphere(scene.get(), Vector3(0.f, 0.f, 0.f), 1.f);
+  auto otherSphere = createSphere(scene.get(), Vector3(3.f, 0.f, 0.f), 1.f);
+
+  auto& physicsEngine = *scene->getPhysicsEngine();
+  auto impostor       = sphere->physicsImpostor().get();
+  auto body           = impostor->physicsBody();
+  EXPECT_EQ(physicsEngine.getImpostorForPhysicsObject(sphere.get()), impostor);
+  EXPECT_EQ(physicsEngine.getImpostorWithPhysicsBody(body), impostor);
+  EXPECT_EQ(physicsEngine.getImpostorWithPhysicsBody(otherSphere->physicsImpostor()->physicsBody()),
+            otherSphere->physicsImpostor().get());
+
+  // Only the impostors around the box are candidates
+  std::vector<PhysicsImpostorPtr> impostors;
+  physicsEngine.getImpostorsInBox(Vector3(2.f, -1.f, -1.f), Vector3(4.f, 1.f, 1.f), impostors);
+  ASSERT_EQ(impostors.size(), 1u);
+  EXPECT_EQ(impostors[0].get(), otherSphere->physicsImpostor().get());
+  physicsEngine.getImpostorsInBox(Vector3(-1.f, -1.f, -1.f), Vector3(4.f, 1.f, 1.f), impostors);
+  ASSERT_EQ(impostors.size(), 2u);
+  EXPECT_EQ(impostors[0].get(), impostor);
+
+  impostor->dispose();
+  EXPECT_EQ(physicsEngine.getImpostorForPhysicsObject(sphere.get()), nullptr);
+  EXPECT_EQ(physicsEngine.getImpostorWithPhysicsBody(body), nullptr);
+  EXPECT_EQ(physicsEngine.getImpostorForPhysicsObject(otherSphere.get()),
+            otherSphere->physicsImpostor().get());
+}
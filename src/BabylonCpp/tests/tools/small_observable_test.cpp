@@ -0,0 +1,153 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/misc/observable.h>
+#include <babylon/misc/small_observable.h>
+
+namespace {
+
+struct Counter {
+  int value = 0;
+};
+
+} // end of anonymous namespace
+
+TEST(TestSmallObservable, addRemoveNotify)
+{
+  using namespace BABYLON;
+
+  Counter counter;
+  SmallObservable<Counter, 2> observable;
+  EXPECT_FALSE(observable.hasObservers());
+  EXPECT_TRUE(observable.notifyObservers(&counter));
+
+  // More observers than the inline capacity
+  std::vector<ObserverHandle> handles;
+  for (int i = 0; i < 5; ++i) {
+    handles.emplace_back(
+      observable.add([](Counter* eventData, EventState& /*es*/) { ++eventData->value; }));
+  }
+  EXPECT_EQ(observable.observerCount(), 5ull);
+  observable.notifyObservers(&counter);
+  EXPECT_EQ(counter.value, 5);
+
+  EXPECT_TRUE(observable.remove(handles[1]));
+  EXPECT_FALSE(observable.remove(handles[1]));
+  observable.notifyObservers(&counter);
+  EXPECT_EQ(counter.value, 9);
+
+  // Recycled slots do not revive stale handles
+  auto handle = observable.add([](Counter* eventData, EventState& /*es*/) { ++eventData->value; });
+  EXPECT_EQ(handle.index, handles[1].index);
+  EXPECT_FALSE(observable.remove(handles[1]));
+  EXPECT_TRUE(observable.remove(handle));
+
+  observable.clear();
+  EXPECT_FALSE(observable.hasObservers());
+}
+
+TEST(TestSmallObservable, notificationOrderAndMasks)
+{
+  using namespace BABYLON;
+
+  std::vector<int> calls;
+  SmallObservable<Counter> observable;
+  observable.add([&calls](Counter*, EventState&) { calls.emplace_back(1); }, 0x01);
+  observable.add([&calls](Counter*, EventState&) { calls.emplace_back(2); }, 0x02);
+  observable.add([&calls](Counter*, EventState&) { calls.emplace_back(0); }, -1, true);
+
+  observable.notifyObservers(nullptr, 0x01);
+  EXPECT_THAT(calls, ::testing::ElementsAre(0, 1));
+  calls.clear();
+  observable.notifyObservers(nullptr, 0x02);
+  EXPECT_THAT(calls, ::testing::ElementsAre(0, 2));
+}
+
+TEST(TestSmallObservable, removeDuringNotification)
+{
+  using namespace BABYLON;
+
+  Counter counter;
+  SmallObservable<Counter> observable;
+  ObserverHandle second;
+  observable.addOnce([](Counter* eventData, EventState&) { ++eventData->value; });
+  observable.add([&observable, &second](Counter* eventData, EventState&) {
+    ++eventData->value;
+    observable.remove(second);
+  });
+  second = observable.add([](Counter* eventData, EventState&) { eventData->value += 100; });
+
+  observable.notifyObservers(&counter);
+  EXPECT_EQ(counter.value, 2);
+  EXPECT_EQ(observable.observerCount(), 1ull);
+  observable.notifyObservers(&counter);
+  EXPECT_EQ(counter.value, 3);
+}
+
+TEST(TestSmallObservable, sharedPointerCompatibility)
+{
+  using namespace BABYLON;
+
+  Counter counter;
+  SmallObservable<Counter> observable;
+  Observer<Counter>::Ptr observer
+    = observable.add([](Counter* eventData, EventState&) { ++eventData->value; });
+  EXPECT_TRUE(observer != nullptr);
+  observable.notifyObservers(&counter);
+  EXPECT_EQ(counter.value, 1);
+  EXPECT_TRUE(observable.remove(observer));
+  EXPECT_FALSE(observable.hasObservers());
+}
+
+TEST(TestSmallObservable, removeChecksTheOwner)
+{
+  using namespace BABYLON;
+
+  // Both observers use the first slot of their observable, with the same generation
+  SmallObservable<Counter> observable1;
+  SmallObservable<Counter> observable2;
+  auto handle1 = observable1.add([](Counter* eventData, EventState&) { ++eventData->value; });
+  auto handle2 = observable2.add([](Counter* eventData, EventState&) { ++eventData->value; });
+  ASSERT_EQ(handle1.pack(), handle2.pack());
+
+  Observer<Counter>::Ptr observer1 = handle1;
+  EXPECT_FALSE(observable2.remove(observer1));
+  EXPECT_FALSE(observable2.remove(handle1));
+  EXPECT_TRUE(observable2.hasObservers());
+
+  // Observers of a regular Observable are not proxies
+  Observable<Counter> regularObservable;
+  auto regularObserver = regularObservable.add([](Counter*, EventState&) {});
+  EXPECT_FALSE(observable2.remove(regularObserver));
+  EXPECT_TRUE(observable2.hasObservers());
+
+  EXPECT_TRUE(observable1.remove(observer1));
+  EXPECT_FALSE(observable1.hasObservers());
+  EXPECT_TRUE(observable2.remove(handle2));
+  EXPECT_FALSE(observable2.hasObservers());
+}
+
+TEST(TestSmallObservable, insertFirstDuringNotification)
+{
+  using namespace BABYLON;
+
+  std::vector<int> calls;
+  bool inserted = false;
+  SmallObservable<Counter> observable;
+  observable.add([&calls](Counter*, EventState&) { calls.emplace_back(1); });
+  observable.add([&calls, &inserted, &observable](Counter*, EventState&) {
+    calls.emplace_back(2);
+    if (!inserted) {
+      inserted = true;
+      observable.add([&calls](Counter*, EventState&) { calls.emplace_back(0); }, -1, true);
+    }
+  });
+  observable.add([&calls](Counter*, EventState&) { calls.emplace_back(3); });
+
+  // The observer inserted first is called from the next notification
+  observable.notifyObservers(nullptr);
+  EXPECT_THAT(calls, ::testing::ElementsAre(1, 2, 3));
+  calls.clear();
+  observable.notifyObservers(nullptr);
+  EXPECT_THAT(calls, ::testing::ElementsAre(0, 1, 2, 3));
+}
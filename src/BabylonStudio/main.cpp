@@ -27,6 +27,7 @@ int main(int argc, char** argv)
   bool flagAsync = false;
   bool flagSpawnScreenshots = false;
   bool flagScreenshotOneSampleAndExit = false;
+  std::size_t nbJobs = 0;
   std::string sampleName;
   {
     CLI::App arg_cli{ "BabylonCpp samples runner" };
@@ -37,6 +38,7 @@ int main(int argc, char** argv)
 
     arg_cli.add_flag("-a,--shot-all-samples", flagSpawnScreenshots, "run all samples and save a screenshot");
     arg_cli.add_flag("-p,--shot-one-sample", flagScreenshotOneSampleAndExit, "run one sample, save a screenshot and exit");
+    arg_cli.add_option("-j,--jobs", nbJobs, "number of samples run concurrently by --shot-all-samples (0 = number of cores)");
     CLI11_PARSE(arg_cli, argc, argv);
   }
 
@@ -49,7 +51,7 @@ int main(int argc, char** argv)
   }
 
   if (flagSpawnScreenshots) {
-    BABYLON::impl::spawnScreenshots(argv[0], flagAsync);
+    BABYLON::impl::spawnScreenshots(argv[0], flagAsync, nbJobs);
     exit(0);
   }
 
@@ -1,6 +1,13 @@
 #include <babylon/core/logging.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <string>
+#include <thread>
+#include <babylon/core/timer.h>
 #include <babylon/core/filesystem.h>
 #include <babylon/babylon_imgui/babylon_studio.h>
 #include <babylon/samples/sample_spawn.h>
@@ -16,9 +23,42 @@ namespace BABYLON {
 namespace impl {
 using namespace BABYLON::SamplesInfo;
 
-SampleAutoRunInfo runOneSample(const std::string & exeName, const std::string &sampleName, bool flagAsync)
+struct SampleRunReport {
+  SampleAutoRunInfo runInfo;
+  Samples::SpawnResult spawnResult;
+  std::optional<double> screenshotSimilarity;
+  bool screenshotUpdated = false;
+  // Set when running the job itself threw (as opposed to the sample process failing)
+  std::optional<std::string> jobError;
+};
+
+// Compares the new screenshot with its version committed in git, and restores the committed
+// version if they are similar (this helps creating commits that contain only the relevant
+// screenshot modifications). The reference is never the file on disk, which may have been
+// overwritten by a previous run, so that small differences cannot drift from run to run.
+void compareScreenshot(const std::string &sampleName, SampleRunReport &report)
 {
-  SampleAutoRunInfo sampleRunInfo;
+  std::string screenshotFile = SampleScreenshotFile_Absolute(sampleName);
+  auto committedScreenshot = Samples::ReadCommittedFileBytes(screenshotFile);
+  if (committedScreenshot.empty()) {
+    report.screenshotUpdated = true;
+    return;
+  }
+  report.screenshotSimilarity = Samples::ComputeImageSimilarity(committedScreenshot, screenshotFile);
+  if (report.screenshotSimilarity
+      && (*report.screenshotSimilarity >= Samples::ScreenshotSimilarityThreshold))
+    Samples::WriteFileBytes(screenshotFile, committedScreenshot);
+  else {
+    BABYLON_LOG_INFO("ScreenshotAllSamples", sampleName, " has new version, similarity_score=",
+                     report.screenshotSimilarity.value_or(0.));
+    report.screenshotUpdated = true;
+  }
+}
+
+SampleRunReport runOneSample(const std::string & exeName, const std::string &sampleName, bool flagAsync)
+{
+  SampleRunReport report;
+  SampleAutoRunInfo& sampleRunInfo = report.runInfo;
 
   std::vector<std::string> command = {exeName, "-s", sampleName, "-p"};
   if (flagAsync)
@@ -27,7 +67,8 @@ SampleAutoRunInfo runOneSample(const std::string & exeName, const std::string &s
   Samples::SpawnOptions spawnOptions;
   spawnOptions.MaxExecutionTimeSeconds       = 15.;
   spawnOptions.CopyOutputToMainProgramOutput = false;
-  auto spawnResult                           = SpawnWaitSubProcess(command, spawnOptions);
+  report.spawnResult                         = SpawnWaitSubProcess(command, spawnOptions);
+  const auto& spawnResult                    = report.spawnResult;
 
   if (spawnResult.ExitStatus != 0) {
     BABYLON_LOG_WARN("ScreenshotAllSamples", "Subprocess has failed for sample ", sampleName);
@@ -51,32 +92,53 @@ SampleAutoRunInfo runOneSample(const std::string & exeName, const std::string &s
       sampleRunInfo.sampleRunStatus = SampleAutoRunStatus::success;
     }
   }
-  return sampleRunInfo;
+
+  if (!spawnResult.MaxExecutionTimePassed)
+    compareScreenshot(sampleName, report);
+  return report;
 }
 
 
-void run_compare_screenshots_git()
+void saveRunReport(const std::vector<SampleData> &allSamples,
+                   const std::vector<SampleRunReport> &reports,
+                   std::size_t nbJobs,
+                   double totalElapsedSeconds)
 {
-  BABYLON_LOG_INFO("spawnScreenshots ", "Running compare_screenshots_git.py ...");
-  std::vector<std::string> command = {
-    "python3",
-    babylon_repo_folder() + "/codegeneration/compare_screenshots_git.py"
-  };
-  Samples::SpawnOptions spawnOptions;
-  spawnOptions.CopyOutputToMainProgramOutput = true;
-  spawnOptions.MixStdOutStdErr = true;
-  auto spawnResult = SpawnWaitSubProcess(command, spawnOptions);
-  if (spawnResult.ExitStatus != 0)
+  nlohmann::json samplesJson = nlohmann::json::array();
+  for (size_t i = 0; i < allSamples.size(); ++i)
   {
-    std::string msg = "Error while running compare_screenshots_git.py!";
-    BABYLON_LOG_ERROR("spawnScreenshots", msg.c_str());
-    throw std::runtime_error(msg.c_str());
+    const auto& report = reports[i];
+    nlohmann::json sampleJson;
+    sampleJson["category"] = allSamples[i].categoryName;
+    sampleJson["sample"] = allSamples[i].sampleName;
+    sampleJson["status"] = report.runInfo.sampleRunStatus;
+    sampleJson["exitStatus"] = report.spawnResult.ExitStatus;
+    sampleJson["timedOut"] = report.spawnResult.MaxExecutionTimePassed;
+    sampleJson["wallTimeSeconds"] = report.spawnResult.ElapsedSeconds;
+    if (report.screenshotSimilarity)
+      sampleJson["screenshotSimilarity"] = *report.screenshotSimilarity;
+    else
+      sampleJson["screenshotSimilarity"] = nullptr;
+    sampleJson["screenshotUpdated"] = report.screenshotUpdated;
+    if (report.jobError)
+      sampleJson["jobError"] = *report.jobError;
+    else
+      sampleJson["jobError"] = nullptr;
+    samplesJson.push_back(sampleJson);
   }
-  BABYLON_LOG_INFO("spawnScreenshots ", "compare_screenshots_git.py ended successfully");
+
+  nlohmann::json j;
+  j["jobs"] = nbJobs;
+  j["totalWallTimeSeconds"] = totalElapsedSeconds;
+  j["samples"] = samplesJson;
+
+  std::ofstream ofs(assets_folder() + screenshotsDirectory_RelativeToAssets() + "/aa_runReport.json");
+  ofs << std::setw(4) << j << std::endl;
+  ofs.close();
 }
 
 
-void spawnScreenshots(const std::string & exeName, bool flagAsync)
+void spawnScreenshots(const std::string & exeName, bool flagAsync, std::size_t nbJobs)
 {
 
 #ifdef _WIN32
@@ -84,19 +146,62 @@ void spawnScreenshots(const std::string & exeName, bool flagAsync)
   return;
 #endif
 
+  if (nbJobs == 0)
+    nbJobs = std::max(std::thread::hardware_concurrency(), 1u);
+
   auto &samplesCollection = SamplesCollection::Instance();
   const auto &allSamples = samplesCollection.AllSamples();
-  for (size_t i = 0; i < allSamples.size(); ++i)
-  {
-    const auto& sampleData = allSamples[i];
-    BABYLON_LOG_INFO("spawnScreenshots ", i+1, "/", allSamples.size(), ": ", sampleData.categoryName, "/", sampleData.sampleName);
-    auto sampleRunInfo = runOneSample(exeName, sampleData.sampleName, flagAsync);
-    samplesCollection.SetSampleRunInfo(sampleData.sampleName, sampleRunInfo);
-//    if (i >= 5)
-//      break;
+  std::vector<SampleRunReport> reports(allSamples.size());
+
+  Timer timer;
+  timer.start();
+
+  // Each worker picks the next sample not yet run: the samples run concurrently in
+  // separate processes, each one with its own timeout and screenshot file. A job that throws
+  // is recorded as failed instead of escaping the worker thread (which would terminate the
+  // program), and the other jobs keep running.
+  std::atomic<size_t> nextSampleIndex = 0;
+  auto worker = [&]() {
+    for (size_t i = nextSampleIndex++; i < allSamples.size(); i = nextSampleIndex++)
+    {
+      const auto& sampleData = allSamples[i];
+      BABYLON_LOG_INFO("spawnScreenshots ", i+1, "/", allSamples.size(), ": ", sampleData.categoryName, "/", sampleData.sampleName);
+      try {
+        reports[i] = runOneSample(exeName, sampleData.sampleName, flagAsync);
+      }
+      catch (const std::exception& e) {
+        reports[i].jobError = e.what();
+      }
+      catch (...) {
+        reports[i].jobError = "unknown exception";
+      }
+      if (reports[i].jobError) {
+        reports[i].runInfo.sampleRunStatus              = SampleAutoRunStatus::unhandledException;
+        reports[i].runInfo.unhandledExceptionStackTrace = *reports[i].jobError;
+      }
+    }
+  };
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < std::min(nbJobs, allSamples.size()); ++i)
+    workers.emplace_back(worker);
+  for (auto& workerThread : workers)
+    workerThread.join();
+
+  std::size_t nbFailedJobs = 0;
+  for (size_t i = 0; i < allSamples.size(); ++i) {
+    if (reports[i].jobError) {
+      BABYLON_LOG_ERROR("spawnScreenshots", "Job failed for sample ", allSamples[i].categoryName,
+                        "/", allSamples[i].sampleName, ": ", *reports[i].jobError);
+      ++nbFailedJobs;
+    }
   }
+  if (nbFailedJobs > 0)
+    BABYLON_LOG_ERROR("spawnScreenshots", nbFailedJobs, " job(s) failed");
+
+  for (size_t i = 0; i < allSamples.size(); ++i)
+    samplesCollection.SetSampleRunInfo(allSamples[i].sampleName, reports[i].runInfo);
   samplesCollection.SaveAllSamplesRunStatuses();
-  run_compare_screenshots_git();
+  saveRunReport(allSamples, reports, nbJobs, timer.getElapsedTimeInSec());
   BABYLON::asio::Service_Stop();
   BABYLON_LOG_INFO("spawnScreenshots", "End, stats:", samplesCollection.GetSampleStatsString().c_str());
 }
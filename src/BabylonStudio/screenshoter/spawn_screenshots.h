@@ -1,9 +1,11 @@
+#include <cstddef>
 #include <string>
 
 namespace BABYLON {
 namespace impl {
 // this implementation will spawn a new process for each sample
 // (so that failing samples will not stop the screenshot generation)
-void spawnScreenshots(const std::string & exeName, bool flagAsync);
+// nbJobs samples are run concurrently (0 = number of hardware threads)
+void spawnScreenshots(const std::string & exeName, bool flagAsync, std::size_t nbJobs = 0);
 } // namespace impl
 } // namespace BABYLON
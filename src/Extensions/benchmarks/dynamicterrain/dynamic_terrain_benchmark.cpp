@@ -0,0 +1,107 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/extensions/dynamicterrain/dynamic_terrain.h>
+#include <babylon/extensions/dynamicterrain/dynamic_terrain_options.h>
+
+namespace {
+
+using namespace BABYLON;
+using namespace BABYLON::Extensions;
+
+using ns = uint64_t;
+
+template <typename F>
+ns measure(F&& f)
+{
+  const auto before = std::chrono::high_resolution_clock::now();
+  f();
+  const auto after = std::chrono::high_resolution_clock::now();
+  return static_cast<ns>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+}
+
+// Hilly map of size x size points, one unit apart, centered on the origin
+Float32Array createMap(unsigned int size)
+{
+  Float32Array mapData(size * size * 3);
+  const float half = static_cast<float>(size) * 0.5f;
+  for (unsigned int j = 0; j < size; ++j) {
+    for (unsigned int i = 0; i < size; ++i) {
+      const auto x       = static_cast<float>(i) - half;
+      const auto z       = static_cast<float>(j) - half;
+      const auto index   = 3 * (j * size + i);
+      mapData[index]     = x;
+      mapData[index + 1] = 20.f * std::sin(x * 0.01f) * std::cos(z * 0.013f)
+                           + 2.f * std::sin(x * 0.1f + z * 0.07f);
+      mapData[index + 2] = z;
+    }
+  }
+  return mapData;
+}
+
+// Moves the camera one map subdivision per frame and updates the terrain
+ns flyOver(DynamicTerrain& terrain, FreeCamera& camera, size_t frameCount)
+{
+  return measure([&]() {
+    for (size_t frame = 0; frame < frameCount; ++frame) {
+      camera.position().x += 1.f;
+      camera.position().z += 0.5f;
+      camera.getViewMatrix(true);
+      terrain.update(terrain.refreshEveryFrame());
+    }
+  });
+}
+
+void compare(unsigned int mapSize, unsigned int terrainSub, size_t frameCount)
+{
+  auto engine = NullEngine::New();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 50.f, 0.f), scene.get());
+
+  DynamicTerrainOptions options;
+  options.mapData    = createMap(mapSize);
+  options.mapSubX    = static_cast<int>(mapSize);
+  options.mapSubZ    = static_cast<int>(mapSize);
+  options.terrainSub = static_cast<int>(terrainSub);
+  options.camera     = camera;
+
+  Float32Array mapNormals;
+  const auto mapNormalsTime = measure([&]() {
+    DynamicTerrain::ComputeNormalsFromMapToRef(options.mapData, mapSize, mapSize, mapNormals);
+  });
+  options.mapNormals = mapNormals;
+
+  DynamicTerrain terrain("terrain", options, scene.get());
+
+  // Each camera move shifts the map window by one subdivision: only the new
+  // border strips are updated
+  const auto stripTime = flyOver(terrain, *camera, frameCount);
+
+  // The whole ribbon is recomputed on each frame
+  terrain.setRefreshEveryFrame(true);
+  const auto fullTime = flyOver(terrain, *camera, frameCount);
+
+  std::cout << "map " << mapSize << "x" << mapSize << ", terrain " << terrainSub << "x"
+            << terrainSub << ", " << frameCount << " frames" << std::endl
+            << "  map normals:    " << mapNormalsTime / 1000000 << " ms" << std::endl
+            << "  strip updates:  " << stripTime / frameCount / 1000 << " us per frame"
+            << std::endl
+            << "  full updates:   " << fullTime / frameCount / 1000 << " us per frame"
+            << std::endl;
+}
+
+} // end of anonymous namespace
+
+TEST(DynamicTerrainBenchmark, MovingCamera)
+{
+  compare(4096, 256, 200);
+  compare(4096, 1024, 50);
+}
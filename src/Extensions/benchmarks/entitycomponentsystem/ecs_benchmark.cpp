@@ -0,0 +1,115 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include <babylon/extensions/entitycomponentsystem/entity.h>
+#include <babylon/extensions/entitycomponentsystem/system.h>
+#include <babylon/extensions/entitycomponentsystem/world.h>
+
+namespace {
+
+using namespace BABYLON::Extensions::ECS;
+
+using ns = uint64_t;
+
+template <typename F>
+ns measure(F&& f)
+{
+  const auto before = std::chrono::high_resolution_clock::now();
+  f();
+  const auto after = std::chrono::high_resolution_clock::now();
+  return static_cast<ns>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+}
+
+struct Position : Component {
+  float x = 0.f, y = 0.f, z = 0.f;
+};
+
+struct Velocity : Component {
+  float x = 1.f, y = 1.f, z = 1.f;
+};
+
+struct Health : Component {
+  float value = 100.f;
+};
+
+struct MovementSystem : System<Requires<Position, Velocity>> {
+};
+
+void compare(size_t entityCount)
+{
+  const size_t frameCount = 20;
+  const float dt          = 1.f / 60.f;
+
+  World world;
+  MovementSystem movementSystem;
+  world.addSystem(movementSystem);
+
+  const ns createTime = measure([&]() {
+    for (size_t i = 0; i < entityCount; ++i) {
+      auto entity = world.createEntity();
+      entity.addComponent<Position>();
+      entity.addComponent<Velocity>();
+      if (i % 2 == 0) {
+        entity.addComponent<Health>();
+      }
+      entity.activate();
+    }
+    world.refresh();
+  });
+
+  // Iteration over the entities of a system, looking up each component
+  const ns systemTime = measure([&]() {
+    for (size_t frame = 0; frame < frameCount; ++frame) {
+      for (auto& entity : movementSystem.getEntities()) {
+        auto& position    = entity.getComponent<Position>();
+        const auto& speed = entity.getComponent<Velocity>();
+        position.x += speed.x * dt;
+        position.y += speed.y * dt;
+        position.z += speed.z * dt;
+      }
+    }
+  });
+
+  // Iteration over the dense component pools
+  const ns viewTime = measure([&]() {
+    for (size_t frame = 0; frame < frameCount; ++frame) {
+      world.view<Position, Velocity>().each([dt](Position& position, const Velocity& speed) {
+        position.x += speed.x * dt;
+        position.y += speed.y * dt;
+        position.z += speed.z * dt;
+      });
+    }
+  });
+
+  const ns healthViewTime = measure([&]() {
+    for (size_t frame = 0; frame < frameCount; ++frame) {
+      world.view<Position, Health>().each(
+        [](Position& position, Health& health) { health.value -= position.x * 0.001f; });
+    }
+  });
+
+  std::cout << entityCount << " entities:" << std::endl;
+  std::cout << "\tcreate:\t" << createTime << std::endl;
+  std::cout << "\ttime per frame, system entities vs. view:" << std::endl;
+  std::cout << "\tmovement:\t" << systemTime / frameCount << " vs. " << viewTime / frameCount
+            << std::endl;
+  std::cout << "\tGain:\t" << 1.0 * systemTime / viewTime << std::endl;
+  std::cout << "\thealth view (half of the entities):\t" << healthViewTime / frameCount
+            << std::endl;
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkECS, entities10k)
+{
+  compare(10000);
+}
+
+TEST(BenchmarkECS, entities100k)
+{
+  compare(100000);
+}
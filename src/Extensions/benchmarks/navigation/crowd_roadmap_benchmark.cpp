@@ -0,0 +1,135 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+
+#include <babylon/extensions/navigation/crowd_roadmap_cache.h>
+#include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
+
+namespace {
+
+using namespace BABYLON::Extensions;
+
+using ns = uint64_t;
+
+template <typename F>
+ns measure(F&& f)
+{
+  const auto before = std::chrono::high_resolution_clock::now();
+  f();
+  const auto after = std::chrono::high_resolution_clock::now();
+  return static_cast<ns>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+}
+
+// Scene with a few blocks, and a roadmap of 500 vertices around them
+void createScene(RVO2::RVOSimulator& sim, std::vector<RVO2::Vector2>& wayPoints)
+{
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      const float x = -75.f + 40.f * static_cast<float>(i);
+      const float y = -75.f + 40.f * static_cast<float>(j);
+      sim.addObstacle({RVO2::Vector2(x + 30.f, y + 30.f), RVO2::Vector2(x, y + 30.f),
+                       RVO2::Vector2(x, y), RVO2::Vector2(x + 30.f, y)});
+    }
+  }
+  sim.processObstacles();
+
+  wayPoints.clear();
+  for (int i = 0; i < 25; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      wayPoints.emplace_back(-80.f + 6.6f * static_cast<float>(i),
+                             -78.f + 8.2f * static_cast<float>(j));
+    }
+  }
+}
+
+// Roadmap computation of one agent, as done before the roadmaps were shared
+void computeAgentRoadmap(const RVO2::RVOSimulator& sim, CrowdRoadmap& roadmap, float radius)
+{
+  for (size_t i = 0; i < roadmap.size(); ++i) {
+    for (size_t j = 0; j < roadmap.size(); ++j) {
+      if (sim.queryVisibility(roadmap[i].position, roadmap[j].position, radius)) {
+        roadmap[i].neighbors.push_back(static_cast<uint32_t>(j));
+      }
+    }
+    roadmap[i].distToGoal.resize(1, 9e9f);
+  }
+
+  std::multimap<float, unsigned int> Q;
+  std::vector<std::multimap<float, unsigned int>::iterator> posInQ(roadmap.size(), Q.end());
+  roadmap[0].distToGoal[0] = 0.0f;
+  posInQ[0]                = Q.insert(std::make_pair(0.0f, 0u));
+  while (!Q.empty()) {
+    const auto u = Q.begin()->second;
+    Q.erase(Q.begin());
+    posInQ[u] = Q.end();
+    for (const auto v : roadmap[u].neighbors) {
+      const float dist_uv = RVO2::abs(roadmap[v].position - roadmap[u].position);
+      if (roadmap[v].distToGoal[0] > roadmap[u].distToGoal[0] + dist_uv) {
+        roadmap[v].distToGoal[0] = roadmap[u].distToGoal[0] + dist_uv;
+        if (posInQ[v] != Q.end()) {
+          Q.erase(posInQ[v]);
+        }
+        posInQ[v] = Q.insert(std::make_pair(roadmap[v].distToGoal[0], v));
+      }
+    }
+  }
+}
+
+void compare(size_t agentCount, size_t goalCount, size_t radiusCount)
+{
+  RVO2::RVOSimulator sim;
+  std::vector<RVO2::Vector2> wayPoints;
+  createScene(sim, wayPoints);
+
+  // Agents roadmaps: goal followed by the waypoints
+  std::vector<CrowdRoadmap> agentRoadmaps(agentCount);
+  std::vector<CrowdRoadmapCache::Request> requests(agentCount);
+  for (size_t i = 0; i < agentCount; ++i) {
+    const auto goal = static_cast<float>(i % goalCount);
+    agentRoadmaps[i].resize(wayPoints.size() + 1);
+    agentRoadmaps[i][0].position = RVO2::Vector2(-79.f + goal * 3.f, 79.f - goal * 2.f);
+    for (size_t w = 0; w < wayPoints.size(); ++w) {
+      agentRoadmaps[i][w + 1].position = wayPoints[w];
+    }
+    requests[i] = {&agentRoadmaps[i], 1.f + 0.5f * static_cast<float>(i % radiusCount)};
+  }
+
+  // Per agent computation is too slow to run for all the agents, so it is extrapolated
+  const size_t sampleCount = 4;
+  const ns sampleTime      = measure([&]() {
+    for (size_t i = 0; i < sampleCount; ++i) {
+      auto roadmap = agentRoadmaps[i];
+      computeAgentRoadmap(sim, roadmap, requests[i].radius);
+    }
+  });
+  const ns perAgentTime = sampleTime / sampleCount * agentCount;
+
+  CrowdRoadmapCache cache{&sim};
+  std::vector<CrowdRoadmapPtr> roadmaps;
+  const ns sharedTime = measure([&]() { cache.computeRoadmaps(requests, roadmaps); });
+  const ns cachedTime = measure([&]() { cache.computeRoadmaps(requests, roadmaps); });
+  EXPECT_EQ(roadmaps.size(), agentCount);
+
+  std::cout << agentCount << " agents, " << wayPoints.size() << " waypoints, " << goalCount
+            << " goals, " << radiusCount << " radiuses, per agent vs. shared roadmaps:" << std::endl;
+  std::cout << "\tCompute (per agent extrapolated): " << perAgentTime << " vs. " << sharedTime
+            << std::endl;
+  std::cout << "\tRecompute (cached): " << cachedTime << std::endl;
+  std::cout << "\tCompute gain:\t" << 1.0 * perAgentTime / sharedTime << std::endl;
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkCrowdRoadmap, sameGoal)
+{
+  compare(1000, 1, 1);
+}
+
+TEST(BenchmarkCrowdRoadmap, manyGoals)
+{
+  compare(1000, 50, 2);
+}
@@ -0,0 +1,95 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
+
+namespace {
+
+using namespace BABYLON::Extensions;
+
+using ns = uint64_t;
+
+template <typename F>
+ns measure(F&& f)
+{
+  const auto before = std::chrono::high_resolution_clock::now();
+  f();
+  const auto after = std::chrono::high_resolution_clock::now();
+  return static_cast<ns>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+}
+
+// Agents on a square grid, swapping with the agent on the opposite side
+ns simulate(BABYLON::ThreadPool& threadPool, size_t agentCount, size_t stepCount)
+{
+  RVO2::RVOSimulator sim;
+  sim.setThreadPool(&threadPool);
+  sim.setTimeStep(0.25f);
+  sim.setAgentDefaults(15.f, 10, 5.f, 5.f, 1.f, 2.f);
+  sim.addObstacle({RVO2::Vector2(5.f, 5.f), RVO2::Vector2(-5.f, 5.f), RVO2::Vector2(-5.f, -5.f),
+                   RVO2::Vector2(5.f, -5.f)});
+  sim.processObstacles();
+
+  const auto side = static_cast<size_t>(std::ceil(std::sqrt(static_cast<float>(agentCount))));
+  const float half = static_cast<float>(side) * 1.5f;
+  for (size_t i = 0; i < agentCount; ++i) {
+    sim.addAgent(RVO2::Vector2(static_cast<float>(i % side) * 3.f - half,
+                               static_cast<float>(i / side) * 3.f - half));
+  }
+
+  return measure([&]() {
+    for (size_t step = 0; step < stepCount; ++step) {
+      for (size_t i = 0; i < agentCount; ++i) {
+        auto goalVector = -sim.getAgentPosition(i) * 2.f;
+        if (RVO2::absSq(goalVector) > 1.f) {
+          goalVector = RVO2::normalize(goalVector);
+        }
+        sim.setAgentPrefVelocity(i, goalVector);
+      }
+      sim.doStep();
+    }
+  });
+}
+
+void compare(size_t agentCount)
+{
+  const size_t stepCount = 20;
+
+  BABYLON::ThreadPool singleThreadPool{1};
+  auto& threadPool = BABYLON::ThreadPool::Default();
+
+  const ns singleThreadTime = simulate(singleThreadPool, agentCount, stepCount) / stepCount;
+  const ns threadPoolTime   = simulate(threadPool, agentCount, stepCount) / stepCount;
+
+  std::cout << agentCount << " agents, time per step, 1 vs. " << threadPool.workerCount()
+            << " workers:" << std::endl;
+  std::cout << "\tdoStep: " << singleThreadTime << " vs. " << threadPoolTime << std::endl;
+  std::cout << "\tGain:\t" << 1.0 * singleThreadTime / threadPoolTime << std::endl;
+}
+
+} // end of anonymous namespace
+
+TEST(BenchmarkRVOSimulator, agents1k)
+{
+  compare(1000);
+}
+
+TEST(BenchmarkRVOSimulator, agents5k)
+{
+  compare(5000);
+}
+
+TEST(BenchmarkRVOSimulator, agents10k)
+{
+  compare(10000);
+}
+
+TEST(BenchmarkRVOSimulator, agents50k)
+{
+  compare(50000);
+}
@@ -0,0 +1,98 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include <babylon/extensions/noisegeneration/perlin_noise.h>
+#include <babylon/extensions/noisegeneration/simplex_noise.h>
+#include <babylon/maths/vector2.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+using namespace BABYLON;
+using namespace BABYLON::Extensions;
+
+using ns = uint64_t;
+
+template <typename F>
+ns measure(F&& f)
+{
+  const auto before = std::chrono::high_resolution_clock::now();
+  f();
+  const auto after = std::chrono::high_resolution_clock::now();
+  return static_cast<ns>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+}
+
+void report(const char* name, size_t pointCount, ns scalarTime, ns batchTime)
+{
+  std::cout << name << ", " << pointCount << " points" << std::endl
+            << "  scalar:  " << pointCount * 1000 / scalarTime << " Mpoints/s" << std::endl
+            << "  batch:   " << pointCount * 1000 / batchTime << " Mpoints/s" << std::endl;
+}
+
+} // end of anonymous namespace
+
+TEST(NoiseBenchmark, Grids)
+{
+  const size_t size  = 1024;
+  const float step   = 0.05f;
+  const auto origin2 = Vector2(-10.f, -20.f);
+  const auto origin3 = Vector3(-10.f, -20.f, 3.f);
+  SimplexNoise simplexNoise;
+  PerlinNoise perlinNoise;
+  Float32Array scalar(size * size), batch;
+  Float64Array perlinScalar(size * size), perlinBatch;
+
+  const auto scalarTime2 = measure([&]() {
+    for (size_t j = 0; j < size; ++j) {
+      for (size_t i = 0; i < size; ++i) {
+        scalar[j * size + i] = simplexNoise.noise(Vector2(origin2.x + step * static_cast<float>(i),
+                                                        origin2.y + step * static_cast<float>(j)));
+      }
+    }
+  });
+  const auto batchTime2
+    = measure([&]() { simplexNoise.noiseGrid(origin2, step, size, size, batch); });
+  report("simplex 2D", size * size, scalarTime2, batchTime2);
+
+  const auto scalarTime3 = measure([&]() {
+    for (size_t j = 0; j < size; ++j) {
+      for (size_t i = 0; i < size; ++i) {
+        scalar[j * size + i] = simplexNoise.noise(Vector3(origin3.x + step * static_cast<float>(i),
+                                                          origin3.y + step * static_cast<float>(j),
+                                                          origin3.z));
+      }
+    }
+  });
+  const auto batchTime3
+    = measure([&]() { simplexNoise.noiseGrid(origin3, step, size, size, 1, batch); });
+  report("simplex 3D", size * size, scalarTime3, batchTime3);
+
+  const auto scalarFBmTime = measure([&]() {
+    for (size_t j = 0; j < size; ++j) {
+      for (size_t i = 0; i < size; ++i) {
+        scalar[j * size + i] = simplexNoise.fBm(Vector2(origin2.x + step * static_cast<float>(i),
+                                                      origin2.y + step * static_cast<float>(j)));
+      }
+    }
+  });
+  const auto batchFBmTime
+    = measure([&]() { simplexNoise.fBmGrid(origin2, step, size, size, batch); });
+  report("simplex 2D fBm, 4 octaves", size * size, scalarFBmTime, batchFBmTime);
+
+  const auto perlinScalarTime = measure([&]() {
+    for (size_t j = 0; j < size; ++j) {
+      for (size_t i = 0; i < size; ++i) {
+        perlinScalar[j * size + i]
+          = perlinNoise.noise(-10.0 + 0.05 * static_cast<double>(i),
+                              -20.0 + 0.05 * static_cast<double>(j), 0.5);
+      }
+    }
+  });
+  const auto perlinBatchTime = measure(
+    [&]() { perlinNoise.noiseGrid(-10.0, -20.0, 0.5, 0.05, size, size, perlinBatch); });
+  report("perlin 3D", size * size, perlinScalarTime, perlinBatchTime);
+}
@@ -0,0 +1,119 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+#include <babylon/extensions/pathfinding/hierarchical_path_finder.h>
+#include <babylon/extensions/pathfinding/rectangular_maze.h>
+
+namespace {
+
+using namespace BABYLON::Extensions;
+
+using ns = uint64_t;
+
+template <typename F>
+ns measure(F&& f)
+{
+  const auto before = std::chrono::high_resolution_clock::now();
+  f();
+  const auto after = std::chrono::high_resolution_clock::now();
+  return static_cast<ns>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+}
+
+// Open grid with random rectangular walls, each move costing 1
+RectangularMaze createGrid(size_t size, size_t wallCount)
+{
+  RectangularMaze maze(size, size);
+  maze.generateEmptyGrid();
+  std::mt19937 generator{42};
+  std::uniform_int_distribution<size_t> coordinates{0, size - 1};
+  std::uniform_int_distribution<size_t> extents{2, 40};
+  for (size_t i = 0; i < wallCount; ++i) {
+    const auto row = coordinates(generator);
+    const auto col = coordinates(generator);
+    maze.addRectagularWall({row, col}, {row + extents(generator), col + extents(generator)});
+  }
+  for (size_t i = 0; i < maze.size(); ++i) {
+    maze.cell(i).id   = i;
+    maze.cell(i).cost = 1.0;
+  }
+  return maze;
+}
+
+void compare(size_t size, size_t wallCount, size_t queryCount)
+{
+  auto maze = createGrid(size, wallCount);
+
+  std::mt19937 generator{7};
+  std::uniform_int_distribution<size_t> cells{0, maze.size() - 1};
+  std::vector<std::pair<size_t, size_t>> queries(queryCount);
+  for (auto& query : queries) {
+    query = {cells(generator), cells(generator)};
+  }
+
+  std::vector<size_t> path;
+  size_t aStarLength = 0, jpsLength = 0, hpaLength = 0;
+
+  AStarContext<size_t> context;
+  const ns aStarTime = measure([&]() {
+    for (const auto& [start, goal] : queries) {
+      AStarSearch(maze, maze.cell(start), maze.cell(goal), context, path);
+      aStarLength += path.size();
+    }
+  });
+
+  const ns jpsTime = measure([&]() {
+    for (const auto& [start, goal] : queries) {
+      JumpPointSearch(maze, start, goal, context, path);
+      jpsLength += path.size();
+    }
+  });
+
+  HierarchicalPathFinder<RectangularMaze> pathFinder{maze, 16};
+  const ns buildTime = measure([&]() { pathFinder.update(); });
+
+  const ns hpaTime = measure([&]() {
+    for (const auto& [start, goal] : queries) {
+      pathFinder.findPath(start, goal, path);
+      hpaLength += path.size();
+    }
+  });
+
+  // A door is opened in a wall
+  const ns updateTime = measure([&]() {
+    const auto row = size / 2, col = size / 2;
+    maze.cell(row, col).rightOpen    = true;
+    maze.cell(row, col + 1).leftOpen = true;
+    pathFinder.updateCell(row, col);
+    pathFinder.updateCell(row, col + 1);
+    pathFinder.update();
+  });
+
+  std::cout << size << "x" << size << " grid, " << wallCount << " walls, " << queryCount << " queries"
+            << std::endl;
+  std::cout << "  A* (reused context)   : " << aStarTime / 1000000.0 << " ms, path length "
+            << aStarLength << std::endl;
+  std::cout << "  Jump point search     : " << jpsTime / 1000000.0 << " ms, path length "
+            << jpsLength << std::endl;
+  std::cout << "  HPA* build            : " << buildTime / 1000000.0 << " ms, "
+            << pathFinder.portalCount() << " portals" << std::endl;
+  std::cout << "  HPA*                  : " << hpaTime / 1000000.0 << " ms, path length "
+            << hpaLength << std::endl;
+  std::cout << "  HPA* incremental      : " << updateTime / 1000000.0 << " ms" << std::endl;
+
+  EXPECT_EQ(aStarLength, jpsLength);
+  EXPECT_GE(hpaLength, aStarLength);
+}
+
+} // end of anonymous namespace
+
+TEST(PathFindingBenchmark, Compare)
+{
+  compare(512, 512, 100);
+  compare(2048, 128, 20);
+  compare(2048, 2048, 20);
+}
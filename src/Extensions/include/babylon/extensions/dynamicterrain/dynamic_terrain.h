@@ -14,6 +14,7 @@ namespace BABYLON {
 class Camera;
 class Mesh;
 class Scene;
+class ThreadPool;
 using CameraPtr = std::shared_ptr<Camera>;
 using MeshPtr   = std::shared_ptr<Mesh>;
 
@@ -145,6 +146,24 @@ public:
   static void ComputeNormalsFromMapToRef(const Float32Array& mapData, unsigned int mapSubX,
                                          unsigned int mapSubZ, Float32Array& normals);
 
+  /**
+   * @brief Computes the normals of the vertices in the rows [rowStart, rowEnd)
+   * and the columns [colStart, colEnd) of a ribbon grid, as
+   * VertexData::ComputeNormals() does with the ribbon indices.
+   * The face normals are computed one quad row at a time from deinterleaved
+   * coordinates, in loops the compiler vectorizes. The passed normals array
+   * must have the same size than the positions array.
+   * @param columns the number of vertices per row
+   * @param rows the number of rows
+   * @param frontSide whether the ribbon was built with Mesh::FRONTSIDE, the
+   * normals being reversed otherwise
+   */
+  static void ComputeRibbonNormalsToRef(const Float32Array& positions, unsigned int columns,
+                                        unsigned int rows, unsigned int rowStart,
+                                        unsigned int rowEnd, unsigned int colStart,
+                                        unsigned int colEnd, bool frontSide,
+                                        Float32Array& normals);
+
   /**
    * @brief Computes all the map normals from the current terrain data map and
    * sets them to the terrain.
@@ -418,6 +437,14 @@ public:
   [[nodiscard]] bool precomputeNormalsFromMap() const;
   void setPrecomputeNormalsFromMap(bool val);
 
+  /**
+   * @brief Sets the thread pool updating the ribbon rows, nullptr to use the
+   * default thread pool.
+   * The rows are updated on the calling thread when useCustomVertexFunction is
+   * set, as updateVertex() is not required to be thread safe.
+   */
+  void setThreadPool(ThreadPool* threadPool);
+
   // User custom functions.
   // These following can be overwritten bu the user to fit his needs.
 
@@ -457,9 +484,24 @@ public:
 private:
   /**
    * @brief Updates the underlying ribbon.
+   * When the camera only moved, without LOD change, the ribbon vertices are
+   * shifted and only the border strips entering the map window are computed.
    */
   void _updateTerrain();
 
+  /**
+   * @brief Computes the LOD values and map offsets of the ribbon rows and
+   * columns.
+   */
+  void _updateRibbonSteps();
+
+  /**
+   * @brief Updates the ribbon vertices of the columns [colStart, colEnd) of the
+   * row j from the map, and adds them to the passed bounds.
+   */
+  void _updateRibbonRow(unsigned int j, unsigned int colStart, unsigned int colEnd, Vector3& bbMin,
+                        Vector3& bbMax);
+
   template <typename T>
   T _mod(T a, T b)
   {
@@ -549,6 +591,32 @@ private:
   bool _colormap;
   // current vertex object passed to the user custom function
   DynamicTerrainVertex _vertex;
+  // LOD value of each ribbon row and column
+  Uint32Array _ribbonLODs;
+  // map subdivision offset of each ribbon row and column
+  Uint32Array _ribbonSteps;
+  // map column of each ribbon column
+  Uint32Array _mapColumns;
+  // terrain map column of each ribbon column
+  Uint32Array _terrainColumns;
+  // vertex data of the previous ribbon update, the ribbon shift copying them
+  // into the current ones
+  Float32Array _previousPositions;
+  Float32Array _previousNormals;
+  Float32Array _previousColors;
+  Float32Array _previousUVs;
+  // ribbon vertex shift on the x axis since the last ribbon update
+  int _ribbonShiftX;
+  // ribbon vertex shift on the z axis since the last ribbon update
+  int _ribbonShiftZ;
+  // LOD value of the last ribbon update
+  unsigned int _ribbonLODValue;
+  // the maps changed, the whole ribbon must be recomputed
+  bool _ribbonOutdated;
+  // true if the ribbon was built with Mesh::FRONTSIDE
+  bool _frontSide;
+  // thread pool updating the ribbon rows, the default one if null
+  ThreadPool* _threadPool;
   // map cell average x size
   float _averageSubSizeX;
   // map cell average z size
@@ -579,8 +647,6 @@ private:
   static Vector3 _vAvB;
   static Vector3 _vAvC;
   static Vector3 _norm;
-  static Vector3 _bbMin;
-  static Vector3 _bbMax;
 
 }; // end of class DynamicTerrain
 
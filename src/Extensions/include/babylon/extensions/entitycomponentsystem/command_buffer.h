@@ -0,0 +1,102 @@
+#ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_COMMAND_BUFFER_H
+#define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_COMMAND_BUFFER_H
+
+#include <functional>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+#include <babylon/extensions/entitycomponentsystem/entity.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace ECS {
+
+class World;
+
+/// \brief Records structural changes of a World, to apply them later
+///
+/// Creating and killing entities, (de)activating them and adding or
+/// removing components modify the storage of the world, which must not
+/// happen while systems are updated concurrently. The systems record these
+/// changes in the command buffer instead, which is thread safe, and the
+/// changes are applied at the next sync point, on World::refresh().
+///
+/// The commands are applied in the order in which they were recorded.
+class BABYLON_SHARED_EXPORT CommandBuffer {
+
+public:
+  /// A recorded command
+  using Command = std::function<void(World&)>;
+
+  CommandBuffer() = default;
+  CommandBuffer(const CommandBuffer&) = delete;
+  CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+  /// Records a command
+  /// \param command The command to apply to the world
+  void push(Command command);
+
+  /// Records the creation of an entity
+  /// \param initialize The function called with the entity once created
+  void createEntity(std::function<void(Entity&)> initialize);
+
+  /// Records the destruction of an entity
+  void killEntity(const Entity& entity);
+
+  /// Records the activation of an entity
+  void activateEntity(const Entity& entity);
+
+  /// Records the deactivation of an entity
+  void deactivateEntity(const Entity& entity);
+
+  /// Records the addition of a component to an entity
+  /// \tparam T The type of component to add
+  /// \param entity The entity
+  /// \param args The arguments for the constructor of the component, which
+  /// are copied
+  template <typename T, typename... Args>
+  void addComponent(const Entity& entity, Args&&... args)
+  {
+    push([entity, args = std::make_tuple(std::forward<Args>(args)...)](World& /*world*/) mutable {
+      std::apply(
+        [&entity](auto&&... componentArgs) {
+          Entity(entity).addComponent<T>(std::forward<decltype(componentArgs)>(componentArgs)...);
+        },
+        std::move(args));
+    });
+  }
+
+  /// Records the removal of a component from an entity
+  /// \tparam T The type of component to remove
+  template <typename T>
+  void removeComponent(const Entity& entity)
+  {
+    push([entity](World& /*world*/) { Entity(entity).removeComponent<T>(); });
+  }
+
+  /// \return true if no command is recorded
+  [[nodiscard]] bool empty() const;
+
+  /// Applies the recorded commands to a world, in order
+  /// \param world The world to apply the commands to
+  /// \note Commands recorded while applying are kept for the next call
+  void apply(World& world);
+
+  /// Removes the recorded commands without applying them
+  void clear();
+
+private:
+  mutable std::mutex m_mutex;
+  std::vector<Command> m_commands;
+
+}; // end of class CommandBuffer
+
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_COMMAND_BUFFER_H
@@ -29,6 +29,7 @@
 #ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_BASE_SYSTEM_H
 #define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_BASE_SYSTEM_H
 
+#include <cstddef>
 #include <vector>
 
 #include <babylon/babylon_api.h>
@@ -67,6 +68,55 @@ public:
   /// \return All the entities that are within the System
   [[nodiscard]] const std::vector<Entity>& getEntities() const;
 
+  /// Updates the system, called by the SystemScheduler
+  /// \note The default implementation updates all the entities of the system
+  virtual void update();
+
+  /// Updates a range of the entities of the system
+  /// \param begin The index of the first entity to update
+  /// \param end The index after the last entity to update
+  /// \note Called by the SystemScheduler, concurrently for disjoint ranges,
+  /// when getGrainSize() is not 0
+  virtual void updateEntities(std::size_t begin, std::size_t end);
+
+  /// \return The amount of entities per range updated concurrently, or 0 if
+  /// the entities of the system cannot be updated concurrently
+  [[nodiscard]] virtual std::size_t getGrainSize() const;
+
+  /// \return The end of the ranges passed to updateEntities(), the amount of
+  /// entities of the system by default
+  /// \note Overridden by the systems which iterate a View::each(begin, end)
+  /// instead of their entities
+  [[nodiscard]] virtual std::size_t getRangeEnd() const;
+
+  /// \return The component types read by the system
+  [[nodiscard]] const ComponentTypeList& getReadComponentTypes() const;
+
+  /// \return The component types written by the system
+  [[nodiscard]] const ComponentTypeList& getWriteComponentTypes() const;
+
+  /// \return true if the system declared the component types it accesses,
+  /// otherwise the SystemScheduler does not run it concurrently with other
+  /// systems
+  [[nodiscard]] bool hasDeclaredAccess() const;
+
+protected:
+  /// Declares component types read by the system
+  template <class... Ts>
+  void reads()
+  {
+    m_readComponentTypes |= types(TypeList<Ts...>{});
+    m_hasDeclaredAccess = true;
+  }
+
+  /// Declares component types written by the system
+  template <class... Ts>
+  void writes()
+  {
+    m_writeComponentTypes |= types(TypeList<Ts...>{});
+    m_hasDeclaredAccess = true;
+  }
+
 private:
   /// Initializes the system, when a world is successfully attached to it.
   virtual void initialize()
@@ -109,6 +159,15 @@ private:
   /// The Entities that are attached to this system
   std::vector<Entity> m_entities;
 
+  /// The component types read by the system
+  ComponentTypeList m_readComponentTypes;
+
+  /// The component types written by the system
+  ComponentTypeList m_writeComponentTypes;
+
+  /// Whether the system declared its component accesses
+  bool m_hasDeclaredAccess;
+
   friend World;
 
 }; // end of class BaseSystem
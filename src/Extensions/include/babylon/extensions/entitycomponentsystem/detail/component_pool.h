@@ -0,0 +1,205 @@
+#ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_COMPONENT_POOL_H
+#define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_COMPONENT_POOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+#include <babylon/extensions/entitycomponentsystem/component.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace ECS {
+namespace detail {
+
+/// \brief The storage of all the components of one type, as a sparse set
+///
+/// The components are stored contiguously (the dense array), along with the
+/// index of the entity each one belongs to (the entity indices array). The
+/// sparse array maps the index of an entity to the position of its component
+/// in the dense array.
+///
+/// This base class gives a type-erased access to the pool.
+class BABYLON_SHARED_EXPORT BaseComponentPool {
+
+public:
+  /// Position of the entities which have no component in the pool
+  static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+  virtual ~BaseComponentPool() = default;
+
+  /// \return true if the entity with the given index has a component
+  [[nodiscard]] bool has(std::size_t entityIndex) const
+  {
+    return entityIndex < m_sparse.size() && m_sparse[entityIndex] != npos;
+  }
+
+  /// \return The amount of components in the pool
+  [[nodiscard]] std::size_t size() const
+  {
+    return m_entityIndices.size();
+  }
+
+  /// \return The entity indices, in the order of the components
+  [[nodiscard]] const std::vector<std::size_t>& getEntityIndices() const
+  {
+    return m_entityIndices;
+  }
+
+  /// \return The component of the entity with the given index
+  [[nodiscard]] virtual Component& getComponent(std::size_t entityIndex) = 0;
+
+  /// Removes the component of the entity with the given index
+  virtual void remove(std::size_t entityIndex) = 0;
+
+  /// Removes all the components
+  virtual void clear() = 0;
+
+protected:
+  /// Position of the component of each entity in the dense array, by
+  /// entity index
+  std::vector<std::size_t> m_sparse;
+
+  /// Index of the entity of each component in the dense array
+  std::vector<std::size_t> m_entityIndices;
+
+}; // end of class BaseComponentPool
+
+/// \brief The storage of the components of type T
+///
+/// The dense array is allocated in pages, so that growing the pool does not
+/// move the components: a component reference stays valid until a component
+/// of the same type is removed, which moves the last component of the pool
+/// into the hole.
+template <class T>
+class ComponentPool : public BaseComponentPool {
+
+public:
+  /// The amount of components per page
+  static constexpr std::size_t PageSize = 1024;
+
+  ComponentPool() = default;
+  ComponentPool(const ComponentPool&) = delete;
+  ComponentPool& operator=(const ComponentPool&) = delete;
+
+  ~ComponentPool() override
+  {
+    clear();
+  }
+
+  /// Creates the pool, used to create the pools from their type id
+  static BaseComponentPool* Create()
+  {
+    return new ComponentPool<T>();
+  }
+
+  /// Constructs the component of an entity, replacing its current one
+  /// \param entityIndex The index of the entity
+  /// \param args The arguments for the constructor of the component
+  template <typename... Args>
+  T& emplace(std::size_t entityIndex, Args&&... args)
+  {
+    if (has(entityIndex)) {
+      remove(entityIndex);
+    }
+
+    const auto position = size();
+    if (position == m_pages.size() * PageSize) {
+      m_pages.emplace_back(new Page);
+    }
+    if (entityIndex >= m_sparse.size()) {
+      m_sparse.resize(entityIndex + 1, npos);
+    }
+    if (m_entityIndices.size() == m_entityIndices.capacity()) {
+      m_entityIndices.reserve(std::max<std::size_t>(2 * m_entityIndices.capacity(), 16));
+    }
+
+    auto component = new (slot(position)) T{std::forward<Args>(args)...};
+
+    m_sparse[entityIndex] = position;
+    m_entityIndices.emplace_back(entityIndex);
+
+    return *component;
+  }
+
+  /// \return The component of the entity with the given index
+  /// \note The entity must have a component in the pool
+  T& get(std::size_t entityIndex)
+  {
+    return at(m_sparse[entityIndex]);
+  }
+
+  /// \return The component at the given position of the dense array
+  T& at(std::size_t position)
+  {
+    return *std::launder(reinterpret_cast<T*>(slot(position)));
+  }
+
+  /// \return The component of the entity with the given index, or nullptr
+  T* find(std::size_t entityIndex)
+  {
+    return has(entityIndex) ? &get(entityIndex) : nullptr;
+  }
+
+  [[nodiscard]] Component& getComponent(std::size_t entityIndex) override
+  {
+    return get(entityIndex);
+  }
+
+  void remove(std::size_t entityIndex) override
+  {
+    if (!has(entityIndex)) {
+      return;
+    }
+
+    // Move the last component into the hole to keep the array dense
+    const auto position = m_sparse[entityIndex];
+    const auto last     = size() - 1;
+    if (position != last) {
+      at(position)                        = std::move(at(last));
+      m_entityIndices[position]           = m_entityIndices[last];
+      m_sparse[m_entityIndices[position]] = position;
+    }
+
+    at(last).~T();
+    m_entityIndices.pop_back();
+    m_sparse[entityIndex] = npos;
+  }
+
+  void clear() override
+  {
+    for (std::size_t position = 0; position < size(); ++position) {
+      at(position).~T();
+    }
+    m_entityIndices.clear();
+    m_sparse.clear();
+    m_pages.clear();
+  }
+
+private:
+  struct Page {
+    alignas(T) unsigned char data[sizeof(T) * PageSize];
+  };
+
+  void* slot(std::size_t position)
+  {
+    return m_pages[position / PageSize]->data + (position % PageSize) * sizeof(T);
+  }
+
+  /// The dense array of components
+  std::vector<std::unique_ptr<Page>> m_pages;
+
+}; // end of class ComponentPool
+
+} // end of namespace detail
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_COMPONENT_POOL_H
@@ -31,10 +31,12 @@
 
 #include <array>
 #include <memory>
+#include <vector>
 
 #include <babylon/babylon_api.h>
 
 #include <babylon/extensions/entitycomponentsystem/detail/class_type_id.h>
+#include <babylon/extensions/entitycomponentsystem/detail/component_pool.h>
 #include <babylon/extensions/entitycomponentsystem/detail/component_type_list.h>
 
 #include <babylon/extensions/entitycomponentsystem/component.h>
@@ -48,22 +50,29 @@ namespace detail {
 
 /// \brief A class to store components for entities within a world
 ///
-///
-/// Used to store the components
-///
+/// The components of each type are stored in their own pool, a sparse set
+/// which keeps them contiguous in memory. The pools are created on the first
+/// use of their component type.
 ///
 /// \author Miguel Martin
 class BABYLON_SHARED_EXPORT EntityComponentStorage {
 
 public:
   explicit EntityComponentStorage(std::size_t entityAmount);
+  ~EntityComponentStorage(); // = default
 
   EntityComponentStorage(const EntityComponentStorage&) = delete;
   EntityComponentStorage(EntityComponentStorage&&)      = delete;
   EntityComponentStorage& operator=(const EntityComponentStorage&) = delete;
   EntityComponentStorage& operator=(EntityComponentStorage&&) = delete;
 
-  void addComponent(Entity& entity, Component* component, TypeId componentTypeId);
+  /// \return The pool of a component type, created if needed
+  /// \param componentTypeId The type id of the component
+  /// \param createPool Creates the pool of this component type
+  BaseComponentPool& getPool(TypeId componentTypeId, BaseComponentPool* (*createPool)());
+
+  /// Marks a component, constructed in its pool, as added to an entity
+  void addComponent(Entity& entity, TypeId componentTypeId);
 
   void removeComponent(Entity& entity, TypeId componentTypeId);
 
@@ -82,40 +91,15 @@ public:
   void clear();
 
 private:
-  typedef std::array<std::unique_ptr<Component>, MAX_AMOUNT_OF_COMPONENTS> ImplComponentArray;
-
-  /// \brief A data structure to describe the components
-  /// within an entity
-  ///
-  /// \author Miguel Martin
-  struct EntityComponents {
-    EntityComponents() = default;
-
-    // bug in clang? won't work w/o this
-    // http://stackoverflow.com/questions/8560994/stdmake-shared-stdunique-ptr-and-move-constructors
-    // I think it's due to ComponentTypeList (may have to update boost)
-    EntityComponents(EntityComponents&& e)
-        : components(std::move(e.components)), componentTypeList(std::move(e.componentTypeList))
-    {
-    }
-
-    /// The components of an entity. The
-    /// index of this array is the same as the TypeId
-    /// of the component.
-    ImplComponentArray components;
-
-    /// A list of component types, which resembles
-    /// what components an entity has
-    ComponentTypeList componentTypeList;
-  };
-
-  /// All the components for every entity, which has
-  /// an entity. The indices of this array is the same
-  /// as the index component of an entity's ID.
-  std::vector<EntityComponents> m_componentEntries;
-
-  ImplComponentArray& getComponentsImpl(const Entity& e);
-  [[nodiscard]] const ImplComponentArray& getComponentsImpl(const Entity& e) const;
+  /// The pools of components. The index of this array
+  /// is the TypeId of the component.
+  std::array<std::unique_ptr<BaseComponentPool>, MAX_AMOUNT_OF_COMPONENTS> m_pools;
+
+  /// A list of component types for every entity, which
+  /// resembles what components the entity has. The indices
+  /// of this array is the same as the index component of
+  /// an entity's ID.
+  std::vector<ComponentTypeList> m_componentTypeLists;
 
 }; // end of class EntityComponentStorage
 
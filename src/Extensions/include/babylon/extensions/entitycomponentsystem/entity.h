@@ -40,6 +40,7 @@
 #include <babylon/babylon_api.h>
 
 #include <babylon/extensions/entitycomponentsystem/detail/class_type_id.h>
+#include <babylon/extensions/entitycomponentsystem/detail/component_pool.h>
 #include <babylon/extensions/entitycomponentsystem/detail/component_type_list.h>
 
 #include <babylon/extensions/entitycomponentsystem/component.h>
@@ -206,7 +207,9 @@ public:
 private:
   // wrappers to add components
   // so I may call them from templated public interfaces
-  void addComponent(Component* component, detail::TypeId componentTypeId);
+  detail::BaseComponentPool& getComponentPool(detail::TypeId componentTypeId,
+                                              detail::BaseComponentPool* (*createPool)()) const;
+  void addComponent(detail::TypeId componentTypeId);
   void removeComponent(detail::TypeId componentTypeId);
   [[nodiscard]] Component& getComponent(detail::TypeId componentTypeId) const;
   [[nodiscard]] bool hasComponent(detail::TypeId componentTypeId) const;
@@ -225,10 +228,13 @@ template <typename T, typename... Args>
 T& Entity::addComponent(Args&&... args)
 {
   static_assert(std::is_base_of<Component, T>(), "T is not a component, cannot add T to entity");
-  // TODO: align components by type
-  auto component = new T{std::forward<Args>(args)...};
-  addComponent(component, ComponentTypeId<T>());
-  return *component;
+  // The components of a type are stored contiguously in their pool
+  const auto componentTypeId = ComponentTypeId<T>();
+  auto& pool                 = static_cast<detail::ComponentPool<T>&>(
+    getComponentPool(componentTypeId, &detail::ComponentPool<T>::Create));
+  auto& component = pool.emplace(m_id.index, std::forward<Args>(args)...);
+  addComponent(componentTypeId);
+  return component;
 }
 
 template <typename T>
@@ -0,0 +1,97 @@
+#ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_SYSTEM_SCHEDULER_H
+#define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_SYSTEM_SCHEDULER_H
+
+#include <cstddef>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+#include <babylon/extensions/entitycomponentsystem/detail/base_system.h>
+
+namespace BABYLON {
+
+class ThreadPool;
+
+namespace Extensions {
+namespace ECS {
+
+class World;
+
+/// \brief Updates the systems of a world, concurrently where possible
+///
+/// The systems are added in program order. Two systems conflict when one of
+/// them writes a component type the other one reads or writes, in which case
+/// they are updated in program order. The systems are grouped in stages: the
+/// systems of a stage do not conflict with each other and are updated
+/// concurrently, and a stage starts once the previous one is done.
+///
+/// A system which did not declare the component types it accesses conflicts
+/// with all the other systems. A system with a grain size is updated in
+/// concurrent ranges of its entities.
+///
+/// The world is refreshed before updating the systems, this is the sync point
+/// where the structural changes recorded in the command buffer of the world
+/// are applied. The systems must not create, kill or (de)activate entities
+/// nor add or remove components directly while updated.
+class BABYLON_SHARED_EXPORT SystemScheduler {
+
+public:
+  /// \param world The world of the systems
+  explicit SystemScheduler(World& world);
+  ~SystemScheduler(); // = default
+
+  SystemScheduler(const SystemScheduler&) = delete;
+  SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+  /// Sets the thread pool used to update the systems
+  /// \param threadPool The thread pool, nullptr to use the default pool
+  void setThreadPool(ThreadPool* threadPool);
+
+  /// Adds a system after the systems already added
+  /// \param system The system, attached to the world of the scheduler
+  void addSystem(detail::BaseSystem& system);
+
+  /// Removes a system
+  void removeSystem(detail::BaseSystem& system);
+
+  /// Removes all the systems
+  void removeAllSystems();
+
+  /// \return The systems of each stage, in update order
+  [[nodiscard]] const std::vector<std::vector<detail::BaseSystem*>>& getStages();
+
+  /// Refreshes the world then updates the systems
+  void update();
+
+private:
+  struct Task {
+    detail::BaseSystem* system;
+    std::size_t begin;
+    std::size_t end;
+    bool isWholeSystem;
+  };
+
+  static bool conflicts(const detail::BaseSystem& a, const detail::BaseSystem& b);
+  void buildStages();
+  void updateStage(const std::vector<detail::BaseSystem*>& stage);
+
+  World& m_world;
+  ThreadPool* m_threadPool;
+
+  /// The systems, in program order
+  std::vector<detail::BaseSystem*> m_systems;
+
+  /// The systems of each stage
+  std::vector<std::vector<detail::BaseSystem*>> m_stages;
+  bool m_stagesAreDirty;
+
+  /// The tasks of the stage being updated
+  std::vector<Task> m_tasks;
+
+}; // end of class SystemScheduler
+
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_SYSTEM_SCHEDULER_H
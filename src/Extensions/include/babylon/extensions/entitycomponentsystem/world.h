@@ -26,7 +26,10 @@
 #ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_WORLD_H
 #define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_WORLD_H
 
+#include <algorithm>
+#include <initializer_list>
 #include <memory>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -37,6 +40,7 @@
 #include <babylon/extensions/entitycomponentsystem/detail/entity_component_storage.h>
 #include <babylon/extensions/entitycomponentsystem/detail/entity_id_pool.h>
 
+#include <babylon/extensions/entitycomponentsystem/command_buffer.h>
 #include <babylon/extensions/entitycomponentsystem/component.h>
 #include <babylon/extensions/entitycomponentsystem/entity.h>
 #include <babylon/extensions/entitycomponentsystem/system.h>
@@ -45,6 +49,9 @@ namespace BABYLON {
 namespace Extensions {
 namespace ECS {
 
+template <class... Ts>
+class View;
+
 class BABYLON_SHARED_EXPORT World {
 
 private:
@@ -155,8 +162,13 @@ public:
   [[nodiscard]] bool isValid(const Entity& entity) const;
 
   /// Refreshes the World
+  /// \note The commands recorded in the command buffer are applied first
   void refresh();
 
+  /// \return The command buffer recording the structural changes to apply
+  /// on the next refresh, which can be used from concurrent systems
+  CommandBuffer& getCommandBuffer();
+
   /// Instantaneously clears the world, by removing
   /// all systems and entities from the world.
   /// \note It is no guarantee that the entities from the world
@@ -179,6 +191,12 @@ public:
   /// to the world
   Entity getEntity(std::size_t index);
 
+  /// Creates a view over the activated entities which have all the
+  /// components Ts, to iterate over these components by reference
+  /// \tparam Ts The types of components of the entities
+  template <class... Ts>
+  View<Ts...> view();
+
 private:
   /// Systems attached with the world.
   SystemArray m_systems;
@@ -271,6 +289,9 @@ private:
   /// within the World.
   m_entityCache;
 
+  /// The structural changes to apply on the next refresh
+  CommandBuffer m_commandBuffer;
+
   void checkForResize(std::size_t amountOfEntitiesToBeAllocated);
   void resize(std::size_t amount);
 
@@ -278,8 +299,13 @@ private:
   void removeSystem(detail::TypeId systemTypeId);
   [[nodiscard]] bool doesSystemExist(detail::TypeId systemTypeId) const;
 
+  template <class T>
+  detail::ComponentPool<T>& getComponentPool();
+
   // to access components
   friend class Entity;
+  template <class... Ts>
+  friend class View;
 
 }; // end of class World
 
@@ -315,6 +341,107 @@ template <class TSystem>
   return system.m_world == this && doesSystemExist<TSystem>();
 }
 
+template <class T>
+detail::ComponentPool<T>& World::getComponentPool()
+{
+  static_assert(std::is_base_of<Component, T>(), "T is not a component");
+  return static_cast<detail::ComponentPool<T>&>(m_entityAttributes.componentStorage.getPool(
+    ComponentTypeId<T>(), &detail::ComponentPool<T>::Create));
+}
+
+/// \brief A view over the activated entities which have all the components Ts
+///
+/// The view walks the pool of the least common component type, which is
+/// contiguous in memory, and looks up the other components in their pools.
+/// The components are passed by reference, nothing is copied.
+///
+/// \note Components of the viewed types must not be removed while iterating.
+template <class... Ts>
+class View {
+
+public:
+  explicit View(World& world)
+      : m_world{&world}, m_pools{&world.getComponentPool<Ts>()...}
+  {
+  }
+
+  /// Calls a function for each entity of the view
+  /// \param func The function, called with (Entity, Ts&...) or (Ts&...)
+  template <class Func>
+  void each(Func&& func) const
+  {
+    each(0, extent(), std::forward<Func>(func));
+  }
+
+  /// Calls a function for each entity of the view within a range of the
+  /// walked pool, disjoint ranges can be iterated concurrently
+  /// \param begin The index of the first component of the walked pool
+  /// \param end The index after the last component of the walked pool
+  /// \param func The function, called with (Entity, Ts&...) or (Ts&...)
+  template <class Func>
+  void each(std::size_t begin, std::size_t end, Func&& func) const
+  {
+    const auto& entityIndices = smallestPool().getEntityIndices();
+    const auto& attributes    = m_world->m_entityAttributes.attributes;
+    end                       = std::min(end, entityIndices.size());
+    for (std::size_t i = begin; i < end; ++i) {
+      const auto entityIndex = entityIndices[i];
+      if (!attributes[entityIndex].activated
+          || !(std::get<detail::ComponentPool<Ts>*>(m_pools)->has(entityIndex) && ...)) {
+        continue;
+      }
+
+      if constexpr (std::is_invocable_v<Func, Ts&...>) {
+        func(std::get<detail::ComponentPool<Ts>*>(m_pools)->get(entityIndex)...);
+      }
+      else {
+        func(m_world->getEntity(entityIndex),
+             std::get<detail::ComponentPool<Ts>*>(m_pools)->get(entityIndex)...);
+      }
+    }
+  }
+
+  /// \return The amount of entities in the view
+  [[nodiscard]] std::size_t size() const
+  {
+    std::size_t count = 0;
+    each([&count](Ts&... /*components*/) { ++count; });
+    return count;
+  }
+
+  /// \return The amount of components in the walked pool, the end of the
+  /// ranges iterated by each(begin, end, func)
+  [[nodiscard]] std::size_t extent() const
+  {
+    return smallestPool().size();
+  }
+
+private:
+  const detail::BaseComponentPool& smallestPool() const
+  {
+    const detail::BaseComponentPool* smallestPool = nullptr;
+    for (const detail::BaseComponentPool* pool :
+         {static_cast<const detail::BaseComponentPool*>(
+           std::get<detail::ComponentPool<Ts>*>(m_pools))...}) {
+      if (smallestPool == nullptr || pool->size() < smallestPool->size()) {
+        smallestPool = pool;
+      }
+    }
+    return *smallestPool;
+  }
+
+  World* m_world;
+  std::tuple<detail::ComponentPool<Ts>*...> m_pools;
+
+}; // end of class View
+
+template <class... Ts>
+View<Ts...> World::view()
+{
+  static_assert(sizeof...(Ts) > 0, "A view requires at least one component type");
+  return View<Ts...>{*this};
+}
+
 } // end of namespace ECS
 } // end of namespace Extensions
 } // end of namespace BABYLON
@@ -3,6 +3,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/extensions/entitycomponentsystem/component.h>
+#include <babylon/extensions/navigation/crowd_roadmap_cache.h>
 #include <babylon/extensions/navigation/crowd_roadmap_vertex.h>
 #include <babylon/extensions/navigation/rvo2/vector2.h>
 #include <babylon/maths/vector2.h>
@@ -35,8 +36,12 @@ public:
   void setAgentPrefVelocity(const BABYLON::Vector2& goalVector);
   void setAgentPrefVelocity(const RVO2::Vector2& goalVector);
   [[nodiscard]] bool hasRoadMap() const;
-  std::vector<CrowdRoadmapVertex>& roadmap();
+  /* Returns the computed roadmap if any, the goal and waypoints otherwise. */
   [[nodiscard]] const std::vector<CrowdRoadmapVertex>& roadmap() const;
+  /* Returns the goal and waypoints, from which the roadmap is computed. */
+  [[nodiscard]] const std::vector<CrowdRoadmapVertex>& wayPoints() const;
+  /* Sets the computed roadmap, shared with the agents having the same goal, waypoints and radius. */
+  void setRoadmap(const CrowdRoadmapPtr& roadmap);
   void addWayPoint(const BABYLON::Vector2& wayPoint);
   void setAgentMaxNeighbors(size_t neighborsMax);
   void setAgentNeighborDist(float neighborDist);
@@ -50,8 +55,10 @@ private:
   size_t _id;
   RVO2::Vector2 _goal;
   RVO2::RVOSimulator* _sim;
-  // Holds the roadmap
+  // Holds the goal and waypoints
   std::vector<CrowdRoadmapVertex> _roadmap;
+  // The computed roadmap
+  CrowdRoadmapPtr _sharedRoadmap;
 
 }; // end of class CrowdAgent
 
@@ -15,7 +15,15 @@ struct BABYLON_SHARED_EXPORT CrowdMeshUpdaterSystem
   CrowdMeshUpdaterSystem();
   ~CrowdMeshUpdaterSystem() override; // = default
 
-  void update();
+  /**
+   * Copies the positions of the agents to their meshes, iterating a view of the agent components.
+   * The agents are independent, so ranges of the view are updated concurrently by the system
+   * scheduler.
+   */
+  void update() override;
+  void updateEntities(std::size_t begin, std::size_t end) override;
+  [[nodiscard]] std::size_t getGrainSize() const override;
+  [[nodiscard]] std::size_t getRangeEnd() const override;
 
 }; // end of struct CrowdMeshUpdaterSystem
 
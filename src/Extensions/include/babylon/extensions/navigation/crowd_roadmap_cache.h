@@ -0,0 +1,89 @@
+#ifndef BABYLON_EXTENSIONS_NAVIGATION_CROWD_ROADMAP_CACHE_H
+#define BABYLON_EXTENSIONS_NAVIGATION_CROWD_ROADMAP_CACHE_H
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/extensions/navigation/crowd_roadmap_vertex.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+namespace RVO2 {
+class RVOSimulator;
+} // namespace RVO2
+
+using CrowdRoadmap    = std::vector<CrowdRoadmapVertex>;
+using CrowdRoadmapPtr = std::shared_ptr<const CrowdRoadmap>;
+
+/**
+ * @brief Computes the roadmaps of the crowd agents and shares them between the agents.
+ *
+ * A roadmap is made of the goal of an agent (vertex 0) followed by its waypoints. The agents which
+ * have the same waypoints and radius form a roadmap class: the visibility graph of the waypoints
+ * is computed once per class, in parallel. The distance to goal field is then computed once per
+ * goal of the class, using Dijkstra's algorithm with a binary heap, and the resulting roadmap is
+ * shared by all the agents having this goal.
+ *
+ * The cache must be cleared when the obstacles of the simulator change.
+ */
+class BABYLON_SHARED_EXPORT CrowdRoadmapCache {
+
+public:
+  /**
+   * Roadmap of an agent to compute: its goal followed by its waypoints, and its radius.
+   */
+  struct Request {
+    const CrowdRoadmap* vertices = nullptr;
+    float radius                 = 0.f;
+  }; // end of struct Request
+
+public:
+  CrowdRoadmapCache(const RVO2::RVOSimulator* sim);
+  ~CrowdRoadmapCache(); // = default
+
+  /**
+   * @brief Computes the roadmaps, reusing the ones already computed.
+   * @param requests the roadmaps to compute
+   * @param roadmaps output the roadmaps, in the order of the requests
+   */
+  void computeRoadmaps(const std::vector<Request>& requests,
+                       std::vector<CrowdRoadmapPtr>& roadmaps);
+
+  /**
+   * @brief Removes all the roadmaps from the cache.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of roadmap classes (distinct waypoints and radius).
+   */
+  [[nodiscard]] size_t roadmapClassCount() const;
+
+  /**
+   * @brief Returns the number of roadmaps (distinct goals of the roadmap classes).
+   */
+  [[nodiscard]] size_t roadmapCount() const;
+
+private:
+  struct RoadmapClass;
+
+  size_t getRoadmapClass(const Request& request);
+  void computeVisibilityGraph(RoadmapClass& roadmapClass) const;
+  CrowdRoadmapPtr computeRoadmap(const RoadmapClass& roadmapClass,
+                                 const RVO2::Vector2& goal) const;
+
+private:
+  const RVO2::RVOSimulator* _sim;
+  std::vector<std::unique_ptr<RoadmapClass>> _roadmapClasses;
+  // Roadmap classes indices, by hash of the waypoints and radius
+  std::unordered_multimap<size_t, size_t> _roadmapClassesByHash;
+
+}; // end of class CrowdRoadmapCache
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_NAVIGATION_CROWD_ROADMAP_CACHE_H
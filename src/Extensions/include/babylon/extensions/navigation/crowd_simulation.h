@@ -2,9 +2,11 @@
 #define BABYLON_EXTENSIONS_NAVIGATION_CROWD_SIMULATION_H
 
 #include <babylon/babylon_api.h>
+#include <babylon/extensions/entitycomponentsystem/system_scheduler.h>
 #include <babylon/extensions/entitycomponentsystem/world.h>
 #include <babylon/extensions/navigation/crowd_collision_avoidance_system.h>
 #include <babylon/extensions/navigation/crowd_mesh_updater_system.h>
+#include <babylon/extensions/navigation/crowd_roadmap_cache.h>
 #include <babylon/maths/vector2.h>
 
 namespace BABYLON {
@@ -45,6 +47,8 @@ public:
 
   /* Add a roadmap vertex. */
   void addWayPoint(const BABYLON::Vector2& waypoint);
+  /* Compute the roadmaps of the agents. The roadmaps are shared between the agents having the
+   * same waypoints and radius, and cached by goal until the obstacles are processed again. */
   void computeRoadMap();
 
   /* Set the simulation precision. */
@@ -65,8 +69,12 @@ private:
   CrowdCollisionAvoidanceSystem _crowdCollisionAvoidanceSystem;
   // The mesh updater system
   CrowdMeshUpdaterSystem _crowdMeshUpdaterSystem;
+  // Updates the systems, in parallel where their component accesses allow it
+  ECS::SystemScheduler _systemScheduler;
   // The crowd agents
   std::vector<ECS::Entity> _agents;
+  // The agents roadmaps
+  CrowdRoadmapCache _roadmapCache;
 
 }; // end of class CrowdSimulation
 
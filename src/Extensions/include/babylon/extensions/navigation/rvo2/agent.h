@@ -35,7 +35,7 @@
 
 /**
  * \file       Agent.h
- * \brief      Contains the Agent class.
+ * \brief      Contains the Agents class.
  */
 
 #include <babylon/extensions/navigation/rvo2/definitions.h>
@@ -46,74 +46,72 @@ namespace Extensions {
 namespace RVO2 {
 
 /**
- * \brief      Defines an agent in the simulation.
+ * \brief      Defines the agents in the simulation, stored as structure of
+ *             arrays: the properties of agent i are at index i of each array.
  */
-class Agent {
+class Agents {
 
 private:
   /**
-   * \brief      Constructs an agent instance.
-   * \param      sim             The simulator instance.
+   * \brief      Adds an agent.
+   * \return     The number of the agent.
    */
-  explicit Agent(RVOSimulator* sim);
+  size_t add(const Vector2& position, float neighborDist, size_t maxNeighbors,
+             float timeHorizon, float timeHorizonObst, float radius,
+             float maxSpeed, const Vector2& velocity);
 
   /**
-   * \brief      Computes the neighbors of this agent.
+   * \brief      Returns the number of agents.
    */
-  void computeNeighbors();
+  [[nodiscard]] size_t size() const;
 
   /**
-   * \brief      Computes the new velocity of this agent.
+   * \brief      Computes the neighbors of an agent.
+   * \param      agentNo         The number of the agent.
+   * \param      kdTree          The obstacle <i>k</i>d-tree.
+   * \param      agentGrid       The agent grid, built from the current
+   *                             positions.
    */
-  void computeNewVelocity();
+  void computeNeighbors(size_t agentNo, const KdTree& kdTree,
+                        const AgentGrid& agentGrid);
 
   /**
-   * \brief      Inserts an agent neighbor into the set of neighbors of
-   *             this agent.
-   * \param      agent           A pointer to the agent to be inserted.
-   * \param      rangeSq         The squared range around this agent.
+   * \brief      Computes the new velocity of an agent.
+   * \param      agentNo         The number of the agent.
+   * \param      timeStep        The time step of the simulation.
+   * \param      projLines       Scratch buffer of the linear program.
    */
-  void insertAgentNeighbor(const Agent* agent, float& rangeSq);
-
-  /**
-   * \brief      Inserts a static obstacle neighbor into the set of neighbors
-   *             of this agent.
-   * \param      obstacle        The number of the static obstacle to be
-   *                             inserted.
-   * \param      rangeSq         The squared range around this agent.
-   */
-  void insertObstacleNeighbor(const Obstacle* obstacle, float rangeSq);
+  void computeNewVelocity(size_t agentNo, float timeStep,
+                          std::vector<Line>& projLines);
 
   /**
    * \brief      Updates the two-dimensional position and two-dimensional
-   *             velocity of this agent.
+   *             velocity of an agent.
    */
-  void update();
-
-  std::vector<std::pair<float, const Agent*>> agentNeighbors_;
-  size_t maxNeighbors_;
-  float maxSpeed_;
-  float neighborDist_;
-  Vector2 newVelocity_;
-  std::vector<std::pair<float, const Obstacle*>> obstacleNeighbors_;
-  std::vector<Line> orcaLines_;
-  Vector2 position_;
-  Vector2 prefVelocity_;
-  float radius_;
-  RVOSimulator* sim_;
-  float timeHorizon_;
-  float timeHorizonObst_;
-  Vector2 velocity_;
-
-  size_t id_;
-
-  friend class KdTree;
+  void update(size_t agentNo, float timeStep);
+
+  std::vector<size_t> maxNeighbors_;
+  std::vector<float> maxSpeed_;
+  std::vector<float> neighborDist_;
+  std::vector<Vector2> newVelocity_;
+  std::vector<Vector2> position_;
+  std::vector<Vector2> prefVelocity_;
+  std::vector<float> radius_;
+  std::vector<float> timeHorizon_;
+  std::vector<float> timeHorizonObst_;
+  std::vector<Vector2> velocity_;
+
+  /* Results of the last step. The buffers keep their capacity across steps. */
+  std::vector<std::vector<std::pair<float, size_t>>> agentNeighbors_;
+  std::vector<std::vector<std::pair<float, const Obstacle*>>> obstacleNeighbors_;
+  std::vector<std::vector<Line>> orcaLines_;
+
   friend class RVOSimulator;
 
-}; // end of class Agent
+}; // end of class Agents
 
 /**
- * \relates    Agent
+ * \relates    Agents
  * \brief      Solves a one-dimensional linear program on a specified line
  *             subject to linear constraints defined by lines and a circular
  *             constraint.
@@ -130,7 +128,7 @@ bool linearProgram1(const std::vector<Line>& lines, size_t lineNo, float radius,
                     Vector2& result);
 
 /**
- * \relates    Agent
+ * \relates    Agents
  * \brief      Solves a two-dimensional linear program subject to linear
  *             constraints defined by lines and a circular constraint.
  * \param      lines         Lines defining the linear constraints.
@@ -146,7 +144,7 @@ size_t linearProgram2(const std::vector<Line>& lines, float radius,
                       Vector2& result);
 
 /**
- * \relates    Agent
+ * \relates    Agents
  * \brief      Solves a two-dimensional linear program subject to linear
  *             constraints defined by lines and a circular constraint.
  * \param      lines         Lines defining the linear constraints.
@@ -154,9 +152,11 @@ size_t linearProgram2(const std::vector<Line>& lines, float radius,
  * \param      beginLine     The line on which the 2-d linear program failed.
  * \param      radius        The radius of the circular constraint.
  * \param      result        A reference to the result of the linear program.
+ * \param      projLines     Scratch buffer of the projected lines.
  */
 void linearProgram3(const std::vector<Line>& lines, size_t numObstLines,
-                    size_t beginLine, float radius, Vector2& result);
+                    size_t beginLine, float radius, Vector2& result,
+                    std::vector<Line>& projLines);
 
 } // end of namespace RVO2
 } // end of namespace Extensions
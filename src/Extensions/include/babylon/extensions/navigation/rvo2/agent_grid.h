@@ -0,0 +1,83 @@
+#ifndef BABYLON_EXTENSIONS_NAVIGATION_RVO2_AGENT_GRID_H
+#define BABYLON_EXTENSIONS_NAVIGATION_RVO2_AGENT_GRID_H
+
+/**
+ * \file       AgentGrid.h
+ * \brief      Contains the AgentGrid class.
+ */
+
+#include <utility>
+
+#include <babylon/extensions/navigation/rvo2/definitions.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace RVO2 {
+
+/**
+ * \brief      Defines a uniform grid over the agents, used to find the agent
+ *             neighbors.
+ *
+ * The grid is rebuilt every step with a counting sort of the agents by cell,
+ * which is linear in the number of agents. The agents of a cell are stored
+ * contiguously, together with their positions.
+ */
+class AgentGrid {
+
+private:
+  /**
+   * \brief      Constructs an empty grid.
+   */
+  AgentGrid();
+
+  /**
+   * \brief      Builds the grid.
+   * \param      positions       The positions of the agents.
+   */
+  void build(const std::vector<Vector2>& positions);
+
+  /**
+   * \brief      Computes the agent neighbors of the specified agent, sorted by
+   *             increasing distance.
+   * \param      agentNo         The number of the agent for which agent
+   *                             neighbors are to be computed.
+   * \param      position        The position of the agent when the grid was
+   *                             built.
+   * \param      rangeSq         The squared range around the agent.
+   * \param      maxNeighbors    The maximum number of neighbors.
+   * \param      neighbors       The squared distances and numbers of the
+   *                             neighbors.
+   */
+  void computeAgentNeighbors(size_t agentNo, const Vector2& position, float rangeSq,
+                             size_t maxNeighbors,
+                             std::vector<std::pair<float, size_t>>& neighbors) const;
+
+  /**
+   * \brief      Returns the column or the row of a coordinate.
+   */
+  [[nodiscard]] size_t cellCoordinate(float value, float min, size_t count) const;
+
+  size_t columns_;
+  size_t rows_;
+  float cellSize_;
+  float invCellSize_;
+  float minX_;
+  float minY_;
+
+  /* Index of the first agent of each cell, followed by the agent count. */
+  std::vector<size_t> cellStart_;
+  /* Agent numbers and positions, sorted by cell. */
+  std::vector<size_t> agentNos_;
+  std::vector<Vector2> positions_;
+  std::vector<size_t> agentCells_;
+
+  friend class Agents;
+  friend class RVOSimulator;
+
+}; // end of class AgentGrid
+
+} // end of namespace RVO2
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif /* BABYLON_EXTENSIONS_NAVIGATION_RVO2_AGENT_GRID_H */
@@ -55,7 +55,7 @@ namespace BABYLON {
 namespace Extensions {
 namespace RVO2 {
 
-class Agent;
+class Agents;
 class Obstacle;
 class RVOSimulator;
 
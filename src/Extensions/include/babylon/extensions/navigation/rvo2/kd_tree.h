@@ -38,6 +38,8 @@
  * \brief      Contains the KdTree class.
  */
 
+#include <utility>
+
 #include <babylon/extensions/navigation/rvo2/definitions.h>
 
 namespace BABYLON {
@@ -45,58 +47,12 @@ namespace Extensions {
 namespace RVO2 {
 
 /**
- * \brief      Defines <i>k</i>d-trees for agents and static obstacles in the
- *             simulation.
+ * \brief      Defines the <i>k</i>d-tree for static obstacles in the
+ *             simulation. The agent neighbors are found with the AgentGrid.
  */
 class KdTree {
 
 private:
-  /**
-   * \brief      Defines an agent <i>k</i>d-tree node.
-   */
-  class AgentTreeNode {
-  public:
-    /**
-     * \brief      The beginning node number.
-     */
-    size_t begin;
-
-    /**
-     * \brief      The ending node number.
-     */
-    size_t end;
-
-    /**
-     * \brief      The left node number.
-     */
-    size_t left;
-
-    /**
-     * \brief      The maximum x-coordinate.
-     */
-    float maxX;
-
-    /**
-     * \brief      The maximum y-coordinate.
-     */
-    float maxY;
-
-    /**
-     * \brief      The minimum x-coordinate.
-     */
-    float minX;
-
-    /**
-     * \brief      The minimum y-coordinate.
-     */
-    float minY;
-
-    /**
-     * \brief      The right node number.
-     */
-    size_t right;
-  };
-
   /**
    * \brief      Defines an obstacle <i>k</i>d-tree node.
    */
@@ -129,13 +85,6 @@ private:
    */
   ~KdTree();
 
-  /**
-   * \brief      Builds an agent <i>k</i>d-tree.
-   */
-  void buildAgentTree();
-
-  void buildAgentTreeRecursive(size_t begin, size_t end, size_t node);
-
   /**
    * \brief      Builds an obstacle <i>k</i>d-tree.
    */
@@ -144,20 +93,15 @@ private:
   ObstacleTreeNode* buildObstacleTreeRecursive(const std::vector<Obstacle*>& obstacles);
 
   /**
-   * \brief      Computes the agent neighbors of the specified agent.
-   * \param      agent           A pointer to the agent for which agent
-   *                             neighbors are to be computed.
-   * \param      rangeSq         The squared range around the agent.
-   */
-  void computeAgentNeighbors(Agent* agent, float& rangeSq) const;
-
-  /**
-   * \brief      Computes the obstacle neighbors of the specified agent.
-   * \param      agent           A pointer to the agent for which obstacle
-   *                             neighbors are to be computed.
+   * \brief      Computes the obstacle neighbors of an agent, sorted by
+   *             increasing distance.
+   * \param      position        The position of the agent.
    * \param      rangeSq         The squared range around the agent.
+   * \param      neighbors       The squared distances and obstacles of the
+   *                             neighbors.
    */
-  void computeObstacleNeighbors(Agent* agent, float rangeSq) const;
+  void computeObstacleNeighbors(const Vector2& position, float rangeSq,
+                                std::vector<std::pair<float, const Obstacle*>>& neighbors) const;
 
   /**
    * \brief      Deletes the specified obstacle tree node.
@@ -166,9 +110,17 @@ private:
    */
   void deleteObstacleTree(ObstacleTreeNode* node);
 
-  void queryAgentTreeRecursive(Agent* agent, float& rangeSq, size_t node) const;
+  /**
+   * \brief      Inserts an obstacle in the sorted obstacle neighbors of an
+   *             agent if it is in range.
+   */
+  static void insertObstacleNeighbor(const Vector2& position, const Obstacle* obstacle,
+                                     float rangeSq,
+                                     std::vector<std::pair<float, const Obstacle*>>& neighbors);
 
-  void queryObstacleTreeRecursive(Agent* agent, float rangeSq, const ObstacleTreeNode* node) const;
+  void queryObstacleTreeRecursive(const Vector2& position, float rangeSq,
+                                  const ObstacleTreeNode* node,
+                                  std::vector<std::pair<float, const Obstacle*>>& neighbors) const;
 
   /**
    * \brief      Queries the visibility between two points within a
@@ -187,14 +139,10 @@ private:
   bool queryVisibilityRecursive(const Vector2& q1, const Vector2& q2, float radius,
                                 const ObstacleTreeNode* node) const;
 
-  std::vector<Agent*> agents_;
-  std::vector<AgentTreeNode> agentTree_;
   ObstacleTreeNode* obstacleTree_;
   RVOSimulator* sim_;
 
-  static const size_t MAX_LEAF_SIZE = 10;
-
-  friend class Agent;
+  friend class Agents;
   friend class RVOSimulator;
 
 }; // end of class KdTree
@@ -63,7 +63,7 @@ private:
 
   size_t id_{0};
 
-  friend class Agent;
+  friend class Agents;
   friend class KdTree;
   friend class RVOSimulator;
 
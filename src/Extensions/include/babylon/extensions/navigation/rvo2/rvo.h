@@ -55,9 +55,8 @@
  (ORCA) formulation for multi-agent simulation. <b>RVO2 Library</b>
  automatically
  uses parallelism for computing the motion of the agents if your machine has
- multiple processors and your compiler supports <a
- href="http://www.openmp.org/">
- OpenMP</a>.
+ multiple processors, by running the simulation steps on the thread pool of
+ BabylonCpp.
 
  Please follow the following steps to install and use <b>RVO2 Library</b>.
 
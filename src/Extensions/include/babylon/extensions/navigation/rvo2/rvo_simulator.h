@@ -45,6 +45,9 @@
 #include <babylon/extensions/navigation/rvo2/vector2.h>
 
 namespace BABYLON {
+
+class ThreadPool;
+
 namespace Extensions {
 namespace RVO2 {
 
@@ -72,7 +75,8 @@ public:
   Vector2 direction;
 };
 
-class Agent;
+class AgentGrid;
+class Agents;
 class KdTree;
 class Obstacle;
 
@@ -80,6 +84,9 @@ class Obstacle;
  * \brief      Defines the simulation.
  *
  * The main class of the library that contains all simulation functionality.
+ * The agents are stored as structure of arrays and the simulation steps are
+ * run in chunks of agents on a thread pool. Each agent only reads the state of
+ * the previous step, so the results do not depend on the number of threads.
  */
 class RVOSimulator {
 
@@ -569,6 +576,13 @@ public:
    */
   void setAgentVelocity(size_t agentNo, const Vector2& velocity);
 
+  /**
+   * \brief      Sets the thread pool running the simulation steps.
+   * \param      threadPool      The thread pool, or nullptr to use the
+   *                             default thread pool.
+   */
+  void setThreadPool(ThreadPool* threadPool);
+
   /**
    * \brief      Sets the time step of the simulation.
    * \param      timeStep        The time step of the simulation.
@@ -577,14 +591,31 @@ public:
   void setTimeStep(float timeStep);
 
 private:
-  std::vector<Agent*> agents_;
-  Agent* defaultAgent_;
+  /**
+   * \brief      Defines the default properties of a new agent.
+   */
+  struct AgentDefaults {
+    size_t maxNeighbors;
+    float maxSpeed;
+    float neighborDist;
+    float radius;
+    float timeHorizon;
+    float timeHorizonObst;
+    Vector2 velocity;
+  };
+
+  AgentGrid* agentGrid_;
+  Agents* agents_;
+  AgentDefaults* defaultAgent_;
   float globalTime_{0.0f};
   KdTree* kdTree_;
   std::vector<Obstacle*> obstacles_;
+  /* Scratch buffers of the linear programs, by worker. */
+  std::vector<std::vector<Line>> projLines_;
+  ThreadPool* threadPool_;
   float timeStep_{0.0f};
 
-  friend class Agent;
+  friend class Agents;
   friend class KdTree;
   friend class Obstacle;
 
@@ -7,6 +7,9 @@
 #include <babylon/babylon_common.h>
 
 namespace BABYLON {
+
+class ThreadPool;
+
 namespace Extensions {
 
 template <typename T>
@@ -73,9 +76,41 @@ public:
    */
   [[nodiscard]] double noise(double x, double y, double z) const;
 
+  /**
+   * @brief Computes the 3D Perlin noise of count points, given by their coordinate arrays.
+   * The points are processed in batches the compiler vectorizes.
+   * @param x X values.
+   * @param y Y values.
+   * @param z Z values.
+   * @param count Number of points.
+   * @param result Noise values of the points.
+   */
+  void noise(const double* x, const double* y, const double* z, size_t count,
+             double* result) const;
+
+  /**
+   * @brief Fills result with the Perlin noise of a grid of columns x rows points, row by row. The
+   * rows are split across the thread pool.
+   * @param x X value of the first point.
+   * @param y Y value of the first point.
+   * @param z Z value of the grid.
+   * @param step Distance between two points.
+   * @param columns Number of points per row.
+   * @param rows Number of rows.
+   * @param result Noise values of the grid.
+   */
+  void noiseGrid(double x, double y, double z, double step, size_t columns, size_t rows,
+                 Float64Array& result) const;
+
+  /**
+   * @brief Sets the thread pool filling the grids, nullptr to use the default thread pool.
+   */
+  void setThreadPool(ThreadPool* threadPool);
+
 private:
   // The permutation vector
   std::array<int, 512> p;
+  ThreadPool* _threadPool;
 
 }; // end of class PerlinNoise
 
@@ -10,6 +10,7 @@
 
 namespace BABYLON {
 
+class ThreadPool;
 class Vector2;
 class Vector3;
 class Vector4;
@@ -364,6 +365,47 @@ public:
 
   // -----------------------------------------------------------------------------------------------
 
+  /**
+   * @brief Computes the 2D simplex noise of count points, given by their coordinate arrays.
+   * The points are processed in batches the compiler vectorizes, the results match noise(Vector2)
+   * up to the floating point rounding.
+   */
+  void noise(const float* x, const float* y, size_t count, float* result) const;
+
+  /**
+   * @brief Computes the 3D simplex noise of count points, given by their coordinate arrays.
+   */
+  void noise(const float* x, const float* y, const float* z, size_t count, float* result) const;
+
+  /**
+   * @brief Fills result with the 2D simplex noise of a grid of columns x rows points spaced by
+   * step, starting at origin, row by row. The rows are split across the thread pool.
+   */
+  void noiseGrid(const Vector2& origin, float step, size_t columns, size_t rows,
+                 Float32Array& result) const;
+
+  /**
+   * @brief Fills result with the 3D simplex noise of a grid of columns x rows x layers points
+   * spaced by step, starting at origin, layer by layer and row by row.
+   */
+  void noiseGrid(const Vector3& origin, float step, size_t columns, size_t rows, size_t layers,
+                 Float32Array& result) const;
+
+  /**
+   * @brief Fills result with the 2D simplex noise fractal brownian motion sum of a grid of columns
+   * x rows points spaced by step, starting at origin, row by row.
+   */
+  void fBmGrid(const Vector2& origin, float step, size_t columns, size_t rows,
+               Float32Array& result, uint8_t octaves = 4, float lacunarity = 2.0f,
+               float gain = 0.5f) const;
+
+  /**
+   * @brief Sets the thread pool filling the grids, nullptr to use the default thread pool.
+   */
+  void setThreadPool(ThreadPool* threadPool);
+
+  // -----------------------------------------------------------------------------------------------
+
   /**
    * @brief Seeds the permutation table with new random values.
    */
@@ -419,6 +461,8 @@ private:
    */
   std::array<unsigned char, 512> perm;
 
+  ThreadPool* _threadPool;
+
 }; // end of class SimplexNoise
 
 } // end of namespace Extensions
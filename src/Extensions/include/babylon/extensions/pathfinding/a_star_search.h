@@ -2,9 +2,12 @@
 #define BABYLON_EXTENSIONS_PATH_FINDING_A_STAR_SEARCH_H
 
 #include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <queue>
-#include <unordered_map>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <babylon/babylon_api.h>
 
@@ -47,54 +50,197 @@ struct AStarNode {
   bool visited;
 }; // end of struct
 
+/**
+ * @brief Reusable state of the A* searches over a graph whose node ids are indices in [0, size()).
+ *
+ * The nodes are stored in flat arrays which are kept from one search to the next. A generation
+ * counter tells which nodes were reached by the current search, so the arrays are never cleared,
+ * and the open list is a binary heap in a reused vector: once the arrays have grown to the size of
+ * the graph, a search does not allocate memory.
+ *
+ * A context is used by one search at a time.
+ */
+template <typename NodeId = std::size_t>
+class AStarContext {
+
+public:
+  /**
+   * @brief Starts a search.
+   * @param nodeCount the number of nodes of the graph
+   * @param start the start node
+   * @param startFScore the heuristic cost estimate from the start node to the goal
+   */
+  void begin(std::size_t nodeCount, NodeId start, double startFScore)
+  {
+    if (_generations.size() < nodeCount) {
+      _nodes.resize(nodeCount);
+      _generations.resize(nodeCount, 0);
+    }
+
+    if (++_generation == 0) {
+      std::fill(_generations.begin(), _generations.end(), 0);
+      _generation = 1;
+    }
+
+    _openList.clear();
+    reach(start, start, 0.0, startFScore);
+  }
+
+  /**
+   * @brief Removes the open node with the lowest fScore, the ties being broken by the lowest id.
+   * @return false if there is no open node left
+   */
+  bool pop(NodeId& current)
+  {
+    while (!_openList.empty()) {
+      std::pop_heap(_openList.begin(), _openList.end(), std::greater<OpenNode>());
+      const auto [fScore, id] = _openList.back();
+      _openList.pop_back();
+
+      // Skip the entries pushed before the gScore of the node was improved
+      if (fScore <= _nodes[static_cast<std::size_t>(id)].fScore) {
+        current = id;
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * @brief Returns whether reaching a node with the given gScore improves the path to that node.
+   */
+  [[nodiscard]] bool improves(NodeId id, double gScore) const
+  {
+    return !isReached(id) || gScore < _nodes[static_cast<std::size_t>(id)].gScore;
+  }
+
+  /**
+   * @brief Records the path to a node and opens it.
+   */
+  void reach(NodeId id, NodeId cameFrom, double gScore, double fScore)
+  {
+    const auto index    = static_cast<std::size_t>(id);
+    _nodes[index]       = AStarNode<NodeId>{cameFrom, gScore, fScore, true};
+    _generations[index] = _generation;
+    _openList.emplace_back(fScore, id);
+    std::push_heap(_openList.begin(), _openList.end(), std::greater<OpenNode>());
+  }
+
+  /**
+   * @brief Returns whether the node was reached by the current search.
+   */
+  [[nodiscard]] bool isReached(NodeId id) const
+  {
+    return _generations[static_cast<std::size_t>(id)] == _generation;
+  }
+
+  /**
+   * @brief Returns the node state of a node reached by the current search.
+   */
+  [[nodiscard]] const AStarNode<NodeId>& node(NodeId id) const
+  {
+    return _nodes[static_cast<std::size_t>(id)];
+  }
+
+  /**
+   * @brief Writes the path from the start node to a reached node.
+   */
+  void reconstructPath(NodeId last, std::vector<NodeId>& path) const
+  {
+    path.clear();
+    auto current = last;
+    path.emplace_back(current);
+    while (node(current).cameFrom != current) {
+      current = node(current).cameFrom;
+      path.emplace_back(current);
+    }
+    std::reverse(path.begin(), path.end());
+  }
+
+private:
+  using OpenNode = std::pair<double, NodeId>;
+
+  std::vector<AStarNode<NodeId>> _nodes;
+  std::vector<std::uint32_t> _generations;
+  std::vector<OpenNode> _openList;
+  std::uint32_t _generation = 0;
+
+}; // end of class AStarContext
+
+namespace detail {
+
+template <typename Graph, typename = void>
+struct HasForEachNeighbor : std::false_type {
+};
+
 template <typename Graph>
-std::vector<typename Graph::NodeId> AStarSearch(Graph& graph, typename Graph::Node& start,
-                                                typename Graph::Node& goal)
+struct HasForEachNeighbor<Graph, std::void_t<decltype(std::declval<const Graph&>().forEachNeighbor(
+                                   std::declval<typename Graph::NodeId>(),
+                                   std::declval<void (*)(const typename Graph::Node&)>()))>>
+    : std::true_type {
+};
+
+} // end of namespace detail
+
+/**
+ * @brief Finds the path from start to goal, reusing the given context and path vectors.
+ *
+ * The node ids of the graph must be indices in [0, graph.size()). The graph provides the neighbors
+ * of a node either with forEachNeighbor(id, func), which does not allocate memory, or with
+ * neighbors(id).
+ *
+ * @return false if the goal cannot be reached, the path being empty
+ */
+template <typename Graph>
+bool AStarSearch(Graph& graph, typename Graph::Node& start, typename Graph::Node& goal,
+                 AStarContext<typename Graph::NodeId>& context,
+                 std::vector<typename Graph::NodeId>& path)
 {
   using NodeId = typename Graph::NodeId;
-  std::vector<NodeId> path;
-  PriorityQueue<NodeId, double> frontier;
-  frontier.put(start.id, 0);
-
-  std::unordered_map<NodeId, AStarNode<NodeId>> aStarNodes(graph.size());
-  aStarNodes[start.id] = AStarNode<NodeId>{
-    start.id,                                 // cameFrom
-    0.0,                                      // gScore
-    graph.heuristicCostEstimate(start, goal), // fScore
-    true                                      // visited
-  };
-
-  while (!frontier.empty()) {
-    // The node in frontier having the lowest fScore
-    auto current = frontier.get();
+  path.clear();
+  context.begin(graph.size(), start.id, graph.heuristicCostEstimate(start, goal));
 
+  NodeId current;
+  while (context.pop(current)) {
     if (current == goal.id) {
-      while (aStarNodes[current].cameFrom != start.id) {
-        path.emplace_back(current);
-        current = aStarNodes[current].cameFrom;
-      }
-      path.emplace_back(current);
-      path.emplace_back(start.id);
-      std::reverse(path.begin(), path.end());
-      break;
+      context.reconstructPath(current, path);
+      return true;
     }
 
-    for (auto&& next : graph.neighbors(current)) {
+    const auto gScore    = context.node(current).gScore;
+    const auto visitNext = [&](const typename Graph::Node& next) {
       // The distance from start to a neighbor
-      const auto tentative_gScore = aStarNodes[current].gScore + graph.cost(current, next);
-      if (!aStarNodes.count(next.id)) {
-        aStarNodes[next.id] = AStarNode<NodeId>{0, 0.0, 0.0, false};
+      const auto tentative_gScore = gScore + graph.cost(current, next);
+      if (context.improves(next.id, tentative_gScore)) {
+        context.reach(next.id, current, tentative_gScore,
+                      tentative_gScore + graph.heuristicCostEstimate(next, goal));
       }
-      auto& neighbor = aStarNodes[next.id];
-      if (!neighbor.visited || tentative_gScore < neighbor.gScore) {
-        neighbor.visited  = true;
-        neighbor.cameFrom = current;
-        neighbor.gScore   = tentative_gScore;
-        neighbor.fScore   = tentative_gScore + graph.heuristicCostEstimate(next, goal);
-        frontier.put(next.id, neighbor.fScore);
+    };
+
+    if constexpr (detail::HasForEachNeighbor<Graph>::value) {
+      graph.forEachNeighbor(current, visitNext);
+    }
+    else {
+      for (auto&& next : graph.neighbors(current)) {
+        visitNext(next);
       }
     }
   }
+
+  return false;
+}
+
+/**
+ * @brief Finds the path from start to goal, using a search context per thread.
+ */
+template <typename Graph>
+std::vector<typename Graph::NodeId> AStarSearch(Graph& graph, typename Graph::Node& start,
+                                                typename Graph::Node& goal)
+{
+  thread_local AStarContext<typename Graph::NodeId> context;
+  std::vector<typename Graph::NodeId> path;
+  AStarSearch(graph, start, goal, context, path);
   return path;
 }
 
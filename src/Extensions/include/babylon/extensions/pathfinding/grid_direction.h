@@ -0,0 +1,60 @@
+#ifndef BABYLON_EXTENSIONS_PATH_FINDING_GRID_DIRECTION_H
+#define BABYLON_EXTENSIONS_PATH_FINDING_GRID_DIRECTION_H
+
+#include <array>
+#include <cstddef>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+/**
+ * @brief The moves on a 4-connected grid.
+ *
+ * The uniform grid searches use grids providing rows(), columns() and canMove(row, column,
+ * direction), which tells whether the cell next to a cell in the given direction can be entered
+ * from it. Each move costs 1.
+ */
+enum class GridDirection { Up, Left, Right, Down };
+
+constexpr std::array<GridDirection, 4> GridDirections{GridDirection::Up, GridDirection::Left,
+                                                      GridDirection::Right, GridDirection::Down};
+
+/**
+ * @brief Returns the row offset of a move.
+ */
+constexpr std::ptrdiff_t rowOffset(GridDirection direction)
+{
+  return direction == GridDirection::Up ? -1 : direction == GridDirection::Down ? 1 : 0;
+}
+
+/**
+ * @brief Returns the column offset of a move.
+ */
+constexpr std::ptrdiff_t columnOffset(GridDirection direction)
+{
+  return direction == GridDirection::Left ? -1 : direction == GridDirection::Right ? 1 : 0;
+}
+
+/**
+ * @brief Returns the opposite move.
+ */
+constexpr GridDirection opposite(GridDirection direction)
+{
+  switch (direction) {
+    case GridDirection::Up:
+      return GridDirection::Down;
+    case GridDirection::Left:
+      return GridDirection::Right;
+    case GridDirection::Right:
+      return GridDirection::Left;
+    default:
+      return GridDirection::Up;
+  }
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_PATH_FINDING_GRID_DIRECTION_H
@@ -0,0 +1,531 @@
+#ifndef BABYLON_EXTENSIONS_PATH_FINDING_HIERARCHICAL_PATH_FINDER_H
+#define BABYLON_EXTENSIONS_PATH_FINDING_HIERARCHICAL_PATH_FINDER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/extensions/pathfinding/a_star_search.h>
+#include <babylon/extensions/pathfinding/grid_direction.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+/**
+ * @brief Hierarchical path finding (HPA*) over a 4-connected uniform grid.
+ *
+ * The grid is split in square clusters. The open crossings along the border of two clusters are
+ * grouped in runs, and each run gives one entrance, or two for long runs: the cells on both sides
+ * of an entrance are portals. The portals of a cluster are linked by their shortest distances
+ * inside the cluster. A query searches the graph of the portals, from the start and to the goal
+ * linked to the portals of their clusters, then refines each step of the abstract path inside its
+ * cluster. The paths are near optimal, and much cheaper to find than with A* on large grids.
+ *
+ * When cells change, updateCell() marks the clusters and borders touching them, which are rebuilt
+ * on the next query: the other clusters are kept.
+ *
+ * The grid provides rows(), columns() and canMove(row, column, direction) (see GridDirection), the
+ * cells being numbered row by row, and each move costs 1. Only the crossings open both ways are
+ * used as entrances. The path finder keeps its search state between the queries and is used by
+ * one thread at a time.
+ */
+template <typename Grid>
+class HierarchicalPathFinder {
+
+public:
+  /**
+   * @brief Creates the abstraction of a grid, which is built on the first query.
+   * @param grid the grid, which must outlive the path finder
+   * @param clusterSize the number of rows and columns of the clusters
+   */
+  explicit HierarchicalPathFinder(const Grid& grid, std::size_t clusterSize = 16)
+      : _grid{grid}
+      , _clusterSize{std::max<std::size_t>(clusterSize, 2)}
+      , _clusterRows{(grid.rows() + _clusterSize - 1) / _clusterSize}
+      , _clusterColumns{(grid.columns() + _clusterSize - 1) / _clusterSize}
+      , _clusters(_clusterRows * _clusterColumns)
+      , _rightBorders(_clusters.size())
+      , _bottomBorders(_clusters.size())
+      , _isDirty{true}
+  {
+    for (std::size_t i = 0; i < _clusters.size(); ++i) {
+      auto& cluster             = _clusters[i];
+      cluster.row               = (i / _clusterColumns) * _clusterSize;
+      cluster.column            = (i % _clusterColumns) * _clusterSize;
+      cluster.rows              = std::min(_clusterSize, grid.rows() - cluster.row);
+      cluster.columns           = std::min(_clusterSize, grid.columns() - cluster.column);
+      cluster.isDirty           = true;
+      _rightBorders[i].isDirty  = true;
+      _bottomBorders[i].isDirty = true;
+    }
+  }
+
+  /**
+   * @brief Marks a cell as changed, its clusters being rebuilt on the next query.
+   */
+  void updateCell(std::size_t row, std::size_t column)
+  {
+    const auto clusterRow    = row / _clusterSize;
+    const auto clusterColumn = column / _clusterSize;
+    const auto index         = clusterRow * _clusterColumns + clusterColumn;
+    _clusters[index].isDirty = true;
+
+    // The moves into the cell from the next clusters cross their borders
+    if (row % _clusterSize == 0 && clusterRow > 0) {
+      markBorderDirty(_bottomBorders, index - _clusterColumns, index);
+    }
+    if ((row + 1) % _clusterSize == 0 && clusterRow + 1 < _clusterRows) {
+      markBorderDirty(_bottomBorders, index, index + _clusterColumns);
+    }
+    if (column % _clusterSize == 0 && clusterColumn > 0) {
+      markBorderDirty(_rightBorders, index - 1, index);
+    }
+    if ((column + 1) % _clusterSize == 0 && clusterColumn + 1 < _clusterColumns) {
+      markBorderDirty(_rightBorders, index, index + 1);
+    }
+    _isDirty = true;
+  }
+
+  /**
+   * @brief Rebuilds the changed clusters.
+   */
+  void update()
+  {
+    if (!_isDirty) {
+      return;
+    }
+
+    for (std::size_t i = 0; i < _clusters.size(); ++i) {
+      if (_rightBorders[i].isDirty) {
+        buildBorder(i, true);
+      }
+      if (_bottomBorders[i].isDirty) {
+        buildBorder(i, false);
+      }
+    }
+
+    _portalOffsets.resize(_clusters.size() + 1);
+    _portalOffsets[0] = 0;
+    for (std::size_t i = 0; i < _clusters.size(); ++i) {
+      if (_clusters[i].isDirty) {
+        buildCluster(i);
+      }
+      _portalOffsets[i + 1] = _portalOffsets[i] + _clusters[i].portals.size();
+    }
+
+    _isDirty = false;
+  }
+
+  /**
+   * @brief Returns the number of portals of the abstraction.
+   */
+  [[nodiscard]] std::size_t portalCount()
+  {
+    update();
+    return _portalOffsets.back();
+  }
+
+  /**
+   * @brief Finds a path between two cells, reusing the given path vector.
+   * @return false if the goal cannot be reached, the path being empty
+   */
+  bool findPath(std::size_t start, std::size_t goal, std::vector<std::size_t>& path)
+  {
+    update();
+    path.clear();
+
+    const auto startCluster = clusterOf(start);
+    const auto goalCluster  = clusterOf(goal);
+
+    // Link the start and the goal to the portals of their clusters
+    searchCluster(startCluster, start, false);
+    const auto& startPortals = _clusters[startCluster].portals;
+    _startDistances.resize(startPortals.size());
+    for (std::size_t i = 0; i < startPortals.size(); ++i) {
+      _startDistances[i] = _distances[localIndex(startCluster, startPortals[i].cell)];
+    }
+    const auto directDistance
+      = startCluster == goalCluster ? _distances[localIndex(goalCluster, goal)] : Unreachable;
+
+    searchCluster(goalCluster, goal, true);
+    const auto& goalPortals = _clusters[goalCluster].portals;
+    _goalDistances.resize(goalPortals.size());
+    for (std::size_t i = 0; i < goalPortals.size(); ++i) {
+      _goalDistances[i] = _distances[localIndex(goalCluster, goalPortals[i].cell)];
+    }
+
+    // Search the abstract graph, whose nodes are the start, the goal and the portals
+    const auto cellOf = [&](std::size_t node) {
+      return node == StartNode ? start : node == GoalNode ? goal : portalOf(node).cell;
+    };
+
+    _context.begin(_portalOffsets.back() + 2, StartNode, distance(start, goal));
+    std::size_t current;
+    while (_context.pop(current)) {
+      if (current == GoalNode) {
+        _context.reconstructPath(current, _abstractPath);
+        refinePath(cellOf, path);
+        return true;
+      }
+
+      const auto gScore = _context.node(current).gScore;
+      const auto visit  = [&](std::size_t next, std::uint32_t cost) {
+        const auto tentative_gScore = gScore + cost;
+        if (_context.improves(next, tentative_gScore)) {
+          _context.reach(next, current, tentative_gScore,
+                         tentative_gScore + distance(cellOf(next), goal));
+        }
+      };
+
+      if (current == StartNode) {
+        for (std::size_t i = 0; i < startPortals.size(); ++i) {
+          if (_startDistances[i] != Unreachable) {
+            visit(portalNode(startCluster, i), _startDistances[i]);
+          }
+        }
+        if (directDistance != Unreachable) {
+          visit(GoalNode, directDistance);
+        }
+        continue;
+      }
+
+      const auto clusterIndex = clusterOfNode(current);
+      const auto portalIndex  = current - 2 - _portalOffsets[clusterIndex];
+      const auto& cluster     = _clusters[clusterIndex];
+      const auto& portal      = cluster.portals[portalIndex];
+      const auto portalsSize  = cluster.portals.size();
+      for (std::size_t i = 0; i < portalsSize; ++i) {
+        const auto cost = cluster.distances[portalIndex * portalsSize + i];
+        if (i != portalIndex && cost != Unreachable) {
+          visit(portalNode(clusterIndex, i), cost);
+        }
+      }
+      for (auto partner : portal.partners) {
+        if (partner != NoPartner) {
+          visit(nodeOfPortalCell(partner), 1);
+        }
+      }
+      if (clusterIndex == goalCluster && _goalDistances[portalIndex] != Unreachable) {
+        visit(GoalNode, _goalDistances[portalIndex]);
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * @brief Finds a path between two cells.
+   */
+  std::vector<std::size_t> findPath(std::size_t start, std::size_t goal)
+  {
+    std::vector<std::size_t> path;
+    findPath(start, goal, path);
+    return path;
+  }
+
+private:
+  static constexpr std::uint32_t Unreachable = std::numeric_limits<std::uint32_t>::max();
+  static constexpr std::size_t NoPartner     = std::numeric_limits<std::size_t>::max();
+  static constexpr std::size_t StartNode     = 0;
+  static constexpr std::size_t GoalNode      = 1;
+  // Runs of open crossings at least that long have an entrance at each end
+  static constexpr std::size_t LongRunLength = 6;
+
+  struct Portal {
+    std::size_t cell;
+    // The cells of the next clusters, a corner cell having two
+    std::size_t partners[2];
+  };
+
+  struct Cluster {
+    std::size_t row;
+    std::size_t column;
+    std::size_t rows;
+    std::size_t columns;
+    std::vector<Portal> portals;
+    // Distances between the portals inside the cluster, row by row
+    std::vector<std::uint32_t> distances;
+    bool isDirty;
+  };
+
+  struct Border {
+    // The cells on both sides of the entrances
+    std::vector<std::pair<std::size_t, std::size_t>> entrances;
+    bool isDirty;
+  };
+
+  void markBorderDirty(std::vector<Border>& borders, std::size_t cluster,
+                       std::size_t nextCluster)
+  {
+    borders[cluster].isDirty       = true;
+    _clusters[cluster].isDirty     = true;
+    _clusters[nextCluster].isDirty = true;
+  }
+
+  [[nodiscard]] std::size_t clusterOf(std::size_t cell) const
+  {
+    return (cell / _grid.columns() / _clusterSize) * _clusterColumns
+           + (cell % _grid.columns()) / _clusterSize;
+  }
+
+  [[nodiscard]] std::size_t clusterOfNode(std::size_t node) const
+  {
+    return static_cast<std::size_t>(
+             std::upper_bound(_portalOffsets.begin(), _portalOffsets.end(), node - 2)
+             - _portalOffsets.begin())
+           - 1;
+  }
+
+  [[nodiscard]] std::size_t portalNode(std::size_t cluster, std::size_t portal) const
+  {
+    return 2 + _portalOffsets[cluster] + portal;
+  }
+
+  [[nodiscard]] const Portal& portalOf(std::size_t node) const
+  {
+    const auto cluster = clusterOfNode(node);
+    return _clusters[cluster].portals[node - 2 - _portalOffsets[cluster]];
+  }
+
+  // The partners of the portals of a cluster are portals of the next clusters
+  [[nodiscard]] std::size_t nodeOfPortalCell(std::size_t cell) const
+  {
+    const auto cluster  = clusterOf(cell);
+    const auto& portals = _clusters[cluster].portals;
+    std::size_t i       = 0;
+    while (portals[i].cell != cell) {
+      ++i;
+    }
+    return portalNode(cluster, i);
+  }
+
+  [[nodiscard]] std::size_t localIndex(std::size_t cluster, std::size_t cell) const
+  {
+    const auto& c = _clusters[cluster];
+    return (cell / _grid.columns() - c.row) * c.columns + (cell % _grid.columns() - c.column);
+  }
+
+  [[nodiscard]] double distance(std::size_t cell1, std::size_t cell2) const
+  {
+    const auto columns = _grid.columns();
+    const auto row1 = cell1 / columns, row2 = cell2 / columns;
+    const auto col1 = cell1 % columns, col2 = cell2 % columns;
+    return static_cast<double>((row1 > row2 ? row1 - row2 : row2 - row1)
+                               + (col1 > col2 ? col1 - col2 : col2 - col1));
+  }
+
+  void buildBorder(std::size_t clusterIndex, bool isRightBorder)
+  {
+    auto& border = isRightBorder ? _rightBorders[clusterIndex] : _bottomBorders[clusterIndex];
+    border.entrances.clear();
+    border.isDirty = false;
+
+    const auto& cluster = _clusters[clusterIndex];
+    if ((isRightBorder && cluster.column + cluster.columns >= _grid.columns())
+        || (!isRightBorder && cluster.row + cluster.rows >= _grid.rows())) {
+      return;
+    }
+
+    // The cells along the border, on both sides
+    const auto columns   = _grid.columns();
+    const auto length    = isRightBorder ? cluster.rows : cluster.columns;
+    const auto firstCell = isRightBorder ?
+                             cluster.row * columns + cluster.column + cluster.columns - 1 :
+                             (cluster.row + cluster.rows - 1) * columns + cluster.column;
+    const auto step      = isRightBorder ? columns : 1;
+    const auto across    = isRightBorder ? 1 : columns;
+    const auto direction = isRightBorder ? GridDirection::Right : GridDirection::Down;
+    const auto along     = isRightBorder ? GridDirection::Down : GridDirection::Right;
+    const auto isOpen    = [&](std::size_t i) {
+      const auto cell = firstCell + i * step;
+      return canMove(cell, direction) && canMove(cell + across, opposite(direction));
+    };
+    // Whether the cells of a crossing are linked to the cells of the previous one on both sides,
+    // so that all the crossings of a run are reached from its entrances
+    const auto isLinked = [&](std::size_t i) {
+      const auto cell = firstCell + (i - 1) * step;
+      return canMove(cell, along) && canMove(cell + step, opposite(along))
+             && canMove(cell + across, along) && canMove(cell + across + step, opposite(along));
+    };
+
+    const auto addEntrance = [&](std::size_t i) {
+      const auto cell = firstCell + i * step;
+      border.entrances.emplace_back(cell, cell + across);
+    };
+
+    for (std::size_t i = 0; i < length;) {
+      if (!isOpen(i)) {
+        ++i;
+        continue;
+      }
+      const auto runStart = i++;
+      while (i < length && isOpen(i) && isLinked(i)) {
+        ++i;
+      }
+      if (i - runStart >= LongRunLength) {
+        addEntrance(runStart);
+        addEntrance(i - 1);
+      }
+      else {
+        addEntrance(runStart + (i - runStart) / 2);
+      }
+    }
+  }
+
+  void buildCluster(std::size_t clusterIndex)
+  {
+    auto& cluster = _clusters[clusterIndex];
+    cluster.portals.clear();
+    cluster.isDirty = false;
+
+    const auto addPortal = [&cluster](std::size_t cell, std::size_t partner) {
+      for (auto& portal : cluster.portals) {
+        if (portal.cell == cell) {
+          portal.partners[1] = partner;
+          return;
+        }
+      }
+      cluster.portals.emplace_back(Portal{cell, {partner, NoPartner}});
+    };
+
+    const auto clusterRow    = clusterIndex / _clusterColumns;
+    const auto clusterColumn = clusterIndex % _clusterColumns;
+    if (clusterColumn > 0) {
+      for (const auto& [left, right] : _rightBorders[clusterIndex - 1].entrances) {
+        addPortal(right, left);
+      }
+    }
+    for (const auto& [left, right] : _rightBorders[clusterIndex].entrances) {
+      addPortal(left, right);
+    }
+    if (clusterRow > 0) {
+      for (const auto& [up, down] : _bottomBorders[clusterIndex - _clusterColumns].entrances) {
+        addPortal(down, up);
+      }
+    }
+    for (const auto& [up, down] : _bottomBorders[clusterIndex].entrances) {
+      addPortal(up, down);
+    }
+
+    const auto portalsSize = cluster.portals.size();
+    cluster.distances.assign(portalsSize * portalsSize, Unreachable);
+    for (std::size_t i = 0; i < portalsSize; ++i) {
+      searchCluster(clusterIndex, cluster.portals[i].cell, false);
+      for (std::size_t j = 0; j < portalsSize; ++j) {
+        cluster.distances[i * portalsSize + j]
+          = _distances[localIndex(clusterIndex, cluster.portals[j].cell)];
+      }
+    }
+  }
+
+  [[nodiscard]] GridDirection directionTo(std::size_t cell, std::size_t next) const
+  {
+    if (next / _grid.columns() == cell / _grid.columns()) {
+      return next > cell ? GridDirection::Right : GridDirection::Left;
+    }
+    return next > cell ? GridDirection::Down : GridDirection::Up;
+  }
+
+  [[nodiscard]] bool canMove(std::size_t cell, GridDirection direction) const
+  {
+    return _grid.canMove(cell / _grid.columns(), cell % _grid.columns(), direction);
+  }
+
+  /**
+   * Breadth first search inside a cluster, from a cell or, reversed, to a cell: fills the
+   * distances and the parents of the cells of the cluster.
+   */
+  void searchCluster(std::size_t clusterIndex, std::size_t source, bool isReversed)
+  {
+    const auto& cluster = _clusters[clusterIndex];
+    const auto columns  = _grid.columns();
+    _distances.assign(cluster.rows * cluster.columns, Unreachable);
+    _parents.resize(_distances.size());
+    _queue.clear();
+
+    _distances[localIndex(clusterIndex, source)] = 0;
+    _queue.emplace_back(source);
+    for (std::size_t head = 0; head < _queue.size(); ++head) {
+      const auto cell     = _queue[head];
+      const auto row      = cell / columns;
+      const auto column   = cell % columns;
+      const auto distance = _distances[localIndex(clusterIndex, cell)] + 1;
+      for (auto direction : GridDirections) {
+        const auto nextRow    = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(row)
+                                                      + rowOffset(direction));
+        const auto nextColumn = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(column)
+                                                         + columnOffset(direction));
+        if (nextRow - cluster.row >= cluster.rows
+            || nextColumn - cluster.column >= cluster.columns) {
+          continue;
+        }
+        const auto next = nextRow * columns + nextColumn;
+        const auto isOpen
+          = isReversed ? canMove(next, opposite(direction)) : canMove(cell, direction);
+        auto& nextDistance = _distances[localIndex(clusterIndex, next)];
+        if (isOpen && nextDistance == Unreachable) {
+          nextDistance                             = distance;
+          _parents[localIndex(clusterIndex, next)] = cell;
+          _queue.emplace_back(next);
+        }
+      }
+    }
+  }
+
+  template <typename CellOf>
+  void refinePath(const CellOf& cellOf, std::vector<std::size_t>& path)
+  {
+    path.emplace_back(cellOf(_abstractPath.front()));
+    for (std::size_t i = 1; i < _abstractPath.size(); ++i) {
+      const auto from = path.back();
+      const auto to   = cellOf(_abstractPath[i]);
+      if (from == to) {
+        continue;
+      }
+      if (distance(from, to) == 1.0 && canMove(from, directionTo(from, to))) {
+        path.emplace_back(to);
+        continue;
+      }
+
+      // Both cells are in the same cluster, walk back the parents from the last one
+      const auto cluster = clusterOf(from);
+      searchCluster(cluster, from, false);
+      const auto size = path.size();
+      for (auto cell = to; cell != from; cell = _parents[localIndex(cluster, cell)]) {
+        path.emplace_back(cell);
+      }
+      std::reverse(path.begin() + static_cast<std::ptrdiff_t>(size), path.end());
+    }
+  }
+
+  const Grid& _grid;
+  std::size_t _clusterSize;
+  std::size_t _clusterRows;
+  std::size_t _clusterColumns;
+  std::vector<Cluster> _clusters;
+  // The border of each cluster with the next cluster on the right, and below
+  std::vector<Border> _rightBorders;
+  std::vector<Border> _bottomBorders;
+  // Index of the first portal of each cluster in the abstract graph, followed by the portal count
+  std::vector<std::size_t> _portalOffsets;
+  bool _isDirty;
+
+  // Search state, kept between the queries
+  AStarContext<std::size_t> _context;
+  std::vector<std::size_t> _abstractPath;
+  std::vector<std::uint32_t> _startDistances;
+  std::vector<std::uint32_t> _goalDistances;
+  std::vector<std::uint32_t> _distances;
+  std::vector<std::size_t> _parents;
+  std::vector<std::size_t> _queue;
+
+}; // end of class HierarchicalPathFinder
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_PATH_FINDING_HIERARCHICAL_PATH_FINDER_H
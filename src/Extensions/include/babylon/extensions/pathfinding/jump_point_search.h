@@ -0,0 +1,195 @@
+#ifndef BABYLON_EXTENSIONS_PATH_FINDING_JUMP_POINT_SEARCH_H
+#define BABYLON_EXTENSIONS_PATH_FINDING_JUMP_POINT_SEARCH_H
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/extensions/pathfinding/a_star_search.h>
+#include <babylon/extensions/pathfinding/grid_direction.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+namespace detail {
+
+/**
+ * @brief The jumps of a jump point search over a 4-connected uniform grid.
+ *
+ * A jump goes straight from a jump point until it reaches a cell where the search has to branch.
+ * Horizontal jumps do not branch: the cells above and below the jump are reached at the same cost
+ * through the rows above and below the jump point, as long as these rows are connected along the
+ * jump. A horizontal jump stops at the goal, or where a cell above or below can only be reached
+ * from the jump. Vertical jumps stop at the goal, or at the cells from which a horizontal jump
+ * finds a jump point.
+ */
+template <typename Grid>
+struct JumpPointGrid {
+  static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+  const Grid& grid;
+  std::size_t columns;
+  std::size_t goal;
+
+  [[nodiscard]] bool canMove(std::size_t cell, GridDirection direction) const
+  {
+    return grid.canMove(cell / columns, cell % columns, direction);
+  }
+
+  [[nodiscard]] std::size_t next(std::size_t cell, GridDirection direction) const
+  {
+    return static_cast<std::size_t>(static_cast<std::ptrdiff_t>(cell)
+                                    + rowOffset(direction) * static_cast<std::ptrdiff_t>(columns)
+                                    + columnOffset(direction));
+  }
+
+  [[nodiscard]] std::size_t distance(std::size_t cell1, std::size_t cell2) const
+  {
+    const auto row1 = cell1 / columns, row2 = cell2 / columns;
+    const auto col1 = cell1 % columns, col2 = cell2 % columns;
+    return (row1 > row2 ? row1 - row2 : row2 - row1) + (col1 > col2 ? col1 - col2 : col2 - col1);
+  }
+
+  [[nodiscard]] std::size_t jumpHorizontally(std::size_t cell, GridDirection direction) const
+  {
+    // The scans are the hot loop of the search, they walk the columns instead of dividing the
+    // cell ids
+    const auto row      = cell / columns;
+    const auto rowStart = row * columns;
+    const auto forward  = (direction == GridDirection::Right);
+    auto col            = cell - rowStart;
+    // Whether the rows above and below are connected from the jump point to the current cell
+    bool upReached   = grid.canMove(row, col, GridDirection::Up);
+    bool downReached = grid.canMove(row, col, GridDirection::Down);
+    while (grid.canMove(row, col, direction)) {
+      upReached   = upReached && grid.canMove(row - 1, col, direction);
+      downReached = downReached && grid.canMove(row + 1, col, direction);
+      col         = forward ? col + 1 : col - 1;
+      if (rowStart + col == goal || (!upReached && grid.canMove(row, col, GridDirection::Up))
+          || (!downReached && grid.canMove(row, col, GridDirection::Down))) {
+        return rowStart + col;
+      }
+    }
+    return npos;
+  }
+
+  [[nodiscard]] std::size_t jumpVertically(std::size_t cell, GridDirection direction) const
+  {
+    while (canMove(cell, direction)) {
+      cell = next(cell, direction);
+      if (cell == goal || jumpHorizontally(cell, GridDirection::Left) != npos
+          || jumpHorizontally(cell, GridDirection::Right) != npos) {
+        return cell;
+      }
+    }
+    return npos;
+  }
+
+}; // end of struct JumpPointGrid
+
+} // end of namespace detail
+
+/**
+ * @brief Finds a shortest path between two cells of a 4-connected uniform grid with jump point
+ * search, reusing the given context and path vectors.
+ *
+ * The search only opens the jump points, where the paths may turn, instead of all the cells, which
+ * makes it much faster than A* on large open grids. The cells are numbered row by row, each move
+ * costs 1 and the grid provides the moves (see GridDirection).
+ *
+ * @return false if the goal cannot be reached, the path being empty
+ */
+template <typename Grid>
+bool JumpPointSearch(const Grid& grid, std::size_t start, std::size_t goal,
+                     AStarContext<std::size_t>& context, std::vector<std::size_t>& path)
+{
+  using JumpGrid = detail::JumpPointGrid<Grid>;
+  const JumpGrid jumpGrid{grid, grid.columns(), goal};
+
+  path.clear();
+  context.begin(grid.rows() * grid.columns(), start,
+                static_cast<double>(jumpGrid.distance(start, goal)));
+
+  std::size_t current;
+  while (context.pop(current)) {
+    if (current == goal) {
+      // The cells of the straight lines between the jump points are appended after the jump
+      // points, which are then removed, except the start
+      context.reconstructPath(current, path);
+      const auto jumpPointCount = path.size();
+      for (std::size_t i = 1; i < jumpPointCount; ++i) {
+        auto cell       = path[i - 1];
+        const auto last = path[i];
+        const auto step = (last / jumpGrid.columns == cell / jumpGrid.columns) ?
+                            (last > cell ? GridDirection::Right : GridDirection::Left) :
+                            (last > cell ? GridDirection::Down : GridDirection::Up);
+        for (cell = jumpGrid.next(cell, step); cell != last; cell = jumpGrid.next(cell, step)) {
+          path.emplace_back(cell);
+        }
+        path.emplace_back(last);
+      }
+      path.erase(path.begin() + 1, path.begin() + static_cast<std::ptrdiff_t>(jumpPointCount));
+      return true;
+    }
+
+    const auto& node  = context.node(current);
+    const auto gScore = node.gScore;
+    const auto jumpTo = [&](GridDirection direction) {
+      if (!jumpGrid.canMove(current, direction)) {
+        return;
+      }
+      const auto jumpPoint
+        = (direction == GridDirection::Left || direction == GridDirection::Right) ?
+            jumpGrid.jumpHorizontally(current, direction) :
+            jumpGrid.jumpVertically(current, direction);
+      if (jumpPoint == JumpGrid::npos) {
+        return;
+      }
+      const auto tentative_gScore
+        = gScore + static_cast<double>(jumpGrid.distance(current, jumpPoint));
+      if (context.improves(jumpPoint, tentative_gScore)) {
+        context.reach(jumpPoint, current, tentative_gScore,
+                      tentative_gScore + static_cast<double>(jumpGrid.distance(jumpPoint, goal)));
+      }
+    };
+
+    if (node.cameFrom == current) {
+      for (auto direction : GridDirections) {
+        jumpTo(direction);
+      }
+    }
+    else if (node.cameFrom / jumpGrid.columns == current / jumpGrid.columns) {
+      // Reached horizontally: go on, or turn
+      jumpTo(node.cameFrom < current ? GridDirection::Right : GridDirection::Left);
+      jumpTo(GridDirection::Up);
+      jumpTo(GridDirection::Down);
+    }
+    else {
+      // Reached vertically: go on, or turn
+      jumpTo(node.cameFrom < current ? GridDirection::Down : GridDirection::Up);
+      jumpTo(GridDirection::Left);
+      jumpTo(GridDirection::Right);
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Finds a shortest path between two cells of a 4-connected uniform grid with jump point
+ * search, using a search context per thread.
+ */
+template <typename Grid>
+std::vector<std::size_t> JumpPointSearch(const Grid& grid, std::size_t start, std::size_t goal)
+{
+  thread_local AStarContext<std::size_t> context;
+  std::vector<std::size_t> path;
+  JumpPointSearch(grid, start, goal, context, path);
+  return path;
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_PATH_FINDING_JUMP_POINT_SEARCH_H
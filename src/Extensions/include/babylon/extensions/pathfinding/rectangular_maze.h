@@ -7,6 +7,8 @@
 #include <babylon/babylon_api.h>
 #include <babylon/core/random.h>
 #include <babylon/extensions/pathfinding/a_star_search.h>
+#include <babylon/extensions/pathfinding/grid_direction.h>
+#include <babylon/extensions/pathfinding/jump_point_search.h>
 
 namespace BABYLON {
 namespace Extensions {
@@ -46,12 +48,12 @@ struct Cell {
   double cost    = 0.0;
 }; // end of struct Cell
 
-bool operator==(const Cell& lhs, const Cell& rhs)
+inline bool operator==(const Cell& lhs, const Cell& rhs)
 {
   return lhs.id == rhs.id;
 }
 
-bool operator!=(const Cell& lhs, const Cell& rhs)
+inline bool operator!=(const Cell& lhs, const Cell& rhs)
 {
   return lhs.id != rhs.id;
 }
@@ -77,6 +79,16 @@ struct RectangularMaze {
     return _cells.size();
   }
 
+  [[nodiscard]] std::size_t rows() const
+  {
+    return _rows;
+  }
+
+  [[nodiscard]] std::size_t columns() const
+  {
+    return _columns;
+  }
+
   [[nodiscard]] Location location(const std::size_t cellId) const
   {
     const size_t row = cellId / _columns;
@@ -124,32 +136,44 @@ struct RectangularMaze {
     return cellId(location) < _cells.size();
   }
 
-  [[nodiscard]] std::vector<Cell> neighbors(const std::size_t _cellId) const
+  // Whether the cell next to a cell in the given direction can be entered from it
+  [[nodiscard]] bool canMove(const std::size_t row, const std::size_t col,
+                             GridDirection direction) const
   {
-    std::vector<Cell> neighborsNodes;
-    std::size_t row, col;
-    std::tie(row, col) = location(_cellId);
-
-    // Can go up
-    if (row != 0 && cell(row - 1, col).downOpen) {
-      neighborsNodes.emplace_back(cell(row - 1, col));
-    }
-
-    // Can go left
-    if (col != 0 && cell(row, col - 1).rightOpen) {
-      neighborsNodes.emplace_back(cell(row, col - 1));
-    }
-
-    // Can go right
-    if (col < _columns - 1 && cell(row, col + 1).leftOpen) {
-      neighborsNodes.emplace_back(cell(row, col + 1));
+    switch (direction) {
+      case GridDirection::Up:
+        return row != 0 && cell(row - 1, col).downOpen;
+      case GridDirection::Left:
+        return col != 0 && cell(row, col - 1).rightOpen;
+      case GridDirection::Right:
+        return col < _columns - 1 && cell(row, col + 1).leftOpen;
+      case GridDirection::Down:
+        return row < _rows - 1 && cell(row + 1, col).upOpen;
     }
+    return false;
+  }
 
-    // Can go down
-    if (row < _rows - 1 && cell(row + 1, col).upOpen) {
-      neighborsNodes.emplace_back(cell(row + 1, col));
+  // Calls func with each neighbor of a cell, without allocating memory
+  template <typename Func>
+  void forEachNeighbor(const std::size_t _cellId, Func&& func) const
+  {
+    const size_t row = _cellId / _columns;
+    const size_t col = _cellId - (row * _columns);
+    for (auto direction : GridDirections) {
+      if (canMove(row, col, direction)) {
+        const auto offset
+          = rowOffset(direction) * static_cast<std::ptrdiff_t>(_columns) + columnOffset(direction);
+        func(cell(static_cast<std::size_t>(static_cast<std::ptrdiff_t>(_cellId) + offset)));
+      }
     }
+  }
 
+  [[nodiscard]] std::vector<Cell> neighbors(const std::size_t _cellId) const
+  {
+    std::vector<Cell> neighborsNodes;
+    forEachNeighbor(_cellId, [&neighborsNodes](const Cell& neighbor) {
+      neighborsNodes.emplace_back(neighbor);
+    });
     return neighborsNodes;
   }
 
@@ -329,11 +353,25 @@ struct RectangularMaze {
     return findPath(location(0), location(_cells.size() - 1));
   }
 
+  // Finds a shortest path with jump point search, each move costing 1 whatever the cell costs
+  std::vector<Location> findJumpPointPath(const Location& start, const Location& goal)
+  {
+    std::vector<Location> result;
+    const std::size_t startCellId = isValid(start) ? cellId(start) : 0;
+    const std::size_t goalCellId  = isValid(goal) ? cellId(goal) : _cells.size() - 1;
+    _path                         = JumpPointSearch(*this, startCellId, goalCellId);
+    result.reserve(_path.size());
+    for (auto& cellId : _path) {
+      result.emplace_back(location(cellId));
+    }
+    return result;
+  }
+
 }; // end of struct RectangularMaze
 
 // For debugging
-std::basic_iostream<char>::basic_ostream& operator<<(std::basic_iostream<char>::basic_ostream& out,
-                                                     const RectangularMaze& maze)
+inline std::basic_iostream<char>::basic_ostream&
+operator<<(std::basic_iostream<char>::basic_ostream& out, const RectangularMaze& maze)
 {
   const auto numRows = maze._rows;
   const auto numCols = maze._columns;
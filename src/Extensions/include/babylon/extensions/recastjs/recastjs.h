@@ -1,8 +1,10 @@
 #pragma once
 #include <recastnavigation/Detour/Include/DetourNavMesh.h>
 #include <recastnavigation/DetourCrowd/Include/DetourCrowd.h>
+#include <recastnavigation/DetourTileCache/Include/DetourTileCache.h>
 
 #include <algorithm>
+#include <functional>
 #include <vector>
 
 class dtNavMeshQuery;
@@ -16,6 +18,8 @@ struct rcConfig;
 namespace BABYLON {
 namespace Extensions {
 
+struct NavMeshTileCache;
+
 struct Vec3 {
   Vec3()
   {
@@ -102,12 +106,37 @@ public:
       , m_pmesh(nullptr)
       , m_dmesh(nullptr)
       , m_navData(nullptr)
+      , m_tileCache(nullptr)
       , m_defaultQueryExtent(1.f)
   {
   }
   void destroy();
+  /**
+   * Builds the navmesh. When config.tileSize is > 0, the navmesh is split in tiles which are
+   * built in parallel, and temporary obstacles and partial geometry updates are supported.
+   * The tile cache stores the tile dimensions in 8 bits, so the build fails (and no navmesh is
+   * created) when config.tileSize plus twice the border of walkableRadius + 3 cells exceeds 255.
+   */
   void build(const float* positions, const int positionCount, const int* indices,
              const int indexCount, const rcConfig& config);
+  /**
+   * Replaces the input geometry of a tiled navmesh, and rebuilds the tiles overlapping the
+   * bounding box where the geometry changed. Does nothing for a navmesh built in one tile.
+   * Returns false when the navmesh is not tiled or when some tiles could not be rebuilt.
+   */
+  bool updateGeometry(const float* positions, const int positionCount, const int* indices,
+                      const int indexCount, const Vec3& bmin, const Vec3& bmax);
+  bool isTiled() const
+  {
+    return m_tileCache != nullptr;
+  }
+  // Temporary obstacles (tiled navmesh only), applied by the next calls to update().
+  // The returned handles stay valid when tiles are rebuilt, 0 is returned on failure.
+  dtObstacleRef addCylinderObstacle(const Vec3& position, float radius, float height);
+  dtObstacleRef addBoxObstacle(const Vec3& position, const Vec3& extent, float angle);
+  void removeObstacle(dtObstacleRef obstacle);
+  // Rebuilds the tiles touched by added/removed obstacles, returns true when up to date
+  bool update();
   void buildFromNavmeshData(NavmeshData* navmeshData);
   NavmeshData getNavmeshData() const;
   void freeNavmeshData(NavmeshData* navmeshData);
@@ -121,6 +150,19 @@ public:
     return m_navMesh;
   }
   NavPath computePath(const Vec3& start, const Vec3& end) const;
+  // Batched queries, spread over the workers of ThreadPool::Default() which each own a
+  // dtNavMeshQuery. The results are written to caller provided buffers of count elements, and
+  // match the single queries ones. The navmesh must not be modified (build, update) while a batch
+  // is running.
+  void getClosestPoints(const Vec3* positions, size_t count, Vec3* results) const;
+  // Query i draws its random numbers from a sequence seeded with seed and i, so the results do not
+  // depend on the number of threads
+  void getRandomPointsAround(const Vec3* positions, size_t count, float maxRadius,
+                             unsigned int seed, Vec3* results) const;
+  // Path i is written to points[i * maxPointsPerPath], its point count to pointCounts[i]. Paths
+  // longer than maxPointsPerPath are truncated.
+  void computePaths(const Vec3* starts, const Vec3* ends, size_t count, Vec3* points,
+                    int maxPointsPerPath, int* pointCounts) const;
   void setDefaultQueryExtent(const Vec3& extent)
   {
     m_defaultQueryExtent = extent;
@@ -136,8 +178,22 @@ protected:
   rcPolyMesh* m_pmesh;
   rcPolyMeshDetail* m_dmesh;
   unsigned char* m_navData;
+  NavMeshTileCache* m_tileCache;
   Vec3 m_defaultQueryExtent;
+  // One query object per worker of the thread pool running the batched queries
+  mutable std::vector<dtNavMeshQuery*> m_batchQueries;
 
+  dtNavMeshQuery* const* getBatchQueries(size_t workerCount) const;
+  void buildTiled(const float* positions, const int positionCount, const int* indices,
+                  const int indexCount, const rcConfig& config);
+  // Returns false when some tiles could not be rebuilt, these tiles keep their previous layers
+  bool rebuildTiles(int minTileX, int minTileZ, int maxTileX, int maxTileZ);
+  // Updates the tile cache until all the obstacle changes are applied, with a bounded number of
+  // updates. Returns false when an update fails or the tile cache is still not up to date.
+  bool updateUntilUpToDate();
+  // Sends an obstacle request to the tile cache, retried after an update when the request queue
+  // is full
+  dtStatus requestObstacle(const std::function<dtStatus()>& request);
   void navMeshPoly(DebugNavMesh& debugNavMesh, const dtNavMesh& mesh, dtPolyRef ref);
   void navMeshPolysWithFlags(DebugNavMesh& debugNavMesh, const dtNavMesh& mesh,
                              const unsigned short polyFlags);
@@ -152,6 +208,10 @@ public:
   void update(const float dt);
   Vec3 getAgentPosition(int idx);
   Vec3 getAgentVelocity(int idx);
+  // Copies the positions and velocities (3 floats per agent) and the states (CrowdAgentState) of
+  // count agents to caller provided buffers, null buffers are skipped
+  void getAgentStates(const int* indices, size_t count, float* positions, float* velocities,
+                      unsigned char* states);
   void agentGoto(int idx, const Vec3& destination);
   void agentTeleport(int idx, const Vec3& destination);
   dtCrowdAgentParams getAgentParameters(const int idx);
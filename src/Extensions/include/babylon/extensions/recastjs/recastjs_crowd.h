@@ -2,7 +2,7 @@
 #define BABYLON_EXTENSIONS_RECASTJS_RECASTJS_CROWD_H
 
 #include <babylon/babylon_api.h>
-#include <babylon/misc/observer.h>
+#include <babylon/misc/observable.h>
 #include <babylon/navigation/icrowd.h>
 
 namespace BABYLON {
@@ -33,7 +33,8 @@ public:
    * You can attach anything to that node. The node position is updated in the scene update tick.
    * @param pos world position that will be constrained by the navigation mesh
    * @param parameters agent parameters
-   * @param transform hooked to the agent that will be update by the scene
+   * @param transform hooked to the agent that will be update by the scene, can be null when the
+   * agents are rendered from the matrix buffer
    * @returns agent index
    */
   int addAgent(const Vector3& pos, const IAgentParameters& parameters,
@@ -103,7 +104,8 @@ public:
 
   /**
    * @brief Tick update done by the Scene. Agent position/velocity/acceleration is updated by this
-   * function.
+   * function. The agent positions, velocities and states are read back in bulk, and only the
+   * transforms of the agents that moved further than positionEpsilon are updated.
    * @param deltaTime in seconds
    */
   void update(float deltaTime) override;
@@ -133,6 +135,21 @@ public:
    */
   void dispose() override;
 
+  /**
+   * @brief Enables or disables the instance matrices of the agents, used to render the agents
+   * with a single instanced mesh.
+   * @param value defines whether the update writes the instance matrices
+   */
+  void setInstanceMatricesEnabled(bool value);
+
+  /**
+   * @brief Gets the instance matrices of the agents, 16 floats per agent in the order of the
+   * agents, empty when they are not enabled. The update writes the agent positions to the
+   * translations of the matrices, the other components are left to the identity.
+   * @returns the instance matrices, owned by the crowd
+   */
+  [[nodiscard]] const Float32Array& getInstanceMatrices() const;
+
 public:
   /**
    * Recast/detour plugin
@@ -154,6 +171,35 @@ public:
    */
   std::vector<int> agents;
 
+  /**
+   * Agent positions in world space, read back by the update, 3 floats per agent in the order of
+   * the agents
+   */
+  Float32Array agentPositions;
+
+  /**
+   * Agent velocities in world space, read back by the update, 3 floats per agent in the order of
+   * the agents
+   */
+  Float32Array agentVelocities;
+
+  /**
+   * Agent states (see CrowdAgentState), read back by the update, in the order of the agents
+   */
+  Uint8Array agentStates;
+
+  /**
+   * The transform of an agent is updated when the agent moved further than this distance from it,
+   * the idle agents do not mark their transform dirty (default 1e-4)
+   */
+  float positionEpsilon;
+
+  /**
+   * Notified after an update changed the instance matrices, to upload them to the instance buffer
+   * of the rendered mesh
+   */
+  Observable<RecastJSCrowd> onInstanceMatricesUpdatedObservable;
+
 private:
   /**
    * Link to the scene is kept to unregister the crowd from the scene
@@ -165,6 +211,16 @@ private:
    */
   Observer<Scene>::Ptr _onBeforeAnimationsObserver;
 
+  /**
+   * Whether the update writes the instance matrices
+   */
+  bool _instanceMatricesEnabled;
+
+  /**
+   * Instance matrices of the agents
+   */
+  Float32Array _instanceMatrices;
+
 }; // end of class RecastJSCrowd
 
 } // end of namespace Extensions
@@ -25,6 +25,48 @@ public:
   void createNavMesh(const std::vector<MeshPtr>& meshes,
                      const INavMeshParameters& parameters) override;
 
+  /**
+   * @brief Updates a tiled navigation mesh after the geometry changed inside a bounding box. Only
+   * the tiles overlapping the bounding box are rebuilt.
+   * @param meshes array of all the geometry used to compute the navigation mesh
+   * @param boundsMin minimum world position of the bounding box where the geometry changed
+   * @param boundsMax maximum world position of the bounding box where the geometry changed
+   * @returns false if there is no tiled navigation mesh or if some tiles could not be rebuilt
+   */
+  bool updateNavMesh(const std::vector<MeshPtr>& meshes, const Vector3& boundsMin,
+                     const Vector3& boundsMax);
+
+  /**
+   * @brief Creates a cylinder obstacle and add it to the navigation (tiled navigation mesh only).
+   * @param position world position
+   * @param radius cylinder radius
+   * @param height cylinder height
+   * @returns the obstacle freshly created, 0 on failure or if there is no navigation mesh
+   */
+  dtObstacleRef addCylinderObstacle(const Vector3& position, float radius, float height);
+
+  /**
+   * @brief Creates a box obstacle and add it to the navigation (tiled navigation mesh only).
+   * @param position world position
+   * @param extent box size
+   * @param angle angle in radians of the box orientation on Y axis
+   * @returns the obstacle freshly created, 0 on failure or if there is no navigation mesh
+   */
+  dtObstacleRef addBoxObstacle(const Vector3& position, const Vector3& extent, float angle);
+
+  /**
+   * @brief Removes an obstacle created with addCylinderObstacle or addBoxObstacle.
+   * @param obstacle obstacle to remove from the navigation
+   */
+  void removeObstacle(dtObstacleRef obstacle);
+
+  /**
+   * @brief Applies the obstacles changes to the navigation mesh. This is done by the crowds on
+   * each frame.
+   * @returns true when all the changes are applied
+   */
+  bool updateObstacles();
+
   /**
    * @brief Create a navigation mesh debug mesh.
    * @param scene is where the mesh will be added
@@ -89,6 +131,40 @@ public:
    */
   std::vector<Vector3> computePath(const Vector3& start, const Vector3& end) override;
 
+  /**
+   * @brief Get the closest navigation mesh constrained positions of a batch of positions. The
+   * queries are spread over worker threads.
+   * @param positions world positions
+   * @param results output the closest points, resized to the number of positions (emptied if
+   * there is no navigation mesh)
+   */
+  void getClosestPoints(const std::vector<Vector3>& positions, std::vector<Vector3>& results);
+
+  /**
+   * @brief Get random navigation mesh constrained positions around a batch of positions. The
+   * queries are spread over worker threads.
+   * @param positions world positions
+   * @param maxRadius the maximum distance to the constrained world positions
+   * @param results output the random points, resized to the number of positions (emptied if
+   * there is no navigation mesh)
+   * @param seed seed of the random sequences, the same seed gives the same results
+   */
+  void getRandomPointsAround(const std::vector<Vector3>& positions, float maxRadius,
+                             std::vector<Vector3>& results, unsigned int seed = 1337);
+
+  /**
+   * @brief Compute a batch of navigation paths. The queries are spread over worker threads.
+   * @param starts world start positions
+   * @param ends world end positions, same count as starts
+   * @param maxPointsPerPath maximum number of points of a path, longer paths are truncated
+   * @param points output the paths points, path i starting at index i * maxPointsPerPath
+   * @param pointCounts output the number of points of each path, 0 if no path can be computed
+   * (both outputs are emptied if there is no navigation mesh)
+   */
+  void computePaths(const std::vector<Vector3>& starts, const std::vector<Vector3>& ends,
+                    size_t maxPointsPerPath, std::vector<Vector3>& points,
+                    std::vector<size_t>& pointCounts);
+
   /**
    * @brief Create a new Crowd so you can add agents.
    * @param maxAgents the maximum agent count in the crowd
@@ -148,6 +224,21 @@ public:
    */
   std::unique_ptr<NavMesh> navMesh;
 
+private:
+  /**
+   * @brief Gathers the world space geometry of the meshes.
+   * @returns the number of vertices
+   */
+  int _getPositionsAndIndices(const std::vector<MeshPtr>& meshes, Float32Array& positions,
+                              Int32Array& indices) const;
+
+private:
+  // Conversion buffers of the batched queries, kept between the calls
+  std::vector<Vec3> _batchInputs;
+  std::vector<Vec3> _batchEnds;
+  std::vector<Vec3> _batchResults;
+  std::vector<int> _batchCounts;
+
 }; // end of class RecastJSPlugin
 
 } // end of namespace Extensions
@@ -1,8 +1,13 @@
 #include <babylon/extensions/dynamicterrain/dynamic_terrain.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/scene.h>
 #include <babylon/extensions/dynamicterrain/dynamic_terrain_options.h>
 #include <babylon/meshes/builders/mesh_builder_options.h>
@@ -15,6 +20,92 @@
 namespace BABYLON {
 namespace Extensions {
 
+namespace {
+
+// Number of ribbon vertices updated by a thread pool task
+constexpr std::size_t RibbonVerticesPerTask = 4096;
+
+// Range [start, end) of the n ribbon rows or columns to recompute after a
+// shift: the new ones, plus the former border one and the new border one
+void shiftedRange(int shift, unsigned int n, unsigned int& start, unsigned int& end)
+{
+  if (shift > 0) {
+    start = n - static_cast<unsigned>(shift) - 1;
+    end   = n;
+  }
+  else {
+    start = 0;
+    end   = static_cast<unsigned>(-shift) + 1;
+  }
+}
+
+// The ribbon normals kernels work on deinterleaved rows, through restricted
+// pointers and without branches so that the compiler vectorizes them (sqrt
+// requires -fno-math-errno)
+
+// Computes the unit normals of the triangles (a, b, c) and (d, c, b) of the
+// count quads between the vertex rows 0 and 1, with a = (0, s), b = (0, s + 1),
+// c = (1, s) and d = (1, s + 1)
+void computeQuadNormals(const float* __restrict x0, const float* __restrict y0,
+                        const float* __restrict z0, const float* __restrict x1,
+                        const float* __restrict y1, const float* __restrict z1, std::size_t count,
+                        float sign, float* __restrict nX1, float* __restrict nY1,
+                        float* __restrict nZ1, float* __restrict nX2, float* __restrict nY2,
+                        float* __restrict nZ2)
+{
+  constexpr float minLengthSquared = std::numeric_limits<float>::min();
+  for (std::size_t s = 0; s < count; ++s) {
+    const float abX = x0[s] - x1[s], abY = y0[s] - y1[s], abZ = z0[s] - z1[s];
+    const float cbX = x0[s + 1] - x1[s], cbY = y0[s + 1] - y1[s], cbZ = z0[s + 1] - z1[s];
+    const float dcX = x1[s + 1] - x0[s + 1], dcY = y1[s + 1] - y0[s + 1],
+                dcZ = z1[s + 1] - z0[s + 1];
+    const float n1X = abY * cbZ - abZ * cbY;
+    const float n1Y = abZ * cbX - abX * cbZ;
+    const float n1Z = abX * cbY - abY * cbX;
+    const float n2X = cbY * dcZ - cbZ * dcY;
+    const float n2Y = cbZ * dcX - cbX * dcZ;
+    const float n2Z = cbX * dcY - cbY * dcX;
+    const float scale1
+      = sign / std::sqrt(std::max(n1X * n1X + n1Y * n1Y + n1Z * n1Z, minLengthSquared));
+    const float scale2
+      = sign / std::sqrt(std::max(n2X * n2X + n2Y * n2Y + n2Z * n2Z, minLengthSquared));
+    nX1[s] = n1X * scale1;
+    nY1[s] = n1Y * scale1;
+    nZ1[s] = n1Z * scale1;
+    nX2[s] = n2X * scale2;
+    nY2[s] = n2Y * scale2;
+    nZ2[s] = n2Z * scale2;
+  }
+}
+
+// Writes the unit normals of count vertices from the normals of the quad rows
+// above (a) and below (b): the vertex s is the vertex b of both triangles of
+// the quad s above, the vertex d of the quad s - 1 above, the vertex a of the
+// quad s below and the vertex c of both triangles of the quad s - 1 below,
+// the quad s being stored in the slot s + 1
+void sumVertexNormals(const float* __restrict aX1, const float* __restrict aY1,
+                      const float* __restrict aZ1, const float* __restrict aX2,
+                      const float* __restrict aY2, const float* __restrict aZ2,
+                      const float* __restrict bX1, const float* __restrict bY1,
+                      const float* __restrict bZ1, const float* __restrict bX2,
+                      const float* __restrict bY2, const float* __restrict bZ2, std::size_t count,
+                      float* __restrict normals)
+{
+  constexpr float minLengthSquared = std::numeric_limits<float>::min();
+  for (std::size_t s = 0; s < count; ++s) {
+    const float nX = aX1[s + 1] + aX2[s + 1] + aX2[s] + bX1[s + 1] + bX1[s] + bX2[s];
+    const float nY = aY1[s + 1] + aY2[s + 1] + aY2[s] + bY1[s + 1] + bY1[s] + bY2[s];
+    const float nZ = aZ1[s + 1] + aZ2[s + 1] + aZ2[s] + bZ1[s + 1] + bZ1[s] + bZ2[s];
+    const float scale
+      = 1.f / std::sqrt(std::max(nX * nX + nY * nY + nZ * nZ, minLengthSquared));
+    normals[3 * s]     = nX * scale;
+    normals[3 * s + 1] = nY * scale;
+    normals[3 * s + 2] = nZ * scale;
+  }
+}
+
+} // end of anonymous namespace
+
 Vector3 DynamicTerrain::_v1    = Vector3::Zero();
 Vector3 DynamicTerrain::_v2    = Vector3::Zero();
 Vector3 DynamicTerrain::_v3    = Vector3::Zero();
@@ -22,8 +113,6 @@ Vector3 DynamicTerrain::_v4    = Vector3::Zero();
 Vector3 DynamicTerrain::_vAvB  = Vector3::Zero();
 Vector3 DynamicTerrain::_vAvC  = Vector3::Zero();
 Vector3 DynamicTerrain::_norm  = Vector3::Zero();
-Vector3 DynamicTerrain::_bbMin = Vector3::Zero();
-Vector3 DynamicTerrain::_bbMax = Vector3::Zero();
 
 DynamicTerrain::DynamicTerrain(const std::string& iName, DynamicTerrainOptions& options,
                                Scene* scene)
@@ -59,6 +148,12 @@ DynamicTerrain::DynamicTerrain(const std::string& iName, DynamicTerrainOptions&
                                    1,                          // vertex LOD value on Z axis
                                    Vector3::Zero(),            // vertex World position
                                    0}}
+    , _ribbonShiftX{0}
+    , _ribbonShiftZ{0}
+    , _ribbonLODValue{0}
+    , _ribbonOutdated{true}
+    , _frontSide{options.invertSide}
+    , _threadPool{nullptr}
     , _averageSubSizeX{0.f}
     , _averageSubSizeZ{0.f}
     , _terrainSizeX{0.f}
@@ -219,24 +314,28 @@ DynamicTerrain& DynamicTerrain::update(bool force)
     _signX     = (_deltaX > 0.f) ? -1 : 1;
     _mapFlgtNb = static_cast<unsigned>(std::abs(_deltaX / _mapShiftX));
     _terrain->position().x += _mapShiftX * _signX * _mapFlgtNb;
+    const auto shiftSubX = (_subToleranceX * _LODValue * _mapFlgtNb) % _mapSubX;
     if (_signX == 1) {
-      _deltaSubX += (_subToleranceX * _LODValue * _mapFlgtNb);
+      _deltaSubX = (_deltaSubX + shiftSubX) % _mapSubX;
     }
-    else if (_signZ == -1) {
-      _deltaSubX -= (_subToleranceX * _LODValue * _mapFlgtNb);
+    else if (_signX == -1) {
+      _deltaSubX = (_deltaSubX + _mapSubX - shiftSubX) % _mapSubX;
     }
+    _ribbonShiftX += _signX * static_cast<int>(_subToleranceX * _mapFlgtNb);
     _needsUpdate = true;
   }
   if (std::abs(_deltaZ) > _mapShiftZ) {
     _signZ     = (_deltaZ > 0.f) ? -1 : 1;
     _mapFlgtNb = static_cast<unsigned>(std::abs(_deltaZ / _mapShiftZ));
     _terrain->position().z += _mapShiftZ * _signZ * _mapFlgtNb;
+    const auto shiftSubZ = (_subToleranceZ * _LODValue * _mapFlgtNb) % _mapSubZ;
     if (_signZ == 1) {
-      _deltaSubZ += (_subToleranceZ * _LODValue * _mapFlgtNb);
+      _deltaSubZ = (_deltaSubZ + shiftSubZ) % _mapSubZ;
     }
     else if (_signZ == -1) {
-      _deltaSubZ -= (_subToleranceZ * _LODValue * _mapFlgtNb);
+      _deltaSubZ = (_deltaSubZ + _mapSubZ - shiftSubZ) % _mapSubZ;
     }
+    _ribbonShiftZ += _signZ * static_cast<int>(_subToleranceZ * _mapFlgtNb);
     _needsUpdate = true;
   }
   if (_needsUpdate || _updateLOD || _updateForced) {
@@ -257,185 +356,266 @@ DynamicTerrain& DynamicTerrain::update(bool force)
 
 void DynamicTerrain::_updateTerrain()
 {
-  unsigned int stepJ        = 0;
-  unsigned int stepI        = 0;
-  unsigned int LODLimitDown = 0;
-  unsigned int LODLimitUp   = 0;
-  unsigned int LODValue     = _LODValue;
-  unsigned int lodI         = LODValue;
-  unsigned int lodJ         = LODValue;
-  unsigned int l            = 0;
-  unsigned int index        = 0;  // current vertex index in the map data array
-  unsigned int posIndex     = 0;  // current position index in the map data array
-  unsigned int colIndex     = 0;  // current index in the map color array
-  unsigned int uvIndex      = 0;  // current index in the map uv array
-  unsigned int terIndex     = 0;  // current vertex index in the terrain map array
-                                  // when used as a data map
-  unsigned int ribbonInd     = 0; // current ribbon vertex index
-  unsigned int ribbonPosInd  = 0; // current ribbon position index (same than normal index)
-  unsigned int ribbonUVInd   = 0; // current ribbon UV index
-  unsigned int ribbonColInd  = 0; // current ribbon color index
-  unsigned int ribbonPosInd1 = 0;
-  unsigned int ribbonPosInd2 = 0;
-  unsigned int ribbonPosInd3 = 0;
-  // note : all the indexes are explicitly set as integers for the js optimizer
-  // (store them all in the stack)
-
   if (_updateLOD || _updateForced) {
     updateTerrainSize();
   }
-  Vector3::FromFloatsToRef(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
-                           std::numeric_limits<float>::max(), _bbMin);
-  Vector3::FromFloatsToRef(std::numeric_limits<float>::lowest(),
-                           std::numeric_limits<float>::lowest(),
-                           std::numeric_limits<float>::lowest(), _bbMax);
-
-  for (unsigned int j = 0; j <= _terrainSub; ++j) {
-    // LOD Z
-    LODValue = _LODValue;
-    for (l = 0; l < _LODLimits.size(); ++l) {
-      LODLimitDown = _LODLimits[l];
-      LODLimitUp   = _terrainSub - LODLimitDown - 1;
-      if (j < LODLimitDown || j > LODLimitUp) {
-        LODValue = l + 1 + _LODValue;
-      }
-      lodJ = LODValue;
-    }
-
-    for (unsigned int i = 0; i <= _terrainSub; ++i) {
-      // LOD X
-      LODValue = _LODValue;
-      for (l = 0; l < _LODLimits.size(); ++l) {
-        LODLimitDown = _LODLimits[l];
-        LODLimitUp   = _terrainSub - LODLimitDown - 1;
-        if (i < LODLimitDown || i > LODLimitUp) {
-          LODValue = l + 1 + _LODValue;
+  _updateRibbonSteps();
+
+  auto& threadPool       = (_threadPool != nullptr ? *_threadPool : ThreadPool::Default());
+  const auto workerCount = _useCustomVertexFunction ? 1 : threadPool.workerCount();
+  const auto grainSize   = std::max<std::size_t>(1, RibbonVerticesPerTask / _terrainIdx);
+  const auto n           = _terrainIdx;
+  const auto shiftX      = _ribbonShiftX;
+  const auto shiftZ      = _ribbonShiftZ;
+
+  // The ribbon is shifted when the map window only moved by less than its size,
+  // each vertex taking the values of the vertex it replaces
+  const bool shiftRibbon = !_ribbonOutdated && !_updateLOD && !_updateForced
+                           && _LODLimits.empty() && !_useCustomVertexFunction
+                           && _LODValue == _ribbonLODValue && std::abs(shiftX) < static_cast<int>(n)
+                           && std::abs(shiftZ) < static_cast<int>(n);
+  _ribbonShiftX   = 0;
+  _ribbonShiftZ   = 0;
+  _ribbonLODValue = _LODValue;
+  _ribbonOutdated = false;
+
+  // bounds of the vertices updated by each worker
+  std::vector<Vector3> bbMins(workerCount, Vector3(std::numeric_limits<float>::max(),
+                                                   std::numeric_limits<float>::max(),
+                                                   std::numeric_limits<float>::max()));
+  std::vector<Vector3> bbMaxs(workerCount, Vector3(std::numeric_limits<float>::lowest(),
+                                                   std::numeric_limits<float>::lowest(),
+                                                   std::numeric_limits<float>::lowest()));
+
+  // rows and columns whose normals are recomputed
+  unsigned int rowStart = 0, rowEnd = 0, colStart = 0, colEnd = 0;
+  unsigned int borderRow = n, borderCol = n;
+  if (shiftRibbon) {
+    // the vertex (i, j) takes the values of the previous vertex (i + shiftX,
+    // j + shiftZ), in one pass from the previous vertex data
+    std::swap(_positions, _previousPositions);
+    std::swap(_normals, _previousNormals);
+    std::swap(_uvs, _previousUVs);
+    std::swap(_colors, _previousColors);
+    _positions.resize(_previousPositions.size());
+    _normals.resize(_previousNormals.size());
+    _uvs.resize(_previousUVs.size());
+    _colors.resize(_previousColors.size());
+    const auto newRowStart  = shiftZ > 0 ? n - static_cast<unsigned>(shiftZ) : 0u;
+    const auto newRowEnd    = shiftZ > 0 ? n : static_cast<unsigned>(-shiftZ);
+    const auto newColStart  = shiftX > 0 ? n - static_cast<unsigned>(shiftX) : 0u;
+    const auto newColEnd    = shiftX > 0 ? n : static_cast<unsigned>(-shiftX);
+    const auto keptColStart = shiftX > 0 ? 0u : newColEnd;
+    const auto keptColEnd   = shiftX > 0 ? newColStart : n;
+    const auto keptCount    = static_cast<std::size_t>(keptColEnd - keptColStart);
+    threadPool.parallelFor(n, grainSize, [&](size_t begin, size_t end, size_t workerIndex) {
+      auto& bbMin = bbMins[workerIndex];
+      auto& bbMax = bbMaxs[workerIndex];
+      for (auto j = static_cast<unsigned>(begin); j < end; ++j) {
+        if (j >= newRowStart && j < newRowEnd) {
+          _updateRibbonRow(j, 0, n, bbMin, bbMax);
+          continue;
         }
-        lodI = LODValue;
-      }
-
-      // map current index
-      index    = _mod(_deltaSubZ + stepJ, _mapSubZ) * _mapSubX + _mod(_deltaSubX + stepI, _mapSubX);
-      terIndex = _mod(_deltaSubZ + stepJ, _terrainIdx) * _terrainIdx
-                 + _mod(_deltaSubX + stepI, _terrainIdx);
-
-      // related index in the array of positions (data map)
-      if (_datamap) {
-        posIndex = 3 * index;
-      }
-      else {
-        posIndex = 3 * terIndex;
-      }
-      // related index in the UV map
-      if (_uvmap) {
-        uvIndex = 2 * index;
-      }
-      else {
-        uvIndex = 2 * terIndex;
-      }
-      // related index in the color map
-      if (_colormap) {
-        colIndex = 3 * index;
-      }
-      else {
-        colIndex = 3 * terIndex;
+        const std::size_t ribbonInd = j * n + keptColStart;
+        const std::size_t previousInd
+          = static_cast<std::size_t>((static_cast<int>(j) + shiftZ) * static_cast<int>(n)
+                                     + static_cast<int>(keptColStart) + shiftX);
+        // the kept altitudes are put back on the terrain grid
+        const float z = _averageSubSizeZ * _ribbonSteps[j];
+        for (std::size_t i = 0; i < keptCount; ++i) {
+          const float y                       = _previousPositions[3 * (previousInd + i) + 1];
+          _positions[3 * (ribbonInd + i)]     = _averageSubSizeX * _ribbonSteps[keptColStart + i];
+          _positions[3 * (ribbonInd + i) + 1] = y;
+          _positions[3 * (ribbonInd + i) + 2] = z;
+          bbMin.y                             = std::min(bbMin.y, y);
+          bbMax.y                             = std::max(bbMax.y, y);
+        }
+        std::copy_n(_previousNormals.begin() + 3 * previousInd, 3 * keptCount,
+                    _normals.begin() + 3 * ribbonInd);
+        std::copy_n(_previousUVs.begin() + 2 * previousInd, 2 * keptCount,
+                    _uvs.begin() + 2 * ribbonInd);
+        std::copy_n(_previousColors.begin() + 4 * previousInd, 4 * keptCount,
+                    _colors.begin() + 4 * ribbonInd);
+        bbMin.x = std::min(bbMin.x, _positions[3 * ribbonInd]);
+        bbMax.x = std::max(bbMax.x, _positions[3 * (ribbonInd + keptCount - 1)]);
+        bbMin.z = std::min(bbMin.z, z);
+        bbMax.z = std::max(bbMax.z, z);
+        _updateRibbonRow(j, newColStart, newColEnd, bbMin, bbMax);
       }
-      // ribbon indexes
-      ribbonPosInd  = 3 * ribbonInd;
-      ribbonColInd  = 4 * ribbonInd;
-      ribbonUVInd   = 2 * ribbonInd;
-      ribbonPosInd1 = ribbonPosInd;
-      ribbonPosInd2 = ribbonPosInd + 1;
-      ribbonPosInd3 = ribbonPosInd + 2;
-      ribbonInd += 1;
-
-      // geometry
-      _positions[ribbonPosInd1] = _averageSubSizeX * stepI;
-      _positions[ribbonPosInd2] = _mapData[posIndex + 1];
-      _positions[ribbonPosInd3] = _averageSubSizeZ * stepJ;
-
-      if (!_computeNormals) {
-        _normals[ribbonPosInd1] = _mapNormals[posIndex];
-        _normals[ribbonPosInd2] = _mapNormals[posIndex + 1];
-        _normals[ribbonPosInd3] = _mapNormals[posIndex + 2];
+    });
+    // only the normals around the new vertices and on the opposite ribbon
+    // borders change
+    if (shiftZ != 0) {
+      shiftedRange(shiftZ, n, rowStart, rowEnd);
+      borderRow = (shiftZ > 0) ? 0 : n - 1;
+    }
+    if (shiftX != 0) {
+      shiftedRange(shiftX, n, colStart, colEnd);
+      borderCol = (shiftX > 0) ? 0 : n - 1;
+    }
+  }
+  else if (workerCount == 1) {
+    for (unsigned int j = 0; j < n; ++j) {
+      _updateRibbonRow(j, 0, n, bbMins[0], bbMaxs[0]);
+    }
+  }
+  else {
+    threadPool.parallelFor(n, grainSize, [&](size_t begin, size_t end, size_t workerIndex) {
+      for (auto j = static_cast<unsigned>(begin); j < end; ++j) {
+        _updateRibbonRow(j, 0, n, bbMins[workerIndex], bbMaxs[workerIndex]);
       }
+    });
+  }
 
-      // bbox internal update
-      if (_positions[ribbonPosInd1] < _bbMin.x) {
-        _bbMin.x = _positions[ribbonPosInd1];
-      }
-      if (_positions[ribbonPosInd1] > _bbMax.x) {
-        _bbMax.x = _positions[ribbonPosInd1];
-      }
-      if (_positions[ribbonPosInd2] < _bbMin.y) {
-        _bbMin.y = _positions[ribbonPosInd2];
-      }
-      if (_positions[ribbonPosInd2] > _bbMax.y) {
-        _bbMax.y = _positions[ribbonPosInd2];
-      }
-      if (_positions[ribbonPosInd3] < _bbMin.z) {
-        _bbMin.z = _positions[ribbonPosInd3];
-      }
-      if (_positions[ribbonPosInd3] > _bbMax.z) {
-        _bbMax.z = _positions[ribbonPosInd3];
-      }
-      // color
-      if (_colormap) {
-        _colors[ribbonColInd]     = _mapColors[colIndex];
-        _colors[ribbonColInd + 1] = _mapColors[colIndex + 1];
-        _colors[ribbonColInd + 2] = _mapColors[colIndex + 2];
-      }
-      // uv : the array _mapUVs is always populated
-      _uvs[ribbonUVInd]     = _mapUVs[uvIndex];
-      _uvs[ribbonUVInd + 1] = _mapUVs[uvIndex + 1];
-
-      // call to user custom function with the current updated vertex object
-      if (_useCustomVertexFunction) {
-        _vertex.position.copyFromFloats(_positions[ribbonPosInd1], _positions[ribbonPosInd2],
-                                        _positions[ribbonPosInd3]);
-        _vertex.worldPosition.x = _mapData[posIndex];
-        _vertex.worldPosition.y = _vertex.position.y;
-        _vertex.worldPosition.z = _mapData[posIndex + 2];
-        _vertex.lodX            = lodI;
-        _vertex.lodZ            = lodJ;
-        _vertex.color.r         = _colors[ribbonColInd];
-        _vertex.color.g         = _colors[ribbonColInd + 1];
-        _vertex.color.b         = _colors[ribbonColInd + 2];
-        _vertex.color.a         = _colors[ribbonColInd + 3];
-        _vertex.uvs.x           = _uvs[ribbonUVInd];
-        _vertex.uvs.y           = _uvs[ribbonUVInd + 1];
-        _vertex.mapIndex        = index;
-        updateVertex(_vertex, i,
-                     j); // the user can modify the array values here
-        _colors[ribbonColInd]     = _vertex.color.r;
-        _colors[ribbonColInd + 1] = _vertex.color.g;
-        _colors[ribbonColInd + 2] = _vertex.color.b;
-        _colors[ribbonColInd + 3] = _vertex.color.a;
-        _uvs[ribbonUVInd]         = _vertex.uvs.x;
-        _uvs[ribbonUVInd + 1]     = _vertex.uvs.y;
-        _positions[ribbonPosInd1] = _vertex.position.x;
-        _positions[ribbonPosInd2] = _vertex.position.y;
-        _positions[ribbonPosInd3] = _vertex.position.z;
+  if (_computeNormals && !shiftRibbon) {
+    threadPool.parallelFor(n, grainSize, [&](size_t begin, size_t end, size_t /*workerIndex*/) {
+      ComputeRibbonNormalsToRef(_positions, n, n, static_cast<unsigned>(begin),
+                                static_cast<unsigned>(end), 0, n, _frontSide, _normals);
+    });
+  }
+  else if (_computeNormals) {
+    threadPool.parallelFor(n, grainSize, [&](size_t begin, size_t end, size_t /*workerIndex*/) {
+      for (auto j = static_cast<unsigned>(begin); j < end; ++j) {
+        if ((j >= rowStart && j < rowEnd) || j == borderRow) {
+          ComputeRibbonNormalsToRef(_positions, n, n, j, j + 1, 0, n, _frontSide, _normals);
+        }
+        else if (colStart < colEnd) {
+          ComputeRibbonNormalsToRef(_positions, n, n, j, j + 1, colStart, colEnd, _frontSide,
+                                    _normals);
+          ComputeRibbonNormalsToRef(_positions, n, n, j, j + 1, borderCol, borderCol + 1,
+                                    _frontSide, _normals);
+        }
       }
+    });
+  }
 
-      stepI += lodI;
-    }
-    stepI = 0;
-    stepJ += lodJ;
+  auto bbMin = bbMins[0];
+  auto bbMax = bbMaxs[0];
+  for (std::size_t w = 1; w < workerCount; ++w) {
+    bbMin.minimizeInPlace(bbMins[w]);
+    bbMax.maximizeInPlace(bbMaxs[w]);
   }
 
   // ribbon update
   _terrain->updateVerticesData(VertexBuffer::PositionKind, _positions, false, false);
-  if (_computeNormals) {
-    VertexData::ComputeNormals(_positions, _indices, _normals);
-  }
   _terrain->updateVerticesData(VertexBuffer::NormalKind, _normals, false, false);
   _terrain->updateVerticesData(VertexBuffer::UVKind, _uvs, false, false);
   _terrain->updateVerticesData(VertexBuffer::ColorKind, _colors, false, false);
-  _terrain->_boundingInfo = std::make_unique<BoundingInfo>(_bbMin, _bbMax);
+  _terrain->_boundingInfo = std::make_unique<BoundingInfo>(bbMin, bbMax);
   _terrain->_boundingInfo->update(_terrain->_worldMatrix);
 }
 
+void DynamicTerrain::_updateRibbonSteps()
+{
+  const auto n = _terrainIdx;
+  _ribbonLODs.resize(n);
+  _ribbonSteps.resize(n);
+  _mapColumns.resize(n);
+  _terrainColumns.resize(n);
+
+  unsigned int step = 0;
+  for (unsigned int i = 0; i < n; ++i) {
+    // LOD
+    unsigned int LODValue = _LODValue;
+    for (unsigned int l = 0; l < _LODLimits.size(); ++l) {
+      const auto LODLimitDown = _LODLimits[l];
+      const auto LODLimitUp   = _terrainSub - LODLimitDown - 1;
+      if (i < LODLimitDown || i > LODLimitUp) {
+        LODValue = l + 1 + _LODValue;
+      }
+    }
+    _ribbonLODs[i]  = LODValue;
+    _ribbonSteps[i] = step;
+    step += LODValue;
+    // map columns
+    _mapColumns[i]     = (_deltaSubX + _ribbonSteps[i]) % _mapSubX;
+    _terrainColumns[i] = (_deltaSubX + _ribbonSteps[i]) % _terrainIdx;
+  }
+}
+
+void DynamicTerrain::_updateRibbonRow(unsigned int j, unsigned int colStart, unsigned int colEnd,
+                                      Vector3& bbMin, Vector3& bbMax)
+{
+  const auto stepJ  = _ribbonSteps[j];
+  const auto mapRow = ((_deltaSubZ + stepJ) % _mapSubZ) * _mapSubX;
+  const auto terRow = ((_deltaSubZ + stepJ) % _terrainIdx) * _terrainIdx;
+
+  for (unsigned int i = colStart; i < colEnd; ++i) {
+    // map current index
+    const auto index    = mapRow + _mapColumns[i];
+    const auto terIndex = terRow + _terrainColumns[i];
+    // related indexes in the arrays of positions, UVs and colors (data map or
+    // terrain map)
+    const auto posIndex = 3 * (_datamap ? index : terIndex);
+    const auto uvIndex  = 2 * (_uvmap ? index : terIndex);
+    const auto colIndex = 3 * (_colormap ? index : terIndex);
+    // ribbon indexes
+    const auto ribbonInd     = j * _terrainIdx + i;
+    const auto ribbonPosInd1 = 3 * ribbonInd;
+    const auto ribbonPosInd2 = ribbonPosInd1 + 1;
+    const auto ribbonPosInd3 = ribbonPosInd1 + 2;
+    const auto ribbonColInd  = 4 * ribbonInd;
+    const auto ribbonUVInd   = 2 * ribbonInd;
+
+    // geometry
+    _positions[ribbonPosInd1] = _averageSubSizeX * _ribbonSteps[i];
+    _positions[ribbonPosInd2] = _mapData[posIndex + 1];
+    _positions[ribbonPosInd3] = _averageSubSizeZ * stepJ;
+
+    if (!_computeNormals) {
+      _normals[ribbonPosInd1] = _mapNormals[posIndex];
+      _normals[ribbonPosInd2] = _mapNormals[posIndex + 1];
+      _normals[ribbonPosInd3] = _mapNormals[posIndex + 2];
+    }
+
+    // bbox internal update
+    bbMin.x = std::min(bbMin.x, _positions[ribbonPosInd1]);
+    bbMax.x = std::max(bbMax.x, _positions[ribbonPosInd1]);
+    bbMin.y = std::min(bbMin.y, _positions[ribbonPosInd2]);
+    bbMax.y = std::max(bbMax.y, _positions[ribbonPosInd2]);
+    bbMin.z = std::min(bbMin.z, _positions[ribbonPosInd3]);
+    bbMax.z = std::max(bbMax.z, _positions[ribbonPosInd3]);
+    // color
+    if (_colormap) {
+      _colors[ribbonColInd]     = _mapColors[colIndex];
+      _colors[ribbonColInd + 1] = _mapColors[colIndex + 1];
+      _colors[ribbonColInd + 2] = _mapColors[colIndex + 2];
+    }
+    // uv : the array _mapUVs is always populated
+    _uvs[ribbonUVInd]     = _mapUVs[uvIndex];
+    _uvs[ribbonUVInd + 1] = _mapUVs[uvIndex + 1];
+
+    // call to user custom function with the current updated vertex object
+    if (_useCustomVertexFunction) {
+      _vertex.position.copyFromFloats(_positions[ribbonPosInd1], _positions[ribbonPosInd2],
+                                      _positions[ribbonPosInd3]);
+      _vertex.worldPosition.x = _mapData[posIndex];
+      _vertex.worldPosition.y = _vertex.position.y;
+      _vertex.worldPosition.z = _mapData[posIndex + 2];
+      _vertex.lodX            = _ribbonLODs[i];
+      _vertex.lodZ            = _ribbonLODs[j];
+      _vertex.color.r         = _colors[ribbonColInd];
+      _vertex.color.g         = _colors[ribbonColInd + 1];
+      _vertex.color.b         = _colors[ribbonColInd + 2];
+      _vertex.color.a         = _colors[ribbonColInd + 3];
+      _vertex.uvs.x           = _uvs[ribbonUVInd];
+      _vertex.uvs.y           = _uvs[ribbonUVInd + 1];
+      _vertex.mapIndex        = index;
+      updateVertex(_vertex, i,
+                   j); // the user can modify the array values here
+      _colors[ribbonColInd]     = _vertex.color.r;
+      _colors[ribbonColInd + 1] = _vertex.color.g;
+      _colors[ribbonColInd + 2] = _vertex.color.b;
+      _colors[ribbonColInd + 3] = _vertex.color.a;
+      _uvs[ribbonUVInd]         = _vertex.uvs.x;
+      _uvs[ribbonUVInd + 1]     = _vertex.uvs.y;
+      _positions[ribbonPosInd1] = _vertex.position.x;
+      _positions[ribbonPosInd2] = _vertex.position.y;
+      _positions[ribbonPosInd3] = _vertex.position.z;
+    }
+  }
+}
+
 DynamicTerrain& DynamicTerrain::updateTerrainSize()
 {
   unsigned int remainder = _terrainSub; // the remaining cells at the general current LOD value
@@ -546,34 +726,128 @@ float DynamicTerrain::_GetHeightFromMap(float x, float z, const Float32Array& ma
 void DynamicTerrain::ComputeNormalsFromMapToRef(const Float32Array& mapData, unsigned int mapSubX,
                                                 unsigned int mapSubZ, Float32Array& normals)
 {
-  Uint32Array mapIndices;
-  auto tmp1Normal = Vector3::Zero();
-  auto tmp2Normal = Vector3::Zero();
-  unsigned int l  = mapSubX * (mapSubZ - 1);
-  for (unsigned int i = 0; i < l; i++) {
-    stl_util::concat(mapIndices, {i + 1, i + mapSubX, i});
-    stl_util::concat(mapIndices, {i + mapSubX, i + 1, i + mapSubX + 1});
+  auto tmpNormal = Vector3::Zero();
+  if (normals.size() < mapData.size()) {
+    normals.resize(mapData.size());
   }
-  VertexData::ComputeNormals(mapData, mapIndices, normals);
-  // seam process
-
-  unsigned int lastIdx  = (mapSubX - 1) * 3;
-  unsigned int colStart = 0;
-  unsigned int colEnd   = 0;
+  // The map quads are made of the same triangles than a back side ribbon. The
+  // normals of the first and last columns are completed by the seam process.
+  ThreadPool::Default().parallelFor(
+    mapSubZ, std::max<std::size_t>(1, RibbonVerticesPerTask / mapSubX),
+    [&](size_t begin, size_t end, size_t /*workerIndex*/) {
+      DynamicTerrain::ComputeRibbonNormalsToRef(
+        mapData, mapSubX, mapSubZ, static_cast<unsigned>(begin), static_cast<unsigned>(end), 0,
+        mapSubX, false, normals);
+    });
+  // seam process: the map wraps, the first and the last columns share the
+  // quads on both sides of the seam
+  const std::size_t lastIdx = (mapSubX - 1) * 3;
   for (unsigned int i = 0; i < mapSubZ; ++i) {
-    colStart = i * mapSubX * 3;
-    colEnd   = colStart + lastIdx;
-    DynamicTerrain::GetHeightFromMap(mapData[colStart], mapData[colStart + 2], mapData, mapSubX,
-                                     mapSubZ, tmp1Normal);
-    DynamicTerrain::GetHeightFromMap(mapData[colEnd], mapData[colEnd + 2], mapData, mapSubX,
-                                     mapSubZ, tmp2Normal);
-    tmp1Normal.addInPlace(tmp2Normal).scaleInPlace(0.5f);
-    normals[colStart]     = tmp1Normal.x;
-    normals[colStart + 1] = tmp1Normal.y;
-    normals[colStart + 2] = tmp1Normal.z;
-    normals[colEnd]       = tmp1Normal.x;
-    normals[colEnd + 1]   = tmp1Normal.y;
-    normals[colEnd + 2]   = tmp1Normal.z;
+    const std::size_t colStart = std::size_t(i) * mapSubX * 3;
+    const std::size_t colEnd   = colStart + lastIdx;
+    tmpNormal.copyFromFloats(normals[colStart] + normals[colEnd],
+                             normals[colStart + 1] + normals[colEnd + 1],
+                             normals[colStart + 2] + normals[colEnd + 2]);
+    tmpNormal.normalize();
+    normals[colStart]     = tmpNormal.x;
+    normals[colStart + 1] = tmpNormal.y;
+    normals[colStart + 2] = tmpNormal.z;
+    normals[colEnd]       = tmpNormal.x;
+    normals[colEnd + 1]   = tmpNormal.y;
+    normals[colEnd + 2]   = tmpNormal.z;
+  }
+}
+
+void DynamicTerrain::ComputeRibbonNormalsToRef(const Float32Array& positions, unsigned int columns,
+                                               unsigned int rows, unsigned int rowStart,
+                                               unsigned int rowEnd, unsigned int colStart,
+                                               unsigned int colEnd, bool frontSide,
+                                               Float32Array& normals)
+{
+  if (columns < 2 || rows < 2 || rowStart >= rowEnd || colStart >= colEnd) {
+    return;
+  }
+
+  // The vertex columns [colStart - 1, colEnd + 1) are deinterleaved in the
+  // slots [0, width + 2), and the normals of the quads between the columns v
+  // and v + 1 are stored in the slot v - colStart + 1, the missing quads
+  // having null normals. The vertex (i, j) belongs to the triangles
+  // (i, j), (i, j + 1), (i + 1, j) and (i + 1, j + 1), (i + 1, j), (i, j + 1).
+  const std::size_t width = colEnd - colStart;
+  const float sign        = frontSide ? 1.f : -1.f;
+  thread_local std::vector<float> scratch;
+  scratch.resize(6 * (width + 2) + 12 * (width + 1));
+  float* x0  = scratch.data();
+  float* y0  = x0 + (width + 2);
+  float* z0  = y0 + (width + 2);
+  float* x1  = z0 + (width + 2);
+  float* y1  = x1 + (width + 2);
+  float* z1  = y1 + (width + 2);
+  float* aX1 = z1 + (width + 2); // first triangles of the quad row above
+  float* aY1 = aX1 + (width + 1);
+  float* aZ1 = aY1 + (width + 1);
+  float* aX2 = aZ1 + (width + 1); // second triangles of the quad row above
+  float* aY2 = aX2 + (width + 1);
+  float* aZ2 = aY2 + (width + 1);
+  float* bX1 = aZ2 + (width + 1); // first triangles of the quad row below
+  float* bY1 = bX1 + (width + 1);
+  float* bZ1 = bY1 + (width + 1);
+  float* bX2 = bZ1 + (width + 1); // second triangles of the quad row below
+  float* bY2 = bX2 + (width + 1);
+  float* bZ2 = bY2 + (width + 1);
+
+  const auto slotStart = (colStart > 0) ? 0u : 1u;
+  const auto slotEnd   = (colEnd < columns) ? width + 2 : width + 1;
+  const auto loadRow = [&](unsigned int row, float* x, float* y, float* z) {
+    x[0] = y[0] = z[0] = x[width + 1] = y[width + 1] = z[width + 1] = 0.f;
+    const float* p = positions.data() + 3 * (std::size_t(row) * columns + colStart);
+    for (std::size_t s = slotStart; s < slotEnd; ++s) {
+      x[s] = p[3 * s - 3];
+      y[s] = p[3 * s - 2];
+      z[s] = p[3 * s - 1];
+    }
+  };
+  const auto computeQuadRow = [&](unsigned int row, float* nX1, float* nY1, float* nZ1, float* nX2,
+                                  float* nY2, float* nZ2) {
+    loadRow(row, x0, y0, z0);
+    loadRow(row + 1, x1, y1, z1);
+    computeQuadNormals(x0, y0, z0, x1, y1, z1, width + 1, sign, nX1, nY1, nZ1, nX2, nY2, nZ2);
+    // missing quads before the first column and after the last one
+    if (colStart == 0) {
+      nX1[0] = nY1[0] = nZ1[0] = nX2[0] = nY2[0] = nZ2[0] = 0.f;
+    }
+    if (colEnd == columns) {
+      nX1[width] = nY1[width] = nZ1[width] = nX2[width] = nY2[width] = nZ2[width] = 0.f;
+    }
+  };
+  const auto clearQuadRow = [&](float* nX1, float* nY1, float* nZ1, float* nX2, float* nY2,
+                                float* nZ2) {
+    for (auto* n : {nX1, nY1, nZ1, nX2, nY2, nZ2}) {
+      std::fill(n, n + width + 1, 0.f);
+    }
+  };
+
+  if (rowStart > 0) {
+    computeQuadRow(rowStart - 1, aX1, aY1, aZ1, aX2, aY2, aZ2);
+  }
+  else {
+    clearQuadRow(aX1, aY1, aZ1, aX2, aY2, aZ2);
+  }
+  for (auto j = rowStart; j < rowEnd; ++j) {
+    if (j + 1 < rows) {
+      computeQuadRow(j, bX1, bY1, bZ1, bX2, bY2, bZ2);
+    }
+    else {
+      clearQuadRow(bX1, bY1, bZ1, bX2, bY2, bZ2);
+    }
+    sumVertexNormals(aX1, aY1, aZ1, aX2, aY2, aZ2, bX1, bY1, bZ1, bX2, bY2, bZ2, width,
+                     normals.data() + 3 * (std::size_t(j) * columns + colStart));
+    std::swap(aX1, bX1);
+    std::swap(aY1, bY1);
+    std::swap(aZ1, bZ1);
+    std::swap(aX2, bX2);
+    std::swap(aY2, bY2);
+    std::swap(aZ2, bZ2);
   }
 }
 
@@ -815,7 +1089,8 @@ const Uint32Array& DynamicTerrain::LODLimits() const
 void DynamicTerrain::LODLimits(Uint32Array ar)
 {
   std::sort(ar.begin(), ar.end(), std::greater<std::uint32_t>());
-  _LODLimits = std::move(ar);
+  _LODLimits      = std::move(ar);
+  _ribbonOutdated = true;
 }
 
 const Float32Array& DynamicTerrain::mapData() const
@@ -844,7 +1119,8 @@ unsigned int DynamicTerrain::mapSubX() const
 
 void DynamicTerrain::setMapSubX(unsigned int val)
 {
-  _mapSubX = val;
+  _mapSubX        = val;
+  _ribbonOutdated = true;
 }
 
 unsigned int DynamicTerrain::mapSubZ() const
@@ -854,7 +1130,8 @@ unsigned int DynamicTerrain::mapSubZ() const
 
 void DynamicTerrain::setMapSubZ(unsigned int val)
 {
-  _mapSubZ = val;
+  _mapSubZ        = val;
+  _ribbonOutdated = true;
 }
 
 const Float32Array& DynamicTerrain::mapColors() const
@@ -864,8 +1141,9 @@ const Float32Array& DynamicTerrain::mapColors() const
 
 void DynamicTerrain::setMapColors(const Float32Array& val)
 {
-  _colormap  = true;
-  _mapColors = val;
+  _colormap       = true;
+  _mapColors      = val;
+  _ribbonOutdated = true;
 }
 
 const Float32Array& DynamicTerrain::mapUVs() const
@@ -875,8 +1153,9 @@ const Float32Array& DynamicTerrain::mapUVs() const
 
 void DynamicTerrain::setMapUVs(const Float32Array& val)
 {
-  _uvmap  = true;
-  _mapUVs = val;
+  _uvmap          = true;
+  _mapUVs         = val;
+  _ribbonOutdated = true;
 }
 
 const Float32Array& DynamicTerrain::mapNormals() const
@@ -886,7 +1165,8 @@ const Float32Array& DynamicTerrain::mapNormals() const
 
 void DynamicTerrain::setMapNormals(const Float32Array& val)
 {
-  _mapNormals = val;
+  _mapNormals     = val;
+  _ribbonOutdated = true;
 }
 
 bool DynamicTerrain::computeNormals() const
@@ -897,6 +1177,7 @@ bool DynamicTerrain::computeNormals() const
 void DynamicTerrain::setComputeNormals(bool val)
 {
   _computeNormals = val;
+  _ribbonOutdated = true;
 }
 
 bool DynamicTerrain::useCustomVertexFunction() const
@@ -907,6 +1188,7 @@ bool DynamicTerrain::useCustomVertexFunction() const
 void DynamicTerrain::useCustomVertexFunction(bool val)
 {
   _useCustomVertexFunction = val;
+  _ribbonOutdated          = true;
 }
 
 bool DynamicTerrain::isAlwaysVisible() const
@@ -930,6 +1212,11 @@ void DynamicTerrain::setPrecomputeNormalsFromMap(bool val)
   _precomputeNormalsFromMap = val;
 }
 
+void DynamicTerrain::setThreadPool(ThreadPool* threadPool)
+{
+  _threadPool = threadPool;
+}
+
 void DynamicTerrain::updateVertex(DynamicTerrainVertex& /*vertex*/, unsigned int /*i*/,
                                   unsigned /*j*/)
 {
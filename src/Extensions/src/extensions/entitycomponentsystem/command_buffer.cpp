@@ -0,0 +1,74 @@
+#include <babylon/extensions/entitycomponentsystem/command_buffer.h>
+
+#include <babylon/extensions/entitycomponentsystem/world.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace ECS {
+
+void CommandBuffer::push(Command command)
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  m_commands.emplace_back(std::move(command));
+}
+
+void CommandBuffer::createEntity(std::function<void(Entity&)> initialize)
+{
+  push([initialize = std::move(initialize)](World& world) {
+    auto entity = world.createEntity();
+    initialize(entity);
+  });
+}
+
+void CommandBuffer::killEntity(const Entity& entity)
+{
+  push([entity](World& world) {
+    Entity e{entity};
+    world.killEntity(e);
+  });
+}
+
+void CommandBuffer::activateEntity(const Entity& entity)
+{
+  push([entity](World& world) {
+    Entity e{entity};
+    world.activateEntity(e);
+  });
+}
+
+void CommandBuffer::deactivateEntity(const Entity& entity)
+{
+  push([entity](World& world) {
+    Entity e{entity};
+    world.deactivateEntity(e);
+  });
+}
+
+bool CommandBuffer::empty() const
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  return m_commands.empty();
+}
+
+void CommandBuffer::apply(World& world)
+{
+  std::vector<Command> commands;
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    commands.swap(m_commands);
+  }
+
+  for (auto& command : commands) {
+    command(world);
+  }
+}
+
+void CommandBuffer::clear()
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  m_commands.clear();
+}
+
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
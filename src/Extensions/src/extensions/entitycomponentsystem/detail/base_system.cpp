@@ -10,7 +10,7 @@ namespace ECS {
 namespace detail {
 
 BaseSystem::BaseSystem(const Filter& filter)
-    : m_world(nullptr), m_filter(filter)
+    : m_world(nullptr), m_filter(filter), m_hasDeclaredAccess(false)
 {
 }
 
@@ -32,6 +32,40 @@ const std::vector<Entity>& BaseSystem::getEntities() const
   return m_entities;
 }
 
+void BaseSystem::update()
+{
+  updateEntities(0, m_entities.size());
+}
+
+void BaseSystem::updateEntities(std::size_t /*begin*/, std::size_t /*end*/)
+{
+}
+
+std::size_t BaseSystem::getGrainSize() const
+{
+  return 0;
+}
+
+std::size_t BaseSystem::getRangeEnd() const
+{
+  return m_entities.size();
+}
+
+const ComponentTypeList& BaseSystem::getReadComponentTypes() const
+{
+  return m_readComponentTypes;
+}
+
+const ComponentTypeList& BaseSystem::getWriteComponentTypes() const
+{
+  return m_writeComponentTypes;
+}
+
+bool BaseSystem::hasDeclaredAccess() const
+{
+  return m_hasDeclaredAccess;
+}
+
 void BaseSystem::add(Entity& entity)
 {
   m_entities.push_back(entity);
@@ -9,21 +9,31 @@ namespace ECS {
 namespace detail {
 
 EntityComponentStorage::EntityComponentStorage(std::size_t entityAmount)
-    : m_componentEntries(entityAmount)
+    : m_componentTypeLists(entityAmount)
 {
 }
 
-void EntityComponentStorage::addComponent(Entity& entity, Component* component,
-                                          TypeId componentTypeId)
+EntityComponentStorage::~EntityComponentStorage() = default;
+
+BaseComponentPool& EntityComponentStorage::getPool(TypeId componentTypeId,
+                                                   BaseComponentPool* (*createPool)())
+{
+  ANAX_ASSERT(componentTypeId < MAX_AMOUNT_OF_COMPONENTS, "too many component types");
+
+  auto& pool = m_pools[componentTypeId];
+  if (!pool) {
+    pool.reset(createPool());
+  }
+
+  return *pool;
+}
+
+void EntityComponentStorage::addComponent(Entity& entity, TypeId componentTypeId)
 {
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot have components added to it");
 
-  auto index                   = entity.getId().index;
-  auto& componentDataForEntity = m_componentEntries[index];
-
-  componentDataForEntity.components[componentTypeId].reset(component);
-  componentDataForEntity.componentTypeList[componentTypeId] = true;
+  m_componentTypeLists[entity.getId().index][componentTypeId] = true;
 }
 
 void EntityComponentStorage::removeComponent(Entity& entity,
@@ -31,21 +41,26 @@ void EntityComponentStorage::removeComponent(Entity& entity,
 {
   ANAX_ASSERT(entity.isValid(), "invalid entity cannot remove components");
 
-  auto index                   = entity.getId().index;
-  auto& componentDataForEntity = m_componentEntries[index];
+  auto index = entity.getId().index;
 
-  componentDataForEntity.components[componentTypeId].reset();
-  componentDataForEntity.componentTypeList[componentTypeId] = false;
+  if (m_pools[componentTypeId]) {
+    m_pools[componentTypeId]->remove(index);
+  }
+  m_componentTypeLists[index][componentTypeId] = false;
 }
 
 void EntityComponentStorage::removeAllComponents(Entity& entity)
 {
-  auto index                   = entity.getId().index;
-  auto& componentDataForEntity = m_componentEntries[index];
-
-  for (auto& c : componentDataForEntity.components)
-    c.reset();
-  componentDataForEntity.componentTypeList.reset();
+  auto index              = entity.getId().index;
+  auto& componentTypeList = m_componentTypeLists[index];
+
+  for (TypeId componentTypeId = 0; componentTypeId < MAX_AMOUNT_OF_COMPONENTS;
+       ++componentTypeId) {
+    if (componentTypeList[componentTypeId]) {
+      m_pools[componentTypeId]->remove(index);
+    }
+  }
+  componentTypeList.reset();
 }
 
 Component& EntityComponentStorage::getComponent(const Entity& entity,
@@ -54,7 +69,7 @@ Component& EntityComponentStorage::getComponent(const Entity& entity,
   ANAX_ASSERT(entity.isValid() && hasComponent(entity, componentTypeId),
               "Entity is not valid or does not contain component");
 
-  return *getComponentsImpl(entity)[componentTypeId];
+  return m_pools[componentTypeId]->getComponent(entity.getId().index);
 }
 
 ComponentTypeList
@@ -63,7 +78,7 @@ EntityComponentStorage::getComponentTypeList(const Entity& entity) const
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot retrieve the component list");
 
-  return m_componentEntries[entity.getId().index].componentTypeList;
+  return m_componentTypeLists[entity.getId().index];
 }
 
 ComponentArray EntityComponentStorage::getComponents(const Entity& entity) const
@@ -71,13 +86,18 @@ ComponentArray EntityComponentStorage::getComponents(const Entity& entity) const
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot retrieve components, as it has none");
 
-  auto& componentsToConvert = getComponentsImpl(entity);
+  const auto& componentTypeList = m_componentTypeLists[entity.getId().index];
 
   ComponentArray temp;
-  temp.reserve(componentsToConvert.size());
+  temp.reserve(MAX_AMOUNT_OF_COMPONENTS);
 
-  for (auto& i : componentsToConvert)
-    temp.emplace_back(i.get());
+  for (TypeId componentTypeId = 0; componentTypeId < MAX_AMOUNT_OF_COMPONENTS;
+       ++componentTypeId) {
+    temp.emplace_back(
+      componentTypeList[componentTypeId] ?
+        &m_pools[componentTypeId]->getComponent(entity.getId().index) :
+        nullptr);
+  }
 
   return temp;
 }
@@ -88,32 +108,23 @@ bool EntityComponentStorage::hasComponent(const Entity& entity,
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot check if it has components");
 
-  auto& components = getComponentsImpl(entity);
-
-  return components.size() > componentTypeId
-         && components[componentTypeId] != nullptr;
+  return componentTypeId < MAX_AMOUNT_OF_COMPONENTS
+         && m_componentTypeLists[entity.getId().index][componentTypeId];
 }
 
 void EntityComponentStorage::resize(std::size_t entityAmount)
 {
-  m_componentEntries.resize(entityAmount);
+  m_componentTypeLists.resize(entityAmount);
 }
 
 void EntityComponentStorage::clear()
 {
-  m_componentEntries.clear();
-}
-
-EntityComponentStorage::ImplComponentArray&
-EntityComponentStorage::getComponentsImpl(const Entity& e)
-{
-  return m_componentEntries[e.getId().index].components;
-}
-
-const EntityComponentStorage::ImplComponentArray&
-EntityComponentStorage::getComponentsImpl(const Entity& e) const
-{
-  return m_componentEntries[e.getId().index].components;
+  for (auto& pool : m_pools) {
+    if (pool) {
+      pool->clear();
+    }
+  }
+  m_componentTypeLists.clear();
 }
 
 } // end of namespace detail
@@ -77,9 +77,19 @@ bool Entity::operator==(const Entity& entity) const
   return m_id == entity.m_id && entity.m_world == m_world;
 }
 
-void Entity::addComponent(Component* component, detail::TypeId componentTypeId)
+detail::BaseComponentPool&
+Entity::getComponentPool(detail::TypeId componentTypeId,
+                         detail::BaseComponentPool* (*createPool)()) const
 {
-  getWorld().m_entityAttributes.componentStorage.addComponent(*this, component,
+  ANAX_ASSERT(isValid(), "invalid entity cannot have components added to it");
+
+  return getWorld().m_entityAttributes.componentStorage.getPool(componentTypeId,
+                                                                createPool);
+}
+
+void Entity::addComponent(detail::TypeId componentTypeId)
+{
+  getWorld().m_entityAttributes.componentStorage.addComponent(*this,
                                                               componentTypeId);
 }
 
@@ -0,0 +1,139 @@
+#include <babylon/extensions/entitycomponentsystem/system_scheduler.h>
+
+#include <algorithm>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/entitycomponentsystem/detail/anax_assert.h>
+#include <babylon/extensions/entitycomponentsystem/world.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace ECS {
+
+SystemScheduler::SystemScheduler(World& world)
+    : m_world(world), m_threadPool(nullptr), m_stagesAreDirty(false)
+{
+}
+
+SystemScheduler::~SystemScheduler() = default;
+
+void SystemScheduler::setThreadPool(ThreadPool* threadPool)
+{
+  m_threadPool = threadPool;
+}
+
+void SystemScheduler::addSystem(detail::BaseSystem& system)
+{
+  ANAX_ASSERT(&system.getWorld() == &m_world, "system is not attached to the world of the scheduler");
+  m_systems.emplace_back(&system);
+  m_stagesAreDirty = true;
+}
+
+void SystemScheduler::removeSystem(detail::BaseSystem& system)
+{
+  m_systems.erase(std::remove(m_systems.begin(), m_systems.end(), &system), m_systems.end());
+  m_stagesAreDirty = true;
+}
+
+void SystemScheduler::removeAllSystems()
+{
+  m_systems.clear();
+  m_stagesAreDirty = true;
+}
+
+const std::vector<std::vector<detail::BaseSystem*>>& SystemScheduler::getStages()
+{
+  if (m_stagesAreDirty) {
+    buildStages();
+  }
+  return m_stages;
+}
+
+void SystemScheduler::update()
+{
+  // sync point: apply the structural changes and update the system entities
+  m_world.refresh();
+
+  for (const auto& stage : getStages()) {
+    updateStage(stage);
+  }
+}
+
+bool SystemScheduler::conflicts(const detail::BaseSystem& a, const detail::BaseSystem& b)
+{
+  if (!a.hasDeclaredAccess() || !b.hasDeclaredAccess()) {
+    return true;
+  }
+
+  const auto& aWrites = a.getWriteComponentTypes();
+  const auto& bWrites = b.getWriteComponentTypes();
+  return (aWrites & (b.getReadComponentTypes() | bWrites)).any()
+         || (bWrites & a.getReadComponentTypes()).any();
+}
+
+void SystemScheduler::buildStages()
+{
+  // A system goes to the stage after the last stage of the systems it
+  // conflicts with, which keeps the program order of the conflicting systems
+  std::vector<std::size_t> systemStages(m_systems.size(), 0);
+  m_stages.clear();
+  for (std::size_t j = 0; j < m_systems.size(); ++j) {
+    for (std::size_t i = 0; i < j; ++i) {
+      if (conflicts(*m_systems[i], *m_systems[j])) {
+        systemStages[j] = std::max(systemStages[j], systemStages[i] + 1);
+      }
+    }
+
+    if (systemStages[j] >= m_stages.size()) {
+      m_stages.resize(systemStages[j] + 1);
+    }
+    m_stages[systemStages[j]].emplace_back(m_systems[j]);
+  }
+
+  m_stagesAreDirty = false;
+}
+
+void SystemScheduler::updateStage(const std::vector<detail::BaseSystem*>& stage)
+{
+  m_tasks.clear();
+  for (auto system : stage) {
+    const auto entityCount = system->getRangeEnd();
+    const auto grainSize   = system->getGrainSize();
+    if (grainSize == 0 || entityCount <= grainSize) {
+      m_tasks.emplace_back(Task{system, 0, entityCount, true});
+      continue;
+    }
+
+    for (std::size_t begin = 0; begin < entityCount; begin += grainSize) {
+      m_tasks.emplace_back(Task{system, begin, std::min(begin + grainSize, entityCount), false});
+    }
+  }
+
+  const auto updateTask = [](const Task& task) {
+    if (task.isWholeSystem) {
+      task.system->update();
+    }
+    else {
+      task.system->updateEntities(task.begin, task.end);
+    }
+  };
+
+  // A single task runs on the calling thread, so that a system can use the
+  // thread pool itself
+  if (m_tasks.size() == 1) {
+    updateTask(m_tasks.front());
+    return;
+  }
+
+  auto& threadPool = m_threadPool ? *m_threadPool : ThreadPool::Default();
+  threadPool.parallelFor(m_tasks.size(), 1,
+                         [this, &updateTask](size_t begin, size_t end, size_t /*workerIndex*/) {
+                           for (size_t i = begin; i < end; ++i) {
+                             updateTask(m_tasks[i]);
+                           }
+                         });
+}
+
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
@@ -99,6 +99,9 @@ bool World::isValid(const Entity& entity) const
 
 void World::refresh()
 {
+  // apply the structural changes recorded since the last call to refresh
+  m_commandBuffer.apply(*this);
+
   // go through all the activated entities from last call to refresh
   for (auto& entity : m_entityCache.activated) {
     auto& attribute     = m_entityAttributes.attributes[entity.getId().index];
@@ -179,10 +182,18 @@ void World::clear()
   // clear the entity cache
   m_entityCache.clear();
 
+  // drop the structural changes not applied yet
+  m_commandBuffer.clear();
+
   // clear the id pool
   m_entityIdPool.clear();
 }
 
+CommandBuffer& World::getCommandBuffer()
+{
+  return m_commandBuffer;
+}
+
 std::size_t World::getEntityCount() const
 {
   return m_entityCache.alive.size();
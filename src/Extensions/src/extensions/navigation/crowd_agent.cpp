@@ -63,18 +63,26 @@ bool CrowdAgent::hasRoadMap() const
   return _roadmap.size() > 1;
 }
 
-std::vector<CrowdRoadmapVertex>& CrowdAgent::roadmap()
+const std::vector<CrowdRoadmapVertex>& CrowdAgent::roadmap() const
 {
-  return _roadmap;
+  return _sharedRoadmap ? *_sharedRoadmap : _roadmap;
 }
 
-const std::vector<CrowdRoadmapVertex>& CrowdAgent::roadmap() const
+const std::vector<CrowdRoadmapVertex>& CrowdAgent::wayPoints() const
 {
   return _roadmap;
 }
 
+void CrowdAgent::setRoadmap(const CrowdRoadmapPtr& roadmap)
+{
+  _sharedRoadmap = roadmap;
+}
+
 void CrowdAgent::addWayPoint(const BABYLON::Vector2& wayPoint)
 {
+  // The roadmap needs to be recomputed
+  _sharedRoadmap = nullptr;
+
   if (_roadmap.empty()) {
     // Add the goal positions of the agent
     CrowdRoadmapVertex p;
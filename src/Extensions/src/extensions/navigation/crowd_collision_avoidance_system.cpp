@@ -8,6 +8,7 @@ namespace Extensions {
 
 CrowdCollisionAvoidanceSystem::CrowdCollisionAvoidanceSystem(RVO2::RVOSimulator* sim) : _sim{sim}
 {
+  writes<CrowdAgent>();
 }
 
 CrowdCollisionAvoidanceSystem::~CrowdCollisionAvoidanceSystem() = default;
@@ -26,7 +27,7 @@ void CrowdCollisionAvoidanceSystem::setPreferredVelocities()
 {
   const auto& entities = getEntities();
   for (auto& entity : entities) {
-    auto agent = entity.getComponent<CrowdAgent>();
+    auto& agent = entity.getComponent<CrowdAgent>();
     if (!agent.hasRoadMap()) {
       // Set the preferred velocity to be a vector of unit magnitude (speed) in the direction of the
       // goal
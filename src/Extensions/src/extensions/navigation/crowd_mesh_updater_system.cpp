@@ -1,24 +1,42 @@
 #include <babylon/extensions/navigation/crowd_mesh_updater_system.h>
 
+#include <babylon/extensions/entitycomponentsystem/world.h>
 #include <babylon/meshes/abstract_mesh.h>
 
 namespace BABYLON {
 namespace Extensions {
 
-CrowdMeshUpdaterSystem::CrowdMeshUpdaterSystem() = default;
+CrowdMeshUpdaterSystem::CrowdMeshUpdaterSystem()
+{
+  reads<CrowdAgent>();
+  writes<CrowdMesh>();
+}
 
 CrowdMeshUpdaterSystem::~CrowdMeshUpdaterSystem() = default;
 
 void CrowdMeshUpdaterSystem::update()
 {
-  auto entities = getEntities();
-  for (auto& entity : entities) {
-    auto crowdAgent              = entity.getComponent<CrowdAgent>();
-    auto crowdMesh               = entity.getComponent<CrowdMesh>();
-    const auto& position         = crowdAgent.position();
-    crowdMesh.mesh->position().x = position.x();
-    crowdMesh.mesh->position().z = position.y();
-  }
+  updateEntities(0, getRangeEnd());
+}
+
+void CrowdMeshUpdaterSystem::updateEntities(std::size_t begin, std::size_t end)
+{
+  getWorld().view<CrowdAgent, CrowdMesh>().each(
+    begin, end, [](const CrowdAgent& crowdAgent, CrowdMesh& crowdMesh) {
+      const auto& position         = crowdAgent.position();
+      crowdMesh.mesh->position().x = position.x();
+      crowdMesh.mesh->position().z = position.y();
+    });
+}
+
+std::size_t CrowdMeshUpdaterSystem::getGrainSize() const
+{
+  return 256;
+}
+
+std::size_t CrowdMeshUpdaterSystem::getRangeEnd() const
+{
+  return getWorld().view<CrowdAgent, CrowdMesh>().extent();
 }
 
 } // end of namespace Extensions
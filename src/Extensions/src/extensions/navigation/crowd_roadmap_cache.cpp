@@ -0,0 +1,255 @@
+#include <babylon/extensions/navigation/crowd_roadmap_cache.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+namespace {
+
+// Distance of the vertices from which the goal cannot be reached
+constexpr float UnreachableDistance = 9e9f;
+
+uint64_t floatBits(float value)
+{
+  uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+uint64_t goalKey(const RVO2::Vector2& goal)
+{
+  return (floatBits(goal.x()) << 32) | floatBits(goal.y());
+}
+
+} // end of anonymous namespace
+
+struct CrowdRoadmapCache::RoadmapClass {
+  float radius = 0.f;
+  std::vector<RVO2::Vector2> wayPoints;
+  // Visibility graph of the waypoints, computed on first use
+  bool hasVisibilityGraph = false;
+  std::vector<Uint32Array> neighbors;
+  // Roadmaps, by goal
+  std::unordered_map<uint64_t, CrowdRoadmapPtr> roadmaps;
+}; // end of struct RoadmapClass
+
+namespace {
+
+size_t roadmapClassHash(const CrowdRoadmapCache::Request& request)
+{
+  // FNV-1a over the radius and the waypoints positions
+  uint64_t hash  = 14695981039346656037ull;
+  const auto mix = [&hash](uint64_t value) {
+    hash = (hash ^ value) * 1099511628211ull;
+  };
+  mix(floatBits(request.radius));
+  const auto& vertices = *request.vertices;
+  for (size_t i = 1; i < vertices.size(); ++i) {
+    mix(goalKey(vertices[i].position));
+  }
+  return static_cast<size_t>(hash);
+}
+
+} // end of anonymous namespace
+
+CrowdRoadmapCache::CrowdRoadmapCache(const RVO2::RVOSimulator* sim) : _sim{sim}
+{
+}
+
+CrowdRoadmapCache::~CrowdRoadmapCache() = default;
+
+void CrowdRoadmapCache::computeRoadmaps(const std::vector<Request>& requests,
+                                        std::vector<CrowdRoadmapPtr>& roadmaps)
+{
+  // Find the roadmap classes and the goals which are not computed yet
+  struct PendingRoadmap {
+    size_t roadmapClass;
+    RVO2::Vector2 goal;
+    CrowdRoadmapPtr roadmap;
+  };
+  std::vector<PendingRoadmap> pendingRoadmaps;
+  std::vector<size_t> requestClasses(requests.size());
+  for (size_t r = 0; r < requests.size(); ++r) {
+    const auto classIndex = getRoadmapClass(requests[r]);
+    requestClasses[r]     = classIndex;
+    // Placeholder, replaced by the roadmap once computed
+    const auto& goal = requests[r].vertices->front().position;
+    if (_roadmapClasses[classIndex]->roadmaps.emplace(goalKey(goal), nullptr).second) {
+      pendingRoadmaps.push_back({classIndex, goal, nullptr});
+    }
+  }
+
+  // Compute the missing visibility graphs, each one in parallel
+  for (const auto& pendingRoadmap : pendingRoadmaps) {
+    auto& roadmapClass = *_roadmapClasses[pendingRoadmap.roadmapClass];
+    if (!roadmapClass.hasVisibilityGraph) {
+      computeVisibilityGraph(roadmapClass);
+    }
+  }
+
+  // Compute the missing distance to goal fields in parallel
+  ThreadPool::Default().parallelFor(
+    pendingRoadmaps.size(), 1, [&](size_t begin, size_t end, size_t /*workerIndex*/) {
+      for (size_t i = begin; i < end; ++i) {
+        auto& pendingRoadmap   = pendingRoadmaps[i];
+        pendingRoadmap.roadmap = computeRoadmap(
+          *_roadmapClasses[pendingRoadmap.roadmapClass], pendingRoadmap.goal);
+      }
+    });
+  for (auto& pendingRoadmap : pendingRoadmaps) {
+    _roadmapClasses[pendingRoadmap.roadmapClass]->roadmaps[goalKey(pendingRoadmap.goal)]
+      = std::move(pendingRoadmap.roadmap);
+  }
+
+  // Share the roadmaps
+  roadmaps.resize(requests.size());
+  for (size_t r = 0; r < requests.size(); ++r) {
+    const auto& goal = requests[r].vertices->front().position;
+    roadmaps[r]      = _roadmapClasses[requestClasses[r]]->roadmaps[goalKey(goal)];
+  }
+}
+
+void CrowdRoadmapCache::clear()
+{
+  _roadmapClasses.clear();
+  _roadmapClassesByHash.clear();
+}
+
+size_t CrowdRoadmapCache::roadmapClassCount() const
+{
+  return _roadmapClasses.size();
+}
+
+size_t CrowdRoadmapCache::roadmapCount() const
+{
+  size_t count = 0;
+  for (const auto& roadmapClass : _roadmapClasses) {
+    count += roadmapClass->roadmaps.size();
+  }
+  return count;
+}
+
+size_t CrowdRoadmapCache::getRoadmapClass(const Request& request)
+{
+  const auto& vertices = *request.vertices;
+  const auto hash      = roadmapClassHash(request);
+
+  // Look for an existing class with the same waypoints and radius
+  const auto range = _roadmapClassesByHash.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    const auto& roadmapClass = *_roadmapClasses[it->second];
+    if (roadmapClass.radius != request.radius
+        || roadmapClass.wayPoints.size() + 1 != vertices.size()) {
+      continue;
+    }
+    bool sameWayPoints = true;
+    for (size_t i = 1; i < vertices.size() && sameWayPoints; ++i) {
+      sameWayPoints = roadmapClass.wayPoints[i - 1] == vertices[i].position;
+    }
+    if (sameWayPoints) {
+      return it->second;
+    }
+  }
+
+  // Create a new class
+  auto roadmapClass    = std::make_unique<RoadmapClass>();
+  roadmapClass->radius = request.radius;
+  roadmapClass->wayPoints.reserve(vertices.size() - 1);
+  for (size_t i = 1; i < vertices.size(); ++i) {
+    roadmapClass->wayPoints.emplace_back(vertices[i].position);
+  }
+  const auto classIndex = _roadmapClasses.size();
+  _roadmapClasses.emplace_back(std::move(roadmapClass));
+  _roadmapClassesByHash.emplace(hash, classIndex);
+  return classIndex;
+}
+
+void CrowdRoadmapCache::computeVisibilityGraph(RoadmapClass& roadmapClass) const
+{
+  const auto& wayPoints  = roadmapClass.wayPoints;
+  const auto vertexCount = wayPoints.size();
+  const float radius     = roadmapClass.radius;
+
+  // The obstacles are one-sided, so the visibility is queried in both directions. The rows are
+  // spread over the workers, each worker filling the neighbors of its own vertices.
+  roadmapClass.neighbors.assign(vertexCount, Uint32Array());
+  ThreadPool::Default().parallelFor(
+    vertexCount, 4, [&](size_t begin, size_t end, size_t /*workerIndex*/) {
+      for (size_t i = begin; i < end; ++i) {
+        auto& neighbors = roadmapClass.neighbors[i];
+        for (size_t j = 0; j < vertexCount; ++j) {
+          if (j != i && _sim->queryVisibility(wayPoints[i], wayPoints[j], radius)) {
+            neighbors.emplace_back(static_cast<uint32_t>(j));
+          }
+        }
+      }
+    });
+  roadmapClass.hasVisibilityGraph = true;
+}
+
+CrowdRoadmapPtr CrowdRoadmapCache::computeRoadmap(const RoadmapClass& roadmapClass,
+                                                  const RVO2::Vector2& goal) const
+{
+  const auto& wayPoints  = roadmapClass.wayPoints;
+  const auto vertexCount = wayPoints.size() + 1;
+
+  // The goal is vertex 0, the waypoints follow
+  auto roadmap         = std::make_shared<CrowdRoadmap>(vertexCount);
+  auto& vertices       = *roadmap;
+  vertices[0].position = goal;
+  for (size_t i = 1; i < vertexCount; ++i) {
+    vertices[i].position  = wayPoints[i - 1];
+    vertices[i].neighbors = roadmapClass.neighbors[i - 1];
+    for (auto& neighbor : vertices[i].neighbors) {
+      ++neighbor;
+    }
+  }
+  for (size_t i = 1; i < vertexCount; ++i) {
+    if (_sim->queryVisibility(goal, wayPoints[i - 1], roadmapClass.radius)) {
+      vertices[0].neighbors.emplace_back(static_cast<uint32_t>(i));
+    }
+    if (_sim->queryVisibility(wayPoints[i - 1], goal, roadmapClass.radius)) {
+      vertices[i].neighbors.insert(vertices[i].neighbors.begin(), 0);
+    }
+  }
+
+  // Dijkstra's algorithm from the goal, on a binary heap. Instead of decreasing the keys, the
+  // vertices are pushed again and the outdated entries are skipped.
+  std::vector<float> distances(vertexCount, UnreachableDistance);
+  std::vector<std::pair<float, uint32_t>> heap;
+  heap.reserve(vertexCount);
+  const auto greater = std::greater<std::pair<float, uint32_t>>();
+  distances[0]       = 0.f;
+  heap.emplace_back(0.f, 0);
+  while (!heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), greater);
+    const auto [dist_u, u] = heap.back();
+    heap.pop_back();
+    if (dist_u > distances[u]) {
+      continue;
+    }
+    for (const auto v : vertices[u].neighbors) {
+      const float dist_v = dist_u + RVO2::abs(vertices[v].position - vertices[u].position);
+      if (dist_v < distances[v]) {
+        distances[v] = dist_v;
+        heap.emplace_back(dist_v, v);
+        std::push_heap(heap.begin(), heap.end(), greater);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < vertexCount; ++i) {
+    vertices[i].distToGoal.assign(1, distances[i]);
+  }
+
+  return roadmap;
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
@@ -2,7 +2,6 @@
 
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
-#include <babylon/extensions/navigation/crowd_roadmap_vertex.h>
 #include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
 #include <babylon/meshes/abstract_mesh.h>
 
@@ -12,6 +11,8 @@ namespace Extensions {
 CrowdSimulation::CrowdSimulation()
     : _simulator{std::make_unique<RVO2::RVOSimulator>()}
     , _crowdCollisionAvoidanceSystem{CrowdCollisionAvoidanceSystem(_simulator.get())}
+    , _systemScheduler{_world}
+    , _roadmapCache{_simulator.get()}
 {
   initializeWorld();
   _simulator->setAgentDefaults(15.0f, 10, 5.0f, 5.0f, 2.0f, 2.0f);
@@ -23,6 +24,8 @@ void CrowdSimulation::initializeWorld()
 {
   _world.addSystem(_crowdCollisionAvoidanceSystem);
   _world.addSystem(_crowdMeshUpdaterSystem);
+  _systemScheduler.addSystem(_crowdCollisionAvoidanceSystem);
+  _systemScheduler.addSystem(_crowdMeshUpdaterSystem);
 }
 
 void CrowdSimulation::setTimeStep(float timeStep)
@@ -104,6 +107,8 @@ void CrowdSimulation::addObstacleByBoundingBox(const AbstractMeshPtr& mesh, cons
 void CrowdSimulation::processObstacles()
 {
   _simulator->processObstacles();
+  // The visibility between the roadmap vertices changed
+  _roadmapCache.clear();
 }
 
 void CrowdSimulation::addWayPoint(const BABYLON::Vector2& waypoint)
@@ -115,62 +120,23 @@ void CrowdSimulation::addWayPoint(const BABYLON::Vector2& waypoint)
 
 void CrowdSimulation::computeRoadMap()
 {
+  std::vector<CrowdRoadmapCache::Request> requests;
+  std::vector<CrowdAgent*> agents;
   for (auto& agent : _agents) {
     // Check if there is a roadmap configured
-    if (!agent.getComponent<CrowdAgent>().hasRoadMap()) {
+    auto& crowdAgent = agent.getComponent<CrowdAgent>();
+    if (!crowdAgent.hasRoadMap()) {
       continue;
     }
 
-    // Get the agent properties
-    auto& roadmap    = agent.getComponent<CrowdAgent>().roadmap();
-    auto agentRadius = agent.getComponent<CrowdAgent>().radius();
-
-    // Connect the roadmap vertices by edges if mutually visible.
-    for (size_t i = 0; i < roadmap.size(); ++i) {
-      for (size_t j = 0; j < roadmap.size(); ++j) {
-        if (_simulator->queryVisibility(roadmap[i].position, roadmap[j].position, agentRadius)) {
-          roadmap[i].neighbors.push_back(static_cast<uint32_t>(j));
-        }
-      }
-
-      // Initialize the distance to each of the four goal vertices at infinity
-      // (9e9f).
-      roadmap[i].distToGoal.resize(1, 9e9f);
-    }
+    requests.push_back({&crowdAgent.wayPoints(), crowdAgent.radius()});
+    agents.emplace_back(&crowdAgent);
+  }
 
-    // Compute the distance to each of the agent's goals (the first vertex)
-    // for all vertices using Dijkstra's algorithm.
-    const unsigned int i = 0;
-    {
-      std::multimap<float, unsigned int> Q;
-      std::vector<std::multimap<float, unsigned int>::iterator> posInQ(roadmap.size(), Q.end());
-
-      roadmap[i].distToGoal[i] = 0.0f;
-      posInQ[i]                = Q.insert(std::make_pair(0.0f, i));
-
-      while (!Q.empty()) {
-        const auto u = Q.begin()->second;
-        Q.erase(Q.begin());
-        posInQ[u] = Q.end();
-
-        for (size_t j = 0; j < roadmap[u].neighbors.size(); ++j) {
-          const auto v        = roadmap[u].neighbors[j];
-          const float dist_uv = RVO2::abs(roadmap[v].position - roadmap[u].position);
-
-          if (roadmap[v].distToGoal[i] > roadmap[u].distToGoal[i] + dist_uv) {
-            roadmap[v].distToGoal[i] = roadmap[u].distToGoal[i] + dist_uv;
-
-            if (posInQ[v] == Q.end()) {
-              posInQ[v] = Q.insert(std::make_pair(roadmap[v].distToGoal[i], v));
-            }
-            else {
-              Q.erase(posInQ[v]);
-              posInQ[v] = Q.insert(std::make_pair(roadmap[v].distToGoal[i], v));
-            }
-          }
-        }
-      }
-    }
+  std::vector<CrowdRoadmapPtr> roadmaps;
+  _roadmapCache.computeRoadmaps(requests, roadmaps);
+  for (size_t i = 0; i < agents.size(); ++i) {
+    agents[i]->setRoadmap(roadmaps[i]);
   }
 }
 
@@ -206,7 +172,7 @@ void CrowdSimulation::setPrecision(unsigned int precision)
   }
 
   for (auto& agent : _agents) {
-    auto crowdAgent = agent.getComponent<CrowdAgent>();
+    auto& crowdAgent = agent.getComponent<CrowdAgent>();
 
     crowdAgent.setAgentMaxNeighbors(neighborsMax);
     crowdAgent.setAgentNeighborDist(neighborDist);
@@ -228,10 +194,8 @@ bool CrowdSimulation::isRunning() const
 
 void CrowdSimulation::update()
 {
-  _world.refresh();
   // if (isRunning()) {
-  _crowdCollisionAvoidanceSystem.update();
-  _crowdMeshUpdaterSystem.update();
+  _systemScheduler.update();
   //}
 }
 
@@ -32,6 +32,7 @@
 
 #include <babylon/extensions/navigation/rvo2/agent.h>
 
+#include <babylon/extensions/navigation/rvo2/agent_grid.h>
 #include <babylon/extensions/navigation/rvo2/kd_tree.h>
 #include <babylon/extensions/navigation/rvo2/obstacle.h>
 
@@ -39,47 +40,74 @@ namespace BABYLON {
 namespace Extensions {
 namespace RVO2 {
 
-Agent::Agent(RVOSimulator* sim)
-    : maxNeighbors_(0)
-    , maxSpeed_(0.0f)
-    , neighborDist_(0.0f)
-    , radius_(0.0f)
-    , sim_(sim)
-    , timeHorizon_(0.0f)
-    , timeHorizonObst_(0.0f)
-    , id_(0)
+size_t Agents::add(const Vector2& position, float neighborDist, size_t maxNeighbors,
+                   float timeHorizon, float timeHorizonObst, float radius, float maxSpeed,
+                   const Vector2& velocity)
 {
+  maxNeighbors_.push_back(maxNeighbors);
+  maxSpeed_.push_back(maxSpeed);
+  neighborDist_.push_back(neighborDist);
+  newVelocity_.emplace_back();
+  position_.push_back(position);
+  prefVelocity_.emplace_back();
+  radius_.push_back(radius);
+  timeHorizon_.push_back(timeHorizon);
+  timeHorizonObst_.push_back(timeHorizonObst);
+  velocity_.push_back(velocity);
+
+  agentNeighbors_.emplace_back();
+  obstacleNeighbors_.emplace_back();
+  orcaLines_.emplace_back();
+
+  return position_.size() - 1;
 }
 
-void Agent::computeNeighbors()
+size_t Agents::size() const
 {
-  obstacleNeighbors_.clear();
-  float rangeSq = sqr(timeHorizonObst_ * maxSpeed_ + radius_);
-  sim_->kdTree_->computeObstacleNeighbors(this, rangeSq);
-
-  agentNeighbors_.clear();
+  return position_.size();
+}
 
-  if (maxNeighbors_ > 0) {
-    rangeSq = sqr(neighborDist_);
-    sim_->kdTree_->computeAgentNeighbors(this, rangeSq);
+void Agents::computeNeighbors(size_t agentNo, const KdTree& kdTree,
+                              const AgentGrid& agentGrid)
+{
+  auto& obstacleNeighbors = obstacleNeighbors_[agentNo];
+  obstacleNeighbors.clear();
+  float rangeSq = sqr(timeHorizonObst_[agentNo] * maxSpeed_[agentNo] + radius_[agentNo]);
+  kdTree.computeObstacleNeighbors(position_[agentNo], rangeSq, obstacleNeighbors);
+
+  auto& agentNeighbors = agentNeighbors_[agentNo];
+  agentNeighbors.clear();
+
+  if (maxNeighbors_[agentNo] > 0) {
+    rangeSq = sqr(neighborDist_[agentNo]);
+    agentGrid.computeAgentNeighbors(agentNo, position_[agentNo], rangeSq,
+                                    maxNeighbors_[agentNo], agentNeighbors);
   }
 }
 
 /* Search for the best new velocity. */
-void Agent::computeNewVelocity()
+void Agents::computeNewVelocity(size_t agentNo, float timeStep,
+                                std::vector<Line>& projLines)
 {
-  orcaLines_.clear();
+  const Vector2 position        = position_[agentNo];
+  const Vector2 velocity        = velocity_[agentNo];
+  const float radius            = radius_[agentNo];
+  const auto& agentNeighbors    = agentNeighbors_[agentNo];
+  const auto& obstacleNeighbors = obstacleNeighbors_[agentNo];
+  auto& orcaLines               = orcaLines_[agentNo];
+
+  orcaLines.clear();
 
-  const float invTimeHorizonObst = 1.0f / timeHorizonObst_;
+  const float invTimeHorizonObst = 1.0f / timeHorizonObst_[agentNo];
 
   /* Create obstacle ORCA lines. */
-  for (auto& obstacleNeighbor : obstacleNeighbors_) {
+  for (const auto& obstacleNeighbor : obstacleNeighbors) {
 
     const Obstacle* obstacle1 = obstacleNeighbor.second;
     const Obstacle* obstacle2 = obstacle1->nextObstacle_;
 
-    const Vector2 relativePosition1 = obstacle1->point_ - position_;
-    const Vector2 relativePosition2 = obstacle2->point_ - position_;
+    const Vector2 relativePosition1 = obstacle1->point_ - position;
+    const Vector2 relativePosition2 = obstacle2->point_ - position;
 
     /*
      * Check if velocity obstacle of obstacle is already taken care of by
@@ -87,12 +115,12 @@ void Agent::computeNewVelocity()
      */
     bool alreadyCovered = false;
 
-    for (auto& orcaLine : orcaLines_) {
+    for (const auto& orcaLine : orcaLines) {
       if (det(invTimeHorizonObst * relativePosition1 - orcaLine.point, orcaLine.direction)
-              - invTimeHorizonObst * radius_
+              - invTimeHorizonObst * radius
             >= -RVO_EPSILON
           && det(invTimeHorizonObst * relativePosition2 - orcaLine.point, orcaLine.direction)
-                 - invTimeHorizonObst * radius_
+                 - invTimeHorizonObst * radius
                >= -RVO_EPSILON) {
         alreadyCovered = true;
         break;
@@ -108,7 +136,7 @@ void Agent::computeNewVelocity()
     const float distSq1 = absSq(relativePosition1);
     const float distSq2 = absSq(relativePosition2);
 
-    const float radiusSq = sqr(radius_);
+    const float radiusSq = sqr(radius);
 
     const Vector2 obstacleVector = obstacle2->point_ - obstacle1->point_;
     const float s
@@ -123,7 +151,7 @@ void Agent::computeNewVelocity()
         line.point = Vector2(0.0f, 0.0f);
         line.direction
           = normalize(Vector2(-relativePosition1.y(), relativePosition1.x()));
-        orcaLines_.push_back(line);
+        orcaLines.push_back(line);
       }
 
       continue;
@@ -136,7 +164,7 @@ void Agent::computeNewVelocity()
         line.point = Vector2(0.0f, 0.0f);
         line.direction
           = normalize(Vector2(-relativePosition2.y(), relativePosition2.x()));
-        orcaLines_.push_back(line);
+        orcaLines.push_back(line);
       }
 
       continue;
@@ -145,7 +173,7 @@ void Agent::computeNewVelocity()
       /* Collision with obstacle segment. */
       line.point     = Vector2(0.0f, 0.0f);
       line.direction = -obstacle1->unitDir_;
-      orcaLines_.push_back(line);
+      orcaLines.push_back(line);
       continue;
     }
 
@@ -172,13 +200,13 @@ void Agent::computeNewVelocity()
       const float leg1 = std::sqrt(distSq1 - radiusSq);
       leftLegDirection
         = Vector2(
-            relativePosition1.x() * leg1 - relativePosition1.y() * radius_,
-            relativePosition1.x() * radius_ + relativePosition1.y() * leg1)
+            relativePosition1.x() * leg1 - relativePosition1.y() * radius,
+            relativePosition1.x() * radius + relativePosition1.y() * leg1)
           / distSq1;
       rightLegDirection
         = Vector2(
-            relativePosition1.x() * leg1 + relativePosition1.y() * radius_,
-            -relativePosition1.x() * radius_ + relativePosition1.y() * leg1)
+            relativePosition1.x() * leg1 + relativePosition1.y() * radius,
+            -relativePosition1.x() * radius + relativePosition1.y() * leg1)
           / distSq1;
     }
     else if (s > 1.0f && distSqLine <= radiusSq) {
@@ -196,13 +224,13 @@ void Agent::computeNewVelocity()
       const float leg2 = std::sqrt(distSq2 - radiusSq);
       leftLegDirection
         = Vector2(
-            relativePosition2.x() * leg2 - relativePosition2.y() * radius_,
-            relativePosition2.x() * radius_ + relativePosition2.y() * leg2)
+            relativePosition2.x() * leg2 - relativePosition2.y() * radius,
+            relativePosition2.x() * radius + relativePosition2.y() * leg2)
           / distSq2;
       rightLegDirection
         = Vector2(
-            relativePosition2.x() * leg2 + relativePosition2.y() * radius_,
-            -relativePosition2.x() * radius_ + relativePosition2.y() * leg2)
+            relativePosition2.x() * leg2 + relativePosition2.y() * radius,
+            -relativePosition2.x() * radius + relativePosition2.y() * leg2)
           / distSq2;
     }
     else {
@@ -211,8 +239,8 @@ void Agent::computeNewVelocity()
         const float leg1 = std::sqrt(distSq1 - radiusSq);
         leftLegDirection
           = Vector2(
-              relativePosition1.x() * leg1 - relativePosition1.y() * radius_,
-              relativePosition1.x() * radius_ + relativePosition1.y() * leg1)
+              relativePosition1.x() * leg1 - relativePosition1.y() * radius,
+              relativePosition1.x() * radius + relativePosition1.y() * leg1)
             / distSq1;
       }
       else {
@@ -224,8 +252,8 @@ void Agent::computeNewVelocity()
         const float leg2 = std::sqrt(distSq2 - radiusSq);
         rightLegDirection
           = Vector2(
-              relativePosition2.x() * leg2 + relativePosition2.y() * radius_,
-              -relativePosition2.x() * radius_ + relativePosition2.y() * leg2)
+              relativePosition2.x() * leg2 + relativePosition2.y() * radius,
+              -relativePosition2.x() * radius + relativePosition2.y() * leg2)
             / distSq2;
       }
       else {
@@ -261,9 +289,9 @@ void Agent::computeNewVelocity()
 
     /* Compute cut-off centers. */
     const Vector2 leftCutoff
-      = invTimeHorizonObst * (obstacle1->point_ - position_);
+      = invTimeHorizonObst * (obstacle1->point_ - position);
     const Vector2 rightCutoff
-      = invTimeHorizonObst * (obstacle2->point_ - position_);
+      = invTimeHorizonObst * (obstacle2->point_ - position);
     const Vector2 cutoffVec = rightCutoff - leftCutoff;
 
     /* Project current velocity on velocity obstacle. */
@@ -272,27 +300,27 @@ void Agent::computeNewVelocity()
     const float t
       = (obstacle1 == obstacle2 ?
            0.5f :
-           ((velocity_ - leftCutoff) * cutoffVec) / absSq(cutoffVec));
-    const float tLeft  = ((velocity_ - leftCutoff) * leftLegDirection);
-    const float tRight = ((velocity_ - rightCutoff) * rightLegDirection);
+           ((velocity - leftCutoff) * cutoffVec) / absSq(cutoffVec));
+    const float tLeft  = ((velocity - leftCutoff) * leftLegDirection);
+    const float tRight = ((velocity - rightCutoff) * rightLegDirection);
 
     if ((t < 0.0f && tLeft < 0.0f)
         || (obstacle1 == obstacle2 && tLeft < 0.0f && tRight < 0.0f)) {
       /* Project on left cut-off circle. */
-      const Vector2 unitW = normalize(velocity_ - leftCutoff);
+      const Vector2 unitW = normalize(velocity - leftCutoff);
 
       line.direction = Vector2(unitW.y(), -unitW.x());
-      line.point     = leftCutoff + radius_ * invTimeHorizonObst * unitW;
-      orcaLines_.push_back(line);
+      line.point     = leftCutoff + radius * invTimeHorizonObst * unitW;
+      orcaLines.push_back(line);
       continue;
     }
     else if (t > 1.0f && tRight < 0.0f) {
       /* Project on right cut-off circle. */
-      const Vector2 unitW = normalize(velocity_ - rightCutoff);
+      const Vector2 unitW = normalize(velocity - rightCutoff);
 
       line.direction = Vector2(unitW.y(), -unitW.x());
-      line.point     = rightCutoff + radius_ * invTimeHorizonObst * unitW;
-      orcaLines_.push_back(line);
+      line.point     = rightCutoff + radius * invTimeHorizonObst * unitW;
+      orcaLines.push_back(line);
       continue;
     }
 
@@ -303,23 +331,23 @@ void Agent::computeNewVelocity()
     const float distSqCutoff
       = ((t < 0.0f || t > 1.0f || obstacle1 == obstacle2) ?
            std::numeric_limits<float>::infinity() :
-           absSq(velocity_ - (leftCutoff + t * cutoffVec)));
+           absSq(velocity - (leftCutoff + t * cutoffVec)));
     const float distSqLeft
       = ((tLeft < 0.0f) ?
            std::numeric_limits<float>::infinity() :
-           absSq(velocity_ - (leftCutoff + tLeft * leftLegDirection)));
+           absSq(velocity - (leftCutoff + tLeft * leftLegDirection)));
     const float distSqRight
       = ((tRight < 0.0f) ?
            std::numeric_limits<float>::infinity() :
-           absSq(velocity_ - (rightCutoff + tRight * rightLegDirection)));
+           absSq(velocity - (rightCutoff + tRight * rightLegDirection)));
 
     if (distSqCutoff <= distSqLeft && distSqCutoff <= distSqRight) {
       /* Project on cut-off line. */
       line.direction = -obstacle1->unitDir_;
       line.point     = leftCutoff
-                   + radius_ * invTimeHorizonObst
+                   + radius * invTimeHorizonObst
                        * Vector2(-line.direction.y(), line.direction.x());
-      orcaLines_.push_back(line);
+      orcaLines.push_back(line);
       continue;
     }
     else if (distSqLeft <= distSqRight) {
@@ -330,9 +358,9 @@ void Agent::computeNewVelocity()
 
       line.direction = leftLegDirection;
       line.point     = leftCutoff
-                   + radius_ * invTimeHorizonObst
+                   + radius * invTimeHorizonObst
                        * Vector2(-line.direction.y(), line.direction.x());
-      orcaLines_.push_back(line);
+      orcaLines.push_back(line);
       continue;
     }
     else {
@@ -343,25 +371,25 @@ void Agent::computeNewVelocity()
 
       line.direction = -rightLegDirection;
       line.point     = rightCutoff
-                   + radius_ * invTimeHorizonObst
+                   + radius * invTimeHorizonObst
                        * Vector2(-line.direction.y(), line.direction.x());
-      orcaLines_.push_back(line);
+      orcaLines.push_back(line);
       continue;
     }
   }
 
-  const size_t numObstLines = orcaLines_.size();
+  const size_t numObstLines = orcaLines.size();
 
-  const float invTimeHorizon = 1.0f / timeHorizon_;
+  const float invTimeHorizon = 1.0f / timeHorizon_[agentNo];
 
   /* Create agent ORCA lines. */
-  for (auto& agentNeighbor : agentNeighbors_) {
-    const Agent* const other = agentNeighbor.second;
+  for (const auto& agentNeighbor : agentNeighbors) {
+    const size_t other = agentNeighbor.second;
 
-    const Vector2 relativePosition = other->position_ - position_;
-    const Vector2 relativeVelocity = velocity_ - other->velocity_;
+    const Vector2 relativePosition = position_[other] - position;
+    const Vector2 relativeVelocity = velocity - velocity_[other];
     const float distSq             = absSq(relativePosition);
-    const float combinedRadius     = radius_ + other->radius_;
+    const float combinedRadius     = radius + radius_[other];
     const float combinedRadiusSq   = sqr(combinedRadius);
 
     Line line;
@@ -412,7 +440,7 @@ void Agent::computeNewVelocity()
     }
     else {
       /* Collision. Project on cut-off circle of time timeStep. */
-      const float invTimeStep = 1.0f / sim_->timeStep_;
+      const float invTimeStep = 1.0f / timeStep;
 
       /* Vector from cutoff center to relative velocity. */
       const Vector2 w = relativeVelocity - invTimeStep * relativePosition;
@@ -424,69 +452,23 @@ void Agent::computeNewVelocity()
       u              = (combinedRadius * invTimeStep - wLength) * unitW;
     }
 
-    line.point = velocity_ + 0.5f * u;
-    orcaLines_.push_back(line);
-  }
-
-  size_t lineFail
-    = linearProgram2(orcaLines_, maxSpeed_, prefVelocity_, false, newVelocity_);
-
-  if (lineFail < orcaLines_.size()) {
-    linearProgram3(orcaLines_, numObstLines, lineFail, maxSpeed_, newVelocity_);
+    line.point = velocity + 0.5f * u;
+    orcaLines.push_back(line);
   }
-}
-
-void Agent::insertAgentNeighbor(const Agent* agent, float& rangeSq)
-{
-  if (this != agent) {
-    const float distSq = absSq(position_ - agent->position_);
 
-    if (distSq < rangeSq) {
-      if (agentNeighbors_.size() < maxNeighbors_) {
-        agentNeighbors_.push_back(std::make_pair(distSq, agent));
-      }
-
-      size_t i = agentNeighbors_.size() - 1;
-
-      while (i != 0 && distSq < agentNeighbors_[i - 1].first) {
-        agentNeighbors_[i] = agentNeighbors_[i - 1];
-        --i;
-      }
-
-      agentNeighbors_[i] = std::make_pair(distSq, agent);
-
-      if (agentNeighbors_.size() == maxNeighbors_) {
-        rangeSq = agentNeighbors_.back().first;
-      }
-    }
-  }
-}
-
-void Agent::insertObstacleNeighbor(const Obstacle* obstacle, float rangeSq)
-{
-  const Obstacle* const nextObstacle = obstacle->nextObstacle_;
-
-  const float distSq
-    = distSqPointLineSegment(obstacle->point_, nextObstacle->point_, position_);
-
-  if (distSq < rangeSq) {
-    obstacleNeighbors_.push_back(std::make_pair(distSq, obstacle));
-
-    size_t i = obstacleNeighbors_.size() - 1;
-
-    while (i != 0 && distSq < obstacleNeighbors_[i - 1].first) {
-      obstacleNeighbors_[i] = obstacleNeighbors_[i - 1];
-      --i;
-    }
+  size_t lineFail = linearProgram2(orcaLines, maxSpeed_[agentNo], prefVelocity_[agentNo], false,
+                                   newVelocity_[agentNo]);
 
-    obstacleNeighbors_[i] = std::make_pair(distSq, obstacle);
+  if (lineFail < orcaLines.size()) {
+    linearProgram3(orcaLines, numObstLines, lineFail, maxSpeed_[agentNo], newVelocity_[agentNo],
+                   projLines);
   }
 }
 
-void Agent::update()
+void Agents::update(size_t agentNo, float timeStep)
 {
-  velocity_ = newVelocity_;
-  position_ += velocity_ * sim_->timeStep_;
+  velocity_[agentNo] = newVelocity_[agentNo];
+  position_[agentNo] += velocity_[agentNo] * timeStep;
 }
 
 bool linearProgram1(const std::vector<Line>& lines, size_t lineNo, float radius,
@@ -604,15 +586,16 @@ size_t linearProgram2(const std::vector<Line>& lines, float radius,
 }
 
 void linearProgram3(const std::vector<Line>& lines, size_t numObstLines,
-                    size_t beginLine, float radius, Vector2& result)
+                    size_t beginLine, float radius, Vector2& result,
+                    std::vector<Line>& projLines)
 {
   float distance = 0.0f;
 
   for (size_t i = beginLine; i < lines.size(); ++i) {
     if (det(lines[i].direction, lines[i].point - result) > distance) {
       /* Result does not satisfy constraint of line i. */
-      std::vector<Line> projLines(
-        lines.begin(), lines.begin() + static_cast<ptrdiff_t>(numObstLines));
+      projLines.assign(lines.begin(),
+                       lines.begin() + static_cast<ptrdiff_t>(numObstLines));
 
       for (size_t j = numObstLines; j < i; ++j) {
         Line line;
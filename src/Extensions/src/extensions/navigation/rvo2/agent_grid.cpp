@@ -0,0 +1,184 @@
+#include <babylon/extensions/navigation/rvo2/agent_grid.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace RVO2 {
+
+AgentGrid::AgentGrid()
+    : columns_(0)
+    , rows_(0)
+    , cellSize_(1.0f)
+    , invCellSize_(1.0f)
+    , minX_(0.0f)
+    , minY_(0.0f)
+    , cellStart_(1, 0)
+{
+}
+
+void AgentGrid::build(const std::vector<Vector2>& positions)
+{
+  const size_t count = positions.size();
+
+  agentNos_.resize(count);
+  positions_.resize(count);
+  agentCells_.resize(count);
+
+  if (count == 0) {
+    columns_ = rows_ = 0;
+    cellStart_.assign(1, 0);
+    return;
+  }
+
+  /* Compute the bounds of the agents. */
+  float maxX = positions[0].x();
+  float maxY = positions[0].y();
+  minX_      = maxX;
+  minY_      = maxY;
+
+  for (size_t i = 1; i < count; ++i) {
+    minX_ = std::min(minX_, positions[i].x());
+    maxX  = std::max(maxX, positions[i].x());
+    minY_ = std::min(minY_, positions[i].y());
+    maxY  = std::max(maxY, positions[i].y());
+  }
+
+  /*
+   * About four agents per cell on average, and at most one cell per agent
+   * along each axis when the agents are aligned.
+   */
+  const float width  = maxX - minX_;
+  const float height = maxY - minY_;
+  const float n      = static_cast<float>(count);
+  cellSize_ = std::max(std::sqrt(4.0f * width * height / n), std::max(width, height) / n);
+
+  if (!(cellSize_ > 0.0f)) {
+    cellSize_ = 1.0f;
+  }
+
+  invCellSize_ = 1.0f / cellSize_;
+  columns_     = static_cast<size_t>(width * invCellSize_) + 1;
+  rows_        = static_cast<size_t>(height * invCellSize_) + 1;
+
+  /* Counting sort of the agents by cell, keeping the agent order per cell. */
+  cellStart_.assign(columns_ * rows_ + 1, 0);
+
+  for (size_t i = 0; i < count; ++i) {
+    const size_t cell = cellCoordinate(positions[i].y(), minY_, rows_) * columns_
+                        + cellCoordinate(positions[i].x(), minX_, columns_);
+    agentCells_[i]    = cell;
+    ++cellStart_[cell + 1];
+  }
+
+  for (size_t cell = 1; cell < cellStart_.size(); ++cell) {
+    cellStart_[cell] += cellStart_[cell - 1];
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    const size_t index = cellStart_[agentCells_[i]]++;
+    agentNos_[index]   = i;
+    positions_[index]  = positions[i];
+  }
+
+  /* The starts have moved to the next cell, shift them back. */
+  for (size_t cell = cellStart_.size() - 1; cell > 0; --cell) {
+    cellStart_[cell] = cellStart_[cell - 1];
+  }
+
+  cellStart_[0] = 0;
+}
+
+void AgentGrid::computeAgentNeighbors(size_t agentNo, const Vector2& position, float rangeSq,
+                                      size_t maxNeighbors,
+                                      std::vector<std::pair<float, size_t>>& neighbors) const
+{
+  if (agentNos_.empty()) {
+    return;
+  }
+
+  const auto column = static_cast<ptrdiff_t>(cellCoordinate(position.x(), minX_, columns_));
+  const auto row    = static_cast<ptrdiff_t>(cellCoordinate(position.y(), minY_, rows_));
+
+  /* Distance from the agent to the nearest border of its cell. */
+  const float cellMinX = minX_ + static_cast<float>(column) * cellSize_;
+  const float cellMinY = minY_ + static_cast<float>(row) * cellSize_;
+  const float toBorder
+    = std::max(0.0f, std::min(std::min(position.x() - cellMinX, cellMinX + cellSize_ - position.x()),
+                              std::min(position.y() - cellMinY, cellMinY + cellSize_ - position.y())));
+
+  /* Visit the rings of cells around the cell of the agent. */
+  const auto maxRing = static_cast<ptrdiff_t>(std::max(columns_, rows_));
+
+  for (ptrdiff_t ring = 0; ring < maxRing; ++ring) {
+    if (ring > 0 && sqr(toBorder + static_cast<float>(ring - 1) * cellSize_) >= rangeSq) {
+      break;
+    }
+
+    for (ptrdiff_t y = row - ring; y <= row + ring; ++y) {
+      if (y < 0 || y >= static_cast<ptrdiff_t>(rows_)) {
+        continue;
+      }
+
+      /* Inside rows of the ring only have their first and last cells. */
+      const bool isBorderRow = (y == row - ring || y == row + ring);
+      const ptrdiff_t step   = (isBorderRow || ring == 0 ? 1 : 2 * ring);
+
+      for (ptrdiff_t x = column - ring; x <= column + ring; x += step) {
+        if (x < 0 || x >= static_cast<ptrdiff_t>(columns_)) {
+          continue;
+        }
+
+        const float x0 = minX_ + static_cast<float>(x) * cellSize_;
+        const float y0 = minY_ + static_cast<float>(y) * cellSize_;
+        const float distSqCell
+          = sqr(std::max(0.0f, std::max(x0 - position.x(), position.x() - x0 - cellSize_)))
+            + sqr(std::max(0.0f, std::max(y0 - position.y(), position.y() - y0 - cellSize_)));
+
+        if (distSqCell >= rangeSq) {
+          continue;
+        }
+
+        const size_t cell = static_cast<size_t>(y) * columns_ + static_cast<size_t>(x);
+
+        for (size_t k = cellStart_[cell]; k < cellStart_[cell + 1]; ++k) {
+          const float distSq = absSq(position - positions_[k]);
+
+          if (distSq >= rangeSq || agentNos_[k] == agentNo) {
+            continue;
+          }
+
+          if (neighbors.size() < maxNeighbors) {
+            neighbors.emplace_back(distSq, agentNos_[k]);
+          }
+
+          size_t i = neighbors.size() - 1;
+
+          while (i != 0 && distSq < neighbors[i - 1].first) {
+            neighbors[i] = neighbors[i - 1];
+            --i;
+          }
+
+          neighbors[i] = std::make_pair(distSq, agentNos_[k]);
+
+          if (neighbors.size() == maxNeighbors) {
+            rangeSq = neighbors.back().first;
+          }
+        }
+      }
+    }
+  }
+}
+
+size_t AgentGrid::cellCoordinate(float value, float min, size_t count) const
+{
+  const float coordinate = (value - min) * invCellSize_;
+
+  if (!(coordinate > 0.0f)) {
+    return 0;
+  }
+
+  return std::min(static_cast<size_t>(coordinate), count - 1);
+}
+
+} // end of namespace RVO2
+} // end of namespace Extensions
+} // end of namespace BABYLON
@@ -32,7 +32,6 @@
 
 #include <babylon/extensions/navigation/rvo2/kd_tree.h>
 
-#include <babylon/extensions/navigation/rvo2/agent.h>
 #include <babylon/extensions/navigation/rvo2/obstacle.h>
 #include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
 
@@ -49,85 +48,6 @@ KdTree::~KdTree()
   deleteObstacleTree(obstacleTree_);
 }
 
-void KdTree::buildAgentTree()
-{
-  if (agents_.size() < sim_->agents_.size()) {
-    for (size_t i = agents_.size(); i < sim_->agents_.size(); ++i) {
-      agents_.push_back(sim_->agents_[i]);
-    }
-
-    agentTree_.resize(2 * agents_.size() - 1);
-  }
-
-  if (!agents_.empty()) {
-    buildAgentTreeRecursive(0, agents_.size(), 0);
-  }
-}
-
-void KdTree::buildAgentTreeRecursive(size_t begin, size_t end, size_t node)
-{
-  agentTree_[node].begin = begin;
-  agentTree_[node].end   = end;
-  agentTree_[node].minX = agentTree_[node].maxX = agents_[begin]->position_.x();
-  agentTree_[node].minY = agentTree_[node].maxY = agents_[begin]->position_.y();
-
-  for (size_t i = begin + 1; i < end; ++i) {
-    agentTree_[node].maxX
-      = std::max(agentTree_[node].maxX, agents_[i]->position_.x());
-    agentTree_[node].minX
-      = std::min(agentTree_[node].minX, agents_[i]->position_.x());
-    agentTree_[node].maxY
-      = std::max(agentTree_[node].maxY, agents_[i]->position_.y());
-    agentTree_[node].minY
-      = std::min(agentTree_[node].minY, agents_[i]->position_.y());
-  }
-
-  if (end - begin > MAX_LEAF_SIZE) {
-    /* No leaf node. */
-    const bool isVertical = (agentTree_[node].maxX - agentTree_[node].minX
-                             > agentTree_[node].maxY - agentTree_[node].minY);
-    const float splitValue
-      = (isVertical ? 0.5f * (agentTree_[node].maxX + agentTree_[node].minX) :
-                      0.5f * (agentTree_[node].maxY + agentTree_[node].minY));
-
-    size_t left  = begin;
-    size_t right = end;
-
-    while (left < right) {
-      while (left < right
-             && (isVertical ? agents_[left]->position_.x() :
-                              agents_[left]->position_.y())
-                  < splitValue) {
-        ++left;
-      }
-
-      while (right > left
-             && (isVertical ? agents_[right - 1]->position_.x() :
-                              agents_[right - 1]->position_.y())
-                  >= splitValue) {
-        --right;
-      }
-
-      if (left < right) {
-        std::swap(agents_[left], agents_[right - 1]);
-        ++left;
-        --right;
-      }
-    }
-
-    if (left == begin) {
-      ++left;
-      ++right;
-    }
-
-    agentTree_[node].left  = node + 1;
-    agentTree_[node].right = node + 2 * (left - begin);
-
-    buildAgentTreeRecursive(begin, left, agentTree_[node].left);
-    buildAgentTreeRecursive(left, end, agentTree_[node].right);
-  }
-}
-
 void KdTree::buildObstacleTree()
 {
   deleteObstacleTree(obstacleTree_);
@@ -276,14 +196,11 @@ KdTree::buildObstacleTreeRecursive(const std::vector<Obstacle*>& obstacles)
   }
 }
 
-void KdTree::computeAgentNeighbors(Agent* agent, float& rangeSq) const
-{
-  queryAgentTreeRecursive(agent, rangeSq, 0);
-}
-
-void KdTree::computeObstacleNeighbors(Agent* agent, float rangeSq) const
+void KdTree::computeObstacleNeighbors(
+  const Vector2& position, float rangeSq,
+  std::vector<std::pair<float, const Obstacle*>>& neighbors) const
 {
-  queryObstacleTreeRecursive(agent, rangeSq, obstacleTree_);
+  queryObstacleTreeRecursive(position, rangeSq, obstacleTree_, neighbors);
 }
 
 void KdTree::deleteObstacleTree(ObstacleTreeNode* node)
@@ -295,64 +212,32 @@ void KdTree::deleteObstacleTree(ObstacleTreeNode* node)
   }
 }
 
-void KdTree::queryAgentTreeRecursive(Agent* agent, float& rangeSq,
-                                     size_t node) const
+void KdTree::insertObstacleNeighbor(
+  const Vector2& position, const Obstacle* obstacle, float rangeSq,
+  std::vector<std::pair<float, const Obstacle*>>& neighbors)
 {
-  if (agentTree_[node].end - agentTree_[node].begin <= MAX_LEAF_SIZE) {
-    for (size_t i = agentTree_[node].begin; i < agentTree_[node].end; ++i) {
-      agent->insertAgentNeighbor(agents_[i], rangeSq);
-    }
-  }
-  else {
-    const float distSqLeft
-      = sqr(std::max(
-          0.0f, agentTree_[agentTree_[node].left].minX - agent->position_.x()))
-        + sqr(std::max(0.0f,
-                       agent->position_.x()
-                         - agentTree_[agentTree_[node].left].maxX))
-        + sqr(std::max(0.0f,
-                       agentTree_[agentTree_[node].left].minY
-                         - agent->position_.y()))
-        + sqr(std::max(0.0f,
-                       agent->position_.y()
-                         - agentTree_[agentTree_[node].left].maxY));
-
-    const float distSqRight
-      = sqr(std::max(
-          0.0f, agentTree_[agentTree_[node].right].minX - agent->position_.x()))
-        + sqr(std::max(0.0f,
-                       agent->position_.x()
-                         - agentTree_[agentTree_[node].right].maxX))
-        + sqr(std::max(0.0f,
-                       agentTree_[agentTree_[node].right].minY
-                         - agent->position_.y()))
-        + sqr(std::max(0.0f,
-                       agent->position_.y()
-                         - agentTree_[agentTree_[node].right].maxY));
-
-    if (distSqLeft < distSqRight) {
-      if (distSqLeft < rangeSq) {
-        queryAgentTreeRecursive(agent, rangeSq, agentTree_[node].left);
-
-        if (distSqRight < rangeSq) {
-          queryAgentTreeRecursive(agent, rangeSq, agentTree_[node].right);
-        }
-      }
-    }
-    else {
-      if (distSqRight < rangeSq) {
-        queryAgentTreeRecursive(agent, rangeSq, agentTree_[node].right);
+  const Obstacle* const nextObstacle = obstacle->nextObstacle_;
 
-        if (distSqLeft < rangeSq) {
-          queryAgentTreeRecursive(agent, rangeSq, agentTree_[node].left);
-        }
-      }
+  const float distSq
+    = distSqPointLineSegment(obstacle->point_, nextObstacle->point_, position);
+
+  if (distSq < rangeSq) {
+    neighbors.push_back(std::make_pair(distSq, obstacle));
+
+    size_t i = neighbors.size() - 1;
+
+    while (i != 0 && distSq < neighbors[i - 1].first) {
+      neighbors[i] = neighbors[i - 1];
+      --i;
     }
+
+    neighbors[i] = std::make_pair(distSq, obstacle);
   }
 }
 
-void KdTree::queryObstacleTreeRecursive(Agent* agent, float rangeSq,
-                                        const ObstacleTreeNode* node) const
+void KdTree::queryObstacleTreeRecursive(
+  const Vector2& position, float rangeSq, const ObstacleTreeNode* node,
+  std::vector<std::pair<float, const Obstacle*>>& neighbors) const
 {
   if (node == nullptr) {
     return;
@@ -362,10 +247,11 @@ void KdTree::queryObstacleTreeRecursive(Agent* agent, float rangeSq,
     const Obstacle* const obstacle2 = obstacle1->nextObstacle_;
 
     const float agentLeftOfLine
-      = leftOf(obstacle1->point_, obstacle2->point_, agent->position_);
+      = leftOf(obstacle1->point_, obstacle2->point_, position);
 
     queryObstacleTreeRecursive(
-      agent, rangeSq, (agentLeftOfLine >= 0.0f ? node->left : node->right));
+      position, rangeSq, (agentLeftOfLine >= 0.0f ? node->left : node->right),
+      neighbors);
 
     const float distSqLine
       = sqr(agentLeftOfLine) / absSq(obstacle2->point_ - obstacle1->point_);
@@ -376,12 +262,13 @@ void KdTree::queryObstacleTreeRecursive(Agent* agent, float rangeSq,
          * Try obstacle at this node only if agent is on right side of
          * obstacle (and can see obstacle).
          */
-        agent->insertObstacleNeighbor(node->obstacle, rangeSq);
+        insertObstacleNeighbor(position, node->obstacle, rangeSq, neighbors);
       }
 
       /* Try other side of line. */
       queryObstacleTreeRecursive(
-        agent, rangeSq, (agentLeftOfLine >= 0.0f ? node->right : node->left));
+        position, rangeSq, (agentLeftOfLine >= 0.0f ? node->right : node->left),
+        neighbors);
     }
   }
 }
@@ -32,38 +32,58 @@
 
 #include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
 
+#include <babylon/core/thread_pool.h>
 #include <babylon/extensions/navigation/rvo2/agent.h>
+#include <babylon/extensions/navigation/rvo2/agent_grid.h>
 #include <babylon/extensions/navigation/rvo2/kd_tree.h>
 #include <babylon/extensions/navigation/rvo2/obstacle.h>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 namespace BABYLON {
 namespace Extensions {
 namespace RVO2 {
 
-RVOSimulator::RVOSimulator() : defaultAgent_(nullptr), kdTree_(nullptr)
+namespace {
+
+/* Number of agents per chunk of work. */
+constexpr size_t AGENT_GRAIN_SIZE = 64;
+
+} // end of anonymous namespace
+
+RVOSimulator::RVOSimulator()
+    : agentGrid_(nullptr)
+    , agents_(nullptr)
+    , defaultAgent_(nullptr)
+    , kdTree_(nullptr)
+    , threadPool_(nullptr)
 {
-  kdTree_ = new KdTree(this);
+  agentGrid_ = new AgentGrid();
+  agents_    = new Agents();
+  kdTree_    = new KdTree(this);
 }
 
 RVOSimulator::RVOSimulator(float timeStep, float neighborDist, size_t maxNeighbors,
                            float timeHorizon, float timeHorizonObst, float radius, float maxSpeed,
                            const Vector2& velocity)
-    : defaultAgent_(nullptr), globalTime_(0.0f), kdTree_(nullptr), timeStep_(timeStep)
-{
+    : agentGrid_(nullptr)
+    , agents_(nullptr)
+    , defaultAgent_(nullptr)
+    , globalTime_(0.0f)
+    , kdTree_(nullptr)
+    , threadPool_(nullptr)
+    , timeStep_(timeStep)
+{
+  agentGrid_    = new AgentGrid();
+  agents_       = new Agents();
   kdTree_       = new KdTree(this);
-  defaultAgent_ = new Agent(this);
+  defaultAgent_ = new AgentDefaults();
 
-  defaultAgent_->maxNeighbors_    = maxNeighbors;
-  defaultAgent_->maxSpeed_        = maxSpeed;
-  defaultAgent_->neighborDist_    = neighborDist;
-  defaultAgent_->radius_          = radius;
-  defaultAgent_->timeHorizon_     = timeHorizon;
-  defaultAgent_->timeHorizonObst_ = timeHorizonObst;
-  defaultAgent_->velocity_        = velocity;
+  defaultAgent_->maxNeighbors    = maxNeighbors;
+  defaultAgent_->maxSpeed        = maxSpeed;
+  defaultAgent_->neighborDist    = neighborDist;
+  defaultAgent_->radius          = radius;
+  defaultAgent_->timeHorizon     = timeHorizon;
+  defaultAgent_->timeHorizonObst = timeHorizonObst;
+  defaultAgent_->velocity        = velocity;
 }
 
 RVOSimulator::~RVOSimulator()
@@ -72,14 +92,12 @@ RVOSimulator::~RVOSimulator()
     delete defaultAgent_;
   }
 
-  for (auto& agent : agents_) {
-    delete agent;
-  }
-
   for (auto& obstacle : obstacles_) {
     delete obstacle;
   }
 
+  delete agentGrid_;
+  delete agents_;
   delete kdTree_;
 }
 
@@ -89,22 +107,9 @@ size_t RVOSimulator::addAgent(const Vector2& position)
     return RVO_ERROR;
   }
 
-  auto* agent = new Agent(this);
-
-  agent->position_        = position;
-  agent->maxNeighbors_    = defaultAgent_->maxNeighbors_;
-  agent->maxSpeed_        = defaultAgent_->maxSpeed_;
-  agent->neighborDist_    = defaultAgent_->neighborDist_;
-  agent->radius_          = defaultAgent_->radius_;
-  agent->timeHorizon_     = defaultAgent_->timeHorizon_;
-  agent->timeHorizonObst_ = defaultAgent_->timeHorizonObst_;
-  agent->velocity_        = defaultAgent_->velocity_;
-
-  agent->id_ = agents_.size();
-
-  agents_.push_back(agent);
-
-  return agents_.size() - 1;
+  return agents_->add(position, defaultAgent_->neighborDist, defaultAgent_->maxNeighbors,
+                      defaultAgent_->timeHorizon, defaultAgent_->timeHorizonObst,
+                      defaultAgent_->radius, defaultAgent_->maxSpeed, defaultAgent_->velocity);
 }
 
 size_t RVOSimulator::addAgent(const Vector2& position, float neighborDist,
@@ -112,22 +117,8 @@ size_t RVOSimulator::addAgent(const Vector2& position, float neighborDist,
                               float timeHorizonObst, float radius,
                               float maxSpeed, const Vector2& velocity)
 {
-  auto* agent = new Agent(this);
-
-  agent->position_        = position;
-  agent->maxNeighbors_    = maxNeighbors;
-  agent->maxSpeed_        = maxSpeed;
-  agent->neighborDist_    = neighborDist;
-  agent->radius_          = radius;
-  agent->timeHorizon_     = timeHorizon;
-  agent->timeHorizonObst_ = timeHorizonObst;
-  agent->velocity_        = velocity;
-
-  agent->id_ = agents_.size();
-
-  agents_.push_back(agent);
-
-  return agents_.size() - 1;
+  return agents_->add(position, neighborDist, maxNeighbors, timeHorizon, timeHorizonObst, radius,
+                      maxSpeed, velocity);
 }
 
 size_t RVOSimulator::addObstacle(const std::vector<Vector2>& vertices)
@@ -175,101 +166,111 @@ size_t RVOSimulator::addObstacle(const std::vector<Vector2>& vertices)
 
 void RVOSimulator::doStep()
 {
-  kdTree_->buildAgentTree();
+  auto& threadPool       = (threadPool_ != nullptr ? *threadPool_ : ThreadPool::Default());
+  const size_t numAgents = agents_->size();
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-  for (auto& agent : agents_) {
-    agent->computeNeighbors();
-    agent->computeNewVelocity();
-  }
+  agentGrid_->build(agents_->position_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-  for (auto& agent : agents_) {
-    agent->update();
+  if (projLines_.size() < threadPool.workerCount()) {
+    projLines_.resize(threadPool.workerCount());
   }
 
+  /* Each agent only writes its own neighbors, lines and new velocity. */
+  threadPool.parallelFor(
+    numAgents, AGENT_GRAIN_SIZE, [this](size_t begin, size_t end, size_t workerIndex) {
+      auto& projLines = projLines_[workerIndex];
+
+      for (size_t i = begin; i < end; ++i) {
+        agents_->computeNeighbors(i, *kdTree_, *agentGrid_);
+        agents_->computeNewVelocity(i, timeStep_, projLines);
+      }
+    });
+
+  threadPool.parallelFor(
+    numAgents, AGENT_GRAIN_SIZE, [this](size_t begin, size_t end, size_t /*workerIndex*/) {
+      for (size_t i = begin; i < end; ++i) {
+        agents_->update(i, timeStep_);
+      }
+    });
+
   globalTime_ += timeStep_;
 }
 
 size_t RVOSimulator::getAgentAgentNeighbor(size_t agentNo,
                                            size_t neighborNo) const
 {
-  return agents_[agentNo]->agentNeighbors_[neighborNo].second->id_;
+  return agents_->agentNeighbors_[agentNo][neighborNo].second;
 }
 
 size_t RVOSimulator::getAgentMaxNeighbors(size_t agentNo) const
 {
-  return agents_[agentNo]->maxNeighbors_;
+  return agents_->maxNeighbors_[agentNo];
 }
 
 float RVOSimulator::getAgentMaxSpeed(size_t agentNo) const
 {
-  return agents_[agentNo]->maxSpeed_;
+  return agents_->maxSpeed_[agentNo];
 }
 
 float RVOSimulator::getAgentNeighborDist(size_t agentNo) const
 {
-  return agents_[agentNo]->neighborDist_;
+  return agents_->neighborDist_[agentNo];
 }
 
 size_t RVOSimulator::getAgentNumAgentNeighbors(size_t agentNo) const
 {
-  return agents_[agentNo]->agentNeighbors_.size();
+  return agents_->agentNeighbors_[agentNo].size();
 }
 
 size_t RVOSimulator::getAgentNumObstacleNeighbors(size_t agentNo) const
 {
-  return agents_[agentNo]->obstacleNeighbors_.size();
+  return agents_->obstacleNeighbors_[agentNo].size();
 }
 
 size_t RVOSimulator::getAgentNumORCALines(size_t agentNo) const
 {
-  return agents_[agentNo]->orcaLines_.size();
+  return agents_->orcaLines_[agentNo].size();
 }
 
 size_t RVOSimulator::getAgentObstacleNeighbor(size_t agentNo,
                                               size_t neighborNo) const
 {
-  return agents_[agentNo]->obstacleNeighbors_[neighborNo].second->id_;
+  return agents_->obstacleNeighbors_[agentNo][neighborNo].second->id_;
 }
 
 const Line& RVOSimulator::getAgentORCALine(size_t agentNo, size_t lineNo) const
 {
-  return agents_[agentNo]->orcaLines_[lineNo];
+  return agents_->orcaLines_[agentNo][lineNo];
 }
 
 const Vector2& RVOSimulator::getAgentPosition(size_t agentNo) const
 {
-  return agents_[agentNo]->position_;
+  return agents_->position_[agentNo];
 }
 
 const Vector2& RVOSimulator::getAgentPrefVelocity(size_t agentNo) const
 {
-  return agents_[agentNo]->prefVelocity_;
+  return agents_->prefVelocity_[agentNo];
 }
 
 float RVOSimulator::getAgentRadius(size_t agentNo) const
 {
-  return agents_[agentNo]->radius_;
+  return agents_->radius_[agentNo];
 }
 
 float RVOSimulator::getAgentTimeHorizon(size_t agentNo) const
 {
-  return agents_[agentNo]->timeHorizon_;
+  return agents_->timeHorizon_[agentNo];
 }
 
 float RVOSimulator::getAgentTimeHorizonObst(size_t agentNo) const
 {
-  return agents_[agentNo]->timeHorizonObst_;
+  return agents_->timeHorizonObst_[agentNo];
 }
 
 const Vector2& RVOSimulator::getAgentVelocity(size_t agentNo) const
 {
-  return agents_[agentNo]->velocity_;
+  return agents_->velocity_[agentNo];
 }
 
 float RVOSimulator::getGlobalTime() const
@@ -279,7 +280,7 @@ float RVOSimulator::getGlobalTime() const
 
 size_t RVOSimulator::getNumAgents() const
 {
-  return agents_.size();
+  return agents_->size();
 }
 
 size_t RVOSimulator::getNumObstacleVertices() const
@@ -324,63 +325,68 @@ void RVOSimulator::setAgentDefaults(float neighborDist, size_t maxNeighbors,
                                     const Vector2& velocity)
 {
   if (defaultAgent_ == nullptr) {
-    defaultAgent_ = new Agent(this);
+    defaultAgent_ = new AgentDefaults();
   }
 
-  defaultAgent_->maxNeighbors_    = maxNeighbors;
-  defaultAgent_->maxSpeed_        = maxSpeed;
-  defaultAgent_->neighborDist_    = neighborDist;
-  defaultAgent_->radius_          = radius;
-  defaultAgent_->timeHorizon_     = timeHorizon;
-  defaultAgent_->timeHorizonObst_ = timeHorizonObst;
-  defaultAgent_->velocity_        = velocity;
+  defaultAgent_->maxNeighbors    = maxNeighbors;
+  defaultAgent_->maxSpeed        = maxSpeed;
+  defaultAgent_->neighborDist    = neighborDist;
+  defaultAgent_->radius          = radius;
+  defaultAgent_->timeHorizon     = timeHorizon;
+  defaultAgent_->timeHorizonObst = timeHorizonObst;
+  defaultAgent_->velocity        = velocity;
 }
 
 void RVOSimulator::setAgentMaxNeighbors(size_t agentNo, size_t maxNeighbors)
 {
-  agents_[agentNo]->maxNeighbors_ = maxNeighbors;
+  agents_->maxNeighbors_[agentNo] = maxNeighbors;
 }
 
 void RVOSimulator::setAgentMaxSpeed(size_t agentNo, float maxSpeed)
 {
-  agents_[agentNo]->maxSpeed_ = maxSpeed;
+  agents_->maxSpeed_[agentNo] = maxSpeed;
 }
 
 void RVOSimulator::setAgentNeighborDist(size_t agentNo, float neighborDist)
 {
-  agents_[agentNo]->neighborDist_ = neighborDist;
+  agents_->neighborDist_[agentNo] = neighborDist;
 }
 
 void RVOSimulator::setAgentPosition(size_t agentNo, const Vector2& position)
 {
-  agents_[agentNo]->position_ = position;
+  agents_->position_[agentNo] = position;
 }
 
 void RVOSimulator::setAgentPrefVelocity(size_t agentNo,
                                         const Vector2& prefVelocity)
 {
-  agents_[agentNo]->prefVelocity_ = prefVelocity;
+  agents_->prefVelocity_[agentNo] = prefVelocity;
 }
 
 void RVOSimulator::setAgentRadius(size_t agentNo, float radius)
 {
-  agents_[agentNo]->radius_ = radius;
+  agents_->radius_[agentNo] = radius;
 }
 
 void RVOSimulator::setAgentTimeHorizon(size_t agentNo, float timeHorizon)
 {
-  agents_[agentNo]->timeHorizon_ = timeHorizon;
+  agents_->timeHorizon_[agentNo] = timeHorizon;
 }
 
 void RVOSimulator::setAgentTimeHorizonObst(size_t agentNo,
                                            float timeHorizonObst)
 {
-  agents_[agentNo]->timeHorizonObst_ = timeHorizonObst;
+  agents_->timeHorizonObst_[agentNo] = timeHorizonObst;
 }
 
 void RVOSimulator::setAgentVelocity(size_t agentNo, const Vector2& velocity)
 {
-  agents_[agentNo]->velocity_ = velocity;
+  agents_->velocity_[agentNo] = velocity;
+}
+
+void RVOSimulator::setThreadPool(ThreadPool* threadPool)
+{
+  threadPool_ = threadPool;
 }
 
 void RVOSimulator::setTimeStep(float timeStep)
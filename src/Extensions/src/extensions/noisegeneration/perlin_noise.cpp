@@ -4,11 +4,73 @@
 #include <numeric>
 #include <random>
 
+#include <babylon/core/thread_pool.h>
+
 namespace BABYLON {
 namespace Extensions {
 
+namespace {
+
+// Points per kernel call of noiseGrid(), their coordinates stay in the L1 cache
+constexpr size_t GridBlockSize = 256;
+
+// Rows of the grids per thread pool task
+constexpr size_t GridPointsPerTask = 16384;
+
+// grad() without branches, so that the batch loop is vectorized
+inline double gradLane(int hash, double x, double y, double z)
+{
+  const int h    = hash & 15;
+  const double u = h < 8 ? x : y;
+  const double v = h < 4 ? y : ((h == 12) | (h == 14)) ? x : z;
+  return ((h & 1) == 0 ? u : -u) + ((h & 2) == 0 ? v : -v);
+}
+
+// The floor of a lane, std::floor() prevents the vectorization of the batch loop
+inline int floorLane(double x)
+{
+  const int i = static_cast<int>(x);
+  return i - (x < static_cast<double>(i) ? 1 : 0);
+}
+
+void perlinNoise(const int* __restrict p, const double* __restrict xs,
+                 const double* __restrict ys, const double* __restrict zs, size_t count,
+                 double* __restrict result)
+{
+  for (size_t n = 0; n < count; ++n) {
+    const int floorX = floorLane(xs[n]);
+    const int floorY = floorLane(ys[n]);
+    const int floorZ = floorLane(zs[n]);
+    const int X      = floorX & 255;
+    const int Y      = floorY & 255;
+    const int Z      = floorZ & 255;
+    const double x   = xs[n] - floorX;
+    const double y   = ys[n] - floorY;
+    const double z   = zs[n] - floorZ;
+    const double u   = fade(x);
+    const double v   = fade(y);
+    const double w   = fade(z);
+    const int A      = p[X] + Y;
+    const int AA     = p[A] + Z;
+    const int AB     = p[A + 1] + Z;
+    const int B      = p[X + 1] + Y;
+    const int BA     = p[B] + Z;
+    const int BB     = p[B + 1] + Z;
+    const double a
+      = lerp(v, lerp(u, gradLane(p[AA], x, y, z), gradLane(p[BA], x - 1, y, z)),
+             lerp(u, gradLane(p[AB], x, y - 1, z), gradLane(p[BB], x - 1, y - 1, z)));
+    const double b
+      = lerp(v, lerp(u, gradLane(p[AA + 1], x, y, z - 1), gradLane(p[BA + 1], x - 1, y, z - 1)),
+             lerp(u, gradLane(p[AB + 1], x, y - 1, z - 1),
+                  gradLane(p[BB + 1], x - 1, y - 1, z - 1)));
+    result[n] = lerp(w, a, b);
+  }
+}
+
+} // end of anonymous namespace
+
 // Initialize with the reference values for the permutation vector
-PerlinNoise::PerlinNoise()
+PerlinNoise::PerlinNoise() : _threadPool{nullptr}
 {
   // Initialize the permutation vector with the reference values
   p = {{151, 160, 137, 91,  90,  15,  131, 13,  201, 95,  96,  53,  194, 233, 7,   225, 140, 36,
@@ -28,7 +90,7 @@ PerlinNoise::PerlinNoise()
         215, 61,  156, 180}};
 }
 
-PerlinNoise::PerlinNoise(uint32_t seed)
+PerlinNoise::PerlinNoise(uint32_t seed) : _threadPool{nullptr}
 {
   if (!seed) {
     seed = static_cast<uint32_t>(time(nullptr));
@@ -103,6 +165,45 @@ double PerlinNoise::noise(double x, double y, double z) const
   return lerp(w, a, b);
 }
 
+void PerlinNoise::noise(const double* x, const double* y, const double* z, size_t count,
+                        double* result) const
+{
+  perlinNoise(p.data(), x, y, z, count, result);
+}
+
+void PerlinNoise::noiseGrid(double x, double y, double z, double step, size_t columns,
+                            size_t rows, Float64Array& result) const
+{
+  result.resize(columns * rows);
+  if (columns == 0) {
+    return;
+  }
+  auto& threadPool = (_threadPool != nullptr ? *_threadPool : ThreadPool::Default());
+  threadPool.parallelFor(
+    rows, std::max<size_t>(1, GridPointsPerTask / columns),
+    [&](size_t begin, size_t end, size_t /*workerIndex*/) {
+      std::array<double, GridBlockSize> xs, ys, zs;
+      for (size_t row = begin; row < end; ++row) {
+        const auto rowY = y + step * static_cast<double>(row);
+        for (size_t column = 0; column < columns; column += GridBlockSize) {
+          const auto count = std::min(GridBlockSize, columns - column);
+          for (size_t i = 0; i < count; ++i) {
+            xs[i] = x + step * static_cast<double>(column + i);
+            ys[i] = rowY;
+            zs[i] = z;
+          }
+          perlinNoise(p.data(), xs.data(), ys.data(), zs.data(), count,
+                      result.data() + row * columns + column);
+        }
+      }
+    });
+}
+
+void PerlinNoise::setThreadPool(ThreadPool* threadPool)
+{
+  _threadPool = threadPool;
+}
+
 PerlinNoiseOctave::PerlinNoiseOctave(int octaves, uint32_t seed)
     : _perlinNoise{seed}, _octaves{octaves}
 {
@@ -1,7 +1,9 @@
 #include <babylon/extensions/noisegeneration/simplex_noise.h>
 
+#include <algorithm>
 #include <random>
 
+#include <babylon/core/thread_pool.h>
 #include <babylon/maths/vector2.h>
 #include <babylon/maths/vector3.h>
 #include <babylon/maths/vector4.h>
@@ -95,7 +97,7 @@ std::array<std::array<float, 4>, 64> SimplexNoise::sSimplexLut{
    {{0, 0, 0, 0}}, {{3, 1, 2, 0}}, {{2, 1, 0, 3}}, {{0, 0, 0, 0}}, {{0, 0, 0, 0}}, {{0, 0, 0, 0}},
    {{3, 1, 0, 2}}, {{0, 0, 0, 0}}, {{3, 2, 0, 1}}, {{3, 2, 1, 0}}}};
 
-SimplexNoise::SimplexNoise()
+SimplexNoise::SimplexNoise() : _threadPool{nullptr}
 {
   perm = {
     {151, 160, 137, 91,  90,  15,  131, 13,  201, 95,  96,  53,  194, 233, 7,   225, 140, 36,  103,
@@ -1978,6 +1980,242 @@ float SimplexNoise::iqfBm(const Vector3& v, uint8_t octaves, float lacunarity, f
 
 // -----------------------------------------------------------------------------
 
+namespace {
+
+// Points per kernel call of the grid functions, their coordinates stay in the L1 cache
+constexpr size_t GridBlockSize = 256;
+
+// Rows of the grids per thread pool task
+constexpr size_t GridPointsPerTask = 16384;
+
+// The batch kernels read the permutation table as ints, which the vectorized loops can gather
+using PermutationLanes = std::array<int, 512>;
+
+PermutationLanes toPermutationLanes(const std::array<unsigned char, 512>& perm)
+{
+  PermutationLanes lanes;
+  std::copy(perm.begin(), perm.end(), lanes.begin());
+  return lanes;
+}
+
+// The kernels below are the scalar noise functions written without branches, so that the
+// compiler vectorizes their loops: the corner contributions are clamped instead of being skipped,
+// and the gradients are selected instead of being looked up
+inline int fastfloorLane(float x)
+{
+  const int i = static_cast<int>(x);
+  return x > 0.f ? i : i - 1;
+}
+
+inline float grad2Lane(int hash, float x, float y)
+{
+  const int h   = hash & 7;
+  const float u = h < 4 ? x : y;
+  const float v = h < 4 ? y : x;
+  return ((h & 1) ? -u : u) + ((h & 2) ? -2.0f * v : 2.0f * v);
+}
+
+inline float grad3Lane(int hash, float x, float y, float z)
+{
+  const int h   = hash & 15;
+  const float u = h < 8 ? x : y;
+  const float v = h < 4 ? y : ((h == 12) | (h == 14)) ? x : z;
+  return ((h & 1) ? -u : u) + ((h & 2) ? -v : v);
+}
+
+void simplexNoise2(const int* __restrict perm, const float* __restrict xs,
+                   const float* __restrict ys, size_t count, float* __restrict result)
+{
+  constexpr float G2 = SimplexNoise::G2;
+  for (size_t p = 0; p < count; ++p) {
+    const float x  = xs[p];
+    const float y  = ys[p];
+    const float s  = (x + y) * SimplexNoise::F2;
+    const int i    = fastfloorLane(x + s);
+    const int j    = fastfloorLane(y + s);
+    const float t  = static_cast<float>(i + j) * G2;
+    const float x0 = x - (static_cast<float>(i) - t);
+    const float y0 = y - (static_cast<float>(j) - t);
+    const int i1   = x0 > y0 ? 1 : 0;
+    const int j1   = 1 - i1;
+    const float x1 = x0 - static_cast<float>(i1) + G2;
+    const float y1 = y0 - static_cast<float>(j1) + G2;
+    const float x2 = x0 - 1.0f + 2.0f * G2;
+    const float y2 = y0 - 1.0f + 2.0f * G2;
+    const int ii   = i & 0xff;
+    const int jj   = j & 0xff;
+    float t0       = std::max(0.5f - x0 * x0 - y0 * y0, 0.f);
+    float t1       = std::max(0.5f - x1 * x1 - y1 * y1, 0.f);
+    float t2       = std::max(0.5f - x2 * x2 - y2 * y2, 0.f);
+    t0 *= t0;
+    t1 *= t1;
+    t2 *= t2;
+    const float n0 = t0 * t0 * grad2Lane(perm[ii + perm[jj]], x0, y0);
+    const float n1 = t1 * t1 * grad2Lane(perm[ii + i1 + perm[jj + j1]], x1, y1);
+    const float n2 = t2 * t2 * grad2Lane(perm[ii + 1 + perm[jj + 1]], x2, y2);
+    result[p]      = 40.0f * (n0 + n1 + n2);
+  }
+}
+
+void simplexNoise3(const int* __restrict perm, const float* __restrict xs,
+                   const float* __restrict ys, const float* __restrict zs, size_t count,
+                   float* __restrict result)
+{
+  constexpr float G3 = SimplexNoise::G3;
+  for (size_t p = 0; p < count; ++p) {
+    const float x  = xs[p];
+    const float y  = ys[p];
+    const float z  = zs[p];
+    const float s  = (x + y + z) * SimplexNoise::F3;
+    const int i    = fastfloorLane(x + s);
+    const int j    = fastfloorLane(y + s);
+    const int k    = fastfloorLane(z + s);
+    const float t  = static_cast<float>(i + j + k) * G3;
+    const float x0 = x - (static_cast<float>(i) - t);
+    const float y0 = y - (static_cast<float>(j) - t);
+    const float z0 = z - (static_cast<float>(k) - t);
+    // The offsets of the second and third corners, from the ordering of x0, y0 and z0
+    const int xy = x0 >= y0, yz = y0 >= z0, xz = x0 >= z0;
+    const int i1 = xy & xz, j1 = (1 - xy) & yz, k1 = (1 - yz) & (1 - xz);
+    const int i2 = xy | xz, j2 = (1 - xy) | yz, k2 = (1 - yz) | (1 - xz);
+    const float x1 = x0 - static_cast<float>(i1) + G3;
+    const float y1 = y0 - static_cast<float>(j1) + G3;
+    const float z1 = z0 - static_cast<float>(k1) + G3;
+    const float x2 = x0 - static_cast<float>(i2) + 2.0f * G3;
+    const float y2 = y0 - static_cast<float>(j2) + 2.0f * G3;
+    const float z2 = z0 - static_cast<float>(k2) + 2.0f * G3;
+    const float x3 = x0 - 1.0f + 3.0f * G3;
+    const float y3 = y0 - 1.0f + 3.0f * G3;
+    const float z3 = z0 - 1.0f + 3.0f * G3;
+    const int ii   = i & 0xff;
+    const int jj   = j & 0xff;
+    const int kk   = k & 0xff;
+    float t0       = std::max(0.6f - x0 * x0 - y0 * y0 - z0 * z0, 0.f);
+    float t1       = std::max(0.6f - x1 * x1 - y1 * y1 - z1 * z1, 0.f);
+    float t2       = std::max(0.6f - x2 * x2 - y2 * y2 - z2 * z2, 0.f);
+    float t3       = std::max(0.6f - x3 * x3 - y3 * y3 - z3 * z3, 0.f);
+    t0 *= t0;
+    t1 *= t1;
+    t2 *= t2;
+    t3 *= t3;
+    const float n0 = t0 * t0 * grad3Lane(perm[ii + perm[jj + perm[kk]]], x0, y0, z0);
+    const float n1
+      = t1 * t1 * grad3Lane(perm[ii + i1 + perm[jj + j1 + perm[kk + k1]]], x1, y1, z1);
+    const float n2
+      = t2 * t2 * grad3Lane(perm[ii + i2 + perm[jj + j2 + perm[kk + k2]]], x2, y2, z2);
+    const float n3 = t3 * t3 * grad3Lane(perm[ii + 1 + perm[jj + 1 + perm[kk + 1]]], x3, y3, z3);
+    result[p]      = 32.0f * (n0 + n1 + n2 + n3);
+  }
+}
+
+// Calls func(x, y, z, count, result) on the blocks of points of a grid, the rows of all the layers
+// being split across the thread pool
+template <typename BlockFunction>
+void forEachGridBlock(ThreadPool& threadPool, const Vector3& origin, float step, size_t columns,
+                      size_t rows, size_t layers, float* result, const BlockFunction& func)
+{
+  if (columns == 0) {
+    return;
+  }
+  threadPool.parallelFor(
+    rows * layers, std::max<size_t>(1, GridPointsPerTask / columns),
+    [&](size_t begin, size_t end, size_t /*workerIndex*/) {
+      std::array<float, GridBlockSize> x, y, z;
+      for (size_t row = begin; row < end; ++row) {
+        const auto rowY = origin.y + step * static_cast<float>(row % rows);
+        const auto rowZ = origin.z + step * static_cast<float>(row / rows);
+        for (size_t column = 0; column < columns; column += GridBlockSize) {
+          const auto count = std::min(GridBlockSize, columns - column);
+          for (size_t i = 0; i < count; ++i) {
+            x[i] = origin.x + step * static_cast<float>(column + i);
+            y[i] = rowY;
+            z[i] = rowZ;
+          }
+          func(x.data(), y.data(), z.data(), count, result + row * columns + column);
+        }
+      }
+    });
+}
+
+} // end of anonymous namespace
+
+void SimplexNoise::noise(const float* x, const float* y, size_t count, float* result) const
+{
+  const auto permLanes = toPermutationLanes(perm);
+  simplexNoise2(permLanes.data(), x, y, count, result);
+}
+
+void SimplexNoise::noise(const float* x, const float* y, const float* z, size_t count,
+                         float* result) const
+{
+  const auto permLanes = toPermutationLanes(perm);
+  simplexNoise3(permLanes.data(), x, y, z, count, result);
+}
+
+void SimplexNoise::noiseGrid(const Vector2& origin, float step, size_t columns, size_t rows,
+                             Float32Array& result) const
+{
+  const auto permLanes = toPermutationLanes(perm);
+  auto& threadPool     = (_threadPool != nullptr ? *_threadPool : ThreadPool::Default());
+  result.resize(columns * rows);
+  forEachGridBlock(threadPool, Vector3(origin.x, origin.y, 0.f), step, columns, rows, 1,
+                   result.data(),
+                   [&](const float* x, const float* y, const float* /*z*/, size_t count,
+                       float* blockResult) {
+                     simplexNoise2(permLanes.data(), x, y, count, blockResult);
+                   });
+}
+
+void SimplexNoise::noiseGrid(const Vector3& origin, float step, size_t columns, size_t rows,
+                             size_t layers, Float32Array& result) const
+{
+  const auto permLanes = toPermutationLanes(perm);
+  auto& threadPool     = (_threadPool != nullptr ? *_threadPool : ThreadPool::Default());
+  result.resize(columns * rows * layers);
+  forEachGridBlock(threadPool, origin, step, columns, rows, layers, result.data(),
+                   [&](const float* x, const float* y, const float* z, size_t count,
+                       float* blockResult) {
+                     simplexNoise3(permLanes.data(), x, y, z, count, blockResult);
+                   });
+}
+
+void SimplexNoise::fBmGrid(const Vector2& origin, float step, size_t columns, size_t rows,
+                           Float32Array& result, uint8_t octaves, float lacunarity,
+                           float gain) const
+{
+  const auto permLanes = toPermutationLanes(perm);
+  auto& threadPool     = (_threadPool != nullptr ? *_threadPool : ThreadPool::Default());
+  result.resize(columns * rows);
+  forEachGridBlock(
+    threadPool, Vector3(origin.x, origin.y, 0.f), step, columns, rows, 1, result.data(),
+    [&](const float* x, const float* y, const float* /*z*/, size_t count, float* blockResult) {
+      std::array<float, GridBlockSize> octaveX, octaveY, octaveNoise;
+      std::fill(blockResult, blockResult + count, 0.f);
+      float freq = 1.0f;
+      float amp  = 0.5f;
+      for (uint8_t octave = 0; octave < octaves; ++octave) {
+        for (size_t i = 0; i < count; ++i) {
+          octaveX[i] = x[i] * freq;
+          octaveY[i] = y[i] * freq;
+        }
+        simplexNoise2(permLanes.data(), octaveX.data(), octaveY.data(), count,
+                      octaveNoise.data());
+        for (size_t i = 0; i < count; ++i) {
+          blockResult[i] += octaveNoise[i] * amp;
+        }
+        freq *= lacunarity;
+        amp *= gain;
+      }
+    });
+}
+
+void SimplexNoise::setThreadPool(ThreadPool* threadPool)
+{
+  _threadPool = threadPool;
+}
+
+// -----------------------------------------------------------------------------
+
 void SimplexNoise::seed(uint32_t s)
 {
   std::random_device rd;
@@ -4,15 +4,21 @@
 #include "DetourNavMesh.h"
 #include "DetourNavMeshBuilder.h"
 #include "DetourNavMeshQuery.h"
+#include "DetourTileCache.h"
+#include "DetourTileCacheBuilder.h"
 #include "Recast.h"
 
+#include <babylon/core/thread_pool.h>
+
 #include <algorithm>
 #include <cstring>
 #include <float.h>
+#include <functional>
 #include <iostream>
 #include <math.h>
 #include <sstream>
 #include <stdio.h>
+#include <unordered_map>
 #include <vector>
 
 namespace BABYLON {
@@ -23,7 +29,8 @@ void Log(const char* str)
   std::cout << std::string(str) << std::endl;
 }
 
-static int g_seed = 1337;
+// Per thread, so that the batched queries can reseed it for each query
+static thread_local int g_seed = 1337;
 inline int fastrand()
 {
   g_seed = (214013 * g_seed + 2531011);
@@ -54,32 +61,279 @@ struct NavMeshintermediates {
   rcContourSet* m_cset        = nullptr;
 };
 
+//
+// Tile cache support
+//
+
+static const int EXPECTED_LAYERS_PER_TILE  = 4;
+static const int MAX_LAYERS                = 32;
+static const int MAX_OBSTACLES             = 128;
+static const int MAX_TILE_CACHE_LAYER_SIZE = 255;
+
+// The layers are kept uncompressed: there is no compression library in the tree, and the
+// layers of a navmesh are small compared to the input geometry
+struct RawTileCacheCompressor : public dtTileCacheCompressor {
+  int maxCompressedSize(const int bufferSize) override
+  {
+    return bufferSize;
+  }
+
+  dtStatus compress(const unsigned char* buffer, const int bufferSize, unsigned char* compressed,
+                    const int maxCompressedSize, int* compressedSize) override
+  {
+    if (bufferSize > maxCompressedSize) {
+      return DT_FAILURE | DT_BUFFER_TOO_SMALL;
+    }
+    memcpy(compressed, buffer, static_cast<size_t>(bufferSize));
+    *compressedSize = bufferSize;
+    return DT_SUCCESS;
+  }
+
+  dtStatus decompress(const unsigned char* compressed, const int compressedSize,
+                      unsigned char* buffer, const int maxBufferSize, int* bufferSize) override
+  {
+    if (compressedSize > maxBufferSize) {
+      return DT_FAILURE | DT_BUFFER_TOO_SMALL;
+    }
+    memcpy(buffer, compressed, static_cast<size_t>(compressedSize));
+    *bufferSize = compressedSize;
+    return DT_SUCCESS;
+  }
+};
+
+// Same area / flags convention as the single tile build
+struct TileCacheMeshProcess : public dtTileCacheMeshProcess {
+  void process(dtNavMeshCreateParams* params, unsigned char* polyAreas,
+               unsigned short* polyFlags) override
+  {
+    for (int i = 0; i < params->polyCount; ++i) {
+      if (polyAreas[i] == DT_TILECACHE_WALKABLE_AREA) {
+        polyAreas[i] = 0;
+      }
+      if (polyAreas[i] == 0) {
+        polyFlags[i] = 1;
+      }
+    }
+  }
+};
+
+struct TileCacheObstacle {
+  dtObstacleRef ref = 0;
+  bool isBox        = false;
+  Vec3 position;
+  Vec3 extent;
+  float radius = 0.f;
+  float height = 0.f;
+  float angle  = 0.f;
+};
+
+struct TileCacheLayerData {
+  unsigned char* data = nullptr;
+  int dataSize        = 0;
+};
+
+struct NavMeshTileCache {
+  ~NavMeshTileCache()
+  {
+    dtFreeTileCache(tileCache);
+  }
+
+  rcConfig cfg;        // per tile configuration (the bounds are the bounds of the whole grid)
+  int tileCountX = 0;  // number of tiles along x
+  int tileCountZ = 0;  // number of tiles along z
+  std::vector<float> verts;
+  std::vector<int> tris;
+  std::vector<std::vector<int>> tileTriangles; // triangles overlapping each tile (and its border)
+  dtTileCacheAlloc alloc;
+  RawTileCacheCompressor compressor;
+  TileCacheMeshProcess meshProcess;
+  dtTileCache* tileCache = nullptr;
+  std::unordered_map<dtObstacleRef, TileCacheObstacle> obstacles;
+  dtObstacleRef nextObstacleId = 1;
+};
+
+// Copies the input geometry, reversing the triangles winding as done by the single tile build
+static void setTileCacheGeometry(NavMeshTileCache& tc, const float* positions,
+                                 const int positionCount, const int* indices, const int indexCount)
+{
+  tc.verts.assign(positions, positions + positionCount * 3);
+  tc.tris.resize(static_cast<size_t>(indexCount - indexCount % 3));
+  for (size_t i = 0; i < tc.tris.size(); i += 3) {
+    tc.tris[i + 0] = indices[i + 2];
+    tc.tris[i + 1] = indices[i + 1];
+    tc.tris[i + 2] = indices[i + 0];
+  }
+}
+
+static void assignTrianglesToTiles(NavMeshTileCache& tc)
+{
+  const rcConfig& cfg = tc.cfg;
+  const float tcs     = static_cast<float>(cfg.tileSize) * cfg.cs;
+  const float border  = static_cast<float>(cfg.borderSize) * cfg.cs;
+
+  tc.tileTriangles.assign(static_cast<size_t>(tc.tileCountX * tc.tileCountZ), {});
+  for (size_t i = 0; i < tc.tris.size(); i += 3) {
+    float minX = FLT_MAX, minZ = FLT_MAX, maxX = -FLT_MAX, maxZ = -FLT_MAX;
+    for (size_t j = 0; j < 3; ++j) {
+      const float* v = &tc.verts[static_cast<size_t>(tc.tris[i + j]) * 3];
+      minX           = std::min(minX, v[0]);
+      maxX           = std::max(maxX, v[0]);
+      minZ           = std::min(minZ, v[2]);
+      maxZ           = std::max(maxZ, v[2]);
+    }
+    const int tx0 = std::max(0, static_cast<int>(floorf((minX - border - cfg.bmin[0]) / tcs)));
+    const int tx1
+      = std::min(tc.tileCountX - 1, static_cast<int>(floorf((maxX + border - cfg.bmin[0]) / tcs)));
+    const int tz0 = std::max(0, static_cast<int>(floorf((minZ - border - cfg.bmin[2]) / tcs)));
+    const int tz1
+      = std::min(tc.tileCountZ - 1, static_cast<int>(floorf((maxZ + border - cfg.bmin[2]) / tcs)));
+    for (int tz = tz0; tz <= tz1; ++tz) {
+      for (int tx = tx0; tx <= tx1; ++tx) {
+        tc.tileTriangles[static_cast<size_t>(tz * tc.tileCountX + tx)].emplace_back(
+          static_cast<int>(i / 3));
+      }
+    }
+  }
+}
+
+// Rasterizes the geometry of one tile into compressed tile cache layers (the tile cache is only
+// read, tiles can be rasterized concurrently)
+static bool rasterizeTileLayers(NavMeshTileCache& tc, int tx, int ty,
+                                std::vector<TileCacheLayerData>& layers)
+{
+  const auto& tileTriangles = tc.tileTriangles[static_cast<size_t>(ty * tc.tileCountX + tx)];
+  if (tileTriangles.empty()) {
+    return true;
+  }
+
+  rcContext ctx(false);
+  rcConfig tcfg   = tc.cfg;
+  const float tcs = static_cast<float>(tcfg.tileSize) * tcfg.cs;
+  tcfg.bmin[0]    = tc.cfg.bmin[0] + static_cast<float>(tx) * tcs;
+  tcfg.bmin[2]    = tc.cfg.bmin[2] + static_cast<float>(ty) * tcs;
+  tcfg.bmax[0]    = tcfg.bmin[0] + tcs;
+  tcfg.bmax[2]    = tcfg.bmin[2] + tcs;
+  tcfg.bmin[0] -= static_cast<float>(tcfg.borderSize) * tcfg.cs;
+  tcfg.bmin[2] -= static_cast<float>(tcfg.borderSize) * tcfg.cs;
+  tcfg.bmax[0] += static_cast<float>(tcfg.borderSize) * tcfg.cs;
+  tcfg.bmax[2] += static_cast<float>(tcfg.borderSize) * tcfg.cs;
+
+  NavMeshintermediates intermediates;
+  intermediates.m_solid = rcAllocHeightfield();
+  if (!intermediates.m_solid
+      || !rcCreateHeightfield(&ctx, *intermediates.m_solid, tcfg.width, tcfg.height, tcfg.bmin,
+                              tcfg.bmax, tcfg.cs, tcfg.ch)) {
+    Log("buildTiledNavigation: Could not create solid heightfield.");
+    return false;
+  }
+
+  std::vector<int> tris(tileTriangles.size() * 3);
+  for (size_t i = 0; i < tileTriangles.size(); ++i) {
+    const auto* t   = &tc.tris[static_cast<size_t>(tileTriangles[i]) * 3];
+    tris[i * 3 + 0] = t[0];
+    tris[i * 3 + 1] = t[1];
+    tris[i * 3 + 2] = t[2];
+  }
+  // All the triangles are walkable, as in the single tile build
+  std::vector<unsigned char> triareas(tileTriangles.size(), RC_WALKABLE_AREA);
+  rcRasterizeTriangles(&ctx, tc.verts.data(), static_cast<int>(tc.verts.size() / 3), tris.data(),
+                       triareas.data(), static_cast<int>(tileTriangles.size()),
+                       *intermediates.m_solid, tcfg.walkableClimb);
+
+  rcFilterLowHangingWalkableObstacles(&ctx, tcfg.walkableClimb, *intermediates.m_solid);
+  rcFilterLedgeSpans(&ctx, tcfg.walkableHeight, tcfg.walkableClimb, *intermediates.m_solid);
+  rcFilterWalkableLowHeightSpans(&ctx, tcfg.walkableHeight, *intermediates.m_solid);
+
+  intermediates.m_chf = rcAllocCompactHeightfield();
+  if (!intermediates.m_chf
+      || !rcBuildCompactHeightfield(&ctx, tcfg.walkableHeight, tcfg.walkableClimb,
+                                    *intermediates.m_solid, *intermediates.m_chf)) {
+    Log("buildTiledNavigation: Could not build compact data.");
+    return false;
+  }
+  if (!rcErodeWalkableArea(&ctx, tcfg.walkableRadius, *intermediates.m_chf)) {
+    Log("buildTiledNavigation: Could not erode.");
+    return false;
+  }
+
+  rcHeightfieldLayerSet* lset = rcAllocHeightfieldLayerSet();
+  if (!lset
+      || !rcBuildHeightfieldLayers(&ctx, *intermediates.m_chf, tcfg.borderSize,
+                                   tcfg.walkableHeight, *lset)) {
+    rcFreeHeightfieldLayerSet(lset);
+    Log("buildTiledNavigation: Could not build heighfield layers.");
+    return false;
+  }
+
+  for (int i = 0; i < std::min(lset->nlayers, MAX_LAYERS); ++i) {
+    const rcHeightfieldLayer* layer = &lset->layers[i];
+
+    dtTileCacheLayerHeader header;
+    header.magic   = DT_TILECACHE_MAGIC;
+    header.version = DT_TILECACHE_VERSION;
+    header.tx      = tx;
+    header.ty      = ty;
+    header.tlayer  = i;
+    dtVcopy(header.bmin, layer->bmin);
+    dtVcopy(header.bmax, layer->bmax);
+    header.width  = static_cast<unsigned char>(layer->width);
+    header.height = static_cast<unsigned char>(layer->height);
+    header.minx   = static_cast<unsigned char>(layer->minx);
+    header.maxx   = static_cast<unsigned char>(layer->maxx);
+    header.miny   = static_cast<unsigned char>(layer->miny);
+    header.maxy   = static_cast<unsigned char>(layer->maxy);
+    header.hmin   = static_cast<unsigned short>(layer->hmin);
+    header.hmax   = static_cast<unsigned short>(layer->hmax);
+
+    TileCacheLayerData tile;
+    dtStatus status = dtBuildTileCacheLayer(&tc.compressor, &header, layer->heights, layer->areas,
+                                            layer->cons, &tile.data, &tile.dataSize);
+    if (dtStatusFailed(status)) {
+      rcFreeHeightfieldLayerSet(lset);
+      Log("buildTiledNavigation: Could not build tile cache layer.");
+      return false;
+    }
+    layers.emplace_back(tile);
+  }
+  rcFreeHeightfieldLayerSet(lset);
+
+  return true;
+}
+
 void NavMesh::destroy()
 {
   if (m_pmesh) {
     rcFreePolyMesh(m_pmesh);
+    m_pmesh = nullptr;
   }
   if (m_dmesh) {
     rcFreePolyMeshDetail(m_dmesh);
+    m_dmesh = nullptr;
   }
   if (m_navData) {
     dtFree(m_navData);
+    m_navData = nullptr;
   }
+  delete m_tileCache;
+  m_tileCache = nullptr;
   dtFreeNavMesh(m_navMesh);
+  m_navMesh = nullptr;
   dtFreeNavMeshQuery(m_navQuery);
+  m_navQuery = nullptr;
+  for (auto* query : m_batchQueries) {
+    dtFreeNavMeshQuery(query);
+  }
+  m_batchQueries.clear();
 }
 
-void NavMesh::build(const float* positions, const int /*positionCount*/, const int* indices,
+void NavMesh::build(const float* positions, const int positionCount, const int* indices,
                     const int indexCount, const rcConfig& config)
 {
-  if (m_pmesh) {
-    rcFreePolyMesh(m_pmesh);
-  }
-  if (m_dmesh) {
-    rcFreePolyMeshDetail(m_dmesh);
-  }
-  if (m_navData) {
-    dtFree(m_navData);
+  destroy();
+
+  if (config.tileSize > 0) {
+    buildTiled(positions, positionCount, indices, indexCount, config);
+    return;
   }
 
   NavMeshintermediates intermediates;
@@ -348,6 +602,8 @@ void NavMesh::build(const float* positions, const int /*positionCount*/, const i
       Log("Could not init Detour navmesh");
       return;
     }
+    // The data is now owned by the navmesh
+    m_navData = nullptr;
 
     m_navQuery = dtAllocNavMeshQuery();
     if (!m_navQuery) {
@@ -367,6 +623,367 @@ void NavMesh::build(const float* positions, const int /*positionCount*/, const i
   Log("Done");
 }
 
+void NavMesh::buildTiled(const float* positions, const int positionCount, const int* indices,
+                         const int indexCount, const rcConfig& config)
+{
+  // The tile cache layers store their dimensions as unsigned char, including the border.
+  const int borderSize = config.walkableRadius + 3; // Reserve enough padding.
+  if (config.tileSize + borderSize * 2 > MAX_TILE_CACHE_LAYER_SIZE) {
+    std::ostringstream msg;
+    msg << "buildTiledNavigation: Tile size " << config.tileSize << " with a border of "
+        << borderSize << " exceeds the tile cache layer size of " << MAX_TILE_CACHE_LAYER_SIZE
+        << ".";
+    Log(msg.str().c_str());
+    return;
+  }
+
+  m_tileCache = new NavMeshTileCache();
+  auto& tc    = *m_tileCache;
+  setTileCacheGeometry(tc, positions, positionCount, indices, indexCount);
+
+  Vec3 bbMin(FLT_MAX);
+  Vec3 bbMax(-FLT_MAX);
+  for (size_t i = 0; i < tc.verts.size(); i += 3) {
+    const Vec3 v(tc.verts[i], tc.verts[i + 1], tc.verts[i + 2]);
+    bbMin.isMinOf(v);
+    bbMax.isMaxOf(v);
+  }
+
+  rcConfig& cfg  = tc.cfg;
+  cfg            = config;
+  cfg.borderSize = borderSize;
+  cfg.width      = config.tileSize + cfg.borderSize * 2;
+  cfg.height     = config.tileSize + cfg.borderSize * 2;
+  rcVcopy(cfg.bmin, &bbMin.x);
+  rcVcopy(cfg.bmax, &bbMax.x);
+
+  int gridWidth = 0, gridHeight = 0;
+  rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &gridWidth, &gridHeight);
+  tc.tileCountX = std::max(1, (gridWidth + config.tileSize - 1) / config.tileSize);
+  tc.tileCountZ = std::max(1, (gridHeight + config.tileSize - 1) / config.tileSize);
+  assignTrianglesToTiles(tc);
+
+  // Tile cache params (the walkable values are in world units)
+  dtTileCacheParams tcparams;
+  memset(&tcparams, 0, sizeof(tcparams));
+  rcVcopy(tcparams.orig, cfg.bmin);
+  tcparams.cs                     = cfg.cs;
+  tcparams.ch                     = cfg.ch;
+  tcparams.width                  = config.tileSize;
+  tcparams.height                 = config.tileSize;
+  tcparams.walkableHeight         = static_cast<float>(config.walkableHeight) * cfg.ch;
+  tcparams.walkableRadius         = static_cast<float>(config.walkableRadius) * cfg.cs;
+  tcparams.walkableClimb          = static_cast<float>(config.walkableClimb) * cfg.ch;
+  tcparams.maxSimplificationError = config.maxSimplificationError;
+  tcparams.maxTiles               = tc.tileCountX * tc.tileCountZ * EXPECTED_LAYERS_PER_TILE;
+  tcparams.maxObstacles           = MAX_OBSTACLES;
+
+  tc.tileCache = dtAllocTileCache();
+  if (!tc.tileCache) {
+    Log("buildTiledNavigation: Could not allocate tile cache.");
+    return;
+  }
+  dtStatus status = tc.tileCache->init(&tcparams, &tc.alloc, &tc.compressor, &tc.meshProcess);
+  if (dtStatusFailed(status)) {
+    Log("buildTiledNavigation: Could not init tile cache.");
+    return;
+  }
+
+  // Navmesh params
+  const int tileBits
+    = std::min(static_cast<int>(dtIlog2(dtNextPow2(static_cast<unsigned int>(
+                 tc.tileCountX * tc.tileCountZ * EXPECTED_LAYERS_PER_TILE)))),
+               14);
+  const int polyBits = 22 - tileBits;
+  dtNavMeshParams params;
+  memset(&params, 0, sizeof(params));
+  rcVcopy(params.orig, cfg.bmin);
+  params.tileWidth  = static_cast<float>(config.tileSize) * cfg.cs;
+  params.tileHeight = static_cast<float>(config.tileSize) * cfg.cs;
+  params.maxTiles   = 1 << tileBits;
+  params.maxPolys   = 1 << polyBits;
+
+  m_navMesh = dtAllocNavMesh();
+  if (!m_navMesh) {
+    Log("Could not create Detour navmesh");
+    return;
+  }
+  status = m_navMesh->init(&params);
+  if (dtStatusFailed(status)) {
+    Log("Could not init Detour navmesh");
+    return;
+  }
+
+  m_navQuery = dtAllocNavMeshQuery();
+  if (!m_navQuery) {
+    Log("Could not allocate Navmesh query");
+    return;
+  }
+  status = m_navQuery->init(m_navMesh, 2048);
+  if (dtStatusFailed(status)) {
+    Log("Could not init Detour navmesh query");
+    return;
+  }
+
+  if (!rebuildTiles(0, 0, tc.tileCountX - 1, tc.tileCountZ - 1)) {
+    Log("buildTiledNavigation: Could not build all the tiles.");
+    return;
+  }
+  Log("Done");
+}
+
+bool NavMesh::rebuildTiles(int minTileX, int minTileZ, int maxTileX, int maxTileZ)
+{
+  auto& tc = *m_tileCache;
+  minTileX = std::max(minTileX, 0);
+  minTileZ = std::max(minTileZ, 0);
+  maxTileX = std::min(maxTileX, tc.tileCountX - 1);
+  maxTileZ = std::min(maxTileZ, tc.tileCountZ - 1);
+  if (minTileX > maxTileX || minTileZ > maxTileZ) {
+    return true;
+  }
+
+  // Rasterize the tiles in parallel, this is where most of the build time is spent
+  const int rangeX = maxTileX - minTileX + 1;
+  const int rangeZ = maxTileZ - minTileZ + 1;
+  std::vector<std::vector<TileCacheLayerData>> tileLayers(static_cast<size_t>(rangeX * rangeZ));
+  std::vector<char> rasterized(tileLayers.size(), 0);
+  ThreadPool::Default().parallelFor(
+    tileLayers.size(), 1, [&](size_t begin, size_t end, size_t /*workerIndex*/) {
+      for (size_t i = begin; i < end; ++i) {
+        const int tx  = minTileX + static_cast<int>(i) % rangeX;
+        const int tz  = minTileZ + static_cast<int>(i) / rangeX;
+        rasterized[i] = rasterizeTileLayers(tc, tx, tz, tileLayers[i]) ? 1 : 0;
+      }
+    });
+
+  // The tile cache and the navmesh are not thread safe, the tiles are added sequentially
+  bool success = true;
+  for (size_t i = 0; i < tileLayers.size(); ++i) {
+    const int tx = minTileX + static_cast<int>(i) % rangeX;
+    const int tz = minTileZ + static_cast<int>(i) / rangeX;
+
+    // A tile which could not be rasterized keeps its previous layers
+    if (!rasterized[i]) {
+      for (auto& layer : tileLayers[i]) {
+        dtFree(layer.data);
+      }
+      success = false;
+      continue;
+    }
+
+    dtCompressedTileRef oldTiles[MAX_LAYERS];
+    const int oldTileCount = tc.tileCache->getTilesAt(tx, tz, oldTiles, MAX_LAYERS);
+    for (int j = 0; j < oldTileCount; ++j) {
+      tc.tileCache->removeTile(oldTiles[j], nullptr, nullptr);
+    }
+    const dtMeshTile* oldNavMeshTiles[MAX_LAYERS];
+    const int oldNavMeshTileCount = m_navMesh->getTilesAt(tx, tz, oldNavMeshTiles, MAX_LAYERS);
+    for (int j = 0; j < oldNavMeshTileCount; ++j) {
+      m_navMesh->removeTile(m_navMesh->getTileRef(oldNavMeshTiles[j]), nullptr, nullptr);
+    }
+
+    for (auto& layer : tileLayers[i]) {
+      dtStatus status = tc.tileCache->addTile(layer.data, layer.dataSize,
+                                              DT_COMPRESSEDTILE_FREE_DATA, nullptr);
+      if (dtStatusFailed(status)) {
+        dtFree(layer.data);
+        success = false;
+      }
+    }
+    if (dtStatusFailed(tc.tileCache->buildNavMeshTilesAt(tx, tz, m_navMesh))) {
+      success = false;
+    }
+  }
+
+  return success;
+}
+
+bool NavMesh::updateGeometry(const float* positions, const int positionCount, const int* indices,
+                             const int indexCount, const Vec3& bmin, const Vec3& bmax)
+{
+  if (!m_tileCache || !m_tileCache->tileCache) {
+    return false;
+  }
+
+  auto& tc = *m_tileCache;
+  setTileCacheGeometry(tc, positions, positionCount, indices, indexCount);
+  assignTrianglesToTiles(tc);
+
+  // Tiles whose border overlaps the modified area
+  const float tcs    = static_cast<float>(tc.cfg.tileSize) * tc.cfg.cs;
+  const float border = static_cast<float>(tc.cfg.borderSize) * tc.cfg.cs;
+  const int minTileX
+    = std::max(0, static_cast<int>(floorf((bmin.x - border - tc.cfg.bmin[0]) / tcs)));
+  const int minTileZ
+    = std::max(0, static_cast<int>(floorf((bmin.z - border - tc.cfg.bmin[2]) / tcs)));
+  const int maxTileX = std::min(
+    tc.tileCountX - 1, static_cast<int>(floorf((bmax.x + border - tc.cfg.bmin[0]) / tcs)));
+  const int maxTileZ = std::min(
+    tc.tileCountZ - 1, static_cast<int>(floorf((bmax.z + border - tc.cfg.bmin[2]) / tcs)));
+  const float rebuiltMinX = tc.cfg.bmin[0] + static_cast<float>(minTileX) * tcs;
+  const float rebuiltMinZ = tc.cfg.bmin[2] + static_cast<float>(minTileZ) * tcs;
+  const float rebuiltMaxX = tc.cfg.bmin[0] + static_cast<float>(maxTileX + 1) * tcs;
+  const float rebuiltMaxZ = tc.cfg.bmin[2] + static_cast<float>(maxTileZ + 1) * tcs;
+
+  // The obstacles reference the tiles they touch, the ones touching the rebuilt tiles are removed
+  // and re-added on top of the new tiles
+  if (!updateUntilUpToDate()) {
+    return false;
+  }
+  std::vector<TileCacheObstacle*> movedObstacles;
+  for (auto& item : tc.obstacles) {
+    auto& obstacle = item.second;
+    const auto* ob = tc.tileCache->getObstacleByRef(obstacle.ref);
+    if (!ob) {
+      continue;
+    }
+    float obmin[3], obmax[3];
+    tc.tileCache->getObstacleBounds(ob, obmin, obmax);
+    if (obmin[0] <= rebuiltMaxX && obmax[0] >= rebuiltMinX && obmin[2] <= rebuiltMaxZ
+        && obmax[2] >= rebuiltMinZ) {
+      const auto ref = obstacle.ref;
+      if (dtStatusFailed(
+            requestObstacle([&tc, ref]() { return tc.tileCache->removeObstacle(ref); }))) {
+        return false;
+      }
+      movedObstacles.emplace_back(&obstacle);
+    }
+  }
+  if (!updateUntilUpToDate()) {
+    return false;
+  }
+
+  auto success = rebuildTiles(minTileX, minTileZ, maxTileX, maxTileZ);
+
+  for (auto* obstacle : movedObstacles) {
+    obstacle->ref     = 0;
+    const auto status = requestObstacle([&tc, obstacle]() {
+      if (obstacle->isBox) {
+        return tc.tileCache->addBoxObstacle(&obstacle->position.x, &obstacle->extent.x,
+                                            obstacle->angle, &obstacle->ref);
+      }
+      return tc.tileCache->addObstacle(&obstacle->position.x, obstacle->radius, obstacle->height,
+                                       &obstacle->ref);
+    });
+    if (dtStatusFailed(status)) {
+      success = false;
+    }
+  }
+
+  return updateUntilUpToDate() && success;
+}
+
+dtObstacleRef NavMesh::addCylinderObstacle(const Vec3& position, float radius, float height)
+{
+  if (!m_tileCache || !m_tileCache->tileCache) {
+    return 0;
+  }
+
+  TileCacheObstacle obstacle;
+  obstacle.position = position;
+  obstacle.radius   = radius;
+  obstacle.height   = height;
+  auto& tileCache = *m_tileCache->tileCache;
+  if (dtStatusFailed(requestObstacle([&tileCache, &obstacle]() {
+        return tileCache.addObstacle(&obstacle.position.x, obstacle.radius, obstacle.height,
+                                     &obstacle.ref);
+      }))) {
+    return 0;
+  }
+  const auto id              = m_tileCache->nextObstacleId++;
+  m_tileCache->obstacles[id] = obstacle;
+  return id;
+}
+
+dtObstacleRef NavMesh::addBoxObstacle(const Vec3& position, const Vec3& extent, float angle)
+{
+  if (!m_tileCache || !m_tileCache->tileCache) {
+    return 0;
+  }
+
+  TileCacheObstacle obstacle;
+  obstacle.isBox    = true;
+  obstacle.position = position;
+  obstacle.extent   = extent;
+  obstacle.angle    = angle;
+  auto& tileCache = *m_tileCache->tileCache;
+  if (dtStatusFailed(requestObstacle([&tileCache, &obstacle]() {
+        return tileCache.addBoxObstacle(&obstacle.position.x, &obstacle.extent.x, obstacle.angle,
+                                        &obstacle.ref);
+      }))) {
+    return 0;
+  }
+  const auto id              = m_tileCache->nextObstacleId++;
+  m_tileCache->obstacles[id] = obstacle;
+  return id;
+}
+
+void NavMesh::removeObstacle(dtObstacleRef obstacle)
+{
+  if (!m_tileCache || !m_tileCache->tileCache) {
+    return;
+  }
+
+  auto it = m_tileCache->obstacles.find(obstacle);
+  if (it == m_tileCache->obstacles.end()) {
+    return;
+  }
+  auto& tileCache = *m_tileCache->tileCache;
+  const auto ref  = it->second.ref;
+  if (dtStatusFailed(
+        requestObstacle([&tileCache, ref]() { return tileCache.removeObstacle(ref); }))) {
+    return;
+  }
+  m_tileCache->obstacles.erase(it);
+}
+
+bool NavMesh::update()
+{
+  if (!m_tileCache || !m_tileCache->tileCache) {
+    return true;
+  }
+
+  bool upToDate = false;
+  if (dtStatusFailed(m_tileCache->tileCache->update(0.f, m_navMesh, &upToDate))) {
+    Log("update: Could not update the tile cache.");
+    return false;
+  }
+  return upToDate;
+}
+
+bool NavMesh::updateUntilUpToDate()
+{
+  // Each update applies the pending obstacle requests and rebuilds at most one tile
+  const int maxUpdates = m_tileCache->tileCache->getParams()->maxTiles + MAX_OBSTACLES;
+  for (int i = 0; i < maxUpdates; ++i) {
+    bool upToDate = false;
+    if (dtStatusFailed(m_tileCache->tileCache->update(0.f, m_navMesh, &upToDate))) {
+      Log("update: Could not update the tile cache.");
+      return false;
+    }
+    if (upToDate) {
+      return true;
+    }
+  }
+  Log("update: The tile cache is still not up to date.");
+  return false;
+}
+
+dtStatus NavMesh::requestObstacle(const std::function<dtStatus()>& request)
+{
+  // An update applies all the queued requests, a request rejected because the queue is full only
+  // needs to be retried once
+  auto status = request();
+  if (status & DT_BUFFER_TOO_SMALL) {
+    bool upToDate = false;
+    if (dtStatusSucceed(m_tileCache->tileCache->update(0.f, m_navMesh, &upToDate))) {
+      status = request();
+    }
+  }
+  return status;
+}
+
 static const int NAVMESHSET_MAGIC   = 'M' << 24 | 'S' << 16 | 'E' << 8 | 'T'; //'MSET';
 static const int NAVMESHSET_VERSION = 1;
 
@@ -582,20 +1199,33 @@ DebugNavMesh NavMesh::getDebugNavMesh()
   return debugNavMesh;
 }
 
-Vec3 NavMesh::getClosestPoint(const Vec3& position)
+//
+// Queries, shared by the single and the batched versions
+//
+
+static const int MAX_PATH_POLYS = 256;
+
+static dtQueryFilter defaultQueryFilter()
 {
   dtQueryFilter filter;
   filter.setIncludeFlags(0xffff);
   filter.setExcludeFlags(0);
+  return filter;
+}
+
+static Vec3 queryClosestPoint(const dtNavMeshQuery& navQuery, const Vec3& position,
+                              const Vec3& extent)
+{
+  const dtQueryFilter filter = defaultQueryFilter();
 
   dtPolyRef polyRef;
 
   Vec3 pos(position.x, position.y, position.z);
-  m_navQuery->findNearestPoly(&pos.x, &m_defaultQueryExtent.x, &filter, &polyRef, nullptr);
+  navQuery.findNearestPoly(&pos.x, &extent.x, &filter, &polyRef, nullptr);
 
   bool posOverlay;
   Vec3 resDetour;
-  dtStatus status = m_navQuery->closestPointOnPoly(polyRef, &pos.x, &resDetour.x, &posOverlay);
+  dtStatus status = navQuery.closestPointOnPoly(polyRef, &pos.x, &resDetour.x, &posOverlay);
 
   if (dtStatusFailed(status)) {
     return Vec3(0.f, 0.f, 0.f);
@@ -603,22 +1233,21 @@ Vec3 NavMesh::getClosestPoint(const Vec3& position)
   return Vec3(resDetour.x, resDetour.y, resDetour.z);
 }
 
-Vec3 NavMesh::getRandomPointAround(const Vec3& position, float maxRadius)
+static Vec3 queryRandomPointAround(const dtNavMeshQuery& navQuery, const Vec3& position,
+                                   float maxRadius, const Vec3& extent)
 {
-  dtQueryFilter filter;
-  filter.setIncludeFlags(0xffff);
-  filter.setExcludeFlags(0);
+  const dtQueryFilter filter = defaultQueryFilter();
 
   dtPolyRef polyRef;
 
   Vec3 pos(position.x, position.y, position.z);
 
-  m_navQuery->findNearestPoly(&pos.x, &m_defaultQueryExtent.x, &filter, &polyRef, nullptr);
+  navQuery.findNearestPoly(&pos.x, &extent.x, &filter, &polyRef, nullptr);
 
   dtPolyRef randomRef;
   Vec3 resDetour;
-  dtStatus status = m_navQuery->findRandomPointAroundCircle(polyRef, &position.x, maxRadius,
-                                                            &filter, r01, &randomRef, &resDetour.x);
+  dtStatus status = navQuery.findRandomPointAroundCircle(polyRef, &position.x, maxRadius, &filter,
+                                                         r01, &randomRef, &resDetour.x);
   if (dtStatusFailed(status)) {
     return Vec3(0.f, 0.f, 0.f);
   }
@@ -626,6 +1255,61 @@ Vec3 NavMesh::getRandomPointAround(const Vec3& position, float maxRadius)
   return Vec3(resDetour.x, resDetour.y, resDetour.z);
 }
 
+// Writes at most maxPoints points of the straight path from start to end, returns the point count
+static int queryPath(const dtNavMeshQuery& navQuery, const Vec3& start, const Vec3& end,
+                     const Vec3& extent, Vec3* points, int maxPoints)
+{
+  float straightPath[MAX_PATH_POLYS * 3];
+
+  dtPolyRef startRef;
+  dtPolyRef endRef;
+
+  const dtQueryFilter filter = defaultQueryFilter();
+
+  Vec3 posStart(start.x, start.y, start.z);
+  Vec3 posEnd(end.x, end.y, end.z);
+
+  navQuery.findNearestPoly(&posStart.x, &extent.x, &filter, &startRef, nullptr);
+  navQuery.findNearestPoly(&posEnd.x, &extent.x, &filter, &endRef, nullptr);
+
+  dtPolyRef polys[MAX_PATH_POLYS];
+  int npolys;
+
+  navQuery.findPath(startRef, endRef, &posStart.x, &posEnd.x, &filter, polys, &npolys,
+                    MAX_PATH_POLYS);
+  int mNstraightPath = 0;
+  if (npolys) {
+    unsigned char straightPathFlags[MAX_PATH_POLYS];
+    dtPolyRef straightPathPolys[MAX_PATH_POLYS];
+    int straightPathOptions;
+    bool posOverPoly;
+    Vec3 closestEnd = posEnd;
+
+    if (polys[npolys - 1] != endRef) {
+      navQuery.closestPointOnPoly(polys[npolys - 1], &end.x, &closestEnd.x, &posOverPoly);
+    }
+    straightPathOptions = 0;
+    navQuery.findStraightPath(&posStart.x, &closestEnd.x, polys, npolys, straightPath,
+                              straightPathFlags, straightPathPolys, &mNstraightPath,
+                              std::min(maxPoints, MAX_PATH_POLYS), straightPathOptions);
+
+    for (int i = 0; i < mNstraightPath; i++) {
+      points[i] = Vec3(straightPath[i * 3], straightPath[i * 3 + 1], straightPath[i * 3 + 2]);
+    }
+  }
+  return mNstraightPath;
+}
+
+Vec3 NavMesh::getClosestPoint(const Vec3& position)
+{
+  return queryClosestPoint(*m_navQuery, position, m_defaultQueryExtent);
+}
+
+Vec3 NavMesh::getRandomPointAround(const Vec3& position, float maxRadius)
+{
+  return queryRandomPointAround(*m_navQuery, position, maxRadius, m_defaultQueryExtent);
+}
+
 Vec3 NavMesh::moveAlong(const Vec3& position, const Vec3& destination)
 {
   dtQueryFilter filter;
@@ -654,50 +1338,87 @@ Vec3 NavMesh::moveAlong(const Vec3& position, const Vec3& destination)
 NavPath NavMesh::computePath(const Vec3& start, const Vec3& end) const
 {
   NavPath navpath;
-  static const int MAX_POLYS = 256;
-  float straightPath[MAX_POLYS * 3];
-
-  dtPolyRef startRef;
-  dtPolyRef endRef;
-
-  dtQueryFilter filter;
-  filter.setIncludeFlags(0xffff);
-  filter.setExcludeFlags(0);
-
-  Vec3 posStart(start.x, start.y, start.z);
-  Vec3 posEnd(end.x, end.y, end.z);
-
-  m_navQuery->findNearestPoly(&posStart.x, &m_defaultQueryExtent.x, &filter, &startRef, nullptr);
-  m_navQuery->findNearestPoly(&posEnd.x, &m_defaultQueryExtent.x, &filter, &endRef, nullptr);
+  navpath.mPoints.resize(MAX_PATH_POLYS);
+  const int pointCount = queryPath(*m_navQuery, start, end, m_defaultQueryExtent,
+                                   navpath.mPoints.data(), MAX_PATH_POLYS);
+  navpath.mPoints.resize(static_cast<size_t>(pointCount));
+  return navpath;
+}
 
-  dtPolyRef polys[MAX_POLYS];
-  int npolys;
+dtNavMeshQuery* const* NavMesh::getBatchQueries(size_t workerCount) const
+{
+  // The queries of a new pool are not attached to any navmesh either, they would not be initialized
+  if (!m_navMesh) {
+    return nullptr;
+  }
 
-  m_navQuery->findPath(startRef, endRef, &posStart.x, &posEnd.x, &filter, polys, &npolys,
-                       MAX_POLYS);
-  int mNstraightPath = 0;
-  if (npolys) {
-    unsigned char straightPathFlags[MAX_POLYS];
-    dtPolyRef straightPathPolys[MAX_POLYS];
-    int straightPathOptions;
-    bool posOverPoly;
-    Vec3 closestEnd = posEnd;
+  // The query objects are (re)initialized when the navmesh was rebuilt since the last batch
+  for (size_t i = 0; i < workerCount; ++i) {
+    if (i == m_batchQueries.size()) {
+      m_batchQueries.emplace_back(dtAllocNavMeshQuery());
+    }
+    auto* query = m_batchQueries[i];
+    if (!query) {
+      return nullptr;
+    }
+    if (query->getAttachedNavMesh() != m_navMesh) {
+      if (dtStatusFailed(query->init(m_navMesh, 2048))) {
+        return nullptr;
+      }
+    }
+  }
+  return m_batchQueries.data();
+}
 
-    if (polys[npolys - 1] != endRef) {
-      m_navQuery->closestPointOnPoly(polys[npolys - 1], &end.x, &closestEnd.x, &posOverPoly);
+void NavMesh::getClosestPoints(const Vec3* positions, size_t count, Vec3* results) const
+{
+  auto& threadPool = ThreadPool::Default();
+  auto* queries    = getBatchQueries(threadPool.workerCount());
+  if (!queries) {
+    std::fill(results, results + count, Vec3(0.f, 0.f, 0.f));
+    return;
+  }
+  threadPool.parallelFor(count, 64, [&](size_t begin, size_t end, size_t workerIndex) {
+    for (size_t i = begin; i < end; ++i) {
+      results[i] = queryClosestPoint(*queries[workerIndex], positions[i], m_defaultQueryExtent);
     }
-    straightPathOptions = 0;
-    m_navQuery->findStraightPath(&posStart.x, &closestEnd.x, polys, npolys, straightPath,
-                                 straightPathFlags, straightPathPolys, &mNstraightPath, MAX_POLYS,
-                                 straightPathOptions);
+  });
+}
 
-    navpath.mPoints.resize(static_cast<size_t>(mNstraightPath));
-    for (size_t i = 0; i < static_cast<size_t>(mNstraightPath); i++) {
-      navpath.mPoints[i]
-        = Vec3(straightPath[i * 3], straightPath[i * 3 + 1], straightPath[i * 3 + 2]);
+void NavMesh::getRandomPointsAround(const Vec3* positions, size_t count, float maxRadius,
+                                    unsigned int seed, Vec3* results) const
+{
+  auto& threadPool = ThreadPool::Default();
+  auto* queries    = getBatchQueries(threadPool.workerCount());
+  if (!queries) {
+    std::fill(results, results + count, Vec3(0.f, 0.f, 0.f));
+    return;
+  }
+  threadPool.parallelFor(count, 64, [&](size_t begin, size_t end, size_t workerIndex) {
+    for (size_t i = begin; i < end; ++i) {
+      g_seed     = static_cast<int>(seed + static_cast<unsigned int>(i) * 2654435761u);
+      results[i] = queryRandomPointAround(*queries[workerIndex], positions[i], maxRadius,
+                                          m_defaultQueryExtent);
     }
+  });
+}
+
+void NavMesh::computePaths(const Vec3* starts, const Vec3* ends, size_t count, Vec3* points,
+                           int maxPointsPerPath, int* pointCounts) const
+{
+  auto& threadPool = ThreadPool::Default();
+  auto* queries    = getBatchQueries(threadPool.workerCount());
+  if (!queries) {
+    std::fill(pointCounts, pointCounts + count, 0);
+    return;
   }
-  return navpath;
+  threadPool.parallelFor(count, 4, [&](size_t begin, size_t end, size_t workerIndex) {
+    for (size_t i = begin; i < end; ++i) {
+      pointCounts[i]
+        = queryPath(*queries[workerIndex], starts[i], ends[i], m_defaultQueryExtent,
+                    points + i * static_cast<size_t>(maxPointsPerPath), maxPointsPerPath);
+    }
+  });
 }
 
 Crowd::Crowd(const int maxAgents, const float maxAgentRadius, dtNavMesh* nav)
@@ -742,6 +1463,23 @@ Vec3 Crowd::getAgentVelocity(int idx)
   return Vec3(agent->vel[0], agent->vel[1], agent->vel[2]);
 }
 
+void Crowd::getAgentStates(const int* indices, size_t count, float* positions, float* velocities,
+                           unsigned char* states)
+{
+  for (size_t i = 0; i < count; ++i) {
+    const dtCrowdAgent* agent = m_crowd->getAgent(indices[i]);
+    if (positions) {
+      dtVcopy(positions + 3 * i, agent->npos);
+    }
+    if (velocities) {
+      dtVcopy(velocities + 3 * i, agent->vel);
+    }
+    if (states) {
+      states[i] = agent->state;
+    }
+  }
+}
+
 void Crowd::agentGoto(int idx, const Vec3& destination)
 {
   dtQueryFilter filter;
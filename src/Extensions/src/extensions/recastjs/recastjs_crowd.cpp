@@ -1,5 +1,7 @@
 #include <babylon/extensions/recastjs/recastjs_crowd.h>
 
+#include <algorithm>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -14,7 +16,7 @@ namespace Extensions {
 
 RecastJSCrowd::RecastJSCrowd(RecastJSPlugin* plugin, size_t maxAgents, float maxAgentRadius,
                              Scene* scene)
-    : ICrowd{}
+    : ICrowd{}, positionEpsilon{1e-4f}, _instanceMatricesEnabled{false}
 {
   bjsRECASTPlugin = plugin;
   recastCrowd     = std::make_unique<Crowd>(static_cast<int>(maxAgents), maxAgentRadius,
@@ -135,12 +137,60 @@ std::vector<int>& RecastJSCrowd::getAgents()
 
 void RecastJSCrowd::update(float deltaTime)
 {
+  // update obstacles
+  bjsRECASTPlugin->updateObstacles();
+
   // update crowd
   recastCrowd->update(deltaTime);
 
-  // update transforms
-  for (size_t index = 0; index < agents.size(); index++) {
-    transforms[index]->position = getAgentPosition(agents[index]);
+  // read back the agent states
+  const auto agentCount = agents.size();
+  agentPositions.resize(3 * agentCount);
+  agentVelocities.resize(3 * agentCount);
+  agentStates.resize(agentCount);
+  recastCrowd->getAgentStates(agents.data(), agentCount, agentPositions.data(),
+                              agentVelocities.data(), agentStates.data());
+
+  // update the transforms of the agents that moved
+  const auto epsilonSquared = positionEpsilon * positionEpsilon;
+  for (size_t index = 0; index < agentCount; ++index) {
+    const auto& transform = transforms[index];
+    if (!transform) {
+      continue;
+    }
+    const auto* agentPosition = &agentPositions[3 * index];
+    const auto& position      = transform->position();
+    const auto dx             = agentPosition[0] - position.x;
+    const auto dy             = agentPosition[1] - position.y;
+    const auto dz             = agentPosition[2] - position.z;
+    if (dx * dx + dy * dy + dz * dz > epsilonSquared) {
+      transform->position = Vector3(agentPosition[0], agentPosition[1], agentPosition[2]);
+    }
+  }
+
+  // update the instance matrices, and notify their upload when they changed
+  if (_instanceMatricesEnabled) {
+    const auto matrixCount = _instanceMatrices.size() / 16;
+    auto changed           = matrixCount != agentCount;
+    if (changed) {
+      _instanceMatrices.resize(16 * agentCount, 0.f);
+      for (size_t index = matrixCount; index < agentCount; ++index) {
+        for (size_t diagonal = 0; diagonal < 16; diagonal += 5) {
+          _instanceMatrices[16 * index + diagonal] = 1.f;
+        }
+      }
+    }
+    for (size_t index = 0; index < agentCount; ++index) {
+      auto* translation         = &_instanceMatrices[16 * index + 12];
+      const auto* agentPosition = &agentPositions[3 * index];
+      if (!std::equal(agentPosition, agentPosition + 3, translation)) {
+        std::copy(agentPosition, agentPosition + 3, translation);
+        changed = true;
+      }
+    }
+    if (changed) {
+      onInstanceMatricesUpdatedObservable.notifyObservers(this);
+    }
   }
 }
 
@@ -162,6 +212,19 @@ void RecastJSCrowd::getDefaultQueryExtentToRef(Vector3& result)
   result.set(p.x, p.y, p.z);
 }
 
+void RecastJSCrowd::setInstanceMatricesEnabled(bool value)
+{
+  _instanceMatricesEnabled = value;
+  if (!value) {
+    _instanceMatrices.clear();
+  }
+}
+
+const Float32Array& RecastJSCrowd::getInstanceMatrices() const
+{
+  return _instanceMatrices;
+}
+
 void RecastJSCrowd::dispose()
 {
   recastCrowd->destroy();
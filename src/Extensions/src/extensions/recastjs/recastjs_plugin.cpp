@@ -42,15 +42,30 @@ void RecastJSPlugin::createNavMesh(const std::vector<MeshPtr>& meshes,
   rc.maxVertsPerPoly        = parameters.maxVertsPerPoly;
   rc.detailSampleDist       = parameters.detailSampleDist;
   rc.detailSampleMaxError   = parameters.detailSampleMaxError;
+  rc.tileSize               = std::max(parameters.tileSize, 0);
 
+  if (navMesh) {
+    navMesh->destroy();
+  }
   navMesh = std::make_unique<NavMesh>();
 
   Int32Array indices;
   Float32Array positions;
-  int offset = 0;
+  const auto vertexCount = _getPositionsAndIndices(meshes, positions, indices);
+
+  navMesh->build(positions.data(), vertexCount, indices.data(), static_cast<int>(indices.size()),
+                 rc);
+}
+
+int RecastJSPlugin::_getPositionsAndIndices(const std::vector<MeshPtr>& meshes,
+                                            Float32Array& positions, Int32Array& indices) const
+{
+  std::vector<std::pair<IndicesArray, Float32Array>> meshesData;
+  size_t indexCount    = 0;
+  size_t positionCount = 0;
   for (const auto& mesh : meshes) {
     if (mesh) {
-      const auto meshIndices = mesh->getIndices();
+      auto meshIndices = mesh->getIndices();
       if (meshIndices.empty()) {
         continue;
       }
@@ -59,25 +74,86 @@ void RecastJSPlugin::createNavMesh(const std::vector<MeshPtr>& meshes,
         continue;
       }
 
-      const auto wm = mesh->computeWorldMatrix(false);
-
-      for (size_t tri = 0; tri < meshIndices.size(); ++tri) {
-        indices.emplace_back(static_cast<int>(meshIndices[tri]) + offset);
-      }
-
+      // Transform the positions in place
+      const auto wm    = mesh->computeWorldMatrix(false);
       auto transformed = Vector3::Zero();
       auto position    = Vector3::Zero();
-      for (unsigned int pt = 0; pt < meshPositions.size(); pt += 3) {
+      for (unsigned int pt = 0; pt + 2 < meshPositions.size(); pt += 3) {
         Vector3::FromArrayToRef(meshPositions, pt, position);
         Vector3::TransformCoordinatesToRef(position, wm, transformed);
-        stl_util::concat(positions, {transformed.x, transformed.y, transformed.z});
+        meshPositions[pt + 0] = transformed.x;
+        meshPositions[pt + 1] = transformed.y;
+        meshPositions[pt + 2] = transformed.z;
       }
 
-      offset += static_cast<int>(meshPositions.size()) / 3;
+      indexCount += meshIndices.size();
+      positionCount += meshPositions.size();
+      meshesData.emplace_back(std::move(meshIndices), std::move(meshPositions));
     }
   }
 
-  navMesh->build(positions.data(), offset, indices.data(), static_cast<int>(indices.size()), rc);
+  indices.clear();
+  indices.reserve(indexCount);
+  positions.clear();
+  positions.reserve(positionCount);
+  int offset = 0;
+  for (const auto& [meshIndices, meshPositions] : meshesData) {
+    for (const auto index : meshIndices) {
+      indices.emplace_back(static_cast<int>(index) + offset);
+    }
+    positions.insert(positions.end(), meshPositions.begin(), meshPositions.end());
+    offset += static_cast<int>(meshPositions.size()) / 3;
+  }
+
+  return offset;
+}
+
+bool RecastJSPlugin::updateNavMesh(const std::vector<MeshPtr>& meshes, const Vector3& boundsMin,
+                                   const Vector3& boundsMax)
+{
+  if (!navMesh || !navMesh->isTiled()) {
+    return false;
+  }
+
+  Int32Array indices;
+  Float32Array positions;
+  const auto vertexCount = _getPositionsAndIndices(meshes, positions, indices);
+
+  return navMesh->updateGeometry(positions.data(), vertexCount, indices.data(),
+                                 static_cast<int>(indices.size()),
+                                 Vec3(boundsMin.x, boundsMin.y, boundsMin.z),
+                                 Vec3(boundsMax.x, boundsMax.y, boundsMax.z));
+}
+
+dtObstacleRef RecastJSPlugin::addCylinderObstacle(const Vector3& position, float radius,
+                                                  float height)
+{
+  if (!navMesh) {
+    return 0;
+  }
+  return navMesh->addCylinderObstacle(Vec3(position.x, position.y, position.z), radius, height);
+}
+
+dtObstacleRef RecastJSPlugin::addBoxObstacle(const Vector3& position, const Vector3& extent,
+                                             float angle)
+{
+  if (!navMesh) {
+    return 0;
+  }
+  return navMesh->addBoxObstacle(Vec3(position.x, position.y, position.z),
+                                 Vec3(extent.x, extent.y, extent.z), angle);
+}
+
+void RecastJSPlugin::removeObstacle(dtObstacleRef obstacle)
+{
+  if (navMesh) {
+    navMesh->removeObstacle(obstacle);
+  }
+}
+
+bool RecastJSPlugin::updateObstacles()
+{
+  return navMesh ? navMesh->update() : true;
 }
 
 MeshPtr RecastJSPlugin::createDebugNavMesh(Scene* scene) const
@@ -167,6 +243,77 @@ std::vector<Vector3> RecastJSPlugin::computePath(const Vector3& start, const Vec
   return positions;
 }
 
+void RecastJSPlugin::getClosestPoints(const std::vector<Vector3>& positions,
+                                      std::vector<Vector3>& results)
+{
+  if (!navMesh) {
+    results.clear();
+    return;
+  }
+  _batchInputs.resize(positions.size());
+  _batchResults.resize(positions.size());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    _batchInputs[i] = Vec3(positions[i].x, positions[i].y, positions[i].z);
+  }
+  navMesh->getClosestPoints(_batchInputs.data(), _batchInputs.size(), _batchResults.data());
+  results.resize(positions.size());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    results[i].set(_batchResults[i].x, _batchResults[i].y, _batchResults[i].z);
+  }
+}
+
+void RecastJSPlugin::getRandomPointsAround(const std::vector<Vector3>& positions, float maxRadius,
+                                           std::vector<Vector3>& results, unsigned int seed)
+{
+  if (!navMesh) {
+    results.clear();
+    return;
+  }
+  _batchInputs.resize(positions.size());
+  _batchResults.resize(positions.size());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    _batchInputs[i] = Vec3(positions[i].x, positions[i].y, positions[i].z);
+  }
+  navMesh->getRandomPointsAround(_batchInputs.data(), _batchInputs.size(), maxRadius, seed,
+                                 _batchResults.data());
+  results.resize(positions.size());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    results[i].set(_batchResults[i].x, _batchResults[i].y, _batchResults[i].z);
+  }
+}
+
+void RecastJSPlugin::computePaths(const std::vector<Vector3>& starts,
+                                  const std::vector<Vector3>& ends, size_t maxPointsPerPath,
+                                  std::vector<Vector3>& points, std::vector<size_t>& pointCounts)
+{
+  if (!navMesh) {
+    points.clear();
+    pointCounts.clear();
+    return;
+  }
+  const auto count = std::min(starts.size(), ends.size());
+  _batchInputs.resize(count);
+  _batchEnds.resize(count);
+  _batchResults.resize(count * maxPointsPerPath);
+  _batchCounts.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    _batchInputs[i] = Vec3(starts[i].x, starts[i].y, starts[i].z);
+    _batchEnds[i]   = Vec3(ends[i].x, ends[i].y, ends[i].z);
+  }
+  navMesh->computePaths(_batchInputs.data(), _batchEnds.data(), count, _batchResults.data(),
+                        static_cast<int>(maxPointsPerPath), _batchCounts.data());
+  points.resize(count * maxPointsPerPath);
+  pointCounts.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    pointCounts[i]    = static_cast<size_t>(_batchCounts[i]);
+    const auto offset = i * maxPointsPerPath;
+    for (size_t pt = 0; pt < pointCounts[i]; ++pt) {
+      const auto& p = _batchResults[offset + pt];
+      points[offset + pt].set(p.x, p.y, p.z);
+    }
+  }
+}
+
 ICrowdPtr RecastJSPlugin::createCrowd(size_t maxAgents, float maxAgentRadius, Scene* scene)
 {
   auto crowd = std::make_shared<RecastJSCrowd>(this, maxAgents, maxAgentRadius, scene);
@@ -195,7 +342,10 @@ void RecastJSPlugin::buildFromNavmeshData(const Uint8Array& data)
   NavmeshData buf{};
   buf.dataPointer = dataStack.data();
   buf.size        = static_cast<int>(data.size());
-  navMesh         = std::make_unique<NavMesh>();
+  if (navMesh) {
+    navMesh->destroy();
+  }
+  navMesh = std::make_unique<NavMesh>();
   navMesh->buildFromNavmeshData(&buf);
 }
 
@@ -217,6 +367,10 @@ void RecastJSPlugin::getDefaultQueryExtentToRef(Vector3& result)
 
 void RecastJSPlugin::dispose()
 {
+  if (navMesh) {
+    navMesh->destroy();
+    navMesh = nullptr;
+  }
 }
 
 bool RecastJSPlugin::isSupported() const
@@ -0,0 +1,212 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/extensions/dynamicterrain/dynamic_terrain.h>
+#include <babylon/extensions/dynamicterrain/dynamic_terrain_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace {
+
+using namespace BABYLON;
+using BABYLON::Extensions::DynamicTerrain;
+using BABYLON::Extensions::DynamicTerrainOptions;
+
+// Bumpy ribbon grid of columns x rows vertices
+Float32Array createRibbon(unsigned int columns, unsigned int rows)
+{
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<float> noise{-2.f, 2.f};
+  Float32Array positions;
+  for (unsigned int j = 0; j < rows; ++j) {
+    for (unsigned int i = 0; i < columns; ++i) {
+      positions.insert(positions.end(), {static_cast<float>(i) * 1.5f, noise(generator),
+                                         static_cast<float>(j) * 0.7f + 0.1f * noise(generator)});
+    }
+  }
+  return positions;
+}
+
+// Bumpy map of subX x subZ points, one unit apart, centered on the origin
+Float32Array createMap(unsigned int subX, unsigned int subZ)
+{
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<float> noise{-2.f, 2.f};
+  Float32Array mapData;
+  for (unsigned int j = 0; j < subZ; ++j) {
+    for (unsigned int i = 0; i < subX; ++i) {
+      mapData.insert(mapData.end(), {static_cast<float>(i) - static_cast<float>(subX) * 0.5f,
+                                     noise(generator),
+                                     static_cast<float>(j) - static_cast<float>(subZ) * 0.5f});
+    }
+  }
+  return mapData;
+}
+
+// Indices of the ribbon grid, as MeshBuilder::CreateRibbon() builds them
+Uint32Array createRibbonIndices(unsigned int columns, unsigned int rows, bool frontSide)
+{
+  Uint32Array indices;
+  for (unsigned int j = 0; j + 1 < rows; ++j) {
+    for (unsigned int i = 0; i + 1 < columns; ++i) {
+      const auto a = j * columns + i, b = a + columns, c = a + 1, d = b + 1;
+      if (frontSide) {
+        indices.insert(indices.end(), {a, b, c, d, c, b});
+      }
+      else {
+        indices.insert(indices.end(), {c, b, a, b, c, d});
+      }
+    }
+  }
+  return indices;
+}
+
+float maxDifference(const Float32Array& array1, const Float32Array& array2)
+{
+  float difference = 0.f;
+  for (size_t i = 0; i < array1.size(); ++i) {
+    difference = std::max(difference, std::abs(array1[i] - array2[i]));
+  }
+  return difference;
+}
+
+// Terrain lifted by its custom vertex function
+class LiftedTerrain : public DynamicTerrain {
+
+public:
+  using DynamicTerrain::DynamicTerrain;
+
+  void updateVertex(Extensions::DynamicTerrainVertex& vertex, unsigned int /*i*/,
+                    unsigned /*j*/) override
+  {
+    vertex.position.y += 100.f;
+  }
+}; // end of class LiftedTerrain
+
+} // end of anonymous namespace
+
+TEST(TestDynamicTerrain, RibbonNormalsMatchVertexDataNormals)
+{
+  for (unsigned int columns : {2u, 3u, 33u}) {
+    for (unsigned int rows : {2u, 5u, 16u}) {
+      for (bool frontSide : {true, false}) {
+        const auto positions = createRibbon(columns, rows);
+        Float32Array expected;
+        VertexData::ComputeNormals(positions, createRibbonIndices(columns, rows, frontSide),
+                                   expected);
+
+        Float32Array normals(positions.size());
+        DynamicTerrain::ComputeRibbonNormalsToRef(positions, columns, rows, 0, rows, 0, columns,
+                                                  frontSide, normals);
+        EXPECT_LT(maxDifference(normals, expected), 1e-5f);
+
+        // Updating the normals by blocks gives the same result
+        Float32Array blockNormals(positions.size());
+        for (unsigned int j = 0; j < rows; j += 2) {
+          for (unsigned int i = 0; i < columns; i += 3) {
+            DynamicTerrain::ComputeRibbonNormalsToRef(positions, columns, rows, j,
+                                                      std::min(rows, j + 2), i,
+                                                      std::min(columns, i + 3), frontSide,
+                                                      blockNormals);
+          }
+        }
+        EXPECT_LT(maxDifference(blockNormals, expected), 1e-5f);
+      }
+    }
+  }
+}
+
+TEST(TestDynamicTerrain, MapNormalsAreUnitVectors)
+{
+  const unsigned int mapSubX = 64, mapSubZ = 48;
+  const auto mapData         = createMap(mapSubX, mapSubZ);
+  Float32Array normals;
+  DynamicTerrain::ComputeNormalsFromMapToRef(mapData, mapSubX, mapSubZ, normals);
+
+  ASSERT_EQ(normals.size(), mapData.size());
+  for (size_t i = 0; i < normals.size(); i += 3) {
+    const auto length = std::sqrt(normals[i] * normals[i] + normals[i + 1] * normals[i + 1]
+                                  + normals[i + 2] * normals[i + 2]);
+    EXPECT_NEAR(length, 1.f, 1e-5f);
+    // The map is rendered from above
+    EXPECT_GT(normals[i + 1], 0.f);
+  }
+}
+
+TEST(TestDynamicTerrain, StripUpdatesMatchFullUpdates)
+{
+  auto engine = NullEngine::New();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 10.f, 0.f), scene.get());
+
+  DynamicTerrainOptions options;
+  options.mapData    = createMap(128, 96);
+  options.mapSubX    = 128;
+  options.mapSubZ    = 96;
+  options.terrainSub = 32;
+  options.camera     = camera;
+  DynamicTerrain terrain("terrain", options, scene.get());
+
+  // Camera moves of one or several subdivisions, wrapping around the map
+  const std::vector<Vector2> moves{{1.6f, 0.f},  {0.f, 0.8f},   {-4.6f, 0.f}, {3.1f, -2.2f},
+                                   {-1.6f, 0.7f}, {30.f, 10.f}, {200.f, 0.f}, {0.f, -70.f}};
+  for (const auto& move : moves) {
+    camera->position().x += move.x;
+    camera->position().z += move.y;
+    camera->getViewMatrix(true);
+    terrain.update(false);
+    const auto positions = terrain.mesh()->getVerticesData(VertexBuffer::PositionKind);
+    const auto normals   = terrain.mesh()->getVerticesData(VertexBuffer::NormalKind);
+    const auto uvs       = terrain.mesh()->getVerticesData(VertexBuffer::UVKind);
+
+    terrain.update(true);
+    EXPECT_LT(maxDifference(positions,
+                            terrain.mesh()->getVerticesData(VertexBuffer::PositionKind)),
+              1e-5f);
+    EXPECT_LT(maxDifference(normals, terrain.mesh()->getVerticesData(VertexBuffer::NormalKind)),
+              1e-5f);
+    EXPECT_LT(maxDifference(uvs, terrain.mesh()->getVerticesData(VertexBuffer::UVKind)), 1e-5f);
+  }
+}
+
+TEST(TestDynamicTerrain, CustomVertexFunctionToggleUpdatesAllVertices)
+{
+  auto engine = NullEngine::New();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 10.f, 0.f), scene.get());
+
+  DynamicTerrainOptions options;
+  options.mapData    = createMap(128, 96);
+  options.mapSubX    = 128;
+  options.mapSubZ    = 96;
+  options.terrainSub = 32;
+  options.camera     = camera;
+  LiftedTerrain terrain("terrain", options, scene.get());
+
+  terrain.useCustomVertexFunction(true);
+  terrain.update(true);
+  const auto lifted = terrain.mesh()->getVerticesData(VertexBuffer::PositionKind);
+  auto minY = lifted[1];
+  for (size_t i = 4; i < lifted.size(); i += 3) {
+    minY = std::min(minY, lifted[i]);
+  }
+  EXPECT_GT(minY, 50.f);
+
+  // Without the custom function, the lifted vertices must not be kept by a ribbon shift
+  terrain.useCustomVertexFunction(false);
+  camera->position().x += 1.6f;
+  camera->getViewMatrix(true);
+  terrain.update(false);
+  const auto positions = terrain.mesh()->getVerticesData(VertexBuffer::PositionKind);
+  terrain.update(true);
+  EXPECT_LT(maxDifference(positions, terrain.mesh()->getVerticesData(VertexBuffer::PositionKind)),
+            1e-5f);
+}
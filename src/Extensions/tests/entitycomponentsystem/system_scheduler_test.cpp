@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#define ANAX_TEST_CASE_BUILD
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/entitycomponentsystem/detail/anax_assert.h>
+#include <babylon/extensions/entitycomponentsystem/entity.h>
+#include <babylon/extensions/entitycomponentsystem/system_scheduler.h>
+#include <babylon/extensions/entitycomponentsystem/world.h>
+
+#include "components.h"
+
+using namespace BABYLON::Extensions::ECS;
+
+namespace {
+
+// Moves the entities, in concurrent ranges
+class ParallelMovementSystem : public System<Requires<PositionComponent, VelocityComponent>> {
+public:
+  ParallelMovementSystem()
+  {
+    reads<VelocityComponent>();
+    writes<PositionComponent>();
+  }
+
+  void updateEntities(std::size_t begin, std::size_t end) override
+  {
+    const auto& entities = getEntities();
+    for (auto i = begin; i < end; ++i) {
+      auto& position = entities[i].getComponent<PositionComponent>();
+      position.x += entities[i].getComponent<VelocityComponent>().x;
+    }
+    rangeCount.fetch_add(1);
+  }
+
+  [[nodiscard]] std::size_t getGrainSize() const override
+  {
+    return 100;
+  }
+
+  std::atomic<std::size_t> rangeCount{0};
+};
+
+// Moves the entities, in concurrent ranges of a view
+class ViewMovementSystem : public System<Requires<PositionComponent, VelocityComponent>> {
+public:
+  ViewMovementSystem()
+  {
+    reads<VelocityComponent>();
+    writes<PositionComponent>();
+  }
+
+  void updateEntities(std::size_t begin, std::size_t end) override
+  {
+    getWorld().view<PositionComponent, VelocityComponent>().each(
+      begin, end, [](PositionComponent& position, const VelocityComponent& velocity) {
+        position.x += velocity.x;
+      });
+  }
+
+  [[nodiscard]] std::size_t getGrainSize() const override
+  {
+    return 100;
+  }
+
+  [[nodiscard]] std::size_t getRangeEnd() const override
+  {
+    return getWorld().view<PositionComponent, VelocityComponent>().extent();
+  }
+};
+
+// Sums the positions, after the movement system
+class PositionSumSystem : public System<Requires<PositionComponent>> {
+public:
+  PositionSumSystem()
+  {
+    reads<PositionComponent>();
+  }
+
+  void update() override
+  {
+    sum = 0.f;
+    for (auto& e : getEntities()) {
+      sum += e.getComponent<PositionComponent>().x;
+    }
+  }
+
+  float sum = 0.f;
+};
+
+// Renames the players, independent from the movement
+class PlayerNameSystem : public System<Requires<PlayerComponent>> {
+public:
+  PlayerNameSystem()
+  {
+    writes<PlayerComponent>();
+  }
+
+  void update() override
+  {
+    for (auto& e : getEntities()) {
+      e.getComponent<PlayerComponent>().name += "!";
+    }
+  }
+};
+
+// Kills the entities moving too far, and spawns a player for each
+class DespawnSystem : public System<Requires<PositionComponent>> {
+public:
+  void update() override
+  {
+    auto& commandBuffer = getWorld().getCommandBuffer();
+    for (auto& e : getEntities()) {
+      if (e.getComponent<PositionComponent>().x > 2.5f) {
+        commandBuffer.killEntity(e);
+        commandBuffer.createEntity([](Entity& player) {
+          player.addComponent<PlayerComponent>().name = "spawned";
+          player.activate();
+        });
+      }
+    }
+  }
+};
+
+} // end of anonymous namespace
+
+TEST(TestSystemScheduler, Stages_follow_the_component_accesses)
+{
+  World world;
+  ParallelMovementSystem movementSystem;
+  PositionSumSystem positionSumSystem;
+  PlayerNameSystem playerNameSystem;
+  DespawnSystem despawnSystem;
+  world.addSystem(movementSystem);
+  world.addSystem(positionSumSystem);
+  world.addSystem(playerNameSystem);
+  world.addSystem(despawnSystem);
+
+  SystemScheduler scheduler{world};
+  scheduler.addSystem(movementSystem);
+  scheduler.addSystem(positionSumSystem);
+  scheduler.addSystem(playerNameSystem);
+  scheduler.addSystem(despawnSystem);
+
+  // The system without declared accesses runs alone, after the others
+  const auto& stages = scheduler.getStages();
+  ASSERT_EQ(stages.size(), 3);
+  EXPECT_EQ(stages[0], (std::vector<detail::BaseSystem*>{&movementSystem, &playerNameSystem}));
+  EXPECT_EQ(stages[1], (std::vector<detail::BaseSystem*>{&positionSumSystem}));
+  EXPECT_EQ(stages[2], (std::vector<detail::BaseSystem*>{&despawnSystem}));
+
+  scheduler.removeSystem(despawnSystem);
+  EXPECT_EQ(scheduler.getStages().size(), 2);
+}
+
+TEST(TestSystemScheduler, Updating_systems_concurrently)
+{
+  BABYLON::ThreadPool threadPool{4};
+
+  World world;
+  ParallelMovementSystem movementSystem;
+  PositionSumSystem positionSumSystem;
+  PlayerNameSystem playerNameSystem;
+  world.addSystem(movementSystem);
+  world.addSystem(positionSumSystem);
+  world.addSystem(playerNameSystem);
+
+  SystemScheduler scheduler{world};
+  scheduler.setThreadPool(&threadPool);
+  scheduler.addSystem(movementSystem);
+  scheduler.addSystem(positionSumSystem);
+  scheduler.addSystem(playerNameSystem);
+
+  std::vector<Entity> players;
+  for (int i = 0; i < 1000; ++i) {
+    auto e                                = world.createEntity();
+    e.addComponent<PositionComponent>().x = 0.f;
+    e.addComponent<VelocityComponent>().x = 1.f;
+    e.activate();
+  }
+  for (int i = 0; i < 10; ++i) {
+    auto e                                 = world.createEntity();
+    e.addComponent<PlayerComponent>().name = "player";
+    e.activate();
+    players.emplace_back(e);
+  }
+
+  scheduler.update();
+  scheduler.update();
+
+  EXPECT_EQ(movementSystem.rangeCount, 20);
+  EXPECT_EQ(positionSumSystem.sum, 2000.f);
+  for (auto& player : players) {
+    EXPECT_EQ(player.getComponent<PlayerComponent>().name, "player!!");
+  }
+}
+
+TEST(TestSystemScheduler, Updating_view_ranges_concurrently)
+{
+  BABYLON::ThreadPool threadPool{4};
+
+  World world;
+  ViewMovementSystem movementSystem;
+  PositionSumSystem positionSumSystem;
+  world.addSystem(movementSystem);
+  world.addSystem(positionSumSystem);
+
+  SystemScheduler scheduler{world};
+  scheduler.setThreadPool(&threadPool);
+  scheduler.addSystem(movementSystem);
+  scheduler.addSystem(positionSumSystem);
+
+  // The walked pool has more components than the system has entities
+  for (int i = 0; i < 1300; ++i) {
+    auto e = world.createEntity();
+    if (i < 1000 || i % 2 == 0) {
+      e.addComponent<PositionComponent>().x = 0.f;
+    }
+    if (i < 1000 || i % 2 == 1) {
+      e.addComponent<VelocityComponent>().x = 1.f;
+    }
+    e.activate();
+  }
+
+  scheduler.update();
+  EXPECT_EQ(movementSystem.getEntities().size(), 1000);
+  EXPECT_EQ(movementSystem.getRangeEnd(), 1150);
+  EXPECT_EQ(positionSumSystem.sum, 1000.f);
+}
+
+TEST(TestSystemScheduler, Applying_structural_changes_at_the_sync_point)
+{
+  World world;
+  ParallelMovementSystem movementSystem;
+  PlayerNameSystem playerNameSystem;
+  DespawnSystem despawnSystem;
+  world.addSystem(movementSystem);
+  world.addSystem(playerNameSystem);
+  world.addSystem(despawnSystem);
+
+  SystemScheduler scheduler{world};
+  scheduler.addSystem(movementSystem);
+  scheduler.addSystem(playerNameSystem);
+  scheduler.addSystem(despawnSystem);
+
+  for (int i = 0; i < 10; ++i) {
+    auto e                                = world.createEntity();
+    e.addComponent<PositionComponent>().x = static_cast<float>(i % 2);
+    e.addComponent<VelocityComponent>().x = 1.f;
+    e.activate();
+  }
+
+  scheduler.update();
+  scheduler.update();
+
+  // The entities starting at 1 were killed on the second update, the
+  // changes being recorded until the next sync point
+  EXPECT_EQ(world.getEntityCount(), 10);
+  EXPECT_EQ(despawnSystem.getEntities().size(), 10);
+  EXPECT_TRUE(playerNameSystem.getEntities().empty());
+
+  scheduler.update();
+
+  EXPECT_EQ(despawnSystem.getEntities().size(), 5);
+  ASSERT_EQ(playerNameSystem.getEntities().size(), 5);
+  for (auto& player : playerNameSystem.getEntities()) {
+    EXPECT_EQ(player.getComponent<PlayerComponent>().name, "spawned!");
+  }
+}
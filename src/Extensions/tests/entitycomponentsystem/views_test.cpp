@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#define ANAX_TEST_CASE_BUILD
+
+#include <babylon/extensions/entitycomponentsystem/detail/anax_assert.h>
+#include <babylon/extensions/entitycomponentsystem/entity.h>
+#include <babylon/extensions/entitycomponentsystem/world.h>
+
+#include "components.h"
+
+using namespace BABYLON::Extensions::ECS;
+
+TEST(TestViews, Iterating_only_activated_entities_with_all_components)
+{
+  World world;
+
+  std::vector<Entity> movingEntities;
+  std::vector<std::size_t> movingIndices;
+  for (int i = 0; i < 10; ++i) {
+    auto e = world.createEntity();
+    e.addComponent<PositionComponent>().x = static_cast<float>(i);
+    if (i % 2 == 0) {
+      e.addComponent<VelocityComponent>().x = 1.f;
+      movingEntities.emplace_back(e);
+      if (i != 4) {
+        movingIndices.emplace_back(e.getId().index);
+      }
+    }
+    if (i != 4) {
+      e.activate();
+    }
+  }
+  world.refresh();
+
+  // Entity 4 is deactivated
+  std::vector<std::size_t> visitedIndices;
+  world.view<PositionComponent, VelocityComponent>().each(
+    [&visitedIndices](Entity e, PositionComponent& position, VelocityComponent& velocity) {
+      position.x += velocity.x;
+      visitedIndices.emplace_back(e.getId().index);
+    });
+
+  std::sort(visitedIndices.begin(), visitedIndices.end());
+  EXPECT_EQ(visitedIndices, movingIndices);
+  EXPECT_EQ((world.view<PositionComponent, VelocityComponent>().size()), 4);
+  EXPECT_EQ(world.view<PositionComponent>().size(), 9);
+
+  // The components were updated in place
+  for (auto& e : movingEntities) {
+    const float offset = e.isActivated() ? 1.f : 0.f;
+    EXPECT_EQ(e.getComponent<PositionComponent>().x, static_cast<float>(e.getId().index) + offset);
+  }
+}
+
+TEST(TestViews, Removing_components_keeps_the_pools_dense)
+{
+  World world;
+
+  std::vector<Entity> entities;
+  for (int i = 0; i < 3000; ++i) {
+    auto e = world.createEntity();
+    e.addComponent<PositionComponent>().x = static_cast<float>(i);
+    e.activate();
+    entities.emplace_back(e);
+  }
+  world.refresh();
+
+  for (std::size_t i = 0; i < entities.size(); i += 3) {
+    entities[i].removeComponent<PositionComponent>();
+  }
+  entities[1].kill();
+  world.refresh();
+
+  EXPECT_EQ(world.view<PositionComponent>().size(), 1999);
+  for (std::size_t i = 2; i < entities.size(); ++i) {
+    if (i % 3 != 0) {
+      ASSERT_TRUE(entities[i].hasComponent<PositionComponent>());
+      EXPECT_EQ(entities[i].getComponent<PositionComponent>().x, static_cast<float>(i));
+    }
+  }
+}
+
+TEST(TestViews, Component_references_stay_valid_when_adding_components)
+{
+  World world;
+
+  auto first     = world.createEntity();
+  auto& position = first.addComponent<PositionComponent>();
+  position.x     = 42.f;
+
+  for (int i = 0; i < 5000; ++i) {
+    world.createEntity().addComponent<PositionComponent>();
+  }
+
+  EXPECT_EQ(&position, &first.getComponent<PositionComponent>());
+  EXPECT_EQ(position.x, 42.f);
+}
+
+TEST(TestViews, Replacing_a_component)
+{
+  World world;
+
+  auto e                                 = world.createEntity();
+  e.addComponent<PlayerComponent>().name = "Bob";
+  e.addComponent<PlayerComponent>().name = "Alice";
+  e.activate();
+  world.refresh();
+
+  EXPECT_EQ(world.view<PlayerComponent>().size(), 1);
+  EXPECT_EQ(e.getComponent<PlayerComponent>().name, "Alice");
+
+  e.removeAllComponents();
+  EXPECT_EQ(world.view<PlayerComponent>().size(), 0);
+  EXPECT_FALSE(e.hasComponent<PlayerComponent>());
+}
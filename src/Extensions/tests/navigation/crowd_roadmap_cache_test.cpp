@@ -0,0 +1,114 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <map>
+
+#include <babylon/extensions/navigation/crowd_roadmap_cache.h>
+#include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
+
+namespace {
+
+using namespace BABYLON::Extensions;
+
+void addBoxObstacle(RVO2::RVOSimulator& sim, float minX, float minY, float maxX, float maxY)
+{
+  sim.addObstacle({RVO2::Vector2(maxX, maxY), RVO2::Vector2(minX, maxY),
+                   RVO2::Vector2(minX, minY), RVO2::Vector2(maxX, minY)});
+}
+
+CrowdRoadmap createRoadmap(const RVO2::Vector2& goal, size_t gridSize, float spacing)
+{
+  CrowdRoadmap roadmap(1);
+  roadmap[0].position = goal;
+  for (size_t x = 0; x < gridSize; ++x) {
+    for (size_t y = 0; y < gridSize; ++y) {
+      CrowdRoadmapVertex vertex;
+      vertex.position = RVO2::Vector2(static_cast<float>(x) * spacing - 50.f,
+                                      static_cast<float>(y) * spacing - 50.f + 0.5f);
+      roadmap.emplace_back(vertex);
+    }
+  }
+  return roadmap;
+}
+
+// Roadmap computation as done per agent before the roadmaps were shared
+std::vector<float> referenceDistances(const RVO2::RVOSimulator& sim, CrowdRoadmap roadmap,
+                                      float radius)
+{
+  for (size_t i = 0; i < roadmap.size(); ++i) {
+    for (size_t j = 0; j < roadmap.size(); ++j) {
+      if (sim.queryVisibility(roadmap[i].position, roadmap[j].position, radius)) {
+        roadmap[i].neighbors.push_back(static_cast<uint32_t>(j));
+      }
+    }
+  }
+  std::vector<float> distances(roadmap.size(), 9e9f);
+  std::multimap<float, uint32_t> Q;
+  distances[0] = 0.f;
+  Q.emplace(0.f, 0);
+  while (!Q.empty()) {
+    const auto [d, u] = *Q.begin();
+    Q.erase(Q.begin());
+    if (d > distances[u]) {
+      continue;
+    }
+    for (auto v : roadmap[u].neighbors) {
+      const float dist = distances[u] + RVO2::abs(roadmap[v].position - roadmap[u].position);
+      if (dist < distances[v]) {
+        distances[v] = dist;
+        Q.emplace(dist, v);
+      }
+    }
+  }
+  return distances;
+}
+
+} // end of anonymous namespace
+
+TEST(TestCrowdRoadmapCache, SharedRoadmapsMatchPerAgentRoadmaps)
+{
+  RVO2::RVOSimulator sim;
+  addBoxObstacle(sim, -30.f, -30.f, -10.f, 20.f);
+  addBoxObstacle(sim, 10.f, -20.f, 30.f, 30.f);
+  sim.processObstacles();
+
+  const std::vector<RVO2::Vector2> goals{RVO2::Vector2(40.f, 40.f), RVO2::Vector2(-40.f, 40.f),
+                                         RVO2::Vector2(0.f, -45.f)};
+  std::vector<CrowdRoadmap> agentRoadmaps;
+  std::vector<float> radiuses;
+  for (size_t i = 0; i < 30; ++i) {
+    agentRoadmaps.emplace_back(createRoadmap(goals[i % goals.size()], 12, 9.f));
+    radiuses.emplace_back(i < 20 ? 2.f : 4.f);
+  }
+
+  std::vector<CrowdRoadmapCache::Request> requests;
+  for (size_t i = 0; i < agentRoadmaps.size(); ++i) {
+    requests.push_back({&agentRoadmaps[i], radiuses[i]});
+  }
+
+  CrowdRoadmapCache cache{&sim};
+  std::vector<CrowdRoadmapPtr> roadmaps;
+  cache.computeRoadmaps(requests, roadmaps);
+  ASSERT_EQ(roadmaps.size(), requests.size());
+  EXPECT_EQ(cache.roadmapClassCount(), 2ull);
+  EXPECT_EQ(cache.roadmapCount(), 6ull);
+
+  for (size_t i = 0; i < requests.size(); ++i) {
+    // Agents with the same goal and radius share their roadmap
+    EXPECT_EQ(roadmaps[i], roadmaps[i % 3 + (i < 20 ? 0 : 21)]);
+
+    const auto expected = referenceDistances(sim, agentRoadmaps[i], radiuses[i]);
+    const auto& roadmap = *roadmaps[i];
+    ASSERT_EQ(roadmap.size(), expected.size());
+    for (size_t v = 0; v < roadmap.size(); ++v) {
+      EXPECT_TRUE(roadmap[v].position == agentRoadmaps[i][v].position);
+      EXPECT_NEAR(roadmap[v].distToGoal[0], expected[v], 1e-2f);
+    }
+  }
+
+  // Computing again reuses the cached roadmaps
+  std::vector<CrowdRoadmapPtr> roadmaps2;
+  cache.computeRoadmaps(requests, roadmaps2);
+  EXPECT_EQ(roadmaps, roadmaps2);
+  EXPECT_EQ(cache.roadmapCount(), 6ull);
+}
@@ -0,0 +1,120 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
+
+namespace {
+
+using namespace BABYLON::Extensions;
+
+// Agents on a circle crossing to the opposite side, around a box obstacle
+void createScene(RVO2::RVOSimulator& sim, size_t agentCount)
+{
+  sim.setTimeStep(0.25f);
+  sim.setAgentDefaults(15.f, 10, 10.f, 10.f, 1.5f, 2.f);
+  sim.addObstacle({RVO2::Vector2(5.f, 5.f), RVO2::Vector2(-5.f, 5.f), RVO2::Vector2(-5.f, -5.f),
+                   RVO2::Vector2(5.f, -5.f)});
+  sim.processObstacles();
+  for (size_t i = 0; i < agentCount; ++i) {
+    const float angle = static_cast<float>(i) * 2.f * 3.14159265f / static_cast<float>(agentCount);
+    sim.addAgent(RVO2::Vector2(100.f * std::cos(angle), 100.f * std::sin(angle)));
+  }
+}
+
+void setPreferredVelocities(RVO2::RVOSimulator& sim, const std::vector<RVO2::Vector2>& goals)
+{
+  for (size_t i = 0; i < sim.getNumAgents(); ++i) {
+    auto goalVector = goals[i] - sim.getAgentPosition(i);
+    if (RVO2::absSq(goalVector) > 1.f) {
+      goalVector = RVO2::normalize(goalVector);
+    }
+    sim.setAgentPrefVelocity(i, goalVector);
+  }
+}
+
+std::vector<RVO2::Vector2> simulate(BABYLON::ThreadPool& threadPool, size_t agentCount,
+                                    size_t stepCount)
+{
+  RVO2::RVOSimulator sim;
+  sim.setThreadPool(&threadPool);
+  createScene(sim, agentCount);
+  std::vector<RVO2::Vector2> goals;
+  for (size_t i = 0; i < sim.getNumAgents(); ++i) {
+    goals.emplace_back(-sim.getAgentPosition(i));
+  }
+
+  for (size_t step = 0; step < stepCount; ++step) {
+    setPreferredVelocities(sim, goals);
+    sim.doStep();
+  }
+
+  std::vector<RVO2::Vector2> positions;
+  for (size_t i = 0; i < sim.getNumAgents(); ++i) {
+    positions.emplace_back(sim.getAgentPosition(i));
+  }
+  return positions;
+}
+
+} // end of anonymous namespace
+
+TEST(TestRVOSimulator, DeterministicAcrossThreadCounts)
+{
+  BABYLON::ThreadPool singleThreadPool{1};
+  BABYLON::ThreadPool multiThreadPool{4};
+
+  const auto expected = simulate(singleThreadPool, 500, 200);
+  const auto actual   = simulate(multiThreadPool, 500, 200);
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(actual[i].x(), expected[i].x());
+    EXPECT_EQ(actual[i].y(), expected[i].y());
+  }
+
+  // The agents went around the obstacle
+  for (const auto& position : actual) {
+    EXPECT_FALSE(std::abs(position.x()) < 5.f && std::abs(position.y()) < 5.f);
+  }
+}
+
+TEST(TestRVOSimulator, AgentNeighborsAreTheNearestAgents)
+{
+  RVO2::RVOSimulator sim;
+  createScene(sim, 300);
+  // Clusters of agents, and some agents without neighbors in range. The agents do not move.
+  for (size_t i = 0; i < 300; ++i) {
+    sim.setAgentMaxSpeed(i, 0.f);
+    const auto f = static_cast<float>(i);
+    sim.setAgentPosition(i, RVO2::Vector2(std::fmod(f * 7.31f, 40.f) + (i % 3 == 0 ? 200.f : 0.f),
+                                          std::fmod(f * 3.17f, 25.f) * (i % 5 == 0 ? 9.f : 1.f)));
+  }
+  sim.setAgentMaxNeighbors(0, 0);
+  sim.setAgentNeighborDist(1, 40.f);
+  sim.doStep();
+
+  std::vector<RVO2::Vector2> positions;
+  for (size_t i = 0; i < sim.getNumAgents(); ++i) {
+    positions.emplace_back(sim.getAgentPosition(i));
+  }
+
+  for (size_t i = 0; i < sim.getNumAgents(); ++i) {
+    std::vector<float> distances;
+    for (size_t j = 0; j < sim.getNumAgents(); ++j) {
+      const float distSq = RVO2::absSq(positions[i] - positions[j]);
+      if (j != i && distSq < sim.getAgentNeighborDist(i) * sim.getAgentNeighborDist(i)) {
+        distances.emplace_back(distSq);
+      }
+    }
+    std::sort(distances.begin(), distances.end());
+    distances.resize(std::min(distances.size(), sim.getAgentMaxNeighbors(i)));
+
+    ASSERT_EQ(sim.getAgentNumAgentNeighbors(i), distances.size()) << "agent " << i;
+    for (size_t n = 0; n < distances.size(); ++n) {
+      const auto neighbor = sim.getAgentAgentNeighbor(i, n);
+      EXPECT_EQ(RVO2::absSq(positions[i] - positions[neighbor]), distances[n]);
+    }
+  }
+}
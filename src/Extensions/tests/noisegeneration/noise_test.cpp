@@ -0,0 +1,117 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/noisegeneration/perlin_noise.h>
+#include <babylon/extensions/noisegeneration/simplex_noise.h>
+#include <babylon/maths/vector2.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+using namespace BABYLON;
+using BABYLON::Extensions::PerlinNoise;
+using BABYLON::Extensions::SimplexNoise;
+
+// Random coordinates, on both sides of the origin and across the permutation table wrapping
+template <typename T>
+std::vector<T> createCoordinates(size_t count, unsigned int seed)
+{
+  std::mt19937 generator{seed};
+  std::uniform_real_distribution<T> distribution{T(-300), T(300)};
+  std::vector<T> coordinates(count);
+  for (auto& coordinate : coordinates) {
+    coordinate = distribution(generator);
+  }
+  return coordinates;
+}
+
+} // end of anonymous namespace
+
+TEST(TestNoise, SimplexBatchesMatchScalarNoise)
+{
+  const size_t count = 1001;
+  const auto x       = createCoordinates<float>(count, 1);
+  const auto y       = createCoordinates<float>(count, 2);
+  const auto z       = createCoordinates<float>(count, 3);
+
+  SimplexNoise simplexNoise;
+  simplexNoise.seed(7);
+  Float32Array noise2(count), noise3(count);
+  simplexNoise.noise(x.data(), y.data(), count, noise2.data());
+  simplexNoise.noise(x.data(), y.data(), z.data(), count, noise3.data());
+  for (size_t i = 0; i < count; ++i) {
+    EXPECT_NEAR(noise2[i], simplexNoise.noise(Vector2(x[i], y[i])), 1e-5f);
+    EXPECT_NEAR(noise3[i], simplexNoise.noise(Vector3(x[i], y[i], z[i])), 1e-5f);
+  }
+}
+
+TEST(TestNoise, SimplexGridsMatchScalarNoise)
+{
+  ThreadPool threadPool{3};
+  SimplexNoise simplexNoise;
+  simplexNoise.setThreadPool(&threadPool);
+
+  // More columns than a kernel block
+  const size_t columns = 300, rows = 7, layers = 3;
+  const float step     = 0.37f;
+  const Vector3 origin(-41.3f, 12.1f, -3.4f);
+
+  Float32Array grid2, grid3, fBm;
+  simplexNoise.noiseGrid(Vector2(origin.x, origin.y), step, columns, rows, grid2);
+  simplexNoise.noiseGrid(origin, step, columns, rows, layers, grid3);
+  simplexNoise.fBmGrid(Vector2(origin.x, origin.y), step, columns, rows, fBm, 5, 2.0f, 0.5f);
+  ASSERT_EQ(grid2.size(), columns * rows);
+  ASSERT_EQ(grid3.size(), columns * rows * layers);
+  ASSERT_EQ(fBm.size(), columns * rows);
+
+  for (size_t layer = 0; layer < layers; ++layer) {
+    for (size_t row = 0; row < rows; ++row) {
+      for (size_t column = 0; column < columns; ++column) {
+        const Vector3 point(origin.x + step * static_cast<float>(column),
+                            origin.y + step * static_cast<float>(row),
+                            origin.z + step * static_cast<float>(layer));
+        const auto index = (layer * rows + row) * columns + column;
+        EXPECT_NEAR(grid3[index], simplexNoise.noise(point), 1e-5f);
+        if (layer == 0) {
+          const Vector2 point2(point.x, point.y);
+          EXPECT_NEAR(grid2[index], simplexNoise.noise(point2), 1e-5f);
+          EXPECT_NEAR(fBm[index], simplexNoise.fBm(point2, 5, 2.0f, 0.5f), 1e-5f);
+        }
+      }
+    }
+  }
+}
+
+TEST(TestNoise, PerlinBatchesMatchScalarNoise)
+{
+  const size_t count = 1001;
+  const auto x       = createCoordinates<double>(count, 4);
+  const auto y       = createCoordinates<double>(count, 5);
+  const auto z       = createCoordinates<double>(count, 6);
+
+  ThreadPool threadPool{3};
+  PerlinNoise perlinNoise{42};
+  perlinNoise.setThreadPool(&threadPool);
+  Float64Array noise(count);
+  perlinNoise.noise(x.data(), y.data(), z.data(), count, noise.data());
+  for (size_t i = 0; i < count; ++i) {
+    EXPECT_NEAR(noise[i], perlinNoise.noise(x[i], y[i], z[i]), 1e-12);
+  }
+
+  // Integer coordinates are the floor edge cases
+  const size_t columns = 300, rows = 5;
+  Float64Array grid;
+  perlinNoise.noiseGrid(-150.0, -2.0, 0.5, 1.0, columns, rows, grid);
+  ASSERT_EQ(grid.size(), columns * rows);
+  for (size_t row = 0; row < rows; ++row) {
+    for (size_t column = 0; column < columns; ++column) {
+      EXPECT_NEAR(grid[row * columns + column],
+                  perlinNoise.noise(-150.0 + static_cast<double>(column),
+                                    -2.0 + static_cast<double>(row), 0.5),
+                  1e-12);
+    }
+  }
+}
@@ -1,8 +1,97 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <random>
+
+#include <babylon/extensions/pathfinding/hierarchical_path_finder.h>
 #include <babylon/extensions/pathfinding/rectangular_maze.h>
 
+namespace {
+
+using BABYLON::Extensions::GridDirection;
+using BABYLON::Extensions::RectangularMaze;
+
+// Empty grid with random walls, closed in one direction only if oneWay is set
+RectangularMaze createGrid(std::size_t rows, std::size_t columns, unsigned int seed, bool oneWay)
+{
+  RectangularMaze maze(rows, columns);
+  maze.generateEmptyGrid();
+  std::mt19937 generator{seed};
+  std::uniform_int_distribution<std::size_t> cells{0, maze.size() - 1};
+  std::uniform_int_distribution<int> sides{0, 3};
+  for (std::size_t i = 0; i < maze.size() / 3; ++i) {
+    const auto cellId = cells(generator);
+    const auto row    = cellId / columns;
+    const auto col    = cellId % columns;
+    switch (sides(generator)) {
+      case 0:
+        maze.cell(cellId).leftOpen = false;
+        if (!oneWay && col > 0) {
+          maze.cell(row, col - 1).rightOpen = false;
+        }
+        break;
+      case 1:
+        maze.cell(cellId).rightOpen = false;
+        if (!oneWay && col + 1 < columns) {
+          maze.cell(row, col + 1).leftOpen = false;
+        }
+        break;
+      case 2:
+        maze.cell(cellId).upOpen = false;
+        if (!oneWay && row > 0) {
+          maze.cell(row - 1, col).downOpen = false;
+        }
+        break;
+      default:
+        maze.cell(cellId).downOpen = false;
+        if (!oneWay && row + 1 < rows) {
+          maze.cell(row + 1, col).upOpen = false;
+        }
+        break;
+    }
+  }
+  for (std::size_t i = 0; i < maze.size(); ++i) {
+    maze.cell(i).id = i;
+  }
+  return maze;
+}
+
+// Number of moves of the shortest path, found with a breadth first search
+std::size_t shortestDistance(const RectangularMaze& maze, std::size_t start, std::size_t goal)
+{
+  std::vector<std::size_t> distances(maze.size(), std::numeric_limits<std::size_t>::max());
+  std::vector<std::size_t> queue{start};
+  distances[start] = 0;
+  for (std::size_t head = 0; head < queue.size(); ++head) {
+    const auto cellId = queue[head];
+    maze.forEachNeighbor(cellId, [&](const BABYLON::Extensions::Cell& next) {
+      if (distances[next.id] == std::numeric_limits<std::size_t>::max()) {
+        distances[next.id] = distances[cellId] + 1;
+        queue.emplace_back(next.id);
+      }
+    });
+  }
+  return distances[goal];
+}
+
+// Whether each move of the path is allowed
+bool isValidPath(const RectangularMaze& maze, const std::vector<std::size_t>& path)
+{
+  for (std::size_t i = 1; i < path.size(); ++i) {
+    bool isNeighbor = false;
+    maze.forEachNeighbor(path[i - 1], [&](const BABYLON::Extensions::Cell& next) {
+      isNeighbor = isNeighbor || next.id == path[i];
+    });
+    if (!isNeighbor) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // end of anonymous namespace
+
 TEST(TestPathFinding, WithoutCosts)
 {
   using namespace BABYLON::Extensions;
@@ -59,3 +148,88 @@ TEST(TestPathFinding, WithCosts)
     EXPECT_EQ(y1, y2);
   }
 }
+
+TEST(TestPathFinding, SearchContextReuse)
+{
+  using namespace BABYLON::Extensions;
+
+  auto maze = createGrid(30, 30, 1, false);
+  AStarContext<std::size_t> context;
+  std::vector<std::size_t> firstPath, secondPath, path;
+
+  AStarSearch(maze, maze.cell(0), maze.cell(899), context, firstPath);
+  AStarSearch(maze, maze.cell(31), maze.cell(500), context, secondPath);
+  AStarSearch(maze, maze.cell(0), maze.cell(899), context, path);
+  EXPECT_EQ(path, firstPath);
+  EXPECT_EQ(AStarSearch(maze, maze.cell(31), maze.cell(500)), secondPath);
+  EXPECT_TRUE(isValidPath(maze, firstPath));
+  EXPECT_TRUE(isValidPath(maze, secondPath));
+}
+
+TEST(TestPathFinding, JumpPointSearchFindsShortestPaths)
+{
+  using namespace BABYLON::Extensions;
+
+  AStarContext<std::size_t> context;
+  std::vector<std::size_t> path;
+  for (unsigned int seed = 0; seed < 20; ++seed) {
+    const auto maze = createGrid(40, 30, seed, seed % 2 == 0);
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<std::size_t> cells{0, maze.size() - 1};
+    for (int query = 0; query < 20; ++query) {
+      const auto start    = cells(generator);
+      const auto goal     = cells(generator);
+      const auto distance = shortestDistance(maze, start, goal);
+      const auto found    = JumpPointSearch(maze, start, goal, context, path);
+      ASSERT_EQ(found, distance != std::numeric_limits<std::size_t>::max());
+      if (found) {
+        ASSERT_EQ(path.size(), distance + 1) << "seed " << seed << " query " << query;
+        EXPECT_EQ(path.front(), start);
+        EXPECT_EQ(path.back(), goal);
+        EXPECT_TRUE(isValidPath(maze, path));
+      }
+    }
+  }
+}
+
+TEST(TestPathFinding, HierarchicalPathFinderFindsPaths)
+{
+  using namespace BABYLON::Extensions;
+
+  std::vector<std::size_t> path;
+  for (unsigned int seed = 0; seed < 10; ++seed) {
+    auto maze = createGrid(64, 50, seed, false);
+    HierarchicalPathFinder<RectangularMaze> pathFinder{maze, 8};
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<std::size_t> cells{0, maze.size() - 1};
+
+    const auto checkQueries = [&]() {
+      for (int query = 0; query < 20; ++query) {
+        const auto start    = cells(generator);
+        const auto goal     = cells(generator);
+        const auto distance = shortestDistance(maze, start, goal);
+        const auto found    = pathFinder.findPath(start, goal, path);
+        ASSERT_EQ(found, distance != std::numeric_limits<std::size_t>::max());
+        if (found) {
+          ASSERT_GE(path.size(), distance + 1);
+          EXPECT_EQ(path.front(), start);
+          EXPECT_EQ(path.back(), goal);
+          EXPECT_TRUE(isValidPath(maze, path)) << "seed " << seed << " query " << query;
+        }
+      }
+    };
+    checkQueries();
+
+    // Wall off a band of cells, across several clusters
+    for (std::size_t row = 20; row < 45; ++row) {
+      for (std::size_t col = 10; col < 13; ++col) {
+        maze.cell(row, col).leftOpen = maze.cell(row, col).rightOpen = false;
+        maze.cell(row, col - 1).rightOpen = maze.cell(row, col + 1).leftOpen = false;
+        pathFinder.updateCell(row, col);
+        pathFinder.updateCell(row, col - 1);
+        pathFinder.updateCell(row, col + 1);
+      }
+    }
+    checkQueries();
+  }
+}
@@ -0,0 +1,150 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/extensions/recastjs/recastjs.h>
+#include <babylon/extensions/recastjs/recastjs_crowd.h>
+#include <babylon/extensions/recastjs/recastjs_plugin.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/transform_node.h>
+#include <babylon/navigation/iagent_parameters.h>
+
+#include "Recast.h"
+
+namespace {
+
+using namespace BABYLON;
+using BABYLON::Extensions::NavMesh;
+using BABYLON::Extensions::RecastJSCrowd;
+using BABYLON::Extensions::RecastJSPlugin;
+
+// Flat square ground navmesh, made of size x size quads of 1 unit, centered on the origin
+std::unique_ptr<NavMesh> createGroundNavMesh(int size)
+{
+  std::vector<float> positions;
+  std::vector<int> indices;
+  const float half = static_cast<float>(size) * 0.5f;
+  for (int z = 0; z <= size; ++z) {
+    for (int x = 0; x <= size; ++x) {
+      positions.insert(positions.end(),
+                       {static_cast<float>(x) - half, 0.f, static_cast<float>(z) - half});
+    }
+  }
+  for (int z = 0; z < size; ++z) {
+    for (int x = 0; x < size; ++x) {
+      const int i0 = z * (size + 1) + x;
+      const int i2 = i0 + size + 1;
+      indices.insert(indices.end(), {i0, i0 + 1, i2, i0 + 1, i2 + 1, i2});
+    }
+  }
+
+  rcConfig config;
+  memset(&config, 0, sizeof(config));
+  config.cs                     = 0.2f;
+  config.ch                     = 0.2f;
+  config.walkableSlopeAngle     = 90.f;
+  config.walkableHeight         = 1;
+  config.walkableClimb          = 1;
+  config.walkableRadius         = 1;
+  config.maxEdgeLen             = 12;
+  config.maxSimplificationError = 1.3f;
+  config.minRegionArea          = 8;
+  config.mergeRegionArea        = 20;
+  config.maxVertsPerPoly        = 6;
+  config.detailSampleDist       = 6.f;
+  config.detailSampleMaxError   = 1.f;
+
+  auto navMesh = std::make_unique<NavMesh>();
+  navMesh->build(positions.data(), static_cast<int>(positions.size() / 3), indices.data(),
+                 static_cast<int>(indices.size()), config);
+  return navMesh;
+}
+
+} // end of anonymous namespace
+
+TEST(TestRecastJSCrowd, UpdateReadsBackAgentStates)
+{
+  auto engine = NullEngine::New();
+  auto scene  = Scene::New(engine.get());
+
+  RecastJSPlugin plugin;
+  plugin.navMesh = createGroundNavMesh(20);
+  RecastJSCrowd crowd(&plugin, 16, 1.f, scene.get());
+
+  IAgentParameters parameters;
+  parameters.radius                = 0.5f;
+  parameters.height                = 1.f;
+  parameters.maxAcceleration       = 8.f;
+  parameters.maxSpeed              = 2.f;
+  parameters.collisionQueryRange   = 2.f;
+  parameters.pathOptimizationRange = 5.f;
+  parameters.separationWeight      = 1.f;
+
+  // The last agent has no transform, it is only rendered from the instance matrices
+  const std::vector<Vector3> starts{{-5.f, 0.f, -5.f}, {5.f, 0.f, -5.f}, {8.f, 0.f, 8.f},
+                                    {-5.f, 0.f, 5.f}};
+  std::vector<TransformNodePtr> transforms;
+  for (size_t i = 0; i < starts.size(); ++i) {
+    transforms.emplace_back(i + 1 < starts.size() ? TransformNode::New("agent", scene.get()) :
+                                                    nullptr);
+    crowd.addAgent(starts[i], parameters, transforms.back());
+  }
+  crowd.setInstanceMatricesEnabled(true);
+  size_t uploadCount = 0;
+  crowd.onInstanceMatricesUpdatedObservable.add(
+    [&uploadCount](RecastJSCrowd* /*crowd*/, EventState& /*es*/) { ++uploadCount; });
+
+  // The third agent stays idle
+  crowd.agentGoto(crowd.agents[0], Vector3(5.f, 0.f, 5.f));
+  crowd.agentGoto(crowd.agents[1], Vector3(-5.f, 0.f, 5.f));
+  crowd.agentGoto(crowd.agents[3], Vector3(5.f, 0.f, -5.f));
+  crowd.update(0.1f);
+  auto& idlePosition = transforms[2]->position();
+  idlePosition.x += 0.5f * crowd.positionEpsilon;
+  const auto idleX = idlePosition.x;
+
+  for (int frame = 0; frame < 20; ++frame) {
+    crowd.update(0.1f);
+    ASSERT_EQ(crowd.agentPositions.size(), 3 * starts.size());
+    ASSERT_EQ(crowd.agentVelocities.size(), 3 * starts.size());
+    ASSERT_EQ(crowd.agentStates.size(), starts.size());
+    for (size_t i = 0; i < starts.size(); ++i) {
+      const auto position = crowd.getAgentPosition(crowd.agents[i]);
+      const auto velocity = crowd.getAgentVelocity(crowd.agents[i]);
+      EXPECT_EQ(crowd.agentPositions[3 * i], position.x);
+      EXPECT_EQ(crowd.agentPositions[3 * i + 1], position.y);
+      EXPECT_EQ(crowd.agentPositions[3 * i + 2], position.z);
+      EXPECT_EQ(crowd.agentVelocities[3 * i], velocity.x);
+      EXPECT_EQ(crowd.agentVelocities[3 * i + 1], velocity.y);
+      EXPECT_EQ(crowd.agentVelocities[3 * i + 2], velocity.z);
+      EXPECT_EQ(crowd.agentStates[i], DT_CROWDAGENT_STATE_WALKING);
+      const auto& matrices = crowd.getInstanceMatrices();
+      ASSERT_EQ(matrices.size(), 16 * starts.size());
+      EXPECT_EQ(matrices[16 * i], 1.f);
+      EXPECT_EQ(matrices[16 * i + 1], 0.f);
+      EXPECT_EQ(matrices[16 * i + 15], 1.f);
+      EXPECT_EQ(matrices[16 * i + 12], position.x);
+      EXPECT_EQ(matrices[16 * i + 13], position.y);
+      EXPECT_EQ(matrices[16 * i + 14], position.z);
+      if (transforms[i]) {
+        EXPECT_TRUE(transforms[i]->position().equalsWithEpsilon(position, crowd.positionEpsilon));
+      }
+    }
+    // The idle transform is left untouched
+    EXPECT_EQ(transforms[2]->position().x, idleX);
+  }
+
+  // The moving agents changed the matrices at each update
+  EXPECT_EQ(uploadCount, 21u);
+  crowd.setInstanceMatricesEnabled(false);
+  EXPECT_TRUE(crowd.getInstanceMatrices().empty());
+
+  // The moving agents went towards their destination
+  EXPECT_GT(crowd.agentPositions[0], starts[0].x + 1.f);
+  EXPECT_LT(crowd.agentPositions[3], starts[1].x - 1.f);
+  EXPECT_GT(crowd.agentPositions[9], starts[3].x + 1.f);
+}
@@ -0,0 +1,360 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <babylon/extensions/recastjs/recastjs.h>
+#include <babylon/extensions/recastjs/recastjs_plugin.h>
+#include <babylon/maths/vector3.h>
+
+#include "Recast.h"
+
+namespace {
+
+using BABYLON::Extensions::NavMesh;
+using BABYLON::Extensions::Vec3;
+
+// Flat square ground, made of size x size quads of 1 unit, centered on the origin
+void createGround(int size, std::vector<float>& positions, std::vector<int>& indices,
+                  float maxX = 1e6f)
+{
+  positions.clear();
+  indices.clear();
+  const float half = static_cast<float>(size) * 0.5f;
+  for (int z = 0; z <= size; ++z) {
+    for (int x = 0; x <= size; ++x) {
+      positions.insert(positions.end(),
+                       {std::min(static_cast<float>(x) - half, maxX), 0.f,
+                        static_cast<float>(z) - half});
+    }
+  }
+  for (int z = 0; z < size; ++z) {
+    for (int x = 0; x < size; ++x) {
+      const int i0 = z * (size + 1) + x;
+      const int i1 = i0 + 1;
+      const int i2 = i0 + size + 1;
+      const int i3 = i2 + 1;
+      indices.insert(indices.end(), {i0, i1, i2, i1, i3, i2});
+    }
+  }
+}
+
+rcConfig createConfig(int tileSize)
+{
+  rcConfig config;
+  memset(&config, 0, sizeof(config));
+  config.cs                     = 0.2f;
+  config.ch                     = 0.2f;
+  config.walkableSlopeAngle     = 90.f;
+  config.walkableHeight         = 1;
+  config.walkableClimb          = 1;
+  config.walkableRadius         = 1;
+  config.maxEdgeLen             = 12;
+  config.maxSimplificationError = 1.3f;
+  config.minRegionArea          = 8;
+  config.mergeRegionArea        = 20;
+  config.maxVertsPerPoly        = 6;
+  config.detailSampleDist       = 6.f;
+  config.detailSampleMaxError   = 1.f;
+  config.tileSize               = tileSize;
+  return config;
+}
+
+int countTiles(NavMesh& navMesh)
+{
+  int count           = 0;
+  const dtNavMesh* nm = navMesh.getNavMesh();
+  for (int i = 0; i < nm->getMaxTiles(); ++i) {
+    const dtMeshTile* tile = nm->getTile(i);
+    if (tile && tile->header) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+void buildNavMesh(NavMesh& navMesh, int tileSize)
+{
+  std::vector<float> positions;
+  std::vector<int> indices;
+  createGround(20, positions, indices);
+  navMesh.build(positions.data(), static_cast<int>(positions.size() / 3), indices.data(),
+                static_cast<int>(indices.size()), createConfig(tileSize));
+}
+
+} // end of anonymous namespace
+
+TEST(TestRecastJSNavMesh, TiledBuildMatchesSingleTileBuild)
+{
+  using BABYLON::Extensions::NavMesh;
+  using BABYLON::Extensions::Vec3;
+
+  NavMesh singleTile;
+  buildNavMesh(singleTile, 0);
+  NavMesh tiled;
+  buildNavMesh(tiled, 32);
+
+  ASSERT_NE(singleTile.getNavMesh(), nullptr);
+  ASSERT_NE(tiled.getNavMesh(), nullptr);
+  EXPECT_EQ(countTiles(singleTile), 1);
+  EXPECT_GT(countTiles(tiled), 1);
+  EXPECT_TRUE(tiled.isTiled());
+
+  const Vec3 start(-8.f, 0.f, -8.f);
+  const Vec3 end(8.f, 0.f, 8.f);
+  auto singleTilePath = singleTile.computePath(start, end);
+  auto tiledPath      = tiled.computePath(start, end);
+  ASSERT_GE(tiledPath.getPointCount(), 2);
+  ASSERT_GE(singleTilePath.getPointCount(), 2);
+  const auto& last = tiledPath.getPoint(tiledPath.getPointCount() - 1);
+  EXPECT_NEAR(last.x, end.x, 0.5f);
+  EXPECT_NEAR(last.z, end.z, 0.5f);
+
+  singleTile.destroy();
+  tiled.destroy();
+}
+
+TEST(TestRecastJSNavMesh, TemporaryObstacles)
+{
+  using BABYLON::Extensions::NavMesh;
+  using BABYLON::Extensions::Vec3;
+
+  NavMesh navMesh;
+  buildNavMesh(navMesh, 32);
+
+  const Vec3 start(0.f, 0.f, -5.f);
+  const Vec3 end(0.f, 0.f, 5.f);
+  EXPECT_EQ(navMesh.computePath(start, end).getPointCount(), 2);
+
+  // Wall between start and end
+  const auto obstacle = navMesh.addBoxObstacle(Vec3(0.f, 0.f, 0.f), Vec3(5.f, 2.f, 0.5f), 0.f);
+  ASSERT_NE(obstacle, 0u);
+  while (!navMesh.update()) {
+  }
+  EXPECT_GT(navMesh.computePath(start, end).getPointCount(), 2);
+
+  navMesh.removeObstacle(obstacle);
+  while (!navMesh.update()) {
+  }
+  EXPECT_EQ(navMesh.computePath(start, end).getPointCount(), 2);
+
+  navMesh.destroy();
+}
+
+TEST(TestRecastJSNavMesh, PartialGeometryUpdate)
+{
+  using BABYLON::Extensions::NavMesh;
+  using BABYLON::Extensions::Vec3;
+
+  NavMesh navMesh;
+  buildNavMesh(navMesh, 32);
+  EXPECT_NEAR(navMesh.getClosestPoint(Vec3(6.f, 0.f, 0.f)).x, 6.f, 0.1f);
+
+  // Cut the ground at x = 2
+  std::vector<float> positions;
+  std::vector<int> indices;
+  createGround(20, positions, indices, 2.f);
+  EXPECT_TRUE(navMesh.updateGeometry(positions.data(), static_cast<int>(positions.size() / 3),
+                                     indices.data(), static_cast<int>(indices.size()),
+                                     Vec3(2.f, -1.f, -10.f), Vec3(10.f, 1.f, 10.f)));
+
+  EXPECT_LT(navMesh.getClosestPoint(Vec3(6.f, 0.f, 0.f)).x, 2.f);
+  EXPECT_NEAR(navMesh.getClosestPoint(Vec3(-6.f, 0.f, 0.f)).x, -6.f, 0.1f);
+
+  navMesh.destroy();
+}
+
+TEST(TestRecastJSNavMesh, GeometryUpdateKeepsObstacles)
+{
+  using BABYLON::Extensions::NavMesh;
+  using BABYLON::Extensions::Vec3;
+
+  NavMesh singleTile;
+  buildNavMesh(singleTile, 0);
+  std::vector<float> positions;
+  std::vector<int> indices;
+  createGround(20, positions, indices);
+  EXPECT_FALSE(singleTile.updateGeometry(positions.data(), static_cast<int>(positions.size() / 3),
+                                         indices.data(), static_cast<int>(indices.size()),
+                                         Vec3(-10.f, -1.f, -10.f), Vec3(10.f, 1.f, 10.f)));
+  singleTile.destroy();
+
+  // Wall of cylinders between start and end, more than the tile cache request queue holds
+  NavMesh navMesh;
+  buildNavMesh(navMesh, 32);
+  for (int i = 0; i <= 80; ++i) {
+    const auto x = -5.f + static_cast<float>(i) * 0.125f;
+    ASSERT_NE(navMesh.addCylinderObstacle(Vec3(x, 0.f, 0.f), 0.3f, 2.f), 0u);
+  }
+  while (!navMesh.update()) {
+  }
+  const Vec3 start(0.f, 0.f, -5.f);
+  const Vec3 end(0.f, 0.f, 5.f);
+  EXPECT_GT(navMesh.computePath(start, end).getPointCount(), 2);
+
+  // The obstacles are moved on top of the rebuilt tiles
+  EXPECT_TRUE(navMesh.updateGeometry(positions.data(), static_cast<int>(positions.size() / 3),
+                                     indices.data(), static_cast<int>(indices.size()),
+                                     Vec3(-10.f, -1.f, -10.f), Vec3(10.f, 1.f, 10.f)));
+  EXPECT_GT(navMesh.computePath(start, end).getPointCount(), 2);
+
+  navMesh.destroy();
+}
+
+TEST(TestRecastJSNavMesh, TiledBuildRejectsOversizedTiles)
+{
+  using BABYLON::Extensions::NavMesh;
+
+  // 250 cells plus a border of 4 cells on each side does not fit in the 8 bit layer size
+  NavMesh oversized;
+  buildNavMesh(oversized, 250);
+  EXPECT_EQ(oversized.getNavMesh(), nullptr);
+  EXPECT_FALSE(oversized.isTiled());
+
+  NavMesh largest;
+  buildNavMesh(largest, 247);
+  ASSERT_NE(largest.getNavMesh(), nullptr);
+  EXPECT_TRUE(largest.isTiled());
+  EXPECT_GT(countTiles(largest), 0);
+
+  oversized.destroy();
+  largest.destroy();
+}
+
+TEST(TestRecastJSNavMesh, PluginWithoutNavMesh)
+{
+  using namespace BABYLON;
+
+  Extensions::RecastJSPlugin plugin;
+  EXPECT_EQ(plugin.addCylinderObstacle(Vector3(0.f, 0.f, 0.f), 1.f, 2.f), 0u);
+  EXPECT_EQ(plugin.addBoxObstacle(Vector3(0.f, 0.f, 0.f), Vector3(1.f, 1.f, 1.f), 0.f), 0u);
+  plugin.removeObstacle(1);
+  EXPECT_TRUE(plugin.updateObstacles());
+  EXPECT_FALSE(plugin.updateNavMesh({}, Vector3(-1.f, -1.f, -1.f), Vector3(1.f, 1.f, 1.f)));
+
+  std::vector<Vector3> points{Vector3(0.f, 0.f, 0.f)};
+  std::vector<size_t> pointCounts{1};
+  plugin.getClosestPoints({Vector3(0.f, 0.f, 0.f)}, points);
+  EXPECT_TRUE(points.empty());
+  plugin.getRandomPointsAround({Vector3(0.f, 0.f, 0.f)}, 1.f, points);
+  EXPECT_TRUE(points.empty());
+  plugin.computePaths({Vector3(0.f, 0.f, 0.f)}, {Vector3(1.f, 0.f, 1.f)}, 8, points, pointCounts);
+  EXPECT_TRUE(points.empty());
+  EXPECT_TRUE(pointCounts.empty());
+}
+
+TEST(TestRecastJSNavMesh, TiledNavmeshDataRoundTrip)
+{
+  using BABYLON::Extensions::NavMesh;
+  using BABYLON::Extensions::Vec3;
+
+  NavMesh navMesh;
+  buildNavMesh(navMesh, 32);
+  auto data = navMesh.getNavmeshData();
+  ASSERT_NE(data.dataPointer, nullptr);
+
+  NavMesh loaded;
+  loaded.buildFromNavmeshData(&data);
+  navMesh.freeNavmeshData(&data);
+  EXPECT_EQ(countTiles(loaded), countTiles(navMesh));
+
+  const Vec3 start(-8.f, 0.f, -8.f);
+  const Vec3 end(8.f, 0.f, 8.f);
+  auto path       = navMesh.computePath(start, end);
+  auto loadedPath = loaded.computePath(start, end);
+  ASSERT_EQ(path.getPointCount(), loadedPath.getPointCount());
+  for (int i = 0; i < path.getPointCount(); ++i) {
+    EXPECT_FLOAT_EQ(path.getPoint(i).x, loadedPath.getPoint(i).x);
+    EXPECT_FLOAT_EQ(path.getPoint(i).z, loadedPath.getPoint(i).z);
+  }
+
+  navMesh.destroy();
+  loaded.destroy();
+}
+
+TEST(TestRecastJSNavMesh, BatchedQueriesMatchSingleQueries)
+{
+  using BABYLON::Extensions::NavMesh;
+  using BABYLON::Extensions::Vec3;
+
+  NavMesh navMesh;
+  buildNavMesh(navMesh, 32);
+  // Wall in the middle, so that the paths are not all straight lines
+  navMesh.addBoxObstacle(Vec3(0.f, 0.f, 0.f), Vec3(6.f, 2.f, 0.5f), 0.f);
+  while (!navMesh.update()) {
+  }
+
+  const size_t count = 500;
+  std::vector<Vec3> starts(count), ends(count);
+  for (size_t i = 0; i < count; ++i) {
+    const float t = static_cast<float>(i);
+    starts[i]     = Vec3(-9.f + std::fmod(t * 0.37f, 18.f), 0.5f, -9.f + std::fmod(t * 0.11f, 8.f));
+    ends[i]       = Vec3(9.f - std::fmod(t * 0.23f, 18.f), 0.5f, 9.f - std::fmod(t * 0.13f, 8.f));
+  }
+
+  // Closest points
+  std::vector<Vec3> closestPoints(count);
+  navMesh.getClosestPoints(starts.data(), count, closestPoints.data());
+  for (size_t i = 0; i < count; ++i) {
+    const auto expected = navMesh.getClosestPoint(starts[i]);
+    EXPECT_FLOAT_EQ(closestPoints[i].x, expected.x);
+    EXPECT_FLOAT_EQ(closestPoints[i].y, expected.y);
+    EXPECT_FLOAT_EQ(closestPoints[i].z, expected.z);
+  }
+
+  // Paths
+  const int maxPoints = 32;
+  std::vector<Vec3> points(count * maxPoints);
+  std::vector<int> pointCounts(count);
+  navMesh.computePaths(starts.data(), ends.data(), count, points.data(), maxPoints,
+                       pointCounts.data());
+  for (size_t i = 0; i < count; ++i) {
+    auto path = navMesh.computePath(starts[i], ends[i]);
+    ASSERT_EQ(pointCounts[i], path.getPointCount());
+    EXPECT_GE(pointCounts[i], 2);
+    for (int pt = 0; pt < pointCounts[i]; ++pt) {
+      const auto& point = points[i * maxPoints + static_cast<size_t>(pt)];
+      EXPECT_FLOAT_EQ(point.x, path.getPoint(pt).x);
+      EXPECT_FLOAT_EQ(point.y, path.getPoint(pt).y);
+      EXPECT_FLOAT_EQ(point.z, path.getPoint(pt).z);
+    }
+  }
+
+  // Random points: reproducible for a given seed, and on the navmesh
+  const float maxRadius = 2.f;
+  std::vector<Vec3> randomPoints(count), randomPoints2(count);
+  navMesh.getRandomPointsAround(closestPoints.data(), count, maxRadius, 42, randomPoints.data());
+  navMesh.getRandomPointsAround(closestPoints.data(), count, maxRadius, 42, randomPoints2.data());
+  for (size_t i = 0; i < count; ++i) {
+    EXPECT_FLOAT_EQ(randomPoints[i].x, randomPoints2[i].x);
+    EXPECT_FLOAT_EQ(randomPoints[i].z, randomPoints2[i].z);
+    const auto onNavMesh = navMesh.getClosestPoint(randomPoints[i]);
+    EXPECT_NEAR(onNavMesh.x, randomPoints[i].x, 1e-3f);
+    EXPECT_NEAR(onNavMesh.z, randomPoints[i].z, 1e-3f);
+  }
+
+  navMesh.destroy();
+}
+
+TEST(TestRecastJSNavMesh, BatchedQueriesWithoutNavMesh)
+{
+  using BABYLON::Extensions::NavMesh;
+  using BABYLON::Extensions::Vec3;
+
+  NavMesh navMesh;
+  const std::vector<Vec3> positions{Vec3(1.f, 2.f, 3.f), Vec3(-1.f, 0.f, 1.f)};
+  std::vector<Vec3> results(positions.size(), Vec3(5.f, 5.f, 5.f));
+  navMesh.getClosestPoints(positions.data(), positions.size(), results.data());
+  for (const auto& result : results) {
+    EXPECT_EQ(result.x, 0.f);
+    EXPECT_EQ(result.y, 0.f);
+    EXPECT_EQ(result.z, 0.f);
+  }
+
+  std::vector<Vec3> points(positions.size() * 4);
+  std::vector<int> pointCounts(positions.size(), -1);
+  navMesh.computePaths(positions.data(), positions.data(), positions.size(), points.data(), 4,
+                       pointCounts.data());
+  EXPECT_THAT(pointCounts, ::testing::Each(0));
+}
@@ -402,7 +402,7 @@ void MixMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh)
   if (!_defines) {
     return;
   }
-  auto defines = *_defines;
+  auto& defines = *_defines;
 
   auto effect = subMesh->effect();
   if (!effect) {
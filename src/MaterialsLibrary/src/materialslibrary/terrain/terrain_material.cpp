@@ -355,7 +355,7 @@ void TerrainMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
   if (!_defines) {
     return;
   }
-  auto defines = *_defines;
+  auto& defines = *_defines;
 
   auto effect = subMesh->effect();
   if (!effect) {
@@ -348,7 +348,7 @@ void TriPlanarMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMe
   if (!_defines) {
     return;
   }
-  auto defines = *_defines;
+  auto& defines = *_defines;
 
   auto effect = subMesh->effect();
   if (!effect) {
@@ -449,7 +449,7 @@ void WaterMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh)
   if (!_defines) {
     return;
   }
-  auto defines = *_defines;
+  auto& defines = *_defines;
 
   auto effect = subMesh->effect();
   if (!effect || !_mesh) {
@@ -2,6 +2,7 @@
 #define BABYLONCPP_SAMPLE_SPAWN_H
 
 #include <babylon/babylon_api.h>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -20,6 +21,7 @@ struct BABYLON_SHARED_EXPORT SpawnResult
 {
   int ExitStatus = -99;
   bool MaxExecutionTimePassed = false;
+  double ElapsedSeconds = 0.;
   std::string StdOutErr = "";
 };
 
@@ -31,6 +33,33 @@ BABYLON_SHARED_EXPORT SpawnResult SpawnWaitSubProcess(
 
 BABYLON_SHARED_EXPORT bool ReadScreenshot_IsImageEmpty(const std::string & sampleName);
 
+// Reads the raw (encoded) content of the version of a file committed in the HEAD of its
+// git repository (via "git show"), returns an empty buffer if the file is not committed
+BABYLON_SHARED_EXPORT std::vector<unsigned char> ReadCommittedFileBytes(const std::string & fileName);
+
+// Writes back a buffer returned by ReadCommittedFileBytes
+BABYLON_SHARED_EXPORT bool WriteFileBytes(const std::string & fileName, const std::vector<unsigned char> & bytes);
+
+// Screenshots whose similarity with their committed version is above this threshold
+// are considered unchanged
+constexpr double ScreenshotSimilarityThreshold = 0.65;
+
+// Structural similarity index (SSIM, 7x7 uniform window) between two 8 bits grayscale images
+// of the same size (width * height pixels, row by row)
+BABYLON_SHARED_EXPORT double ComputeGrayImageSimilarity(
+  const std::vector<unsigned char> & referencePixels,
+  const std::vector<unsigned char> & imagePixels,
+  int width, int height
+);
+
+// Structural similarity index (SSIM, 7x7 uniform window) between the grayscale versions
+// of an encoded reference image and an image file. The image is resized to the reference
+// size if needed. Returns std::nullopt if one of the images cannot be decoded.
+BABYLON_SHARED_EXPORT std::optional<double> ComputeImageSimilarity(
+  const std::vector<unsigned char> & referenceImageBytes,
+  const std::string & imageFileName
+);
+
 } // namespace Samples
 } // namespace BABYLON
 
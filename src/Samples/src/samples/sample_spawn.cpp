@@ -7,13 +7,40 @@
 #include "subprocess_cpp_wrapper.h"
 #include <stdexcept>
 #include <atomic>
+#include <fstream>
+#include <functional>
 #include <future>
+#include <mutex>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#endif
 
 #include <babylon/samples/sample_spawn.h>
 
 namespace BABYLON {
 namespace Samples {
 
+namespace {
+// Serializes the process creations: several samples can be spawned concurrently from
+// different threads, and a child must not inherit the pipes of its siblings (otherwise
+// a sibling pipe would stay open until this child exits, and its reader would hang)
+std::mutex gSpawnMutex;
+
+void SetCloseOnExec(FILE* file)
+{
+#ifndef _WIN32
+  if (file) {
+    int fd = fileno(file);
+    fcntl(fd, F_SETFD, fcntl(fd, F_GETFD) | FD_CLOEXEC);
+  }
+#else
+  (void)file;
+#endif
+}
+} // namespace
+
 SpawnResult SpawnWaitSubProcess(
   const std::vector<std::string> & command,
   const SpawnOptions& spawnOptions
@@ -32,11 +59,15 @@ SpawnResult SpawnWaitSubProcess(
     processOptions = processOptions | subprocess_option_inherit_environment;
 
 
-  int resultCreateProcess = subprocess_create_cpp(
-    command, subprocess_option_inherit_environment | subprocess_option_combined_stdout_stderr,
-    &subProcess);
-  if (0 != resultCreateProcess)
-    throw std::runtime_error("spawnScreenshots: Error while spawning screenshot process");
+  {
+    std::lock_guard<std::mutex> lock(gSpawnMutex);
+    int resultCreateProcess = subprocess_create_cpp(command, processOptions, &subProcess);
+    if (0 != resultCreateProcess)
+      throw std::runtime_error("spawnScreenshots: Error while spawning screenshot process");
+    SetCloseOnExec(subprocess_stdin(&subProcess));
+    SetCloseOnExec(subprocess_stdout(&subProcess));
+    SetCloseOnExec(subprocess_stderr(&subProcess));
+  }
   Timer timer;
   timer.start();
 
@@ -50,7 +81,7 @@ SpawnResult SpawnWaitSubProcess(
       if (spawnOptions.CopyOutputToMainProgramOutput)
         printf("%s", line);
 
-      spawnResult.StdOutErr = spawnResult.StdOutErr + line;
+      spawnResult.StdOutErr += line;
     }
   };
 
@@ -79,6 +110,7 @@ SpawnResult SpawnWaitSubProcess(
 
   fclose(outPipe);
   subprocess_join(&subProcess, &spawnResult.ExitStatus);
+  spawnResult.ElapsedSeconds = timer.getElapsedTimeInSec();
   return spawnResult;
 }
 
@@ -121,5 +153,193 @@ bool ReadScreenshot_IsImageEmpty(const std::string & sampleName)
 }
 
 
+bool WriteFileBytes(const std::string & fileName, const std::vector<unsigned char> & bytes)
+{
+  std::ofstream ofs(fileName, std::ios::binary | std::ios::trunc);
+  if (!ofs)
+    return false;
+  ofs.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  return static_cast<bool>(ofs);
+}
+
+
+std::vector<unsigned char> ReadCommittedFileBytes(const std::string & fileName)
+{
+  // The output of "git show" is binary: it is read with fread, not line by line
+  // as in SpawnWaitSubProcess
+  auto separatorPosition = fileName.find_last_of("/\\");
+  std::string folder = (separatorPosition == std::string::npos) ? "." : fileName.substr(0, separatorPosition);
+  std::string baseName = (separatorPosition == std::string::npos) ? fileName : fileName.substr(separatorPosition + 1);
+  std::vector<std::string> command = {"git", "-C", folder, "show", "HEAD:./" + baseName};
+
+  struct subprocess_s subProcess;
+  {
+    std::lock_guard<std::mutex> lock(gSpawnMutex);
+    if (0 != subprocess_create_cpp(command, subprocess_option_inherit_environment, &subProcess))
+      return {};
+    SetCloseOnExec(subprocess_stdin(&subProcess));
+    SetCloseOnExec(subprocess_stdout(&subProcess));
+    SetCloseOnExec(subprocess_stderr(&subProcess));
+  }
+
+  std::vector<unsigned char> bytes;
+  unsigned char buffer[4096];
+  FILE* outPipe = subprocess_stdout(&subProcess);
+  size_t nbRead = 0;
+  while ((nbRead = fread(buffer, 1, sizeof buffer, outPipe)) > 0)
+    bytes.insert(bytes.end(), buffer, buffer + nbRead);
+
+  int exitStatus = -1;
+  subprocess_join(&subProcess, &exitStatus);
+  subprocess_destroy(&subProcess);
+  if (exitStatus != 0)
+    return {};
+  return bytes;
+}
+
+
+namespace {
+struct GrayImage {
+  int Width = 0;
+  int Height = 0;
+  std::vector<double> Pixels;
+};
+
+std::optional<GrayImage> ToGrayImage(unsigned char * data, int w, int h)
+{
+  if (data == NULL)
+    return std::nullopt;
+  GrayImage image;
+  image.Width = w;
+  image.Height = h;
+  image.Pixels.assign(data, data + static_cast<size_t>(w) * static_cast<size_t>(h));
+  stbi_image_free(data);
+  return image;
+}
+
+GrayImage ResizeNearest(const GrayImage & image, int w, int h)
+{
+  GrayImage resized;
+  resized.Width = w;
+  resized.Height = h;
+  resized.Pixels.resize(static_cast<size_t>(w) * static_cast<size_t>(h));
+  for (int y = 0; y < h; ++y) {
+    int srcY = y * image.Height / h;
+    for (int x = 0; x < w; ++x) {
+      int srcX = x * image.Width / w;
+      resized.Pixels[static_cast<size_t>(y) * w + x]
+        = image.Pixels[static_cast<size_t>(srcY) * image.Width + srcX];
+    }
+  }
+  return resized;
+}
+
+// Summed area table, with one extra row and column of zeros
+std::vector<double> SummedAreaTable(int w, int h, const std::function<double(size_t)>& value)
+{
+  std::vector<double> table(static_cast<size_t>(w + 1) * static_cast<size_t>(h + 1), 0.);
+  for (int y = 0; y < h; ++y) {
+    double rowSum = 0.;
+    for (int x = 0; x < w; ++x) {
+      rowSum += value(static_cast<size_t>(y) * w + x);
+      table[static_cast<size_t>(y + 1) * (w + 1) + (x + 1)]
+        = table[static_cast<size_t>(y) * (w + 1) + (x + 1)] + rowSum;
+    }
+  }
+  return table;
+}
+
+// Same computation as skimage.metrics.structural_similarity with its default parameters
+// (uniform 7x7 window, sample covariance, mean over the window centers that fit in the image)
+double StructuralSimilarity(const GrayImage & a, const GrayImage & b)
+{
+  constexpr int windowSize = 7;
+  const int w = a.Width, h = a.Height;
+  if ((w < windowSize) || (h < windowSize))
+    return (a.Pixels == b.Pixels) ? 1. : 0.;
+
+  const auto& pa = a.Pixels;
+  const auto& pb = b.Pixels;
+  auto sumA  = SummedAreaTable(w, h, [&](size_t i) { return pa[i]; });
+  auto sumB  = SummedAreaTable(w, h, [&](size_t i) { return pb[i]; });
+  auto sumAA = SummedAreaTable(w, h, [&](size_t i) { return pa[i] * pa[i]; });
+  auto sumBB = SummedAreaTable(w, h, [&](size_t i) { return pb[i] * pb[i]; });
+  auto sumAB = SummedAreaTable(w, h, [&](size_t i) { return pa[i] * pb[i]; });
+
+  auto windowSum = [w](const std::vector<double>& table, int x, int y) {
+    const size_t stride = static_cast<size_t>(w + 1);
+    const size_t x0 = static_cast<size_t>(x), y0 = static_cast<size_t>(y);
+    const size_t x1 = x0 + windowSize, y1 = y0 + windowSize;
+    return table[y1 * stride + x1] - table[y0 * stride + x1] - table[y1 * stride + x0]
+           + table[y0 * stride + x0];
+  };
+
+  constexpr double dataRange = 255.;
+  constexpr double C1 = (0.01 * dataRange) * (0.01 * dataRange);
+  constexpr double C2 = (0.03 * dataRange) * (0.03 * dataRange);
+  constexpr double NP = windowSize * windowSize;
+  constexpr double covNorm = NP / (NP - 1.);
+
+  double ssimSum = 0.;
+  for (int y = 0; y + windowSize <= h; ++y) {
+    for (int x = 0; x + windowSize <= w; ++x) {
+      double ux = windowSum(sumA, x, y) / NP;
+      double uy = windowSum(sumB, x, y) / NP;
+      double vx = covNorm * (windowSum(sumAA, x, y) / NP - ux * ux);
+      double vy = covNorm * (windowSum(sumBB, x, y) / NP - uy * uy);
+      double vxy = covNorm * (windowSum(sumAB, x, y) / NP - ux * uy);
+      ssimSum += ((2. * ux * uy + C1) * (2. * vxy + C2))
+                 / ((ux * ux + uy * uy + C1) * (vx + vy + C2));
+    }
+  }
+  double nbWindows = static_cast<double>(w - windowSize + 1) * static_cast<double>(h - windowSize + 1);
+  return ssimSum / nbWindows;
+}
+} // namespace
+
+
+double ComputeGrayImageSimilarity(
+  const std::vector<unsigned char> & referencePixels,
+  const std::vector<unsigned char> & imagePixels,
+  int width, int height
+)
+{
+  GrayImage reference, image;
+  reference.Width = image.Width = width;
+  reference.Height = image.Height = height;
+  reference.Pixels.assign(referencePixels.begin(), referencePixels.end());
+  image.Pixels.assign(imagePixels.begin(), imagePixels.end());
+  return StructuralSimilarity(reference, image);
+}
+
+
+std::optional<double> ComputeImageSimilarity(
+  const std::vector<unsigned char> & referenceImageBytes,
+  const std::string & imageFileName
+)
+{
+  if (referenceImageBytes.empty())
+    return std::nullopt;
+
+  int w = 0, h = 0, n = 0;
+  int force_1_channel = 1;
+  unsigned char *referenceData = stbi_load_from_memory(
+    referenceImageBytes.data(), static_cast<int>(referenceImageBytes.size()), &w, &h, &n,
+    force_1_channel);
+  auto reference = ToGrayImage(referenceData, w, h);
+  if (!reference)
+    return std::nullopt;
+  unsigned char *imageData = stbi_load(imageFileName.c_str(), &w, &h, &n, force_1_channel);
+  auto image = ToGrayImage(imageData, w, h);
+  if (!image)
+    return std::nullopt;
+
+  if ((image->Width != reference->Width) || (image->Height != reference->Height))
+    image = ResizeNearest(*image, reference->Width, reference->Height);
+
+  return StructuralSimilarity(*reference, *image);
+}
+
+
 } // namespace Samples
 } // namespace BABYLON
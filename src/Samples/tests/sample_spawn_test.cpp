@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <babylon/samples/sample_spawn.h>
+
+namespace {
+
+// Grayscale image with horizontal and vertical structures (gradient and stripes)
+std::vector<unsigned char> createTestImage(int width, int height)
+{
+  std::vector<unsigned char> pixels(static_cast<size_t>(width) * static_cast<size_t>(height));
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      int value = (x * 200) / width + (((y / 4) % 2 == 0) ? 40 : 0);
+      pixels[static_cast<size_t>(y) * width + x] = static_cast<unsigned char>(value);
+    }
+  }
+  return pixels;
+}
+
+} // namespace
+
+TEST(TestSampleSpawn, ComputeGrayImageSimilarity_IdenticalImages)
+{
+  using namespace BABYLON::Samples;
+  const int width = 64, height = 48;
+  auto image = createTestImage(width, height);
+  EXPECT_NEAR(ComputeGrayImageSimilarity(image, image, width, height), 1., 1e-9);
+}
+
+TEST(TestSampleSpawn, ComputeGrayImageSimilarity_PerturbedImages)
+{
+  using namespace BABYLON::Samples;
+  const int width = 64, height = 48;
+  auto image = createTestImage(width, height);
+
+  // A slight brightness change keeps the image similar
+  auto brighter = image;
+  for (auto& pixel : brighter)
+    pixel = static_cast<unsigned char>(pixel + 2);
+  EXPECT_GT(ComputeGrayImageSimilarity(image, brighter, width, height),
+            ScreenshotSimilarityThreshold);
+
+  // Strong noise destroys the structure
+  auto noisy = image;
+  unsigned int seed = 12345;
+  for (auto& pixel : noisy) {
+    seed = seed * 1103515245u + 12345u;
+    pixel = static_cast<unsigned char>((pixel + (seed >> 16) % 160) % 256);
+  }
+  EXPECT_LT(ComputeGrayImageSimilarity(image, noisy, width, height),
+            ScreenshotSimilarityThreshold);
+}